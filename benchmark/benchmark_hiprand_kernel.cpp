@@ -0,0 +1,329 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Compares device functions of hipRAND with the rocRAND functions they wrap:
+// the same kernel is run with hiprand_*() and rocrand_*() calls on the same
+// states, both variants are expected to have the same throughput.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <numeric>
+#include <algorithm>
+#include <type_traits>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <hiprand_kernel.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#ifndef DEFAULT_RAND_N
+const size_t DEFAULT_RAND_N = 1024 * 1024 * 128;
+#endif
+
+static_assert(std::is_same<hiprandStateXORWOW_t, rocrand_state_xorwow>::value, "");
+static_assert(std::is_same<hiprandStateMRG32k3a_t, rocrand_state_mrg32k3a>::value, "");
+static_assert(std::is_same<hiprandStatePhilox4_32_10_t, rocrand_state_philox4x32_10>::value, "");
+
+template<typename GeneratorState>
+__global__
+void init_kernel(GeneratorState * states,
+                 const unsigned long long seed,
+                 const unsigned long long offset)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    GeneratorState state;
+    hiprand_init(seed, state_id, offset, &state);
+    states[state_id] = state;
+}
+
+template<typename T, typename GeneratorState, typename GenerateFunc>
+__global__
+void generate_kernel(GeneratorState * states,
+                     T * data,
+                     const size_t size,
+                     GenerateFunc generate_func)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state = states[state_id];
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        data[index] = generate_func(&state);
+        index += stride;
+    }
+    states[state_id] = state;
+}
+
+template<typename T, typename GeneratorState, typename GenerateFunc>
+double run_benchmark(const cli::Parser& parser,
+                     const GenerateFunc& generate_func)
+{
+    const size_t size = parser.get<size_t>("size");
+    const size_t trials = parser.get<size_t>("trials");
+
+    const size_t blocks = parser.get<size_t>("blocks");
+    const size_t threads = parser.get<size_t>("threads");
+
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+    GeneratorState * states;
+    HIP_CHECK(hipMalloc((void **)&states, blocks * threads * sizeof(GeneratorState)));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(init_kernel),
+        dim3(blocks), dim3(threads), 0, 0,
+        states, 12345ULL, 6789ULL
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    // Warm-up
+    for (size_t i = 0; i < 5; i++)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(generate_kernel),
+            dim3(blocks), dim3(threads), 0, 0,
+            states, data, size, generate_func
+        );
+        HIP_CHECK(hipPeekAtLastError());
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Measurement
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < trials; i++)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(generate_kernel),
+            dim3(blocks), dim3(threads), 0, 0,
+            states, data, size, generate_func
+        );
+    }
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+
+    HIP_CHECK(hipFree(states));
+    HIP_CHECK(hipFree(data));
+
+    return (trials * size) / (elapsed.count() / 1e3 * (1 << 30));
+}
+
+template<typename T, typename GeneratorState, typename HiprandFunc, typename RocrandFunc>
+void run_pair(const cli::Parser& parser,
+              const HiprandFunc& hiprand_func,
+              const RocrandFunc& rocrand_func)
+{
+    const double hiprand_samples = run_benchmark<T, GeneratorState>(parser, hiprand_func);
+    const double rocrand_samples = run_benchmark<T, GeneratorState>(parser, rocrand_func);
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "      "
+              << "hipRAND = "
+              << std::setw(8) << hiprand_samples
+              << " GSample/s, rocRAND = "
+              << std::setw(8) << rocrand_samples
+              << " GSample/s, hipRAND/rocRAND = "
+              << std::setw(6) << hiprand_samples / rocrand_samples
+              << std::endl;
+}
+
+template<typename GeneratorState>
+void run_benchmarks(const cli::Parser& parser,
+                    const std::string& distribution)
+{
+    if (distribution == "uniform-uint")
+    {
+        run_pair<unsigned int, GeneratorState>(parser,
+            [] __device__ (GeneratorState * state) { return hiprand(state); },
+            [] __device__ (GeneratorState * state) { return rocrand(state); }
+        );
+    }
+    if (distribution == "uniform-float")
+    {
+        run_pair<float, GeneratorState>(parser,
+            [] __device__ (GeneratorState * state) { return hiprand_uniform(state); },
+            [] __device__ (GeneratorState * state) { return rocrand_uniform(state); }
+        );
+    }
+    if (distribution == "uniform-double")
+    {
+        run_pair<double, GeneratorState>(parser,
+            [] __device__ (GeneratorState * state) { return hiprand_uniform_double(state); },
+            [] __device__ (GeneratorState * state) { return rocrand_uniform_double(state); }
+        );
+    }
+    if (distribution == "normal-float")
+    {
+        run_pair<float, GeneratorState>(parser,
+            [] __device__ (GeneratorState * state) { return hiprand_normal(state); },
+            [] __device__ (GeneratorState * state) { return rocrand_normal(state); }
+        );
+    }
+    if (distribution == "normal-double")
+    {
+        run_pair<double, GeneratorState>(parser,
+            [] __device__ (GeneratorState * state) { return hiprand_normal_double(state); },
+            [] __device__ (GeneratorState * state) { return rocrand_normal_double(state); }
+        );
+    }
+    if (distribution == "log-normal-float")
+    {
+        run_pair<float, GeneratorState>(parser,
+            [] __device__ (GeneratorState * state) { return hiprand_log_normal(state, 0.0f, 1.0f); },
+            [] __device__ (GeneratorState * state) { return rocrand_log_normal(state, 0.0f, 1.0f); }
+        );
+    }
+    if (distribution == "poisson")
+    {
+        run_pair<unsigned int, GeneratorState>(parser,
+            [] __device__ (GeneratorState * state) { return hiprand_poisson(state, 10.0); },
+            [] __device__ (GeneratorState * state) { return rocrand_poisson(state, 10.0); }
+        );
+    }
+}
+
+const std::vector<std::string> all_engines = {
+    "xorwow",
+    "mrg32k3a",
+    "philox",
+};
+
+const std::vector<std::string> all_distributions = {
+    "uniform-uint",
+    "uniform-float",
+    "uniform-double",
+    "normal-float",
+    "normal-double",
+    "log-normal-float",
+    "poisson",
+};
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string distribution_desc =
+        "space-separated list of distributions:" +
+        std::accumulate(all_distributions.begin(), all_distributions.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<size_t>("size", "size", DEFAULT_RAND_N, "number of values");
+    parser.set_optional<size_t>("trials", "trials", 20, "number of trials");
+    parser.set_optional<size_t>("blocks", "blocks", 256, "number of blocks");
+    parser.set_optional<size_t>("threads", "threads", 256, "number of threads in each block");
+    parser.set_optional<std::vector<std::string>>("dis", "dis", {"uniform-uint"}, distribution_desc.c_str());
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"all"}, engine_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    std::vector<std::string> engines;
+    {
+        auto es = parser.get<std::vector<std::string>>("engine");
+        if (std::find(es.begin(), es.end(), "all") != es.end())
+        {
+            engines = all_engines;
+        }
+        else
+        {
+            for (auto e : all_engines)
+            {
+                if (std::find(es.begin(), es.end(), e) != es.end())
+                    engines.push_back(e);
+            }
+        }
+    }
+
+    std::vector<std::string> distributions;
+    {
+        auto ds = parser.get<std::vector<std::string>>("dis");
+        if (std::find(ds.begin(), ds.end(), "all") != ds.end())
+        {
+            distributions = all_distributions;
+        }
+        else
+        {
+            for (auto d : all_distributions)
+            {
+                if (std::find(ds.begin(), ds.end(), d) != ds.end())
+                    distributions.push_back(d);
+            }
+        }
+    }
+
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::cout << "Runtime: " << runtime_version << " ";
+    std::cout << "Device: " << props.name;
+    std::cout << std::endl << std::endl;
+
+    for (auto engine : engines)
+    {
+        std::cout << engine << ":" << std::endl;
+        for (auto distribution : distributions)
+        {
+            std::cout << "  " << distribution << ":" << std::endl;
+            if (engine == "xorwow")
+            {
+                run_benchmarks<hiprandStateXORWOW_t>(parser, distribution);
+            }
+            else if (engine == "mrg32k3a")
+            {
+                run_benchmarks<hiprandStateMRG32k3a_t>(parser, distribution);
+            }
+            else if (engine == "philox")
+            {
+                run_benchmarks<hiprandStatePhilox4_32_10_t>(parser, distribution);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,277 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Compares the target-specialized wide multiplies and modular reductions
+// used by Philox4x32-10 and MRG32k3a (rocrand_common.h) with portable
+// 64-bit arithmetic. The library code is compiled separately for every
+// entry of AMDGPU_TARGETS, run this benchmark on each architecture to see
+// the gain of the specialized paths.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+#include <rocrand_kernel.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status status = condition;           \
+    if(status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << status << " line: " << __LINE__ << std::endl; \
+        exit(status); \
+    } \
+  }
+
+struct philox_specialized
+{
+    __device__
+    uint4 operator()(uint4 counter, uint2 key) const
+    {
+        return rocrand_device::detail::philox4x32_10_ten_rounds(counter, key);
+    }
+};
+
+struct philox_portable
+{
+    __device__
+    uint4 round(uint4 counter, uint2 key) const
+    {
+        const unsigned long long p0 =
+            static_cast<unsigned long long>(ROCRAND_PHILOX_M4x32_0) * counter.x;
+        const unsigned long long p1 =
+            static_cast<unsigned long long>(ROCRAND_PHILOX_M4x32_1) * counter.z;
+        return uint4 {
+            static_cast<unsigned int>(p1 >> 32) ^ counter.y ^ key.x,
+            static_cast<unsigned int>(p1),
+            static_cast<unsigned int>(p0 >> 32) ^ counter.w ^ key.y,
+            static_cast<unsigned int>(p0)
+        };
+    }
+
+    __device__
+    uint4 operator()(uint4 counter, uint2 key) const
+    {
+        for(unsigned int i = 0; i < 9; i++)
+        {
+            counter = round(counter, key);
+            key.x += ROCRAND_PHILOX_W32_0;
+            key.y += ROCRAND_PHILOX_W32_1;
+        }
+        return round(counter, key);
+    }
+};
+
+template<typename Rounds>
+__global__
+void philox_kernel(unsigned int * data,
+                   const unsigned int iterations,
+                   Rounds rounds)
+{
+    const unsigned int id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    uint4 counter = { id, 0, 0, 0 };
+    const uint2 key = { 12345, 67890 };
+    unsigned int result = 0;
+    for(unsigned int i = 0; i < iterations; i++)
+    {
+        counter.y = i;
+        const uint4 v = rounds(counter, key);
+        result ^= v.x ^ v.y ^ v.z ^ v.w;
+    }
+    data[id] = result;
+}
+
+// Gives the portable implementation access to the engine's state
+struct mrg32k3a_state : public rocrand_state_mrg32k3a
+{
+    __device__ unsigned int * g1() { return m_state.g1; }
+    __device__ unsigned int * g2() { return m_state.g2; }
+};
+
+struct mrg32k3a_specialized
+{
+    __device__
+    unsigned int operator()(mrg32k3a_state * state) const
+    {
+        return state->next();
+    }
+};
+
+struct mrg32k3a_portable
+{
+    __device__
+    unsigned int operator()(mrg32k3a_state * state) const
+    {
+        // Same recurrence as mrg32k3a_engine::next() with generic 64-bit
+        // remainders
+        unsigned int * g1 = state->g1();
+        unsigned int * g2 = state->g2();
+        const unsigned int p1 = static_cast<unsigned int>(
+            (static_cast<unsigned long long>(ROCRAND_MRG32K3A_A12) * g1[1]
+             + static_cast<unsigned long long>(ROCRAND_MRG32K3A_A13N) * (ROCRAND_MRG32K3A_M1 - g1[0]))
+            % ROCRAND_MRG32K3A_M1
+        );
+        g1[0] = g1[1]; g1[1] = g1[2]; g1[2] = p1;
+        const unsigned int p2 = static_cast<unsigned int>(
+            (static_cast<unsigned long long>(ROCRAND_MRG32K3A_A21) * g2[2]
+             + static_cast<unsigned long long>(ROCRAND_MRG32K3A_A23N) * (ROCRAND_MRG32K3A_M2 - g2[0]))
+            % ROCRAND_MRG32K3A_M2
+        );
+        g2[0] = g2[1]; g2[1] = g2[2]; g2[2] = p2;
+        return (p1 - p2) + (p1 <= p2 ? ROCRAND_MRG32K3A_M1 : 0);
+    }
+};
+
+template<typename Next>
+__global__
+void mrg32k3a_kernel(unsigned int * data,
+                     const unsigned int iterations,
+                     Next next)
+{
+    const unsigned int id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    mrg32k3a_state state;
+    rocrand_init(12345ULL, id, 0, &state);
+    unsigned int result = 0;
+    for(unsigned int i = 0; i < iterations; i++)
+    {
+        result ^= next(&state);
+    }
+    data[id] = result;
+}
+
+template<typename Kernel, typename Op>
+void run_benchmark(const cli::Parser& parser,
+                   const std::string& name,
+                   Kernel kernel,
+                   Op op,
+                   std::vector<unsigned int>& results)
+{
+    const size_t trials = parser.get<size_t>("trials");
+    const size_t blocks = parser.get<size_t>("blocks");
+    const size_t threads = parser.get<size_t>("threads");
+    const unsigned int iterations = parser.get<unsigned int>("iterations");
+    const size_t size = blocks * threads;
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    // Warm-up
+    for (size_t i = 0; i < 5; i++)
+    {
+        hipLaunchKernelGGL(kernel, dim3(blocks), dim3(threads), 0, 0, data, iterations, op);
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+    }
+
+    // Measurement
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < trials; i++)
+    {
+        hipLaunchKernelGGL(kernel, dim3(blocks), dim3(threads), 0, 0, data, iterations, op);
+    }
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+
+    results.resize(size);
+    HIP_CHECK(hipMemcpy(results.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "  " << std::setw(12) << std::left << name << std::right
+              << " Steps = "
+              << std::setw(8) << (trials * size * iterations) /
+                    (elapsed.count() / 1e3 * 1e9)
+              << " G/s, AvgTime (1 trial) = "
+              << std::setw(8) << elapsed.count() / trials
+              << " ms" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    parser.set_optional<size_t>("trials", "trials", 20, "number of trials");
+    parser.set_optional<size_t>("blocks", "blocks", 1024, "number of blocks");
+    parser.set_optional<size_t>("threads", "threads", 256, "number of threads in each block");
+    parser.set_optional<unsigned int>("iterations", "iterations", 1024, "number of generator steps per thread");
+    parser.run_and_exit_if_error();
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::cout << "rocRAND: " << version << " ";
+    std::cout << "Runtime: " << runtime_version << " ";
+    std::cout << "Device: " << props.name;
+    #ifdef __HIP_PLATFORM_HCC__
+    std::cout << " (gfx" << props.gcnArch << ")";
+    #else
+    std::cout << " (sm_" << props.major << props.minor << ")";
+    #endif
+    std::cout << std::endl << std::endl;
+
+    std::vector<unsigned int> specialized;
+    std::vector<unsigned int> portable;
+
+    std::cout << "philox (10 rounds):" << std::endl;
+    run_benchmark(parser, "specialized", philox_kernel<philox_specialized>,
+                  philox_specialized(), specialized);
+    run_benchmark(parser, "portable", philox_kernel<philox_portable>,
+                  philox_portable(), portable);
+    if (specialized != portable)
+    {
+        std::cout << "  results differ" << std::endl;
+        return 1;
+    }
+
+    std::cout << "mrg32k3a:" << std::endl;
+    run_benchmark(parser, "specialized", mrg32k3a_kernel<mrg32k3a_specialized>,
+                  mrg32k3a_specialized(), specialized);
+    run_benchmark(parser, "portable", mrg32k3a_kernel<mrg32k3a_portable>,
+                  mrg32k3a_portable(), portable);
+    if (specialized != portable)
+    {
+        std::cout << "  results differ" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,394 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Side-by-side comparison of host API generate functions of rocRAND and
+// cuRAND (cuRAND only when built with NVCC). The same engine x distribution
+// x size matrix is run on both backends with the same timing (events on the
+// generator's stream), the report contains throughputs, the ratio
+// rocRAND / cuRAND and the achieved bandwidth (bytes written per second) as
+// a fraction of the peak memory bandwidth of the device.
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#ifdef __HIP_PLATFORM_NVCC__
+#include <curand.h>
+#endif
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#ifndef DEFAULT_RAND_N
+const size_t DEFAULT_RAND_N = 1024 * 1024 * 128;
+#endif
+
+struct engine_info
+{
+    std::string name;
+    rocrand_rng_type rocrand_type;
+#ifdef __HIP_PLATFORM_NVCC__
+    curandRngType_t curand_type;
+#endif
+};
+
+#ifdef __HIP_PLATFORM_NVCC__
+#define ENGINE(name, rocrand_type, curand_type) { name, rocrand_type, curand_type }
+#else
+#define ENGINE(name, rocrand_type, curand_type) { name, rocrand_type }
+#endif
+
+const std::vector<engine_info> all_engines = {
+    ENGINE("xorwow", ROCRAND_RNG_PSEUDO_XORWOW, CURAND_RNG_PSEUDO_XORWOW),
+    ENGINE("mrg32k3a", ROCRAND_RNG_PSEUDO_MRG32K3A, CURAND_RNG_PSEUDO_MRG32K3A),
+    ENGINE("mtgp32", ROCRAND_RNG_PSEUDO_MTGP32, CURAND_RNG_PSEUDO_MTGP32),
+    ENGINE("mt19937", ROCRAND_RNG_PSEUDO_MT19937, CURAND_RNG_PSEUDO_MT19937),
+    ENGINE("philox", ROCRAND_RNG_PSEUDO_PHILOX4_32_10, CURAND_RNG_PSEUDO_PHILOX4_32_10),
+    ENGINE("sobol32", ROCRAND_RNG_QUASI_SOBOL32, CURAND_RNG_QUASI_SOBOL32),
+    ENGINE("scrambled_sobol32", ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32, CURAND_RNG_QUASI_SCRAMBLED_SOBOL32),
+    ENGINE("sobol64", ROCRAND_RNG_QUASI_SOBOL64, CURAND_RNG_QUASI_SOBOL64),
+    ENGINE("scrambled_sobol64", ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64, CURAND_RNG_QUASI_SCRAMBLED_SOBOL64),
+};
+
+#undef ENGINE
+
+const std::vector<std::string> all_distributions = {
+    "uniform-uint",
+    "uniform-long-long",
+    "uniform-float",
+    "uniform-double",
+    "normal-float",
+    "normal-double",
+    "log-normal-float",
+    "log-normal-double",
+    "poisson"
+};
+
+// Bytes of one value of a distribution
+size_t value_size(const std::string& distribution)
+{
+    if (distribution == "uniform-long-long"
+        || distribution == "uniform-double"
+        || distribution == "normal-double"
+        || distribution == "log-normal-double")
+    {
+        return 8;
+    }
+    return 4;
+}
+
+// Generators of both backends share this interface: create returns false
+// if the engine is not supported, generate returns false if the
+// distribution is not supported by the engine
+struct rocrand_backend
+{
+    static const char * name() { return "rocRAND"; }
+
+    rocrand_generator generator;
+
+    bool create(const engine_info& engine, hipStream_t stream, const size_t dimensions)
+    {
+        if (rocrand_create_generator(&generator, engine.rocrand_type) != ROCRAND_STATUS_SUCCESS)
+            return false;
+        rocrand_set_stream(generator, stream);
+        // Fails with ROCRAND_STATUS_TYPE_ERROR for pseudo-random engines
+        rocrand_set_quasi_random_generator_dimensions(generator, dimensions);
+        return true;
+    }
+
+    void destroy()
+    {
+        rocrand_destroy_generator(generator);
+    }
+
+    bool generate(const std::string& distribution, void * data, const size_t size, const double lambda)
+    {
+        rocrand_status status = ROCRAND_STATUS_TYPE_ERROR;
+        if (distribution == "uniform-uint")
+            status = rocrand_generate(generator, static_cast<unsigned int *>(data), size);
+        else if (distribution == "uniform-long-long")
+            status = rocrand_generate_long_long(generator, static_cast<unsigned long long *>(data), size);
+        else if (distribution == "uniform-float")
+            status = rocrand_generate_uniform(generator, static_cast<float *>(data), size);
+        else if (distribution == "uniform-double")
+            status = rocrand_generate_uniform_double(generator, static_cast<double *>(data), size);
+        else if (distribution == "normal-float")
+            status = rocrand_generate_normal(generator, static_cast<float *>(data), size, 0.0f, 1.0f);
+        else if (distribution == "normal-double")
+            status = rocrand_generate_normal_double(generator, static_cast<double *>(data), size, 0.0, 1.0);
+        else if (distribution == "log-normal-float")
+            status = rocrand_generate_log_normal(generator, static_cast<float *>(data), size, 0.0f, 1.0f);
+        else if (distribution == "log-normal-double")
+            status = rocrand_generate_log_normal_double(generator, static_cast<double *>(data), size, 0.0, 1.0);
+        else if (distribution == "poisson")
+            status = rocrand_generate_poisson(generator, static_cast<unsigned int *>(data), size, lambda);
+        return status == ROCRAND_STATUS_SUCCESS;
+    }
+};
+
+#ifdef __HIP_PLATFORM_NVCC__
+struct curand_backend
+{
+    static const char * name() { return "cuRAND"; }
+
+    curandGenerator_t generator;
+
+    bool create(const engine_info& engine, hipStream_t stream, const size_t dimensions)
+    {
+        if (curandCreateGenerator(&generator, engine.curand_type) != CURAND_STATUS_SUCCESS)
+            return false;
+        curandSetStream(generator, stream);
+        // Fails with CURAND_STATUS_TYPE_ERROR for pseudo-random engines
+        curandSetQuasiRandomGeneratorDimensions(generator, dimensions);
+        return true;
+    }
+
+    void destroy()
+    {
+        curandDestroyGenerator(generator);
+    }
+
+    bool generate(const std::string& distribution, void * data, const size_t size, const double lambda)
+    {
+        curandStatus_t status = CURAND_STATUS_TYPE_ERROR;
+        if (distribution == "uniform-uint")
+            status = curandGenerate(generator, static_cast<unsigned int *>(data), size);
+        else if (distribution == "uniform-long-long")
+            status = curandGenerateLongLong(generator, static_cast<unsigned long long *>(data), size);
+        else if (distribution == "uniform-float")
+            status = curandGenerateUniform(generator, static_cast<float *>(data), size);
+        else if (distribution == "uniform-double")
+            status = curandGenerateUniformDouble(generator, static_cast<double *>(data), size);
+        else if (distribution == "normal-float")
+            status = curandGenerateNormal(generator, static_cast<float *>(data), size, 0.0f, 1.0f);
+        else if (distribution == "normal-double")
+            status = curandGenerateNormalDouble(generator, static_cast<double *>(data), size, 0.0, 1.0);
+        else if (distribution == "log-normal-float")
+            status = curandGenerateLogNormal(generator, static_cast<float *>(data), size, 0.0f, 1.0f);
+        else if (distribution == "log-normal-double")
+            status = curandGenerateLogNormalDouble(generator, static_cast<double *>(data), size, 0.0, 1.0);
+        else if (distribution == "poisson")
+            status = curandGeneratePoisson(generator, static_cast<unsigned int *>(data), size, lambda);
+        return status == CURAND_STATUS_SUCCESS;
+    }
+};
+#endif
+
+// Returns throughput in GB/s (bytes written), or a negative value if
+// the combination is not supported by the backend
+template<typename Backend>
+double measure(const engine_info& engine,
+               const std::string& distribution,
+               const size_t size,
+               const size_t dimensions,
+               const size_t trials,
+               const double lambda)
+{
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+    void * data;
+    HIP_CHECK(hipMalloc(&data, size * value_size(distribution)));
+
+    double throughput = -1.0;
+    Backend backend;
+    if (backend.create(engine, stream, dimensions))
+    {
+        // Warm-up
+        bool supported = true;
+        for (size_t i = 0; i < 5 && supported; i++)
+        {
+            supported = backend.generate(distribution, data, size, lambda);
+        }
+        if (supported)
+        {
+            HIP_CHECK(hipStreamSynchronize(stream));
+            HIP_CHECK(hipEventRecord(start, stream));
+            for (size_t i = 0; i < trials; i++)
+            {
+                backend.generate(distribution, data, size, lambda);
+            }
+            HIP_CHECK(hipEventRecord(stop, stream));
+            HIP_CHECK(hipEventSynchronize(stop));
+            float elapsed;
+            HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+            throughput = (trials * size * value_size(distribution)) / (elapsed / 1e3) / 1e9;
+        }
+        backend.destroy();
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipStreamDestroy(stream));
+    return throughput;
+}
+
+std::string format_value(const double value, const int precision, const std::string& suffix = "")
+{
+    if (value < 0.0)
+    {
+        return "-";
+    }
+    std::ostringstream s;
+    s << std::fixed << std::setprecision(precision) << value << suffix;
+    return s.str();
+}
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    std::vector<std::string> engine_names;
+    for (auto e : all_engines) engine_names.push_back(e.name);
+    const std::string distribution_desc =
+        "space-separated list of distributions:" +
+        std::accumulate(all_distributions.begin(), all_distributions.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(engine_names.begin(), engine_names.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<std::vector<size_t>>("size", "size",
+        {1024 * 1024, 16 * 1024 * 1024, DEFAULT_RAND_N},
+        "space-separated list of numbers of values (rounded up to multiples of dimensions)");
+    parser.set_optional<size_t>("dimensions", "dimensions", 1, "number of dimensions of quasi-random values");
+    parser.set_optional<size_t>("trials", "trials", 20, "number of trials");
+    parser.set_optional<double>("lambda", "lambda", 10.0, "lambda of Poisson distribution");
+    parser.set_optional<std::vector<std::string>>("dis", "dis", {"all"}, distribution_desc.c_str());
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"all"}, engine_desc.c_str());
+    parser.set_optional<bool>("csv", "csv", false, "print the report as CSV");
+    parser.run_and_exit_if_error();
+
+    const auto es = parser.get<std::vector<std::string>>("engine");
+    const bool all_es = std::find(es.begin(), es.end(), "all") != es.end();
+    const auto ds = parser.get<std::vector<std::string>>("dis");
+    const bool all_ds = std::find(ds.begin(), ds.end(), "all") != ds.end();
+    const size_t dimensions = parser.get<size_t>("dimensions");
+    const size_t trials = parser.get<size_t>("trials");
+    const double lambda = parser.get<double>("lambda");
+    const bool csv = parser.get<bool>("csv");
+
+    int version;
+    rocrand_get_version(&version);
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+    // Double data rate: 2 transfers per clock (kHz) of memoryBusWidth bits
+    const double peak_bandwidth =
+        2.0 * props.memoryClockRate * 1e3 * (props.memoryBusWidth / 8) / 1e9;
+
+    if (!csv)
+    {
+        std::cout << "rocRAND: " << version << " "
+                  << "Device: " << props.name << " "
+                  << "Peak memory bandwidth: " << std::fixed << std::setprecision(1)
+                  << peak_bandwidth << " GB/s" << std::endl << std::endl;
+    }
+
+    const std::vector<std::string> columns = {
+        "engine", "distribution", "size",
+        "rocRAND GB/s", "rocRAND % peak",
+        "cuRAND GB/s", "cuRAND % peak",
+        "rocRAND/cuRAND"
+    };
+    const std::vector<int> widths = { 18, 18, 10, 13, 15, 13, 15, 15 };
+    auto print_row = [&](const std::vector<std::string>& cells) {
+        for (size_t i = 0; i < cells.size(); i++)
+        {
+            if (csv)
+                std::cout << (i > 0 ? "," : "") << cells[i];
+            else
+                std::cout << std::setw(widths[i]) << cells[i];
+        }
+        std::cout << std::endl;
+    };
+    print_row(columns);
+
+    for (auto engine : all_engines)
+    {
+        if (!all_es && std::find(es.begin(), es.end(), engine.name) == es.end())
+            continue;
+        for (auto distribution : all_distributions)
+        {
+            if (!all_ds && std::find(ds.begin(), ds.end(), distribution) == ds.end())
+                continue;
+            for (size_t s : parser.get<std::vector<size_t>>("size"))
+            {
+                const size_t size = (s + dimensions - 1) / dimensions * dimensions;
+                const double rocrand_throughput = measure<rocrand_backend>(
+                    engine, distribution, size, dimensions, trials, lambda
+                );
+#ifdef __HIP_PLATFORM_NVCC__
+                const double curand_throughput = measure<curand_backend>(
+                    engine, distribution, size, dimensions, trials, lambda
+                );
+#else
+                const double curand_throughput = -1.0;
+#endif
+                if (rocrand_throughput < 0.0 && curand_throughput < 0.0)
+                    continue;
+
+                const double ratio = rocrand_throughput >= 0.0 && curand_throughput > 0.0
+                    ? rocrand_throughput / curand_throughput
+                    : -1.0;
+                print_row({
+                    engine.name, distribution, std::to_string(size),
+                    format_value(rocrand_throughput, 3),
+                    format_value(rocrand_throughput < 0.0 ? -1.0 : 100.0 * rocrand_throughput / peak_bandwidth, 1),
+                    format_value(curand_throughput, 3),
+                    format_value(curand_throughput < 0.0 ? -1.0 : 100.0 * curand_throughput / peak_bandwidth, 1),
+                    format_value(ratio, 3)
+                });
+            }
+        }
+    }
+
+    return 0;
+}
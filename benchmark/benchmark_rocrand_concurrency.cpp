@@ -0,0 +1,334 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Concurrency scaling benchmark, built on Google Benchmark: K generators on
+// K streams generate concurrently, benchmarks are named
+// <engine>/<distribution>/<size>/streams:<K>.
+//
+// Time of an iteration is the wall time from enqueuing of the first call
+// until all streams are finished, bytes and items per second are aggregate
+// throughputs of all generators. Every stream also records events around
+// its calls; "fairness" is Jain's index of throughputs of streams (1 when
+// all streams progress equally, 1/K when one stream gets the whole device)
+// and "slowest_ratio" is the time of the slowest stream divided by the time
+// of the fastest one.
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+#include <benchmark/benchmark.h>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+typedef rocrand_rng_type rng_type_t;
+
+template<typename T>
+using generate_func_type = std::function<rocrand_status(rocrand_generator, T *, size_t)>;
+
+struct benchmark_config
+{
+    rng_type_t rng_type;
+    size_t size;
+    size_t streams;
+    size_t trials;
+};
+
+template<typename T>
+void run_benchmark(benchmark::State& state,
+                   const benchmark_config config,
+                   generate_func_type<T> generate_func)
+{
+    const size_t k = config.streams;
+    const size_t size = config.size;
+
+    std::vector<hipStream_t> streams(k);
+    std::vector<hipEvent_t> starts(k);
+    std::vector<hipEvent_t> stops(k);
+    std::vector<T *> data(k);
+    std::vector<rocrand_generator> generators(k);
+    for (size_t i = 0; i < k; i++)
+    {
+        HIP_CHECK(hipStreamCreateWithFlags(&streams[i], hipStreamNonBlocking));
+        HIP_CHECK(hipEventCreate(&starts[i]));
+        HIP_CHECK(hipEventCreate(&stops[i]));
+        HIP_CHECK(hipMalloc((void **)&data[i], size * sizeof(T)));
+        ROCRAND_CHECK(rocrand_create_generator(&generators[i], config.rng_type));
+        ROCRAND_CHECK(rocrand_set_stream(generators[i], streams[i]));
+        // Generators produce different sequences as in real workloads
+        ROCRAND_CHECK(rocrand_set_seed(generators[i], 1234ULL + i));
+    }
+
+    // Warm-up (initialization of generators), combinations not supported
+    // by the generator are skipped
+    rocrand_status status = ROCRAND_STATUS_SUCCESS;
+    for (size_t i = 0; i < k && status == ROCRAND_STATUS_SUCCESS; i++)
+    {
+        status = generate_func(generators[i], data[i], size);
+    }
+    if (status == ROCRAND_STATUS_SUCCESS)
+    {
+        HIP_CHECK(hipDeviceSynchronize());
+
+        double fairness = 0.0;
+        double slowest_ratio = 0.0;
+        std::vector<float> times(k);
+        for (auto _ : state)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            for (size_t i = 0; i < k; i++)
+            {
+                HIP_CHECK(hipEventRecord(starts[i], streams[i]));
+            }
+            // Calls are interleaved so no stream gets a head start of
+            // more than one call
+            for (size_t t = 0; t < config.trials; t++)
+            {
+                for (size_t i = 0; i < k; i++)
+                {
+                    ROCRAND_CHECK(generate_func(generators[i], data[i], size));
+                }
+            }
+            for (size_t i = 0; i < k; i++)
+            {
+                HIP_CHECK(hipEventRecord(stops[i], streams[i]));
+            }
+            for (size_t i = 0; i < k; i++)
+            {
+                HIP_CHECK(hipEventSynchronize(stops[i]));
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<double> elapsed = end - start;
+            state.SetIterationTime(elapsed.count());
+
+            // Throughputs of streams are proportional to 1 / time
+            double sum = 0.0;
+            double sum2 = 0.0;
+            for (size_t i = 0; i < k; i++)
+            {
+                HIP_CHECK(hipEventElapsedTime(&times[i], starts[i], stops[i]));
+                const double x = 1.0 / std::max(times[i], 1e-6f);
+                sum += x;
+                sum2 += x * x;
+            }
+            fairness += (sum * sum) / (k * sum2);
+            slowest_ratio += *std::max_element(times.begin(), times.end()) /
+                             std::max(*std::min_element(times.begin(), times.end()), 1e-6f);
+        }
+
+        const int64_t values = static_cast<int64_t>(state.iterations() * config.trials * k * size);
+        state.SetBytesProcessed(values * sizeof(T));
+        state.SetItemsProcessed(values);
+        state.counters["streams"] = static_cast<double>(k);
+        state.counters["fairness"] = fairness / state.iterations();
+        state.counters["slowest_ratio"] = slowest_ratio / state.iterations();
+    }
+    else
+    {
+        std::ostringstream message;
+        message << "not supported (status " << status << ")";
+        state.SkipWithError(message.str().c_str());
+    }
+
+    for (size_t i = 0; i < k; i++)
+    {
+        ROCRAND_CHECK(rocrand_destroy_generator(generators[i]));
+        HIP_CHECK(hipFree(data[i]));
+        HIP_CHECK(hipEventDestroy(starts[i]));
+        HIP_CHECK(hipEventDestroy(stops[i]));
+        HIP_CHECK(hipStreamDestroy(streams[i]));
+    }
+}
+
+template<typename T>
+void register_benchmark(const std::string& name,
+                        const benchmark_config& config,
+                        const size_t repetitions,
+                        generate_func_type<T> generate_func)
+{
+    benchmark::RegisterBenchmark(name.c_str(),
+        [config, generate_func](benchmark::State& state) {
+            run_benchmark<T>(state, config, generate_func);
+        }
+    )
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(static_cast<int>(repetitions));
+}
+
+void register_benchmarks(const cli::Parser& parser,
+                         const std::string& engine,
+                         const std::string& distribution,
+                         const benchmark_config& config)
+{
+    const size_t repetitions = parser.get<size_t>("repetitions");
+    std::ostringstream name;
+    name << engine << "/" << distribution << "/" << config.size
+         << "/streams:" << config.streams;
+
+    if (distribution == "uniform-uint")
+    {
+        register_benchmark<unsigned int>(name.str(), config, repetitions,
+            [](rocrand_generator gen, unsigned int * data, size_t size) {
+                return rocrand_generate(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "uniform-float")
+    {
+        register_benchmark<float>(name.str(), config, repetitions,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_uniform(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "normal-float")
+    {
+        register_benchmark<float>(name.str(), config, repetitions,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_normal(gen, data, size, 0.0f, 1.0f);
+            }
+        );
+    }
+}
+
+const std::vector<std::pair<std::string, rng_type_t>> all_engines = {
+    { "xorwow", ROCRAND_RNG_PSEUDO_XORWOW },
+    { "mrg32k3a", ROCRAND_RNG_PSEUDO_MRG32K3A },
+    { "mtgp32", ROCRAND_RNG_PSEUDO_MTGP32 },
+    { "philox", ROCRAND_RNG_PSEUDO_PHILOX4_32_10 },
+    { "sobol32", ROCRAND_RNG_QUASI_SOBOL32 },
+    { "scrambled_sobol32", ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 },
+};
+
+const std::vector<std::string> all_distributions = {
+    "uniform-uint",
+    "uniform-float",
+    "normal-float",
+};
+
+int main(int argc, char *argv[])
+{
+    // Google Benchmark's flags (--benchmark_out, --benchmark_format,
+    // --benchmark_filter etc.) are consumed first
+    benchmark::Initialize(&argc, argv);
+
+    cli::Parser parser(argc, argv);
+
+    std::vector<std::string> engine_names;
+    for (auto e : all_engines) engine_names.push_back(e.first);
+    const std::string distribution_desc =
+        "space-separated list of distributions:" +
+        std::accumulate(all_distributions.begin(), all_distributions.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(engine_names.begin(), engine_names.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<std::vector<size_t>>("size", "size", {64 * 1024, 1024 * 1024},
+        "space-separated list of numbers of values of every generator and call");
+    parser.set_optional<std::vector<size_t>>("streams", "streams", {1, 2, 4, 8, 16, 32, 64},
+        "space-separated list of numbers of concurrent generators and streams");
+    parser.set_optional<size_t>("trials", "trials", 10, "number of calls of every generator in one timed iteration");
+    parser.set_optional<size_t>("repetitions", "repetitions", 5, "number of repetitions of each benchmark for mean, median and stddev");
+    parser.set_optional<std::vector<std::string>>("dis", "dis", {"uniform-uint"}, distribution_desc.c_str());
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    const auto es = parser.get<std::vector<std::string>>("engine");
+    const bool all_es = std::find(es.begin(), es.end(), "all") != es.end();
+    const auto ds = parser.get<std::vector<std::string>>("dis");
+    const bool all_ds = std::find(ds.begin(), ds.end(), "all") != ds.end();
+    for (auto engine : all_engines)
+    {
+        if (!all_es && std::find(es.begin(), es.end(), engine.first) == es.end())
+            continue;
+        for (auto distribution : all_distributions)
+        {
+            if (!all_ds && std::find(ds.begin(), ds.end(), distribution) == ds.end())
+                continue;
+            for (size_t size : parser.get<std::vector<size_t>>("size"))
+            {
+                for (size_t streams : parser.get<std::vector<size_t>>("streams"))
+                {
+                    benchmark_config config;
+                    config.rng_type = engine.second;
+                    config.size = size;
+                    config.streams = std::max<size_t>(streams, 1);
+                    config.trials = parser.get<size_t>("trials");
+                    register_benchmarks(parser, engine.first, distribution, config);
+                }
+            }
+        }
+    }
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    benchmark::AddCustomContext("rocrand_version", std::to_string(version));
+    benchmark::AddCustomContext("hip_runtime_version", std::to_string(runtime_version));
+    benchmark::AddCustomContext("device_name", props.name);
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,363 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Benchmarks of discrete distributions, built on Google Benchmark:
+//
+//   construct/custom/<size>          rocrand_create_discrete_distribution
+//   construct/poisson/<lambda>       rocrand_create_poisson_distribution
+//   sample/<alias|cdf>/custom/<size> sampling in a kernel (Philox)
+//   sample/<alias|cdf>/poisson/<lambda>
+//   generate_poisson/<fixed|changing>/<lambda>
+//                                    rocrand_generate_poisson of the host API
+//                                    with the same lambda in every call or with
+//                                    a new lambda in every call (every call
+//                                    builds new tables)
+//
+// Construction includes the host build of tables, allocations and copies,
+// it is timed by the wall clock. Sampling and generate_poisson are timed by
+// events.
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <random>
+#include <utility>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+#include <rocrand_kernel.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+enum class sampling_method
+{
+    alias,
+    cdf
+};
+
+template<sampling_method Method>
+__global__
+void sample_kernel(unsigned int * data,
+                   const size_t size,
+                   const rocrand_discrete_distribution discrete_distribution)
+{
+    const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    rocrand_state_philox4x32_10 state;
+    rocrand_init(12345ULL, thread_id, 0, &state);
+
+    for(size_t index = thread_id; index < size; index += stride)
+    {
+        const unsigned int r = rocrand(&state);
+        data[index] = Method == sampling_method::alias
+            ? rocrand_device::detail::discrete_alias(r, *discrete_distribution)
+            : rocrand_device::detail::discrete_cdf(r, *discrete_distribution);
+    }
+}
+
+// Unnormalized weights of a custom distribution of size values
+std::vector<double> custom_weights(const size_t size)
+{
+    std::mt19937 engine(size);
+    std::uniform_real_distribution<double> weight(0.0, 1.0);
+    std::vector<double> weights(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        weights[i] = weight(engine);
+    }
+    return weights;
+}
+
+// Creates a custom distribution (lambda < 0) or a Poisson distribution
+rocrand_status create_distribution(const std::vector<double>& weights,
+                                   const double lambda,
+                                   rocrand_discrete_distribution * discrete_distribution)
+{
+    if (lambda < 0.0)
+    {
+        return rocrand_create_discrete_distribution(
+            weights.data(), static_cast<unsigned int>(weights.size()), 0, discrete_distribution
+        );
+    }
+    return rocrand_create_poisson_distribution(lambda, discrete_distribution);
+}
+
+void run_construct_benchmark(benchmark::State& state,
+                             const size_t table_size,
+                             const double lambda)
+{
+    const std::vector<double> weights = custom_weights(table_size);
+    for (auto _ : state)
+    {
+        rocrand_discrete_distribution discrete_distribution;
+        auto start = std::chrono::high_resolution_clock::now();
+        ROCRAND_CHECK(create_distribution(weights, lambda, &discrete_distribution));
+        auto end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double> elapsed = end - start;
+        state.SetIterationTime(elapsed.count());
+        ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+    }
+}
+
+template<sampling_method Method>
+void run_sample_benchmark(benchmark::State& state,
+                          const size_t table_size,
+                          const double lambda,
+                          const size_t size,
+                          const size_t trials)
+{
+    const std::vector<double> weights = custom_weights(table_size);
+    rocrand_discrete_distribution discrete_distribution;
+    ROCRAND_CHECK(create_distribution(weights, lambda, &discrete_distribution));
+
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+    const unsigned int threads = 256;
+    const unsigned int blocks = props.multiProcessorCount * 8;
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+
+    // Warm-up
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(sample_kernel<Method>),
+        dim3(blocks), dim3(threads), 0, 0,
+        data, size, discrete_distribution
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for (auto _ : state)
+    {
+        HIP_CHECK(hipEventRecord(start, 0));
+        for (size_t i = 0; i < trials; i++)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(sample_kernel<Method>),
+                dim3(blocks), dim3(threads), 0, 0,
+                data, size, discrete_distribution
+            );
+        }
+        HIP_CHECK(hipEventRecord(stop, 0));
+        HIP_CHECK(hipEventSynchronize(stop));
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+        state.SetIterationTime(elapsed / 1e3);
+    }
+    HIP_CHECK(hipPeekAtLastError());
+
+    const int64_t values = static_cast<int64_t>(state.iterations() * trials * size);
+    state.SetBytesProcessed(values * sizeof(unsigned int));
+    state.SetItemsProcessed(values);
+
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+}
+
+// Every call of rocrand_generate_poisson uses lambda (changing = false) or
+// a lambda not used before (changing = true), so the generator builds
+// tables of a new distribution in every call
+void run_generate_poisson_benchmark(benchmark::State& state,
+                                    const double lambda,
+                                    const bool changing,
+                                    const size_t size,
+                                    const size_t trials)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+
+    // Warm-up
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, lambda));
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    size_t call = 0;
+    for (auto _ : state)
+    {
+        HIP_CHECK(hipEventRecord(start, stream));
+        for (size_t i = 0; i < trials; i++)
+        {
+            call++;
+            const double l = changing ? lambda * (1.0 + 1e-9 * call) : lambda;
+            ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, l));
+        }
+        HIP_CHECK(hipEventRecord(stop, stream));
+        HIP_CHECK(hipEventSynchronize(stop));
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+        state.SetIterationTime(elapsed / 1e3);
+    }
+
+    const int64_t values = static_cast<int64_t>(state.iterations() * trials * size);
+    state.SetBytesProcessed(values * sizeof(unsigned int));
+    state.SetItemsProcessed(values);
+
+    unsigned long long hits, misses;
+    ROCRAND_CHECK(rocrand_get_poisson_cache_stats(generator, &hits, &misses));
+    state.counters["cache_hits"] = static_cast<double>(hits);
+    state.counters["cache_misses"] = static_cast<double>(misses);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(data));
+}
+
+std::string lambda_name(const double lambda)
+{
+    std::ostringstream name;
+    name << std::setprecision(6) << lambda;
+    return name.str();
+}
+
+int main(int argc, char *argv[])
+{
+    // Google Benchmark's flags (--benchmark_out, --benchmark_format,
+    // --benchmark_filter etc.) are consumed first
+    benchmark::Initialize(&argc, argv);
+
+    cli::Parser parser(argc, argv);
+
+    parser.set_optional<std::vector<size_t>>("table-size", "table-size",
+        {10, 100, 1000, 10000, 100000, 1000000, 10000000},
+        "space-separated list of sizes of custom distributions");
+    parser.set_optional<std::vector<double>>("lambda", "lambda",
+        {0.1, 1.0, 10.0, 100.0, 1000.0, 10000.0, 100000.0},
+        "space-separated list of lambdas of Poisson distributions");
+    parser.set_optional<size_t>("size", "size", 1024 * 1024 * 16, "number of values of sampling and generate calls");
+    parser.set_optional<size_t>("trials", "trials", 10, "number of calls of one timed iteration");
+    parser.set_optional<size_t>("repetitions", "repetitions", 5, "number of repetitions of each benchmark for mean, median and stddev");
+    parser.run_and_exit_if_error();
+
+    const auto table_sizes = parser.get<std::vector<size_t>>("table-size");
+    const auto lambdas = parser.get<std::vector<double>>("lambda");
+    const size_t size = parser.get<size_t>("size");
+    const size_t trials = parser.get<size_t>("trials");
+    const int repetitions = static_cast<int>(parser.get<size_t>("repetitions"));
+
+    // Custom distributions are (table size, lambda = -1),
+    // Poisson distributions are (0, lambda)
+    std::vector<std::pair<std::string, std::pair<size_t, double>>> distributions;
+    for (size_t table_size : table_sizes)
+    {
+        distributions.push_back({ "custom/" + std::to_string(table_size), { table_size, -1.0 } });
+    }
+    for (double lambda : lambdas)
+    {
+        distributions.push_back({ "poisson/" + lambda_name(lambda), { 0, lambda } });
+    }
+
+    for (auto d : distributions)
+    {
+        const size_t table_size = d.second.first;
+        const double lambda = d.second.second;
+        benchmark::RegisterBenchmark(("construct/" + d.first).c_str(),
+            [table_size, lambda](benchmark::State& state) {
+                run_construct_benchmark(state, table_size, lambda);
+            }
+        )->UseManualTime()->Unit(benchmark::kMicrosecond)->Repetitions(repetitions);
+    }
+    for (auto d : distributions)
+    {
+        const size_t table_size = d.second.first;
+        const double lambda = d.second.second;
+        benchmark::RegisterBenchmark(("sample/alias/" + d.first).c_str(),
+            [table_size, lambda, size, trials](benchmark::State& state) {
+                run_sample_benchmark<sampling_method::alias>(state, table_size, lambda, size, trials);
+            }
+        )->UseManualTime()->Unit(benchmark::kMillisecond)->Repetitions(repetitions);
+        benchmark::RegisterBenchmark(("sample/cdf/" + d.first).c_str(),
+            [table_size, lambda, size, trials](benchmark::State& state) {
+                run_sample_benchmark<sampling_method::cdf>(state, table_size, lambda, size, trials);
+            }
+        )->UseManualTime()->Unit(benchmark::kMillisecond)->Repetitions(repetitions);
+    }
+    for (double lambda : lambdas)
+    {
+        for (bool changing : { false, true })
+        {
+            const std::string name = std::string("generate_poisson/")
+                + (changing ? "changing/" : "fixed/") + lambda_name(lambda);
+            benchmark::RegisterBenchmark(name.c_str(),
+                [lambda, changing, size, trials](benchmark::State& state) {
+                    run_generate_poisson_benchmark(state, lambda, changing, size, trials);
+                }
+            )->UseManualTime()->Unit(benchmark::kMillisecond)->Repetitions(repetitions);
+        }
+    }
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    benchmark::AddCustomContext("rocrand_version", std::to_string(version));
+    benchmark::AddCustomContext("hip_runtime_version", std::to_string(runtime_version));
+    benchmark::AddCustomContext("device_name", props.name);
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
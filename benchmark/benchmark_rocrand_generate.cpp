@@ -18,14 +18,27 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+// Benchmarks of host API generate functions, built on Google Benchmark.
+// Every engine x distribution x size is a separate benchmark named
+// <engine>/<distribution>/<size>, timed by HIP events on the generator's
+// stream and repeated to report mean, median and stddev. Results are
+// written as JSON or CSV with Google Benchmark's flags, for example:
+//
+//   benchmark_rocrand_generate --engine all --dis all
+//       --benchmark_out=results.json --benchmark_out_format=json
+
 #include <iostream>
 #include <iomanip>
+#include <sstream>
 #include <vector>
 #include <string>
-#include <chrono>
 #include <numeric>
 #include <utility>
 #include <algorithm>
+#include <functional>
+#include <cmath>
+
+#include <benchmark/benchmark.h>
 
 #include "cmdparser.hpp"
 
@@ -59,78 +72,182 @@ typedef rocrand_rng_type rng_type_t;
 template<typename T>
 using generate_func_type = std::function<rocrand_status(rocrand_generator, T *, size_t)>;
 
+struct benchmark_config
+{
+    size_t size;
+    size_t dimensions;
+    size_t trials;
+    bool latency;
+    size_t calls;
+};
+
+// Nearest-rank percentile q of sorted samples
+double percentile(const std::vector<double>& sorted, const double q)
+{
+    const size_t rank = static_cast<size_t>(std::ceil(q * sorted.size()));
+    return sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1];
+}
+
+// Throughput benchmarks: one iteration is `trials` calls of generate_func,
+// all calls are enqueued and timed by events on the generator's stream.
+// Latency benchmarks: one iteration is one synchronized call timed by events
+// recorded before and after it. The start event is reached as soon as it is
+// enqueued on the idle stream, so the latency includes the host side of the
+// call (dispatch, initialization checks, launches) and all its kernels.
 template<typename T>
-void run_benchmark(const cli::Parser& parser,
+void run_benchmark(benchmark::State& state,
                    const rng_type_t rng_type,
+                   const benchmark_config config,
                    generate_func_type<T> generate_func)
 {
-    const size_t size = parser.get<size_t>("size");
-    const size_t trials = parser.get<size_t>("trials");
+    const size_t size = config.size;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
 
     T * data;
     HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
 
     rocrand_generator generator;
     ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
 
-    const size_t dimensions = parser.get<size_t>("dimensions");
-    rocrand_status status = rocrand_set_quasi_random_generator_dimensions(generator, dimensions);
+    rocrand_status status = rocrand_set_quasi_random_generator_dimensions(generator, config.dimensions);
     if (status != ROCRAND_STATUS_TYPE_ERROR) // If the RNG is not quasi-random
     {
         ROCRAND_CHECK(status);
     }
 
-    // Warm-up
-    for (size_t i = 0; i < 5; i++)
+    // Warm-up, combinations not supported by the generator are skipped
+    status = ROCRAND_STATUS_SUCCESS;
+    for (size_t i = 0; i < 5 && status == ROCRAND_STATUS_SUCCESS; i++)
     {
-        ROCRAND_CHECK(generate_func(generator, data, size));
+        status = generate_func(generator, data, size);
     }
-    HIP_CHECK(hipDeviceSynchronize());
+    if (status == ROCRAND_STATUS_SUCCESS)
+    {
+        HIP_CHECK(hipStreamSynchronize(stream));
 
-    // Measurement
-    auto start = std::chrono::high_resolution_clock::now();
-    for (size_t i = 0; i < trials; i++)
+        // Latencies of calls in microseconds
+        std::vector<double> latencies;
+        for (auto _ : state)
+        {
+            if (config.latency)
+            {
+                HIP_CHECK(hipEventRecord(start, stream));
+                ROCRAND_CHECK(generate_func(generator, data, size));
+                HIP_CHECK(hipEventRecord(stop, stream));
+                HIP_CHECK(hipEventSynchronize(stop));
+                float elapsed;
+                HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+                latencies.push_back(elapsed * 1e3);
+                state.SetIterationTime(elapsed / 1e3);
+            }
+            else
+            {
+                HIP_CHECK(hipEventRecord(start, stream));
+                for (size_t i = 0; i < config.trials; i++)
+                {
+                    ROCRAND_CHECK(generate_func(generator, data, size));
+                }
+                HIP_CHECK(hipEventRecord(stop, stream));
+                HIP_CHECK(hipEventSynchronize(stop));
+                float elapsed;
+                HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+                state.SetIterationTime(elapsed / 1e3);
+            }
+        }
+
+        state.counters["size"] = static_cast<double>(size);
+        if (config.latency)
+        {
+            std::sort(latencies.begin(), latencies.end());
+            state.counters["p50_us"] = percentile(latencies, 0.5);
+            state.counters["p90_us"] = percentile(latencies, 0.9);
+            state.counters["p99_us"] = percentile(latencies, 0.99);
+            state.counters["p999_us"] = percentile(latencies, 0.999);
+        }
+        else
+        {
+            const int64_t values = static_cast<int64_t>(state.iterations() * config.trials * size);
+            state.SetBytesProcessed(values * sizeof(T));
+            state.SetItemsProcessed(values);
+            // Seconds of one call
+            state.counters["call_time"] = benchmark::Counter(
+                static_cast<double>(config.trials),
+                benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert
+            );
+        }
+    }
+    else
     {
-        ROCRAND_CHECK(generate_func(generator, data, size));
+        std::ostringstream message;
+        message << "not supported (status " << status << ")";
+        state.SkipWithError(message.str().c_str());
     }
-    HIP_CHECK(hipDeviceSynchronize());
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double, std::milli> elapsed = end - start;
-
-    std::cout << std::fixed << std::setprecision(3)
-              << "      "
-              << "Throughput = "
-              << std::setw(8) << (trials * size * sizeof(T)) /
-                    (elapsed.count() / 1e3 * (1 << 30))
-              << " GB/s, Samples = "
-              << std::setw(8) << (trials * size) /
-                    (elapsed.count() / 1e3 * (1 << 30))
-              << " GSample/s, AvgTime (1 trial) = "
-              << std::setw(8) << elapsed.count() / trials
-              << " ms, Time (all) = "
-              << std::setw(8) << elapsed.count()
-              << " ms, Size = " << size
-              << std::endl;
 
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
     HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipStreamDestroy(stream));
 }
 
-void run_benchmarks(const cli::Parser& parser,
-                    const rng_type_t rng_type,
-                    const std::string& distribution)
+template<typename T>
+void register_benchmark(const std::string& name,
+                        const rng_type_t rng_type,
+                        const benchmark_config& config,
+                        const size_t repetitions,
+                        generate_func_type<T> generate_func)
+{
+    auto b = benchmark::RegisterBenchmark(name.c_str(),
+        [rng_type, config, generate_func](benchmark::State& state) {
+            run_benchmark<T>(state, rng_type, config, generate_func);
+        }
+    );
+    b->UseManualTime()
+     ->Unit(config.latency ? benchmark::kMicrosecond : benchmark::kMillisecond)
+     ->Repetitions(static_cast<int>(repetitions));
+    if (config.latency)
+    {
+        // A fixed number of independent calls for percentiles
+        b->Iterations(static_cast<benchmark::IterationCount>(config.calls));
+    }
+}
+
+void register_benchmarks(const cli::Parser& parser,
+                         const rng_type_t rng_type,
+                         const std::string& engine,
+                         const std::string& distribution,
+                         const benchmark_config& config)
 {
+    const size_t repetitions = parser.get<size_t>("repetitions");
+    std::ostringstream prefix;
+    prefix << engine << "/" << distribution;
+    const std::string suffix = "/" + std::to_string(config.size);
+
     if (distribution == "uniform-uint")
     {
-        run_benchmark<unsigned int>(parser, rng_type,
+        register_benchmark<unsigned int>(prefix.str() + suffix, rng_type, config, repetitions,
             [](rocrand_generator gen, unsigned int * data, size_t size) {
                 return rocrand_generate(gen, data, size);
             }
         );
     }
+    if (distribution == "uniform-long-long")
+    {
+        register_benchmark<unsigned long long>(prefix.str() + suffix, rng_type, config, repetitions,
+            [](rocrand_generator gen, unsigned long long * data, size_t size) {
+                return rocrand_generate_long_long(gen, data, size);
+            }
+        );
+    }
     if (distribution == "uniform-float")
     {
-        run_benchmark<float>(parser, rng_type,
+        register_benchmark<float>(prefix.str() + suffix, rng_type, config, repetitions,
             [](rocrand_generator gen, float * data, size_t size) {
                 return rocrand_generate_uniform(gen, data, size);
             }
@@ -138,15 +255,29 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "uniform-double")
     {
-        run_benchmark<double>(parser, rng_type,
+        register_benchmark<double>(prefix.str() + suffix, rng_type, config, repetitions,
             [](rocrand_generator gen, double * data, size_t size) {
                 return rocrand_generate_uniform_double(gen, data, size);
             }
         );
     }
+    if (distribution == "uniform-double-fast" || distribution == "uniform-double-full")
+    {
+        const rocrand_double_resolution resolution = distribution == "uniform-double-fast"
+            ? ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT
+            : ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT;
+        register_benchmark<double>(prefix.str() + suffix, rng_type, config, repetitions,
+            [resolution](rocrand_generator gen, double * data, size_t size) {
+                const rocrand_status status = rocrand_set_double_resolution(gen, resolution);
+                if (status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+                return rocrand_generate_uniform_double(gen, data, size);
+            }
+        );
+    }
     if (distribution == "normal-float")
     {
-        run_benchmark<float>(parser, rng_type,
+        register_benchmark<float>(prefix.str() + suffix, rng_type, config, repetitions,
             [](rocrand_generator gen, float * data, size_t size) {
                 return rocrand_generate_normal(gen, data, size, 0.0f, 1.0f);
             }
@@ -154,7 +285,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "normal-double")
     {
-        run_benchmark<double>(parser, rng_type,
+        register_benchmark<double>(prefix.str() + suffix, rng_type, config, repetitions,
             [](rocrand_generator gen, double * data, size_t size) {
                 return rocrand_generate_normal_double(gen, data, size, 0.0, 1.0);
             }
@@ -162,7 +293,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "log-normal-float")
     {
-        run_benchmark<float>(parser, rng_type,
+        register_benchmark<float>(prefix.str() + suffix, rng_type, config, repetitions,
             [](rocrand_generator gen, float * data, size_t size) {
                 return rocrand_generate_log_normal(gen, data, size, 0.0f, 1.0f);
             }
@@ -170,7 +301,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "log-normal-double")
     {
-        run_benchmark<double>(parser, rng_type,
+        register_benchmark<double>(prefix.str() + suffix, rng_type, config, repetitions,
             [](rocrand_generator gen, double * data, size_t size) {
                 return rocrand_generate_log_normal_double(gen, data, size, 0.0, 1.0);
             }
@@ -181,41 +312,77 @@ void run_benchmarks(const cli::Parser& parser,
         const auto lambdas = parser.get<std::vector<double>>("lambda");
         for (double lambda : lambdas)
         {
-            std::cout << "    " << "lambda "
-                 << std::fixed << std::setprecision(1) << lambda << std::endl;
-            run_benchmark<unsigned int>(parser, rng_type,
+            std::ostringstream name;
+            name << prefix.str() << "(lambda=" << std::fixed << std::setprecision(1)
+                 << lambda << ")" << suffix;
+            register_benchmark<unsigned int>(name.str(), rng_type, config, repetitions,
                 [lambda](rocrand_generator gen, unsigned int * data, size_t size) {
                     return rocrand_generate_poisson(gen, data, size, lambda);
                 }
             );
         }
     }
+    if (distribution == "permutation" || distribution == "permutation-exact")
+    {
+        const rocrand_permutation_method method = distribution == "permutation"
+            ? ROCRAND_PERMUTATION_METHOD_FEISTEL
+            : ROCRAND_PERMUTATION_METHOD_EXACT;
+        register_benchmark<unsigned int>(prefix.str() + suffix, rng_type, config, repetitions,
+            [method](rocrand_generator gen, unsigned int * data, size_t size) {
+                const rocrand_status status = rocrand_set_permutation_method(gen, method);
+                if (status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+                return rocrand_generate_permutation(gen, data, size);
+            }
+        );
+    }
 }
 
-const std::vector<std::string> all_engines = {
-    "xorwow",
-    "mrg32k3a",
-    "mtgp32",
-    "philox",
-    "sobol32",
+const std::vector<std::pair<std::string, rng_type_t>> all_engines = {
+    { "xorwow", ROCRAND_RNG_PSEUDO_XORWOW },
+    { "mrg32k3a", ROCRAND_RNG_PSEUDO_MRG32K3A },
+    { "mtgp32", ROCRAND_RNG_PSEUDO_MTGP32 },
+    { "philox", ROCRAND_RNG_PSEUDO_PHILOX4_32_10 },
+    { "threefry4x32_20", ROCRAND_RNG_PSEUDO_THREEFRY4_32_20 },
+    { "threefry2x64_20", ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 },
+    { "philox4x64_10", ROCRAND_RNG_PSEUDO_PHILOX4_64_10 },
+    { "xoshiro128pp", ROCRAND_RNG_PSEUDO_XOSHIRO128PP },
+    { "pcg32", ROCRAND_RNG_PSEUDO_PCG32 },
+    { "mt19937", ROCRAND_RNG_PSEUDO_MT19937 },
+    { "sobol32", ROCRAND_RNG_QUASI_SOBOL32 },
+    { "scrambled_sobol32", ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 },
+    { "sobol64", ROCRAND_RNG_QUASI_SOBOL64 },
+    { "scrambled_sobol64", ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 },
+    { "lattice", ROCRAND_RNG_QUASI_LATTICE },
+    { "halton", ROCRAND_RNG_QUASI_HALTON },
 };
 
 const std::vector<std::string> all_distributions = {
     "uniform-uint",
-    // "uniform-long-long",
+    "uniform-long-long",
     "uniform-float",
     "uniform-double",
+    "uniform-double-fast",
+    "uniform-double-full",
     "normal-float",
     "normal-double",
     "log-normal-float",
     "log-normal-double",
-    "poisson"
+    "poisson",
+    "permutation",
+    "permutation-exact"
 };
 
 int main(int argc, char *argv[])
 {
+    // Google Benchmark's flags (--benchmark_out, --benchmark_format,
+    // --benchmark_filter etc.) are consumed first
+    benchmark::Initialize(&argc, argv);
+
     cli::Parser parser(argc, argv);
 
+    std::vector<std::string> engine_names;
+    for (auto e : all_engines) engine_names.push_back(e.first);
     const std::string distribution_desc =
         "space-separated list of distributions:" +
         std::accumulate(all_distributions.begin(), all_distributions.end(), std::string(),
@@ -226,51 +393,63 @@ int main(int argc, char *argv[])
         "\n      or all";
     const std::string engine_desc =
         "space-separated list of random number engines:" +
-        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+        std::accumulate(engine_names.begin(), engine_names.end(), std::string(),
             [](std::string a, std::string b) {
                 return a + "\n      " + b;
             }
         ) +
         "\n      or all";
 
-    parser.set_optional<size_t>("size", "size", DEFAULT_RAND_N, "number of values");
+    parser.set_optional<std::vector<size_t>>("size", "size",
+        {1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024, DEFAULT_RAND_N},
+        "space-separated list of numbers of values (rounded up to multiples of dimensions)");
     parser.set_optional<size_t>("dimensions", "dimensions", 1, "number of dimensions of quasi-random values");
-    parser.set_optional<size_t>("trials", "trials", 20, "number of trials");
+    parser.set_optional<size_t>("trials", "trials", 20, "number of calls of one timed iteration");
+    parser.set_optional<size_t>("repetitions", "repetitions", 5, "number of repetitions of each benchmark for mean, median and stddev");
     parser.set_optional<std::vector<std::string>>("dis", "dis", {"uniform-uint"}, distribution_desc.c_str());
     parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
     parser.set_optional<std::vector<double>>("lambda", "lambda", {10.0}, "space-separated list of lambdas of Poisson distribution");
+    parser.set_optional<bool>("latency", "latency", false, "measure p50/p90/p99/p999 latency of synchronized calls instead of throughput");
+    parser.set_optional<std::vector<size_t>>("latency-size", "latency-size",
+        {1, 64, 4096, 64 * 1024, 1024 * 1024},
+        "space-separated list of numbers of values of --latency");
+    parser.set_optional<size_t>("calls", "calls", 10000, "number of calls of --latency");
     parser.run_and_exit_if_error();
 
-    std::vector<std::string> engines;
+    const auto es = parser.get<std::vector<std::string>>("engine");
+    const bool all_es = std::find(es.begin(), es.end(), "all") != es.end();
+    const auto ds = parser.get<std::vector<std::string>>("dis");
+    const bool all_ds = std::find(ds.begin(), ds.end(), "all") != ds.end();
+    for (auto e : es)
     {
-        auto es = parser.get<std::vector<std::string>>("engine");
-        if (std::find(es.begin(), es.end(), "all") != es.end())
+        auto found = std::find_if(all_engines.begin(), all_engines.end(),
+            [&e](const std::pair<std::string, rng_type_t>& p) { return p.first == e; });
+        if (e != "all" && found == all_engines.end())
         {
-            engines = all_engines;
-        }
-        else
-        {
-            for (auto e : all_engines)
-            {
-                if (std::find(es.begin(), es.end(), e) != es.end())
-                    engines.push_back(e);
-            }
+            std::cout << "Wrong engine name: " << e << std::endl;
+            exit(1);
         }
     }
 
-    std::vector<std::string> distributions;
+    const size_t dimensions = parser.get<size_t>("dimensions");
+    for (auto engine : all_engines)
     {
-        auto ds = parser.get<std::vector<std::string>>("dis");
-        if (std::find(ds.begin(), ds.end(), "all") != ds.end())
+        if (!all_es && std::find(es.begin(), es.end(), engine.first) == es.end())
+            continue;
+        for (auto distribution : all_distributions)
         {
-            distributions = all_distributions;
-        }
-        else
-        {
-            for (auto d : all_distributions)
+            if (!all_ds && std::find(ds.begin(), ds.end(), distribution) == ds.end())
+                continue;
+            const bool latency = parser.get<bool>("latency");
+            for (size_t s : parser.get<std::vector<size_t>>(latency ? "latency-size" : "size"))
             {
-                if (std::find(ds.begin(), ds.end(), d) != ds.end())
-                    distributions.push_back(d);
+                benchmark_config config;
+                config.size = (s + dimensions - 1) / dimensions * dimensions;
+                config.dimensions = dimensions;
+                config.trials = parser.get<size_t>("trials");
+                config.latency = latency;
+                config.calls = parser.get<size_t>("calls");
+                register_benchmarks(parser, engine.second, engine.first, distribution, config);
             }
         }
     }
@@ -284,39 +463,21 @@ int main(int argc, char *argv[])
     hipDeviceProp_t props;
     HIP_CHECK(hipGetDeviceProperties(&props, device_id));
 
-    std::cout << "rocRAND: " << version << " ";
-    std::cout << "Runtime: " << runtime_version << " ";
-    std::cout << "Device: " << props.name;
-    std::cout << std::endl << std::endl;
-
-    for (auto engine : engines)
-    {
-        rng_type_t rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
-        if (engine == "xorwow")
-            rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
-        else if (engine == "mrg32k3a")
-            rng_type = ROCRAND_RNG_PSEUDO_MRG32K3A;
-        else if (engine == "philox")
-            rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
-        else if (engine == "sobol32")
-            rng_type = ROCRAND_RNG_QUASI_SOBOL32;
-        else if (engine == "mtgp32")
-            rng_type = ROCRAND_RNG_PSEUDO_MTGP32;
-        else
-        {
-            std::cout << "Wrong engine name" << std::endl;
-            exit(1);
-        }
-
-        std::cout << engine << ":" << std::endl;
-
-        for (auto distribution : distributions)
-        {
-            std::cout << "  " << distribution << ":" << std::endl;
-            run_benchmarks(parser, rng_type, distribution);
-        }
-        std::cout << std::endl;
-    }
+    // Recorded in the context of JSON and console output, so results of
+    // different builds and devices can be told apart
+    benchmark::AddCustomContext("rocrand_version", std::to_string(version));
+    benchmark::AddCustomContext("hip_runtime_version", std::to_string(runtime_version));
+    benchmark::AddCustomContext("device_name", props.name);
+    // Key of per-GPU baselines of test/performance/perf_regression.py
+    #ifdef __HIP_PLATFORM_HCC__
+    benchmark::AddCustomContext("device_arch", "gfx" + std::to_string(props.gcnArch));
+    #else
+    benchmark::AddCustomContext("device_arch",
+        "sm_" + std::to_string(props.major) + std::to_string(props.minor));
+    #endif
+    benchmark::AddCustomContext("timing", parser.get<bool>("latency") ? "hip_events_per_call" : "hip_events");
 
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
     return 0;
 }
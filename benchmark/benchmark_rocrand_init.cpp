@@ -0,0 +1,388 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Benchmarks of rocrand_init() of device API states, built on Google
+// Benchmark. Every thread initializes one state (one thread per path):
+//
+//   <engine>/init/subsequence:<s>  subsequences s + thread id, offset 0
+//   <engine>/init/offset:<o>       subsequences thread id, offset o
+//   <engine>/init+generate/k:<k>   initialization and k values
+//   <engine>/create_states         rocrand_create_states(), subsequences
+//                                  0 .. states - 1 stored to an array
+//   <engine>/create_states_soa     rocrand_create_states_soa()
+//
+// Kernels are timed by events, items per second are initialized states.
+// MTGP32 states are initialized on the host (rocrand_make_state_mtgp32)
+// and are not benchmarked here.
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+#include <rocrand_kernel.h>
+#include <rocrand_sobol_precomputed.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+template<typename GeneratorState>
+__device__ __forceinline__
+void init_state(const unsigned long long seed,
+                const unsigned long long subsequence,
+                const unsigned long long offset,
+                const unsigned int * /* directions */,
+                GeneratorState * state)
+{
+    rocrand_init(seed, subsequence, offset, state);
+}
+
+// Sobol32 states have no seed, subsequences are offsets of threads
+__device__ __forceinline__
+void init_state(const unsigned long long /* seed */,
+                const unsigned long long subsequence,
+                const unsigned long long offset,
+                const unsigned int * directions,
+                rocrand_state_sobol32 * state)
+{
+    rocrand_init(directions, static_cast<unsigned int>(offset + subsequence), state);
+}
+
+template<typename GeneratorState>
+__global__
+void init_kernel(unsigned int * output,
+                 const unsigned long long seed,
+                 const unsigned long long subsequence,
+                 const unsigned long long offset,
+                 const unsigned int * directions,
+                 const unsigned int k)
+{
+    const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    GeneratorState state;
+    init_state(seed, subsequence + thread_id, offset, directions, &state);
+
+    unsigned int result = 0;
+    if(k == 0)
+    {
+        // All words of the state are used, so no part of the
+        // initialization can be removed by the compiler
+        const unsigned int * words = reinterpret_cast<const unsigned int *>(&state);
+        for(unsigned int i = 0; i < sizeof(GeneratorState) / sizeof(unsigned int); i++)
+        {
+            result ^= words[i];
+        }
+    }
+    for(unsigned int i = 0; i < k; i++)
+    {
+        result += rocrand(&state);
+    }
+    output[thread_id] = result;
+}
+
+struct benchmark_config
+{
+    size_t blocks;
+    size_t threads;
+    unsigned long long subsequence;
+    unsigned long long offset;
+    unsigned int k;
+};
+
+template<typename GeneratorState>
+void run_benchmark(benchmark::State& state,
+                   const benchmark_config config,
+                   const size_t trials)
+{
+    const size_t states = config.blocks * config.threads;
+
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, states * sizeof(unsigned int)));
+    unsigned int * directions;
+    const size_t directions_size = 32 * sizeof(unsigned int);
+    HIP_CHECK(hipMalloc((void **)&directions, directions_size));
+    HIP_CHECK(hipMemcpy(directions, h_sobol32_direction_vectors, directions_size, hipMemcpyHostToDevice));
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+
+    auto launch = [&]() {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_kernel<GeneratorState>),
+            dim3(config.blocks), dim3(config.threads), 0, 0,
+            output, 12345ULL, config.subsequence, config.offset, directions, config.k
+        );
+    };
+
+    // Warm-up
+    launch();
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for (auto _ : state)
+    {
+        HIP_CHECK(hipEventRecord(start, 0));
+        for (size_t i = 0; i < trials; i++)
+        {
+            launch();
+        }
+        HIP_CHECK(hipEventRecord(stop, 0));
+        HIP_CHECK(hipEventSynchronize(stop));
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+        state.SetIterationTime(elapsed / 1e3);
+    }
+    HIP_CHECK(hipPeekAtLastError());
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * trials * states));
+    state.counters["states"] = static_cast<double>(states);
+
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipFree(directions));
+    HIP_CHECK(hipFree(output));
+}
+
+template<typename GeneratorState>
+void run_create_states_benchmark(benchmark::State& state,
+                                 const size_t states,
+                                 const bool soa,
+                                 const size_t trials)
+{
+    GeneratorState * data;
+    HIP_CHECK(hipMalloc((void **)&data, states * sizeof(GeneratorState)));
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+
+    auto create = [&]() {
+        if (soa)
+        {
+            ROCRAND_CHECK(rocrand_create_states_soa<GeneratorState>(
+                reinterpret_cast<unsigned int *>(data), states, 12345ULL));
+        }
+        else
+        {
+            ROCRAND_CHECK(rocrand_create_states(data, states, 12345ULL));
+        }
+    };
+
+    // Warm-up
+    create();
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for (auto _ : state)
+    {
+        HIP_CHECK(hipEventRecord(start, 0));
+        for (size_t i = 0; i < trials; i++)
+        {
+            create();
+        }
+        HIP_CHECK(hipEventRecord(stop, 0));
+        HIP_CHECK(hipEventSynchronize(stop));
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+        state.SetIterationTime(elapsed / 1e3);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * trials * states));
+    state.counters["states"] = static_cast<double>(states);
+
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipFree(data));
+}
+
+// States of the same subsequences as <engine>/init/subsequence:0 created by
+// rocrand_create_states() and rocrand_create_states_soa()
+template<typename GeneratorState>
+void register_create_states_benchmarks(const cli::Parser& parser,
+                                       const std::string& engine)
+{
+    const size_t trials = parser.get<size_t>("trials");
+    const int repetitions = static_cast<int>(parser.get<size_t>("repetitions"));
+    const size_t states = parser.get<size_t>("blocks") * parser.get<size_t>("threads");
+
+    for (bool soa : { false, true })
+    {
+        const std::string name = engine + (soa ? "/create_states_soa" : "/create_states");
+        benchmark::RegisterBenchmark(name.c_str(),
+            [states, soa, trials](benchmark::State& state) {
+                run_create_states_benchmark<GeneratorState>(state, states, soa, trials);
+            }
+        )->UseManualTime()->Unit(benchmark::kMicrosecond)->Repetitions(repetitions);
+    }
+}
+
+template<typename GeneratorState>
+void register_benchmarks(const cli::Parser& parser,
+                         const std::string& engine,
+                         const bool has_subsequences)
+{
+    const size_t trials = parser.get<size_t>("trials");
+    const int repetitions = static_cast<int>(parser.get<size_t>("repetitions"));
+
+    benchmark_config base;
+    base.blocks = parser.get<size_t>("blocks");
+    base.threads = parser.get<size_t>("threads");
+    base.subsequence = 0;
+    base.offset = 0;
+    base.k = 0;
+
+    std::vector<std::pair<std::string, benchmark_config>> configs;
+    if (has_subsequences)
+    {
+        for (unsigned long long subsequence : parser.get<std::vector<unsigned long>>("subsequence"))
+        {
+            benchmark_config config = base;
+            config.subsequence = subsequence;
+            configs.push_back({ engine + "/init/subsequence:" + std::to_string(subsequence), config });
+        }
+    }
+    for (unsigned long long offset : parser.get<std::vector<unsigned long>>("offset"))
+    {
+        // Offsets of Sobol32 are 32-bit
+        if (!has_subsequences && offset > 0xFFFFFFFFULL)
+            continue;
+        benchmark_config config = base;
+        config.offset = offset;
+        configs.push_back({ engine + "/init/offset:" + std::to_string(offset), config });
+    }
+    for (size_t k : parser.get<std::vector<size_t>>("k"))
+    {
+        benchmark_config config = base;
+        config.k = static_cast<unsigned int>(k);
+        configs.push_back({ engine + "/init+generate/k:" + std::to_string(k), config });
+    }
+
+    for (auto c : configs)
+    {
+        const benchmark_config config = c.second;
+        benchmark::RegisterBenchmark(c.first.c_str(),
+            [config, trials](benchmark::State& state) {
+                run_benchmark<GeneratorState>(state, config, trials);
+            }
+        )->UseManualTime()->Unit(benchmark::kMicrosecond)->Repetitions(repetitions);
+    }
+}
+
+const std::vector<std::string> all_engines = {
+    "xorwow",
+    "mrg32k3a",
+    "philox",
+    "sobol32",
+};
+
+int main(int argc, char *argv[])
+{
+    // Google Benchmark's flags (--benchmark_out, --benchmark_format,
+    // --benchmark_filter etc.) are consumed first
+    benchmark::Initialize(&argc, argv);
+
+    cli::Parser parser(argc, argv);
+
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<size_t>("blocks", "blocks", 4096, "number of blocks");
+    parser.set_optional<size_t>("threads", "threads", 256, "number of threads in each block (one state per thread)");
+    parser.set_optional<std::vector<unsigned long>>("subsequence", "subsequence",
+        {0, 1UL << 10, 1UL << 20, 1UL << 40, 1UL << 60},
+        "space-separated list of first subsequences");
+    parser.set_optional<std::vector<unsigned long>>("offset", "offset",
+        {0, 1UL << 10, 1UL << 20, 1UL << 30, 1UL << 40, 1UL << 60},
+        "space-separated list of offsets");
+    parser.set_optional<std::vector<size_t>>("k", "k", {1, 4, 16, 64},
+        "space-separated list of numbers of values generated after initialization");
+    parser.set_optional<size_t>("trials", "trials", 10, "number of kernels of one timed iteration");
+    parser.set_optional<size_t>("repetitions", "repetitions", 5, "number of repetitions of each benchmark for mean, median and stddev");
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"all"}, engine_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    const auto es = parser.get<std::vector<std::string>>("engine");
+    const bool all_es = std::find(es.begin(), es.end(), "all") != es.end();
+    auto selected = [&](const std::string& engine) {
+        return all_es || std::find(es.begin(), es.end(), engine) != es.end();
+    };
+    if (selected("xorwow"))
+    {
+        register_benchmarks<rocrand_state_xorwow>(parser, "xorwow", true);
+        register_create_states_benchmarks<rocrand_state_xorwow>(parser, "xorwow");
+    }
+    if (selected("mrg32k3a"))
+    {
+        register_benchmarks<rocrand_state_mrg32k3a>(parser, "mrg32k3a", true);
+        register_create_states_benchmarks<rocrand_state_mrg32k3a>(parser, "mrg32k3a");
+    }
+    if (selected("philox"))
+    {
+        register_benchmarks<rocrand_state_philox4x32_10>(parser, "philox", true);
+        register_create_states_benchmarks<rocrand_state_philox4x32_10>(parser, "philox");
+    }
+    if (selected("sobol32"))
+        register_benchmarks<rocrand_state_sobol32>(parser, "sobol32", false);
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    benchmark::AddCustomContext("rocrand_version", std::to_string(version));
+    benchmark::AddCustomContext("hip_runtime_version", std::to_string(runtime_version));
+    benchmark::AddCustomContext("device_name", props.name);
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
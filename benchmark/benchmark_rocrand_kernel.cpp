@@ -26,6 +26,7 @@
 #include <numeric>
 #include <utility>
 #include <algorithm>
+#include <type_traits>
 
 #include "cmdparser.hpp"
 
@@ -368,6 +369,53 @@ void run_benchmark(const cli::Parser& parser,
     HIP_CHECK(hipFree(data));
 }
 
+// Mixed lambdas: every value has its own lambda from (0; max_lambda], so
+// threads of a warp use different methods and numbers of rejections
+template<typename GeneratorState>
+void run_poisson_mixed_benchmarks(const cli::Parser& parser,
+                                  const double max_lambda,
+                                  std::true_type /* warp */)
+{
+    std::cout << "      " << "rocrand_poisson" << std::endl;
+    run_benchmark<unsigned int, GeneratorState>(parser,
+        [] __device__ (GeneratorState * state, double max_lambda) {
+            return rocrand_poisson(state, max_lambda * rocrand_uniform_double(state));
+        }, max_lambda
+    );
+
+    // rocrand_poisson_warp() must be called by all threads of the warp
+    const size_t stride = parser.get<size_t>("blocks") * parser.get<size_t>("threads");
+    if (parser.get<size_t>("size") % stride != 0)
+    {
+        std::cout << "      " << "rocrand_poisson_warp: size must be a multiple of blocks * threads" << std::endl;
+        return;
+    }
+    std::cout << "      " << "rocrand_poisson_warp" << std::endl;
+    run_benchmark<unsigned int, GeneratorState>(parser,
+        [] __device__ (GeneratorState * state, double max_lambda) {
+            return rocrand_poisson_warp(state, max_lambda * rocrand_uniform_double(state));
+        }, max_lambda
+    );
+}
+
+template<typename GeneratorState>
+void run_poisson_mixed_benchmarks(const cli::Parser&,
+                                  const double,
+                                  std::false_type /* warp */)
+{
+    std::cout << "      " << "not supported" << std::endl;
+}
+
+// Engines with rocrand_poisson_warp()
+template<typename GeneratorState>
+struct has_poisson_warp : std::false_type { };
+template<>
+struct has_poisson_warp<rocrand_state_xorwow> : std::true_type { };
+template<>
+struct has_poisson_warp<rocrand_state_mrg32k3a> : std::true_type { };
+template<>
+struct has_poisson_warp<rocrand_state_philox4x32_10> : std::true_type { };
+
 template<typename GeneratorState>
 void run_benchmarks(const cli::Parser& parser,
                     const std::string& distribution)
@@ -442,6 +490,17 @@ void run_benchmarks(const cli::Parser& parser,
             );
         }
     }
+    if (distribution == "poisson-mixed")
+    {
+        const auto lambdas = parser.get<std::vector<double>>("lambda");
+        for (double lambda : lambdas)
+        {
+            std::cout << "    " << "max lambda "
+                 << std::fixed << std::setprecision(1) << lambda << std::endl;
+            run_poisson_mixed_benchmarks<GeneratorState>(parser, lambda,
+                has_poisson_warp<GeneratorState>());
+        }
+    }
     if (distribution == "discrete-poisson")
     {
         const auto lambdas = parser.get<std::vector<double>>("lambda");
@@ -507,6 +566,7 @@ const std::vector<std::string> all_distributions = {
     "log-normal-float",
     "log-normal-double",
     "poisson",
+    "poisson-mixed",
     "discrete-poisson",
     "discrete-custom",
 };
@@ -0,0 +1,363 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Benchmarks of lifecycle phases of generators, built on Google Benchmark:
+//
+//   <engine>/create                   rocrand_create_generator
+//   <engine>/first_generate           first call (initialization of states,
+//                                     tables and direction vectors)
+//   <engine>/set_seed+generate        reseeding of an initialized generator
+//   <engine>/set_offset+generate/<o>  setting offset o of an initialized
+//                                     generator (skipahead in init kernels)
+//   <engine>/destroy                  rocrand_destroy_generator
+//   <engine>/dispatch                 host overhead of rocrand_generate of
+//                                     4 values (rounded up to a multiple of
+//                                     dimensions) into device memory on an
+//                                     initialized generator
+//
+// Phases are timed by the wall clock including synchronization of the
+// generator's stream, so both host and device work is measured. Phases
+// are prepared outside of the timed region. dispatch is timed without
+// synchronization per call.
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+#include <benchmark/benchmark.h>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+typedef rocrand_rng_type rng_type_t;
+
+struct benchmark_config
+{
+    rng_type_t rng_type;
+    size_t size;
+    size_t dimensions;
+    unsigned long long offset;
+};
+
+// Owns a generator of the benchmark, its stream and output buffer
+struct lifecycle_runner
+{
+    const benchmark_config config;
+    hipStream_t stream;
+    unsigned int * data;
+    rocrand_generator generator;
+
+    explicit lifecycle_runner(const benchmark_config& config)
+        : config(config), generator(NULL)
+    {
+        HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+        HIP_CHECK(hipMalloc((void **)&data, config.size * sizeof(unsigned int)));
+    }
+
+    ~lifecycle_runner()
+    {
+        if (generator != NULL)
+        {
+            ROCRAND_CHECK(rocrand_destroy_generator(generator));
+        }
+        HIP_CHECK(hipFree(data));
+        HIP_CHECK(hipStreamDestroy(stream));
+    }
+
+    void create()
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&generator, config.rng_type));
+    }
+
+    void configure()
+    {
+        ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+        rocrand_status status = rocrand_set_quasi_random_generator_dimensions(generator, config.dimensions);
+        if (status != ROCRAND_STATUS_TYPE_ERROR) // If the RNG is not quasi-random
+        {
+            ROCRAND_CHECK(status);
+        }
+    }
+
+    rocrand_status generate()
+    {
+        rocrand_status status = rocrand_generate(generator, data, config.size);
+        if (status == ROCRAND_STATUS_SUCCESS)
+        {
+            HIP_CHECK(hipStreamSynchronize(stream));
+        }
+        return status;
+    }
+
+    void destroy()
+    {
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+        generator = NULL;
+    }
+};
+
+typedef std::function<rocrand_status(lifecycle_runner&)> phase_func_type;
+
+// Every iteration runs prepare (not timed) and then phase (timed). An error
+// status of either skips the benchmark, for example offsets which are not
+// supported by the generator
+void run_benchmark(benchmark::State& state,
+                   const benchmark_config config,
+                   phase_func_type prepare,
+                   phase_func_type phase)
+{
+    lifecycle_runner runner(config);
+    for (auto _ : state)
+    {
+        rocrand_status status = prepare(runner);
+        std::chrono::duration<double> elapsed(0.0);
+        if (status == ROCRAND_STATUS_SUCCESS)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            status = phase(runner);
+            auto end = std::chrono::high_resolution_clock::now();
+            elapsed = end - start;
+        }
+        if (status != ROCRAND_STATUS_SUCCESS)
+        {
+            std::ostringstream message;
+            message << "not supported (status " << status << ")";
+            state.SkipWithError(message.str().c_str());
+            break;
+        }
+        state.SetIterationTime(elapsed.count());
+    }
+}
+
+void register_benchmark(const std::string& name,
+                        const benchmark_config& config,
+                        const size_t repetitions,
+                        phase_func_type prepare,
+                        phase_func_type phase)
+{
+    benchmark::RegisterBenchmark(name.c_str(),
+        [config, prepare, phase](benchmark::State& state) {
+            run_benchmark(state, config, prepare, phase);
+        }
+    )
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond)
+    ->Repetitions(static_cast<int>(repetitions));
+}
+
+// Calls are not synchronized, so only the host time of the C API (checks,
+// dispatch to the generator and the launch of a kernel with little work) is
+// measured
+void run_dispatch_benchmark(benchmark::State& state,
+                            const benchmark_config config)
+{
+    lifecycle_runner runner(config);
+    runner.create();
+    runner.configure();
+    rocrand_status status = runner.generate();
+    // A few values, so all checks of the output and the stream are done
+    // (calls with 0 values return before them)
+    const size_t size = std::min(config.size,
+        (4 + config.dimensions - 1) / config.dimensions * config.dimensions);
+    for (auto _ : state)
+    {
+        if (status != ROCRAND_STATUS_SUCCESS)
+            break;
+        status = rocrand_generate(runner.generator, runner.data, size);
+    }
+    if (status != ROCRAND_STATUS_SUCCESS)
+    {
+        std::ostringstream message;
+        message << "not supported (status " << status << ")";
+        state.SkipWithError(message.str().c_str());
+    }
+    HIP_CHECK(hipStreamSynchronize(runner.stream));
+}
+
+void register_benchmarks(const cli::Parser& parser,
+                         const std::string& engine,
+                         benchmark_config config)
+{
+    const size_t repetitions = parser.get<size_t>("repetitions");
+
+    // Generators are destroyed by the next phase or by the runner
+    auto reset = [](lifecycle_runner& r) {
+        if (r.generator != NULL) r.destroy();
+        return ROCRAND_STATUS_SUCCESS;
+    };
+    auto reset_and_create = [reset](lifecycle_runner& r) {
+        reset(r);
+        r.create();
+        r.configure();
+        return ROCRAND_STATUS_SUCCESS;
+    };
+    auto initialized = [reset_and_create](lifecycle_runner& r) {
+        reset_and_create(r);
+        return r.generate();
+    };
+
+    register_benchmark(engine + "/create", config, repetitions,
+        reset,
+        [](lifecycle_runner& r) {
+            r.create();
+            return ROCRAND_STATUS_SUCCESS;
+        }
+    );
+    register_benchmark(engine + "/first_generate", config, repetitions,
+        reset_and_create,
+        [](lifecycle_runner& r) {
+            return r.generate();
+        }
+    );
+    register_benchmark(engine + "/set_seed+generate", config, repetitions,
+        initialized,
+        [](lifecycle_runner& r) {
+            rocrand_status status = rocrand_set_seed(r.generator, 1234567ULL);
+            if (status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            return r.generate();
+        }
+    );
+    for (unsigned long long offset : parser.get<std::vector<unsigned long>>("offset"))
+    {
+        config.offset = offset;
+        register_benchmark(engine + "/set_offset+generate/" + std::to_string(offset),
+            config, repetitions,
+            initialized,
+            [](lifecycle_runner& r) {
+                rocrand_status status = rocrand_set_offset(r.generator, r.config.offset);
+                if (status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+                return r.generate();
+            }
+        );
+    }
+    register_benchmark(engine + "/destroy", config, repetitions,
+        initialized,
+        [](lifecycle_runner& r) {
+            r.destroy();
+            return ROCRAND_STATUS_SUCCESS;
+        }
+    );
+    benchmark::RegisterBenchmark((engine + "/dispatch").c_str(),
+        [config](benchmark::State& state) {
+            run_dispatch_benchmark(state, config);
+        }
+    )
+    ->Unit(benchmark::kNanosecond)
+    ->Repetitions(static_cast<int>(repetitions));
+}
+
+const std::vector<std::pair<std::string, rng_type_t>> all_engines = {
+    { "xorwow", ROCRAND_RNG_PSEUDO_XORWOW },
+    { "mrg32k3a", ROCRAND_RNG_PSEUDO_MRG32K3A },
+    { "mtgp32", ROCRAND_RNG_PSEUDO_MTGP32 },
+    { "philox", ROCRAND_RNG_PSEUDO_PHILOX4_32_10 },
+    { "sobol32", ROCRAND_RNG_QUASI_SOBOL32 },
+    { "scrambled_sobol32", ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 },
+};
+
+int main(int argc, char *argv[])
+{
+    // Google Benchmark's flags (--benchmark_out, --benchmark_format,
+    // --benchmark_filter etc.) are consumed first
+    benchmark::Initialize(&argc, argv);
+
+    cli::Parser parser(argc, argv);
+
+    std::vector<std::string> engine_names;
+    for (auto e : all_engines) engine_names.push_back(e.first);
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(engine_names.begin(), engine_names.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<size_t>("size", "size", 1024, "number of values of generate calls (rounded up to a multiple of dimensions)");
+    parser.set_optional<size_t>("dimensions", "dimensions", 1, "number of dimensions of quasi-random values");
+    parser.set_optional<size_t>("repetitions", "repetitions", 5, "number of repetitions of each benchmark for mean, median and stddev");
+    parser.set_optional<std::vector<unsigned long>>("offset", "offset",
+        {0, 1UL << 20, 1UL << 40, 1UL << 60},
+        "space-separated list of offsets of set_offset+generate");
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"all"}, engine_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    const auto es = parser.get<std::vector<std::string>>("engine");
+    const bool all_es = std::find(es.begin(), es.end(), "all") != es.end();
+    const size_t dimensions = parser.get<size_t>("dimensions");
+    for (auto engine : all_engines)
+    {
+        if (!all_es && std::find(es.begin(), es.end(), engine.first) == es.end())
+            continue;
+        benchmark_config config;
+        config.rng_type = engine.second;
+        config.size = (parser.get<size_t>("size") + dimensions - 1) / dimensions * dimensions;
+        config.dimensions = dimensions;
+        config.offset = 0;
+        register_benchmarks(parser, engine.first, config);
+    }
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    benchmark::AddCustomContext("rocrand_version", std::to_string(version));
+    benchmark::AddCustomContext("hip_runtime_version", std::to_string(runtime_version));
+    benchmark::AddCustomContext("device_name", props.name);
+    benchmark::AddCustomContext("dimensions", std::to_string(dimensions));
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
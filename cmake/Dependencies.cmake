@@ -70,6 +70,31 @@ if(BUILD_TEST)
     find_package(GTest REQUIRED)
 endif()
 
+# Benchmark dependencies
+if(BUILD_BENCHMARK)
+    if(NOT DEPENDENCIES_FORCE_DOWNLOAD)
+        find_package(benchmark QUIET)
+    endif()
+
+    if(NOT benchmark_FOUND)
+        message(STATUS "Google Benchmark not found. Downloading and building Google Benchmark.")
+        # Download, build and install Google Benchmark library
+        set(GOOGLEBENCHMARK_ROOT ${CMAKE_CURRENT_BINARY_DIR}/googlebenchmark CACHE PATH "")
+        download_project(PROJ                googlebenchmark
+                         GIT_REPOSITORY      https://github.com/google/benchmark.git
+                         GIT_TAG             v1.6.1
+                         INSTALL_DIR         ${GOOGLEBENCHMARK_ROOT}
+                         CMAKE_ARGS          -DCMAKE_BUILD_TYPE=RELEASE -DBENCHMARK_ENABLE_TESTING=OFF -DBENCHMARK_ENABLE_INSTALL=ON -DCMAKE_INSTALL_PREFIX=<INSTALL_DIR>
+                         LOG_DOWNLOAD        TRUE
+                         LOG_CONFIGURE       TRUE
+                         LOG_BUILD           TRUE
+                         LOG_INSTALL         TRUE
+                         ${UPDATE_DISCONNECTED_IF_AVAILABLE}
+        )
+        find_package(benchmark REQUIRED CONFIG PATHS ${GOOGLEBENCHMARK_ROOT} NO_DEFAULT_PATH)
+    endif()
+endif()
+
 # Crush Tests
 if(BUILD_CRUSH_TEST)
     if(NOT DEPENDENCIES_FORCE_DOWNLOAD)
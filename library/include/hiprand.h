@@ -222,6 +222,34 @@ hiprandStatus_t HIPRANDAPI
 hiprandGenerate(hiprandGenerator_t generator,
                 unsigned int * output_data, size_t n);
 
+/**
+ * \brief Generates uniformly distributed 64-bit unsigned integers.
+ *
+ * Generates \p n uniformly distributed 64-bit unsigned integers and
+ * saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0 and \p 2^64, including \p 0 and
+ * excluding \p 2^64.
+ *
+ * Only HIPRAND_RNG_QUASI_SOBOL64 and HIPRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+ * generators support this function.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 64-bit unsigned integers to generate
+ *
+ * \return
+ * - HIPRAND_STATUS_NOT_INITIALIZED if the generator was not initialized \n
+ * - HIPRAND_STATUS_TYPE_ERROR if the generator does not generate 64-bit numbers \n
+ * - HIPRAND_STATUS_LAUNCH_FAILURE if generator failed to launch kernel \n
+ * - HIPRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - HIPRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+hiprandStatus_t HIPRANDAPI
+hiprandGenerateLongLong(hiprandGenerator_t generator,
+                        unsigned long long * output_data, size_t n);
+
 /**
  * \brief Generates uniformly distributed floats.
  *
@@ -37,12 +37,12 @@
 #include <rocrand_kernel.h>
 
 /// \cond
+// hipRAND states are aliases of rocRAND states: they have the same layout,
+// device functions forward to rocRAND overloads without conversions, and
+// states can be shared with code that uses the rocRAND device API.
 #define DEFINE_HIPRAND_STATE(hiprand_name, rocrand_name) \
-    struct hiprand_name : public rocrand_name \
-    { \
-        typedef rocrand_name base; \
-    }; \
-    typedef struct hiprand_name hiprand_name ## _t;
+    typedef rocrand_name hiprand_name; \
+    typedef rocrand_name hiprand_name ## _t;
 
 DEFINE_HIPRAND_STATE(hiprandState, rocrand_state_xorwow)
 DEFINE_HIPRAND_STATE(hiprandStateXORWOW, rocrand_state_xorwow)
@@ -260,8 +260,10 @@ void skipahead(unsigned long long n, StateType * state)
         >::value,
         "hiprandStateMtgp32_t does not have skipahead function"
     );
-    typedef typename StateType::base base_type;
-    skipahead(n, static_cast<base_type*>(state));
+    // Supported states are rocRAND states, their non-template skipahead()
+    // overloads are exact matches and are selected instead of this template
+    (void) n;
+    (void) state;
 }
 
 /// \brief Updates PRNG state skipping \p n sequences ahead.
@@ -270,7 +272,7 @@ void skipahead(unsigned long long n, StateType * state)
 /// ------------- | -------------
 /// XORWOW        | 2^67
 /// Philox        | 4 * 2^64
-/// MRG32k3a      | 2^67
+/// MRG32k3a      | 2^127
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
@@ -292,8 +294,8 @@ void skipahead_sequence(unsigned long long n, StateType * state)
         >::value,
         "StateType does not have skipahead_sequence function"
     );
-    typedef typename StateType::base base_type;
-    skipahead_subsequence(n, static_cast<base_type*>(state));
+    // MRG32k3a uses the non-template rocRAND skipahead_sequence() overload
+    skipahead_subsequence(n, state);
 }
 
 /// \brief Updates PRNG state skipping \p n subsequences ahead.
@@ -302,7 +304,7 @@ void skipahead_sequence(unsigned long long n, StateType * state)
 /// ------------- | -------------
 /// XORWOW        | 2^67
 /// Philox        | 4 * 2^64
-/// MRG32k3a      | 2^127
+/// MRG32k3a      | 2^67
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
@@ -324,8 +326,9 @@ void skipahead_subsequence(unsigned long long n, StateType * state)
         >::value,
         "StateType does not have skipahead_subsequence function"
     );
-    typedef typename StateType::base base_type;
-    skipahead_subsequence(n, static_cast<base_type*>(state));
+    // Supported states use non-template rocRAND overloads
+    (void) n;
+    (void) state;
 }
 
 /// \brief Generates uniformly distributed random <tt>unsigned int</tt>
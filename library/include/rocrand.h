@@ -27,6 +27,7 @@
 #define ROCRAND_H_
 
 #include <hip/hip_runtime.h>
+#include <hip/hip_fp16.h>
 
 #include "rocrand_discrete_types.h"
 
@@ -41,6 +42,8 @@
 /// \cond ROCRAND_DOCS_TYPEDEFS
 /// rocRAND random number generator (opaque)
 typedef struct rocrand_generator_base_type * rocrand_generator;
+/// rocRAND generator split across several devices (opaque)
+typedef struct rocrand_multi_device_generator_base_type * rocrand_multi_device_generator;
 /// \endcond
 
 #if defined(__cplusplus)
@@ -58,8 +61,8 @@ typedef enum rocrand_status {
     ROCRAND_STATUS_TYPE_ERROR = 103, ///< Generator type is wrong
     ROCRAND_STATUS_OUT_OF_RANGE = 104, ///< Argument out of range
     ROCRAND_STATUS_LENGTH_NOT_MULTIPLE = 105, ///< Requested size is not a multiple of quasirandom generator's dimension,
-                                              ///< or requested size is not even (see rocrand_generate_normal()),
-                                              ///< or pointer is misaligned (see rocrand_generate_normal())
+                                              ///< or requested size is not even (see rocrand_generate_normal_half()),
+                                              ///< or pointer is misaligned (see rocrand_generate_normal_half())
     ROCRAND_STATUS_DOUBLE_PRECISION_REQUIRED = 106, ///< GPU does not have double precision
     ROCRAND_STATUS_LAUNCH_FAILURE = 107, ///< Kernel launch failure
     ROCRAND_STATUS_INTERNAL_ERROR = 108 ///< Internal library error
@@ -74,10 +77,194 @@ typedef enum rocrand_rng_type {
     ROCRAND_RNG_PSEUDO_MRG32K3A = 402, ///< MRG32k3a pseudorandom generator
     ROCRAND_RNG_PSEUDO_MTGP32 = 403, ///< Mersenne Twister MTGP32 pseudorandom generator
     ROCRAND_RNG_PSEUDO_PHILOX4_32_10 = 404, ///< PHILOX-4x32-10 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_THREEFRY4_32_20 = 405, ///< Threefry-4x32-20 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 = 406, ///< Threefry-2x64-20 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP = 407, ///< xoshiro128++ pseudorandom generator (128-bit state)
+    ROCRAND_RNG_PSEUDO_PCG32 = 408, ///< PCG32 (XSH RR) pseudorandom generator (2 64-bit values of state)
+    ROCRAND_RNG_PSEUDO_MT19937 = 409, ///< Mersenne Twister MT19937 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10 = 410, ///< PHILOX-4x64-10 pseudorandom generator
     ROCRAND_RNG_QUASI_DEFAULT = 500,  ///< Default quasirandom generator
-    ROCRAND_RNG_QUASI_SOBOL32 = 501 ///< Sobol32 quasirandom generator
+    ROCRAND_RNG_QUASI_SOBOL32 = 501, ///< Sobol32 quasirandom generator
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 = 502, ///< Scrambled Sobol32 quasirandom generator
+    ROCRAND_RNG_QUASI_SOBOL64 = 503, ///< Sobol64 quasirandom generator
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 = 504, ///< Scrambled Sobol64 quasirandom generator
+    ROCRAND_RNG_QUASI_LATTICE = 505, ///< Randomly shifted rank-1 lattice quasirandom generator
+    ROCRAND_RNG_QUASI_HALTON = 506 ///< Scrambled Halton quasirandom generator
 } rocrand_rng_type;
 
+/**
+ * \brief rocRAND generator ordering
+ *
+ * Ordering controls how the results of a generator are laid out in
+ * the output (see rocrand_set_ordering()).
+ */
+typedef enum rocrand_ordering {
+    ROCRAND_ORDERING_PSEUDO_BEST = 100, ///< Fastest ordering for the device
+    ROCRAND_ORDERING_PSEUDO_DEFAULT = 101, ///< Default ordering for pseudorandom results (same as ROCRAND_ORDERING_PSEUDO_LEGACY)
+    ROCRAND_ORDERING_PSEUDO_SEEDED = 102, ///< Fast seeding, engines are seeded independently instead of skipping ahead
+    ROCRAND_ORDERING_PSEUDO_LEGACY = 103, ///< Legacy ordering, results of versions of the library without orderings
+    ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT = 104, ///< Same results on all devices and platforms
+    ROCRAND_ORDERING_QUASI_DEFAULT = 201, ///< Dimension-major ordering for quasirandom results
+    ROCRAND_ORDERING_QUASI_POINT_MAJOR = 202 ///< Point-major ordering for quasirandom results
+} rocrand_ordering;
+
+/**
+ * \brief Method of normal and log-normal generation of pseudo-random generators
+ *
+ * See rocrand_set_normal_method().
+ */
+typedef enum rocrand_normal_method {
+    ROCRAND_NORMAL_METHOD_BOX_MULLER = 0, ///< Box-Muller transform of pairs of numbers (default)
+    ROCRAND_NORMAL_METHOD_ZIGGURAT = 1, ///< Ziggurat method with rejection, no transcendental functions for most values
+    ROCRAND_NORMAL_METHOD_INVERSION = 2 ///< Inverse normal CDF of each number (two numbers for doubles)
+} rocrand_normal_method;
+
+/**
+ * \brief rocRAND precision of transcendental functions of distributions
+ */
+typedef enum rocrand_math_mode {
+    ROCRAND_MATH_MODE_ACCURATE = 0, ///< Accurate log, exp and sqrt (default)
+    ROCRAND_MATH_MODE_FAST = 1 ///< Fast intrinsics (__logf, __expf) in single and half precision
+} rocrand_math_mode;
+
+/**
+ * \brief rocRAND resolution of uniformly distributed doubles
+ *
+ * See rocrand_set_double_resolution().
+ */
+typedef enum rocrand_double_resolution {
+    ROCRAND_DOUBLE_RESOLUTION_DEFAULT = 0, ///< Resolution of the generator's own sequence (default)
+    ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT = 1, ///< One 32-bit number per double
+    ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT = 2 ///< Two 32-bit numbers (53 bits) per double
+} rocrand_double_resolution;
+
+/**
+ * \brief Method of rocrand_generate_permutation() and rocrand_shuffle()
+ *
+ * See rocrand_set_permutation_method().
+ */
+typedef enum rocrand_permutation_method {
+    ROCRAND_PERMUTATION_METHOD_FEISTEL = 0, ///< Bijection computed per value by a Feistel network (default)
+    ROCRAND_PERMUTATION_METHOD_EXACT = 1 ///< Uniform permutations by MergeShuffle of shuffled segments
+} rocrand_permutation_method;
+
+/**
+ * \brief Hints of generation to managed memory
+ *
+ * Flags combined with bitwise OR, see rocrand_set_managed_memory_hints().
+ */
+typedef enum rocrand_managed_hint {
+    ROCRAND_MANAGED_HINT_PREFETCH = 1, ///< Prefetch output to the device before generation (default)
+    ROCRAND_MANAGED_HINT_READ_MOSTLY = 2, ///< Advise output as read-mostly after generation
+    ROCRAND_MANAGED_HINT_PREFETCH_TO_HOST = 4 ///< Prefetch output back to the host after generation
+} rocrand_managed_hint;
+
+/**
+ * \brief Distribution of a request of rocrand_generate_batch() and
+ * rocrand_generate_to_host()
+ */
+typedef enum rocrand_distribution {
+    ROCRAND_DISTRIBUTION_UNIFORM_UINT = 0, ///< 32-bit unsigned integers (as rocrand_generate())
+    ROCRAND_DISTRIBUTION_UNIFORM_FLOAT = 1, ///< Uniformly distributed floats (as rocrand_generate_uniform())
+    ROCRAND_DISTRIBUTION_UNIFORM_DOUBLE = 2, ///< Uniformly distributed doubles (as rocrand_generate_uniform_double())
+    ROCRAND_DISTRIBUTION_NORMAL_FLOAT = 3, ///< Normally distributed floats (as rocrand_generate_normal())
+    ROCRAND_DISTRIBUTION_NORMAL_DOUBLE = 4, ///< Normally distributed doubles (as rocrand_generate_normal_double())
+    ROCRAND_DISTRIBUTION_LOG_NORMAL_FLOAT = 5, ///< Log-normally distributed floats (as rocrand_generate_log_normal())
+    ROCRAND_DISTRIBUTION_LOG_NORMAL_DOUBLE = 6, ///< Log-normally distributed doubles (as rocrand_generate_log_normal_double())
+    ROCRAND_DISTRIBUTION_POISSON = 7 ///< Poisson-distributed 32-bit unsigned integers (as rocrand_generate_poisson())
+} rocrand_distribution;
+
+/**
+ * \brief Request of rocrand_generate_batch() and rocrand_generate_to_host()
+ */
+typedef struct rocrand_generate_request {
+    rocrand_distribution distribution; ///< Distribution of generated numbers
+    void * output_data; ///< Pointer to memory to store generated numbers (of the type of the distribution)
+    size_t n; ///< Number of numbers to generate
+    double mean; ///< Mean of normal and log-normal distributions
+    double stddev; ///< Standard deviation of normal and log-normal distributions
+    double lambda; ///< Lambda of the Poisson distribution
+} rocrand_generate_request;
+
+/**
+ * \brief Runtime statistics of a random number generator.
+ *
+ * Counters since the generator was created, see rocrand_get_generator_stats().
+ */
+typedef struct rocrand_generator_stats {
+    unsigned long long samples; ///< Number of generated numbers
+    unsigned long long launches; ///< Number of launched generation and initialization kernels
+    unsigned long long inits; ///< Number of initializations of the generator's state
+    unsigned long long table_rebuilds; ///< Number of created tables of Poisson distributions
+    double init_time; ///< Host time of initializations in milliseconds
+    double table_time; ///< Host time of creation of tables of Poisson distributions in milliseconds
+} rocrand_generator_stats;
+
+/**
+ * \brief Telemetry of device generators of one type in the process.
+ *
+ * Counters since the start of the process, see rocrand_get_telemetry_stats()
+ * and rocrand_set_telemetry_callback().
+ */
+typedef struct rocrand_telemetry_stats {
+    rocrand_rng_type rng_type; ///< Type of generators
+    unsigned long long calls; ///< Number of calls of generate functions
+    unsigned long long samples; ///< Number of generated numbers
+    unsigned long long bytes; ///< Number of bytes of output written by generate functions
+    unsigned long long timed_calls; ///< Number of calls whose kernels were timed by events
+    double kernel_time; ///< Device time of timed calls in milliseconds
+    double average_kernel_time; ///< Device time of one timed call in milliseconds
+    double samples_per_second; ///< Numbers generated per second of device time of timed calls
+    unsigned long long inits; ///< Number of initializations of generators
+    double init_time; ///< Host time of initializations in milliseconds
+    unsigned long long table_rebuilds; ///< Number of created tables of Poisson distributions
+    double table_time; ///< Host time of creation of tables of Poisson distributions in milliseconds
+} rocrand_telemetry_stats;
+
+/**
+ * \brief Precomputed tables of the library.
+ *
+ * Pointers to tables used by device functions (jump matrices of XORWOW
+ * and MRG32k3a, jump polynomials of Xoshiro128++) and by quasi-random generators (Sobol direction vectors
+ * and scrambling constants), see rocrand_get_host_tables() and
+ * rocrand_get_device_tables(). Layout fields describe how jump matrices
+ * were generated (see tools/xorwow_precomputed_generator and
+ * tools/mrg32k3a_precomputed_generator).
+ */
+typedef struct rocrand_precomputed_tables {
+    unsigned int xorwow_jump_log2; ///< Log2 of the base of XORWOW jumps (XORWOW_JUMP_LOG2)
+    unsigned int xorwow_jump_multiples; ///< XORWOW jump matrices per digit (XORWOW_JUMP_MULTIPLES)
+    unsigned int mrg32k3a_jump_log2; ///< Log2 of the base of MRG32k3a jumps (MRG323A_JUMP_LOG2)
+    unsigned int sobol_dimensions; ///< Number of dimensions of Sobol tables (SOBOL_DIM or of ROCRAND_SOBOL_TABLES)
+    const unsigned int * xorwow_jump_matrices; ///< XORWOW jump matrices for offsets
+    const unsigned int * xorwow_sequence_jump_matrices; ///< XORWOW jump matrices for subsequences
+    const unsigned long long * mrg32k3a_A1; ///< MRG32k3a jump matrices of the first component for offsets
+    const unsigned long long * mrg32k3a_A2; ///< MRG32k3a jump matrices of the second component for offsets
+    const unsigned long long * mrg32k3a_A1P67; ///< MRG32k3a jump matrices of the first component for subsequences
+    const unsigned long long * mrg32k3a_A2P67; ///< MRG32k3a jump matrices of the second component for subsequences
+    const unsigned long long * mrg32k3a_A1P127; ///< MRG32k3a jump matrices of the first component for sequences
+    const unsigned long long * mrg32k3a_A2P127; ///< MRG32k3a jump matrices of the second component for sequences
+    const unsigned int * sobol32_direction_vectors; ///< 32 direction vectors per dimension of Sobol32
+    const unsigned long long * sobol64_direction_vectors; ///< 64 direction vectors per dimension of Sobol64
+    const unsigned int * scrambled_sobol32_constants; ///< Scrambling constant per dimension of scrambled Sobol32
+    const unsigned long long * scrambled_sobol64_constants; ///< Scrambling constant per dimension of scrambled Sobol64
+    const unsigned int * xoshiro128pp_jump_polynomials; ///< Xoshiro128++ jump polynomials for offsets
+    const unsigned int * xoshiro128pp_sequence_jump_polynomials; ///< Xoshiro128++ jump polynomials for subsequences
+} rocrand_precomputed_tables;
+
+/**
+ * \brief Handle of a generator exported to other processes.
+ *
+ * Returned by rocrand_export_generator() and passed to
+ * rocrand_import_generator() in another process (e.g. through a pipe or
+ * shared memory), it contains no pointers of the exporting process.
+ */
+typedef struct rocrand_generator_ipc_handle {
+    hipIpcMemHandle_t state; ///< IPC handle of the saved state in device memory of the exporter
+    rocrand_rng_type rng_type; ///< Type of the exported generator
+    size_t state_size; ///< Size of the saved state in bytes (see rocrand_get_state_size())
+} rocrand_generator_ipc_handle;
+
 
 // Host API function
 
@@ -91,8 +278,36 @@ typedef enum rocrand_rng_type {
  * - ROCRAND_RNG_PSEUDO_XORWOW
  * - ROCRAND_RNG_PSEUDO_MRG32K3A
  * - ROCRAND_RNG_PSEUDO_MTGP32
+ * - ROCRAND_RNG_PSEUDO_MT19937
  * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+ * - ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+ * - ROCRAND_RNG_PSEUDO_PCG32
  * - ROCRAND_RNG_QUASI_SOBOL32
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+ * - ROCRAND_RNG_QUASI_SOBOL64
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+ * - ROCRAND_RNG_QUASI_LATTICE
+ * - ROCRAND_RNG_QUASI_HALTON
+ *
+ * Lattice and Halton generators compute every point from its index.
+ * Lattice points are an extensible rank-1 lattice in base 2 (the first
+ * 2^m points are a lattice rule of 2^m points) shifted by a random vector,
+ * Halton points have scrambled digits (every digit is multiplied by a random
+ * factor of the dimension). The shift and the factors are set by the seed
+ * (rocrand_set_seed()), the generating vector of lattices can be set by
+ * rocrand_set_lattice_generating_vector().
+ *
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_10 with ROCRAND_ORDERING_PSEUDO_DEFAULT and
+ * ROCRAND_ORDERING_PSEUDO_LEGACY generates the sequence of earlier versions
+ * of the library (16384 engines, 16 threads interleave numbers of one
+ * engine). With ROCRAND_ORDERING_PSEUDO_BEST, ROCRAND_ORDERING_PSEUDO_SEEDED
+ * and ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT it computes every group of
+ * 4 numbers from its counter, results are subsequence 0 of
+ * rocrand_state_philox4x32_10 initialized with the seed and the offset
+ * (the same as results of the device API).
  *
  * \param generator - Pointer to generator
  * \param rng_type - Type of generator to create
@@ -102,12 +317,54 @@ typedef enum rocrand_rng_type {
  * - ROCRAND_STATUS_VERSION_MISMATCH if the header file version does not match the
  *   dynamically linked library version \n
  * - ROCRAND_STATUS_TYPE_ERROR if the value for \p rng_type is invalid \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if \p rng_type is a Sobol type and the tables
+ *   file of the environment variable \p ROCRAND_SOBOL_TABLES could not be loaded \n
  * - ROCRAND_STATUS_SUCCESS if generator was created successfully \n
  *
  */
 rocrand_status ROCRANDAPI
 rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_type);
 
+/**
+ * \brief Creates a new random number generator which runs on the host.
+ *
+ * Creates a new host random number generator of type \p rng_type
+ * and returns it in \p generator. Numbers are generated by CPU threads
+ * directly to host memory, all generation functions accept only pointers
+ * to host memory and return when the numbers are generated.
+ *
+ * Host generators produce the same sequences as generators created by
+ * rocrand_create_generator (for ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG32K3A and ROCRAND_RNG_PSEUDO_MTGP32 the sequences
+ * of device generators depend on the number of engines, host generators
+ * use the default number, which is used by device generators with
+ * ROCRAND_ORDERING_PSEUDO_LEGACY; the same holds for
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_10 with the legacy orderings). Floating-point results can differ
+ * in the last bits because of different implementations of math functions.
+ *
+ * rocrand_set_stream has no effect on host generators.
+ *
+ * Values for \p rng_type are:
+ * - ROCRAND_RNG_PSEUDO_XORWOW
+ * - ROCRAND_RNG_PSEUDO_MRG32K3A
+ * - ROCRAND_RNG_PSEUDO_MTGP32
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ * - ROCRAND_RNG_QUASI_SOBOL32
+ *
+ * \param generator - Pointer to generator
+ * \param rng_type - Type of generator to create
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the value for \p rng_type is invalid \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if \p rng_type is a Sobol type and the tables
+ *   file of the environment variable \p ROCRAND_SOBOL_TABLES could not be loaded \n
+ * - ROCRAND_STATUS_SUCCESS if generator was created successfully \n
+ *
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_generator_host(rocrand_generator * generator, rocrand_rng_type rng_type);
+
 /**
  * \brief Destroys random number generator.
  *
@@ -140,12 +397,116 @@ rocrand_destroy_generator(rocrand_generator generator);
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
  * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
  * of used quasi-random generator \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a 64-bit quasi-random generator
+ * (see rocrand_generate_long_long()) \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
 rocrand_generate(rocrand_generator generator,
                  unsigned int * output_data, size_t n);
 
+/**
+ * \brief Generates uniformly distributed 64-bit unsigned integers.
+ *
+ * Generates \p n uniformly distributed 64-bit unsigned integers and
+ * saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0 and \p 2^64, including \p 0 and
+ * excluding \p 2^64.
+ *
+ * Only ROCRAND_RNG_QUASI_SOBOL64, ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 and
+ * ROCRAND_RNG_PSEUDO_PHILOX4_64_10 generators support this function.
+ * 64-bit numbers of ROCRAND_RNG_PSEUDO_PHILOX4_64_10 are the results of its
+ * round function, rocrand_generate() returns their lower and upper halves
+ * as consecutive numbers.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 64-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not generate 64-bit numbers \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_long_long(rocrand_generator generator,
+                           unsigned long long * output_data, size_t n);
+
+/**
+ * \brief Generates a range of uniformly distributed 32-bit unsigned integers.
+ *
+ * Generates numbers <tt>[start, start + n)</tt> of the sequence of
+ * 32-bit unsigned integers produced by the generator and saves them to
+ * \p output_data. The numbers are the same as elements <tt>[start, start + n)</tt>
+ * of the output of one rocrand_generate() call of <tt>start + n</tt> numbers
+ * made right after creation or after the last change of the generator's seed,
+ * offset or ordering.
+ *
+ * For quasi-random generators \p start is a point index: numbers of points
+ * <tt>[start, start + n / dimensions)</tt> of all dimensions are generated
+ * with the layout of rocrand_generate().
+ *
+ * The state of the generator is not changed, so ranges can be generated
+ * in any order and the results of subsequent rocrand_generate() calls are
+ * not affected. Philox and Sobol generators compute the range directly,
+ * XORWOW and MRG32K3A engines are skipped ahead in a temporary buffer.
+ * ROCRAND_RNG_PSEUDO_MTGP32 and ROCRAND_RNG_PSEUDO_MT19937 do not support
+ * this function.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param start - Position of the first number (point for quasi-random generators)
+ * \param n - Number of 32-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory for temporary engines could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is ROCRAND_RNG_PSEUDO_MTGP32,
+ * ROCRAND_RNG_PSEUDO_MT19937 or a 64-bit quasi-random generator
+ * (see rocrand_generate_long_long_range()) \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_range(rocrand_generator generator,
+                       unsigned int * output_data,
+                       unsigned long long start, size_t n);
+
+/**
+ * \brief Generates a range of uniformly distributed 64-bit unsigned integers.
+ *
+ * Generates numbers of points <tt>[start, start + n / dimensions)</tt> of
+ * a 64-bit quasi-random generator without changing its state, see
+ * rocrand_generate_range().
+ *
+ * Only ROCRAND_RNG_QUASI_SOBOL64, ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 and
+ * ROCRAND_RNG_PSEUDO_PHILOX4_64_10 (\p start is the index of a 64-bit number)
+ * generators support this function.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param start - Index of the first point
+ * \param n - Number of 64-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not generate 64-bit numbers \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_long_long_range(rocrand_generator generator,
+                                 unsigned long long * output_data,
+                                 unsigned long long start, size_t n);
+
 /**
  * \brief Generates uniformly distributed \p float values.
  *
@@ -209,8 +570,7 @@ rocrand_generate_uniform_double(rocrand_generator generator,
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even, \p output_data is not
- * aligned to \p sizeof(float2) bytes, or \p n is not a multiple of the dimension
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
  * of used quasi-random generator \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
@@ -234,8 +594,7 @@ rocrand_generate_normal(rocrand_generator generator,
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even, \p output_data is not
- * aligned to \p sizeof(double2) bytes, or \p n is not a multiple of the dimension
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
  * of used quasi-random generator \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
@@ -259,8 +618,7 @@ rocrand_generate_normal_double(rocrand_generator generator,
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even, \p output_data is not
- * aligned to \p sizeof(float2) bytes, or \p n is not a multiple of the dimension
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
  * of used quasi-random generator \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
@@ -284,8 +642,7 @@ rocrand_generate_log_normal(rocrand_generator generator,
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even, \p output_data is not
- * aligned to \p sizeof(double2) bytes, or \p n is not a multiple of the dimension
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
  * of used quasi-random generator \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
@@ -295,180 +652,2565 @@ rocrand_generate_log_normal_double(rocrand_generator generator,
                                    double mean, double stddev);
 
 /**
- * \brief Generates Poisson-distributed 32-bit unsigned integers.
+ * \brief Generates uniformly distributed \p __half values.
  *
- * Generates \p n Poisson-distributed 32-bit unsigned integers and
- * saves them to \p output_data.
+ * Generates \p n uniformly distributed 16-bit half-precision floating-point
+ * values and saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0.0f and \p 1.0f, excluding \p 0.0f and
+ * including \p 1.0f.
+ *
+ * Pseudo-random generators produce two half values from each 32-bit random
+ * number (16 bits per value), so \p n must be even and \p output_data must be
+ * aligned to \p sizeof(__half2) bytes. Quasi-random generators produce one
+ * value per point.
  *
  * \param generator - Generator to use
  * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of 32-bit unsigned integers to generate
- * \param lambda - lambda for the Poisson distribution
+ * \param n - Number of <tt>__half</tt>s to generate
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator \n
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
- * of used quasi-random generator \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even or \p output_data is not
+ * aligned to \p sizeof(__half2) bytes for pseudo-random generators, or \p n is
+ * not a multiple of the dimension of used quasi-random generator \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_generate_poisson(rocrand_generator generator,
-                         unsigned int * output_data, size_t n,
-                         double lambda);
+rocrand_generate_uniform_half(rocrand_generator generator,
+                              __half * output_data, size_t n);
 
 /**
- * \brief Initializes the generator's state on GPU or host.
+ * \brief Generates normally distributed \p __half values.
  *
- * Initializes the generator's state on GPU or host. User it not
- * required to call this function before using a generator.
+ * Generates \p n normally distributed 16-bit half-precision floating-point
+ * values and saves them to \p output_data. Values are computed in
+ * single precision and rounded to half precision.
  *
- * If rocrand_initialize() was not called for a generator, it will be
- * automatically called by functions which generates random numbers like
- * rocrand_generate(), rocrang_generate_uniform() etc.
+ * Pseudo-random generators produce two half values from each 32-bit random
+ * number (16 bits per value), so \p n must be even and \p output_data must be
+ * aligned to \p sizeof(__half2) bytes.
  *
- * \param generator - Generator to initialize
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>__half</tt>s to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator \n
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_SUCCESS if the seeds were generated successfully \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even or \p output_data is not
+ * aligned to \p sizeof(__half2) bytes for pseudo-random generators, or \p n is
+ * not a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_initialize_generator(rocrand_generator generator);
+rocrand_generate_normal_half(rocrand_generator generator,
+                             __half * output_data, size_t n,
+                             float mean, float stddev);
 
 /**
- * \brief Sets the current stream for kernel launches.
+ * \brief Generates log-normally distributed \p __half values.
  *
- * Sets the current stream for all kernel launches of the generator.
- * All functions will use this stream.
+ * Generates \p n log-normally distributed 16-bit half-precision floating-point
+ * values and saves them to \p output_data. Values are computed in
+ * single precision and rounded to half precision.
  *
- * \param generator - Generator to modify
- * \param stream - Stream to use or NULL for default stream
+ * Pseudo-random generators produce two half values from each 32-bit random
+ * number (16 bits per value), so \p n must be even and \p output_data must be
+ * aligned to \p sizeof(__half2) bytes.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>__half</tt>s to generate
+ * \param mean - Mean value of log normal distribution
+ * \param stddev - Standard deviation value of log normal distribution
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_SUCCESS if stream was set successfully \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even or \p output_data is not
+ * aligned to \p sizeof(__half2) bytes for pseudo-random generators, or \p n is
+ * not a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_set_stream(rocrand_generator generator, hipStream_t stream);
+rocrand_generate_log_normal_half(rocrand_generator generator,
+                                 __half * output_data, size_t n,
+                                 float mean, float stddev);
 
 /**
- * \brief Sets the seed of a pseudo-random number generator.
- *
- * Sets the seed of the pseudo-random number generator.
+ * \brief Generates uniformly distributed 32-bit unsigned integers to a pitched 2D array.
  *
- * - This operation resets the generator's internal state.
- * - This operation does not change the generator's offset.
+ * Generates \p width x \p height uniformly distributed 32-bit unsigned integers
+ * and saves them to rows of a 2D array (for example a sub-matrix of a larger
+ * matrix or memory allocated by \p hipMallocPitch), row \p r starts at
+ * <tt>(char *)output_data + r * pitch</tt>.
  *
- * For a MRG32K3a generator seed value can't be zero. If \p seed is
- * equal zero and generator's type is ROCRAND_RNG_PSEUDO_MRG32K3A,
- * value \p 12345 is used as a seed instead.
+ * The results are the same as of \p height calls of rocrand_generate() with
+ * \p width values, one per row, but Philox and XORWOW generate all rows in one
+ * kernel launch without a temporary buffer or a 2D copy, other generators
+ * generate the rows one by one.
  *
- * \param generator - Pseudo-random number generator
- * \param seed - New seed value
+ * \param generator - Generator to use
+ * \param output_data - Pointer to the first row of the array
+ * \param width - Number of <tt>unsigned int</tt>s in each row
+ * \param height - Number of rows
+ * \param pitch - Distance in bytes between the starts of consecutive rows
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
- * - ROCRAND_STATUS_SUCCESS if seed was set successfully \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than \p width values or
+ * is not a multiple of the size of a value \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p width is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_set_seed(rocrand_generator generator, unsigned long long seed);
+rocrand_generate_2d(rocrand_generator generator,
+                    unsigned int * output_data, size_t width,
+                    size_t height, size_t pitch);
 
 /**
- * \brief Sets the offset of a random number generator.
- *
- * Sets the absolute offset of the random number generator.
- *
- * - This operation resets the generator's internal state.
- * - This operation does not change the generator's seed.
+ * \brief Generates uniformly distributed \p float values to a pitched 2D array.
  *
- * Absolute offset cannot be set if generator's type is ROCRAND_RNG_PSEUDO_MTGP32.
+ * Generates \p width x \p height uniformly distributed 32-bit floating-point values
+ * from (0, 1] range and saves them to rows of a 2D array, the results are the
+ * same as of \p height calls of rocrand_generate_uniform() with \p width values
+ * (see rocrand_generate_2d()).
  *
- * \param generator - Random number generator
- * \param offset - New absolute offset
+ * \param generator - Generator to use
+ * \param output_data - Pointer to the first row of the array
+ * \param width - Number of <tt>float</tt>s in each row
+ * \param height - Number of rows
+ * \param pitch - Distance in bytes between the starts of consecutive rows
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_SUCCESS if offset was successfully set \n
- * - ROCRAND_STATUS_TYPE_ERROR if generator's type is ROCRAND_RNG_PSEUDO_MTGP32
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than \p width values or
+ * is not a multiple of the size of a value \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p width is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_set_offset(rocrand_generator generator, unsigned long long offset);
+rocrand_generate_uniform_2d(rocrand_generator generator,
+                            float * output_data, size_t width,
+                            size_t height, size_t pitch);
 
 /**
- * \brief Set the number of dimensions of a quasi-random number generator.
+ * \brief Generates uniformly distributed \p double values to a pitched 2D array.
  *
- * Set the number of dimensions of a quasi-random number generator.
- * Supported values of \p dimensions are 1 to 20000.
- *
- * - This operation resets the generator's internal state.
- * - This operation does not change the generator's offset.
+ * Generates \p width x \p height uniformly distributed 64-bit floating-point values
+ * from (0, 1] range and saves them to rows of a 2D array, the results are the
+ * same as of \p height calls of rocrand_generate_uniform_double() with \p width
+ * values (see rocrand_generate_2d()).
  *
- * \param generator - Quasi-random number generator
- * \param dimensions - Number of dimensions
+ * \param generator - Generator to use
+ * \param output_data - Pointer to the first row of the array
+ * \param width - Number of <tt>double</tt>s in each row
+ * \param height - Number of rows
+ * \param pitch - Distance in bytes between the starts of consecutive rows
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a quasi-random number generator \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is out of range \n
- * - ROCRAND_STATUS_SUCCESS if the number of dimensions was set successfully \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than \p width values or
+ * is not a multiple of the size of a value \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p width is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
-                                              unsigned int dimensions);
+rocrand_generate_uniform_double_2d(rocrand_generator generator,
+                                   double * output_data, size_t width,
+                                   size_t height, size_t pitch);
 
 /**
- * \brief Returns the version number of the library.
+ * \brief Generates normally distributed \p float values to a pitched 2D array.
  *
- * Returns in \p version the version number of the dynamically linked
- * rocRAND library.
+ * Generates \p width x \p height normally distributed 32-bit floating-point values
+ * and saves them to rows of a 2D array, the results are the same as of \p height
+ * calls of rocrand_generate_normal() with \p width values (see rocrand_generate_2d()).
  *
- * \param version - Version of the library
+ * \param generator - Generator to use
+ * \param output_data - Pointer to the first row of the array
+ * \param width - Number of <tt>float</tt>s in each row
+ * \param height - Number of rows
+ * \param pitch - Distance in bytes between the starts of consecutive rows
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
  *
  * \return
- * - ROCRAND_STATUS_OUT_OF_RANGE if \p version is NULL \n
- * - ROCRAND_STATUS_SUCCESS if the version number was successfully returned \n
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than \p width values or
+ * is not a multiple of the size of a value \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p width is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_get_version(int * version);
+rocrand_generate_normal_2d(rocrand_generator generator,
+                           float * output_data, size_t width,
+                           size_t height, size_t pitch,
+                           float mean, float stddev);
 
 /**
- * \brief Construct the histogram for a Poisson distribution.
+ * \brief Generates normally distributed \p double values to a pitched 2D array.
  *
- * Construct the histogram for the Poisson distribution with lambda \p lambda.
+ * Generates \p width x \p height normally distributed 64-bit floating-point values
+ * and saves them to rows of a 2D array, the results are the same as of \p height
+ * calls of rocrand_generate_normal_double() with \p width values
+ * (see rocrand_generate_2d()).
  *
- * \param lambda - lambda for the Poisson distribution
- * \param discrete_distribution - pointer to the histogram in device memory
+ * \param generator - Generator to use
+ * \param output_data - Pointer to the first row of the array
+ * \param width - Number of <tt>double</tt>s in each row
+ * \param height - Number of rows
+ * \param pitch - Distance in bytes between the starts of consecutive rows
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
  *
  * \return
- * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
- * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than \p width values or
+ * is not a multiple of the size of a value \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p width is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_create_poisson_distribution(double lambda,
-                                    rocrand_discrete_distribution * discrete_distribution);
+rocrand_generate_normal_double_2d(rocrand_generator generator,
+                                  double * output_data, size_t width,
+                                  size_t height, size_t pitch,
+                                  double mean, double stddev);
 
 /**
- * \brief Construct the histogram for a custom discrete distribution.
+ * \brief Generates log-normally distributed \p float values to a pitched 2D array.
  *
- * Construct the histogram for the discrete distribution of \p size
- * 32-bit unsigned integers from the range [\p offset, \p offset + \p size)
- * using \p probabilities as probabilities.
+ * Generates \p width x \p height log-normally distributed 32-bit floating-point values
+ * and saves them to rows of a 2D array, the results are the same as of \p height
+ * calls of rocrand_generate_log_normal() with \p width values
+ * (see rocrand_generate_2d()).
  *
- * \param probabilities - probabilities of the the distribution in host memory
- * \param size - size of \p probabilities
- * \param offset - offset of values
- * \param discrete_distribution - pointer to the histogram in device memory
+ * \param generator - Generator to use
+ * \param output_data - Pointer to the first row of the array
+ * \param width - Number of <tt>float</tt>s in each row
+ * \param height - Number of rows
+ * \param pitch - Distance in bytes between the starts of consecutive rows
+ * \param mean - Mean value of log normal distribution
+ * \param stddev - Standard deviation value of log normal distribution
  *
  * \return
- * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if \p size was zero \n
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than \p width values or
+ * is not a multiple of the size of a value \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p width is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_2d(rocrand_generator generator,
+                               float * output_data, size_t width,
+                               size_t height, size_t pitch,
+                               float mean, float stddev);
+
+/**
+ * \brief Generates log-normally distributed \p double values to a pitched 2D array.
+ *
+ * Generates \p width x \p height log-normally distributed 64-bit floating-point values
+ * and saves them to rows of a 2D array, the results are the same as of \p height
+ * calls of rocrand_generate_log_normal_double() with \p width values
+ * (see rocrand_generate_2d()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to the first row of the array
+ * \param width - Number of <tt>double</tt>s in each row
+ * \param height - Number of rows
+ * \param pitch - Distance in bytes between the starts of consecutive rows
+ * \param mean - Mean value of log normal distribution
+ * \param stddev - Standard deviation value of log normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than \p width values or
+ * is not a multiple of the size of a value \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p width is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_double_2d(rocrand_generator generator,
+                                      double * output_data, size_t width,
+                                      size_t height, size_t pitch,
+                                      double mean, double stddev);
+
+/**
+ * \brief Generates 32-bit unsigned integers of an ensemble of seeds.
+ *
+ * Generates \p k rows of \p n numbers to \p output_data (row r starts at
+ * \p output_data + r * \p n): row r contains the numbers which rocrand_generate()
+ * of \p n values returns for a new generator of the same type and settings
+ * (offset, partition) with seed \p seeds[r]. All rows are generated by one
+ * kernel launch, the seed of a row is the key of its counters, so no state
+ * per row is initialized or stored. The state of \p generator is not changed.
+ *
+ * Only counter-based generators (Philox and Threefry) are supported,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_10 only with ROCRAND_ORDERING_PSEUDO_BEST,
+ * ROCRAND_ORDERING_PSEUDO_SEEDED or ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store \p k * \p n numbers
+ * \param seeds - Pointer to \p k seeds in device memory
+ * \param k - Number of rows (seeds)
+ * \param n - Number of numbers per row
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a counter-based
+ * device generator \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_ensemble(rocrand_generator generator,
+                          unsigned int * output_data,
+                          const unsigned long long * seeds,
+                          size_t k, size_t n);
+
+/**
+ * \brief Generates uniformly distributed \p float values of an ensemble of seeds.
+ *
+ * Generates \p k rows of \p n uniformly distributed floats, row r contains
+ * the values of rocrand_generate_uniform() of a new generator with seed
+ * \p seeds[r] (see rocrand_generate_ensemble()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store \p k * \p n floats
+ * \param seeds - Pointer to \p k seeds in device memory
+ * \param k - Number of rows (seeds)
+ * \param n - Number of floats per row
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a counter-based
+ * device generator \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_ensemble(rocrand_generator generator,
+                                  float * output_data,
+                                  const unsigned long long * seeds,
+                                  size_t k, size_t n);
+
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers from [lo, hi) range.
+ *
+ * Generates \p n uniformly distributed 32-bit unsigned integers from [\p lo, \p hi)
+ * range and saves them to \p output_data.
+ *
+ * Pseudo-random generators use Lemire's multiply-shift method, numbers which would
+ * introduce bias are rejected and replaced, so the values are unbiased and no
+ * modulo is computed in kernels. Quasi-random generators map each point by
+ * multiply-shift without rejection to keep their low-discrepancy properties.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param lo - Lower bound of the range (inclusive)
+ * \param hi - Upper bound of the range (exclusive)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p hi is not greater than \p lo \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_int(rocrand_generator generator,
+                             unsigned int * output_data, size_t n,
+                             unsigned int lo, unsigned int hi);
+
+/**
+ * \brief Generates uniformly distributed 64-bit unsigned integers from [lo, hi) range.
+ *
+ * Generates \p n uniformly distributed 64-bit unsigned integers from [\p lo, \p hi)
+ * range and saves them to \p output_data.
+ *
+ * Pseudo-random generators use Lemire's multiply-shift method on 64-bit numbers
+ * drawn from two 32-bit numbers. Quasi-random generators map each point by
+ * multiply-shift without rejection, only 64-bit quasi-random generators
+ * are supported.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 64-bit unsigned integers to generate
+ * \param lo - Lower bound of the range (inclusive)
+ * \param hi - Upper bound of the range (exclusive)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p hi is not greater than \p lo \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a 32-bit quasi-random generator \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_long_long(rocrand_generator generator,
+                                   unsigned long long * output_data, size_t n,
+                                   unsigned long long lo, unsigned long long hi);
+
+/**
+ * \brief Generates Poisson-distributed 32-bit unsigned integers.
+ *
+ * Generates \p n Poisson-distributed 32-bit unsigned integers and
+ * saves them to \p output_data.
+ *
+ * Philox, MRG32K3A and XORWOW generators use the rejection method PA
+ * (normal approximation for \p lambda above 4000) for \p lambda >= 64,
+ * so generation with a new \p lambda does not build and copy tables.
+ * Other generators and smaller \p lambda use precomputed tables, which are
+ * cached (see rocrand_set_poisson_cache_size()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param lambda - lambda for the Poisson distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson(rocrand_generator generator,
+                         unsigned int * output_data, size_t n,
+                         double lambda);
+
+/**
+ * \brief Generates Poisson-distributed 32-bit unsigned integers with
+ * a rate per value.
+ *
+ * Generates \p n Poisson-distributed 32-bit unsigned integers and
+ * saves them to \p output_data, i-th value has lambda \p lambdas[i].
+ *
+ * Values are computed as by rocrand_poisson() of the device API: Knuth's method
+ * for lambda < 64, the rejection method PA up to 4000 and the normal
+ * approximation above, no tables are used. Values of non-positive lambdas are 0.
+ * Neighboring values with lambdas in the same range are computed with less
+ * divergence of threads.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+ * ROCRAND_RNG_PSEUDO_THREEFRY2_64_20, ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+ * ROCRAND_RNG_PSEUDO_MRG32K3A and ROCRAND_RNG_PSEUDO_XORWOW generators
+ * created with rocrand_create_generator().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param lambdas - Pointer to device memory with \p n lambdas
+ * \param n - Number of 32-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson_array(rocrand_generator generator,
+                               unsigned int * output_data,
+                               const double * lambdas,
+                               size_t n);
+
+/**
+ * \brief Generates binomially distributed 32-bit unsigned integers with
+ * parameters per value.
+ *
+ * Generates \p n binomially distributed 32-bit unsigned integers and
+ * saves them to \p output_data, i-th value is the number of successes of
+ * \p trials[i] trials with probability \p probabilities[i].
+ *
+ * Values are computed as by rocrand_binomial() of the device API: inversion
+ * for trials * min(p, 1 - p) < 10 and the transformed rejection method BTRD
+ * above, so the amount of work per value does not grow with the number of trials.
+ * Values of probabilities not greater than 0 are 0, values of probabilities
+ * not less than 1 are the numbers of trials.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+ * ROCRAND_RNG_PSEUDO_THREEFRY2_64_20, ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+ * ROCRAND_RNG_PSEUDO_MRG32K3A, ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_XOSHIRO128PP and ROCRAND_RNG_PSEUDO_PCG32 generators
+ * created with rocrand_create_generator().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param trials - Pointer to device memory with \p n numbers of trials
+ * \param probabilities - Pointer to device memory with \p n probabilities
+ * \param n - Number of 32-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_binomial_array(rocrand_generator generator,
+                                unsigned int * output_data,
+                                const unsigned int * trials,
+                                const double * probabilities,
+                                size_t n);
+
+/**
+ * \brief Generates multinomially distributed counts with parameters per value.
+ *
+ * Distributes \p trials[i] trials of each of \p n values among \p categories
+ * categories and saves the counts to \p output_data. Parameters and counts
+ * are stored by category: the probability of category j of value i is
+ * \p probabilities[j * n + i] and its count is saved to
+ * \p output_data[j * n + i], so \p probabilities and \p output_data have
+ * \p n * \p categories elements.
+ *
+ * Counts are computed by conditional binomial values as by rocrand_multinomial()
+ * of the device API, the last category gets the remaining trials.
+ * Probabilities of a value should sum to 1.
+ *
+ * Supported by the generators of rocrand_generate_binomial_array().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store \p n * \p categories counts
+ * \param trials - Pointer to device memory with \p n numbers of trials
+ * \param probabilities - Pointer to device memory with \p n * \p categories probabilities
+ * \param categories - Number of categories
+ * \param n - Number of values (sets of counts) to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p categories is 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multinomial_array(rocrand_generator generator,
+                                   unsigned int * output_data,
+                                   const unsigned int * trials,
+                                   const double * probabilities,
+                                   unsigned int categories,
+                                   size_t n);
+
+/**
+ * \brief Generates gamma-distributed floats.
+ *
+ * Generates \p n gamma-distributed 32-bit floating-point values
+ * with shape \p shape and scale \p scale, and saves them to \p output_data.
+ *
+ * Values are computed by the rejection method of Marsaglia and Tsang
+ * (values of \p shape less than 1 from values of \p shape + 1). Every
+ * attempt uses the same amount of random numbers, rejected attempts
+ * draw more numbers only for their own values.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated values
+ * \param n - Number of floats to generate
+ * \param shape - Shape of the distribution
+ * \param scale - Scale of the distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is non-positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_gamma(rocrand_generator generator,
+                       float * output_data, size_t n,
+                       float shape, float scale);
+
+/**
+ * \brief Generates gamma-distributed doubles.
+ *
+ * Generates \p n gamma-distributed 64-bit double-precision floating-point
+ * values with shape \p shape and scale \p scale, and saves them to
+ * \p output_data (see rocrand_generate_gamma()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated values
+ * \param n - Number of doubles to generate
+ * \param shape - Shape of the distribution
+ * \param scale - Scale of the distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is non-positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_gamma_double(rocrand_generator generator,
+                              double * output_data, size_t n,
+                              double shape, double scale);
+
+/**
+ * \brief Generates beta-distributed floats.
+ *
+ * Generates \p n beta-distributed 32-bit floating-point values from [0, 1]
+ * with shapes \p alpha and \p beta, and saves them to \p output_data.
+ * Every value is X / (X + Y) of gamma-distributed X and Y with shapes
+ * \p alpha and \p beta (see rocrand_generate_gamma()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated values
+ * \param n - Number of floats to generate
+ * \param alpha - First shape of the distribution
+ * \param beta - Second shape of the distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p alpha or \p beta is non-positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_beta(rocrand_generator generator,
+                      float * output_data, size_t n,
+                      float alpha, float beta);
+
+/**
+ * \brief Generates beta-distributed doubles.
+ *
+ * Generates \p n beta-distributed 64-bit double-precision floating-point
+ * values from [0, 1] with shapes \p alpha and \p beta, and saves them to
+ * \p output_data (see rocrand_generate_beta()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated values
+ * \param n - Number of doubles to generate
+ * \param alpha - First shape of the distribution
+ * \param beta - Second shape of the distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p alpha or \p beta is non-positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_beta_double(rocrand_generator generator,
+                             double * output_data, size_t n,
+                             double alpha, double beta);
+
+/**
+ * \brief Generates exponentially distributed floats.
+ *
+ * Generates \p n exponentially distributed 32-bit floating-point values
+ * with rate \p lambda (mean 1 / \p lambda), and saves them to \p output_data.
+ * Every value uses one random number.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated values
+ * \param n - Number of floats to generate
+ * \param lambda - Rate of the distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lambda is non-positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_exponential(rocrand_generator generator,
+                             float * output_data, size_t n,
+                             float lambda);
+
+/**
+ * \brief Generates exponentially distributed doubles.
+ *
+ * Generates \p n exponentially distributed 64-bit double-precision
+ * floating-point values with rate \p lambda (mean 1 / \p lambda), and saves
+ * them to \p output_data. Every value uses two random numbers.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated values
+ * \param n - Number of doubles to generate
+ * \param lambda - Rate of the distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lambda is non-positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_exponential_double(rocrand_generator generator,
+                                    double * output_data, size_t n,
+                                    double lambda);
+
+/**
+ * \brief Generates packed Bernoulli trials.
+ *
+ * Generates \p n_bits independent trials with probability \p p of 1 bits,
+ * packed 32 trials per 32-bit unsigned integer (bit i of value j is trial
+ * 32 * j + i), and saves (\p n_bits + 31) / 32 values to \p output_data.
+ * Bits of the last value beyond \p n_bits are trials too.
+ *
+ * \p p is rounded to a multiple of 2^-32. Probabilities k / 2^m are
+ * computed exactly by comparing m bits of 32 numbers at once, every value
+ * uses m random numbers (one for \p p = 0.5). Other probabilities are
+ * compared with a threshold, every value uses 32 random numbers.
+ * \p p = 0 and \p p = 1 do not use random numbers. The same method is
+ * used by rocrand_bernoulli_bits() of the device API.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated values
+ * \param n_bits - Number of trials to generate
+ * \param p - Probability of 1 bits, from [0, 1]
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p p is not from [0, 1] \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_bernoulli_bits(rocrand_generator generator,
+                                unsigned int * output_data, size_t n_bits,
+                                double p);
+
+/**
+ * \brief Generates truncated normally distributed floats.
+ *
+ * Generates \p n normally distributed 32-bit floating-point values with
+ * mean \p mean and standard deviation \p stddev conditioned on the interval
+ * [\p a, \p b], and saves them to \p output_data.
+ *
+ * Values of intervals which do not lie beyond 3 standard deviations from
+ * the mean are computed by the inverse CDF from one random number each.
+ * Values of intervals in the tails are computed by the exponential rejection
+ * method of Robert, which accepts more than 95% of attempts however far
+ * the interval is from the mean.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated values
+ * \param n - Number of floats to generate
+ * \param mean - Mean of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution
+ * \param a - Lower bound of the interval, can be -INFINITY
+ * \param b - Upper bound of the interval, can be INFINITY
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stddev is non-positive or \p a is not
+ * less than \p b \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal(rocrand_generator generator,
+                                  float * output_data, size_t n,
+                                  float mean, float stddev,
+                                  float a, float b);
+
+/**
+ * \brief Generates truncated normally distributed doubles.
+ *
+ * Generates \p n normally distributed 64-bit double-precision floating-point
+ * values with mean \p mean and standard deviation \p stddev conditioned on
+ * the interval [\p a, \p b], and saves them to \p output_data. Methods are
+ * the same as of rocrand_generate_truncated_normal(), every uniform value
+ * uses two random numbers.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated values
+ * \param n - Number of doubles to generate
+ * \param mean - Mean of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution
+ * \param a - Lower bound of the interval, can be -INFINITY
+ * \param b - Upper bound of the interval, can be INFINITY
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stddev is non-positive or \p a is not
+ * less than \p b \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal_double(rocrand_generator generator,
+                                         double * output_data, size_t n,
+                                         double mean, double stddev,
+                                         double a, double b);
+
+/**
+ * \brief Generates correlated multivariate normally distributed floats.
+ *
+ * Generates \p n vectors mean + factor * z of \p dimensions 32-bit
+ * floating-point values, where z are vectors of independent standard normal
+ * values and \p factor is a lower triangular matrix (for example, the Cholesky
+ * factor of the covariance matrix), and saves them to \p output_data.
+ *
+ * Vectors are the rows of an \p n x \p dimensions column-major matrix:
+ * component j of vector i is saved to \p output_data[j * n + i].
+ * \p factor is a column-major \p dimensions x \p dimensions matrix (element
+ * in row j and column k is \p factor[k * dimensions + j]), its upper triangle
+ * is not used.
+ *
+ * Every thread draws the values z of its vector and multiplies them
+ * by \p factor in registers, so uncorrelated values are never stored and
+ * no separate matrix multiplication is needed.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store \p n * \p dimensions values
+ * \param n - Number of vectors to generate
+ * \param dimensions - Number of components of a vector, up to 64
+ * \param mean - Pointer to device memory with \p dimensions means
+ * \param factor - Pointer to device memory with the lower triangular factor
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is 0 or greater than 64 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal(rocrand_generator generator,
+                                     float * output_data, size_t n,
+                                     unsigned int dimensions,
+                                     const float * mean,
+                                     const float * factor);
+
+/**
+ * \brief Generates correlated multivariate normally distributed doubles.
+ *
+ * Generates \p n vectors mean + factor * z of \p dimensions 64-bit
+ * double-precision floating-point values, and saves them to \p output_data.
+ * Layouts of \p output_data and \p factor are the same as of
+ * rocrand_generate_multivariate_normal().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store \p n * \p dimensions values
+ * \param n - Number of vectors to generate
+ * \param dimensions - Number of components of a vector, up to 64
+ * \param mean - Pointer to device memory with \p dimensions means
+ * \param factor - Pointer to device memory with the lower triangular factor
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is 0 or greater than 64 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal_double(rocrand_generator generator,
+                                            double * output_data, size_t n,
+                                            unsigned int dimensions,
+                                            const double * mean,
+                                            const double * factor);
+
+/**
+ * \brief Generates categorical distributed 32-bit unsigned integers.
+ *
+ * Generates one value for each of \p batch rows of the row-major matrix
+ * \p probabilities, the value of row \p i is a category from
+ * [0, \p n_categories) distributed according to probabilities
+ * <tt>probabilities[i * ld + j]</tt> of categories \p j (probabilities do
+ * not need to be normalized, negative probabilities are treated as 0, rows
+ * with zero sum give 0). Values are saved to \p output_data.
+ *
+ * No tables are built: one uniform number is generated for every row, and
+ * its category is found by inversion of the row (a block of threads per
+ * row computes prefix sums). The matrix is in device memory for
+ * generators created with rocrand_create_generator(), in host memory for
+ * host generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated values
+ * \param probabilities - Row-major matrix of probabilities
+ * \param batch - Number of rows (and values)
+ * \param n_categories - Number of categories (columns)
+ * \param ld - Distance between rows of \p probabilities in elements
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p n_categories is 0 or \p ld is less
+ * than \p n_categories \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is 64-bit quasi-random \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_categorical(rocrand_generator generator,
+                             unsigned int * output_data,
+                             const float * probabilities,
+                             size_t batch,
+                             unsigned int n_categories,
+                             size_t ld);
+
+/**
+ * \brief Generates a random permutation.
+ *
+ * Generates a random permutation of [0, \p n) and saves it to \p output_data.
+ * The permutation is computed by the method set by rocrand_set_permutation_method():
+ * - ROCRAND_PERMUTATION_METHOD_FEISTEL (default): every value is computed
+ *   independently by a bijective Feistel network with 24 Philox-like rounds
+ *   (and cycle walking to [0, \p n)), no memory besides \p output_data is used.
+ *   Permutations are pseudo-random, but not uniform among all \p n! permutations.
+ * - ROCRAND_PERMUTATION_METHOD_EXACT: segments of 256 values are shuffled by
+ *   Fisher-Yates and merged by MergeShuffle, all permutations are equally
+ *   likely. Merges of the last levels run in few threads.
+ *
+ * Keys of both methods are 32 random numbers of the generator, so the generator
+ * advances as by rocrand_generate() of 32 values.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store the permutation
+ * \param n - Number of values, less than 2^32
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p n is not less than 2^32 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if the permutation was successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_permutation(rocrand_generator generator,
+                             unsigned int * output_data, size_t n);
+
+/**
+ * \brief Shuffles an array in device memory.
+ *
+ * Reorders \p n elements of \p element_size bytes in \p data by a random
+ * permutation of rocrand_generate_permutation() (element i is moved from
+ * the position given by value i of the permutation). Elements are copied
+ * to temporary device memory, ROCRAND_PERMUTATION_METHOD_EXACT also stores
+ * the permutation.
+ *
+ * \param generator - Generator to use
+ * \param data - Pointer to elements in device memory
+ * \param n - Number of elements, less than 2^32
+ * \param element_size - Size of an element in bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p n is not less than 2^32 or
+ * \p element_size is 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if the elements were successfully shuffled \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_shuffle(rocrand_generator generator,
+                void * data, size_t n, size_t element_size);
+
+/**
+ * \brief Samples indices without replacement.
+ *
+ * Selects \p k distinct indices of [0, \p n) and saves them to \p output_data
+ * in increasing order. With \p weights == NULL all subsets of \p k indices are
+ * equally likely, otherwise indices are selected one after another with
+ * probabilities proportional to \p weights of the remaining indices
+ * (\p weights is an array of \p n floats in device memory).
+ *
+ * Uniform samples of up to 2048 indices are selected by Floyd's algorithm in one
+ * thread block, the work does not depend on \p n. Weighted samples and larger
+ * uniform samples give every index a random key (-log(u) / weight for weighted
+ * samples, Efraimidis-Spirakis) and select the \p k smallest keys by a radix
+ * selection with block histograms, which reads \p weights 6 times. Indices
+ * with non-positive weights are selected only when fewer than \p k weights
+ * are positive.
+ *
+ * Keys are 32 random numbers of the generator, so the generator advances as
+ * by rocrand_generate() of 32 values.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store \p k indices
+ * \param k - Number of indices to select
+ * \param n - Number of indices to select from, less than 2^32
+ * \param weights - Weights of indices in device memory, or NULL
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p k is greater than \p n or \p n is not
+ * less than 2^32 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if indices were successfully selected \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_sample_without_replacement(rocrand_generator generator,
+                                   unsigned int * output_data,
+                                   size_t k, size_t n,
+                                   const float * weights);
+
+/**
+ * \brief Converts floats to half-precision floats with stochastic rounding.
+ *
+ * Converts \p n floats of \p input_data to half-precision floats and saves
+ * them to \p output_data. A value between two consecutive half-precision
+ * values a < b is rounded to b with probability (x - a) / (b - a), so
+ * the expected result equals the input. Values whose magnitude is not less
+ * than 65504 and NaN are rounded to nearest.
+ *
+ * Random numbers are Philox hashes (see rocrand_philox4x32_10_hash()) of
+ * indices of values with a key of 2 random numbers of the generator, they
+ * are computed in the conversion kernel, which reads \p input_data once.
+ * The generator advances as by rocrand_generate() of 2 values.
+ *
+ * \param generator - Generator to use
+ * \param input_data - Pointer to \p n floats in device memory
+ * \param output_data - Pointer to memory to store \p n half-precision floats
+ * \param n - Number of values to convert
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if values were successfully converted \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_stochastic_round_half(rocrand_generator generator,
+                              const float * input_data,
+                              __half * output_data, size_t n);
+
+/**
+ * \brief Converts floats to bfloat16 values with stochastic rounding.
+ *
+ * Converts \p n floats of \p input_data to bfloat16 values (the upper
+ * 16 bits of floats) and saves their bits to \p output_data. The lower 16 bits
+ * of every value are replaced by a carry with probability of their value
+ * divided by 2^16, so the expected result equals the input. Infinities
+ * are kept, NaN gives quiet NaN.
+ *
+ * Random numbers are computed as by rocrand_stochastic_round_half().
+ *
+ * \param generator - Generator to use
+ * \param input_data - Pointer to \p n floats in device memory
+ * \param output_data - Pointer to memory to store \p n bfloat16 values
+ * \param n - Number of values to convert
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if values were successfully converted \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_stochastic_round_bfloat16(rocrand_generator generator,
+                                  const float * input_data,
+                                  unsigned short * output_data, size_t n);
+
+/**
+ * \brief Quantizes floats to 8-bit integers with stochastic rounding.
+ *
+ * Saves \p n values x / \p scale of \p input_data clamped to [-128, 127]
+ * and rounded stochastically to integers to \p output_data: y between
+ * integers a < a + 1 is rounded to a + 1 with probability y - a. NaN gives 0.
+ *
+ * Random numbers are computed as by rocrand_stochastic_round_half().
+ *
+ * \param generator - Generator to use
+ * \param input_data - Pointer to \p n floats in device memory
+ * \param output_data - Pointer to memory to store \p n integers
+ * \param n - Number of values to convert
+ * \param scale - Quantization step, must be greater than 0
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p scale is not greater than 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator or
+ * a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if values were successfully converted \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_stochastic_round_int8(rocrand_generator generator,
+                              const float * input_data,
+                              signed char * output_data, size_t n,
+                              float scale);
+
+/**
+ * \brief Generates numbers of several requests.
+ *
+ * Generates numbers for \p count requests of \p requests in order. The results
+ * are the same as of calling the generate function of the distribution of each
+ * request (for example rocrand_generate_normal() for ROCRAND_DISTRIBUTION_NORMAL_FLOAT)
+ * in the same order, and requests must satisfy the requirements of those functions.
+ *
+ * XORWOW and MRG32K3A device generators validate all requests first and fill
+ * buffers of many requests in one kernel launch, so batches of small requests
+ * do not pay the launch overhead of each request. Other generators process
+ * requests one by one and stop at the first request which fails.
+ *
+ * \param generator - Generator to use
+ * \param requests - Array of requests
+ * \param count - Number of requests
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p requests is NULL and \p count is not 0,
+ * a distribution is invalid or lambda of a Poisson request is non-positive \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_batch(rocrand_generator generator,
+                       const rocrand_generate_request * requests,
+                       size_t count);
+
+/**
+ * \brief Generates numbers to host memory.
+ *
+ * Generates \p request->n numbers of the distribution of \p request and saves
+ * them to host memory \p request->output_data. Numbers are generated in chunks
+ * of \p chunk_size values into two device buffers on the stream of the generator,
+ * and generation of every chunk overlaps the device-to-host copy of the previous
+ * chunk on a separate stream, so large outputs are produced at close to the copy
+ * bandwidth instead of generation time plus copy time. The function returns when
+ * all numbers are in host memory.
+ *
+ * Copies are asynchronous only to pinned memory (allocated by \p hipHostMalloc or
+ * registered by \p hipHostRegister). Other host memory is supported: chunks are
+ * copied through two pinned staging buffers and the host moves every chunk to
+ * \p request->output_data while the next one is generated.
+ *
+ * The results are the same as of consecutive calls of the generate function
+ * of the distribution (see rocrand_generate_batch()) with \p chunk_size values
+ * (the last chunk may be smaller), so \p chunk_size must satisfy requirements
+ * of that function, for example it must be a multiple of the dimension
+ * of a quasi-random generator. Host generators generate to
+ * \p request->output_data directly.
+ *
+ * \param generator - Generator to use
+ * \param request - Request with a pointer to host memory
+ * \param chunk_size - Number of values of a chunk, 0 selects the default size
+ * (16M values)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p request is NULL or its distribution is invalid \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if buffers of chunks could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if a chunk does not satisfy length requirements
+ * of the generate function \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_to_host(rocrand_generator generator,
+                         const rocrand_generate_request * request,
+                         size_t chunk_size);
+
+/**
+ * \brief Reserves numbers of a counter-based generator.
+ *
+ * Returns in \p seed the seed of the generator and in \p position the
+ * position (including the offset) of the first number which would be
+ * generated by the next call of rocrand_generate(), and advances the
+ * generator as if \p n numbers were generated by rocrand_generate().
+ *
+ * Reserved numbers can be computed in user kernels with the device API:
+ * i-th number is the result of a state initialized with
+ * <tt>rocrand_init(seed, 0, position + i, &state)</tt>. This is used by
+ * the C++ wrapper to fuse generation with user transformations
+ * (see rocrand_cpp::philox4x32_10_engine::generate()).
+ *
+ * Only counter-based generators (ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ * ROCRAND_RNG_PSEUDO_THREEFRY4_32_20, ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 and
+ * ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+ * created with rocrand_create_generator() support this function,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_10 only with ROCRAND_ORDERING_PSEUDO_BEST,
+ * ROCRAND_ORDERING_PSEUDO_SEEDED or ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT.
+ *
+ * \param generator - Generator to use
+ * \param n - Number of 32-bit unsigned integers to reserve
+ * \param seed - Pointer to memory to store the seed
+ * \param position - Pointer to memory to store the position of the first number
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not counter-based or is in
+ *   capture-safe mode (see rocrand_set_capture_safe()) \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p seed or \p position is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if numbers were successfully reserved \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_reserve_sequence(rocrand_generator generator, size_t n,
+                         unsigned long long * seed,
+                         unsigned long long * position);
+
+/**
+ * \brief Initializes the generator's state on GPU or host.
+ *
+ * Initializes the generator's state on GPU or host. User it not
+ * required to call this function before using a generator.
+ *
+ * If rocrand_initialize() was not called for a generator, it will be
+ * automatically called by functions which generates random numbers like
+ * rocrand_generate(), rocrang_generate_uniform() etc.
+ *
+ * \param generator - Generator to initialize
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the seeds were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_initialize_generator(rocrand_generator generator);
+
+/**
+ * \brief Enables or disables capture-safe mode of the generator.
+ *
+ * Generation with a generator in capture-safe mode can be captured into
+ * a HIP graph (hipStreamBeginCapture() on the generator's stream): every
+ * launch of the graph continues the sequence where the previous launch
+ * (or generation outside of the graph) stopped, as if the captured
+ * generation functions were called again.
+ *
+ * Enabling the mode initializes the generator and copies its tables to
+ * the device, so later generations only enqueue kernels to the generator's
+ * stream. Generators with engine states (XORWOW, MRG32K3A, MTGP32, MT19937) keep
+ * them in device memory and need only the initialization. Counter-based
+ * generators (Philox, Sobol) keep the position of the next number in
+ * device memory instead of on the host, so rocrand_reserve_sequence()
+ * can not be used in this mode.
+ *
+ * The stream, ordering and dimensions must be set before the mode is
+ * enabled. Host-side work which can not be captured fails with
+ * ROCRAND_STATUS_LAUNCH_FAILURE during capture in any mode: initialization
+ * after the seed or the offset were changed, building Poisson tables of a
+ * lambda not cached yet (generate it once before capture), copying Sobol
+ * tables of new dimensions and rocrand_generate_range() of generators with
+ * engine states.
+ *
+ * Host generators do not support capture-safe mode.
+ *
+ * \param generator - Generator to modify
+ * \param capture_safe - Non-zero to enable, zero to disable capture-safe mode
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a host generator \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the generator's stream is being captured
+ *   or a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was successfully changed \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_capture_safe(rocrand_generator generator, int capture_safe);
+
+/**
+ * \brief Sets the current stream for kernel launches.
+ *
+ * Sets the current stream for all kernel launches of the generator.
+ * All functions will use this stream.
+ *
+ * \param generator - Generator to modify
+ * \param stream - Stream to use or NULL for default stream
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if stream was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_stream(rocrand_generator generator, hipStream_t stream);
+
+/**
+ * \brief Sets the seed of a pseudo-random number generator.
+ *
+ * Sets the seed of the pseudo-random number generator.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's offset.
+ *
+ * For a MRG32K3a generator seed value can't be zero. If \p seed is
+ * equal zero and generator's type is ROCRAND_RNG_PSEUDO_MRG32K3A,
+ * value \p 12345 is used as a seed instead.
+ *
+ * Randomized quasi-random generators ROCRAND_RNG_QUASI_LATTICE and
+ * ROCRAND_RNG_QUASI_HALTON also have a seed, which sets the random shift
+ * of lattices and the digit scrambling of Halton sequences.
+ *
+ * \param generator - Pseudo-random number generator
+ * \param seed - New seed value
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator
+ *   other than a lattice or Halton generator \n
+ * - ROCRAND_STATUS_SUCCESS if seed was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_seed(rocrand_generator generator, unsigned long long seed);
+
+/**
+ * \brief Prepares the state of a pseudo-random number generator for a seed.
+ *
+ * Initializes the state of the generator for \p seed (with the current
+ * offset, ordering and number of engines) in a second buffer, on a separate
+ * stream, so initialization runs concurrently with generation that uses
+ * the current state. The next rocrand_set_seed() call with the same \p seed
+ * swaps the prepared state in without launching initialization; the
+ * generator's stream waits for the preparation on the device only, the
+ * host is not blocked. Changing the offset, ordering or number of engines
+ * discards the prepared state, and rocrand_set_seed() with another seed
+ * initializes the state as usual.
+ *
+ * XORWOW, MRG32K3A, MTGP32 and MT19937 generators keep a second engine buffer (see
+ * rocrand_get_generator_memory_usage()). Philox has no state to initialize,
+ * so the function does nothing.
+ *
+ * \param generator - Pseudo-random number generator
+ * \param seed - Next seed value
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number
+ * generator or a host generator \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the state was prepared successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_prepare_seed(rocrand_generator generator, unsigned long long seed);
+
+/**
+ * \brief Sets the offset of a random number generator.
+ *
+ * Sets the absolute offset of the random number generator.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's seed.
+ *
+ * Absolute offset cannot be set if generator's type is ROCRAND_RNG_PSEUDO_MTGP32
+ * or ROCRAND_RNG_PSEUDO_MT19937.
+ *
+ * The offset of quasi-random generators is the index of the first point. Sequences
+ * of ROCRAND_RNG_QUASI_SOBOL32 and ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 have 2^32
+ * points, their offsets and positions are kept in 64 bits and the points wrap
+ * around modulo 2^32.
+ *
+ * \param generator - Random number generator
+ * \param offset - New absolute offset
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if offset was successfully set \n
+ * - ROCRAND_STATUS_TYPE_ERROR if generator's type is ROCRAND_RNG_PSEUDO_MTGP32
+ * or ROCRAND_RNG_PSEUDO_MT19937
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_offset(rocrand_generator generator, unsigned long long offset);
+
+/**
+ * \brief Sets the ordering of a random number generator.
+ *
+ * Sets the ordering of the results of the random number generator.
+ *
+ * Pseudo-random number generators support:
+ * - ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_LEGACY - the default
+ *   number of engines is used on every device, results are the same as results
+ *   of host generators and of versions of the library without orderings
+ * - ROCRAND_ORDERING_PSEUDO_BEST - the number of engines (and therefore results of
+ *   ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_PSEUDO_MRG32K3A, ROCRAND_RNG_PSEUDO_MTGP32,
+ *   ROCRAND_RNG_PSEUDO_MT19937, ROCRAND_RNG_PSEUDO_XOSHIRO128PP and
+ *   ROCRAND_RNG_PSEUDO_PCG32) is chosen for the device, results can differ between
+ *   devices
+ * - ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT - the number of engines is the
+ *   same on all devices and platforms (HIP-HCC and HIP-NVCC), results do not depend
+ *   on the device while the grid is still chosen for the device
+ * - ROCRAND_ORDERING_PSEUDO_SEEDED - same as ROCRAND_ORDERING_PSEUDO_BEST, but
+ *   engines of ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_PSEUDO_MRG32K3A,
+ *   ROCRAND_RNG_PSEUDO_XOSHIRO128PP and ROCRAND_RNG_PSEUDO_PCG32 are
+ *   initialized with different seeds instead of skipping ahead to different
+ *   subsequences, which makes initialization much faster but sequences of
+ *   engines are not guaranteed to be non-overlapping
+ *
+ * Results of counter-based generators (ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+ * ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 and ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+ * do not depend on the ordering. ROCRAND_RNG_PSEUDO_PHILOX4_32_10 uses engines
+ * with ROCRAND_ORDERING_PSEUDO_DEFAULT and ROCRAND_ORDERING_PSEUDO_LEGACY and
+ * is counter-based with the other orderings (see rocrand_create_generator()).
+ *
+ * Quasi-random number generators support:
+ * - ROCRAND_ORDERING_QUASI_DEFAULT - results are stored dimension by dimension
+ *   (all points of the first dimension, then all points of the second dimension...)
+ * - ROCRAND_ORDERING_QUASI_POINT_MAJOR - results are stored point by point
+ *   (all dimensions of the first point, then all dimensions of the second point...)
+ *
+ * Host generators support ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT
+ * (with the same results as device generators), ROCRAND_ORDERING_PSEUDO_DEFAULT,
+ * ROCRAND_ORDERING_PSEUDO_BEST and ROCRAND_ORDERING_PSEUDO_LEGACY (all of them
+ * use the legacy ordering, except ROCRAND_RNG_PSEUDO_PHILOX4_32_10 which is
+ * counter-based with ROCRAND_ORDERING_PSEUDO_BEST as on the device) and
+ * ROCRAND_ORDERING_QUASI_DEFAULT.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's seed and offset.
+ *
+ * \param generator - Random number generator
+ * \param order - New ordering
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p order is not a valid ordering \n
+ * - ROCRAND_STATUS_TYPE_ERROR if \p order is not supported by the generator \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_SUCCESS if the ordering was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_ordering(rocrand_generator generator, rocrand_ordering order);
+
+/**
+ * \brief Sets the method of normal and log-normal generation.
+ *
+ * Sets the method used by rocrand_generate_normal(), rocrand_generate_normal_double(),
+ * rocrand_generate_log_normal() and rocrand_generate_log_normal_double() (also for
+ * requests of rocrand_generate_batch()) of pseudo-random generator \p generator.
+ *
+ * ROCRAND_NORMAL_METHOD_BOX_MULLER is the default, it transforms each pair of
+ * numbers by the Box-Muller transform (log, sqrt and sincos per pair).
+ *
+ * ROCRAND_NORMAL_METHOD_ZIGGURAT uses the Ziggurat method: most values are computed
+ * with one table lookup and one multiplication from one 32-bit number (two numbers
+ * for doubles), about 1.2% of candidates need exp or log, and some of them are
+ * rejected, so the results differ from ROCRAND_NORMAL_METHOD_BOX_MULLER and
+ * the number of consumed random numbers depends on the values.
+ *
+ * ROCRAND_NORMAL_METHOD_INVERSION maps each 32-bit number (two numbers for doubles)
+ * by the inverse normal CDF (Giles' approximation of erfinv, the same transform as
+ * of quasi-random generators), relative error below 4e-7 for floats and 2e-15 for
+ * doubles. Each value depends on one input number, so monotonicity is preserved
+ * (for example, for antithetic or stratified inputs), and values are never
+ * rejected, but the results differ from ROCRAND_NORMAL_METHOD_BOX_MULLER.
+ *
+ * The requirements on \p n and alignment of the output are the same for all methods.
+ *
+ * Half-precision generation always uses the Box-Muller transform.
+ *
+ * - This operation does not change the generator's state, seed and offset.
+ *
+ * \param generator - Pseudo-random number generator
+ * \param method - Method of normal generation
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p method is not a valid method \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random or host generator,
+ * or ROCRAND_RNG_PSEUDO_MTGP32 and ROCRAND_RNG_PSEUDO_MT19937 (their threads draw
+ * numbers together, so they support only the Box-Muller transform) \n
+ * - ROCRAND_STATUS_SUCCESS if the method was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_normal_method(rocrand_generator generator, rocrand_normal_method method);
+
+/**
+ * \brief Sets the precision of transcendental functions of distributions.
+ *
+ * With ROCRAND_MATH_MODE_FAST, the Box-Muller transform of rocrand_generate_normal(),
+ * rocrand_generate_log_normal() and their half-precision variants uses device
+ * intrinsics __logf and __expf instead of logf and expf (sincos is always computed
+ * by __sincosf):
+ * - normal values closer than 1e-3 to \p mean (in units of \p stddev) have an
+ *   absolute error up to 1e-3, other values a relative error below 2^-20,
+ * - log-normal values have an additional relative error of (2 + 1.16 * |x|) ulp
+ *   where x is the normal value.
+ *
+ * Distributions of the mean and of the variance are not changed within the accuracy
+ * of float statistical tests (see test/crush/stat_test_rocrand_generate.cpp with
+ * the option --math-mode fast), so the mode is intended for noise of machine
+ * learning and similar applications which do not need the last ulp.
+ *
+ * Double-precision generation, ROCRAND_NORMAL_METHOD_ZIGGURAT and
+ * ROCRAND_NORMAL_METHOD_INVERSION, requests of rocrand_generate_batch(), other
+ * distributions and quasi-random generators (which use the inverse normal CDF)
+ * are not changed. The sequence
+ * of consumed random numbers is the same in both modes.
+ *
+ * - This operation does not change the generator's state, seed and offset.
+ *
+ * \param generator - Random number generator
+ * \param mode - Precision of transcendental functions
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p mode is not a valid mode \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator was created with
+ *   rocrand_create_generator_host() \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_math_mode(rocrand_generator generator, rocrand_math_mode mode);
+
+/**
+ * \brief Sets the resolution of uniformly distributed doubles.
+ *
+ * Sets how many random numbers rocrand_generate_uniform_double() consumes
+ * per value (see rocrand_double_resolution):
+ * - ROCRAND_DOUBLE_RESOLUTION_DEFAULT - the generator's own resolution:
+ *   53 bits (two 32-bit numbers) for ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ *   ROCRAND_RNG_PSEUDO_THREEFRY4_32_20, ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+ *   ROCRAND_RNG_PSEUDO_PHILOX4_64_10, ROCRAND_RNG_PSEUDO_XORWOW,
+ *   ROCRAND_RNG_PSEUDO_XOSHIRO128PP and ROCRAND_RNG_PSEUDO_PCG32,
+ *   32 bits (one number) for ROCRAND_RNG_PSEUDO_MRG32K3A,
+ *   ROCRAND_RNG_PSEUDO_MTGP32 and ROCRAND_RNG_PSEUDO_MT19937,
+ * - ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT - one number per value,
+ *   the same values as rocrand_uniform_double_fast() of the device API;
+ *   values are multiples of 2^-32, but generation is up to twice as fast
+ *   for generators with 53-bit resolution by default,
+ * - ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT - two numbers per value,
+ *   the same values as rocrand_uniform_double_full() of the device API.
+ *
+ * All values are from (0; 1] range. Other distributions, 2D and ensemble
+ * generation and requests of rocrand_generate_batch() are not changed.
+ *
+ * - This operation does not change the generator's state, seed and offset.
+ *
+ * \param generator - Pseudo-random number generator
+ * \param resolution - Resolution of uniformly distributed doubles
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p resolution is not a valid resolution \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number
+ *   generator or was created with rocrand_create_generator_host() \n
+ * - ROCRAND_STATUS_SUCCESS if the resolution was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_double_resolution(rocrand_generator generator,
+                              rocrand_double_resolution resolution);
+
+/**
+ * \brief Sets the method of random permutations.
+ *
+ * Sets the method of rocrand_generate_permutation() and rocrand_shuffle()
+ * (see rocrand_permutation_method).
+ *
+ * - This operation does not change the generator's state, seed and offset.
+ *
+ * \param generator - Random number generator
+ * \param method - Method of permutations
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p method is not a valid method \n
+ * - ROCRAND_STATUS_SUCCESS if the method was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_permutation_method(rocrand_generator generator,
+                               rocrand_permutation_method method);
+
+/**
+ * \brief Sets hints of generation to managed memory.
+ *
+ * Output memory of device generators is checked by hipPointerGetAttributes()
+ * on every generation call. If it is managed memory (allocated by
+ * hipMallocManaged()), \p hints (flags of rocrand_managed_hint) are applied
+ * on the generator's stream:
+ * - ROCRAND_MANAGED_HINT_PREFETCH - output is prefetched to the current
+ *   device before generation, so kernels do not page-fault through it
+ *   (enabled by default)
+ * - ROCRAND_MANAGED_HINT_READ_MOSTLY - output is advised as read-mostly
+ *   after generation
+ * - ROCRAND_MANAGED_HINT_PREFETCH_TO_HOST - output is prefetched back to
+ *   the host after generation, when it is consumed by host code
+ *
+ * \p hints equal to 0 disables the check. Hints do not change generated
+ * values, they are ignored on devices without managed memory support and
+ * while the generator's stream is being captured into a graph.
+ *
+ * - This operation does not change the generator's state, seed and offset.
+ *
+ * \param generator - Random number generator
+ * \param hints - Bitwise OR of rocrand_managed_hint flags or 0
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p hints contains unknown flags \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator was created with
+ *   rocrand_create_generator_host() \n
+ * - ROCRAND_STATUS_SUCCESS if hints were successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_managed_memory_hints(rocrand_generator generator, unsigned int hints);
+
+/**
+ * \brief Sets the number of engines of a pseudo-random number generator.
+ *
+ * Sets the number of engines (independent streams whose results are
+ * interleaved in the output) of ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG32K3A, ROCRAND_RNG_PSEUDO_MTGP32, ROCRAND_RNG_PSEUDO_MT19937,
+ * ROCRAND_RNG_PSEUDO_XOSHIRO128PP and ROCRAND_RNG_PSEUDO_PCG32 generators.
+ * Fewer engines need less memory (see rocrand_get_generator_memory_usage())
+ * but may not fill the device, so peak throughput can be lower.
+ *
+ * The number of engines replaces the number chosen by the ordering,
+ * results then depend only on the number of engines and are the same
+ * on all devices and for host generators. If \p engine_count is 0,
+ * the number of engines of the ordering is restored.
+ *
+ * ROCRAND_RNG_PSEUDO_MTGP32 supports at most 512 engines, ROCRAND_RNG_PSEUDO_MT19937
+ * at most 8192 engines (2^1000 numbers apart in the sequence of the seed).
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's seed, offset and ordering.
+ *
+ * \param generator - Pseudo-random number generator
+ * \param engine_count - Number of engines, 0 for the default number
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator has no engines
+ * (counter-based and quasi-random generators) \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p engine_count is greater than the maximum
+ * number of engines of the generator \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_SUCCESS if the number of engines was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_engine_count(rocrand_generator generator, unsigned int engine_count);
+
+/**
+ * \brief Returns the memory allocated by a random number generator.
+ *
+ * Returns the number of bytes of memory currently allocated by the generator:
+ * engines, precomputed tables and cached tables of Poisson distributions
+ * (see rocrand_set_poisson_cache_size()).
+ * Device memory is returned for generators created with rocrand_create_generator(),
+ * host memory for generators created with rocrand_create_generator_host().
+ * Temporary memory used by rocrand_generate_range() is not included.
+ * Precomputed tables of quasi-random generators are shared by all generators
+ * of the same device and are included in the result of each of them.
+ *
+ * \param generator - Random number generator
+ * \param bytes - Pointer to memory to store the number of bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p bytes is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the memory usage was successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_generator_memory_usage(rocrand_generator generator, size_t * bytes);
+
+/**
+ * \brief Function which allocates device memory for rocRAND.
+ *
+ * Allocates \p size bytes of device memory of the current device and stores
+ * the pointer to \p ptr. The memory is used by work enqueued to \p stream
+ * after the call, so stream-ordered allocators (e.g. pools based on
+ * hipMallocAsync()) can allocate it on \p stream without synchronization.
+ *
+ * \param ptr - Pointer to memory to store the pointer to allocated memory
+ * \param size - Number of bytes to allocate
+ * \param stream - Stream which will use the memory
+ * \param user_data - Pointer passed to rocrand_set_allocator() or
+ * rocrand_set_default_allocator()
+ *
+ * \return hipSuccess if memory was allocated, an error otherwise
+ */
+typedef hipError_t (*rocrand_device_malloc_fn)(void ** ptr, size_t size,
+                                               hipStream_t stream, void * user_data);
+
+/**
+ * \brief Function which frees device memory allocated by rocrand_device_malloc_fn.
+ *
+ * Work enqueued to \p stream before the call can still use the memory,
+ * so it must be reused only after that work is completed (as hipFree()
+ * and stream-ordered allocators do).
+ *
+ * \param ptr - Pointer to memory to free
+ * \param stream - Stream which used the memory last
+ * \param user_data - Pointer passed with the allocating function
+ *
+ * \return hipSuccess if memory was freed, an error otherwise
+ */
+typedef hipError_t (*rocrand_device_free_fn)(void * ptr, hipStream_t stream, void * user_data);
+
+/**
+ * \brief Sets the allocator of device memory of a random number generator.
+ *
+ * Engines, Poisson tables, buffers of rocrand_generate_to_host() and
+ * rocrand_generate_range() and other device memory of the generator are
+ * allocated by \p malloc_fn and freed by \p free_fn (with \p user_data)
+ * on the generator's stream instead of hipMalloc() and hipFree().
+ * If both functions are NULL, hipMalloc() and hipFree() are used.
+ *
+ * Engines of the generator are reallocated by the new allocator, so
+ * the state of generators with engines is reset (as by rocrand_set_seed()
+ * with the same seed). Other memory allocated before the call is freed
+ * by the allocator which allocated it. Generators use the default allocator
+ * (see rocrand_set_default_allocator()) until this function is called.
+ * Precomputed tables of quasi-random generators are shared by generators
+ * of the same device and are allocated by the default allocator.
+ *
+ * Generators created with rocrand_create_generator_host() do not use device
+ * memory, the allocator is ignored.
+ *
+ * \param generator - Random number generator
+ * \param malloc_fn - Function which allocates device memory
+ * \param free_fn - Function which frees device memory
+ * \param user_data - Pointer passed to \p malloc_fn and \p free_fn
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if only one of \p malloc_fn and \p free_fn is NULL \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if engines could not be allocated, the generator
+ *   keeps its allocator and state \n
+ * - ROCRAND_STATUS_SUCCESS if the allocator was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_allocator(rocrand_generator generator,
+                      rocrand_device_malloc_fn malloc_fn,
+                      rocrand_device_free_fn free_fn,
+                      void * user_data);
+
+/**
+ * \brief Sets the default allocator of device memory.
+ *
+ * The default allocator is used by generators created after the call
+ * (see rocrand_set_allocator()), by discrete distributions created
+ * after the call (e.g. rocrand_create_poisson_distribution()) and by
+ * precomputed tables shared by quasi-random generators of a device when
+ * they are allocated. Tables returned by rocrand_get_device_tables() are
+ * never freed and are always allocated by hipMalloc().
+ * Memory allocated before the call is freed by the allocator which
+ * allocated it, so the allocator must remain valid until such memory
+ * is freed. If both functions are NULL, hipMalloc() and hipFree()
+ * are used (the initial default allocator).
+ *
+ * \param malloc_fn - Function which allocates device memory
+ * \param free_fn - Function which frees device memory
+ * \param user_data - Pointer passed to \p malloc_fn and \p free_fn
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if only one of \p malloc_fn and \p free_fn is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the allocator was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_default_allocator(rocrand_device_malloc_fn malloc_fn,
+                              rocrand_device_free_fn free_fn,
+                              void * user_data);
+
+/**
+ * \brief Returns the size of a saved state of a random number generator.
+ *
+ * Returns the number of bytes of memory needed by rocrand_save_state():
+ * a header with counters of the generator (seed, offset, ordering, position
+ * of Philox and Sobol generators) followed by engines of XORWOW, MRG32k3a,
+ * MTGP32 and MT19937 generators. The size depends on the number of engines, so it
+ * changes with rocrand_set_ordering() and rocrand_set_engine_count().
+ *
+ * \param generator - Random number generator
+ * \param bytes - Pointer to memory to store the number of bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p bytes is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator was created with
+ *   rocrand_create_generator_host() \n
+ * - ROCRAND_STATUS_SUCCESS if the size was successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_state_size(rocrand_generator generator, size_t * bytes);
+
+/**
+ * \brief Saves the state of a random number generator.
+ *
+ * Copies the state of \p generator to \p state, device or host memory of at
+ * least rocrand_get_state_size() bytes. Copies are enqueued to \p stream
+ * and the function does not wait for them, so \p state can be used only after
+ * work of \p stream is completed. Copies are ordered after generation of
+ * the generator if \p stream is the stream of the generator
+ * (see rocrand_set_stream()).
+ *
+ * A generator of the same type restores the state with rocrand_load_state()
+ * and continues the sequence exactly, without skipping ahead as
+ * rocrand_set_offset() does (which is not supported by MTGP32 and MT19937).
+ * Generators created with rocrand_create_generator_host() are not supported.
+ *
+ * \param generator - Random number generator
+ * \param state - Pointer to memory to store the state
+ * \param stream - Stream which copies the state
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p state is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator was created with
+ *   rocrand_create_generator_host() \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if \p stream is being captured into a graph \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if copies could not be enqueued \n
+ * - ROCRAND_STATUS_SUCCESS if copies were successfully enqueued \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_save_state(rocrand_generator generator, void * state, hipStream_t stream);
+
+/**
+ * \brief Restores the state of a random number generator.
+ *
+ * Restores a state saved by rocrand_save_state() of a generator of the same
+ * type: seed, offset, ordering, number of engines (see rocrand_set_engine_count()),
+ * method of normal generation, math mode, resolution of doubles (see
+ * rocrand_set_math_mode() and rocrand_set_double_resolution()) and the
+ * position in the sequence. Engines are
+ * copied on \p stream without initialization, the function waits only for
+ * the copy of the header of the state. Engines must not be used by work of
+ * other streams until the copy is completed. Poisson tables, the stream,
+ * the allocator and capture-safe mode of \p generator are not changed.
+ *
+ * States of orderings which depend on the device (e.g. ROCRAND_ORDERING_PSEUDO_BEST)
+ * can be loaded only by generators with the same number of engines,
+ * ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT or rocrand_set_engine_count()
+ * give states which can be loaded on any device.
+ *
+ * \param generator - Random number generator
+ * \param state - Pointer to a state saved by rocrand_save_state()
+ * \param stream - Stream which copies the state
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p state is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator was created with
+ *   rocrand_create_generator_host(), if \p state is not a state of a generator
+ *   of the same type or if the number of engines is different, \p generator is
+ *   not changed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if engines could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if \p stream is being captured into a graph \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the state could not be copied \n
+ * - ROCRAND_STATUS_SUCCESS if the state was successfully restored \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_load_state(rocrand_generator generator, const void * state, hipStream_t stream);
+
+/**
+ * \brief Exports the state of a generator to other processes.
+ *
+ * Saves the state of \p generator (see rocrand_save_state()) to device
+ * memory owned by \p generator and returns an IPC handle of it
+ * (hipIpcGetMemHandle()). Processes on the same device create generators
+ * with this state by rocrand_import_generator() without initializing
+ * engines. The function waits for work of the stream of \p generator.
+ *
+ * The state is a snapshot: later generation by \p generator does not change
+ * it and every import starts at the same position. Processes which should
+ * draw disjoint parts of the sequence use children of the imported generator
+ * with different subsequences (see rocrand_fork_generator()). The memory is
+ * reused by the next export and freed with \p generator, which must not be
+ * destroyed before other processes have imported it.
+ *
+ * \param generator - Random number generator
+ * \param handle - Pointer to the handle to store
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p handle is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator was created with
+ *   rocrand_create_generator_host() \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory of the state could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the stream of \p generator is being captured \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the state could not be copied or exported \n
+ * - ROCRAND_STATUS_SUCCESS if the generator was successfully exported \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_export_generator(rocrand_generator generator,
+                         rocrand_generator_ipc_handle * handle);
+
+/**
+ * \brief Creates a generator with a state exported by another process.
+ *
+ * Opens \p handle of rocrand_export_generator() (hipIpcOpenMemHandle()),
+ * creates a generator of the exported type and restores the exported state
+ * as rocrand_load_state() does: engines are copied within the device, they are
+ * not initialized. The function waits for the copy and closes the handle,
+ * so the generator does not depend on the exporting process afterwards.
+ * The generator uses the default stream and allocator and is destroyed by
+ * rocrand_destroy_generator().
+ *
+ * \param handle - Pointer to a handle of rocrand_export_generator()
+ * \param generator - Pointer to the generator to create
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p handle or \p generator is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if \p handle does not contain a state of its type \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the generator could not be created \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the handle could not be opened or
+ *   the state could not be copied \n
+ * - ROCRAND_STATUS_SUCCESS if the generator was successfully created \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_import_generator(const rocrand_generator_ipc_handle * handle,
+                         rocrand_generator * generator);
+
+/**
+ * \brief Creates a child generator which produces an independent stream of its parent.
+ *
+ * Creates a new generator \p child of the same type as \p parent with
+ * the same settings (ordering, number of engines, method of normal
+ * generation, offset, stream, allocator and the limit of the Poisson cache).
+ * It is cheaper than creating and seeding a new generator: tables are
+ * shared and the state of the child is derived on the device.
+ *
+ * - XORWOW, MRG32K3A, xoshiro128++ and PCG32: engines of the child are
+ *   copied from the current engines of \p parent (which are initialized
+ *   first if needed) and skipped ahead by (\p subsequence_id + 1) times the
+ *   number of engines subsequences with one kernel, so sequences of the
+ *   parent and of children with different \p subsequence_id do not overlap
+ *   (PCG32 switches to other streams of its LCG). If the child is
+ *   initialized again (e.g. by rocrand_set_offset()), its engines keep
+ *   the shifted subsequences.
+ * - Philox 4x32-10: the key of the child is derived from the seed of
+ *   \p parent and \p subsequence_id.
+ * - MTGP32: the seed of the child is derived from the seed of \p parent and
+ *   \p subsequence_id, parameters of engines are shared by all MTGP32
+ *   generators of the device.
+ * - MT19937: the seed of the child is derived from the seed of \p parent and
+ *   \p subsequence_id, engines of the child are initialized with jumps when
+ *   the child is used.
+ *
+ * Children are independent generators which must be destroyed by
+ * rocrand_destroy_generator(), the parent can be destroyed before them.
+ * Engines of the parent are read on the stream of \p parent.
+ *
+ * Quasi-random generators share their tables on the device and can not
+ * be forked, use rocrand_set_offset() to split their sequence.
+ *
+ * \param parent - Random number generator to fork
+ * \param child - Pointer to generator of the child
+ * \param subsequence_id - Identifier of the child
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if \p parent wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p child is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if \p parent is a quasi-random generator or
+ *   was created with rocrand_create_generator_host() \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if engines could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the stream is being captured into a graph
+ *   or if a kernel could not be launched \n
+ * - ROCRAND_STATUS_SUCCESS if the child was successfully created \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_fork_generator(rocrand_generator parent,
+                       rocrand_generator * child,
+                       unsigned long long subsequence_id);
+
+/**
+ * \brief Leases a generator of \p generator for requests on \p stream.
+ *
+ * A generator must not be used concurrently from several host threads or
+ * streams: its stream, engines and Poisson cache are not synchronized. Leases
+ * let one generator serve concurrent requests: every lease is a child
+ * generator which can be used on \p stream by one thread until it is returned
+ * by rocrand_release_stream_generator(), leases of different threads and
+ * streams run concurrently.
+ *
+ * The generator has up to 64 lease slots; a lease takes the free slot with the
+ * lowest index without locking. The first lease of slot k creates the child
+ * rocrand_fork_generator(generator, &child, k) (see there for its substream),
+ * so sequences of slots do not overlap and are the same in every run with
+ * the same order of leases. A returned child keeps its state and continues
+ * its sequence in the next lease of the slot without initialization; work of
+ * the next lease on another stream waits for the work of the previous one.
+ * Leases are destroyed with \p generator and must not be destroyed by
+ * rocrand_destroy_generator().
+ *
+ * Settings of \p generator changed after the first lease of a slot are not
+ * copied to its child. \p generator itself must not be used by other threads
+ * while a slot is leased for the first time.
+ *
+ * \param generator - Random number generator which owns leases
+ * \param stream - Stream of requests of the lease
+ * \param lease - Pointer to the leased generator
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lease is NULL or all slots are leased \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random generator or
+ *   was created with rocrand_create_generator_host() \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if slots or engines could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a kernel of the first lease of the slot
+ *   could not be launched \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if \p stream could not wait for the previous lease \n
+ * - ROCRAND_STATUS_SUCCESS if the generator was successfully leased \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_acquire_stream_generator(rocrand_generator generator,
+                                 hipStream_t stream,
+                                 rocrand_generator * lease);
+
+/**
+ * \brief Returns a generator leased by rocrand_acquire_stream_generator().
+ *
+ * The slot of \p lease becomes free after requests enqueued by the lease,
+ * they do not have to be completed.
+ *
+ * \param generator - Random number generator which owns \p lease
+ * \param lease - Leased generator
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lease is not a current lease of \p generator \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the end of the requests could not be recorded \n
+ * - ROCRAND_STATUS_SUCCESS if the lease was successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_release_stream_generator(rocrand_generator generator,
+                                 rocrand_generator lease);
+
+/**
+ * \brief Assigns a disjoint part of the sequence to one of \p nranks processes.
+ *
+ * Generators of all ranks (e.g. MPI processes of a multi-node job) are created
+ * with the same type, seed and settings, each rank calls this function with
+ * its \p rank. The sequences of different ranks do not overlap; the setup is
+ * done by the usual skipahead of engines (logarithmic in the distance) when
+ * the generator is initialized. Rank 0 of 1 is the default partition.
+ *
+ * - XORWOW, MRG32K3A and xoshiro128++: engines of \p rank start at subsequence
+ *   \p rank * ((2^64 - 1) / \p nranks). PCG32 uses its 2^63 streams the same way.
+ * - Philox 4x32-10, Threefry and Philox 4x64-10: counters of \p rank start at
+ *   number \p rank * ((2^64 - 1) / \p nranks) (rounded down to whole counters).
+ * - MTGP32: engines of \p rank use a separate range of parameter sets, the
+ *   number of engines is limited by the number of sets divided by \p nranks.
+ * - MT19937: engines of \p rank are a separate range of jumped engines, the
+ *   number of engines is limited by 8192 / \p nranks.
+ * - Sobol: points of \p rank start at point \p rank * (2^32 / \p nranks)
+ *   (32-bit) or \p rank * ((2^64 - 1) / \p nranks) (64-bit).
+ *
+ * The offset (see rocrand_set_offset()) is added within the part of the rank
+ * and children created by rocrand_fork_generator() stay in the part of their
+ * parent as long as all their subsequences fit into it. The partition is not
+ * a part of states saved by rocrand_save_state() (engines and positions are),
+ * so it must be set again before a state of Philox or Threefry generators is
+ * loaded. The state of the generator is reset.
+ *
+ * \param generator - Random number generator
+ * \param rank - Index of the part, less than \p nranks
+ * \param nranks - Number of parts
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p nranks is 0, if \p rank is not less than
+ *   \p nranks or if \p nranks is larger than the number of parameter sets of
+ *   MTGP32 or jumped engines of MT19937 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator was created with
+ *   rocrand_create_generator_host() \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if engines could not be allocated \n
+ * - ROCRAND_STATUS_SUCCESS if the partition was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_subsequence_partition(rocrand_generator generator,
+                                  unsigned int rank,
+                                  unsigned int nranks);
+
+/**
+ * \brief Sets the memory limit of the cache of Poisson tables of a generator.
+ *
+ * rocrand_generate_poisson() and Poisson requests of rocrand_generate_batch()
+ * use precomputed tables (except the rejection method for large \p lambda, see
+ * rocrand_generate_poisson()). Tables of recently used \p lambda values are kept
+ * while their total size does not exceed \p bytes, least recently used tables
+ * are freed first, so workloads which alternate between several values of
+ * \p lambda do not recompute and copy tables on every call. Tables of the last
+ * used \p lambda are always kept. The default limit is 32 MiB, 0 keeps only
+ * the tables of the last used \p lambda.
+ *
+ * The new limit is applied when tables of a new \p lambda are created.
+ *
+ * \param generator - Random number generator
+ * \param bytes - Maximum number of bytes of cached tables
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if the limit was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_poisson_cache_size(rocrand_generator generator, size_t bytes);
+
+/**
+ * \brief Returns statistics of the cache of Poisson tables of a generator.
+ *
+ * Returns the number of generations which used cached tables (\p hits) and
+ * the number of generations which had to create tables (\p misses) since
+ * the generator was created. Generations without tables are not counted.
+ *
+ * \param generator - Random number generator
+ * \param hits - Pointer to memory to store the number of cache hits
+ * \param misses - Pointer to memory to store the number of cache misses
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p hits or \p misses is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the statistics were successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_poisson_cache_stats(rocrand_generator generator,
+                                unsigned long long * hits,
+                                unsigned long long * misses);
+
+/**
+ * \brief Returns runtime statistics of a random number generator.
+ *
+ * Returns counters of the generator since it was created:
+ * - \p samples - numbers generated by all generate functions
+ *   (including requests of rocrand_generate_batch() and chunks of
+ *   rocrand_generate_to_host()),
+ * - \p launches - kernels launched to generate numbers or to initialize
+ *   the state, always 0 for generators created with rocrand_create_generator_host(),
+ * - \p inits - initializations of the state, which happen on the first
+ *   generation and on the next generation after the state is reset
+ *   (e.g. by rocrand_set_seed() or rocrand_set_offset()),
+ * - \p table_rebuilds - tables of Poisson distributions created because
+ *   they were not cached (misses of rocrand_get_poisson_cache_stats()),
+ * - \p init_time and \p table_time - host time in milliseconds spent in
+ *   initializations and in creation of Poisson tables (asynchronous kernels
+ *   are not waited for, so host time of launches is included, not their
+ *   execution time).
+ *
+ * Frequent initializations or table rebuilds relative to \p samples
+ * indicate workloads which reset the generator or change \p lambda
+ * too often. Numbers of launches which fail are not counted.
+ *
+ * \param generator - Random number generator
+ * \param stats - Pointer to memory to store the statistics
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stats is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the statistics were successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_generator_stats(rocrand_generator generator,
+                            rocrand_generator_stats * stats);
+
+/**
+ * \brief Returns telemetry of device generators of a type.
+ *
+ * Returns counters of all device generators of type \p rng_type since the start
+ * of the process, including destroyed generators. Numbers, initializations
+ * and Poisson tables are counted as by rocrand_get_generator_stats(),
+ * generate functions also count their calls and bytes of output.
+ *
+ * Every n-th generate call of the process (n is the value of the environment
+ * variable \p ROCRAND_TELEMETRY_SAMPLE_RATE, 16 by default, 0 disables timing)
+ * is timed by events recorded to the generator's stream before and after its
+ * kernels. Events are never waited for, times of calls are added when their
+ * kernels are completed, so \p timed_calls can be less than the number of
+ * sampled calls. Calls captured into graphs are not timed.
+ *
+ * Telemetry is collected only if the library is built with the cmake option
+ * \p ENABLE_TELEMETRY, generators created with rocrand_create_generator_host()
+ * are not counted.
+ *
+ * \param rng_type - Type of generators
+ * \param stats - Pointer to memory to store the telemetry
+ *
+ * \return
+ * - ROCRAND_STATUS_TYPE_ERROR if the library is built without telemetry \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stats is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the telemetry was successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_telemetry_stats(rocrand_rng_type rng_type,
+                            rocrand_telemetry_stats * stats);
+
+/**
+ * \brief Function which receives telemetry of device generators.
+ *
+ * \param stats - Array of telemetry of generator types used in the process
+ * \param count - Number of elements of \p stats
+ * \param user_data - Pointer passed to rocrand_set_telemetry_callback()
+ */
+typedef void (*rocrand_telemetry_callback)(const rocrand_telemetry_stats * stats,
+                                           size_t count, void * user_data);
+
+/**
+ * \brief Sets the function which periodically receives telemetry.
+ *
+ * \p callback receives telemetry of all generator types used in the process
+ * (see rocrand_get_telemetry_stats()). It is called by a generate function
+ * which ends at least \p interval seconds after the previous report, in the
+ * thread of that function (the library starts no threads), so the callback
+ * must not call rocrand_set_telemetry_callback(). Reports are not made while
+ * no generate functions are called.
+ *
+ * When the environment variable \p ROCRAND_TELEMETRY_FILE is set, reports are
+ * also written to a JSON file at its path ("%p" is replaced by the process id),
+ * every \p ROCRAND_TELEMETRY_INTERVAL seconds (10 by default, or \p interval
+ * after the call) and at exit.
+ *
+ * \param callback - Function which receives telemetry, NULL disables callbacks
+ * \param user_data - Pointer passed to \p callback
+ * \param interval - Minimum time between reports in seconds
+ *
+ * \return
+ * - ROCRAND_STATUS_TYPE_ERROR if the library is built without telemetry \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p interval is negative \n
+ * - ROCRAND_STATUS_SUCCESS if the callback was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_telemetry_callback(rocrand_telemetry_callback callback,
+                               void * user_data,
+                               double interval);
+
+/**
+ * \brief Set the number of dimensions of a quasi-random number generator.
+ *
+ * Set the number of dimensions of a quasi-random number generator.
+ * Supported values of \p dimensions are 1 to 20000. Sobol generators support
+ * more dimensions if the library loads tables of more dimensions (environment
+ * variable \p ROCRAND_SOBOL_TABLES, see \p sobol_dimensions of
+ * rocrand_get_host_tables()).
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's offset.
+ *
+ * \param generator - Quasi-random number generator
+ * \param dimensions - Number of dimensions
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a quasi-random number generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is out of range \n
+ * - ROCRAND_STATUS_SUCCESS if the number of dimensions was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
+                                              unsigned int dimensions);
+
+/**
+ * \brief Set the first dimension of a quasi-random number generator.
+ *
+ * Sets the index of the first dimension generated by quasi-random number
+ * generator \p generator: dimensions [\p first_dimension, \p first_dimension + d)
+ * of the sequence are generated, where d is set by
+ * rocrand_set_quasi_random_generator_dimensions(). The default is 0.
+ *
+ * Together with rocrand_set_offset() it allows to split a run between devices or
+ * processes: each of them generates its own range of points and dimensions,
+ * and values are the same as in the corresponding part of the output of one
+ * generator of all points and dimensions. Neither preceding points nor
+ * preceding dimensions are generated, the state of the first point of each
+ * thread is computed directly from its index (Gray code of the index).
+ *
+ * \p first_dimension + d must not be greater than 20000 (or the number of
+ * dimensions of Sobol tables), it is checked when
+ * the generator is used (generation functions return ROCRAND_STATUS_OUT_OF_RANGE).
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's offset and number of dimensions.
+ *
+ * \param generator - Quasi-random number generator
+ * \param first_dimension - Index of the first dimension (0-based)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a quasi-random number generator
+ *   or if it is a host generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p first_dimension is not less than the supported
+ *   number of dimensions \n
+ * - ROCRAND_STATUS_SUCCESS if the first dimension was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_quasi_random_generator_first_dimension(rocrand_generator generator,
+                                                   unsigned int first_dimension);
+
+/**
+ * \brief Sets the generating vector of a lattice generator.
+ *
+ * Coordinate d of point i of ROCRAND_RNG_QUASI_LATTICE generators is
+ * (phi(i) * \p vector[d] + shift[d]) mod 2^32 (in 32-bit fixed point),
+ * where phi(i) is the bit-reversed index and shift is random (set by the seed).
+ * Odd components give lattices whose first 2^m points have all coordinates
+ * distinct, published generating vectors of extensible lattices in base 2 can
+ * be used. \p vector is copied, it must have at least as many components as
+ * dimensions of the generator, which is checked when the generator is used
+ * (generation functions return ROCRAND_STATUS_OUT_OF_RANGE).
+ * NULL \p vector (or zero \p size) restores the built-in Korobov vector.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's offset and number of dimensions.
+ *
+ * \param generator - Lattice quasi-random number generator
+ * \param vector - Generating vector (host memory) or NULL
+ * \param size - Number of components of \p vector
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a lattice generator \n
+ * - ROCRAND_STATUS_SUCCESS if the generating vector was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_lattice_generating_vector(rocrand_generator generator,
+                                      const unsigned int * vector,
+                                      unsigned int size);
+
+/**
+ * \brief Returns the version number of the library.
+ *
+ * Returns in \p version the version number of the dynamically linked
+ * rocRAND library.
+ *
+ * \param version - Version of the library
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p version is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the version number was successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_version(int * version);
+
+/**
+ * \brief Returns precomputed tables of the library in host memory.
+ *
+ * Returns in \p tables a pointer to tables of the library in host memory.
+ * The tables are valid until the library is unloaded.
+ *
+ * \param tables - Pointer to memory to store the pointer to the tables
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p tables is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the tables were successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_host_tables(const rocrand_precomputed_tables ** tables);
+
+/**
+ * \brief Returns precomputed tables of the library in device memory.
+ *
+ * Returns in \p tables a pointer to a structure in host memory with
+ * pointers to tables of the library in memory of the current device.
+ * The pointers can be passed to kernels, for example Sobol direction vectors
+ * to rocrand_init() of Sobol states, so applications do not need to include
+ * large headers like rocrand_sobol_precomputed.h.
+ *
+ * Jump matrices of XORWOW and MRG32k3a are device variables of the library.
+ * Sobol tables are copied to the device on the first call for the device
+ * (about 13 MB) and stay allocated until the process exits.
+ *
+ * When device code is compiled with \p ROCRAND_EXTERNAL_TABLES defined,
+ * rocrand_kernel.h does not include the precomputed jump matrices and
+ * the device functions use the tables of the library instead, see
+ * rocrand_load_precomputed_tables().
+ *
+ * \param tables - Pointer to memory to store the pointer to the tables
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p tables is NULL \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the tables could not be copied or
+ *   the current device could not be queried \n
+ * - ROCRAND_STATUS_SUCCESS if the tables were successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_device_tables(const rocrand_precomputed_tables ** tables);
+
+/**
+ * \brief Creates a random number generator split across several devices.
+ *
+ * Creates a generator of type \p rng_type which owns one generator and
+ * one stream on each of \p device_count devices \p devices, and returns
+ * it in \p generator. All device generators have the same seed and
+ * offset, rocrand_generate_multi_device() fills consecutive parts of one
+ * sequence on all devices in parallel. ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ * generators use ROCRAND_ORDERING_PSEUDO_BEST (counter-based) ordering.
+ *
+ * Values for \p rng_type are:
+ * - ROCRAND_RNG_PSEUDO_XORWOW
+ * - ROCRAND_RNG_PSEUDO_MRG32K3A
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+ * - ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+ * - ROCRAND_RNG_PSEUDO_PCG32
+ * - ROCRAND_RNG_QUASI_SOBOL32
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+ *
+ * \param generator - Pointer to generator
+ * \param rng_type - Type of generator to create
+ * \param devices - Devices to use
+ * \param device_count - Number of devices
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p devices is NULL, \p device_count is 0
+ * or a device is invalid \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the value for \p rng_type is invalid \n
+ * - ROCRAND_STATUS_SUCCESS if generator was created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_multi_device_generator(rocrand_multi_device_generator * generator,
+                                      rocrand_rng_type rng_type,
+                                      const int * devices,
+                                      unsigned int device_count);
+
+/**
+ * \brief Destroys a random number generator split across several devices.
+ *
+ * \param generator - Generator to be destroyed
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if generator was destroyed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_destroy_multi_device_generator(rocrand_multi_device_generator generator);
+
+/**
+ * \brief Sets the seed of a generator split across several devices.
+ *
+ * Sets the seed of generators of all devices and resets the position
+ * in the sequence, see rocrand_set_seed().
+ *
+ * \param generator - Generator to modify
+ * \param seed - New seed value
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if seed was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_multi_device_seed(rocrand_multi_device_generator generator,
+                              unsigned long long seed);
+
+/**
+ * \brief Sets the offset of a generator split across several devices.
+ *
+ * Sets the offset of generators of all devices and resets the position
+ * in the sequence, see rocrand_set_offset().
+ *
+ * \param generator - Generator to modify
+ * \param offset - New absolute offset
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if offset was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_multi_device_offset(rocrand_multi_device_generator generator,
+                                unsigned long long offset);
+
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers on
+ * several devices.
+ *
+ * Generates \p sizes[i] numbers to \p output_data[i] in memory of device
+ * \p i (in the order of devices passed to
+ * rocrand_create_multi_device_generator()) for every device. Parts are
+ * consecutive ranges of one sequence: the combined output of one call,
+ * and of successive calls, is the same as numbers [p, p + total) returned
+ * by rocrand_generate_range() of one generator of the same type, seed and
+ * offset, where p is the number of numbers generated by previous calls.
+ * For the first call it is the output of one rocrand_generate() call of
+ * the total size on one device.
+ *
+ * Devices generate in parallel on their own streams, the function returns
+ * when all parts are generated.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Array of pointers to device memory, one per device
+ * \param sizes - Array of numbers of numbers to generate, one per device
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p output_data or \p sizes is NULL \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory for temporary engines could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multi_device(rocrand_multi_device_generator generator,
+                              unsigned int * const * output_data,
+                              const size_t * sizes);
+
+/**
+ * \brief Construct the histogram for a Poisson distribution.
+ *
+ * Construct the histogram for the Poisson distribution with lambda \p lambda.
+ *
+ * \param lambda - lambda for the Poisson distribution
+ * \param discrete_distribution - pointer to the histogram in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
+ * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_poisson_distribution(double lambda,
+                                    rocrand_discrete_distribution * discrete_distribution);
+
+/**
+ * \brief Construct the histogram for a custom discrete distribution.
+ *
+ * Construct the histogram for the discrete distribution of \p size
+ * 32-bit unsigned integers from the range [\p offset, \p offset + \p size)
+ * using \p probabilities as probabilities.
+ *
+ * \param probabilities - probabilities of the the distribution in host memory
+ * \param size - size of \p probabilities
+ * \param offset - offset of values
+ * \param discrete_distribution - pointer to the histogram in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size was zero \n
  * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
  */
 rocrand_status ROCRANDAPI
@@ -477,6 +3219,101 @@ rocrand_create_discrete_distribution(const double * probabilities,
                                      unsigned int offset,
                                      rocrand_discrete_distribution * discrete_distribution);
 
+/**
+ * \brief Construct the histogram for a custom discrete distribution
+ * from probabilities in device memory.
+ *
+ * Construct the histogram for the discrete distribution of \p size
+ * 32-bit unsigned integers from the range [\p offset, \p offset + \p size)
+ * using \p probabilities as probabilities, like
+ * rocrand_create_discrete_distribution(). Probabilities are not copied to
+ * the host: their sum, the alias table and the cumulative distribution
+ * function are computed on the device (parallel alias table construction
+ * and prefix sums), which is faster for large distributions.
+ * Probabilities do not need to be normalized. The function returns when
+ * the histogram is ready.
+ *
+ * \param probabilities - probabilities of the distribution in device memory
+ * \param size - size of \p probabilities
+ * \param offset - offset of values
+ * \param discrete_distribution - pointer to the histogram in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size was zero \n
+ * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution_device(const double * probabilities,
+                                            unsigned int size,
+                                            unsigned int offset,
+                                            rocrand_discrete_distribution * discrete_distribution);
+
+/**
+ * \brief Construct an updatable histogram for a custom discrete distribution.
+ *
+ * Construct the histogram for the discrete distribution of \p size
+ * 32-bit unsigned integers from the range [\p offset, \p offset + \p size)
+ * using \p probabilities as (unnormalized) probabilities. Unlike
+ * rocrand_create_discrete_distribution(), probabilities of the distribution
+ * can be changed later with rocrand_update_discrete_distribution() without
+ * rebuilding it.
+ *
+ * The histogram is a Fenwick tree of probabilities in device memory,
+ * generation of one value takes log2(\p size) steps. Values are in
+ * inversion order, so the histogram can be used with both pseudo-random
+ * and quasi-random generators.
+ *
+ * \param probabilities - probabilities of the distribution in host memory
+ * \param size - size of \p probabilities
+ * \param offset - offset of values
+ * \param discrete_distribution - pointer to the histogram in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size was zero \n
+ * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution_updatable(const double * probabilities,
+                                               unsigned int size,
+                                               unsigned int offset,
+                                               rocrand_discrete_distribution * discrete_distribution);
+
+/**
+ * \brief Update probabilities of an updatable discrete distribution.
+ *
+ * Sets probabilities of values <tt>offset + indices[i]</tt> to
+ * \p probabilities[i] for \p k values. Probabilities are in the same
+ * units as the probabilities the histogram was created with (they are not
+ * normalized). Indices must be unique, indices not less than the size of the
+ * distribution are ignored. The update takes O(\p k log(size)) work on
+ * the device.
+ *
+ * The update is asynchronous with respect to the host and is ordered with
+ * other work of the default (null) stream.
+ *
+ * \param discrete_distribution - histogram created by
+ * rocrand_create_discrete_distribution_updatable()
+ * \param indices - indices of values in device memory
+ * \param probabilities - new probabilities in device memory
+ * \param k - number of values to update
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution was null \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the histogram is not updatable \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the update was enqueued successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_update_discrete_distribution(rocrand_discrete_distribution discrete_distribution,
+                                     const unsigned int * indices,
+                                     const double * probabilities,
+                                     unsigned int k);
+
 /**
  * \brief Destroy the histogram array for a discrete distribution.
  *
@@ -30,6 +30,10 @@
 #include <sstream>
 #include <type_traits>
 #include <limits>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
 
 #include "rocrand.h"
 #include "rocrand_kernel.h"
@@ -845,6 +849,216 @@ private:
     param_type m_params;
 };
 
+/// \cond
+namespace detail {
+
+// Returns 4 numbers of the Philox stream of key (subsequence 0) starting
+// at number c * 4 + substate
+__device__ inline
+uint4 philox4x32_10_group(const uint2 key, const unsigned long long c,
+                          const unsigned int substate)
+{
+    uint4 v = ::rocrand_device::detail::philox4x32_10_ten_rounds(
+        uint4 { static_cast<unsigned int>(c), static_cast<unsigned int>(c >> 32), 0, 0 },
+        key
+    );
+    if(substate > 0)
+    {
+        const unsigned long long c_next = c + 1;
+        const uint4 v_next = ::rocrand_device::detail::philox4x32_10_ten_rounds(
+            uint4 { static_cast<unsigned int>(c_next), static_cast<unsigned int>(c_next >> 32), 0, 0 },
+            key
+        );
+        const unsigned int r[8] = { v.x, v.y, v.z, v.w, v_next.x, v_next.y, v_next.z, v_next.w };
+        v = uint4 { r[substate], r[substate + 1], r[substate + 2], r[substate + 3] };
+    }
+    return v;
+}
+
+// Applies f to numbers [position, position + size) of the Philox stream
+// of subsequence 0 of seed (see rocrand_reserve_sequence()), every thread
+// computes groups of 4 numbers directly from their counters.
+template<class T, class Functor>
+__global__
+void philox4x32_10_generate_kernel(const unsigned long long seed,
+                                   const unsigned long long position,
+                                   T * output, const size_t size,
+                                   Functor f)
+{
+    const uint2 key = uint2 {
+        static_cast<unsigned int>(seed),
+        static_cast<unsigned int>(seed >> 32)
+    };
+    const unsigned long long counter = position / 4;
+    const unsigned int substate = static_cast<unsigned int>(position % 4);
+
+    const size_t stride = hipGridDim_x * hipBlockDim_x;
+    for(size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        index < (size + 3) / 4;
+        index += stride)
+    {
+        const uint4 v = philox4x32_10_group(key, counter + index, substate);
+
+        const size_t first = index * 4;
+        const unsigned int count = static_cast<unsigned int>(size - first < 4 ? size - first : 4);
+        for(unsigned int i = 0; i < count; i++)
+        {
+            output[first + i] = f((&v.x)[i]);
+        }
+    }
+}
+
+// Reduces values of all threads of the block with op, the result is valid
+// in thread 0
+template<unsigned int BlockSize, class T, class ReduceOp>
+__device__ inline
+T block_reduce(T value, ReduceOp op)
+{
+    __shared__ typename std::aligned_storage<sizeof(T), alignof(T)>::type storage[BlockSize];
+    T * values = reinterpret_cast<T *>(storage);
+
+    const unsigned int tid = hipThreadIdx_x;
+    values[tid] = value;
+    __syncthreads();
+    for(unsigned int active = BlockSize / 2; active > 0; active /= 2)
+    {
+        if(tid < active)
+        {
+            values[tid] = op(values[tid], values[tid + active]);
+        }
+        __syncthreads();
+    }
+    return values[0];
+}
+
+// Reduces f(distribution(x)) of numbers [position, position + size) of the
+// Philox stream of seed, every block stores its partial result
+template<unsigned int BlockSize, class T, class Distribution, class Function, class ReduceOp>
+__global__
+__launch_bounds__(BlockSize)
+void philox4x32_10_reduce_kernel(const unsigned long long seed,
+                                 const unsigned long long position,
+                                 const size_t size,
+                                 Distribution distribution, Function f,
+                                 ReduceOp op, T identity,
+                                 T * partials)
+{
+    const uint2 key = uint2 {
+        static_cast<unsigned int>(seed),
+        static_cast<unsigned int>(seed >> 32)
+    };
+    const unsigned long long counter = position / 4;
+    const unsigned int substate = static_cast<unsigned int>(position % 4);
+
+    T value = identity;
+    const size_t stride = hipGridDim_x * BlockSize;
+    for(size_t index = hipBlockIdx_x * BlockSize + hipThreadIdx_x;
+        index < (size + 3) / 4;
+        index += stride)
+    {
+        const uint4 v = philox4x32_10_group(key, counter + index, substate);
+
+        const size_t first = index * 4;
+        const unsigned int count = static_cast<unsigned int>(size - first < 4 ? size - first : 4);
+        for(unsigned int i = 0; i < count; i++)
+        {
+            value = op(value, f(distribution((&v.x)[i])));
+        }
+    }
+
+    value = block_reduce<BlockSize>(value, op);
+    if(hipThreadIdx_x == 0)
+    {
+        partials[hipBlockIdx_x] = value;
+    }
+}
+
+// Reduces partial results of blocks, launched as one block
+template<unsigned int BlockSize, class T, class ReduceOp>
+__global__
+__launch_bounds__(BlockSize)
+void reduce_partials_kernel(const T * partials, const unsigned int count,
+                            ReduceOp op, T identity,
+                            T * result)
+{
+    T value = identity;
+    for(unsigned int i = hipThreadIdx_x; i < count; i += BlockSize)
+    {
+        value = op(value, partials[i]);
+    }
+    value = block_reduce<BlockSize>(value, op);
+    if(hipThreadIdx_x == 0)
+    {
+        *result = value;
+    }
+}
+
+struct sum_op
+{
+    template<class T>
+    __host__ __device__
+    T operator()(const T& a, const T& b) const
+    {
+        return a + b;
+    }
+};
+
+// Count, mean and sum of squared differences from the mean of samples
+struct moments
+{
+    double count;
+    double mean;
+    double m2;
+};
+
+template<class Function>
+struct to_moments
+{
+    Function f;
+
+    template<class U>
+    __host__ __device__
+    moments operator()(const U& x) const
+    {
+        return moments { 1.0, static_cast<double>(f(x)), 0.0 };
+    }
+};
+
+// Merges moments of two sets of samples (Chan et al.)
+struct merge_moments
+{
+    __host__ __device__
+    moments operator()(const moments& a, const moments& b) const
+    {
+        const double count = a.count + b.count;
+        if(count == 0.0)
+        {
+            return a;
+        }
+        const double delta = b.mean - a.mean;
+        return moments {
+            count,
+            a.mean + delta * (b.count / count),
+            a.m2 + b.m2 + delta * delta * (a.count * b.count / count)
+        };
+    }
+};
+
+} // end namespace detail
+/// \endcond
+
+/// \cond
+template<class Engine>
+class buffered_engine;
+
+template<class Engine, class Distribution>
+class counting_random_iterator;
+
+template<class Engine, class Distribution, class Function, class ReduceOp, class T>
+T monte_carlo_reduce(Engine& engine, Distribution distribution, size_t size,
+                     Function f, ReduceOp reduce_op, T identity);
+/// \endcond
+
 /// \brief Pseudorandom number engine based Philox algorithm.
 ///
 /// philox4x32_10_engine implements
@@ -883,6 +1097,7 @@ public:
     /// See also: rocrand_create_generator()
     philox4x32_10_engine(seed_type seed_value = DefaultSeed,
                          offset_type offset_value = 0)
+        : m_stream(0)
     {
         rocrand_status status;
         status = rocrand_create_generator(&m_generator, this->type());
@@ -903,7 +1118,7 @@ public:
     ///
     /// \param generator - rocRAND generator
     philox4x32_10_engine(rocrand_generator& generator)
-        : m_generator(generator)
+        : m_generator(generator), m_stream(0)
     {
         if(generator == NULL)
         {
@@ -927,6 +1142,7 @@ public:
     {
         rocrand_status status = rocrand_set_stream(m_generator, value);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        m_stream = value;
     }
 
     /// \brief Sets the offset of a random number engine.
@@ -960,6 +1176,25 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \brief Sets the ordering of the pseudo-random number engine.
+    ///
+    /// The default and legacy orderings generate the sequence of earlier
+    /// versions of the library. generate() with a function object,
+    /// counting_random_iterator and monte_carlo_reduce() need the counter-based
+    /// sequence of \p ROCRAND_ORDERING_PSEUDO_BEST, \p ROCRAND_ORDERING_PSEUDO_SEEDED
+    /// or \p ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT.
+    ///
+    /// - This operation resets the engine's internal state.
+    ///
+    /// \param value - New ordering
+    ///
+    /// See also: rocrand_set_ordering()
+    void order(rocrand_ordering value)
+    {
+        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
     /// \brief Fills \p output with uniformly distributed random integer values.
     ///
     /// Generates \p size random integer values uniformly distributed
@@ -981,6 +1216,72 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \brief Fills \p output with values of a user function of random integers.
+    ///
+    /// Generates \p size random integer values uniformly distributed
+    /// on the interval [0, 2^32 - 1], applies \p f to each of them, and stores
+    /// the results into the device memory referenced by \p output pointer.
+    /// \p f is called in the generating kernel, so the random integers are not
+    /// stored in memory and no separate transformation pass is needed.
+    ///
+    /// The results are the same as \p f applied to the values of rocrand_generate()
+    /// and the engine is advanced by the same number of values. The kernel is
+    /// launched on the stream set by stream(). The engine must use a
+    /// counter-based ordering (see order()), otherwise
+    /// \p ROCRAND_STATUS_TYPE_ERROR is thrown.
+    ///
+    /// \tparam T - type of generated values
+    /// \tparam Functor - function object type, <tt>T operator()(unsigned int) const</tt>
+    /// must be a \p __device__ function
+    ///
+    /// \param output - Pointer to device memory to store results
+    /// \param size - Number of values to generate
+    /// \param f - Function object applied to random integers
+    ///
+    /// Example:
+    /// \code
+    /// struct clamped_uniform
+    /// {
+    ///     __device__ float operator()(unsigned int v) const
+    ///     {
+    ///         return fminf(rocrand_device::detail::uniform_distribution(v), 0.9f);
+    ///     }
+    /// };
+    ///
+    /// rocrand_cpp::philox4x32_10 engine;
+    /// engine.order(ROCRAND_ORDERING_PSEUDO_BEST);
+    /// engine.generate(output, size, clamped_uniform());
+    /// \endcode
+    ///
+    /// See also: rocrand_reserve_sequence()
+    template<class T, class Functor>
+    void generate(T * output, size_t size, Functor f)
+    {
+        seed_type seed_value;
+        offset_type position;
+        rocrand_status status = rocrand_reserve_sequence(m_generator, size, &seed_value, &position);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(size == 0)
+        {
+            return;
+        }
+
+        const unsigned int threads = 256;
+        const size_t groups = (size + 3) / 4;
+        const unsigned int blocks = static_cast<unsigned int>(
+            std::min<size_t>((groups + threads - 1) / threads, 4096)
+        );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(detail::philox4x32_10_generate_kernel<T, Functor>),
+            dim3(blocks), dim3(threads), 0, m_stream,
+            seed_value, position, output, size, f
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_LAUNCH_FAILURE);
+        }
+    }
+
     /// Returns the smallest possible value that can be generated by the engine.
     result_type min() const
     {
@@ -1001,6 +1302,8 @@ public:
 
 private:
     rocrand_generator m_generator;
+    // Stream of kernels launched by generate() with a function object
+    hipStream_t m_stream;
 
     /// \cond
     template<class T>
@@ -1017,6 +1320,15 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class E>
+    friend class ::rocrand_cpp::buffered_engine;
+
+    template<class E, class D>
+    friend class ::rocrand_cpp::counting_random_iterator;
+
+    template<class E, class D, class F, class R, class T>
+    friend T rocrand_cpp::monte_carlo_reduce(E&, D, size_t, F, R, T);
     /// \endcond
 };
 
@@ -1025,6 +1337,415 @@ template<unsigned long long DefaultSeed>
 constexpr typename philox4x32_10_engine<DefaultSeed>::seed_type philox4x32_10_engine<DefaultSeed>::default_seed;
 /// \endcond
 
+/// \brief Random-access iterator over random numbers computed on the fly.
+///
+/// counting_random_iterator represents a range of numbers of a counter-based
+/// engine without storing it: dereferencing the iterator at index \p i computes
+/// the Philox block of the <tt>i</tt>-th number of the range from its counter
+/// and applies \p Distribution to it. It can be passed to rocPRIM or Thrust
+/// algorithms (e.g. <tt>rocprim::transform_reduce</tt>, <tt>thrust::transform</tt>)
+/// as an input range which needs no memory.
+///
+/// The values are the same as values of Engine::generate() with the same
+/// function object, the engine is advanced by the size of the range when the
+/// iterator is constructed from it.
+///
+/// \tparam Engine - counter-based engine type, only philox4x32_10_engine with
+/// a counter-based ordering (see philox4x32_10_engine::order()) is supported
+/// \tparam Distribution - function object type, <tt>T operator()(unsigned int) const</tt>
+/// must be a \p __device__ function
+///
+/// Example:
+/// \code
+/// struct to_uniform
+/// {
+///     __device__ float operator()(unsigned int v) const
+///     {
+///         return rocrand_device::detail::uniform_distribution(v);
+///     }
+/// };
+///
+/// rocrand_cpp::philox4x32_10 engine;
+/// engine.order(ROCRAND_ORDERING_PSEUDO_BEST);
+/// rocrand_cpp::counting_random_iterator<rocrand_cpp::philox4x32_10, to_uniform> first(engine, size);
+/// float sum = thrust::reduce(thrust::device, first, first + size);
+/// \endcode
+template<class Engine, class Distribution>
+class counting_random_iterator
+{
+    static_assert(Engine::type() == ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                  "counting_random_iterator supports only counter-based Philox engines");
+
+public:
+    /// \typedef value_type
+    /// Type of values of the range (result of \p Distribution).
+    typedef typename std::decay<
+        decltype(std::declval<const Distribution&>()(0U))
+    >::type value_type;
+    /// \typedef difference_type
+    typedef std::ptrdiff_t difference_type;
+    /// \typedef reference
+    /// Values are computed on dereference and returned by value.
+    typedef value_type reference;
+    /// \typedef pointer
+    typedef const value_type * pointer;
+    /// \typedef iterator_category
+    typedef std::random_access_iterator_tag iterator_category;
+
+    /// \brief Constructs an iterator to the first of \p size numbers of \p engine.
+    ///
+    /// Reserves \p size numbers of the sequence of \p engine (as Engine::generate()),
+    /// no kernels are launched. The engine must use a counter-based ordering.
+    ///
+    /// \param engine - engine which is advanced by \p size numbers
+    /// \param size - size of the range
+    /// \param distribution - function object applied to random integers
+    ///
+    /// See also: rocrand_reserve_sequence()
+    counting_random_iterator(Engine& engine, size_t size,
+                             Distribution distribution = Distribution())
+        : m_distribution(distribution)
+    {
+        rocrand_status status = rocrand_reserve_sequence(
+            engine.m_generator, size, &m_seed, &m_position
+        );
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \brief Constructs an iterator to the number at \p position of the
+    /// Philox stream of \p seed (subsequence 0).
+    __host__ __device__
+    counting_random_iterator(unsigned long long seed, unsigned long long position,
+                             Distribution distribution = Distribution())
+        : m_seed(seed), m_position(position), m_distribution(distribution)
+    {
+    }
+
+    /// Seed of the stream.
+    __host__ __device__
+    unsigned long long seed() const
+    {
+        return m_seed;
+    }
+
+    /// Position of the current number in the stream.
+    __host__ __device__
+    unsigned long long position() const
+    {
+        return m_position;
+    }
+
+    __device__
+    reference operator*() const
+    {
+        return (*this)[0];
+    }
+
+    __device__
+    reference operator[](difference_type n) const
+    {
+        const unsigned long long p = m_position + n;
+        const unsigned long long c = p / 4;
+        const uint4 v = ::rocrand_device::detail::philox4x32_10_ten_rounds(
+            uint4 { static_cast<unsigned int>(c), static_cast<unsigned int>(c >> 32), 0, 0 },
+            uint2 { static_cast<unsigned int>(m_seed), static_cast<unsigned int>(m_seed >> 32) }
+        );
+        return m_distribution((&v.x)[p % 4]);
+    }
+
+    __host__ __device__
+    counting_random_iterator& operator++()
+    {
+        m_position++;
+        return *this;
+    }
+
+    __host__ __device__
+    counting_random_iterator operator++(int)
+    {
+        counting_random_iterator old = *this;
+        m_position++;
+        return old;
+    }
+
+    __host__ __device__
+    counting_random_iterator& operator--()
+    {
+        m_position--;
+        return *this;
+    }
+
+    __host__ __device__
+    counting_random_iterator operator--(int)
+    {
+        counting_random_iterator old = *this;
+        m_position--;
+        return old;
+    }
+
+    __host__ __device__
+    counting_random_iterator& operator+=(difference_type n)
+    {
+        m_position += n;
+        return *this;
+    }
+
+    __host__ __device__
+    counting_random_iterator& operator-=(difference_type n)
+    {
+        m_position -= n;
+        return *this;
+    }
+
+    __host__ __device__
+    counting_random_iterator operator+(difference_type n) const
+    {
+        return counting_random_iterator(m_seed, m_position + n, m_distribution);
+    }
+
+    __host__ __device__
+    friend counting_random_iterator operator+(difference_type n,
+                                              const counting_random_iterator& it)
+    {
+        return it + n;
+    }
+
+    __host__ __device__
+    counting_random_iterator operator-(difference_type n) const
+    {
+        return counting_random_iterator(m_seed, m_position - n, m_distribution);
+    }
+
+    __host__ __device__
+    difference_type operator-(const counting_random_iterator& other) const
+    {
+        return static_cast<difference_type>(m_position - other.m_position);
+    }
+
+    // Iterators are compared by position, they must belong to the same range
+    __host__ __device__
+    bool operator==(const counting_random_iterator& other) const
+    {
+        return m_position == other.m_position;
+    }
+
+    __host__ __device__
+    bool operator!=(const counting_random_iterator& other) const
+    {
+        return m_position != other.m_position;
+    }
+
+    __host__ __device__
+    bool operator<(const counting_random_iterator& other) const
+    {
+        return (*this - other) < 0;
+    }
+
+    __host__ __device__
+    bool operator>(const counting_random_iterator& other) const
+    {
+        return (*this - other) > 0;
+    }
+
+    __host__ __device__
+    bool operator<=(const counting_random_iterator& other) const
+    {
+        return (*this - other) <= 0;
+    }
+
+    __host__ __device__
+    bool operator>=(const counting_random_iterator& other) const
+    {
+        return (*this - other) >= 0;
+    }
+
+private:
+    unsigned long long m_seed;
+    unsigned long long m_position;
+    Distribution m_distribution;
+};
+
+/// \brief Reduces a function of \p size random numbers without storing them.
+///
+/// Computes <tt>reduce_op</tt> of <tt>f(distribution(x))</tt> for the next \p size
+/// random integers \p x of \p engine, e.g. the sum of payoffs of Monte Carlo
+/// paths or of values of an integrand. Numbers are generated, transformed and
+/// reduced in one kernel (a block-level reduction followed by a reduction of
+/// block results), samples are never written to memory.
+///
+/// Samples are the same as values of Engine::generate() with function object
+/// <tt>f(distribution(x))</tt> and the engine is advanced by \p size numbers.
+/// Kernels are launched on the stream set by Engine::stream(), the function
+/// waits for the result. The order of reduction is unspecified, so \p reduce_op
+/// must be associative and commutative.
+///
+/// \tparam Engine - counter-based engine type, only philox4x32_10_engine with
+/// a counter-based ordering (see philox4x32_10_engine::order()) is supported
+/// \tparam Distribution - function object type, <tt>U operator()(unsigned int) const</tt>
+/// must be a \p __device__ function (e.g. <tt>rocrand_device::detail::uniform_distribution</tt>
+/// or <tt>rocrand_device::detail::normal_distribution</tt> in a function object)
+/// \tparam Function - function object type, <tt>T operator()(U) const</tt>
+/// must be a \p __device__ function
+/// \tparam ReduceOp - function object type, <tt>T operator()(T, T) const</tt>
+/// must be a \p __device__ function
+///
+/// \param engine - engine which is advanced by \p size numbers
+/// \param distribution - function object which maps random integers to samples
+/// \param size - number of samples
+/// \param f - function object applied to samples
+/// \param reduce_op - binary reduction operation
+/// \param identity - identity element of \p reduce_op (e.g. 0 for addition),
+/// returned if \p size is 0
+///
+/// \return Reduced value
+///
+/// \throws rocrand_cpp::error if the sequence cannot be reserved, memory cannot be
+/// allocated (\p ROCRAND_STATUS_ALLOCATION_FAILED) or kernels fail
+/// (\p ROCRAND_STATUS_LAUNCH_FAILURE)
+///
+/// Example:
+/// \code
+/// struct to_normal
+/// {
+///     __device__ float operator()(unsigned int v) const
+///     {
+///         return rocrand_device::detail::normal_distribution(v);
+///     }
+/// };
+///
+/// struct call_payoff
+/// {
+///     float s0, strike, drift, vol;
+///     __device__ float operator()(float z) const
+///     {
+///         return fmaxf(s0 * expf(drift + vol * z) - strike, 0.0f);
+///     }
+/// };
+///
+/// rocrand_cpp::philox4x32_10 engine;
+/// engine.order(ROCRAND_ORDERING_PSEUDO_BEST);
+/// float sum = rocrand_cpp::monte_carlo_reduce(
+///     engine, to_normal(), n, call_payoff { 100.0f, 110.0f, 0.01f, 0.2f },
+///     rocprim::plus<float>(), 0.0f
+/// );
+/// \endcode
+///
+/// See also: monte_carlo_mean_variance(), counting_random_iterator
+template<class Engine, class Distribution, class Function, class ReduceOp, class T>
+T monte_carlo_reduce(Engine& engine, Distribution distribution, size_t size,
+                     Function f, ReduceOp reduce_op, T identity)
+{
+    static_assert(Engine::type() == ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                  "monte_carlo_reduce supports only counter-based Philox engines");
+
+    unsigned long long seed_value;
+    unsigned long long position;
+    rocrand_status status = rocrand_reserve_sequence(
+        engine.m_generator, size, &seed_value, &position
+    );
+    if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    if(size == 0)
+    {
+        return identity;
+    }
+
+    constexpr unsigned int threads = 256;
+    const size_t groups = (size + 3) / 4;
+    const unsigned int blocks = static_cast<unsigned int>(
+        std::min<size_t>((groups + threads - 1) / threads, 1024)
+    );
+
+    // Partial results of blocks followed by the result
+    T * partials;
+    if(hipMalloc(reinterpret_cast<void **>(&partials), sizeof(T) * (blocks + 1)) != hipSuccess)
+    {
+        throw rocrand_cpp::error(ROCRAND_STATUS_ALLOCATION_FAILED);
+    }
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(detail::philox4x32_10_reduce_kernel<threads, T, Distribution, Function, ReduceOp>),
+        dim3(blocks), dim3(threads), 0, engine.m_stream,
+        seed_value, position, size, distribution, f, reduce_op, identity, partials
+    );
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(detail::reduce_partials_kernel<threads, T, ReduceOp>),
+        dim3(1), dim3(threads), 0, engine.m_stream,
+        partials, blocks, reduce_op, identity, partials + blocks
+    );
+
+    T result = identity;
+    const bool failed =
+        hipPeekAtLastError() != hipSuccess
+        || hipMemcpyAsync(&result, partials + blocks, sizeof(T),
+                          hipMemcpyDeviceToHost, engine.m_stream) != hipSuccess
+        || hipStreamSynchronize(engine.m_stream) != hipSuccess;
+    hipFree(partials);
+    if(failed)
+    {
+        throw rocrand_cpp::error(ROCRAND_STATUS_LAUNCH_FAILURE);
+    }
+    return result;
+}
+
+/// \brief Sums a function of \p size random numbers without storing them.
+///
+/// Same as monte_carlo_reduce() with addition and the identity <tt>T()</tt>,
+/// where \p T is the result type of \p f.
+template<class Engine, class Distribution, class Function>
+auto monte_carlo_reduce(Engine& engine, Distribution distribution, size_t size, Function f)
+    -> typename std::decay<decltype(
+        std::declval<const Function&>()(std::declval<const Distribution&>()(0U))
+    )>::type
+{
+    typedef typename std::decay<decltype(
+        std::declval<const Function&>()(std::declval<const Distribution&>()(0U))
+    )>::type value_type;
+    return monte_carlo_reduce(engine, distribution, size, f, detail::sum_op(), value_type());
+}
+
+/// \brief Mean and variance of samples, see monte_carlo_mean_variance().
+struct monte_carlo_estimate
+{
+    /// Number of samples
+    unsigned long long count;
+    /// Mean of samples
+    double mean;
+    /// Unbiased sample variance (0 if there are less than 2 samples)
+    double variance;
+};
+
+/// \brief Estimates the mean and variance of a function of \p size random
+/// numbers without storing them.
+///
+/// Samples <tt>f(distribution(x))</tt> are reduced as in monte_carlo_reduce(),
+/// every block merges counts, means and sums of squared differences from the
+/// mean (Chan et al.) in double precision, so the variance does not suffer
+/// from cancellation as with sums of squares. The standard error of the mean
+/// is <tt>sqrt(variance / count)</tt>.
+///
+/// \param engine - engine which is advanced by \p size numbers
+/// \param distribution - function object which maps random integers to samples
+/// \param size - number of samples
+/// \param f - function object applied to samples, the result must be
+/// convertible to \p double
+///
+/// \return Count, mean and variance of samples
+template<class Engine, class Distribution, class Function>
+monte_carlo_estimate monte_carlo_mean_variance(Engine& engine, Distribution distribution,
+                                               size_t size, Function f)
+{
+    const detail::moments m = monte_carlo_reduce(
+        engine, distribution, size,
+        detail::to_moments<Function> { f }, detail::merge_moments(),
+        detail::moments { 0.0, 0.0, 0.0 }
+    );
+    monte_carlo_estimate result;
+    result.count = static_cast<unsigned long long>(m.count);
+    result.mean = m.mean;
+    result.variance = m.count > 1.0 ? m.m2 / (m.count - 1.0) : 0.0;
+    return result;
+}
+
 /// \brief Pseudorandom number engine based XORWOW algorithm.
 ///
 /// xorwow_engine is a <a href="https://en.wikipedia.org/wiki/Xorshift">xorshift</a> pseudorandom
@@ -1142,6 +1863,9 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class E>
+    friend class ::rocrand_cpp::buffered_engine;
     /// \endcond
 };
 
@@ -1266,6 +1990,9 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class E>
+    friend class ::rocrand_cpp::buffered_engine;
     /// \endcond
 };
 
@@ -1389,6 +2116,9 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class E>
+    friend class ::rocrand_cpp::buffered_engine;
     /// \endcond
 };
 
@@ -1487,6 +2217,24 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \brief Set the first dimension of a quasi-random number generator.
+    ///
+    /// Dimensions [\p value, \p value + dimensions) of the sequence are generated,
+    /// supported values of \p value are 0 to 19999.
+    ///
+    /// - This operation resets the generator's internal state.
+    /// - This operation does not change the generator's offset.
+    ///
+    /// \param value - Index of the first dimension
+    ///
+    /// See also: rocrand_set_quasi_random_generator_first_dimension()
+    void first_dimension(dimensions_num_type value)
+    {
+        rocrand_status status =
+            rocrand_set_quasi_random_generator_first_dimension(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
     /// \brief Fills \p output with uniformly distributed random integer values.
     ///
     /// Generates \p size random integer values uniformly distributed
@@ -1546,6 +2294,9 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class E>
+    friend class ::rocrand_cpp::buffered_engine;
     /// \endcond
 };
 
@@ -1555,6 +2306,294 @@ constexpr typename sobol32_engine<DefaultNumDimensions>::dimensions_num_type
 sobol32_engine<DefaultNumDimensions>::default_num_dimensions;
 /// \endcond
 
+/// \brief Adapter of a random number engine which serves requests from a pool
+/// of pre-generated numbers.
+///
+/// buffered_engine keeps two device buffers (a double-buffered pool) of
+/// \p pool_size random integers generated by \p Engine. Requests smaller than
+/// the pool are served by device-to-device copies from the pool (or by
+/// a pointer into it, see acquire()), and when a buffer is used up it is
+/// refilled on a separate stream while the other one is being used. Many small
+/// requests then cost one bulk generation per \p pool_size values instead of
+/// a kernel launch per request.
+///
+/// The pool is filled by consecutive calls of the engine with \p pool_size values,
+/// requests of at least \p pool_size values are generated directly by the engine
+/// (into the next values of its sequence). Therefore the numbers are the same
+/// numbers as of the engine, but they are not handed out in the order of the engine.
+///
+/// All copies and direct generation are enqueued to the stream set by stream()
+/// (the default stream by default), which waits for refills of the pool.
+///
+/// \tparam Engine - rocRAND pseudo-random number engine, for example
+/// rocrand_cpp::philox4x32_10 or rocrand_cpp::xorwow
+///
+/// Example:
+/// \code
+/// rocrand_cpp::buffered_engine<rocrand_cpp::philox4x32_10> engine(1 << 20);
+/// for(size_t i = 0; i < 1000; i++)
+/// {
+///     engine(output + i * 16, 16); // copies from the pool, no kernel launches
+/// }
+/// \endcode
+template<class Engine>
+class buffered_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef typename Engine::result_type result_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef typename Engine::seed_type seed_type;
+    /// Type of the underlying engine
+    typedef Engine engine_type;
+
+    /// \brief Constructs the engine and fills the pool.
+    ///
+    /// \param pool_size - number of values in each of two buffers of the pool
+    /// \param seed_value - seed value of the underlying engine
+    ///
+    /// Throws rocrand_cpp::error with ROCRAND_STATUS_OUT_OF_RANGE if \p pool_size is 0,
+    /// ROCRAND_STATUS_ALLOCATION_FAILED if the pool can not be allocated.
+    buffered_engine(size_t pool_size = 1 << 20,
+                    seed_type seed_value = Engine::default_seed)
+        : m_engine(seed_value), m_pool_size(pool_size),
+          m_current(0), m_used(0), m_stream(0), m_refill_stream(0)
+    {
+        m_buffers[0] = m_buffers[1] = NULL;
+        m_ready[0] = m_ready[1] = NULL;
+        m_consumed[0] = m_consumed[1] = NULL;
+        if(pool_size == 0)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_OUT_OF_RANGE);
+        }
+        if(hipStreamCreateWithFlags(&m_refill_stream, hipStreamNonBlocking) != hipSuccess)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_INTERNAL_ERROR);
+        }
+        for(int i = 0; i < 2; i++)
+        {
+            if(hipMalloc(&m_buffers[i], pool_size * sizeof(result_type)) != hipSuccess
+                || hipEventCreateWithFlags(&m_ready[i], hipEventDisableTiming) != hipSuccess
+                || hipEventCreateWithFlags(&m_consumed[i], hipEventDisableTiming) != hipSuccess)
+            {
+                release();
+                throw rocrand_cpp::error(ROCRAND_STATUS_ALLOCATION_FAILED);
+            }
+        }
+        rocrand_status status = rocrand_set_stream(m_engine.m_generator, m_refill_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            release();
+            throw rocrand_cpp::error(status);
+        }
+        for(int i = 0; i < 2; i++)
+        {
+            status = refill(i);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                release();
+                throw rocrand_cpp::error(status);
+            }
+        }
+        wait(0);
+    }
+
+    buffered_engine(const buffered_engine&) = delete;
+    buffered_engine& operator=(const buffered_engine&) = delete;
+
+    /// Destructs the engine, waits for refills of the pool.
+    ~buffered_engine() noexcept(false)
+    {
+        release();
+    }
+
+    /// \brief Sets the \p hipStream of copies and direct generation.
+    /// \param value - new \p hipStream to use
+    void stream(hipStream_t value)
+    {
+        // Work enqueued to the new stream must see the current buffer
+        m_stream = value;
+        wait(m_current);
+    }
+
+    /// \brief Fills \p output with uniformly distributed random integer values.
+    ///
+    /// Requests of less than \p pool_size values are copied from the pool,
+    /// larger ones are generated by the underlying engine.
+    ///
+    /// \param output - Pointer to device memory to store results
+    /// \param size - Number of values to generate
+    void operator()(result_type * output, size_t size)
+    {
+        if(size >= m_pool_size)
+        {
+            generate_direct(output, size);
+            return;
+        }
+        while(size > 0)
+        {
+            if(m_used == m_pool_size)
+            {
+                next_buffer();
+            }
+            const size_t count = std::min(size, m_pool_size - m_used);
+            if(hipMemcpyAsync(output, m_buffers[m_current] + m_used,
+                              count * sizeof(result_type),
+                              hipMemcpyDeviceToDevice, m_stream) != hipSuccess)
+            {
+                throw rocrand_cpp::error(ROCRAND_STATUS_LAUNCH_FAILURE);
+            }
+            m_used += count;
+            output += count;
+            size -= count;
+        }
+    }
+
+    /// \brief Returns a pointer to \p size random integer values in the pool.
+    ///
+    /// No copy is made: the values stay valid for work enqueued to stream()
+    /// before the next call of operator() or acquire(). If the current buffer
+    /// does not have \p size values left, the rest of it is skipped.
+    ///
+    /// \param size - Number of values, at most \p pool_size
+    ///
+    /// Throws rocrand_cpp::error with ROCRAND_STATUS_OUT_OF_RANGE if \p size
+    /// is greater than \p pool_size.
+    const result_type * acquire(size_t size)
+    {
+        if(size > m_pool_size)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_OUT_OF_RANGE);
+        }
+        if(m_pool_size - m_used < size)
+        {
+            next_buffer();
+        }
+        const result_type * values = m_buffers[m_current] + m_used;
+        m_used += size;
+        return values;
+    }
+
+    /// Returns the number of values in each of two buffers of the pool.
+    size_t pool_size() const
+    {
+        return m_pool_size;
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return m_engine.min();
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return m_engine.max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return Engine::type();
+    }
+
+private:
+    // Enqueues generation of buffer i after all copies from it
+    rocrand_status refill(int i)
+    {
+        if(hipStreamWaitEvent(m_refill_stream, m_consumed[i], 0) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        rocrand_status status = rocrand_generate(m_engine.m_generator, m_buffers[i], m_pool_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(hipEventRecord(m_ready[i], m_refill_stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Makes m_stream wait until buffer i is generated
+    void wait(int i)
+    {
+        if(hipStreamWaitEvent(m_stream, m_ready[i], 0) != hipSuccess)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_INTERNAL_ERROR);
+        }
+    }
+
+    // Starts refilling of the current buffer and switches to the other one
+    void next_buffer()
+    {
+        if(hipEventRecord(m_consumed[m_current], m_stream) != hipSuccess)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_INTERNAL_ERROR);
+        }
+        rocrand_status status = refill(m_current);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        m_current = 1 - m_current;
+        m_used = 0;
+        wait(m_current);
+    }
+
+    void generate_direct(result_type * output, size_t size)
+    {
+        // The last refill (of the other buffer) must finish before
+        // the engine is used on m_stream
+        wait(1 - m_current);
+        rocrand_status status = rocrand_set_stream(m_engine.m_generator, m_stream);
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = rocrand_generate(m_engine.m_generator, output, size);
+        }
+        // Refills must be ordered after generation which changes the state
+        // of the engine
+        if(hipEventRecord(m_consumed[m_current], m_stream) != hipSuccess
+            || hipStreamWaitEvent(m_refill_stream, m_consumed[m_current], 0) != hipSuccess)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        rocrand_status stream_status = rocrand_set_stream(m_engine.m_generator, m_refill_stream);
+        if(status == ROCRAND_STATUS_SUCCESS) status = stream_status;
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    void release()
+    {
+        if(m_refill_stream != 0)
+        {
+            hipStreamSynchronize(m_refill_stream);
+        }
+        for(int i = 0; i < 2; i++)
+        {
+            if(m_buffers[i] != NULL) hipFree(m_buffers[i]);
+            if(m_ready[i] != NULL) hipEventDestroy(m_ready[i]);
+            if(m_consumed[i] != NULL) hipEventDestroy(m_consumed[i]);
+            m_buffers[i] = NULL;
+            m_ready[i] = m_consumed[i] = NULL;
+        }
+        if(m_refill_stream != 0)
+        {
+            // The engine must not refer to the destroyed stream
+            rocrand_set_stream(m_engine.m_generator, 0);
+            hipStreamDestroy(m_refill_stream);
+            m_refill_stream = 0;
+        }
+    }
+
+    Engine m_engine;
+    const size_t m_pool_size;
+    result_type * m_buffers[2];
+    // Recorded on the refill stream when a buffer is generated
+    hipEvent_t m_ready[2];
+    // Recorded on m_stream when all copies from a buffer are enqueued
+    hipEvent_t m_consumed[2];
+    // Buffer which is being used and the number of its used values
+    int m_current;
+    size_t m_used;
+    hipStream_t m_stream;
+    hipStream_t m_refill_stream;
+};
+
 /// \typedef philox4x32_10;
 /// \brief Typedef of rocrand_cpp::philox4x32_10_engine PRNG engine with default seed (#ROCRAND_PHILOX4x32_DEFAULT_SEED).
 typedef philox4x32_10_engine<> philox4x32_10;
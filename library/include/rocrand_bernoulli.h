@@ -0,0 +1,149 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_BERNOULLI_H_
+#define ROCRAND_BERNOULLI_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#include <math.h>
+
+#include "rocrand_philox4x32_10.h"
+#include "rocrand_mrg32k3a.h"
+#include "rocrand_xorwow.h"
+#include "rocrand_mtgp32.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// Probability p rounded to k / 2^digits with the least digits (at most 32),
+// k = 2^digits (digits = 0) for p = 1
+struct bernoulli_bits_params
+{
+    unsigned long long int k;
+    unsigned int digits;
+};
+
+FQUALIFIERS
+bernoulli_bits_params make_bernoulli_bits_params(double p)
+{
+    bernoulli_bits_params params;
+    params.k = static_cast<unsigned long long int>(ldexp(p, 32) + 0.5);
+    params.digits = 32;
+    if(params.k == 0)
+    {
+        params.digits = 0;
+        return params;
+    }
+    while((params.k & 1) == 0)
+    {
+        params.k >>= 1;
+        params.digits--;
+    }
+    return params;
+}
+
+// 32 trials, bit i is set if the i-th number U of 'digits' bits is less
+// than k (probability k / 2^digits). Numbers with fewer than 32 digits are
+// compared bit-sliced: every draw gives one digit (the least significant
+// first) of all 32 numbers. Numbers with 32 digits are compared with
+// a threshold, the same amount of draws with fewer operations.
+template<class Source>
+FQUALIFIERS
+unsigned int bernoulli_bits(Source& source, const bernoulli_bits_params params)
+{
+    if(params.digits == 0)
+    {
+        return params.k == 0 ? 0U : 0xFFFFFFFFU;
+    }
+    if(params.digits == 32)
+    {
+        const unsigned int threshold = static_cast<unsigned int>(params.k);
+        unsigned int bits = 0;
+        for(unsigned int i = 0; i < 32; i++)
+        {
+            bits |= (source() < threshold ? 1U : 0U) << i;
+        }
+        return bits;
+    }
+    // less: U < k for digits below j, decided by digit j unless digits are equal
+    unsigned int less = 0;
+    for(unsigned int j = 0; j < params.digits; j++)
+    {
+        const unsigned int r = source();
+        const unsigned int kj = ((params.k >> j) & 1) ? 0xFFFFFFFFU : 0U;
+        less = (kj & ~r) | (~(kj ^ r) & less);
+    }
+    return less;
+}
+
+// Random numbers of the algorithm above, the same algorithm is used by
+// the host API with numbers of its engines
+template<class State>
+struct bernoulli_bits_source
+{
+    State state;
+
+    FQUALIFIERS
+    unsigned int operator()()
+    {
+        return rocrand(state);
+    }
+};
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Returns 32 Bernoulli trials packed in an <tt>unsigned int</tt>.
+ *
+ * Generates and returns an <tt>unsigned int</tt> of 32 independent trials,
+ * every bit is 1 with probability \p p, using the generator in \p state,
+ * which can be the state of any generator with rocrand() (pseudo-random
+ * generators). \p p is rounded to a multiple of 2^-32. Probabilities
+ * k / 2^m use m random numbers (one for \p p = 0.5), other probabilities
+ * use 32 random numbers, \p p = 0 and \p p = 1 do not use random numbers.
+ * rocrand_generate_bernoulli_bits() of the host API uses the same method.
+ *
+ * \param state - Pointer to a state to use
+ * \param p - Probability of 1 bits, from [0, 1]
+ *
+ * \return 32 Bernoulli trials with probability \p p
+ */
+template<class State>
+FQUALIFIERS
+unsigned int rocrand_bernoulli_bits(State * state, double p)
+{
+    rocrand_device::detail::bernoulli_bits_source<State *> source { state };
+    return rocrand_device::detail::bernoulli_bits(
+        source, rocrand_device::detail::make_bernoulli_bits_params(p)
+    );
+}
+
+#endif // ROCRAND_BERNOULLI_H_
+
+/** @} */ // end of group rocranddevice
@@ -0,0 +1,437 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_BINOMIAL_H_
+#define ROCRAND_BINOMIAL_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#include <math.h>
+
+#include "rocrand_philox4x32_10.h"
+#include "rocrand_mrg32k3a.h"
+#include "rocrand_xorwow.h"
+#include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
+#include "rocrand_mtgp32.h"
+
+#include "rocrand_uniform.h"
+#include "rocrand_normal.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// n * min(p, 1 - p) below which values are computed by inversion
+constexpr double binomial_threshold_small = 10.0;
+// n * min(p, 1 - p) above which the inversion of generators which use one
+// number per value (quasi-random, MTGP32) is replaced with the normal approximation
+constexpr double binomial_threshold_huge  = 1000.0;
+
+// Uniform values of the algorithms below, the same algorithms are used by
+// the host API with numbers of its engines
+template<class State>
+struct binomial_uniform_source
+{
+    State state;
+
+    FQUALIFIERS
+    double operator()()
+    {
+        return rocrand_uniform_double(state);
+    }
+};
+
+// log(k!) - log of its Stirling approximation
+FQUALIFIERS
+double binomial_stirling_correction(const double k)
+{
+    const double table[10] = {
+        0.08106146679532733,
+        0.041340695955409457,
+        0.027677925684997717,
+        0.020790672103765839,
+        0.016644691189821259,
+        0.013876128823072875,
+        0.011896709945893313,
+        0.010411265261973668,
+        0.0092554621827094508,
+        0.0083305634333594725
+    };
+    if(k < 10.0)
+    {
+        return table[static_cast<int>(k)];
+    }
+    const double r = 1.0 / (k + 1.0);
+    const double r2 = r * r;
+    return (1.0 / 12.0 - (1.0 / 360.0 - (1.0 / 1260.0) * r2) * r2) * r;
+}
+
+// Inversion by sequential search from 0, p <= 0.5, about n * p + 1
+// iterations and one uniform value per value
+template<class Uniform>
+FQUALIFIERS
+unsigned int binomial_distribution_inversion(Uniform& uniform, unsigned int n, double p)
+{
+    const double q = 1.0 - p;
+    const double s = p / q;
+    const double a = (n + 1.0) * s;
+    double r = pow(q, static_cast<double>(n));
+    double u = uniform();
+    unsigned int k = 0;
+    // Rounding errors can leave u > r after all n terms
+    while(u > r && k < n)
+    {
+        u -= r;
+        k++;
+        r *= a / k - s;
+    }
+    return k;
+}
+
+// Transformed rejection with decomposition (BTRD), W. Hormann,
+// The generation of binomial random variates, p <= 0.5 and n * p >= 10,
+// about 1.2 attempts of 1-2 uniform values per value
+template<class Uniform>
+FQUALIFIERS
+unsigned int binomial_distribution_btrd(Uniform& uniform, unsigned int n, double p)
+{
+    const double q = 1.0 - p;
+    const double npq = n * p * q;
+    const double spq = sqrt(npq);
+    const double m = floor((n + 1.0) * p);
+    const double r = p / q;
+    const double nr = (n + 1.0) * r;
+    const double b = 1.15 + 2.53 * spq;
+    const double a = -0.0873 + 0.0248 * b + 0.01 * p;
+    const double c = n * p + 0.5;
+    const double alpha = (2.83 + 5.1 / b) * spq;
+    const double v_r = 0.92 - 4.2 / b;
+    const double u_rv_r = 0.86 * v_r;
+
+    while(true)
+    {
+        double v = uniform();
+        double u;
+        if(v <= u_rv_r)
+        {
+            // Most values are accepted without the density
+            u = v / v_r - 0.43;
+            return static_cast<unsigned int>(floor((2.0 * a / (0.5 - fabs(u)) + b) * u + c));
+        }
+        if(v >= v_r)
+        {
+            u = uniform() - 0.5;
+        }
+        else
+        {
+            u = v / v_r - 0.93;
+            u = copysign(0.5, u) - u;
+            v = uniform() * v_r;
+        }
+
+        const double us = 0.5 - fabs(u);
+        const double k = floor((2.0 * a / us + b) * u + c);
+        if(k < 0.0 || k > n)
+        {
+            continue;
+        }
+        v = v * alpha / (a / (us * us) + b);
+        const double km = fabs(k - m);
+        if(km <= 15.0)
+        {
+            // Ratio f(k) / f(m) by recursion
+            double f = 1.0;
+            if(m < k)
+            {
+                for(double i = m + 1.0; i <= k; i++)
+                {
+                    f *= nr / i - r;
+                }
+            }
+            else
+            {
+                for(double i = k + 1.0; i <= m; i++)
+                {
+                    v *= nr / i - r;
+                }
+            }
+            if(v <= f)
+            {
+                return static_cast<unsigned int>(k);
+            }
+            continue;
+        }
+
+        // Squeeze of the logarithm of the ratio
+        v = log(v);
+        const double rho = (km / npq) * (((km / 3.0 + 0.625) * km + 1.0 / 6.0) / npq + 0.5);
+        const double t = -km * km / (2.0 * npq);
+        if(v < t - rho)
+        {
+            return static_cast<unsigned int>(k);
+        }
+        if(v > t + rho)
+        {
+            continue;
+        }
+
+        const double nm = n - m + 1.0;
+        const double h = (m + 0.5) * log((m + 1.0) / (r * nm))
+            + binomial_stirling_correction(m) + binomial_stirling_correction(n - m);
+        const double nk = n - k + 1.0;
+        if(v <= h + (n + 1.0) * log(nm / nk) + (k + 0.5) * log(nk * r / (k + 1.0))
+            - binomial_stirling_correction(k) - binomial_stirling_correction(n - k))
+        {
+            return static_cast<unsigned int>(k);
+        }
+    }
+}
+
+// Values of p > 0.5 are n minus values of 1 - p, values of p outside (0, 1)
+// are 0 or n
+template<class Uniform>
+FQUALIFIERS
+unsigned int binomial_distribution(Uniform& uniform, unsigned int n, double p)
+{
+    if(n == 0 || p <= 0.0)
+    {
+        return 0;
+    }
+    if(p >= 1.0)
+    {
+        return n;
+    }
+    const bool flip = p > 0.5;
+    const double pp = flip ? 1.0 - p : p;
+    const unsigned int k = n * pp < binomial_threshold_small
+        ? binomial_distribution_inversion(uniform, n, pp)
+        : binomial_distribution_btrd(uniform, n, pp);
+    return flip ? n - k : k;
+}
+
+// One number per value: inversion up to binomial_threshold_huge,
+// the normal approximation above it
+template<class State>
+FQUALIFIERS
+unsigned int binomial_distribution_inv(State state, unsigned int n, double p)
+{
+    if(n == 0 || p <= 0.0)
+    {
+        return 0;
+    }
+    if(p >= 1.0)
+    {
+        return n;
+    }
+    const bool flip = p > 0.5;
+    const double pp = flip ? 1.0 - p : p;
+    unsigned int k;
+    if(n * pp < binomial_threshold_huge)
+    {
+        binomial_uniform_source<State> uniform { state };
+        k = binomial_distribution_inversion(uniform, n, pp);
+    }
+    else
+    {
+        const double x = round(n * pp + sqrt(n * pp * (1.0 - pp)) * rocrand_normal_double(state));
+        k = static_cast<unsigned int>(fmin(fmax(x, 0.0), static_cast<double>(n)));
+    }
+    return flip ? n - k : k;
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt>.
+ *
+ * Generates and returns the number of successes of \p n trials with
+ * probability \p p using the generator in \p state, which can be the state
+ * of any pseudo-random generator with rocrand_uniform_double().
+ * Values are computed by inversion for n * min(p, 1 - p) < 10 and by
+ * the transformed rejection method BTRD above (the amount of work does not
+ * grow with \p n). Values of \p p not greater than 0 are 0, values of \p p
+ * not less than 1 are \p n. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Probability of success of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> from [0, n]
+ */
+template<class State>
+FQUALIFIERS
+unsigned int rocrand_binomial(State * state, unsigned int n, double p)
+{
+    rocrand_device::detail::binomial_uniform_source<State *> uniform { state };
+    return rocrand_device::detail::binomial_distribution(uniform, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using MTGP32 generator.
+ *
+ * Generates and returns the number of successes of \p n trials with
+ * probability \p p using MTGP32 generator in \p state. Values are computed
+ * by inversion for n * min(p, 1 - p) < 1000 and by the normal approximation
+ * above. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Probability of success of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> from [0, n]
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_mtgp32 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using SOBOL32 generator.
+ *
+ * Generates and returns the number of successes of \p n trials with
+ * probability \p p using SOBOL32 generator in \p state. Values are computed
+ * by inversion for n * min(p, 1 - p) < 1000 and by the normal approximation
+ * above. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Probability of success of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> from [0, n]
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_sobol32 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using SCRAMBLED_SOBOL32 generator.
+ *
+ * Generates and returns the number of successes of \p n trials with
+ * probability \p p using SCRAMBLED_SOBOL32 generator in \p state. Values are
+ * computed by inversion for n * min(p, 1 - p) < 1000 and by the normal
+ * approximation above. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Probability of success of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> from [0, n]
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_scrambled_sobol32 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using SOBOL64 generator.
+ *
+ * Generates and returns the number of successes of \p n trials with
+ * probability \p p using SOBOL64 generator in \p state. Values are computed
+ * by inversion for n * min(p, 1 - p) < 1000 and by the normal approximation
+ * above. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Probability of success of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> from [0, n]
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_sobol64 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using SCRAMBLED_SOBOL64 generator.
+ *
+ * Generates and returns the number of successes of \p n trials with
+ * probability \p p using SCRAMBLED_SOBOL64 generator in \p state. Values are
+ * computed by inversion for n * min(p, 1 - p) < 1000 and by the normal
+ * approximation above. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Probability of success of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> from [0, n]
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_scrambled_sobol64 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Generates multinomially distributed counts.
+ *
+ * Distributes \p n trials among \p categories categories with probabilities
+ * \p probabilities and stores the number of trials of each category in
+ * \p counts. Counts are computed by conditional binomial values (see
+ * rocrand_binomial()): the count of category i is a binomial value of
+ * the trials not assigned to categories before i with the probability of i
+ * relative to the probabilities of categories from i, the last category
+ * gets the remaining trials. Probabilities should sum to 1.
+ * State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param probabilities - Pointer to \p categories probabilities
+ * \param categories - Number of categories (greater than 0)
+ * \param counts - Pointer to memory to store \p categories counts
+ */
+template<class State>
+FQUALIFIERS
+void rocrand_multinomial(State * state, unsigned int n,
+                         const double * probabilities, unsigned int categories,
+                         unsigned int * counts)
+{
+    unsigned int remaining = n;
+    double mass = 1.0;
+    for(unsigned int i = 0; i + 1 < categories; i++)
+    {
+        const double p = probabilities[i];
+        const unsigned int k = remaining > 0 && mass > 0.0
+            ? rocrand_binomial(state, remaining, p / mass)
+            : 0;
+        counts[i] = k;
+        remaining -= k;
+        mass -= p;
+    }
+    counts[categories - 1] = remaining;
+}
+
+#endif // ROCRAND_BINOMIAL_H_
+
+/** @} */ // end of group rocranddevice
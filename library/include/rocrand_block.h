@@ -0,0 +1,197 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#ifndef ROCRAND_BLOCK_H_
+#define ROCRAND_BLOCK_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+#include "rocrand_philox4x32_10.h"
+#include "rocrand_mrg32k3a.h"
+#include "rocrand_xorwow.h"
+#include "rocrand_uniform.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// Flat index of the thread in its block
+FQUALIFIERS
+unsigned int block_thread_id()
+{
+    return hipThreadIdx_x
+        + hipBlockDim_x * (hipThreadIdx_y + hipBlockDim_y * hipThreadIdx_z);
+}
+
+struct block_rocrand
+{
+    template<class State>
+    FQUALIFIERS
+    unsigned int operator()(State * state) const
+    {
+        return ::rocrand(state);
+    }
+};
+
+struct block_rocrand_uniform
+{
+    template<class State>
+    FQUALIFIERS
+    float operator()(State * state) const
+    {
+        return ::rocrand_uniform(state);
+    }
+};
+
+// Every thread of the block generates a contiguous part of n numbers
+// from a copy of the shared state skipped ahead to the beginning of its
+// part, so output is the same as n consecutive calls of generate on one
+// state. The thread which generates the last number stores its state.
+template<unsigned int BlockSize, class State, class T, class Generate>
+FQUALIFIERS
+void block_generate(State * block_state, T * output, const unsigned int n,
+                    Generate generate)
+{
+    const unsigned int thread_id = block_thread_id();
+    const unsigned int part_size = (n + BlockSize - 1) / BlockSize;
+    const unsigned int begin = thread_id * part_size < n ? thread_id * part_size : n;
+    const unsigned int end = n - begin > part_size ? begin + part_size : n;
+
+    State state = *block_state;
+    if(begin < end)
+    {
+        ::skipahead(begin, &state);
+        for(unsigned int i = begin; i < end; i++)
+        {
+            output[i] = generate(&state);
+        }
+    }
+    // All threads have copied the state
+    __syncthreads();
+    if(begin < end && end == n)
+    {
+        *block_state = state;
+    }
+    __syncthreads();
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Initializes a state shared by all threads of a block.
+ *
+ * Initializes \p block_state (usually in shared memory) with the given
+ * \p seed, \p subsequence and \p offset, as rocrand_init() does.
+ * Must be called by all threads of the block, the state is initialized
+ * by the first thread and the function returns when the state is ready.
+ *
+ * The state can be used by rocrand_block_generate() and
+ * rocrand_block_generate_uniform(). One shared state per block replaces
+ * a state per thread, so memory of states and the cost of their
+ * initialization are reduced by a factor of the block size.
+ * Supported states: XORWOW, MRG32k3a and Philox4x32-10.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at (e.g. index of the block)
+ * \param offset - Absolute offset into subsequence
+ * \param block_state - Pointer to the state shared by the block
+ */
+template<class State>
+FQUALIFIERS
+void rocrand_block_init(const unsigned long long seed,
+                        const unsigned long long subsequence,
+                        const unsigned long long offset,
+                        State * block_state)
+{
+    if(rocrand_device::detail::block_thread_id() == 0)
+    {
+        ::rocrand_init(seed, subsequence, offset, block_state);
+    }
+    __syncthreads();
+}
+
+/**
+ * \brief Cooperatively generates uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using a state shared by a block.
+ *
+ * Generates \p n values to \p output (usually a tile in shared memory) using
+ * all \p BlockSize threads of the block and \p block_state initialized by
+ * rocrand_block_init(). Results are the same as \p n consecutive calls
+ * of rocrand() with the state, and the state is incremented by \p n positions.
+ *
+ * Every thread generates a contiguous part of <tt>ceil(n / BlockSize)</tt>
+ * values after skipping ahead a copy of the state (see skipahead()), so
+ * \p n should be a multiple of \p BlockSize large enough to amortize skipping
+ * (it is cheap for Philox4x32-10 and takes a few matrix-vector products for
+ * XORWOW and MRG32k3a).
+ *
+ * Must be called by all threads of the block with the same arguments,
+ * \p output can be read by all threads after the call.
+ *
+ * \tparam BlockSize - Number of threads of the block
+ *
+ * \param block_state - Pointer to the state shared by the block
+ * \param output - Pointer to memory to store \p n values
+ * \param n - Number of values to generate
+ */
+template<unsigned int BlockSize, class State>
+FQUALIFIERS
+void rocrand_block_generate(State * block_state, unsigned int * output,
+                            const unsigned int n)
+{
+    rocrand_device::detail::block_generate<BlockSize>(
+        block_state, output, n, rocrand_device::detail::block_rocrand()
+    );
+}
+
+/**
+ * \brief Cooperatively generates uniformly distributed random <tt>float</tt>
+ * values from (0; 1] range using a state shared by a block.
+ *
+ * Generates \p n values to \p output as rocrand_block_generate() does,
+ * results are the same as \p n consecutive calls of rocrand_uniform()
+ * with the state, and the state is incremented by \p n positions.
+ *
+ * \tparam BlockSize - Number of threads of the block
+ *
+ * \param block_state - Pointer to the state shared by the block
+ * \param output - Pointer to memory to store \p n values
+ * \param n - Number of values to generate
+ */
+template<unsigned int BlockSize, class State>
+FQUALIFIERS
+void rocrand_block_generate_uniform(State * block_state, float * output,
+                                    const unsigned int n)
+{
+    rocrand_device::detail::block_generate<BlockSize>(
+        block_state, output, n, rocrand_device::detail::block_rocrand_uniform()
+    );
+}
+
+#endif // ROCRAND_BLOCK_H_
+
+/** @} */ // end of group rocranddevice
@@ -25,11 +25,15 @@
 #define ROCRAND_2POW32_INV_DOUBLE (2.3283064365386963e-10)
 #define ROCRAND_2POW32_INV_2PI (2.3283064e-10f * 6.2831855f)
 #define ROCRAND_2POW53_INV_DOUBLE (1.1102230246251565e-16)
+#define ROCRAND_2POW16_INV (1.5258789e-05f)
+#define ROCRAND_2POW16_INV_2PI (1.5258789e-05f * 6.2831855f)
 #define ROCRAND_PI  (3.1415926f)
 #define ROCRAND_PI_DOUBLE  (3.1415926535897932)
 #define ROCRAND_2PI (6.2831855f)
 #define ROCRAND_SQRT2 (1.4142135f)
 #define ROCRAND_SQRT2_DOUBLE (1.4142135623730951)
+#define ROCRAND_SQRT1_2_DOUBLE (0.7071067811865476)
+#define ROCRAND_SQRT2PI_DOUBLE (2.5066282746310002)
 
 #include <math.h>
 
@@ -40,14 +44,27 @@
 namespace rocrand_device {
 namespace detail {
 
+// Selects constructors of engines which leave the state uninitialized,
+// used when all words of the state are written afterwards (e.g. loaded
+// from a structure of arrays)
+struct uninitialized_tag { };
+
 FQUALIFIERS
 unsigned long long mad_u64_u32(const unsigned int x, const unsigned int y, const unsigned long long z)
 {
     #if defined(__HIP_PLATFORM_HCC__) && defined(__HIP_DEVICE_COMPILE__) \
         && defined(ROCRAND_ENABLE_INLINE_ASM)
 
+    // v_mad_u64_u32 is available on all GCN/CDNA/RDNA targets since gfx7.
+    // Every AMDGPU_TARGETS entry is compiled separately, so the carry
+    // operand is selected per target: a single SGPR in wave32 mode
+    // (gfx10+), an SGPR pair in wave64 mode.
     unsigned long long r;
-    unsigned long long c; // carry bits, SGPR, unused
+    #if defined(__AMDGCN_WAVEFRONT_SIZE) && (__AMDGCN_WAVEFRONT_SIZE == 32)
+    unsigned int c; // carry bits, SGPR, unused
+    #else
+    unsigned long long c; // carry bits, SGPR pair, unused
+    #endif
     // x has "r" constraint. This allows to use both VGPR and SGPR
     // (to save VGPR) as input.
     // y and z have "v" constraints, because only one SGPR or literal
@@ -73,6 +90,40 @@ unsigned long long mad_u64_u32(const unsigned int x, const unsigned int y, const
     #endif
 }
 
+// Returns the low 32 bits of x * y and stores the high 32 bits in hi
+FQUALIFIERS
+unsigned int mul_hilo_u32(const unsigned int x, const unsigned int y, unsigned int& hi)
+{
+    #if defined(__HIP_PLATFORM_NVCC__) && defined(__HIP_DEVICE_COMPILE__)
+
+    // IMAD.HI and IMAD run at full rate and do not need a 64-bit
+    // register pair (mad.wide.u32 with zero addend is split into the same
+    // two instructions plus moves)
+    hi = __umulhi(x, y);
+    return x * y;
+
+    #else // AMDGPU: one v_mad_u64_u32 produces both halves
+
+    const unsigned long long xy = mad_u64_u32(x, y, 0);
+    hi = static_cast<unsigned int>(xy >> 32);
+    return static_cast<unsigned int>(xy);
+
+    #endif
+}
+
+// Seed of a subsequence for fast initialization (rocrand_init_fast()
+// and ROCRAND_ORDERING_PSEUDO_SEEDED): SplitMix64 of seed and subsequence,
+// so seeds of neighbouring subsequences are not correlated
+FQUALIFIERS
+unsigned long long splitmix64_seed(const unsigned long long seed,
+                                   const unsigned long long subsequence)
+{
+    unsigned long long z = seed + (subsequence + 1ULL) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
 // This helps access fields of engine's internal state which
 // saves floats and doubles generated using the Box–Muller transform
 template<typename Engine>
@@ -31,6 +31,9 @@
 #include "rocrand_mrg32k3a.h"
 #include "rocrand_xorwow.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_uniform.h"
@@ -48,9 +51,34 @@
 namespace rocrand_device {
 namespace detail {
 
+FQUALIFIERS
+unsigned int discrete_tree(const double x, const rocrand_discrete_distribution_st& dis)
+{
+    // Descend the Fenwick tree to the first value whose prefix sum of
+    // weights exceeds x * (sum of weights), log2(size) steps
+
+    double target = x * dis.tree[dis.size];
+    unsigned int i = 0;
+    for(unsigned int step = dis.tree_step; step > 0; step >>= 1)
+    {
+        if(i + step <= dis.size && dis.tree[i + step - 1] <= target)
+        {
+            i += step;
+            target -= dis.tree[i - 1];
+        }
+    }
+    // Only rounding errors of the sums can lead past the last value
+    return dis.offset + (i < dis.size ? i : dis.size - 1);
+}
+
 FQUALIFIERS
 unsigned int discrete_alias(const double x, const rocrand_discrete_distribution_st& dis)
 {
+    if(dis.tree != NULL)
+    {
+        return discrete_tree(x, dis);
+    }
+
     // Calculate value using Alias table
 
     // x is [0, 1)
@@ -58,12 +86,28 @@ unsigned int discrete_alias(const double x, const rocrand_discrete_distribution_
     const double fnx = floor(nx);
     const double y = nx - fnx;
     const unsigned int i = static_cast<unsigned int>(fnx);
+    if(dis.packed_alias != NULL)
+    {
+        const unsigned long long e = dis.packed_alias[i];
+        const double p = static_cast<unsigned int>(e) * ROCRAND_2POW32_INV_DOUBLE;
+        return dis.offset + (y < p ? i : static_cast<unsigned int>(e >> 32));
+    }
     return dis.offset + (y < dis.probability[i] ? i : dis.alias[i]);
 }
 
 FQUALIFIERS
 unsigned int discrete_alias(const unsigned int r, const rocrand_discrete_distribution_st& dis)
 {
+    if(dis.packed_alias != NULL)
+    {
+        // The high word of r * size is the bucket, the low word is
+        // the fixed-point position inside it
+        const unsigned long long t = static_cast<unsigned long long>(r) * dis.size;
+        const unsigned int i = static_cast<unsigned int>(t >> 32);
+        const unsigned int y = static_cast<unsigned int>(t);
+        const unsigned long long e = dis.packed_alias[i];
+        return dis.offset + (y < static_cast<unsigned int>(e) ? i : static_cast<unsigned int>(e >> 32));
+    }
     const double x = r * ROCRAND_2POW32_INV_DOUBLE;
     return discrete_alias(x, dis);
 }
@@ -71,6 +115,30 @@ unsigned int discrete_alias(const unsigned int r, const rocrand_discrete_distrib
 FQUALIFIERS
 unsigned int discrete_cdf(const double x, const rocrand_discrete_distribution_st& dis)
 {
+    if(dis.tree != NULL)
+    {
+        // Values are in the same order as in the CDF
+        return discrete_tree(x, dis);
+    }
+
+    if(dis.guide != NULL)
+    {
+        // Start from the guide entry of x and scan the CDF, on average
+        // the scan is shorter than 2 steps. The backward step handles
+        // rounding of x * guide_size.
+        const unsigned int k = static_cast<unsigned int>(x * dis.guide_size);
+        unsigned int i = dis.guide[k < dis.guide_size ? k : dis.guide_size - 1];
+        while(i > 0 && x <= dis.cdf[i - 1])
+        {
+            i--;
+        }
+        while(i < dis.size - 1 && x > dis.cdf[i])
+        {
+            i++;
+        }
+        return dis.offset + i;
+    }
+
     // Calculate value using binary search in CDF
 
     unsigned int min = 0;
@@ -100,6 +168,13 @@ unsigned int discrete_cdf(const unsigned int r, const rocrand_discrete_distribut
     return discrete_cdf(x, dis);
 }
 
+// Only the 32 most significant bits of r are used.
+FQUALIFIERS
+unsigned int discrete_cdf(const unsigned long long r, const rocrand_discrete_distribution_st& dis)
+{
+    return discrete_cdf(static_cast<unsigned int>(r >> 32), dis);
+}
+
 } // end namespace detail
 } // end namespace rocrand_device
 
@@ -222,6 +297,60 @@ unsigned int rocrand_discrete(rocrand_state_sobol32 * state, const rocrand_discr
     return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
 }
 
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using SCRAMBLED_SOBOL32 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_scrambled_sobol32 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using SOBOL64 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_sobol64 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using SCRAMBLED_SOBOL64 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_scrambled_sobol64 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+}
+
 #endif // ROCRAND_DISCRETE_H_
 
 /** @} */ // end of group rocranddevice
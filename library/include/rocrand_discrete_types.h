@@ -32,6 +32,25 @@ struct rocrand_discrete_distribution_st
 
     // Cumulative distribution function
     double * cdf;
+
+    // Packed alias table, one load per value: the low 32 bits are the
+    // probability of the bucket in 0.32 fixed point, the high 32 bits are
+    // its alias (buckets with probability 1 are their own alias).
+    // Used instead of alias and probability if not NULL.
+    unsigned long long * packed_alias;
+
+    // Guide table for the CDF (indexed search): guide[k] is the first value
+    // with cdf >= k / guide_size. Used to start the search if not NULL.
+    unsigned int guide_size;
+    unsigned int * guide;
+
+    // Updatable distributions: current (unnormalized) weights and their
+    // Fenwick tree, tree[i] is the sum of weights[i + 1 - lowbit(i + 1)]
+    // ... weights[i], tree[size] is the sum of all weights. tree_step is the largest power
+    // of 2 not greater than size. Used instead of other tables if not NULL.
+    double * weights;
+    double * tree;
+    unsigned int tree_step;
 };
 
 typedef struct rocrand_discrete_distribution_st * rocrand_discrete_distribution;
@@ -0,0 +1,133 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_EXTERNAL_TABLES_H_
+#define ROCRAND_EXTERNAL_TABLES_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+#include <hip/hip_runtime.h>
+
+#include "rocrand.h"
+
+// Lightweight replacement of rocrand_xorwow_precomputed.h,
+// rocrand_mrg32k3a_precomputed.h and rocrand_xoshiro128pp_precomputed.h, used when ROCRAND_EXTERNAL_TABLES is defined:
+// device functions read jump matrices of the library (rocrand_get_device_tables())
+// instead of embedding megabytes of tables in every code object.
+
+// Layout of the tables of the library, it is checked by
+// rocrand_load_precomputed_tables()
+#define XORWOW_N 5
+#define XORWOW_M 32
+#define XORWOW_SIZE (XORWOW_M * XORWOW_N * XORWOW_N)
+#define XORWOW_JUMP_MATRICES 32
+#define XORWOW_JUMP_LOG2 2
+#define XORWOW_JUMP_MULTIPLES 1
+
+#define MRG323A_JUMP_LOG2 1
+
+#define XOSHIRO128PP_N 4
+#define XOSHIRO128PP_JUMP_POLYNOMIALS 64
+
+namespace rocrand_device {
+namespace detail {
+
+// Tables of the library in memory of the device, every translation unit
+// has its own copy which is set by rocrand_load_precomputed_tables()
+static __constant__ rocrand_precomputed_tables device_precomputed_tables;
+
+inline const rocrand_precomputed_tables * host_precomputed_tables()
+{
+    static const rocrand_precomputed_tables * tables = []()
+    {
+        const rocrand_precomputed_tables * t = NULL;
+        rocrand_get_host_tables(&t);
+        return t;
+    }();
+    return tables;
+}
+
+FQUALIFIERS
+const rocrand_precomputed_tables& precomputed_tables()
+{
+    #if defined(__HIP_DEVICE_COMPILE__)
+    return device_precomputed_tables;
+    #else
+    return *host_precomputed_tables();
+    #endif
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/**
+ * \brief Makes tables of the library available to device functions.
+ *
+ * Required when device code is compiled with \p ROCRAND_EXTERNAL_TABLES
+ * defined before including rocrand_kernel.h: jump matrices of XORWOW and
+ * MRG32k3a and jump polynomials of Xoshiro128++ (used by rocrand_init(),
+ * skipahead() etc.) are not included
+ * in the code object, device functions read the tables of the library
+ * (see rocrand_get_device_tables()) through one constant variable.
+ *
+ * Must be called for the current device before launching kernels which
+ * use XORWOW, MRG32k3a or Xoshiro128++ states, in every translation unit (source file)
+ * with such kernels, because every code object has its own variable.
+ *
+ * \return
+ * - ROCRAND_STATUS_VERSION_MISMATCH if the layout of tables of the library
+ *   is not the same as the layout of this header \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the tables could not be copied \n
+ * - Status of rocrand_get_device_tables() if it failed \n
+ * - ROCRAND_STATUS_SUCCESS if the tables were successfully loaded \n
+ */
+static inline
+rocrand_status rocrand_load_precomputed_tables()
+{
+    const rocrand_precomputed_tables * tables = NULL;
+    rocrand_status status = rocrand_get_device_tables(&tables);
+    if(status != ROCRAND_STATUS_SUCCESS)
+        return status;
+
+    if(tables->xorwow_jump_log2 != XORWOW_JUMP_LOG2
+        || tables->xorwow_jump_multiples != XORWOW_JUMP_MULTIPLES
+        || tables->mrg32k3a_jump_log2 != MRG323A_JUMP_LOG2)
+    {
+        return ROCRAND_STATUS_VERSION_MISMATCH;
+    }
+
+    if(hipMemcpyToSymbol(HIP_SYMBOL(rocrand_device::detail::device_precomputed_tables),
+                         tables, sizeof(rocrand_precomputed_tables)) != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+/** @} */ // end of group rocranddevice
+
+#endif // ROCRAND_EXTERNAL_TABLES_H_
@@ -0,0 +1,307 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_GAMMA_H_
+#define ROCRAND_GAMMA_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#include <math.h>
+
+#include "rocrand_uniform.h"
+#include "rocrand_normal.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// One attempt of the method of G. Marsaglia and W. W. Tsang for the
+// standard gamma distribution with shape a >= 1, d = a - 1/3 and
+// c = 1 / sqrt(9 * d): x is a standard normal value, u is a uniform value
+// from (0, 1]. Stores the candidate d * (1 + c * x)^3 in result and returns
+// false if it is rejected. The squeeze accepts most candidates without
+// logarithms, the whole test is evaluated without branches on x and u, so
+// threads of a wavefront which accept and which retry stay converged.
+template<class RealType>
+FQUALIFIERS
+bool gamma_marsaglia_tsang(const RealType x, const RealType u,
+                           const RealType d, const RealType c,
+                           RealType& result)
+{
+    const RealType t = RealType(1) + c * x;
+    const RealType v = t * t * t;
+    const RealType x2 = x * x;
+    result = d * v;
+    return t > RealType(0)
+        && (u < RealType(1) - RealType(0.0331) * x2 * x2
+            || log(u) < RealType(0.5) * x2 + d * (RealType(1) - v + log(v)));
+}
+
+// Values of the standard gamma distribution with shape >= 1, attempts are
+// repeated until a candidate is accepted (about 1.05 attempts per value)
+template<class State>
+FQUALIFIERS
+float gamma_distribution_marsaglia_tsang(State state, float shape)
+{
+    const float d = shape - 1.0f / 3.0f;
+    const float c = 1.0f / sqrtf(9.0f * d);
+    float result;
+    bool accepted;
+    do
+    {
+        const float x = rocrand_normal(state);
+        const float u = rocrand_uniform(state);
+        accepted = gamma_marsaglia_tsang(x, u, d, c, result);
+    }
+    while(!accepted);
+    return result;
+}
+
+template<class State>
+FQUALIFIERS
+double gamma_distribution_marsaglia_tsang_double(State state, double shape)
+{
+    const double d = shape - 1.0 / 3.0;
+    const double c = 1.0 / sqrt(9.0 * d);
+    double result;
+    bool accepted;
+    do
+    {
+        const double x = rocrand_normal_double(state);
+        const double u = rocrand_uniform_double(state);
+        accepted = gamma_marsaglia_tsang(x, u, d, c, result);
+    }
+    while(!accepted);
+    return result;
+}
+
+// Shape < 1: a value of shape + 1 multiplied by u^(1 / shape)
+template<class State>
+FQUALIFIERS
+float gamma_distribution(State state, float shape)
+{
+    if(shape < 1.0f)
+    {
+        const float g = gamma_distribution_marsaglia_tsang(state, shape + 1.0f);
+        return g * powf(rocrand_uniform(state), 1.0f / shape);
+    }
+    return gamma_distribution_marsaglia_tsang(state, shape);
+}
+
+template<class State>
+FQUALIFIERS
+double gamma_distribution_double(State state, double shape)
+{
+    if(shape < 1.0)
+    {
+        const double g = gamma_distribution_marsaglia_tsang_double(state, shape + 1.0);
+        return g * pow(rocrand_uniform_double(state), 1.0 / shape);
+    }
+    return gamma_distribution_marsaglia_tsang_double(state, shape);
+}
+
+// Logarithms of gamma values, values of small shapes underflow
+template<class State>
+FQUALIFIERS
+float log_gamma_distribution(State state, float shape)
+{
+    if(shape < 1.0f)
+    {
+        const float g = gamma_distribution_marsaglia_tsang(state, shape + 1.0f);
+        return logf(g) + logf(rocrand_uniform(state)) / shape;
+    }
+    return logf(gamma_distribution_marsaglia_tsang(state, shape));
+}
+
+template<class State>
+FQUALIFIERS
+double log_gamma_distribution_double(State state, double shape)
+{
+    if(shape < 1.0)
+    {
+        const double g = gamma_distribution_marsaglia_tsang_double(state, shape + 1.0);
+        return log(g) + log(rocrand_uniform_double(state)) / shape;
+    }
+    return log(gamma_distribution_marsaglia_tsang_double(state, shape));
+}
+
+// X / (X + Y) of gamma values X and Y with shapes alpha and beta,
+// computed from logarithms of X and Y
+template<class State>
+FQUALIFIERS
+float beta_distribution(State state, float alpha, float beta)
+{
+    const float log_x = log_gamma_distribution(state, alpha);
+    const float log_y = log_gamma_distribution(state, beta);
+    return 1.0f / (1.0f + expf(log_y - log_x));
+}
+
+template<class State>
+FQUALIFIERS
+double beta_distribution_double(State state, double alpha, double beta)
+{
+    const double log_x = log_gamma_distribution_double(state, alpha);
+    const double log_y = log_gamma_distribution_double(state, beta);
+    return 1.0 / (1.0 + exp(log_y - log_x));
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Returns a gamma-distributed <tt>float</tt> value.
+ *
+ * Generates and returns a gamma-distributed random <tt>float</tt> value
+ * with shape \p shape and scale \p scale using the generator in \p state,
+ * which can be the state of any generator with rocrand_normal() and
+ * rocrand_uniform() (pseudo-random generators). Values are computed by
+ * the method of Marsaglia and Tsang, values of \p shape less than 1 from
+ * values of \p shape + 1. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param shape - Shape of the distribution (greater than 0)
+ * \param scale - Scale of the distribution (greater than 0)
+ *
+ * \return Gamma-distributed <tt>float</tt> value
+ */
+template<class State>
+FQUALIFIERS
+float rocrand_gamma(State * state, float shape, float scale)
+{
+    return scale * rocrand_device::detail::gamma_distribution(state, shape);
+}
+
+/**
+ * \brief Returns a gamma-distributed <tt>double</tt> value.
+ *
+ * Generates and returns a gamma-distributed random <tt>double</tt> value
+ * with shape \p shape and scale \p scale using the generator in \p state,
+ * which can be the state of any generator with rocrand_normal_double() and
+ * rocrand_uniform_double() (pseudo-random generators). Values are computed by
+ * the method of Marsaglia and Tsang, values of \p shape less than 1 from
+ * values of \p shape + 1. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param shape - Shape of the distribution (greater than 0)
+ * \param scale - Scale of the distribution (greater than 0)
+ *
+ * \return Gamma-distributed <tt>double</tt> value
+ */
+template<class State>
+FQUALIFIERS
+double rocrand_gamma_double(State * state, double shape, double scale)
+{
+    return scale * rocrand_device::detail::gamma_distribution_double(state, shape);
+}
+
+/**
+ * \brief Returns a beta-distributed <tt>float</tt> value.
+ *
+ * Generates and returns a beta-distributed random <tt>float</tt> value
+ * with shapes \p alpha and \p beta using the generator in \p state
+ * (see rocrand_gamma()). The value is X / (X + Y) of gamma-distributed X
+ * and Y with shapes \p alpha and \p beta. State is incremented by
+ * a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param alpha - First shape of the distribution (greater than 0)
+ * \param beta - Second shape of the distribution (greater than 0)
+ *
+ * \return Beta-distributed <tt>float</tt> value from [0, 1]
+ */
+template<class State>
+FQUALIFIERS
+float rocrand_beta(State * state, float alpha, float beta)
+{
+    return rocrand_device::detail::beta_distribution(state, alpha, beta);
+}
+
+/**
+ * \brief Returns a beta-distributed <tt>double</tt> value.
+ *
+ * Generates and returns a beta-distributed random <tt>double</tt> value
+ * with shapes \p alpha and \p beta using the generator in \p state
+ * (see rocrand_gamma_double()). The value is X / (X + Y) of gamma-distributed
+ * X and Y with shapes \p alpha and \p beta. State is incremented by
+ * a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param alpha - First shape of the distribution (greater than 0)
+ * \param beta - Second shape of the distribution (greater than 0)
+ *
+ * \return Beta-distributed <tt>double</tt> value from [0, 1]
+ */
+template<class State>
+FQUALIFIERS
+double rocrand_beta_double(State * state, double alpha, double beta)
+{
+    return rocrand_device::detail::beta_distribution_double(state, alpha, beta);
+}
+
+/**
+ * \brief Returns an exponentially distributed <tt>float</tt> value.
+ *
+ * Generates and returns an exponentially distributed random <tt>float</tt>
+ * value with rate \p lambda (mean 1 / \p lambda) using the generator in
+ * \p state, which can be the state of any generator with rocrand_uniform().
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Rate of the distribution (greater than 0)
+ *
+ * \return Exponentially distributed <tt>float</tt> value
+ */
+template<class State>
+FQUALIFIERS
+float rocrand_exponential(State * state, float lambda)
+{
+    // Uniform values are from (0, 1], so values are finite
+    return -logf(rocrand_uniform(state)) / lambda;
+}
+
+/**
+ * \brief Returns an exponentially distributed <tt>double</tt> value.
+ *
+ * Generates and returns an exponentially distributed random <tt>double</tt>
+ * value with rate \p lambda (mean 1 / \p lambda) using the generator in
+ * \p state, which can be the state of any generator with rocrand_uniform_double().
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Rate of the distribution (greater than 0)
+ *
+ * \return Exponentially distributed <tt>double</tt> value
+ */
+template<class State>
+FQUALIFIERS
+double rocrand_exponential_double(State * state, double lambda)
+{
+    return -log(rocrand_uniform_double(state)) / lambda;
+}
+
+#endif // ROCRAND_GAMMA_H_
+
+/** @} */ // end of group rocranddevice
@@ -31,9 +31,17 @@
 
 #include "rocrand_common.h"
 #include "rocrand_philox4x32_10.h"
+#include "rocrand_threefry4x32_20.h"
+#include "rocrand_threefry2x64_20.h"
+#include "rocrand_philox4x64_10.h"
 #include "rocrand_mrg32k3a.h"
 #include "rocrand_xorwow.h"
+#include "rocrand_xoshiro128pp.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_uniform.h"
@@ -41,5 +49,11 @@
 #include "rocrand_log_normal.h"
 #include "rocrand_poisson.h"
 #include "rocrand_discrete.h"
+#include "rocrand_gamma.h"
+#include "rocrand_binomial.h"
+#include "rocrand_bernoulli.h"
+#include "rocrand_truncated_normal.h"
+#include "rocrand_block.h"
+#include "rocrand_states.h"
 
 #endif // ROCRAND_KERNEL_H_
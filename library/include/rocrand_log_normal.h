@@ -36,6 +36,9 @@
 #include "rocrand_mrg32k3a.h"
 #include "rocrand_xorwow.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_normal.h"
@@ -95,6 +98,25 @@ float2 rocrand_log_normal2(rocrand_state_philox4x32_10 * state, float mean, floa
     };
 }
 
+/**
+ * \brief Same as rocrand_log_normal2() for a compact Philox \p state.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_log_normal2(rocrand_state_philox4x32_10_compact * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    return float2 {
+        expf(mean + (stddev * r.x)),
+        expf(mean + (stddev * r.y))
+    };
+}
+
 /**
  * \brief Returns four log-normally distributed \p float values.
  *
@@ -176,6 +198,25 @@ double2 rocrand_log_normal_double2(rocrand_state_philox4x32_10 * state, double m
     };
 }
 
+/**
+ * \brief Same as rocrand_log_normal_double2() for a compact Philox \p state.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_log_normal_double2(rocrand_state_philox4x32_10_compact * state, double mean, double stddev)
+{
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double2 {
+        exp(mean + (stddev * r.x)),
+        exp(mean + (stddev * r.y))
+    };
+}
+
 /**
  * \brief Returns four log-normally distributed \p double values.
  *
@@ -256,6 +297,25 @@ float2 rocrand_log_normal2(rocrand_state_mrg32k3a * state, float mean, float std
     };
 }
 
+/**
+ * \brief Same as rocrand_log_normal2() for a compact MRG32K3A \p state.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_log_normal2(rocrand_state_mrg32k3a_compact * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+    return float2 {
+        expf(mean + (stddev * r.x)),
+        expf(mean + (stddev * r.y))
+    };
+}
+
 /**
  * \brief Returns a log-normally distributed \p double value.
  *
@@ -311,6 +371,25 @@ double2 rocrand_log_normal_double2(rocrand_state_mrg32k3a * state, double mean,
     };
 }
 
+/**
+ * \brief Same as rocrand_log_normal_double2() for a compact MRG32K3A \p state.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_log_normal_double2(rocrand_state_mrg32k3a_compact * state, double mean, double stddev)
+{
+    double2 r = rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+    return double2 {
+        exp(mean + (stddev * r.x)),
+        exp(mean + (stddev * r.y))
+    };
+}
+
 /**
  * \brief Returns a log-normally distributed \p float value.
  *
@@ -366,6 +445,25 @@ float2 rocrand_log_normal2(rocrand_state_xorwow * state, float mean, float stdde
     };
 }
 
+/**
+ * \brief Same as rocrand_log_normal2() for a compact XORWOW \p state.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_log_normal2(rocrand_state_xorwow_compact * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    return float2 {
+        expf(mean + (stddev * r.x)),
+        expf(mean + (stddev * r.y))
+    };
+}
+
 /**
  * \brief Returns a log-normally distributed \p double value.
  *
@@ -425,6 +523,27 @@ double2 rocrand_log_normal_double2(rocrand_state_xorwow * state, double mean, do
     };
 }
 
+/**
+ * \brief Same as rocrand_log_normal_double2() for a compact XORWOW \p state.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_log_normal_double2(rocrand_state_xorwow_compact * state, double mean, double stddev)
+{
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
+    );
+    return double2 {
+        exp(mean + (stddev * r.x)),
+        exp(mean + (stddev * r.y))
+    };
+}
+
 /**
  * \brief Returns a log-normally distributed \p float value.
  *
@@ -501,6 +620,215 @@ double rocrand_log_normal_double(rocrand_state_sobol32 * state, double mean, dou
     return exp(mean + (stddev * r));
 }
 
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using SCRAMBLED_SOBOL32
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_scrambled_sobol32 * state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(rocrand(state));
+    return expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using SCRAMBLED_SOBOL32
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_scrambled_sobol32 * state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_sobol64 * state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(rocrand(state));
+    return expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_sobol64 * state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using SCRAMBLED_SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_scrambled_sobol64 * state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(rocrand(state));
+    return expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using SCRAMBLED_SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_scrambled_sobol64 * state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns two log-normally distributed \p __half values.
+ *
+ * Generates and returns two log-normally distributed \p __half values using Philox
+ * generator in \p state, and increments position of the generator by one.
+ * The values are computed by the Box-Muller transform of two 16-bit uniform
+ * values of one <tt>unsigned int</tt> value.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p __half values as \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_log_normal_half2(rocrand_state_philox4x32_10 * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::box_muller_half(rocrand(state));
+    return __floats2half2_rn(
+        expf(mean + (stddev * r.x)),
+        expf(mean + (stddev * r.y))
+    );
+}
+
+/**
+ * \brief Returns two log-normally distributed \p __half values.
+ *
+ * Generates and returns two log-normally distributed \p __half values using MRG32K3A
+ * generator in \p state, and increments position of the generator by one.
+ * The values are computed by the Box-Muller transform of two 16-bit uniform
+ * values of one <tt>unsigned int</tt> value.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p __half values as \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_log_normal_half2(rocrand_state_mrg32k3a * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::box_muller_half(rocrand(state));
+    return __floats2half2_rn(
+        expf(mean + (stddev * r.x)),
+        expf(mean + (stddev * r.y))
+    );
+}
+
+/**
+ * \brief Returns two log-normally distributed \p __half values.
+ *
+ * Generates and returns two log-normally distributed \p __half values using XORWOW
+ * generator in \p state, and increments position of the generator by one.
+ * The values are computed by the Box-Muller transform of two 16-bit uniform
+ * values of one <tt>unsigned int</tt> value.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p __half values as \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_log_normal_half2(rocrand_state_xorwow * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::box_muller_half(rocrand(state));
+    return __floats2half2_rn(
+        expf(mean + (stddev * r.x)),
+        expf(mean + (stddev * r.y))
+    );
+}
+
+/**
+ * \brief Returns two log-normally distributed \p __half values.
+ *
+ * Generates and returns two log-normally distributed \p __half values using MTGP32
+ * generator in \p state, and increments position of the generator by one.
+ * The values are computed by the Box-Muller transform of two 16-bit uniform
+ * values of one <tt>unsigned int</tt> value.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p __half values as \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_log_normal_half2(rocrand_state_mtgp32 * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::box_muller_half(rocrand(state));
+    return __floats2half2_rn(
+        expf(mean + (stddev * r.x)),
+        expf(mean + (stddev * r.y))
+    );
+}
 
 #endif // ROCRAND_LOG_NORMAL_H_
 
@@ -26,7 +26,27 @@
 #endif // FQUALIFIERS_
 
 #include "rocrand_common.h"
+#ifdef ROCRAND_EXTERNAL_TABLES
+#include "rocrand_external_tables.h"
+#else
 #include "rocrand_mrg32k3a_precomputed.h"
+#endif
+
+// Tables generated before jump bases were configurable have one matrix
+// per binary digit
+#ifndef MRG323A_JUMP_LOG2
+#define MRG323A_JUMP_LOG2 1
+#endif
+
+// Jump matrices of the library, of device code or of host code
+#if defined(ROCRAND_EXTERNAL_TABLES)
+#define ROCRAND_DETAIL_MRG32K3A_TABLE(name) \
+    (::rocrand_device::detail::precomputed_tables().mrg32k3a_##name)
+#elif defined(__HIP_DEVICE_COMPILE__)
+#define ROCRAND_DETAIL_MRG32K3A_TABLE(name) d_##name
+#else
+#define ROCRAND_DETAIL_MRG32K3A_TABLE(name) h_##name
+#endif
 
 // Thomas Bradley, Parallelisation Techniques for Random Number Generators
 // https://www.nag.co.uk/IndustryArticles/gpu_gems_article.pdf
@@ -58,32 +78,60 @@
 
 namespace rocrand_device {
 
-class mrg32k3a_engine
+namespace detail {
+
+// State of mrg32k3a_engine
+struct mrg32k3a_state
 {
-public:
-    struct mrg32k3a_state
-    {
-        unsigned int g1[3];
-        unsigned int g2[3];
+    unsigned int g1[3];
+    unsigned int g2[3];
 
+    #ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+    // The Box–Muller transform requires two inputs to convert uniformly
+    // distributed real values [0; 1] to normally distributed real values
+    // (with mean = 0, and stddev = 1). Often user wants only one
+    // normally distributed number, to save performance and random
+    // numbers the 2nd value is saved for future requests.
+    unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+    unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+    float boxmuller_float; // normally distributed float
+    double boxmuller_double; // normally distributed double
+    #endif
+
+    FQUALIFIERS
+    void reset_boxmuller()
+    {
         #ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
-        // The Box–Muller transform requires two inputs to convert uniformly
-        // distributed real values [0; 1] to normally distributed real values
-        // (with mean = 0, and stddev = 1). Often user wants only one
-        // normally distributed number, to save performance and random
-        // numbers the 2nd value is saved for future requests.
-        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
-        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
-        float boxmuller_float; // normally distributed float
-        double boxmuller_double; // normally distributed double
+        boxmuller_float_state = 0;
+        boxmuller_double_state = 0;
         #endif
+    }
 
-        FQUALIFIERS
-        ~mrg32k3a_state() { }
-    };
+    FQUALIFIERS
+    ~mrg32k3a_state() { }
+};
 
+// State of mrg32k3a_compact_engine, without the Box-Muller cache
+struct mrg32k3a_compact_state
+{
+    unsigned int g1[3];
+    unsigned int g2[3];
+
+    FQUALIFIERS
+    void reset_boxmuller() { }
+
+    FQUALIFIERS
+    ~mrg32k3a_compact_state() { }
+};
+
+// Sequence of mrg32k3a_engine and mrg32k3a_compact_engine, which
+// differ only in the State (with or without the Box-Muller cache)
+template<class State>
+class mrg32k3a_engine_base
+{
+public:
     FQUALIFIERS
-    mrg32k3a_engine()
+    mrg32k3a_engine_base()
     {
         this->seed(ROCRAND_MRG32K3A_DEFAULT_SEED, 0, 0);
     }
@@ -97,16 +145,13 @@ public:
     ///
     /// A subsequence is 2^67 numbers long.
     FQUALIFIERS
-    mrg32k3a_engine(const unsigned long long seed,
-                    const unsigned long long subsequence,
-                    const unsigned long long offset)
+    mrg32k3a_engine_base(const unsigned long long seed,
+                         const unsigned long long subsequence,
+                         const unsigned long long offset)
     {
         this->seed(seed, subsequence, offset);
     }
 
-    FQUALIFIERS
-    ~mrg32k3a_engine() { }
-
     /// Reinitializes the internal state of the PRNG using new
     /// seed value \p seed_value, skips \p subsequence subsequences
     /// and \p offset random numbers.
@@ -162,10 +207,7 @@ public:
     void restart(const unsigned long long subsequence,
                  const unsigned long long offset)
     {
-        #ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
-        m_state.boxmuller_float_state = 0;
-        m_state.boxmuller_double_state = 0;
-        #endif
+        m_state.reset_boxmuller();
         this->discard_subsequence_impl(subsequence);
         this->discard_impl(offset);
     }
@@ -181,7 +223,7 @@ public:
     FQUALIFIERS
     unsigned int next()
     {
-        const unsigned int p1 = mod_m1(
+        const unsigned int p1 = mod_m1_next(
             detail::mad_u64_u32(
                 ROCRAND_MRG32K3A_A12,
                 m_state.g1[1],
@@ -196,7 +238,7 @@ public:
         m_state.g1[0] = m_state.g1[1]; m_state.g1[1] = m_state.g1[2];
         m_state.g1[2] = p1;
 
-        const unsigned int p2 = mod_m2(
+        const unsigned int p2 = mod_m2_next(
             detail::mad_u64_u32(
                 ROCRAND_MRG32K3A_A21,
                 m_state.g2[2],
@@ -230,17 +272,15 @@ protected:
         int i = 0;
 
         while(subsequence > 0) {
-            if (subsequence & 1) {
-                #if defined(__HIP_DEVICE_COMPILE__)
-                mod_mat_vec_m1(d_A1P67 + i, m_state.g1);
-                mod_mat_vec_m2(d_A2P67 + i, m_state.g2);
-                #else
-                mod_mat_vec_m1(h_A1P67 + i, m_state.g1);
-                mod_mat_vec_m2(h_A2P67 + i, m_state.g2);
-                #endif
+            const unsigned int is =
+                static_cast<unsigned int>(subsequence) & ((1 << MRG323A_JUMP_LOG2) - 1);
+            if (is > 0) {
+                const int mi = i + (is - 1) * 9;
+                mod_mat_vec_m1(ROCRAND_DETAIL_MRG32K3A_TABLE(A1P67) + mi, m_state.g1);
+                mod_mat_vec_m2(ROCRAND_DETAIL_MRG32K3A_TABLE(A2P67) + mi, m_state.g2);
             }
-            subsequence >>= 1;
-            i += 9;
+            subsequence >>= MRG323A_JUMP_LOG2;
+            i += 9 * ((1 << MRG323A_JUMP_LOG2) - 1);
         }
     }
 
@@ -251,17 +291,15 @@ protected:
         int i = 0;
 
         while(sequence > 0) {
-            if (sequence & 1) {
-                #if defined(__HIP_DEVICE_COMPILE__)
-                mod_mat_vec_m1(d_A1P127 + i, m_state.g1);
-                mod_mat_vec_m2(d_A2P127 + i, m_state.g2);
-                #else
-                mod_mat_vec_m1(h_A1P127 + i, m_state.g1);
-                mod_mat_vec_m2(h_A2P127 + i, m_state.g2);
-                #endif
+            const unsigned int is =
+                static_cast<unsigned int>(sequence) & ((1 << MRG323A_JUMP_LOG2) - 1);
+            if (is > 0) {
+                const int mi = i + (is - 1) * 9;
+                mod_mat_vec_m1(ROCRAND_DETAIL_MRG32K3A_TABLE(A1P127) + mi, m_state.g1);
+                mod_mat_vec_m2(ROCRAND_DETAIL_MRG32K3A_TABLE(A2P127) + mi, m_state.g2);
             }
-            sequence >>= 1;
-            i += 9;
+            sequence >>= MRG323A_JUMP_LOG2;
+            i += 9 * ((1 << MRG323A_JUMP_LOG2) - 1);
         }
     }
 
@@ -273,17 +311,16 @@ protected:
         int i = 0;
 
         while(offset > 0) {
-            if (offset & 1) {
-                #if defined(__HIP_DEVICE_COMPILE__)
-                mod_mat_vec_m1(d_A1 + i, m_state.g1);
-                mod_mat_vec_m2(d_A2 + i, m_state.g2);
-                #else
-                mod_mat_vec_m1(h_A1 + i, m_state.g1);
-                mod_mat_vec_m2(h_A2 + i, m_state.g2);
-                #endif
+            const unsigned int is =
+                static_cast<unsigned int>(offset) & ((1 << MRG323A_JUMP_LOG2) - 1);
+            if (is > 0) {
+                // Matrices of a digit are A^(k * base^i) for k = 1...base - 1
+                const int mi = i + (is - 1) * 9;
+                mod_mat_vec_m1(ROCRAND_DETAIL_MRG32K3A_TABLE(A1) + mi, m_state.g1);
+                mod_mat_vec_m2(ROCRAND_DETAIL_MRG32K3A_TABLE(A2) + mi, m_state.g2);
             }
-            offset >>= 1;
-            i += 9;
+            offset >>= MRG323A_JUMP_LOG2;
+            i += 9 * ((1 << MRG323A_JUMP_LOG2) - 1);
         }
     }
 
@@ -369,6 +406,18 @@ private:
         return p;
     }
 
+    // Reduction of products computed in next() (p < 2^53). After folding
+    // the high part once p < 2 * M1, so the final step needs only 32-bit
+    // operations: p - M1 == lo + M1C (mod 2^32) because 2^32 == M1C (mod M1).
+    FQUALIFIERS
+    unsigned int mod_m1_next(unsigned long long p)
+    {
+        p = detail::mad_u64_u32(ROCRAND_MRG32K3A_M1C, (p >> 32), p & (ROCRAND_MRG32K3A_POW32 - 1));
+        const unsigned int lo = static_cast<unsigned int>(p);
+        const unsigned int hi = static_cast<unsigned int>(p >> 32);
+        return (hi != 0 || lo >= ROCRAND_MRG32K3A_M1) ? lo + ROCRAND_MRG32K3A_M1C : lo;
+    }
+
     FQUALIFIERS
     unsigned long long mod_mul_m2(unsigned int i,
                                   unsigned long long j)
@@ -397,16 +446,80 @@ private:
         return p;
     }
 
+    // Same as mod_m1_next(), two folding steps leave p < 2 * M2
+    FQUALIFIERS
+    unsigned int mod_m2_next(unsigned long long p)
+    {
+        p = detail::mad_u64_u32(ROCRAND_MRG32K3A_M2C, (p >> 32), p & (ROCRAND_MRG32K3A_POW32 - 1));
+        p = detail::mad_u64_u32(ROCRAND_MRG32K3A_M2C, (p >> 32), p & (ROCRAND_MRG32K3A_POW32 - 1));
+        const unsigned int lo = static_cast<unsigned int>(p);
+        const unsigned int hi = static_cast<unsigned int>(p >> 32);
+        return (hi != 0 || lo >= ROCRAND_MRG32K3A_M2) ? lo + ROCRAND_MRG32K3A_M2C : lo;
+    }
+
 protected:
     // State
-    mrg32k3a_state m_state;
+    State m_state;
+}; // mrg32k3a_engine_base class
+
+} // end detail namespace
+
+class mrg32k3a_engine : public detail::mrg32k3a_engine_base<detail::mrg32k3a_state>
+{
+public:
+    typedef detail::mrg32k3a_state mrg32k3a_state;
+
+    FQUALIFIERS
+    mrg32k3a_engine() { }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    FQUALIFIERS
+    mrg32k3a_engine(const unsigned long long seed,
+                    const unsigned long long subsequence,
+                    const unsigned long long offset)
+        : detail::mrg32k3a_engine_base<detail::mrg32k3a_state>(seed, subsequence, offset) { }
+
+    FQUALIFIERS
+    explicit mrg32k3a_engine(detail::uninitialized_tag) { }
 
+    FQUALIFIERS
+    ~mrg32k3a_engine() { }
+
+protected:
     #ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
     friend struct detail::engine_boxmuller_helper<mrg32k3a_engine>;
     #endif
 
 }; // mrg32k3a_engine class
 
+/// MRG32k3a engine with the same sequences as mrg32k3a_engine but without
+/// the cached second value of the Box-Muller transform, so the state is
+/// 24 instead of 48 bytes. Normal values are generated in pairs.
+class mrg32k3a_compact_engine : public detail::mrg32k3a_engine_base<detail::mrg32k3a_compact_state>
+{
+public:
+    typedef detail::mrg32k3a_compact_state mrg32k3a_state;
+
+    FQUALIFIERS
+    mrg32k3a_compact_engine() { }
+
+    /// Initializes the internal state of the PRNG, see mrg32k3a_engine.
+    FQUALIFIERS
+    mrg32k3a_compact_engine(const unsigned long long seed,
+                            const unsigned long long subsequence,
+                            const unsigned long long offset)
+        : detail::mrg32k3a_engine_base<detail::mrg32k3a_compact_state>(seed, subsequence, offset) { }
+
+    FQUALIFIERS
+    explicit mrg32k3a_compact_engine(detail::uninitialized_tag) { }
+
+    FQUALIFIERS
+    ~mrg32k3a_compact_engine() { }
+
+}; // mrg32k3a_compact_engine class
+
 } // end namespace rocrand_device
 
 /** \rocrand_internal \addtogroup rocranddevice
@@ -416,6 +529,7 @@ protected:
 
 /// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
 typedef rocrand_device::mrg32k3a_engine rocrand_state_mrg32k3a;
+typedef rocrand_device::mrg32k3a_compact_engine rocrand_state_mrg32k3a_compact;
 /// \endcond
 
 /**
@@ -438,6 +552,34 @@ void rocrand_init(const unsigned long long seed,
     *state = rocrand_state_mrg32k3a(seed, subsequence, offset);
 }
 
+/**
+ * \brief Initialize MRG32K3A state without skipping ahead to the subsequence.
+ *
+ * Initializes the MRG32K3A generator \p state with a seed computed by hashing
+ * \p seed and \p subsequence (SplitMix64) and skips \p offset numbers.
+ * Unlike rocrand_init(), no jump to \p subsequence is computed, so the
+ * initialization is much faster, but sequences of different subsequences are
+ * statistically independent instead of guaranteed to be non-overlapping.
+ *
+ * States of subsequences 0, 1, 2... give the same numbers as engines of
+ * the host API generator with ROCRAND_ORDERING_PSEUDO_SEEDED ordering.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence (e.g. index of the thread) hashed with the seed
+ * \param offset - Absolute offset into the sequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init_fast(const unsigned long long seed,
+                       const unsigned long long subsequence,
+                       const unsigned long long offset,
+                       rocrand_state_mrg32k3a * state)
+{
+    *state = rocrand_state_mrg32k3a(
+        rocrand_device::detail::splitmix64_seed(seed, subsequence), 0, offset
+    );
+}
+
 /**
  * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
  * from [0; 2^32 - 1] range.
@@ -456,6 +598,33 @@ unsigned int rocrand(rocrand_state_mrg32k3a * state)
     return static_cast<unsigned int>(state->next() * ROCRAND_MRG32K3A_UINT_NORM);
 }
 
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using MRG32K3A generator in \p state.
+ * State is incremented by four positions. The results are the same as of
+ * four calls of rocrand(), but the state is loaded and stored once.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand4(rocrand_state_mrg32k3a * state)
+{
+    rocrand_state_mrg32k3a local = *state;
+    const uint4 result = uint4 {
+        static_cast<unsigned int>(local.next() * ROCRAND_MRG32K3A_UINT_NORM),
+        static_cast<unsigned int>(local.next() * ROCRAND_MRG32K3A_UINT_NORM),
+        static_cast<unsigned int>(local.next() * ROCRAND_MRG32K3A_UINT_NORM),
+        static_cast<unsigned int>(local.next() * ROCRAND_MRG32K3A_UINT_NORM)
+    };
+    *state = local;
+    return result;
+}
+
 /**
  * \brief Updates MRG32K3A state to skip ahead by \p offset elements.
  *
@@ -500,6 +669,72 @@ void skipahead_sequence(unsigned long long sequence, rocrand_state_mrg32k3a * st
     return state->discard_sequence(sequence);
 }
 
+/**
+ * \brief Initialize compact MRG32K3A state.
+ *
+ * Initializes the compact MRG32K3A generator \p state with the given
+ * \p seed, \p subsequence, and \p offset. Sequences are the same as of
+ * rocrand_state_mrg32k3a, but the state has no cache of the Box-Muller
+ * transform (24 instead of 48 bytes), so normal values are returned only
+ * in pairs (rocrand_normal2(), rocrand_normal_double2(), rocrand_log_normal2()
+ * and rocrand_log_normal_double2()).
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_mrg32k3a_compact * state)
+{
+    *state = rocrand_state_mrg32k3a_compact(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Same as rocrand() of rocrand_state_mrg32k3a for a compact MRG32K3A \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_mrg32k3a_compact * state)
+{
+    return static_cast<unsigned int>(state->next() * ROCRAND_MRG32K3A_UINT_NORM);
+}
+
+/**
+ * \brief Updates compact MRG32K3A state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_mrg32k3a_compact * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates compact MRG32K3A state to skip ahead by \p subsequence subsequences.
+ *
+ * Each subsequence is 2^67 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_mrg32k3a_compact * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
 #endif // ROCRAND_MRG32K3A_H_
 
 /** @} */ // end of group rocranddevice
@@ -26,6 +26,7 @@
 
 #define MRG323A_DIM 64
 #define MRG323A_N 576
+#define MRG323A_JUMP_LOG2 1
 
 static const __device__ unsigned long long d_A1[MRG323A_N] =
     {
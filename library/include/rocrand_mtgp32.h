@@ -136,7 +136,8 @@ struct mtgp32_state
     ~mtgp32_state() { }
 };
 
-inline
+// Can be called on the host and on the device
+__forceinline__ __host__ __device__
 void rocrand_mtgp32_init_state(unsigned int array[],
                                const mtgp32_fast_params *para, unsigned int seed)
 {
@@ -148,7 +149,12 @@ void rocrand_mtgp32_init_state(unsigned int array[],
     tmp = hidden_seed;
     tmp += tmp >> 16;
     tmp += tmp >> 8;
-    memset(array, tmp & 0xff, sizeof(unsigned int) * size);
+    // Same as memset(array, tmp & 0xff, sizeof(unsigned int) * size)
+    tmp &= 0xff;
+    tmp |= tmp << 8;
+    tmp |= tmp << 16;
+    for (i = 0; i < size; i++)
+        array[i] = tmp;
     array[0] = seed;
     array[1] = hidden_seed;
     for (i = 1; i < size; i++)
@@ -294,7 +300,7 @@ public:
         #endif
     }
 
-private:
+protected:
     FQUALIFIERS
     unsigned int para_rec(unsigned int X1, unsigned int X2, unsigned int Y)
     {
@@ -345,6 +351,28 @@ public:
 
 }; // mtgp32_engine class
 
+// Initializes the state and parameters of engine of the id-th block,
+// can be called on the host and on the device
+__forceinline__ __host__ __device__
+void rocrand_mtgp32_init_engine(mtgp32_engine& engine,
+                                const mtgp32_fast_params params[],
+                                int id,
+                                unsigned int seed)
+{
+    rocrand_mtgp32_init_state(&(engine.m_state.status[0]), &params[id], seed);
+    engine.m_state.offset = 0;
+    engine.m_state.id = id;
+    engine.pos_tbl = params[id].pos;
+    engine.sh1_tbl = params[id].sh1;
+    engine.sh2_tbl = params[id].sh2;
+    engine.mask = params[0].mask;
+    for (int j = 0; j < MTGP_TS; j++) {
+        engine.param_tbl[j] = params[id].tbl[j];
+        engine.temper_tbl[j] = params[id].tmp_tbl[j];
+        engine.single_temper_tbl[j] = params[id].flt_tmp_tbl[j];
+    }
+}
+
 } // end namespace rocrand_device
 
 /** \rocrand_internal \addtogroup rocranddevice
@@ -388,18 +416,7 @@ rocrand_status rocrand_make_state_mtgp32(rocrand_state_mtgp32 * d_state,
         return ROCRAND_STATUS_ALLOCATION_FAILED;
 
     for (i = 0; i < n; i++) {
-        rocrand_device::rocrand_mtgp32_init_state(&(h_state[i].m_state.status[0]), &params[i], (unsigned int)seed + i + 1);
-        h_state[i].m_state.offset = 0;
-        h_state[i].m_state.id = i;
-        h_state[i].pos_tbl = params[i].pos;
-        h_state[i].sh1_tbl = params[i].sh1;
-        h_state[i].sh2_tbl = params[i].sh2;
-        h_state[i].mask = params[0].mask;
-        for (int j = 0; j < MTGP_TS; j++) {
-            h_state[i].param_tbl[j] = params[i].tbl[j];
-            h_state[i].temper_tbl[j] = params[i].tmp_tbl[j];
-            h_state[i].single_temper_tbl[j] = params[i].flt_tmp_tbl[j];
-        }
+        rocrand_device::rocrand_mtgp32_init_engine(h_state[i], params, i, (unsigned int)seed + i + 1);
     }
 
     hipMemcpy(d_state, h_state, sizeof(rocrand_state_mtgp32) * n, hipMemcpyHostToDevice);
@@ -503,6 +520,13 @@ rocrand_status rocrand_make_constant(const mtgp32_fast_params params[], mtgp32_p
  * value from [0; 2^32 - 1] range using MTGP32 generator in \p state.
  * State is incremented by one position.
  *
+ * The state is shared by the block, so the function must be called by all
+ * threads of the block. Blocks can have from MTGP_TS (16) to MTGP_TN (256)
+ * threads: each call returns the next <tt>hipBlockDim_x</tt> numbers of
+ * the sequence (one per thread, in order of thread indices), so the sequence
+ * of a state is the same for all block sizes. Smaller blocks (e.g. 64 or 128
+ * threads) allow more states per compute unit when occupancy is limited.
+ *
  * \param state - Pointer to a state to use
  *
  * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
@@ -513,6 +537,26 @@ unsigned int rocrand(rocrand_state_mtgp32 * state)
     return state->next();
 }
 
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using MTGP32 generator in \p state.
+ * State is incremented by four positions. The results are the same as of
+ * four calls of rocrand(), so the function must be called by all threads
+ * of the block.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand4(rocrand_state_mtgp32 * state)
+{
+    return uint4 { state->next(), state->next(), state->next(), state->next() };
+}
+
 /**
  * \brief Copies MTGP32 state to another state using block of threads
  *
@@ -33,9 +33,17 @@
 #include <math.h>
 
 #include "rocrand_philox4x32_10.h"
+#include "rocrand_threefry4x32_20.h"
+#include "rocrand_threefry2x64_20.h"
+#include "rocrand_philox4x64_10.h"
 #include "rocrand_mrg32k3a.h"
 #include "rocrand_xorwow.h"
+#include "rocrand_xoshiro128pp.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_uniform.h"
@@ -61,6 +69,76 @@ float2 box_muller(unsigned int x, unsigned int y)
     return result;
 }
 
+// Box-Muller transform of two 16-bit uniform values (the low and
+// the high 16 bits of v), precise enough for half results
+FQUALIFIERS
+float2 box_muller_half(unsigned int v)
+{
+    float2 result;
+    float u = ROCRAND_2POW16_INV + ((v & 0xffff) * ROCRAND_2POW16_INV);
+    float w = ROCRAND_2POW16_INV_2PI + ((v >> 16) * ROCRAND_2POW16_INV_2PI);
+    float s = sqrtf(-2.0f * logf(u));
+    #ifdef __HIP_DEVICE_COMPILE__
+        __sincosf(w, &result.x, &result.y);
+        result.x *= s;
+        result.y *= s;
+    #else
+        result.x = sinf(w) * s;
+        result.y = cosf(w) * s;
+    #endif
+    return result;
+}
+
+// Box-Muller transform of ROCRAND_MATH_MODE_FAST: __logf instead of logf
+// (absolute error below 2^-21 for u close to 1, so results closer than 1e-3
+// to 0 have an absolute error up to 1e-3, others a relative error below
+// 2^-20), the host uses box_muller()
+FQUALIFIERS
+float2 box_muller_fast(unsigned int x, unsigned int y)
+{
+    #ifdef __HIP_DEVICE_COMPILE__
+        float2 result;
+        float u = ROCRAND_2POW32_INV + (x * ROCRAND_2POW32_INV);
+        float v = ROCRAND_2POW32_INV_2PI + (y * ROCRAND_2POW32_INV_2PI);
+        float s = sqrtf(-2.0f * __logf(u));
+        __sincosf(v, &result.x, &result.y);
+        result.x *= s;
+        result.y *= s;
+        return result;
+    #else
+        return box_muller(x, y);
+    #endif
+}
+
+// The same for 16-bit uniform values (see box_muller_half)
+FQUALIFIERS
+float2 box_muller_half_fast(unsigned int v)
+{
+    #ifdef __HIP_DEVICE_COMPILE__
+        float2 result;
+        float u = ROCRAND_2POW16_INV + ((v & 0xffff) * ROCRAND_2POW16_INV);
+        float w = ROCRAND_2POW16_INV_2PI + ((v >> 16) * ROCRAND_2POW16_INV_2PI);
+        float s = sqrtf(-2.0f * __logf(u));
+        __sincosf(w, &result.x, &result.y);
+        result.x *= s;
+        result.y *= s;
+        return result;
+    #else
+        return box_muller_half(v);
+    #endif
+}
+
+// exp of ROCRAND_MATH_MODE_FAST: __expf (error 2 + 1.16 * |x| ulp)
+FQUALIFIERS
+float exp_fast(float x)
+{
+    #ifdef __HIP_DEVICE_COMPILE__
+        return __expf(x);
+    #else
+        return expf(x);
+    #endif
+}
+
 FQUALIFIERS
 double2 box_muller_double(uint4 v)
 {
@@ -102,6 +180,22 @@ float2 mrg_box_muller(float x, float y)
     return result;
 }
 
+// The same for uniform values of MRG32k3a (see box_muller_fast)
+FQUALIFIERS
+float2 mrg_box_muller_fast(float x, float y)
+{
+    #ifdef __HIP_DEVICE_COMPILE__
+        float2 result;
+        float s = sqrtf(-2.0f * __logf(x));
+        __sincosf(y * ROCRAND_2PI, &result.x, &result.y);
+        result.x *= s;
+        result.y *= s;
+        return result;
+    #else
+        return mrg_box_muller(x, y);
+    #endif
+}
+
 FQUALIFIERS
 double2 mrg_box_muller_double(double x, double y)
 {
@@ -120,14 +214,149 @@ double2 mrg_box_muller_double(double x, double y)
     return result;
 }
 
+// Giles' approximation of erfinv(x) (M. Giles, "Approximating the erfinv
+// function", GPU Computing Gems Jade Edition, 2011), w = -log((1 - x) * (1 + x))
+// is computed by the caller, so it can be computed without cancellation
+// when x is close to 1. The relative error is below 3e-7 for w < 45,
+// the third branch uses the coefficients of the double precision version.
 FQUALIFIERS
-float roc_f_erfinv(float x)
+float erfinv_giles(const float x, float w)
 {
-    float tt1, tt2, lnx, sgn;
-    sgn = (x < 0.0f) ? -1.0f : 1.0f;
+    float p;
+    if(w < 5.0f)
+    {
+        w = w - 2.5f;
+        p = 2.81022636e-08f;
+        p = 3.43273939e-07f + p * w;
+        p = -3.5233877e-06f + p * w;
+        p = -4.39150654e-06f + p * w;
+        p = 0.00021858087f + p * w;
+        p = -0.00125372503f + p * w;
+        p = -0.00417768164f + p * w;
+        p = 0.246640727f + p * w;
+        p = 1.50140941f + p * w;
+    }
+    else if(w < 16.0f)
+    {
+        w = sqrtf(w) - 3.0f;
+        p = -0.000200214257f;
+        p = 0.000100950558f + p * w;
+        p = 0.00134934322f + p * w;
+        p = -0.00367342844f + p * w;
+        p = 0.00573950773f + p * w;
+        p = -0.0076224613f + p * w;
+        p = 0.00943887047f + p * w;
+        p = 1.00167406f + p * w;
+        p = 2.83297682f + p * w;
+    }
+    else
+    {
+        w = sqrtf(w) - 5.0f;
+        p = -2.7109920616438573243e-11f;
+        p = -2.5556418169965252055e-10f + p * w;
+        p = 1.5076572693500548083e-09f + p * w;
+        p = -3.7894654401267369937e-09f + p * w;
+        p = 7.6157012080783393804e-09f + p * w;
+        p = -1.4960026627149240478e-08f + p * w;
+        p = 2.9147953450901080826e-08f + p * w;
+        p = -6.7711997758452339498e-08f + p * w;
+        p = 2.2900482228026654717e-07f + p * w;
+        p = -9.9298272942317002539e-07f + p * w;
+        p = 4.5260625972231537039e-06f + p * w;
+        p = -1.9681778105531670567e-05f + p * w;
+        p = 7.5995277030017761139e-05f + p * w;
+        p = -0.00021503011930044477347f + p * w;
+        p = -0.00013871931833623122026f + p * w;
+        p = 1.0103004648645343977f + p * w;
+        p = 4.8499064014085844221f + p * w;
+    }
+    return p * x;
+}
+
+// The same in double precision, the relative error is below 1e-15 for
+// w < 36.7 (1 - |x| >= 2^-53)
+FQUALIFIERS
+double erfinv_giles(const double x, double w)
+{
+    double p;
+    if(w < 6.25)
+    {
+        w = w - 3.125;
+        p = -3.6444120640178196996e-21;
+        p = -1.685059138182016589e-19 + p * w;
+        p = 1.2858480715256400167e-18 + p * w;
+        p = 1.115787767802518096e-17 + p * w;
+        p = -1.333171662854620906e-16 + p * w;
+        p = 2.0972767875968561637e-17 + p * w;
+        p = 6.6376381343583238325e-15 + p * w;
+        p = -4.0545662729752068639e-14 + p * w;
+        p = -8.1519341976054721522e-14 + p * w;
+        p = 2.6335093153082322977e-12 + p * w;
+        p = -1.2975133253453532498e-11 + p * w;
+        p = -5.4154120542946279317e-11 + p * w;
+        p = 1.051212273321532285e-09 + p * w;
+        p = -4.1126339803469836976e-09 + p * w;
+        p = -2.9070369957882005086e-08 + p * w;
+        p = 4.2347877827932403518e-07 + p * w;
+        p = -1.3654692000834678645e-06 + p * w;
+        p = -1.3882523362786468719e-05 + p * w;
+        p = 0.0001867342080340571352 + p * w;
+        p = -0.00074070253416626697512 + p * w;
+        p = -0.0060336708714301490533 + p * w;
+        p = 0.24015818242558961693 + p * w;
+        p = 1.6536545626831027356 + p * w;
+    }
+    else if(w < 16.0)
+    {
+        w = sqrt(w) - 3.25;
+        p = 2.2137376921775787049e-09;
+        p = 9.0756561938885390979e-08 + p * w;
+        p = -2.7517406297064545428e-07 + p * w;
+        p = 1.8239629214389227755e-08 + p * w;
+        p = 1.5027403968909827627e-06 + p * w;
+        p = -4.013867526981545969e-06 + p * w;
+        p = 2.9234449089955446044e-06 + p * w;
+        p = 1.2475304481671778723e-05 + p * w;
+        p = -4.7318229009055733981e-05 + p * w;
+        p = 6.8284851459573175448e-05 + p * w;
+        p = 2.4031110387097893999e-05 + p * w;
+        p = -0.0003550375203628474796 + p * w;
+        p = 0.00095328937973738049703 + p * w;
+        p = -0.0016882755560235047313 + p * w;
+        p = 0.0024914420961078508066 + p * w;
+        p = -0.0037512085075692412107 + p * w;
+        p = 0.005370914553590063617 + p * w;
+        p = 1.0052589676941592334 + p * w;
+        p = 3.0838856104922207635 + p * w;
+    }
+    else
+    {
+        w = sqrt(w) - 5.0;
+        p = -2.7109920616438573243e-11;
+        p = -2.5556418169965252055e-10 + p * w;
+        p = 1.5076572693500548083e-09 + p * w;
+        p = -3.7894654401267369937e-09 + p * w;
+        p = 7.6157012080783393804e-09 + p * w;
+        p = -1.4960026627149240478e-08 + p * w;
+        p = 2.9147953450901080826e-08 + p * w;
+        p = -6.7711997758452339498e-08 + p * w;
+        p = 2.2900482228026654717e-07 + p * w;
+        p = -9.9298272942317002539e-07 + p * w;
+        p = 4.5260625972231537039e-06 + p * w;
+        p = -1.9681778105531670567e-05 + p * w;
+        p = 7.5995277030017761139e-05 + p * w;
+        p = -0.00021503011930044477347 + p * w;
+        p = -0.00013871931833623122026 + p * w;
+        p = 1.0103004648645343977 + p * w;
+        p = 4.8499064014085844221 + p * w;
+    }
+    return p * x;
+}
 
-    x = (1.0f - x) * (1.0f + x);
-    lnx = logf(x);
+FQUALIFIERS
+float roc_f_erfinv(float x)
+{
+    const float lnx = logf((1.0f - x) * (1.0f + x));
 
     #ifdef __HIP_DEVICE_COMPILE__
     if (isnan(lnx))
@@ -142,20 +371,13 @@ float roc_f_erfinv(float x)
     #endif
         return 0.0f;
 
-    tt1 = 2.0f / (ROCRAND_PI * 0.147f) + 0.5f * lnx;
-    tt2 = 1.0f / (0.147f) * lnx;
-
-    return(sgn * sqrtf(-tt1 + sqrtf(tt1 * tt1 - tt2)));
+    return ::rocrand_device::detail::erfinv_giles(x, -lnx);
 }
 
 FQUALIFIERS
 double roc_d_erfinv(double x)
 {
-    double tt1, tt2, lnx, sgn;
-    sgn = (x < 0.0) ? -1.0 : 1.0;
-
-    x = (1.0 - x) * (1.0 + x);
-    lnx = log(x);
+    const double lnx = log((1.0 - x) * (1.0 + x));
 
     #ifdef __HIP_DEVICE_COMPILE__
     if (isnan(lnx))
@@ -170,18 +392,71 @@ double roc_d_erfinv(double x)
     #endif
         return 0.0;
 
-    tt1 = 2.0 / (ROCRAND_PI_DOUBLE * 0.147) + 0.5 * lnx;
-    tt2 = 1.0 / (0.147) * lnx;
+    return ::rocrand_device::detail::erfinv_giles(x, -lnx);
+}
+
+// Inverse normal CDF of the probability (v + 0.5) / 2^32 (the midpoint of
+// the v-th of 2^32 intervals, so 0 and 1 are never reached and v and ~v give
+// opposite values). The tail is folded to t = min(v, ~v), so both
+// s = 2 * min(p, 1 - p) and |2p - 1| = 1 - s are computed exactly from
+// the integer, without cancellation in either tail.
+FQUALIFIERS
+float normal_inverse_cdf(unsigned int v)
+{
+    const bool upper = v > 0x7fffffffU;
+    const unsigned int t = upper ? ~v : v;
+    const float s = (static_cast<float>(t) + 0.5f) * (2.0f * ROCRAND_2POW32_INV);
+    const float y = (static_cast<float>(0x7fffffffU - t) + 0.5f) * (2.0f * ROCRAND_2POW32_INV);
+    const float z = ROCRAND_SQRT2 * ::rocrand_device::detail::erfinv_giles(y, -logf(s * (2.0f - s)));
+    return upper ? z : -z;
+}
+
+// The same from the 32 high bits of v
+FQUALIFIERS
+float normal_inverse_cdf(unsigned long long v)
+{
+    return ::rocrand_device::detail::normal_inverse_cdf(static_cast<unsigned int>(v >> 32));
+}
+
+FQUALIFIERS
+double normal_inverse_cdf_double(unsigned int v)
+{
+    const bool upper = v > 0x7fffffffU;
+    const unsigned int t = upper ? ~v : v;
+    const double s = (static_cast<double>(t) + 0.5) * (2.0 * ROCRAND_2POW32_INV_DOUBLE);
+    const double y = (static_cast<double>(0x7fffffffU - t) + 0.5) * (2.0 * ROCRAND_2POW32_INV_DOUBLE);
+    const double z = ROCRAND_SQRT2_DOUBLE * ::rocrand_device::detail::erfinv_giles(y, -log(s * (2.0 - s)));
+    return upper ? z : -z;
+}
+
+// Inverse normal CDF of the probability (v + 0.5) / 2^53 where v is
+// the 53 high bits of the number
+FQUALIFIERS
+double normal_inverse_cdf_double(unsigned long long v)
+{
+    v >>= 11;
+    const bool upper = v > 0xfffffffffffffULL;
+    const unsigned long long t = upper ? (0x1fffffffffffffULL - v) : v;
+    const double s = (static_cast<double>(t) + 0.5) * (2.0 * ROCRAND_2POW53_INV_DOUBLE);
+    const double y = (static_cast<double>(0xfffffffffffffULL - t) + 0.5) * (2.0 * ROCRAND_2POW53_INV_DOUBLE);
+    const double z = ROCRAND_SQRT2_DOUBLE * ::rocrand_device::detail::erfinv_giles(y, -log(s * (2.0 - s)));
+    return upper ? z : -z;
+}
 
-    return(sgn * sqrt(-tt1 + sqrt(tt1 * tt1 - tt2)));
+// The same from two 32-bit numbers (53 bits of them are used as by
+// uniform_distribution_double(v1, v2))
+FQUALIFIERS
+double normal_inverse_cdf_double(unsigned int v1, unsigned int v2)
+{
+    return ::rocrand_device::detail::normal_inverse_cdf_double(
+        (static_cast<unsigned long long>(v2) << 32) | v1
+    );
 }
 
 FQUALIFIERS
 float normal_distribution(unsigned int x)
 {
-    float p = ::rocrand_device::detail::uniform_distribution(x);
-    float v = ROCRAND_SQRT2 * ::rocrand_device::detail::roc_f_erfinv(2.0f * p - 1.0f);
-    return v;
+    return ::rocrand_device::detail::normal_inverse_cdf(x);
 }
 
 FQUALIFIERS
@@ -206,9 +481,19 @@ float4 normal_distribution4(uint4 v)
 FQUALIFIERS
 double normal_distribution_double(unsigned int x)
 {
-    double p = ::rocrand_device::detail::uniform_distribution_double(x);
-    double v = ROCRAND_SQRT2 * ::rocrand_device::detail::roc_d_erfinv(2.0 * p - 1.0);
-    return v;
+    return ::rocrand_device::detail::normal_inverse_cdf_double(x);
+}
+
+FQUALIFIERS
+float normal_distribution(unsigned long long x)
+{
+    return ::rocrand_device::detail::normal_inverse_cdf(x);
+}
+
+FQUALIFIERS
+double normal_distribution_double(unsigned long long x)
+{
+    return ::rocrand_device::detail::normal_inverse_cdf_double(x);
 }
 
 FQUALIFIERS
@@ -225,6 +510,27 @@ float2 mrg_normal_distribution2(unsigned int v1, unsigned int v2)
     return ::rocrand_device::detail::mrg_box_muller(x, y);
 }
 
+FQUALIFIERS
+float2 mrg_normal_distribution2_fast(unsigned int v1, unsigned int v2)
+{
+    float x = rocrand_device::detail::mrg_uniform_distribution(v1);
+    float y = rocrand_device::detail::mrg_uniform_distribution(v2);
+    return ::rocrand_device::detail::mrg_box_muller_fast(x, y);
+}
+
+FQUALIFIERS
+float4 mrg_normal_distribution4(uint4 v)
+{
+    float2 r1 = ::rocrand_device::detail::mrg_normal_distribution2(v.x, v.y);
+    float2 r2 = ::rocrand_device::detail::mrg_normal_distribution2(v.z, v.w);
+    return float4{
+        r1.x,
+        r1.y,
+        r2.x,
+        r2.y
+    };
+}
+
 FQUALIFIERS
 double2 mrg_normal_distribution_double2(unsigned int v1, unsigned int v2)
 {
@@ -286,6 +592,19 @@ float2 rocrand_normal2(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
 }
 
+/**
+ * \brief Same as rocrand_normal2() for a compact Philox \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_philox4x32_10_compact * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
 /**
  * \brief Returns four normally distributed \p float values.
  *
@@ -306,6 +625,19 @@ float4 rocrand_normal4(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::normal_distribution4(rocrand4(state));
 }
 
+/**
+ * \brief Same as rocrand_normal4() for a compact Philox \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float values as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_philox4x32_10_compact * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand4(state));
+}
+
 /**
  * \brief Returns a normally distributed \p double value.
  *
@@ -356,6 +688,19 @@ double2 rocrand_normal_double2(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
 }
 
+/**
+ * \brief Same as rocrand_normal_double2() for a compact Philox \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_philox4x32_10_compact * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+}
+
 /**
  * \brief Returns four normally distributed \p double values.
  *
@@ -384,7 +729,7 @@ double4 rocrand_normal_double4(rocrand_state_philox4x32_10 * state)
 /**
  * \brief Returns a normally distributed \p float value.
  *
- * Generates and returns a normally distributed \p float value using MRG32k3a
+ * Generates and returns a normally distributed \p float value using Threefry4x32-20
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
@@ -395,26 +740,26 @@ double4 rocrand_normal_double4(rocrand_state_philox4x32_10 * state)
  *
  * \return Normally distributed \p float value
  */
-#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS
-float rocrand_normal(rocrand_state_mrg32k3a * state)
+float rocrand_normal(rocrand_state_threefry4x32_20 * state)
 {
-    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg32k3a> bm_helper;
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x32_20> bm_helper;
 
     if(bm_helper::has_float(state))
     {
         return bm_helper::get_float(state);
     }
-    float2 r = rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
     bm_helper::save_float(state, r.y);
     return r.x;
 }
-#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p float values.
  *
- * Generates and returns two normally distributed \p float values using MRG32k3a
+ * Generates and returns two normally distributed \p float values using Threefry4x32-20
  * generator in \p state, and increments position of the generator by two.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
@@ -426,16 +771,36 @@ float rocrand_normal(rocrand_state_mrg32k3a * state)
  * \return Two normally distributed \p float value as \p float2
  */
 FQUALIFIERS
-float2 rocrand_normal2(rocrand_state_mrg32k3a * state)
+float2 rocrand_normal2(rocrand_state_threefry4x32_20 * state)
 {
-    return rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using Threefry4x32-20
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_threefry4x32_20 * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand4(state));
 }
 
 /**
  * \brief Returns a normally distributed \p double value.
  *
- * Generates and returns a normally distributed \p double value using MRG32k3a
- * generator in \p state, and increments position of the generator by one.
+ * Generates and returns a normally distributed \p double value using Threefry4x32-20
+ * generator in \p state, and increments position of the generator by two.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
  * The function uses the Box-Muller transform method to generate two normally distributed
@@ -445,27 +810,27 @@ float2 rocrand_normal2(rocrand_state_mrg32k3a * state)
  *
  * \return Normally distributed \p double value
  */
-#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS
-double rocrand_normal_double(rocrand_state_mrg32k3a * state)
+double rocrand_normal_double(rocrand_state_threefry4x32_20 * state)
 {
-    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg32k3a> bm_helper;
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x32_20> bm_helper;
 
     if(bm_helper::has_double(state))
     {
         return bm_helper::get_double(state);
     }
-    double2 r = rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
     bm_helper::save_double(state, r.y);
     return r.x;
 }
-#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p double values.
  *
- * Generates and returns two normally distributed \p double values using MRG32k3a
- * generator in \p state, and increments position of the generator by two.
+ * Generates and returns two normally distributed \p double values using Threefry4x32-20
+ * generator in \p state, and increments position of the generator by four.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
  * The function uses the Box-Muller transform method to generate two normally
@@ -473,18 +838,43 @@ double rocrand_normal_double(rocrand_state_mrg32k3a * state)
  *
  * \param state - Pointer to a state to use
  *
- * \return Two normally distributed \p double value as \p double2
+ * \return Two normally distributed \p double values as \p double2
  */
 FQUALIFIERS
-double2 rocrand_normal_double2(rocrand_state_mrg32k3a * state)
+double2 rocrand_normal_double2(rocrand_state_threefry4x32_20 * state)
 {
-    return rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p double values.
+ *
+ * Generates and returns four normally distributed \p double values using Threefry4x32-20
+ * generator in \p state, and increments position of the generator by eight.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_normal_double4(rocrand_state_threefry4x32_20 * state)
+{
+    double2 r1, r2;
+    r1 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    r2 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
 }
 
 /**
  * \brief Returns a normally distributed \p float value.
  *
- * Generates and returns a normally distributed \p float value using XORWOW
+ * Generates and returns a normally distributed \p float value using Threefry2x64-20
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
@@ -495,11 +885,11 @@ double2 rocrand_normal_double2(rocrand_state_mrg32k3a * state)
  *
  * \return Normally distributed \p float value
  */
-#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS
-float rocrand_normal(rocrand_state_xorwow * state)
+float rocrand_normal(rocrand_state_threefry2x64_20 * state)
 {
-    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xorwow> bm_helper;
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x64_20> bm_helper;
 
     if(bm_helper::has_float(state))
     {
@@ -509,12 +899,12 @@ float rocrand_normal(rocrand_state_xorwow * state)
     bm_helper::save_float(state, r.y);
     return r.x;
 }
-#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p float values.
  *
- * Generates and returns two normally distributed \p float values using XORWOW
+ * Generates and returns two normally distributed \p float values using Threefry2x64-20
  * generator in \p state, and increments position of the generator by two.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
@@ -523,18 +913,38 @@ float rocrand_normal(rocrand_state_xorwow * state)
  *
  * \param state - Pointer to a state to use
  *
- * \return Two normally distributed \p float values as \p float2
+ * \return Two normally distributed \p float value as \p float2
  */
 FQUALIFIERS
-float2 rocrand_normal2(rocrand_state_xorwow * state)
+float2 rocrand_normal2(rocrand_state_threefry2x64_20 * state)
 {
     return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
 }
 
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using Threefry2x64-20
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand4(state));
+}
+
 /**
  * \brief Returns a normally distributed \p double value.
  *
- * Generates and returns a normally distributed \p double value using XORWOW
+ * Generates and returns a normally distributed \p double value using Threefry2x64-20
  * generator in \p state, and increments position of the generator by two.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
@@ -545,28 +955,26 @@ float2 rocrand_normal2(rocrand_state_xorwow * state)
  *
  * \return Normally distributed \p double value
  */
-#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS
-double rocrand_normal_double(rocrand_state_xorwow * state)
+double rocrand_normal_double(rocrand_state_threefry2x64_20 * state)
 {
-    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xorwow> bm_helper;
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x64_20> bm_helper;
 
     if(bm_helper::has_double(state))
     {
         return bm_helper::get_double(state);
     }
-    double2 r = rocrand_device::detail::normal_distribution_double2(
-        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
-    );
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
     bm_helper::save_double(state, r.y);
     return r.x;
 }
-#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p double values.
  *
- * Generates and returns two normally distributed \p double values using XORWOW
+ * Generates and returns two normally distributed \p double values using Threefry2x64-20
  * generator in \p state, and increments position of the generator by four.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
@@ -575,12 +983,743 @@ double rocrand_normal_double(rocrand_state_xorwow * state)
  *
  * \param state - Pointer to a state to use
  *
- * \return Two normally distributed \p double value as \p double2
+ * \return Two normally distributed \p double values as \p double2
  */
 FQUALIFIERS
-double2 rocrand_normal_double2(rocrand_state_xorwow * state)
+double2 rocrand_normal_double2(rocrand_state_threefry2x64_20 * state)
 {
-    return rocrand_device::detail::normal_distribution_double2(
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p double values.
+ *
+ * Generates and returns four normally distributed \p double values using Threefry2x64-20
+ * generator in \p state, and increments position of the generator by eight.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_normal_double4(rocrand_state_threefry2x64_20 * state)
+{
+    double2 r1, r2;
+    r1 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    r2 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using Philox4x64-10
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_normal(rocrand_state_philox4x64_10 * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x64_10> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using Philox4x64-10
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_philox4x64_10 * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using Philox4x64-10
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_philox4x64_10 * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand4(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using Philox4x64-10
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_philox4x64_10 * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x64_10> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using Philox4x64-10
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_philox4x64_10 * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p double values.
+ *
+ * Generates and returns four normally distributed \p double values using Philox4x64-10
+ * generator in \p state, and increments position of the generator by eight.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_normal_double4(rocrand_state_philox4x64_10 * state)
+{
+    double2 r1, r2;
+    r1 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    r2 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using xoshiro128++
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The value is computed from one number by the inverse of the normal CDF,
+ * so no values are cached in the state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using xoshiro128++
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using xoshiro128++
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand4(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using xoshiro128++
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The value is computed from one number by the inverse of the normal CDF,
+ * so no values are cached in the state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using xoshiro128++
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using PCG32
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The value is computed from one number by the inverse of the normal CDF,
+ * so no values are cached in the state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using PCG32
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using PCG32
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand4(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using PCG32
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The value is computed from one number by the inverse of the normal CDF,
+ * so no values are cached in the state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using PCG32
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p float values for a Philox
+ * counter and key, without state.
+ *
+ * Returns normally distributed values (mean 0.0f, standard deviation 1.0f)
+ * computed with the Box-Muller transform from the first two numbers of
+ * rocrand_philox4x32_10_hash(), the same values as rocrand_normal2()
+ * of the corresponding state.
+ *
+ * \param counter - Counter (see rocrand_philox4x32_10_counter())
+ * \param key - Key (see rocrand_philox4x32_10_key())
+ *
+ * \return Two normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2_at(const uint4 counter, const uint2 key)
+{
+    const uint4 v = rocrand_philox4x32_10_hash(counter, key);
+    return rocrand_device::detail::normal_distribution2(v.x, v.y);
+}
+
+/**
+ * \brief Returns four normally distributed \p float values for a Philox
+ * counter and key, without state.
+ *
+ * Returns normally distributed values (mean 0.0f, standard deviation 1.0f)
+ * computed with the Box-Muller transform from the numbers of
+ * rocrand_philox4x32_10_hash(), the same values as rocrand_normal4()
+ * of the corresponding state.
+ *
+ * \param counter - Counter (see rocrand_philox4x32_10_counter())
+ * \param key - Key (see rocrand_philox4x32_10_key())
+ *
+ * \return Four normally distributed \p float values as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4_at(const uint4 counter, const uint2 key)
+{
+    return rocrand_device::detail::normal_distribution4(
+        rocrand_philox4x32_10_hash(counter, key)
+    );
+}
+
+/**
+ * \brief Returns two normally distributed \p double values for a Philox
+ * counter and key, without state.
+ *
+ * Returns normally distributed values (mean 0.0, standard deviation 1.0)
+ * computed with the Box-Muller transform from the numbers of
+ * rocrand_philox4x32_10_hash(), the same values as rocrand_normal_double2()
+ * of the corresponding state.
+ *
+ * \param counter - Counter (see rocrand_philox4x32_10_counter())
+ * \param key - Key (see rocrand_philox4x32_10_key())
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2_at(const uint4 counter, const uint2 key)
+{
+    return rocrand_device::detail::normal_distribution_double2(
+        rocrand_philox4x32_10_hash(counter, key)
+    );
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using MRG32k3a
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_normal(rocrand_state_mrg32k3a * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg32k3a> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+    float2 r = rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using MRG32k3a
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Same as rocrand_normal2() for a compact MRG32K3A \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_mrg32k3a_compact * state)
+{
+    return rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using MRG32k3a
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, the same values as two calls of rocrand_normal2().
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float values as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::mrg_normal_distribution4(rocrand4(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using MRG32k3a
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_mrg32k3a * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg32k3a> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+    double2 r = rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using MRG32k3a
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Same as rocrand_normal_double2() for a compact MRG32K3A \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_mrg32k3a_compact * state)
+{
+    return rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using XORWOW
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_normal(rocrand_state_xorwow * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xorwow> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using XORWOW
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Same as rocrand_normal2() for a compact XORWOW \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using XORWOW
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, the same values as two calls of rocrand_normal2().
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float values as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand4(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using XORWOW
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_xorwow * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xorwow> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
+    );
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using XORWOW
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(
+        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
+    );
+}
+
+/**
+ * \brief Same as rocrand_normal_double2() for a compact XORWOW \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(
         uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
     );
 }
@@ -603,6 +1742,32 @@ float rocrand_normal(rocrand_state_mtgp32 * state)
     return rocrand_device::detail::normal_distribution(rocrand(state));
 }
 
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using MTGP32
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The values are the same as of four calls of rocrand_normal(), the function
+ * must be called by all threads of the block.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float values as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_mtgp32 * state)
+{
+    const uint4 v = rocrand4(state);
+    return float4 {
+        rocrand_device::detail::normal_distribution(v.x),
+        rocrand_device::detail::normal_distribution(v.y),
+        rocrand_device::detail::normal_distribution(v.z),
+        rocrand_device::detail::normal_distribution(v.w)
+    };
+}
+
 /**
  * \brief Returns a normally distributed \p double value.
  *
@@ -657,6 +1822,194 @@ double rocrand_normal_double(rocrand_state_sobol32 * state)
     return rocrand_device::detail::normal_distribution_double(rocrand(state));
 }
 
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using SCRAMBLED_SOBOL32
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal(rocrand_state_scrambled_sobol32 * state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using SCRAMBLED_SOBOL32
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_scrambled_sobol32 * state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal(rocrand_state_sobol64 * state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_sobol64 * state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using SCRAMBLED_SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal(rocrand_state_scrambled_sobol64 * state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using SCRAMBLED_SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_scrambled_sobol64 * state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p __half values.
+ *
+ * Generates and returns two normally distributed \p __half values using Philox
+ * generator in \p state, and increments position of the generator by one.
+ * The values are computed by the Box-Muller transform of two 16-bit uniform
+ * values of one <tt>unsigned int</tt> value. Used normal distribution has mean
+ * value equal to 0.0, and standard deviation equal to 1.0.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p __half values as \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_normal_half2(rocrand_state_philox4x32_10 * state)
+{
+    float2 r = rocrand_device::detail::box_muller_half(rocrand(state));
+    return __floats2half2_rn(r.x, r.y);
+}
+
+/**
+ * \brief Returns two normally distributed \p __half values.
+ *
+ * Generates and returns two normally distributed \p __half values using MRG32K3A
+ * generator in \p state, and increments position of the generator by one.
+ * The values are computed by the Box-Muller transform of two 16-bit uniform
+ * values of one <tt>unsigned int</tt> value. Used normal distribution has mean
+ * value equal to 0.0, and standard deviation equal to 1.0.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p __half values as \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_normal_half2(rocrand_state_mrg32k3a * state)
+{
+    float2 r = rocrand_device::detail::box_muller_half(rocrand(state));
+    return __floats2half2_rn(r.x, r.y);
+}
+
+/**
+ * \brief Returns two normally distributed \p __half values.
+ *
+ * Generates and returns two normally distributed \p __half values using XORWOW
+ * generator in \p state, and increments position of the generator by one.
+ * The values are computed by the Box-Muller transform of two 16-bit uniform
+ * values of one <tt>unsigned int</tt> value. Used normal distribution has mean
+ * value equal to 0.0, and standard deviation equal to 1.0.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p __half values as \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_normal_half2(rocrand_state_xorwow * state)
+{
+    float2 r = rocrand_device::detail::box_muller_half(rocrand(state));
+    return __floats2half2_rn(r.x, r.y);
+}
+
+/**
+ * \brief Returns two normally distributed \p __half values.
+ *
+ * Generates and returns two normally distributed \p __half values using MTGP32
+ * generator in \p state, and increments position of the generator by one.
+ * The values are computed by the Box-Muller transform of two 16-bit uniform
+ * values of one <tt>unsigned int</tt> value. Used normal distribution has mean
+ * value equal to 0.0, and standard deviation equal to 1.0.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p __half values as \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_normal_half2(rocrand_state_mtgp32 * state)
+{
+    float2 r = rocrand_device::detail::box_muller_half(rocrand(state));
+    return __floats2half2_rn(r.x, r.y);
+}
+
 #endif // ROCRAND_NORMAL_H_
 
 /** @} */ // end of group rocranddevice
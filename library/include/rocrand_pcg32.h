@@ -0,0 +1,273 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_PCG32_H_
+#define ROCRAND_PCG32_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand_common.h"
+
+#define ROCRAND_PCG32_MULTIPLIER 6364136223846793005ULL
+
+// M. E. O'Neill, PCG: A Family of Simple Fast Space-Efficient Statistically
+// Good Algorithms for Random Number Generation, 2014
+// https://www.pcg-random.org/download.html (pcg32_random_r, XSH RR)
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+ /**
+ * \def ROCRAND_PCG32_DEFAULT_SEED
+ * \brief Default seed for PCG32 PRNG.
+ */
+ #define ROCRAND_PCG32_DEFAULT_SEED 0ULL
+ /** @} */ // end of group rocranddevice
+
+namespace rocrand_device {
+
+class pcg32_engine
+{
+public:
+    struct pcg32_state
+    {
+        // 64-bit LCG state
+        unsigned long long state;
+        // Odd increment of the LCG, selects the stream (subsequence).
+        // Normal values are not cached, so the state is 2 64-bit values.
+        unsigned long long increment;
+    };
+
+    FQUALIFIERS
+    pcg32_engine() : pcg32_engine(ROCRAND_PCG32_DEFAULT_SEED, 0, 0) { }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// Subsequences are streams of the LCG (different increments), each
+    /// is 2^64 numbers long. The results are the same as of pcg32_srandom_r()
+    /// with initstate \p seed and initseq \p subsequence.
+    FQUALIFIERS
+    pcg32_engine(const unsigned long long seed,
+                 const unsigned long long subsequence,
+                 const unsigned long long offset)
+    {
+        m_state.state = 0;
+        m_state.increment = (subsequence << 1) | 1;
+        step();
+        m_state.state += seed;
+        step();
+
+        discard(offset);
+    }
+
+    FQUALIFIERS
+    explicit pcg32_engine(detail::uninitialized_tag) { }
+
+    /// Advances the internal state to skip \p offset numbers,
+    /// in O(log(offset)) steps.
+    FQUALIFIERS
+    void discard(unsigned long long offset)
+    {
+        // F. Brown, Random Number Generation with Arbitrary Stride, 1994:
+        // offset steps of x -> a * x + c are x -> A * x + C, A and C are
+        // accumulated by squaring
+        unsigned long long a = ROCRAND_PCG32_MULTIPLIER;
+        unsigned long long c = m_state.increment;
+        unsigned long long acc_a = 1;
+        unsigned long long acc_c = 0;
+        while(offset > 0)
+        {
+            if(offset & 1)
+            {
+                acc_a *= a;
+                acc_c = acc_c * a + c;
+            }
+            c = (a + 1) * c;
+            a *= a;
+            offset >>= 1;
+        }
+        m_state.state = acc_a * m_state.state + acc_c;
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences:
+    /// the stream is switched, the position in it is kept.
+    FQUALIFIERS
+    void discard_subsequence(unsigned long long subsequence)
+    {
+        m_state.increment += subsequence << 1;
+    }
+
+    FQUALIFIERS
+    unsigned int operator()()
+    {
+        return next();
+    }
+
+    FQUALIFIERS
+    unsigned int next()
+    {
+        const unsigned long long old_state = m_state.state;
+        step();
+        const unsigned int xorshifted =
+            static_cast<unsigned int>(((old_state >> 18) ^ old_state) >> 27);
+        const unsigned int rot = static_cast<unsigned int>(old_state >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+    }
+
+protected:
+
+    FQUALIFIERS
+    void step()
+    {
+        m_state.state = m_state.state * ROCRAND_PCG32_MULTIPLIER + m_state.increment;
+    }
+
+protected:
+    // State
+    pcg32_state m_state;
+
+}; // pcg32_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::pcg32_engine rocrand_state_pcg32;
+/// \endcond
+
+/**
+ * \brief Initialize PCG32 state.
+ *
+ * Initializes the PCG32 generator \p state with the given
+ * \p seed, \p subsequence, and \p offset. The state is two 64-bit
+ * values and initialization takes O(log(offset)) steps, so it fits
+ * kernels which run out of registers with larger states.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence (stream of the LCG) to use
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_pcg32 * state)
+{
+    *state = rocrand_state_pcg32(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using PCG32 generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_pcg32 * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using PCG32 generator in \p state.
+ * State is incremented by four positions. The results are the same as of
+ * four calls of rocrand(), but the state is loaded and stored once.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand4(rocrand_state_pcg32 * state)
+{
+    rocrand_state_pcg32 local = *state;
+    const uint4 result = uint4 { local.next(), local.next(), local.next(), local.next() };
+    *state = local;
+    return result;
+}
+
+/**
+ * \brief Updates PCG32 state to skip ahead by \p offset elements.
+ *
+ * Updates the PCG32 state in \p state to skip ahead by \p offset elements
+ * in O(log(offset)) steps.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_pcg32 * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates PCG32 state to skip ahead by \p subsequence subsequences.
+ *
+ * Switches the PCG32 \p state \p subsequence streams ahead, the position
+ * in the stream is kept. Each subsequence (stream) is 2^64 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_pcg32 * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates PCG32 state to skip ahead by \p sequence sequences.
+ *
+ * Updates the PCG32 \p state skipping \p sequence sequences ahead.
+ * For PCG32 a sequence is a stream of the LCG (equal to a subsequence).
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_sequence(unsigned long long sequence, rocrand_state_pcg32 * state)
+{
+    return state->discard_subsequence(sequence);
+}
+
+#endif // ROCRAND_PCG32_H_
+
+/** @} */ // end of group rocranddevice
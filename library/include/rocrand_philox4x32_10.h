@@ -83,41 +83,107 @@ namespace detail {
 FQUALIFIERS
 unsigned int mulhilo32(unsigned int x, unsigned int y, unsigned int& z)
 {
-    unsigned long long xy = mad_u64_u32(x, y, 0);
-    z = static_cast<unsigned int>(xy >> 32);
-    return static_cast<unsigned int>(xy);
+    return mul_hilo_u32(x, y, z);
 }
 
-} // end detail namespace
+// Single Philox4x32 round
+FQUALIFIERS
+uint4 philox4x32_10_single_round(uint4 counter, uint2 key)
+{
+    // Source: Random123
+    unsigned int hi0;
+    unsigned int hi1;
+    unsigned int lo0 = mulhilo32(ROCRAND_PHILOX_M4x32_0, counter.x, hi0);
+    unsigned int lo1 = mulhilo32(ROCRAND_PHILOX_M4x32_1, counter.z, hi1);
+    return uint4 {
+        hi1 ^ counter.y ^ key.x,
+        lo1,
+        hi0 ^ counter.w ^ key.y,
+        lo0
+    };
+}
 
-class philox4x32_10_engine
+FQUALIFIERS
+uint2 philox4x32_10_bumpkey(uint2 key)
 {
-public:
-    struct philox4x32_10_state
-    {
-        uint4 counter;
-        uint4 result;
-        uint2 key;
-        unsigned int substate;
+    key.x += ROCRAND_PHILOX_W32_0;
+    key.y += ROCRAND_PHILOX_W32_1;
+    return key;
+}
+
+// 10 Philox4x32 rounds, computes 4 random numbers for given
+// counter and key without any state
+FQUALIFIERS
+uint4 philox4x32_10_ten_rounds(uint4 counter, uint2 key)
+{
+    counter = philox4x32_10_single_round(counter, key); key = philox4x32_10_bumpkey(key); // 1
+    counter = philox4x32_10_single_round(counter, key); key = philox4x32_10_bumpkey(key); // 2
+    counter = philox4x32_10_single_round(counter, key); key = philox4x32_10_bumpkey(key); // 3
+    counter = philox4x32_10_single_round(counter, key); key = philox4x32_10_bumpkey(key); // 4
+    counter = philox4x32_10_single_round(counter, key); key = philox4x32_10_bumpkey(key); // 5
+    counter = philox4x32_10_single_round(counter, key); key = philox4x32_10_bumpkey(key); // 6
+    counter = philox4x32_10_single_round(counter, key); key = philox4x32_10_bumpkey(key); // 7
+    counter = philox4x32_10_single_round(counter, key); key = philox4x32_10_bumpkey(key); // 8
+    counter = philox4x32_10_single_round(counter, key); key = philox4x32_10_bumpkey(key); // 9
+    return philox4x32_10_single_round(counter, key);                                      // 10
+}
+
+// State of philox4x32_10_engine
+struct philox4x32_10_state
+{
+    uint4 counter;
+    uint4 result;
+    uint2 key;
+    unsigned int substate;
 
+    #ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+    // The Box–Muller transform requires two inputs to convert uniformly
+    // distributed real values [0; 1] to normally distributed real values
+    // (with mean = 0, and stddev = 1). Often user wants only one
+    // normally distributed number, to save performance and random
+    // numbers the 2nd value is saved for future requests.
+    unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+    unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+    float boxmuller_float; // normally distributed float
+    double boxmuller_double; // normally distributed double
+    #endif
+
+    FQUALIFIERS
+    void reset_boxmuller()
+    {
         #ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
-        // The Box–Muller transform requires two inputs to convert uniformly
-        // distributed real values [0; 1] to normally distributed real values
-        // (with mean = 0, and stddev = 1). Often user wants only one
-        // normally distributed number, to save performance and random
-        // numbers the 2nd value is saved for future requests.
-        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
-        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
-        float boxmuller_float; // normally distributed float
-        double boxmuller_double; // normally distributed double
+        boxmuller_float_state = 0;
+        boxmuller_double_state = 0;
         #endif
+    }
 
-        FQUALIFIERS
-        ~philox4x32_10_state() { }
-    };
+    FQUALIFIERS
+    ~philox4x32_10_state() { }
+};
+
+// State of philox4x32_10_compact_engine, without the Box-Muller cache
+struct philox4x32_10_compact_state
+{
+    uint4 counter;
+    uint4 result;
+    uint2 key;
+    unsigned int substate;
 
     FQUALIFIERS
-    philox4x32_10_engine()
+    void reset_boxmuller() { }
+
+    FQUALIFIERS
+    ~philox4x32_10_compact_state() { }
+};
+
+// Sequence of philox4x32_10_engine and philox4x32_10_compact_engine, which
+// differ only in the State (with or without the Box-Muller cache)
+template<class State>
+class philox4x32_10_engine_base
+{
+public:
+    FQUALIFIERS
+    philox4x32_10_engine_base()
     {
         this->seed(ROCRAND_PHILOX4x32_DEFAULT_SEED, 0, 0);
     }
@@ -128,16 +194,13 @@ public:
     ///
     /// A subsequence is 4 * 2^64 numbers long.
     FQUALIFIERS
-    philox4x32_10_engine(const unsigned long long seed,
-                         const unsigned long long subsequence,
-                         const unsigned long long offset)
+    philox4x32_10_engine_base(const unsigned long long seed,
+                              const unsigned long long subsequence,
+                              const unsigned long long offset)
     {
         this->seed(seed, subsequence, offset);
     }
 
-    FQUALIFIERS
-    ~philox4x32_10_engine() { }
-
     /// Reinitializes the internal state of the PRNG using new
     /// seed value \p seed_value, skips \p subsequence subsequences
     /// and \p offset random numbers.
@@ -177,10 +240,7 @@ public:
         m_state.counter = {0, 0, 0, 0};
         m_state.result  = {0, 0, 0, 0};
         m_state.substate = 0;
-        #ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
-        m_state.boxmuller_float_state = 0;
-        m_state.boxmuller_double_state = 0;
-        #endif
+        m_state.reset_boxmuller();
         this->discard_subsequence_impl(subsequence);
         this->discard_impl(offset);
         m_state.result = this->ten_rounds(m_state.counter, m_state.key);
@@ -288,54 +348,72 @@ protected:
     FQUALIFIERS
     uint4 ten_rounds(uint4 counter, uint2 key)
     {
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 1
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 2
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 3
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 4
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 5
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 6
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 7
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 8
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 9
-        return this->single_round(counter, key);                        // 10
+        return detail::philox4x32_10_ten_rounds(counter, key);
     }
 
-private:
-    // Single Philox4x32 round
+protected:
+    // State
+    State m_state;
+}; // philox4x32_10_engine_base class
+
+} // end detail namespace
+
+class philox4x32_10_engine : public detail::philox4x32_10_engine_base<detail::philox4x32_10_state>
+{
+public:
+    typedef detail::philox4x32_10_state philox4x32_10_state;
+
     FQUALIFIERS
-    uint4 single_round(uint4 counter, uint2 key)
-    {
-        // Source: Random123
-        unsigned int hi0;
-        unsigned int hi1;
-        unsigned int lo0 = detail::mulhilo32(ROCRAND_PHILOX_M4x32_0, counter.x, hi0);
-        unsigned int lo1 = detail::mulhilo32(ROCRAND_PHILOX_M4x32_1, counter.z, hi1);
-        return uint4 {
-            hi1 ^ counter.y ^ key.x,
-            lo1,
-            hi0 ^ counter.w ^ key.y,
-            lo0
-        };
-    }
+    philox4x32_10_engine() { }
 
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
     FQUALIFIERS
-    uint2 bumpkey(uint2 key)
-    {
-        key.x += ROCRAND_PHILOX_W32_0;
-        key.y += ROCRAND_PHILOX_W32_1;
-        return key;
-    }
+    philox4x32_10_engine(const unsigned long long seed,
+                         const unsigned long long subsequence,
+                         const unsigned long long offset)
+        : detail::philox4x32_10_engine_base<detail::philox4x32_10_state>(seed, subsequence, offset) { }
 
-protected:
-    // State
-    philox4x32_10_state m_state;
+    FQUALIFIERS
+    explicit philox4x32_10_engine(detail::uninitialized_tag) { }
 
+    FQUALIFIERS
+    ~philox4x32_10_engine() { }
+
+protected:
     #ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
     friend struct detail::engine_boxmuller_helper<philox4x32_10_engine>;
     #endif
 
 }; // philox4x32_10_engine class
 
+/// Philox engine with the same sequences as philox4x32_10_engine but without
+/// the cached second value of the Box-Muller transform, so the state is
+/// 48 instead of 64 bytes. Normal values are generated in pairs.
+class philox4x32_10_compact_engine : public detail::philox4x32_10_engine_base<detail::philox4x32_10_compact_state>
+{
+public:
+    typedef detail::philox4x32_10_compact_state philox4x32_10_state;
+
+    FQUALIFIERS
+    philox4x32_10_compact_engine() { }
+
+    /// Initializes the internal state of the PRNG, see philox4x32_10_engine.
+    FQUALIFIERS
+    philox4x32_10_compact_engine(const unsigned long long seed,
+                                 const unsigned long long subsequence,
+                                 const unsigned long long offset)
+        : detail::philox4x32_10_engine_base<detail::philox4x32_10_compact_state>(seed, subsequence, offset) { }
+
+    FQUALIFIERS
+    explicit philox4x32_10_compact_engine(detail::uninitialized_tag) { }
+
+    FQUALIFIERS
+    ~philox4x32_10_compact_engine() { }
+
+}; // philox4x32_10_compact_engine class
+
 } // end namespace rocrand_device
 
 /** \rocrand_internal \addtogroup rocranddevice
@@ -345,6 +423,7 @@ protected:
 
 /// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
 typedef rocrand_device::philox4x32_10_engine rocrand_state_philox4x32_10;
+typedef rocrand_device::philox4x32_10_compact_engine rocrand_state_philox4x32_10_compact;
 /// \endcond
 
 /**
@@ -403,6 +482,75 @@ uint4 rocrand4(rocrand_state_philox4x32_10 * state)
     return state->next4();
 }
 
+/**
+ * \brief Returns the Philox key of a seed.
+ *
+ * Returns the key used by rocrand_philox4x32_10_hash() for \p seed, it is the
+ * key of states initialized by rocrand_init() with \p seed.
+ *
+ * \param seed - Value to use as a seed
+ *
+ * \return Key as an <tt>uint2</tt>
+ */
+FQUALIFIERS
+uint2 rocrand_philox4x32_10_key(const unsigned long long seed)
+{
+    return uint2 {
+        static_cast<unsigned int>(seed),
+        static_cast<unsigned int>(seed >> 32)
+    };
+}
+
+/**
+ * \brief Returns the Philox counter of a group of four numbers.
+ *
+ * Returns the counter used by rocrand_philox4x32_10_hash() for the \p index -th
+ * group of four numbers of \p subsequence, i.e. numbers at offsets
+ * <tt>[4 * index, 4 * index + 4)</tt> of the subsequence.
+ *
+ * \param subsequence - Subsequence of the numbers
+ * \param index - Index of the group of four numbers in the subsequence
+ *
+ * \return Counter as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand_philox4x32_10_counter(const unsigned long long subsequence,
+                                    const unsigned long long index)
+{
+    return uint4 {
+        static_cast<unsigned int>(index),
+        static_cast<unsigned int>(index >> 32),
+        static_cast<unsigned int>(subsequence),
+        static_cast<unsigned int>(subsequence >> 32)
+    };
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range for a counter and a key, without state.
+ *
+ * Computes ten Philox4x32 rounds of \p counter with \p key. Unlike rocrand4(),
+ * no state is initialized, loaded or stored, so kernels which need random
+ * numbers of known positions (e.g. per particle id and time step) can compute
+ * them directly in registers.
+ *
+ * Results are the same as rocrand4() of a state initialized by
+ * <tt>rocrand_init(seed, subsequence, 4 * index, state)</tt>, where \p key is
+ * <tt>rocrand_philox4x32_10_key(seed)</tt> and \p counter is
+ * <tt>rocrand_philox4x32_10_counter(subsequence, index)</tt>.
+ * Different counters give independent numbers.
+ *
+ * \param counter - Counter (position of the numbers)
+ * \param key - Key (seed)
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand_philox4x32_10_hash(const uint4 counter, const uint2 key)
+{
+    return rocrand_device::detail::philox4x32_10_ten_rounds(counter, key);
+}
+
 /**
  * \brief Updates Philox state to skip ahead by \p offset elements.
  *
@@ -447,6 +595,88 @@ void skipahead_subsequence(unsigned long long subsequence, rocrand_state_philox4
      return state->discard_subsequence(sequence);
  }
 
+/**
+ * \brief Initialize compact Philox state.
+ *
+ * Initializes the compact Philox generator \p state with the given
+ * \p seed, \p subsequence, and \p offset. Sequences are the same as of
+ * rocrand_state_philox4x32_10, but the state has no cache of the Box-Muller
+ * transform (48 instead of 64 bytes), so normal values are returned only
+ * in pairs (rocrand_normal2(), rocrand_normal_double2(), rocrand_log_normal2()
+ * and rocrand_log_normal_double2()).
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_philox4x32_10_compact * state)
+{
+    *state = rocrand_state_philox4x32_10_compact(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Same as rocrand() of rocrand_state_philox4x32_10 for a compact Philox \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_philox4x32_10_compact * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Same as rocrand4() of rocrand_state_philox4x32_10 for a compact Philox \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand4(rocrand_state_philox4x32_10_compact * state)
+{
+    return state->next4();
+}
+
+/**
+ * \brief Updates compact Philox state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_philox4x32_10_compact * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates compact Philox state to skip ahead by \p subsequence subsequences.
+ *
+ * Each subsequence is 4 * 2^64 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_philox4x32_10_compact * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
 #endif // ROCRAND_PHILOX4X32_10_H_
 
 /** @} */ // end of group rocranddevice
@@ -0,0 +1,488 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/*
+Copyright 2010-2011, D. E. Shaw Research.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions, and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions, and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+* Neither the name of D. E. Shaw Research nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef ROCRAND_PHILOX4X64_10_H_
+#define ROCRAND_PHILOX4X64_10_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand_common.h"
+
+// Constants from Random123
+// See https://www.deshawresearch.com/resources_random123.html
+#define ROCRAND_PHILOX_M4x64_0 0xD2E7470EE14C6C93ULL
+#define ROCRAND_PHILOX_M4x64_1 0xCA5A826395121157ULL
+#define ROCRAND_PHILOX_W64_0   0x9E3779B97F4A7C15ULL
+#define ROCRAND_PHILOX_W64_1   0xBB67AE8584CAA73BULL
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+ /**
+ * \def ROCRAND_PHILOX4x64_DEFAULT_SEED
+ * \brief Default seed for PHILOX4x64 PRNG.
+ */
+#define ROCRAND_PHILOX4x64_DEFAULT_SEED 0xdeadbeefdeadbeefULL
+/** @} */ // end of group rocranddevice
+
+namespace rocrand_device {
+namespace detail {
+
+FQUALIFIERS
+unsigned long long mulhilo64(unsigned long long x, unsigned long long y, unsigned long long& z)
+{
+    #if defined(__HIP_DEVICE_COMPILE__)
+
+    z = __umul64hi(x, y);
+
+    #else // host code
+
+    const unsigned long long x_lo = x & 0xFFFFFFFFULL;
+    const unsigned long long x_hi = x >> 32;
+    const unsigned long long y_lo = y & 0xFFFFFFFFULL;
+    const unsigned long long y_hi = y >> 32;
+    const unsigned long long lo_lo = x_lo * y_lo;
+    const unsigned long long hi_lo = x_hi * y_lo;
+    const unsigned long long lo_hi = x_lo * y_hi;
+    const unsigned long long cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFULL) + lo_hi;
+    z = x_hi * y_hi + (hi_lo >> 32) + (cross >> 32);
+
+    #endif
+    return x * y;
+}
+
+// Single Philox4x64 round of the 256-bit counter x0..x3 with the key k0, k1
+FQUALIFIERS
+void philox4x64_10_single_round(unsigned long long& x0, unsigned long long& x1,
+                                unsigned long long& x2, unsigned long long& x3,
+                                const unsigned long long k0, const unsigned long long k1)
+{
+    // Source: Random123
+    unsigned long long hi0;
+    unsigned long long hi1;
+    const unsigned long long lo0 = mulhilo64(ROCRAND_PHILOX_M4x64_0, x0, hi0);
+    const unsigned long long lo1 = mulhilo64(ROCRAND_PHILOX_M4x64_1, x2, hi1);
+    x0 = hi1 ^ x1 ^ k0;
+    x1 = lo1;
+    x2 = hi0 ^ x3 ^ k1;
+    x3 = lo0;
+}
+
+// 10 Philox4x64 rounds of the 256-bit counter x0..x3 with the 128-bit key k0, k1
+FQUALIFIERS
+void philox4x64_10_rounds(unsigned long long& x0, unsigned long long& x1,
+                          unsigned long long& x2, unsigned long long& x3,
+                          unsigned long long k0, unsigned long long k1)
+{
+    for(unsigned int i = 0; i < 9; i++)
+    {
+        philox4x64_10_single_round(x0, x1, x2, x3, k0, k1);
+        k0 += ROCRAND_PHILOX_W64_0;
+        k1 += ROCRAND_PHILOX_W64_1;
+    }
+    philox4x64_10_single_round(x0, x1, x2, x3, k0, k1);
+}
+
+// Computes 8 random numbers: the 128-bit counter is the lower half of the
+// 256-bit Philox4x64 counter (two 64-bit words, x, y and z, w), the 64-bit
+// key is the lower half of the 128-bit key (the upper halves are 0),
+// 64-bit results are split into 32-bit numbers (lower halves first)
+FQUALIFIERS
+void philox4x64_10_apply(const uint4 counter, const uint2 key, uint4 * result)
+{
+    unsigned long long x0 = counter.x | (static_cast<unsigned long long>(counter.y) << 32);
+    unsigned long long x1 = counter.z | (static_cast<unsigned long long>(counter.w) << 32);
+    unsigned long long x2 = 0;
+    unsigned long long x3 = 0;
+    const unsigned long long k0 = key.x | (static_cast<unsigned long long>(key.y) << 32);
+    philox4x64_10_rounds(x0, x1, x2, x3, k0, 0);
+    result[0] = uint4 {
+        static_cast<unsigned int>(x0), static_cast<unsigned int>(x0 >> 32),
+        static_cast<unsigned int>(x1), static_cast<unsigned int>(x1 >> 32)
+    };
+    result[1] = uint4 {
+        static_cast<unsigned int>(x2), static_cast<unsigned int>(x2 >> 32),
+        static_cast<unsigned int>(x3), static_cast<unsigned int>(x3 >> 32)
+    };
+}
+
+} // end detail namespace
+
+// Philox4x64-10 has the counter/key structure of Philox4x32-10 (a 128-bit
+// counter: the first two words are the position of a group of 8 numbers,
+// the other two are the subsequence, and a 64-bit key, the seed), one call
+// of the rounds gives 8 numbers (4 64-bit results).
+class philox4x64_10_engine
+{
+public:
+    struct philox4x64_10_state
+    {
+        uint4 counter;
+        uint4 result[2];
+        uint2 key;
+        unsigned int substate;
+
+        #ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+        // The second value of the Box–Muller transform
+        // (see philox4x32_10_engine)
+        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+        float boxmuller_float; // normally distributed float
+        double boxmuller_double; // normally distributed double
+        #endif
+
+        FQUALIFIERS
+        ~philox4x64_10_state() { }
+    };
+
+    FQUALIFIERS
+    philox4x64_10_engine()
+    {
+        this->seed(ROCRAND_PHILOX4x64_DEFAULT_SEED, 0, 0);
+    }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 8 * 2^64 numbers long.
+    FQUALIFIERS
+    philox4x64_10_engine(const unsigned long long seed,
+                         const unsigned long long subsequence,
+                         const unsigned long long offset)
+    {
+        this->seed(seed, subsequence, offset);
+    }
+
+    FQUALIFIERS
+    ~philox4x64_10_engine() { }
+
+    /// Reinitializes the internal state of the PRNG using new
+    /// seed value \p seed_value, skips \p subsequence subsequences
+    /// and \p offset random numbers.
+    ///
+    /// A subsequence is 8 * 2^64 numbers long.
+    FQUALIFIERS
+    void seed(unsigned long long seed_value,
+              const unsigned long long subsequence,
+              const unsigned long long offset)
+    {
+        m_state.key.x = static_cast<unsigned int>(seed_value);
+        m_state.key.y = static_cast<unsigned int>(seed_value >> 32);
+        this->restart(subsequence, offset);
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    FQUALIFIERS
+    void discard(unsigned long long offset)
+    {
+        this->discard_impl(offset);
+        detail::philox4x64_10_apply(m_state.counter, m_state.key, m_state.result);
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// A subsequence is 8 * 2^64 numbers long.
+    FQUALIFIERS
+    void discard_subsequence(unsigned long long subsequence)
+    {
+        this->discard_subsequence_impl(subsequence);
+        detail::philox4x64_10_apply(m_state.counter, m_state.key, m_state.result);
+    }
+
+    FQUALIFIERS
+    void restart(const unsigned long long subsequence,
+                 const unsigned long long offset)
+    {
+        m_state.counter = {0, 0, 0, 0};
+        m_state.substate = 0;
+        #ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state = 0;
+        m_state.boxmuller_double_state = 0;
+        #endif
+        this->discard_subsequence_impl(subsequence);
+        this->discard_impl(offset);
+        detail::philox4x64_10_apply(m_state.counter, m_state.key, m_state.result);
+    }
+
+    FQUALIFIERS
+    unsigned int operator()()
+    {
+        return this->next();
+    }
+
+    FQUALIFIERS
+    unsigned int next()
+    {
+        const uint4 r = m_state.result[m_state.substate / 4];
+        const unsigned int ret = (&r.x)[m_state.substate % 4];
+        m_state.substate++;
+        if(m_state.substate == 8)
+        {
+            m_state.substate = 0;
+            this->discard_state();
+            detail::philox4x64_10_apply(m_state.counter, m_state.key, m_state.result);
+        }
+        return ret;
+    }
+
+    FQUALIFIERS
+    uint4 next4()
+    {
+        if(m_state.substate < 4)
+        {
+            const uint4 ret = combine(m_state.result[0], m_state.result[1], m_state.substate);
+            m_state.substate += 4;
+            return ret;
+        }
+        const uint4 r = m_state.result[1];
+        this->discard_state();
+        detail::philox4x64_10_apply(m_state.counter, m_state.key, m_state.result);
+        m_state.substate -= 4;
+        return combine(r, m_state.result[0], m_state.substate);
+    }
+
+protected:
+    // Returns 4 numbers starting at substate-th number of r and
+    // continuing in r_next, substate must be in [0, 3]
+    static FQUALIFIERS
+    uint4 combine(const uint4 r, const uint4 r_next, const unsigned int substate)
+    {
+        switch(substate)
+        {
+            case 1:
+                return uint4 { r.y, r.z, r.w, r_next.x };
+            case 2:
+                return uint4 { r.z, r.w, r_next.x, r_next.y };
+            case 3:
+                return uint4 { r.w, r_next.x, r_next.y, r_next.z };
+            default:
+                return r;
+        }
+    }
+
+    // Advances the internal state to skip \p offset numbers.
+    // DOES NOT CALCULATE NEW 8 UINTs (m_state.result)
+    FQUALIFIERS
+    void discard_impl(unsigned long long offset)
+    {
+        // Adjust offset for subset
+        m_state.substate += offset & 7;
+        offset += m_state.substate < 8 ? 0 : 8;
+        m_state.substate += m_state.substate < 8 ? 0 : -8;
+        // Discard states
+        this->discard_state(offset / 8);
+    }
+
+    // DOES NOT CALCULATE NEW 8 UINTs (m_state.result)
+    FQUALIFIERS
+    void discard_subsequence_impl(unsigned long long subsequence)
+    {
+        unsigned int lo = static_cast<unsigned int>(subsequence);
+        unsigned int hi = static_cast<unsigned int>(subsequence >> 32);
+
+        unsigned int temp = m_state.counter.z;
+        m_state.counter.z += lo;
+        m_state.counter.w += hi + (m_state.counter.z < temp ? 1 : 0);
+    }
+
+    // Advances the internal state by offset times.
+    // DOES NOT CALCULATE NEW 8 UINTs (m_state.result)
+    FQUALIFIERS
+    void discard_state(unsigned long long offset)
+    {
+        unsigned int lo = static_cast<unsigned int>(offset);
+        unsigned int hi = static_cast<unsigned int>(offset >> 32);
+
+        uint4 temp = m_state.counter;
+        m_state.counter.x += lo;
+        m_state.counter.y += hi + (m_state.counter.x < temp.x ? 1 : 0);
+        m_state.counter.z += (m_state.counter.y < temp.y ? 1 : 0);
+        m_state.counter.w += (m_state.counter.z < temp.z ? 1 : 0);
+    }
+
+    // Advances the internal state to the next state
+    // DOES NOT CALCULATE NEW 8 UINTs (m_state.result)
+    FQUALIFIERS
+    void discard_state()
+    {
+        m_state.counter.x++;
+        unsigned int add = m_state.counter.x == 0 ? 1 : 0;
+        m_state.counter.y += add; add = m_state.counter.y == 0 ? add : 0;
+        m_state.counter.z += add; add = m_state.counter.z == 0 ? add : 0;
+        m_state.counter.w += add;
+    }
+
+protected:
+    // State
+    philox4x64_10_state m_state;
+
+    #ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+    friend struct detail::engine_boxmuller_helper<philox4x64_10_engine>;
+    #endif
+
+}; // philox4x64_10_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::philox4x64_10_engine rocrand_state_philox4x64_10;
+/// \endcond
+
+/**
+ * \brief Initializes Philox4x64-10 state.
+ *
+ * Initializes the Philox4x64-10 generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_philox4x64_10 * state)
+{
+    *state = rocrand_state_philox4x64_10(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using Philox4x64-10 generator in \p state
+ * (64-bit results are split into two numbers, lower halves first).
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_philox4x64_10 * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using Philox4x64-10 generator in \p state
+ * (two 64-bit numbers, lower halves first).
+ * State is incremented by four positions.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand4(rocrand_state_philox4x64_10 * state)
+{
+    return state->next4();
+}
+
+/**
+ * \brief Updates Philox4x64-10 state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_philox4x64_10 * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates Philox4x64-10 state to skip ahead by \p subsequence subsequences.
+ *
+ * Each subsequence is 8 * 2^64 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_philox4x64_10 * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates Philox4x64-10 state to skip ahead by \p sequence sequences.
+ *
+ * Each sequence is 8 * 2^64 numbers long (equal to the size of a subsequence).
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_sequence(unsigned long long sequence, rocrand_state_philox4x64_10 * state)
+{
+    return state->discard_subsequence(sequence);
+}
+
+#endif // ROCRAND_PHILOX4X64_10_H_
+
+/** @} */ // end of group rocranddevice
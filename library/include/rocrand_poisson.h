@@ -36,6 +36,9 @@
 #include "rocrand_mrg32k3a.h"
 #include "rocrand_xorwow.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_uniform.h"
@@ -100,37 +103,55 @@ double lgamma_approx(const double x)
     return (log_sqrt_2_pi + log(sum) - g) + (z + 0.5) * log((z + g + 0.5) / e);
 }
 
-template<class State>
-FQUALIFIERS
-unsigned int poisson_distribution_large(State& state, double lambda)
+// Rejection method PA, A. C. Atkinson
+struct poisson_large_params
 {
-    // Rejection method PA, A. C. Atkinson
+    double alpha;
+    double beta;
+    double k;
+    double log_lambda;
 
-    const double c = 0.767 - 3.36 / lambda;
-    const double beta = ROCRAND_PI_DOUBLE / sqrt(3.0 * lambda);
-    const double alpha = beta * lambda;
-    const double k = log(c) - lambda - log(beta);
-    const double log_lambda = log(lambda);
+    FQUALIFIERS
+    poisson_large_params(double lambda)
+    {
+        const double c = 0.767 - 3.36 / lambda;
+        beta = ROCRAND_PI_DOUBLE / sqrt(3.0 * lambda);
+        alpha = beta * lambda;
+        k = log(c) - lambda - log(beta);
+        log_lambda = log(lambda);
+    }
 
-    while (true)
+    // One attempt of the rejection method, returns true and sets n if
+    // the candidate is accepted
+    template<class State>
+    FQUALIFIERS
+    bool attempt(State& state, unsigned int& n) const
     {
         const double u = rocrand_uniform_double(state);
         const double x = (alpha - log((1.0 - u) / u)) / beta;
-        const double n = floor(x + 0.5);
-        if (n < 0)
+        const double m = floor(x + 0.5);
+        if (m < 0)
         {
-            continue;
+            return false;
         }
         const double v = rocrand_uniform_double(state);
         const double y = alpha - beta * x;
         const double t = 1.0 + exp(y);
         const double lhs = y + log(v / (t * t));
-        const double rhs = k + n * log_lambda - lgamma_approx(n + 1.0);
-        if (lhs <= rhs)
-        {
-            return static_cast<unsigned int>(n);
-        }
+        const double rhs = k + m * log_lambda - lgamma_approx(m + 1.0);
+        n = static_cast<unsigned int>(m);
+        return lhs <= rhs;
     }
+};
+
+template<class State>
+FQUALIFIERS
+unsigned int poisson_distribution_large(State& state, double lambda)
+{
+    const poisson_large_params params(lambda);
+    unsigned int n;
+    while (!params.attempt(state, n)) { }
+    return n;
 }
 
 template<class State>
@@ -161,6 +182,84 @@ unsigned int poisson_distribution(State& state, double lambda)
     }
 }
 
+#if defined(__HIP_DEVICE_COMPILE__)
+// Index of the n-th (from 0) lane of mask
+FQUALIFIERS
+unsigned int warp_nth_lane(unsigned long long mask, unsigned int n)
+{
+    for (unsigned int i = 0; i < n; i++)
+    {
+        mask &= mask - 1;
+    }
+    return __ffsll(mask) - 1;
+}
+#endif
+
+// Same distribution as poisson_distribution() but the rejection method is
+// shared by all lanes of the warp: in every round each lane makes one attempt
+// for a lane which has no result yet (lanes are distributed evenly, using
+// lambda of the pending lane), and each pending lane takes the accepted
+// candidate of the lowest lane. Retries of one lane are done in parallel by
+// lanes which have finished or have lambdas of other methods, so the warp
+// waits for about (number of pending lanes) / (warp size) rounds instead of
+// the longest sequence of rejections. Sequences of states differ from
+// poisson_distribution().
+template<class State>
+FQUALIFIERS
+unsigned int poisson_distribution_warp(State& state, double lambda)
+{
+    #if defined(__HIP_DEVICE_COMPILE__)
+    unsigned int result = 0;
+    const bool large = lambda >= lambda_threshold_small && lambda <= lambda_threshold_huge;
+    if (lambda < lambda_threshold_small)
+    {
+        result = poisson_distribution_small(state, lambda);
+    }
+    else if (!large)
+    {
+        result = poisson_distribution_huge(state, lambda);
+    }
+
+    const unsigned int lane = __lane_id();
+    unsigned long long pending = __ballot(large);
+    while (pending != 0)
+    {
+        const unsigned int pending_count = __popcll(pending);
+        const unsigned int target = warp_nth_lane(pending, lane % pending_count);
+        const double target_lambda = __shfl(lambda, target);
+
+        unsigned int n = 0;
+        const bool accepted = poisson_large_params(target_lambda).attempt(state, n);
+        const unsigned long long accepted_mask = __ballot(accepted);
+
+        // Lanes lane_rank, lane_rank + pending_count... made attempts for this lane
+        unsigned int source = lane;
+        bool found = false;
+        if ((pending >> lane) & 1)
+        {
+            const unsigned int lane_rank = __popcll(pending & ((1ULL << lane) - 1));
+            for (unsigned int i = lane_rank; i < warpSize && !found; i += pending_count)
+            {
+                if ((accepted_mask >> i) & 1)
+                {
+                    source = i;
+                    found = true;
+                }
+            }
+        }
+        const unsigned int candidate = __shfl(static_cast<int>(n), source);
+        if (found)
+        {
+            result = candidate;
+        }
+        pending &= ~__ballot(found);
+    }
+    return result;
+    #else
+    return poisson_distribution(state, lambda);
+    #endif
+}
+
 template<class State>
 FQUALIFIERS
 unsigned int poisson_distribution_itr(State& state, double lambda)
@@ -234,6 +333,28 @@ unsigned int rocrand_poisson(rocrand_state_philox4x32_10 * state, double lambda)
     return rocrand_device::detail::poisson_distribution(state, lambda);
 }
 
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using Philox generator,
+ * sampled together by all threads of the warp.
+ *
+ * Same distribution as rocrand_poisson() but retries of the rejection method
+ * (for lambdas in [64; 4000]) are shared by all threads of the warp, so threads
+ * with different lambdas or with long sequences of rejections do not serialize
+ * the warp. Must be called by all threads of the warp, values of \p lambda can
+ * differ. The state is incremented by a variable amount and the results differ
+ * from rocrand_poisson() of the same state.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson_warp(rocrand_state_philox4x32_10 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_warp(state, lambda);
+}
+
 /**
  * \brief Returns four Poisson-distributed <tt>unsigned int</tt> values using Philox generator.
  *
@@ -274,6 +395,28 @@ unsigned int rocrand_poisson(rocrand_state_mrg32k3a * state, double lambda)
 {
     return rocrand_device::detail::poisson_distribution(state, lambda);
 }
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using MRG32k3a generator,
+ * sampled together by all threads of the warp.
+ *
+ * Same distribution as rocrand_poisson() but retries of the rejection method
+ * (for lambdas in [64; 4000]) are shared by all threads of the warp, so threads
+ * with different lambdas or with long sequences of rejections do not serialize
+ * the warp. Must be called by all threads of the warp, values of \p lambda can
+ * differ. The state is incremented by a variable amount and the results differ
+ * from rocrand_poisson() of the same state.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson_warp(rocrand_state_mrg32k3a * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_warp(state, lambda);
+}
 #endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
 
 /**
@@ -293,6 +436,28 @@ unsigned int rocrand_poisson(rocrand_state_xorwow * state, double lambda)
 {
     return rocrand_device::detail::poisson_distribution(state, lambda);
 }
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using XORWOW generator,
+ * sampled together by all threads of the warp.
+ *
+ * Same distribution as rocrand_poisson() but retries of the rejection method
+ * (for lambdas in [64; 4000]) are shared by all threads of the warp, so threads
+ * with different lambdas or with long sequences of rejections do not serialize
+ * the warp. Must be called by all threads of the warp, values of \p lambda can
+ * differ. The state is incremented by a variable amount and the results differ
+ * from rocrand_poisson() of the same state.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson_warp(rocrand_state_xorwow * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_warp(state, lambda);
+}
 #endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
 
 /**
@@ -329,6 +494,57 @@ unsigned int rocrand_poisson(rocrand_state_sobol32 * state, double lambda)
     return rocrand_device::detail::poisson_distribution_inv(state, lambda);
 }
 
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using SCRAMBLED_SOBOL32 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using SCRAMBLED_SOBOL32 generator in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_scrambled_sobol32 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using SOBOL64 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using SOBOL64 generator in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_sobol64 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using SCRAMBLED_SOBOL64 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using SCRAMBLED_SOBOL64 generator in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_scrambled_sobol64 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
 #endif // ROCRAND_POISSON_H_
 
 /** @} */ // end of group rocranddevice
@@ -135,16 +135,19 @@ public:
     }
 
 protected:
-    // Advances the internal state by offset times.
+    // Advances the internal state by offset times: the point is the XOR of
+    // direction vectors of set bits of the Gray code of its index, so the cost
+    // does not depend on offset (one step per set bit, at most 32).
     FQUALIFIERS
     void discard_state(unsigned int offset)
     {
         m_state.i += offset;
-        const unsigned int g = m_state.i ^ (m_state.i >> 1);
+        unsigned int g = m_state.i ^ (m_state.i >> 1);
         m_state.d = 0;
-        for(int i = 0; i < 32; i++)
+        while(g != 0)
         {
-            m_state.d ^= (g & (1 << i) ? m_state.vectors[i] : 0);
+            m_state.d ^= m_state.vectors[rightmost_zero_bit(~g)];
+            g &= g - 1;
         }
     }
 
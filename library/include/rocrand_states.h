@@ -0,0 +1,314 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#ifndef ROCRAND_STATES_H_
+#define ROCRAND_STATES_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+#include <string.h>
+
+#include "rocrand.h"
+#include "rocrand_philox4x32_10.h"
+#include "rocrand_mrg32k3a.h"
+#include "rocrand_xorwow.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// States stored as an array of structures
+template<class State>
+struct states_aos
+{
+    State * states;
+
+    FQUALIFIERS
+    State load(const unsigned long long i) const
+    {
+        return states[i];
+    }
+
+    FQUALIFIERS
+    void store(const unsigned long long i, const State& state) const
+    {
+        states[i] = state;
+    }
+};
+
+// States stored as a structure of arrays of 32-bit words: word w of
+// state i is words[w * n + i], so neighbouring threads access neighbouring
+// words
+template<class State>
+struct states_soa
+{
+    static_assert(sizeof(State) % sizeof(unsigned int) == 0,
+                  "State size must be a multiple of 4 bytes");
+    static const unsigned int state_words = sizeof(State) / sizeof(unsigned int);
+
+    unsigned int * words;
+    unsigned long long n;
+
+    // All words are overwritten, so the state is not seeded by a default
+    // constructor. Words are copied by memcpy, states are not arrays of
+    // unsigned int.
+    FQUALIFIERS
+    State load(const unsigned long long i) const
+    {
+        State state((uninitialized_tag()));
+        unsigned char * state_bytes = reinterpret_cast<unsigned char *>(&state);
+        for(unsigned int w = 0; w < state_words; w++)
+        {
+            const unsigned int word = words[w * n + i];
+            memcpy(state_bytes + w * sizeof(unsigned int), &word, sizeof(unsigned int));
+        }
+        return state;
+    }
+
+    FQUALIFIERS
+    void store(const unsigned long long i, const State& state) const
+    {
+        const unsigned char * state_bytes = reinterpret_cast<const unsigned char *>(&state);
+        for(unsigned int w = 0; w < state_words; w++)
+        {
+            unsigned int word;
+            memcpy(&word, state_bytes + w * sizeof(unsigned int), sizeof(unsigned int));
+            words[w * n + i] = word;
+        }
+    }
+};
+
+// States whose subsequence jumps are products with precomputed matrices
+// are created in doubling steps, Philox states are initialized directly
+// (their subsequence is a part of the counter)
+template<class State>
+struct create_states_by_steps
+{
+    static const bool value = true;
+};
+
+template<>
+struct create_states_by_steps<rocrand_state_philox4x32_10>
+{
+    static const bool value = false;
+};
+
+template<>
+struct create_states_by_steps<rocrand_state_philox4x32_10_compact>
+{
+    static const bool value = false;
+};
+
+// State i is rocrand_init(seed, i, 0). Only the first state of a block is
+// seeded and jumps to its subsequence, then the block doubles the number
+// of ready states in log2(block size) steps: in step k states
+// [2^k, 2^(k+1)) of the block copy states [0, 2^k) and jump by 2^k
+// subsequences (one or two products with precomputed matrices instead of
+// one per digit of the subsequence)
+template<class State, class Layout>
+__global__
+void create_states_kernel(const Layout layout,
+                          const unsigned long long n,
+                          const unsigned long long seed)
+{
+    const unsigned long long block_start =
+        static_cast<unsigned long long>(hipBlockIdx_x) * hipBlockDim_x;
+    const unsigned long long state_id = block_start + hipThreadIdx_x;
+
+    if(!create_states_by_steps<State>::value)
+    {
+        if(state_id < n)
+        {
+            State state;
+            ::rocrand_init(seed, state_id, 0, &state);
+            layout.store(state_id, state);
+        }
+        return;
+    }
+
+    if(hipThreadIdx_x == 0)
+    {
+        State state;
+        ::rocrand_init(seed, block_start, 0, &state);
+        layout.store(block_start, state);
+    }
+    __syncthreads();
+    // States written by other threads of the block are visible after
+    // the barrier
+    for(unsigned int step = 1; step < hipBlockDim_x; step *= 2)
+    {
+        if(hipThreadIdx_x >= step && hipThreadIdx_x < 2 * step && state_id < n)
+        {
+            State state = layout.load(state_id - step);
+            ::skipahead_subsequence(step, &state);
+            layout.store(state_id, state);
+        }
+        __syncthreads();
+    }
+}
+
+template<class State, class Layout>
+inline
+rocrand_status create_states(const Layout& layout,
+                             const unsigned long long n,
+                             const unsigned long long seed,
+                             hipStream_t stream)
+{
+    if(n == 0)
+        return ROCRAND_STATUS_SUCCESS;
+    const unsigned int threads = 256;
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(create_states_kernel<State, Layout>),
+        dim3(static_cast<unsigned int>((n + threads - 1) / threads)), dim3(threads), 0, stream,
+        layout, n, seed
+    );
+    if(hipPeekAtLastError() != hipSuccess)
+        return ROCRAND_STATUS_LAUNCH_FAILURE;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Initializes an array of states on the device.
+ *
+ * Initializes \p n states in device memory \p states, state i is the same
+ * as after <tt>rocrand_init(seed, i, 0, &state)</tt>, so states of threads
+ * generate non-overlapping subsequences.
+ *
+ * It is faster than a kernel calling rocrand_init() in every thread:
+ * only the first state of each block of 256 states is seeded and jumps to its
+ * subsequence, the other states are computed from their neighbours in
+ * doubling steps with one or two matrix-vector products per state (XORWOW
+ * and MRG32k3a). Philox4x32-10 states are initialized directly.
+ *
+ * The kernel is launched to \p stream, states can be used by kernels
+ * launched to \p stream after the call.
+ * Supported states: XORWOW, MRG32k3a and Philox4x32-10 (and their compact
+ * variants).
+ *
+ * \param states - Pointer to an array of \p n states in device memory
+ * \param n - Number of states
+ * \param seed - Value to use as a seed
+ * \param stream - Stream of the initialization kernel
+ *
+ * \return
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the kernel could not be launched \n
+ * - ROCRAND_STATUS_SUCCESS if states are initialized \n
+ */
+template<class State>
+__host__ inline
+rocrand_status rocrand_create_states(State * states,
+                                     const unsigned long long n,
+                                     const unsigned long long seed,
+                                     hipStream_t stream = 0)
+{
+    const rocrand_device::detail::states_aos<State> layout = { states };
+    return rocrand_device::detail::create_states<State>(layout, n, seed, stream);
+}
+
+/**
+ * \brief Initializes an array of states on the device in the structure of
+ * arrays layout.
+ *
+ * Initializes \p n states as rocrand_create_states() does, but stores them
+ * as a structure of arrays of 32-bit words: word w of state i is
+ * <tt>soa_states[w * n + i]</tt>. Neighbouring threads load and store
+ * neighbouring words (see rocrand_load_state_soa() and
+ * rocrand_store_state_soa()), so accesses are coalesced.
+ * \p soa_states must have <tt>sizeof(State) * n</tt> bytes.
+ *
+ * \tparam State - Type of states (it cannot be deduced)
+ *
+ * \param soa_states - Pointer to device memory of \p n states
+ * \param n - Number of states
+ * \param seed - Value to use as a seed
+ * \param stream - Stream of the initialization kernel
+ *
+ * \return
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the kernel could not be launched \n
+ * - ROCRAND_STATUS_SUCCESS if states are initialized \n
+ */
+template<class State>
+__host__ inline
+rocrand_status rocrand_create_states_soa(unsigned int * soa_states,
+                                         const unsigned long long n,
+                                         const unsigned long long seed,
+                                         hipStream_t stream = 0)
+{
+    const rocrand_device::detail::states_soa<State> layout = { soa_states, n };
+    return rocrand_device::detail::create_states<State>(layout, n, seed, stream);
+}
+
+/**
+ * \brief Loads a state stored in the structure of arrays layout.
+ *
+ * Loads state \p i of \p n states created by rocrand_create_states_soa()
+ * (or stored by rocrand_store_state_soa()) to \p state.
+ *
+ * \param soa_states - Pointer to \p n states in the structure of arrays layout
+ * \param n - Number of states
+ * \param i - Index of the state
+ * \param state - Pointer to the loaded state
+ */
+template<class State>
+FQUALIFIERS
+void rocrand_load_state_soa(const unsigned int * soa_states,
+                            const unsigned long long n,
+                            const unsigned long long i,
+                            State * state)
+{
+    const rocrand_device::detail::states_soa<State> layout =
+        { const_cast<unsigned int *>(soa_states), n };
+    *state = layout.load(i);
+}
+
+/**
+ * \brief Stores a state in the structure of arrays layout.
+ *
+ * Stores \p state as state \p i of \p n states in the structure of arrays
+ * layout of rocrand_create_states_soa().
+ *
+ * \param soa_states - Pointer to \p n states in the structure of arrays layout
+ * \param n - Number of states
+ * \param i - Index of the state
+ * \param state - Pointer to the state to store
+ */
+template<class State>
+FQUALIFIERS
+void rocrand_store_state_soa(unsigned int * soa_states,
+                             const unsigned long long n,
+                             const unsigned long long i,
+                             const State * state)
+{
+    const rocrand_device::detail::states_soa<State> layout = { soa_states, n };
+    layout.store(i, *state);
+}
+
+#endif // ROCRAND_STATES_H_
+
+/** @} */ // end of group rocranddevice
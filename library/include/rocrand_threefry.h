@@ -0,0 +1,303 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/*
+Copyright 2010-2011, D. E. Shaw Research.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions, and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions, and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+* Neither the name of D. E. Shaw Research nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef ROCRAND_THREEFRY_H_
+#define ROCRAND_THREEFRY_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand_common.h"
+
+// Constants from Random123
+// See https://www.deshawresearch.com/resources_random123.html
+#define ROCRAND_THREEFRY_PARITY32 0x1BD11BDAU
+#define ROCRAND_THREEFRY_PARITY64 0x1BD11BDAA9FC1A22ULL
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+ /**
+ * \def ROCRAND_THREEFRY_DEFAULT_SEED
+ * \brief Default seed for Threefry PRNGs.
+ */
+#define ROCRAND_THREEFRY_DEFAULT_SEED 0xdeadbeefdeadbeefULL
+/** @} */ // end of group rocranddevice
+
+namespace rocrand_device {
+namespace detail {
+
+FQUALIFIERS
+unsigned int rotl32(unsigned int x, unsigned int r)
+{
+    return (x << r) | (x >> (32 - r));
+}
+
+FQUALIFIERS
+unsigned long long rotl64(unsigned long long x, unsigned int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+} // end detail namespace
+
+// Threefry engines have the same counter/key structure as Philox4x32-10:
+// a 128-bit counter (4 x 32-bit words, the first two are the position
+// of a group of 4 numbers, the other two are the subsequence) and a 64-bit
+// key (the seed). Rounds::apply(counter, key) computes 4 random numbers.
+template<class Rounds>
+class threefry_engine
+{
+public:
+    struct threefry_state
+    {
+        uint4 counter;
+        uint4 result;
+        uint2 key;
+        unsigned int substate;
+
+        #ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+        // The second value of the Box–Muller transform
+        // (see philox4x32_10_engine)
+        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+        float boxmuller_float; // normally distributed float
+        double boxmuller_double; // normally distributed double
+        #endif
+
+        FQUALIFIERS
+        ~threefry_state() { }
+    };
+
+    FQUALIFIERS
+    threefry_engine()
+    {
+        this->seed(ROCRAND_THREEFRY_DEFAULT_SEED, 0, 0);
+    }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 4 * 2^64 numbers long.
+    FQUALIFIERS
+    threefry_engine(const unsigned long long seed,
+                    const unsigned long long subsequence,
+                    const unsigned long long offset)
+    {
+        this->seed(seed, subsequence, offset);
+    }
+
+    FQUALIFIERS
+    ~threefry_engine() { }
+
+    /// Reinitializes the internal state of the PRNG using new
+    /// seed value \p seed_value, skips \p subsequence subsequences
+    /// and \p offset random numbers.
+    ///
+    /// A subsequence is 4 * 2^64 numbers long.
+    FQUALIFIERS
+    void seed(unsigned long long seed_value,
+              const unsigned long long subsequence,
+              const unsigned long long offset)
+    {
+        m_state.key.x = static_cast<unsigned int>(seed_value);
+        m_state.key.y = static_cast<unsigned int>(seed_value >> 32);
+        this->restart(subsequence, offset);
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    FQUALIFIERS
+    void discard(unsigned long long offset)
+    {
+        this->discard_impl(offset);
+        m_state.result = Rounds::apply(m_state.counter, m_state.key);
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// A subsequence is 4 * 2^64 numbers long.
+    FQUALIFIERS
+    void discard_subsequence(unsigned long long subsequence)
+    {
+        this->discard_subsequence_impl(subsequence);
+        m_state.result = Rounds::apply(m_state.counter, m_state.key);
+    }
+
+    FQUALIFIERS
+    void restart(const unsigned long long subsequence,
+                 const unsigned long long offset)
+    {
+        m_state.counter = {0, 0, 0, 0};
+        m_state.result  = {0, 0, 0, 0};
+        m_state.substate = 0;
+        #ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state = 0;
+        m_state.boxmuller_double_state = 0;
+        #endif
+        this->discard_subsequence_impl(subsequence);
+        this->discard_impl(offset);
+        m_state.result = Rounds::apply(m_state.counter, m_state.key);
+    }
+
+    FQUALIFIERS
+    unsigned int operator()()
+    {
+        return this->next();
+    }
+
+    FQUALIFIERS
+    unsigned int next()
+    {
+        unsigned int ret = (&m_state.result.x)[m_state.substate];
+        m_state.substate++;
+        if(m_state.substate == 4)
+        {
+            m_state.substate = 0;
+            this->discard_state();
+            m_state.result = Rounds::apply(m_state.counter, m_state.key);
+        }
+        return ret;
+    }
+
+    FQUALIFIERS
+    uint4 next4()
+    {
+        uint4 ret = m_state.result;
+        this->discard_state();
+        m_state.result = Rounds::apply(m_state.counter, m_state.key);
+        switch(m_state.substate)
+        {
+            case 0:
+                return ret;
+            case 1:
+                ret = { ret.y, ret.z, ret.w, m_state.result.x };
+                break;
+            case 2:
+                ret = { ret.z, ret.w, m_state.result.x, m_state.result.y };
+                break;
+            case 3:
+                ret = { ret.w, m_state.result.x, m_state.result.y, m_state.result.z };
+                break;
+            default:
+                return ret;
+        }
+        return ret;
+    }
+
+protected:
+    // Advances the internal state to skip \p offset numbers.
+    // DOES NOT CALCULATE NEW 4 UINTs (m_state.result)
+    FQUALIFIERS
+    void discard_impl(unsigned long long offset)
+    {
+        // Adjust offset for subset
+        m_state.substate += offset & 3;
+        offset += m_state.substate < 4 ? 0 : 4;
+        m_state.substate += m_state.substate < 4 ? 0 : -4;
+        // Discard states
+        this->discard_state(offset / 4);
+    }
+
+    // DOES NOT CALCULATE NEW 4 UINTs (m_state.result)
+    FQUALIFIERS
+    void discard_subsequence_impl(unsigned long long subsequence)
+    {
+        unsigned int lo = static_cast<unsigned int>(subsequence);
+        unsigned int hi = static_cast<unsigned int>(subsequence >> 32);
+
+        unsigned int temp = m_state.counter.z;
+        m_state.counter.z += lo;
+        m_state.counter.w += hi + (m_state.counter.z < temp ? 1 : 0);
+    }
+
+    // Advances the internal state by offset times.
+    // DOES NOT CALCULATE NEW 4 UINTs (m_state.result)
+    FQUALIFIERS
+    void discard_state(unsigned long long offset)
+    {
+        unsigned int lo = static_cast<unsigned int>(offset);
+        unsigned int hi = static_cast<unsigned int>(offset >> 32);
+
+        uint4 temp = m_state.counter;
+        m_state.counter.x += lo;
+        m_state.counter.y += hi + (m_state.counter.x < temp.x ? 1 : 0);
+        m_state.counter.z += (m_state.counter.y < temp.y ? 1 : 0);
+        m_state.counter.w += (m_state.counter.z < temp.z ? 1 : 0);
+    }
+
+    // Advances the internal state to the next state
+    // DOES NOT CALCULATE NEW 4 UINTs (m_state.result)
+    FQUALIFIERS
+    void discard_state()
+    {
+        m_state.counter.x++;
+        unsigned int add = m_state.counter.x == 0 ? 1 : 0;
+        m_state.counter.y += add; add = m_state.counter.y == 0 ? add : 0;
+        m_state.counter.z += add; add = m_state.counter.z == 0 ? add : 0;
+        m_state.counter.w += add;
+    }
+
+protected:
+    // State
+    threefry_state m_state;
+
+    #ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+    friend struct detail::engine_boxmuller_helper<threefry_engine>;
+    #endif
+
+}; // threefry_engine class
+
+} // end namespace rocrand_device
+
+#endif // ROCRAND_THREEFRY_H_
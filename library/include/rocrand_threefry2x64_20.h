@@ -0,0 +1,270 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/*
+Copyright 2010-2011, D. E. Shaw Research.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions, and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions, and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+* Neither the name of D. E. Shaw Research nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef ROCRAND_THREEFRY2X64_20_H_
+#define ROCRAND_THREEFRY2X64_20_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand_common.h"
+#include "rocrand_threefry.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// Threefry2x64 round (rotations from Random123)
+FQUALIFIERS
+void threefry2x64_round(unsigned long long& x0, unsigned long long& x1, unsigned int r)
+{
+    x0 += x1; x1 = rotl64(x1, r); x1 ^= x0;
+}
+
+// Injects the s-th key of the key schedule ks (3 words)
+FQUALIFIERS
+void threefry2x64_inject_key(unsigned long long& x0, unsigned long long& x1,
+                             const unsigned long long * ks, unsigned int s)
+{
+    x0 += ks[s % 3];
+    x1 += ks[(s + 1) % 3] + s;
+}
+
+// 20 Threefry2x64 rounds of x0, x1 with a 128-bit key k0, k1
+FQUALIFIERS
+void threefry2x64_20_rounds(unsigned long long& x0, unsigned long long& x1,
+                            const unsigned long long k0, const unsigned long long k1)
+{
+    const unsigned long long ks[3] = {
+        k0, k1, ROCRAND_THREEFRY_PARITY64 ^ k0 ^ k1
+    };
+    threefry2x64_inject_key(x0, x1, ks, 0);
+    for(unsigned int s = 1; s <= 5; s++)
+    {
+        // Rounds 0-3 and 4-7 (mod 8) use different rotations
+        if(s % 2 == 1)
+        {
+            threefry2x64_round(x0, x1, 16);
+            threefry2x64_round(x0, x1, 42);
+            threefry2x64_round(x0, x1, 12);
+            threefry2x64_round(x0, x1, 31);
+        }
+        else
+        {
+            threefry2x64_round(x0, x1, 16);
+            threefry2x64_round(x0, x1, 32);
+            threefry2x64_round(x0, x1, 24);
+            threefry2x64_round(x0, x1, 21);
+        }
+        threefry2x64_inject_key(x0, x1, ks, s);
+    }
+}
+
+// Rounds of threefry2x64_20_engine: the 128-bit counter is two 64-bit
+// words (x, y and z, w), the 64-bit key is the lower half of the 128-bit
+// key (the upper half is 0), 64-bit results are split into 32-bit numbers
+struct threefry2x64_20_rounds_type
+{
+    static FQUALIFIERS
+    uint4 apply(const uint4 counter, const uint2 key)
+    {
+        unsigned long long x0 = counter.x | (static_cast<unsigned long long>(counter.y) << 32);
+        unsigned long long x1 = counter.z | (static_cast<unsigned long long>(counter.w) << 32);
+        const unsigned long long k0 = key.x | (static_cast<unsigned long long>(key.y) << 32);
+        threefry2x64_20_rounds(x0, x1, k0, 0);
+        return uint4 {
+            static_cast<unsigned int>(x0),
+            static_cast<unsigned int>(x0 >> 32),
+            static_cast<unsigned int>(x1),
+            static_cast<unsigned int>(x1 >> 32)
+        };
+    }
+};
+
+} // end detail namespace
+
+typedef threefry_engine<detail::threefry2x64_20_rounds_type> threefry2x64_20_engine;
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::threefry2x64_20_engine rocrand_state_threefry2x64_20;
+/// \endcond
+
+/**
+ * \brief Initializes Threefry2x64-20 state.
+ *
+ * Initializes the Threefry2x64-20 generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_threefry2x64_20 * state)
+{
+    *state = rocrand_state_threefry2x64_20(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using Threefry2x64-20 generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_threefry2x64_20 * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using Threefry2x64-20 generator in \p state
+ * (two 64-bit numbers, lower halves first).
+ * State is incremented by four positions.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand4(rocrand_state_threefry2x64_20 * state)
+{
+    return state->next4();
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range for a counter and a key, without state.
+ *
+ * Computes twenty Threefry2x64 rounds of \p counter (two 64-bit words,
+ * <tt>x | y << 32</tt> and <tt>z | w << 32</tt>) with \p key (the upper
+ * 64 bits of the Threefry key are 0). Counters and keys are the same as of
+ * Philox: results are the same as rocrand4() of a state initialized by
+ * <tt>rocrand_init(seed, subsequence, 4 * index, state)</tt>, where \p key is
+ * <tt>rocrand_philox4x32_10_key(seed)</tt> and \p counter is
+ * <tt>rocrand_philox4x32_10_counter(subsequence, index)</tt>.
+ *
+ * \param counter - Counter (position of the numbers)
+ * \param key - Key (seed)
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand_threefry2x64_20_hash(const uint4 counter, const uint2 key)
+{
+    return rocrand_device::detail::threefry2x64_20_rounds_type::apply(counter, key);
+}
+
+/**
+ * \brief Updates Threefry2x64-20 state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_threefry2x64_20 * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates Threefry2x64-20 state to skip ahead by \p subsequence subsequences.
+ *
+ * Each subsequence is 4 * 2^64 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_threefry2x64_20 * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates Threefry2x64-20 state to skip ahead by \p sequence sequences.
+ *
+ * Each sequence is 4 * 2^64 numbers long (equal to the size of a subsequence).
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_sequence(unsigned long long sequence, rocrand_state_threefry2x64_20 * state)
+{
+    return state->discard_subsequence(sequence);
+}
+
+#endif // ROCRAND_THREEFRY2X64_20_H_
+
+/** @} */ // end of group rocranddevice
@@ -0,0 +1,270 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/*
+Copyright 2010-2011, D. E. Shaw Research.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions, and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions, and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+* Neither the name of D. E. Shaw Research nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef ROCRAND_THREEFRY4X32_20_H_
+#define ROCRAND_THREEFRY4X32_20_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand_common.h"
+#include "rocrand_threefry.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// Even Threefry4x32 round (rotations from Random123)
+FQUALIFIERS
+void threefry4x32_even_round(uint4& x, unsigned int r0, unsigned int r1)
+{
+    x.x += x.y; x.y = rotl32(x.y, r0); x.y ^= x.x;
+    x.z += x.w; x.w = rotl32(x.w, r1); x.w ^= x.z;
+}
+
+// Odd Threefry4x32 round
+FQUALIFIERS
+void threefry4x32_odd_round(uint4& x, unsigned int r0, unsigned int r1)
+{
+    x.x += x.w; x.w = rotl32(x.w, r0); x.w ^= x.x;
+    x.z += x.y; x.y = rotl32(x.y, r1); x.y ^= x.z;
+}
+
+// Injects the s-th key of the key schedule ks (5 words)
+FQUALIFIERS
+void threefry4x32_inject_key(uint4& x, const unsigned int * ks, unsigned int s)
+{
+    x.x += ks[s % 5];
+    x.y += ks[(s + 1) % 5];
+    x.z += ks[(s + 2) % 5];
+    x.w += ks[(s + 3) % 5] + s;
+}
+
+// 20 Threefry4x32 rounds with a 128-bit key, computes 4 random
+// numbers for given counter and key without any state
+FQUALIFIERS
+uint4 threefry4x32_20_rounds(uint4 counter, const uint4 key)
+{
+    const unsigned int ks[5] = {
+        key.x, key.y, key.z, key.w,
+        ROCRAND_THREEFRY_PARITY32 ^ key.x ^ key.y ^ key.z ^ key.w
+    };
+    threefry4x32_inject_key(counter, ks, 0);
+    for(unsigned int s = 1; s <= 5; s++)
+    {
+        // Rounds 0-3 and 4-7 (mod 8) use different rotations
+        if(s % 2 == 1)
+        {
+            threefry4x32_even_round(counter, 10, 26);
+            threefry4x32_odd_round(counter, 11, 21);
+            threefry4x32_even_round(counter, 13, 27);
+            threefry4x32_odd_round(counter, 23, 5);
+        }
+        else
+        {
+            threefry4x32_even_round(counter, 6, 20);
+            threefry4x32_odd_round(counter, 17, 11);
+            threefry4x32_even_round(counter, 25, 10);
+            threefry4x32_odd_round(counter, 18, 20);
+        }
+        threefry4x32_inject_key(counter, ks, s);
+    }
+    return counter;
+}
+
+// Rounds of threefry4x32_20_engine, the 64-bit key is the lower half
+// of the 128-bit key (the upper half is 0)
+struct threefry4x32_20_rounds_type
+{
+    static FQUALIFIERS
+    uint4 apply(const uint4 counter, const uint2 key)
+    {
+        return threefry4x32_20_rounds(counter, uint4 { key.x, key.y, 0, 0 });
+    }
+};
+
+} // end detail namespace
+
+typedef threefry_engine<detail::threefry4x32_20_rounds_type> threefry4x32_20_engine;
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::threefry4x32_20_engine rocrand_state_threefry4x32_20;
+/// \endcond
+
+/**
+ * \brief Initializes Threefry4x32-20 state.
+ *
+ * Initializes the Threefry4x32-20 generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_threefry4x32_20 * state)
+{
+    *state = rocrand_state_threefry4x32_20(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using Threefry4x32-20 generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_threefry4x32_20 * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using Threefry4x32-20 generator in \p state.
+ * State is incremented by four positions.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand4(rocrand_state_threefry4x32_20 * state)
+{
+    return state->next4();
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range for a counter and a key, without state.
+ *
+ * Computes twenty Threefry4x32 rounds of \p counter with \p key (the upper
+ * 64 bits of the Threefry key are 0). Counters and keys are the same as of
+ * Philox: results are the same as rocrand4() of a state initialized by
+ * <tt>rocrand_init(seed, subsequence, 4 * index, state)</tt>, where \p key is
+ * <tt>rocrand_philox4x32_10_key(seed)</tt> and \p counter is
+ * <tt>rocrand_philox4x32_10_counter(subsequence, index)</tt>.
+ *
+ * \param counter - Counter (position of the numbers)
+ * \param key - Key (seed)
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand_threefry4x32_20_hash(const uint4 counter, const uint2 key)
+{
+    return rocrand_device::detail::threefry4x32_20_rounds_type::apply(counter, key);
+}
+
+/**
+ * \brief Updates Threefry4x32-20 state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_threefry4x32_20 * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates Threefry4x32-20 state to skip ahead by \p subsequence subsequences.
+ *
+ * Each subsequence is 4 * 2^64 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_threefry4x32_20 * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates Threefry4x32-20 state to skip ahead by \p sequence sequences.
+ *
+ * Each sequence is 4 * 2^64 numbers long (equal to the size of a subsequence).
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_sequence(unsigned long long sequence, rocrand_state_threefry4x32_20 * state)
+{
+    return state->discard_subsequence(sequence);
+}
+
+#endif // ROCRAND_THREEFRY4X32_20_H_
+
+/** @} */ // end of group rocranddevice
@@ -0,0 +1,279 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_TRUNCATED_NORMAL_H_
+#define ROCRAND_TRUNCATED_NORMAL_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#include <math.h>
+
+#include "rocrand_common.h"
+#include "rocrand_uniform.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// Standardized intervals which lie beyond this value (on either side) are
+// sampled by exponential rejection, others by the inverse CDF
+constexpr double truncated_normal_tail_threshold = 3.0;
+
+// Rational approximation of the inverse CDF of the standard normal
+// distribution (P. J. Acklam), relative error below 1.2e-9,
+// p is from (0, 0.5], the upper half is computed from the complement
+template<class RealType>
+FQUALIFIERS
+RealType normal_quantile_approx(const RealType p)
+{
+    if(p < RealType(0.02425))
+    {
+        const RealType t = sqrt(RealType(-2) * log(p));
+        return (((((RealType(-7.784894002430293e-03) * t + RealType(-3.223964580411365e-01)) * t
+            + RealType(-2.400758277161838e+00)) * t + RealType(-2.549732539343734e+00)) * t
+            + RealType(4.374664141464968e+00)) * t + RealType(2.938163982698783e+00))
+            / ((((RealType(7.784695709041462e-03) * t + RealType(3.224671290700398e-01)) * t
+            + RealType(2.445134137142996e+00)) * t + RealType(3.754408661907416e+00)) * t + RealType(1));
+    }
+    const RealType t = p - RealType(0.5);
+    const RealType r = t * t;
+    return (((((RealType(-3.969683028665376e+01) * r + RealType(2.209460984245205e+02)) * r
+        + RealType(-2.759285104469687e+02)) * r + RealType(1.383577518672690e+02)) * r
+        + RealType(-3.066479806614716e+01)) * r + RealType(2.506628277459239e+00)) * t
+        / (((((RealType(-5.447609879822406e+01) * r + RealType(1.615858368580409e+02)) * r
+        + RealType(-1.556989798598866e+02)) * r + RealType(6.680131188771972e+01)) * r
+        + RealType(-1.328068155288572e+01)) * r + RealType(1));
+}
+
+FQUALIFIERS
+float normal_quantile(const float p)
+{
+    return normal_quantile_approx(p);
+}
+
+// One step of Halley's method gives full double precision
+FQUALIFIERS
+double normal_quantile(const double p)
+{
+    const double x = normal_quantile_approx(p);
+    const double e = 0.5 * erfc(-x * ROCRAND_SQRT1_2_DOUBLE) - p;
+    const double u = e * ROCRAND_SQRT2PI_DOUBLE * exp(0.5 * x * x);
+    return x - u / (1.0 + 0.5 * x * u);
+}
+
+// Parameters of the standard normal distribution truncated to
+// [alpha, beta] = [(a - mean) / stddev, (b - mean) / stddev]. Intervals
+// beyond -truncated_normal_tail_threshold are mirrored to the positive
+// tail (sign is -1).
+template<class RealType>
+struct truncated_normal_params
+{
+    RealType mean;
+    RealType stddev;
+    // Values are clamped to [a, b] after scaling, which can round them out
+    RealType a;
+    RealType b;
+    RealType alpha;
+    RealType beta;
+    RealType sign;
+    bool tail;
+    // Inverse CDF: CDF of alpha, complementary CDF of beta and the mass of
+    // the interval, both ends are computed precisely from them
+    RealType cdf_alpha;
+    RealType ccdf_beta;
+    RealType mass;
+    // Exponential rejection (C. P. Robert): rate lambda of the proposal,
+    // 1 - exp(-lambda * (beta - alpha)) is its mass in the interval
+    RealType lambda;
+    RealType proposal_mass;
+
+    FQUALIFIERS
+    truncated_normal_params(RealType mean, RealType stddev, RealType a, RealType b)
+        : mean(mean), stddev(stddev), a(a), b(b),
+          alpha((a - mean) / stddev), beta((b - mean) / stddev),
+          sign(1), tail(false),
+          cdf_alpha(0), ccdf_beta(0), mass(0),
+          lambda(0), proposal_mass(0)
+    {
+        const RealType threshold = static_cast<RealType>(truncated_normal_tail_threshold);
+        if(beta <= -threshold)
+        {
+            const RealType t = alpha;
+            alpha = -beta;
+            beta = -t;
+            sign = RealType(-1);
+        }
+        tail = alpha >= threshold;
+        if(tail)
+        {
+            lambda = RealType(0.5) * (alpha + sqrt(alpha * alpha + RealType(4)));
+            proposal_mass = -expm1(-lambda * (beta - alpha));
+        }
+        else
+        {
+            const RealType s = static_cast<RealType>(ROCRAND_SQRT1_2_DOUBLE);
+            cdf_alpha = RealType(0.5) * erfc(-alpha * s);
+            ccdf_beta = RealType(0.5) * erfc(beta * s);
+            if(alpha >= RealType(0))
+            {
+                mass = RealType(0.5) * erfc(alpha * s) - ccdf_beta;
+            }
+            else if(beta <= RealType(0))
+            {
+                mass = RealType(0.5) * erfc(-beta * s) - cdf_alpha;
+            }
+            else
+            {
+                mass = RealType(1) - cdf_alpha - ccdf_beta;
+            }
+        }
+    }
+
+    // Value of the inverse CDF of uniform u from (0, 1]
+    FQUALIFIERS
+    RealType central(const RealType u) const
+    {
+        const RealType p = cdf_alpha + u * mass;
+        const RealType q = ccdf_beta + (RealType(1) - u) * mass;
+        const RealType x = p < q ? normal_quantile(p) : -normal_quantile(q);
+        return fmin(fmax(mean + stddev * x, a), b);
+    }
+
+    // One attempt of exponential rejection with uniforms u and v from (0, 1],
+    // the proposal is truncated to the interval
+    FQUALIFIERS
+    bool tail_attempt(const RealType u, const RealType v, RealType& result) const
+    {
+        const RealType w = proposal_mass < RealType(0.5)
+            ? log1p(proposal_mass * (u - RealType(1)))
+            : log((RealType(1) - proposal_mass) + proposal_mass * u);
+        const RealType z = alpha - w / lambda;
+        const RealType d = z - lambda;
+        result = fmin(fmax(mean + stddev * sign * z, a), b);
+        return d * d <= RealType(-2) * log(v);
+    }
+};
+
+template<class State>
+FQUALIFIERS
+float truncated_normal_distribution(State state, const truncated_normal_params<float>& params)
+{
+    if(!params.tail)
+    {
+        return params.central(rocrand_uniform(state));
+    }
+    float result;
+    bool accepted;
+    do
+    {
+        const float u = rocrand_uniform(state);
+        const float v = rocrand_uniform(state);
+        accepted = params.tail_attempt(u, v, result);
+    }
+    while(!accepted);
+    return result;
+}
+
+template<class State>
+FQUALIFIERS
+double truncated_normal_distribution_double(State state, const truncated_normal_params<double>& params)
+{
+    if(!params.tail)
+    {
+        return params.central(rocrand_uniform_double(state));
+    }
+    double result;
+    bool accepted;
+    do
+    {
+        const double u = rocrand_uniform_double(state);
+        const double v = rocrand_uniform_double(state);
+        accepted = params.tail_attempt(u, v, result);
+    }
+    while(!accepted);
+    return result;
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Returns a truncated normally distributed <tt>float</tt> value.
+ *
+ * Generates and returns a normally distributed random <tt>float</tt> value
+ * with mean \p mean and standard deviation \p stddev conditioned on
+ * the interval [\p a, \p b] using the generator in \p state, which can be
+ * the state of any generator with rocrand_uniform(). Values of intervals
+ * which do not lie beyond 3 standard deviations from the mean are computed
+ * by the inverse CDF (state is incremented by one position), values of
+ * intervals in the tails by the exponential rejection method of Robert
+ * (state is incremented by a variable amount, about 2.1 positions).
+ * Acceptance does not degrade in the tails.
+ *
+ * \param state - Pointer to a state to use
+ * \param mean - Mean of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution (greater than 0)
+ * \param a - Lower bound of the interval, can be -INFINITY
+ * \param b - Upper bound of the interval (greater than \p a), can be INFINITY
+ *
+ * \return Truncated normally distributed <tt>float</tt> value from [\p a, \p b]
+ */
+template<class State>
+FQUALIFIERS
+float rocrand_truncated_normal(State * state, float mean, float stddev, float a, float b)
+{
+    const rocrand_device::detail::truncated_normal_params<float> params(mean, stddev, a, b);
+    return rocrand_device::detail::truncated_normal_distribution(state, params);
+}
+
+/**
+ * \brief Returns a truncated normally distributed <tt>double</tt> value.
+ *
+ * Generates and returns a normally distributed random <tt>double</tt> value
+ * with mean \p mean and standard deviation \p stddev conditioned on
+ * the interval [\p a, \p b] using the generator in \p state, which can be
+ * the state of any generator with rocrand_uniform_double(). Methods are
+ * the same as of rocrand_truncated_normal().
+ *
+ * \param state - Pointer to a state to use
+ * \param mean - Mean of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution (greater than 0)
+ * \param a - Lower bound of the interval, can be -INFINITY
+ * \param b - Upper bound of the interval (greater than \p a), can be INFINITY
+ *
+ * \return Truncated normally distributed <tt>double</tt> value from [\p a, \p b]
+ */
+template<class State>
+FQUALIFIERS
+double rocrand_truncated_normal_double(State * state, double mean, double stddev, double a, double b)
+{
+    const rocrand_device::detail::truncated_normal_params<double> params(mean, stddev, a, b);
+    return rocrand_device::detail::truncated_normal_distribution_double(state, params);
+}
+
+#endif // ROCRAND_TRUNCATED_NORMAL_H_
+
+/** @} */ // end of group rocranddevice
@@ -31,11 +31,21 @@
 #endif // FQUALIFIERS
 
 #include "rocrand_philox4x32_10.h"
+#include "rocrand_threefry4x32_20.h"
+#include "rocrand_threefry2x64_20.h"
+#include "rocrand_philox4x64_10.h"
 #include "rocrand_mrg32k3a.h"
 #include "rocrand_xorwow.h"
+#include "rocrand_xoshiro128pp.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
 #include "rocrand_mtgp32.h"
 
+#include <hip/hip_fp16.h>
+
 namespace rocrand_device {
 namespace detail {
 
@@ -59,6 +69,15 @@ float uniform_distribution(unsigned int v)
     return ROCRAND_2POW32_INV + (v * ROCRAND_2POW32_INV);
 }
 
+// For unsigned integer between 0 and ULLONG_MAX, returns value between
+// 0.0f and 1.0f, excluding 0.0f and including 1.0f. Only the 32 most
+// significant bits are used.
+FQUALIFIERS
+float uniform_distribution(unsigned long long v)
+{
+    return uniform_distribution(static_cast<unsigned int>(v >> 32));
+}
+
 FQUALIFIERS
 float4 uniform_distribution4(uint4 v)
 {
@@ -144,6 +163,143 @@ double mrg_uniform_distribution_double(unsigned int v)
     return ret;
 }
 
+FQUALIFIERS
+float4 mrg_uniform_distribution4(uint4 v)
+{
+    return float4 {
+        mrg_uniform_distribution(v.x),
+        mrg_uniform_distribution(v.y),
+        mrg_uniform_distribution(v.z),
+        mrg_uniform_distribution(v.w)
+    };
+}
+
+// For unsigned integer between 0 and UINT_MAX, returns two half values
+// between 0.0 and 1.0 (excluding 0.0, including 1.0) computed from
+// the low and the high 16 bits of v.
+FQUALIFIERS
+__half2 uniform_distribution_half2(unsigned int v)
+{
+    return __floats2half2_rn(
+        ROCRAND_2POW16_INV + ((v & 0xffff) * ROCRAND_2POW16_INV),
+        ROCRAND_2POW16_INV + ((v >> 16) * ROCRAND_2POW16_INV)
+    );
+}
+
+// Returns one half value from all bits of v (used by quasi-random
+// generators, both halves of a point are not independent).
+FQUALIFIERS
+__half uniform_distribution_half(unsigned int v)
+{
+    return __float2half(uniform_distribution(v));
+}
+
+FQUALIFIERS
+__half uniform_distribution_half(unsigned long long v)
+{
+    return __float2half(uniform_distribution(v));
+}
+
+// Returns the high 64 bits of the 128-bit product of x and y
+FQUALIFIERS
+unsigned long long mul_hi_u64(unsigned long long x, unsigned long long y)
+{
+    const unsigned long long x0 = x & 0xffffffffULL;
+    const unsigned long long x1 = x >> 32;
+    const unsigned long long y0 = y & 0xffffffffULL;
+    const unsigned long long y1 = y >> 32;
+    const unsigned long long p00 = x0 * y0;
+    const unsigned long long p01 = x0 * y1;
+    const unsigned long long p10 = x1 * y0;
+    const unsigned long long p11 = x1 * y1;
+    const unsigned long long middle =
+        (p00 >> 32) + (p01 & 0xffffffffULL) + (p10 & 0xffffffffULL);
+    return p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+}
+
+// Lemire's multiply-shift method: the high part of x * range is uniformly
+// distributed in [0, range) if x is rejected when the low part of the
+// product is less than threshold = 2^32 mod range.
+FQUALIFIERS
+bool uniform_int_accept(unsigned int x,
+                        unsigned int range,
+                        unsigned int threshold,
+                        unsigned int& result)
+{
+    const unsigned long long m = static_cast<unsigned long long>(x) * range;
+    if(static_cast<unsigned int>(m) < threshold)
+    {
+        return false;
+    }
+    result = static_cast<unsigned int>(m >> 32);
+    return true;
+}
+
+// The same for 64-bit x and range, threshold = 2^64 mod range.
+FQUALIFIERS
+bool uniform_int_accept(unsigned long long x,
+                        unsigned long long range,
+                        unsigned long long threshold,
+                        unsigned long long& result)
+{
+    if(x * range < threshold)
+    {
+        return false;
+    }
+    result = mul_hi_u64(x, range);
+    return true;
+}
+
+// Returns a value uniformly distributed in [lo, hi), the threshold is
+// computed only when the low part of the product is less than range
+// (which is rare for small ranges), so the modulo is avoided in most cases.
+template<class StateType>
+FQUALIFIERS
+unsigned int uniform_int(StateType * state, unsigned int lo, unsigned int hi)
+{
+    const unsigned int range = hi - lo;
+    if(range == 0)
+    {
+        return lo;
+    }
+    unsigned long long m = static_cast<unsigned long long>(rocrand(state)) * range;
+    if(static_cast<unsigned int>(m) < range)
+    {
+        const unsigned int threshold = (0U - range) % range;
+        while(static_cast<unsigned int>(m) < threshold)
+        {
+            m = static_cast<unsigned long long>(rocrand(state)) * range;
+        }
+    }
+    return lo + static_cast<unsigned int>(m >> 32);
+}
+
+// 64-bit values are drawn from two 32-bit numbers.
+template<class StateType>
+FQUALIFIERS
+unsigned long long uniform_long_long(StateType * state,
+                                     unsigned long long lo,
+                                     unsigned long long hi)
+{
+    const unsigned long long range = hi - lo;
+    if(range == 0)
+    {
+        return lo;
+    }
+    unsigned long long x = rocrand(state);
+    x = (x << 32) | rocrand(state);
+    if(x * range < range)
+    {
+        const unsigned long long threshold = (0ULL - range) % range;
+        while(x * range < threshold)
+        {
+            x = rocrand(state);
+            x = (x << 32) | rocrand(state);
+        }
+    }
+    return lo + mul_hi_u64(x, range);
+}
+
 } // end namespace detail
 } // end namespace rocrand_device
 
@@ -165,6 +321,19 @@ float rocrand_uniform(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::uniform_distribution(rocrand(state));
 }
 
+/**
+ * \brief Same as rocrand_uniform() for a compact Philox \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_philox4x32_10_compact * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
 /**
  * \brief Returns two uniformly distributed random <tt>float</tt> values
  * from (0; 1] range.
@@ -222,6 +391,19 @@ double rocrand_uniform_double(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
 }
 
+/**
+ * \brief Same as rocrand_uniform_double() for a compact Philox \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_philox4x32_10_compact * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
 /**
  * \brief Returns two uniformly distributed random <tt>double</tt> values
  * from (0; 1] range.
@@ -258,12 +440,12 @@ double4 rocrand_uniform_double4(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
 }
 
- /**
+/**
  * \brief Returns a uniformly distributed random <tt>float</tt> value
  * from (0; 1] range.
  *
  * Generates and returns a uniformly distributed \p float value from (0; 1] range
- * (excluding \p 0.0f, including \p 1.0f) using MRG32K3A generator in \p state, and
+ * (excluding \p 0.0f, including \p 1.0f) using Threefry4x32-20 generator in \p state, and
  * increments position of the generator by one.
  *
  * \param state - Pointer to a state to use
@@ -271,56 +453,56 @@ double4 rocrand_uniform_double4(rocrand_state_philox4x32_10 * state)
  * \return Uniformly distributed \p float value from (0; 1] range.
  */
 FQUALIFIERS
-float rocrand_uniform(rocrand_state_mrg32k3a * state)
+float rocrand_uniform(rocrand_state_threefry4x32_20 * state)
 {
-    return rocrand_device::detail::mrg_uniform_distribution(rocrand(state));
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
 }
 
- /**
- * \brief Returns a uniformly distributed random <tt>double</tt> value
+/**
+ * \brief Returns two uniformly distributed random <tt>float</tt> values
  * from (0; 1] range.
  *
- * Generates and returns a uniformly distributed \p double value from (0; 1] range
- * (excluding \p 0.0, including \p 1.0) using MRG32K3A generator in \p state, and
- * increments position of the generator by one.
+ * Generates and returns two uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Threefry4x32-20 generator in \p state, and
+ * increments position of the generator by two.
  *
  * \param state - Pointer to a state to use
  *
- * Note: In this implementation returned \p double value is generated
- * from only 32 random bits (one <tt>unsigned int</tt> value).
- *
- * \return Uniformly distributed \p double value from (0; 1] range.
+ * \return Two uniformly distributed \p float values from (0; 1] range as \p float2.
  */
 FQUALIFIERS
-double rocrand_uniform_double(rocrand_state_mrg32k3a * state)
+float2 rocrand_uniform2(rocrand_state_threefry4x32_20 * state)
 {
-    return rocrand_device::detail::mrg_uniform_distribution_double(rocrand(state));
+    return float2 {
+        rocrand_device::detail::uniform_distribution(rocrand(state)),
+        rocrand_device::detail::uniform_distribution(rocrand(state))
+    };
 }
 
- /**
- * \brief Returns a uniformly distributed random <tt>float</tt> value
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
  * from (0; 1] range.
  *
- * Generates and returns a uniformly distributed \p float value from (0; 1] range
- * (excluding \p 0.0f, including \p 1.0f) using XORWOW generator in \p state, and
- * increments position of the generator by one.
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Threefry4x32-20 generator in \p state, and
+ * increments position of the generator by four.
  *
  * \param state - Pointer to a state to use
  *
- * \return Uniformly distributed \p float value from (0; 1] range.
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
  */
 FQUALIFIERS
-float rocrand_uniform(rocrand_state_xorwow * state)
+float4 rocrand_uniform4(rocrand_state_threefry4x32_20 * state)
 {
-    return rocrand_device::detail::uniform_distribution(rocrand(state));
+    return rocrand_device::detail::uniform_distribution4(rocrand4(state));
 }
 
- /**
+/**
  * \brief Returns a uniformly distributed random <tt>double</tt> value
  * from (0; 1] range.
  *
  * Generates and returns a uniformly distributed \p double value from (0; 1] range
- * (excluding \p 0.0, including \p 1.0) using MRG32K3A generator in \p state, and
+ * (excluding \p 0.0, including \p 1.0) using Threefry4x32-20 generator in \p state, and
  * increments position of the generator by two.
  *
  * \param state - Pointer to a state to use
@@ -328,17 +510,53 @@ float rocrand_uniform(rocrand_state_xorwow * state)
  * \return Uniformly distributed \p double value from (0; 1] range.
  */
 FQUALIFIERS
-double rocrand_uniform_double(rocrand_state_xorwow * state)
+double rocrand_uniform_double(rocrand_state_threefry4x32_20 * state)
 {
     return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
 }
 
- /**
+/**
+ * \brief Returns two uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Threefry4x32-20 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p double values from (0; 1] range as \p double2.
+ */
+FQUALIFIERS
+double2 rocrand_uniform_double2(rocrand_state_threefry4x32_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Threefry4x32-20 generator in \p state, and
+ * increments position of the generator by eight.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p double values from (0; 1] range as \p double4.
+ */
+FQUALIFIERS
+double4 rocrand_uniform_double4(rocrand_state_threefry4x32_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
+}
+
+/**
  * \brief Returns a uniformly distributed random <tt>float</tt> value
  * from (0; 1] range.
  *
  * Generates and returns a uniformly distributed \p float value from (0; 1] range
- * (excluding \p 0.0f, including \p 1.0f) using MTGP32 generator in \p state, and
+ * (excluding \p 0.0f, including \p 1.0f) using Threefry2x64-20 generator in \p state, and
  * increments position of the generator by one.
  *
  * \param state - Pointer to a state to use
@@ -346,38 +564,110 @@ double rocrand_uniform_double(rocrand_state_xorwow * state)
  * \return Uniformly distributed \p float value from (0; 1] range.
  */
 FQUALIFIERS
-float rocrand_uniform(rocrand_state_mtgp32 * state)
+float rocrand_uniform(rocrand_state_threefry2x64_20 * state)
 {
     return rocrand_device::detail::uniform_distribution(rocrand(state));
 }
 
+/**
+ * \brief Returns two uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Threefry2x64-20 generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p float values from (0; 1] range as \p float2.
+ */
+FQUALIFIERS
+float2 rocrand_uniform2(rocrand_state_threefry2x64_20 * state)
+{
+    return float2 {
+        rocrand_device::detail::uniform_distribution(rocrand(state)),
+        rocrand_device::detail::uniform_distribution(rocrand(state))
+    };
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Threefry2x64-20 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution4(rocrand4(state));
+}
+
 /**
  * \brief Returns a uniformly distributed random <tt>double</tt> value
  * from (0; 1] range.
  *
  * Generates and returns a uniformly distributed \p double value from (0; 1] range
- * (excluding \p 0.0, including \p 1.0) using MTGP32 generator in \p state, and
- * increments position of the generator by one.
+ * (excluding \p 0.0, including \p 1.0) using Threefry2x64-20 generator in \p state, and
+ * increments position of the generator by two.
  *
  * \param state - Pointer to a state to use
  *
- * Note: In this implementation returned \p double value is generated
- * from only 32 random bits (one <tt>unsigned int</tt> value).
- *
  * \return Uniformly distributed \p double value from (0; 1] range.
  */
 FQUALIFIERS
-double rocrand_uniform_double(rocrand_state_mtgp32 * state)
+double rocrand_uniform_double(rocrand_state_threefry2x64_20 * state)
 {
-    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
 }
 
- /**
+/**
+ * \brief Returns two uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Threefry2x64-20 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p double values from (0; 1] range as \p double2.
+ */
+FQUALIFIERS
+double2 rocrand_uniform_double2(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Threefry2x64-20 generator in \p state, and
+ * increments position of the generator by eight.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p double values from (0; 1] range as \p double4.
+ */
+FQUALIFIERS
+double4 rocrand_uniform_double4(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
+}
+
+/**
  * \brief Returns a uniformly distributed random <tt>float</tt> value
  * from (0; 1] range.
  *
  * Generates and returns a uniformly distributed \p float value from (0; 1] range
- * (excluding \p 0.0f, including \p 1.0f) using SOBOL32 generator in \p state, and
+ * (excluding \p 0.0f, including \p 1.0f) using Philox4x64-10 generator in \p state, and
  * increments position of the generator by one.
  *
  * \param state - Pointer to a state to use
@@ -385,30 +675,1027 @@ double rocrand_uniform_double(rocrand_state_mtgp32 * state)
  * \return Uniformly distributed \p float value from (0; 1] range.
  */
 FQUALIFIERS
-float rocrand_uniform(rocrand_state_sobol32 * state)
+float rocrand_uniform(rocrand_state_philox4x64_10 * state)
 {
     return rocrand_device::detail::uniform_distribution(rocrand(state));
 }
 
 /**
- * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * \brief Returns two uniformly distributed random <tt>float</tt> values
  * from (0; 1] range.
  *
- * Generates and returns a uniformly distributed \p double value from (0; 1] range
- * (excluding \p 0.0, including \p 1.0) using SOBOL32 generator in \p state, and
- * increments position of the generator by one.
+ * Generates and returns two uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Philox4x64-10 generator in \p state, and
+ * increments position of the generator by two.
  *
  * \param state - Pointer to a state to use
  *
- * Note: In this implementation returned \p double value is generated
- * from only 32 random bits (one <tt>unsigned int</tt> value).
+ * \return Two uniformly distributed \p float values from (0; 1] range as \p float2.
+ */
+FQUALIFIERS
+float2 rocrand_uniform2(rocrand_state_philox4x64_10 * state)
+{
+    return float2 {
+        rocrand_device::detail::uniform_distribution(rocrand(state)),
+        rocrand_device::detail::uniform_distribution(rocrand(state))
+    };
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
  *
- * \return Uniformly distributed \p double value from (0; 1] range.
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Philox4x64-10 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
  */
 FQUALIFIERS
-double rocrand_uniform_double(rocrand_state_sobol32 * state)
+float4 rocrand_uniform4(rocrand_state_philox4x64_10 * state)
 {
-    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+    return rocrand_device::detail::uniform_distribution4(rocrand4(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox4x64-10 generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_philox4x64_10 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox4x64-10 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p double values from (0; 1] range as \p double2.
+ */
+FQUALIFIERS
+double2 rocrand_uniform_double2(rocrand_state_philox4x64_10 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox4x64-10 generator in \p state, and
+ * increments position of the generator by eight.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p double values from (0; 1] range as \p double4.
+ */
+FQUALIFIERS
+double4 rocrand_uniform_double4(rocrand_state_philox4x64_10 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using xoshiro128++ generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using xoshiro128++ generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p float values from (0; 1] range as \p float2.
+ */
+FQUALIFIERS
+float2 rocrand_uniform2(rocrand_state_xoshiro128pp * state)
+{
+    return float2 {
+        rocrand_device::detail::uniform_distribution(rocrand(state)),
+        rocrand_device::detail::uniform_distribution(rocrand(state))
+    };
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using xoshiro128++ generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::uniform_distribution4(rocrand4(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using xoshiro128++ generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using xoshiro128++ generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p double values from (0; 1] range as \p double2.
+ */
+FQUALIFIERS
+double2 rocrand_uniform_double2(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::uniform_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using xoshiro128++ generator in \p state, and
+ * increments position of the generator by eight.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p double values from (0; 1] range as \p double4.
+ */
+FQUALIFIERS
+double4 rocrand_uniform_double4(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using PCG32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using PCG32 generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p float values from (0; 1] range as \p float2.
+ */
+FQUALIFIERS
+float2 rocrand_uniform2(rocrand_state_pcg32 * state)
+{
+    return float2 {
+        rocrand_device::detail::uniform_distribution(rocrand(state)),
+        rocrand_device::detail::uniform_distribution(rocrand(state))
+    };
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using PCG32 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::uniform_distribution4(rocrand4(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using PCG32 generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using PCG32 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p double values from (0; 1] range as \p double2.
+ */
+FQUALIFIERS
+double2 rocrand_uniform_double2(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using PCG32 generator in \p state, and
+ * increments position of the generator by eight.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p double values from (0; 1] range as \p double4.
+ */
+FQUALIFIERS
+double4 rocrand_uniform_double4(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range for a Philox counter and key, without state.
+ *
+ * Returns the first value of rocrand_uniform4_at().
+ *
+ * \param counter - Counter (see rocrand_philox4x32_10_counter())
+ * \param key - Key (see rocrand_philox4x32_10_key())
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform_at(const uint4 counter, const uint2 key)
+{
+    return rocrand_device::detail::uniform_distribution(
+        rocrand_philox4x32_10_hash(counter, key).x
+    );
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range for a Philox counter and key, without state.
+ *
+ * Returns uniformly distributed \p float values from (0; 1] range of the numbers
+ * of rocrand_philox4x32_10_hash(), the same values as rocrand_uniform4()
+ * of the corresponding state.
+ *
+ * \param counter - Counter (see rocrand_philox4x32_10_counter())
+ * \param key - Key (see rocrand_philox4x32_10_key())
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4_at(const uint4 counter, const uint2 key)
+{
+    return rocrand_device::detail::uniform_distribution4(
+        rocrand_philox4x32_10_hash(counter, key)
+    );
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range for a Philox counter and key, without state.
+ *
+ * Returns uniformly distributed \p double values from (0; 1] range of the numbers
+ * of rocrand_philox4x32_10_hash(), the same values as rocrand_uniform_double2()
+ * of the corresponding state.
+ *
+ * \param counter - Counter (see rocrand_philox4x32_10_counter())
+ * \param key - Key (see rocrand_philox4x32_10_key())
+ *
+ * \return Two uniformly distributed \p double values from (0; 1] range as \p double2.
+ */
+FQUALIFIERS
+double2 rocrand_uniform_double2_at(const uint4 counter, const uint2 key)
+{
+    return rocrand_device::detail::uniform_distribution_double2(
+        rocrand_philox4x32_10_hash(counter, key)
+    );
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using MRG32K3A generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::mrg_uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Same as rocrand_uniform() for a compact MRG32K3A \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_mrg32k3a_compact * state)
+{
+    return rocrand_device::detail::mrg_uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using MRG32K3A generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::mrg_uniform_distribution4(rocrand4(state));
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using MRG32K3A generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::mrg_uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Same as rocrand_uniform_double() for a compact MRG32K3A \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_mrg32k3a_compact * state)
+{
+    return rocrand_device::detail::mrg_uniform_distribution_double(rocrand(state));
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using XORWOW generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Same as rocrand_uniform() for a compact XORWOW \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using XORWOW generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::uniform_distribution4(rocrand4(state));
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using MRG32K3A generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Same as rocrand_uniform_double() for a compact XORWOW \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using MTGP32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_mtgp32 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using MTGP32 generator in \p state, and
+ * increments position of the generator by four.
+ * The function must be called by all threads of the block.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_mtgp32 * state)
+{
+    return rocrand_device::detail::uniform_distribution4(rocrand4(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using MTGP32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_mtgp32 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using SOBOL32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_sobol32 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using SOBOL32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_sobol32 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using SCRAMBLED_SOBOL32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_scrambled_sobol32 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using SCRAMBLED_SOBOL32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_scrambled_sobol32 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using SOBOL64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p float value is generated
+ * from the 32 most significant bits of one <tt>unsigned long long</tt> value.
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_sobol64 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using SOBOL64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from 53 most significant bits of one <tt>unsigned long long</tt> value.
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_sobol64 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using SCRAMBLED_SOBOL64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p float value is generated
+ * from the 32 most significant bits of one <tt>unsigned long long</tt> value.
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_scrambled_sobol64 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using SCRAMBLED_SOBOL64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from 53 most significant bits of one <tt>unsigned long long</tt> value.
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_scrambled_sobol64 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>__half</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p __half values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox generator in \p state, and
+ * increments position of the generator by one. Each value is computed from
+ * 16 bits of one <tt>unsigned int</tt> value.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p __half values from (0; 1] range as \p __half2.
+ */
+FQUALIFIERS
+__half2 rocrand_uniform_half2(rocrand_state_philox4x32_10 * state)
+{
+    return rocrand_device::detail::uniform_distribution_half2(rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>__half</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p __half values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using MRG32K3A generator in \p state, and
+ * increments position of the generator by one. Each value is computed from
+ * 16 bits of one <tt>unsigned int</tt> value.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p __half values from (0; 1] range as \p __half2.
+ */
+FQUALIFIERS
+__half2 rocrand_uniform_half2(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::uniform_distribution_half2(rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>__half</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p __half values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using XORWOW generator in \p state, and
+ * increments position of the generator by one. Each value is computed from
+ * 16 bits of one <tt>unsigned int</tt> value.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p __half values from (0; 1] range as \p __half2.
+ */
+FQUALIFIERS
+__half2 rocrand_uniform_half2(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::uniform_distribution_half2(rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>__half</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p __half values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using MTGP32 generator in \p state, and
+ * increments position of the generator by one. Each value is computed from
+ * 16 bits of one <tt>unsigned int</tt> value.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p __half values from (0; 1] range as \p __half2.
+ */
+FQUALIFIERS
+__half2 rocrand_uniform_half2(rocrand_state_mtgp32 * state)
+{
+    return rocrand_device::detail::uniform_distribution_half2(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>unsigned int</tt> value
+ * from [lo; hi) range.
+ *
+ * Generates and returns a uniformly distributed \p unsigned \p int value from [lo; hi)
+ * range using Philox generator in \p state and Lemire's multiply-shift method.
+ * Values which would introduce bias are rejected, so the position of the generator
+ * is incremented by one or (rarely) more.
+ *
+ * \param state - Pointer to a state to use
+ * \param lo - Lower bound of the range (inclusive)
+ * \param hi - Upper bound of the range (exclusive), must be greater than \p lo
+ *
+ * \return Uniformly distributed \p unsigned \p int value from [lo; hi) range.
+ */
+FQUALIFIERS
+unsigned int rocrand_uniform_int(rocrand_state_philox4x32_10 * state,
+                                 unsigned int lo, unsigned int hi)
+{
+    return rocrand_device::detail::uniform_int(state, lo, hi);
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>unsigned long long</tt> value
+ * from [lo; hi) range.
+ *
+ * Generates and returns a uniformly distributed \p unsigned \p long \p long value
+ * from [lo; hi) range using Philox generator in \p state and Lemire's
+ * multiply-shift method. Each candidate value is drawn from two <tt>unsigned int</tt>
+ * values, so the position of the generator is incremented by two or (rarely) more.
+ *
+ * \param state - Pointer to a state to use
+ * \param lo - Lower bound of the range (inclusive)
+ * \param hi - Upper bound of the range (exclusive), must be greater than \p lo
+ *
+ * \return Uniformly distributed \p unsigned \p long \p long value from [lo; hi) range.
+ */
+FQUALIFIERS
+unsigned long long rocrand_uniform_long_long(rocrand_state_philox4x32_10 * state,
+                                             unsigned long long lo,
+                                             unsigned long long hi)
+{
+    return rocrand_device::detail::uniform_long_long(state, lo, hi);
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>unsigned int</tt> value
+ * from [lo; hi) range.
+ *
+ * Generates and returns a uniformly distributed \p unsigned \p int value from [lo; hi)
+ * range using MRG32K3A generator in \p state and Lemire's multiply-shift method.
+ * Values which would introduce bias are rejected, so the position of the generator
+ * is incremented by one or (rarely) more.
+ *
+ * \param state - Pointer to a state to use
+ * \param lo - Lower bound of the range (inclusive)
+ * \param hi - Upper bound of the range (exclusive), must be greater than \p lo
+ *
+ * \return Uniformly distributed \p unsigned \p int value from [lo; hi) range.
+ */
+FQUALIFIERS
+unsigned int rocrand_uniform_int(rocrand_state_mrg32k3a * state,
+                                 unsigned int lo, unsigned int hi)
+{
+    return rocrand_device::detail::uniform_int(state, lo, hi);
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>unsigned long long</tt> value
+ * from [lo; hi) range.
+ *
+ * Generates and returns a uniformly distributed \p unsigned \p long \p long value
+ * from [lo; hi) range using MRG32K3A generator in \p state and Lemire's
+ * multiply-shift method. Each candidate value is drawn from two <tt>unsigned int</tt>
+ * values, so the position of the generator is incremented by two or (rarely) more.
+ *
+ * \param state - Pointer to a state to use
+ * \param lo - Lower bound of the range (inclusive)
+ * \param hi - Upper bound of the range (exclusive), must be greater than \p lo
+ *
+ * \return Uniformly distributed \p unsigned \p long \p long value from [lo; hi) range.
+ */
+FQUALIFIERS
+unsigned long long rocrand_uniform_long_long(rocrand_state_mrg32k3a * state,
+                                             unsigned long long lo,
+                                             unsigned long long hi)
+{
+    return rocrand_device::detail::uniform_long_long(state, lo, hi);
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>unsigned int</tt> value
+ * from [lo; hi) range.
+ *
+ * Generates and returns a uniformly distributed \p unsigned \p int value from [lo; hi)
+ * range using XORWOW generator in \p state and Lemire's multiply-shift method.
+ * Values which would introduce bias are rejected, so the position of the generator
+ * is incremented by one or (rarely) more.
+ *
+ * \param state - Pointer to a state to use
+ * \param lo - Lower bound of the range (inclusive)
+ * \param hi - Upper bound of the range (exclusive), must be greater than \p lo
+ *
+ * \return Uniformly distributed \p unsigned \p int value from [lo; hi) range.
+ */
+FQUALIFIERS
+unsigned int rocrand_uniform_int(rocrand_state_xorwow * state,
+                                 unsigned int lo, unsigned int hi)
+{
+    return rocrand_device::detail::uniform_int(state, lo, hi);
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>unsigned long long</tt> value
+ * from [lo; hi) range.
+ *
+ * Generates and returns a uniformly distributed \p unsigned \p long \p long value
+ * from [lo; hi) range using XORWOW generator in \p state and Lemire's
+ * multiply-shift method. Each candidate value is drawn from two <tt>unsigned int</tt>
+ * values, so the position of the generator is incremented by two or (rarely) more.
+ *
+ * \param state - Pointer to a state to use
+ * \param lo - Lower bound of the range (inclusive)
+ * \param hi - Upper bound of the range (exclusive), must be greater than \p lo
+ *
+ * \return Uniformly distributed \p unsigned \p long \p long value from [lo; hi) range.
+ */
+FQUALIFIERS
+unsigned long long rocrand_uniform_long_long(rocrand_state_xorwow * state,
+                                             unsigned long long lo,
+                                             unsigned long long hi)
+{
+    return rocrand_device::detail::uniform_long_long(state, lo, hi);
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range computed from one <tt>unsigned int</tt> value.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) from one value of rocrand() of \p state, and
+ * increments position of the generator by one. Values are multiples of 2^-32, they
+ * are computed as values of rocrand_generate_uniform_double() with
+ * ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT (see rocrand_set_double_resolution()).
+ *
+ * \tparam StateType - State of a pseudo-random number generator
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+template<class StateType>
+FQUALIFIERS
+double rocrand_uniform_double_fast(StateType * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range computed from two <tt>unsigned int</tt> values.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) from two values of rocrand() of \p state
+ * (53 random bits), and increments position of the generator by two. Values are
+ * computed as values of rocrand_generate_uniform_double() with
+ * ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT (see rocrand_set_double_resolution()).
+ *
+ * \tparam StateType - State of a pseudo-random number generator
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+template<class StateType>
+FQUALIFIERS
+double rocrand_uniform_double_full(StateType * state)
+{
+    const unsigned int v1 = rocrand(state);
+    const unsigned int v2 = rocrand(state);
+    return rocrand_device::detail::uniform_distribution_double(v1, v2);
 }
 
 #endif // ROCRAND_UNIFORM_H_
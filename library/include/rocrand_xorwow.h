@@ -26,7 +26,27 @@
 #endif // FQUALIFIERS_
 
 #include "rocrand_common.h"
+#ifdef ROCRAND_EXTERNAL_TABLES
+#include "rocrand_external_tables.h"
+#else
 #include "rocrand_xorwow_precomputed.h"
+#endif
+
+// Tables generated before jump bases were configurable have one matrix per digit
+#ifndef XORWOW_JUMP_MULTIPLES
+#define XORWOW_JUMP_MULTIPLES 1
+#endif
+
+// Jump matrices of the library, of device code or of host code
+#if defined(ROCRAND_EXTERNAL_TABLES)
+#define ROCRAND_DETAIL_XORWOW_TABLE(name) \
+    reinterpret_cast<const unsigned int (*)[XORWOW_SIZE]>( \
+        ::rocrand_device::detail::precomputed_tables().xorwow_##name)
+#elif defined(__HIP_DEVICE_COMPILE__)
+#define ROCRAND_DETAIL_XORWOW_TABLE(name) d_xorwow_##name
+#else
+#define ROCRAND_DETAIL_XORWOW_TABLE(name) h_xorwow_##name
+#endif
 
 // G. Marsaglia, Xorshift RNGs, 2003
 // http://www.jstatsoft.org/v08/i14/paper
@@ -71,47 +91,71 @@ void mul_mat_vec_inplace(const unsigned int * m, unsigned int * v)
     copy_vec(v, r);
 }
 
-} // end detail namespace
-
-class xorwow_engine
+// State of xorwow_engine
+struct xorwow_state
 {
-public:
-    struct xorwow_state
-    {
-        // Xorshift values (160 bits)
-        unsigned int x[5];
+    // Xorshift values (160 bits)
+    unsigned int x[5];
+
+    // Weyl sequence value
+    unsigned int d;
 
-        // Weyl sequence value
-        unsigned int d;
+    #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+    // The Box–Muller transform requires two inputs to convert uniformly
+    // distributed real values [0; 1] to normally distributed real values
+    // (with mean = 0, and stddev = 1). Often user wants only one
+    // normally distributed number, to save performance and random
+    // numbers the 2nd value is saved for future requests.
+    unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+    unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+    float boxmuller_float; // normally distributed float
+    double boxmuller_double; // normally distributed double
+    #endif
 
+    FQUALIFIERS
+    void reset_boxmuller()
+    {
         #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
-        // The Box–Muller transform requires two inputs to convert uniformly
-        // distributed real values [0; 1] to normally distributed real values
-        // (with mean = 0, and stddev = 1). Often user wants only one
-        // normally distributed number, to save performance and random
-        // numbers the 2nd value is saved for future requests.
-        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
-        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
-        float boxmuller_float; // normally distributed float
-        double boxmuller_double; // normally distributed double
+        boxmuller_float_state = 0;
+        boxmuller_double_state = 0;
         #endif
+    }
 
-        FQUALIFIERS
-        ~xorwow_state() { }
-    };
+    FQUALIFIERS
+    ~xorwow_state() { }
+};
+
+// State of xorwow_compact_engine, without the Box-Muller cache
+struct xorwow_compact_state
+{
+    // Xorshift values (160 bits)
+    unsigned int x[5];
+
+    // Weyl sequence value
+    unsigned int d;
 
     FQUALIFIERS
-    xorwow_engine() : xorwow_engine(ROCRAND_XORWOW_DEFAULT_SEED, 0, 0) { }
+    void reset_boxmuller() { }
 
+    FQUALIFIERS
+    ~xorwow_compact_state() { }
+};
+
+// Sequence of xorwow_engine and xorwow_compact_engine, which differ only
+// in the State (with or without the Box-Muller cache)
+template<class State>
+class xorwow_engine_base
+{
+public:
     /// Initializes the internal state of the PRNG using
     /// seed value \p seed, goes to \p subsequence -th subsequence,
     /// and skips \p offset random numbers.
     ///
     /// A subsequence is 2^67 numbers long.
     FQUALIFIERS
-    xorwow_engine(const unsigned long long seed,
-                  const unsigned long long subsequence,
-                  const unsigned long long offset)
+    xorwow_engine_base(const unsigned long long seed,
+                       const unsigned long long subsequence,
+                       const unsigned long long offset)
     {
         m_state.x[0] = 123456789U;
         m_state.x[1] = 362436069U;
@@ -136,24 +180,17 @@ public:
         discard_subsequence(subsequence);
         discard(offset);
 
-        #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
-        m_state.boxmuller_float_state = 0;
-        m_state.boxmuller_double_state = 0;
-        #endif
+        m_state.reset_boxmuller();
     }
 
     FQUALIFIERS
-    ~xorwow_engine() { }
+    explicit xorwow_engine_base(uninitialized_tag) { }
 
     /// Advances the internal state to skip \p offset numbers.
     FQUALIFIERS
     void discard(unsigned long long offset)
     {
-        #ifdef __HIP_DEVICE_COMPILE__
-        jump(offset, d_xorwow_jump_matrices);
-        #else
-        jump(offset, h_xorwow_jump_matrices);
-        #endif
+        jump(offset, ROCRAND_DETAIL_XORWOW_TABLE(jump_matrices));
 
         // Apply n steps to Weyl sequence value as well
         m_state.d += static_cast<unsigned int>(offset) * 362437;
@@ -165,15 +202,29 @@ public:
     void discard_subsequence(unsigned long long subsequence)
     {
         // Discard n * 2^67 samples
-        #ifdef __HIP_DEVICE_COMPILE__
-        jump(subsequence, d_xorwow_sequence_jump_matrices);
-        #else
-        jump(subsequence, h_xorwow_sequence_jump_matrices);
-        #endif
+        jump(subsequence, ROCRAND_DETAIL_XORWOW_TABLE(sequence_jump_matrices));
 
         // d has the same value because 2^67 is divisible by 2^32 (d is 32-bit)
     }
 
+    /// Same as discard() but must be called by all threads of the block,
+    /// jump matrices are staged in \p shared_matrix (XORWOW_SIZE values).
+    FQUALIFIERS
+    void block_discard(unsigned long long offset, unsigned int * shared_matrix)
+    {
+        block_jump(offset, ROCRAND_DETAIL_XORWOW_TABLE(jump_matrices), shared_matrix);
+
+        m_state.d += static_cast<unsigned int>(offset) * 362437;
+    }
+
+    /// Same as discard_subsequence() but must be called by all threads of the block,
+    /// jump matrices are staged in \p shared_matrix (XORWOW_SIZE values).
+    FQUALIFIERS
+    void block_discard_subsequence(unsigned long long subsequence, unsigned int * shared_matrix)
+    {
+        block_jump(subsequence, ROCRAND_DETAIL_XORWOW_TABLE(sequence_jump_matrices), shared_matrix);
+    }
+
     FQUALIFIERS
     unsigned int operator()()
     {
@@ -213,30 +264,151 @@ protected:
         //   A^(1 * 2^67), A^(4 * 2^67), A^(16 * 2^67)...
         //
         // Intermediate powers can be calculated as multiplication of the powers above.
+        //
+        // If tables are generated with all multiples of the powers
+        // (XORWOW_JUMP_MULTIPLES = 2^XORWOW_JUMP_LOG2 - 1, see
+        // tools/xorwow_precomputed_generator), they contain
+        //   A^1, A^2, A^3, A^4, A^8, A^12, A^16...
+        // and one product is computed per digit.
 
         unsigned int mi = 0;
         while (v > 0)
         {
             const unsigned int is = static_cast<unsigned int>(v) & ((1 << XORWOW_JUMP_LOG2) - 1);
+            #if XORWOW_JUMP_MULTIPLES == 1
             for (unsigned int i = 0; i < is; i++)
             {
-                detail::mul_mat_vec_inplace(jump_matrices[mi], m_state.x);
+                mul_mat_vec_inplace(jump_matrices[mi], m_state.x);
+            }
+            #else
+            if (is > 0)
+            {
+                mul_mat_vec_inplace(jump_matrices[mi + is - 1], m_state.x);
+            }
+            #endif
+            mi += XORWOW_JUMP_MULTIPLES;
+            v >>= XORWOW_JUMP_LOG2;
+        }
+    }
+
+    // Same as jump() but all threads of the block jump together, every
+    // matrix is loaded from jump_matrices to shared_matrix once per block
+    // (instead of once per thread) and only if some thread needs it.
+    FQUALIFIERS
+    void block_jump(unsigned long long v,
+                    const unsigned int jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE],
+                    unsigned int * shared_matrix)
+    {
+        const unsigned int block_size = hipBlockDim_x * hipBlockDim_y * hipBlockDim_z;
+        const unsigned int thread_id = hipThreadIdx_x
+            + hipBlockDim_x * (hipThreadIdx_y + hipBlockDim_y * hipThreadIdx_z);
+
+        unsigned int mi = 0;
+        while (__syncthreads_or(v > 0))
+        {
+            const unsigned int is = static_cast<unsigned int>(v) & ((1 << XORWOW_JUMP_LOG2) - 1);
+            #if XORWOW_JUMP_MULTIPLES == 1
+            if (__syncthreads_or(is > 0))
+            {
+                for (unsigned int i = thread_id; i < XORWOW_SIZE; i += block_size)
+                {
+                    shared_matrix[i] = jump_matrices[mi][i];
+                }
+                __syncthreads();
+                for (unsigned int i = 0; i < is; i++)
+                {
+                    mul_mat_vec_inplace(shared_matrix, m_state.x);
+                }
             }
-            mi++;
+            #else
+            for (unsigned int k = 1; k <= XORWOW_JUMP_MULTIPLES; k++)
+            {
+                if (__syncthreads_or(is == k))
+                {
+                    for (unsigned int i = thread_id; i < XORWOW_SIZE; i += block_size)
+                    {
+                        shared_matrix[i] = jump_matrices[mi + k - 1][i];
+                    }
+                    __syncthreads();
+                    if (is == k)
+                    {
+                        mul_mat_vec_inplace(shared_matrix, m_state.x);
+                    }
+                }
+            }
+            #endif
+            mi += XORWOW_JUMP_MULTIPLES;
             v >>= XORWOW_JUMP_LOG2;
         }
     }
 
 protected:
     // State
-    xorwow_state m_state;
+    State m_state;
+}; // xorwow_engine_base class
+
+} // end detail namespace
+
+class xorwow_engine : public detail::xorwow_engine_base<detail::xorwow_state>
+{
+public:
+    typedef detail::xorwow_state xorwow_state;
+
+    FQUALIFIERS
+    xorwow_engine() : xorwow_engine(ROCRAND_XORWOW_DEFAULT_SEED, 0, 0) { }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 2^67 numbers long.
+    FQUALIFIERS
+    xorwow_engine(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset)
+        : detail::xorwow_engine_base<detail::xorwow_state>(seed, subsequence, offset) { }
+
+    FQUALIFIERS
+    explicit xorwow_engine(detail::uninitialized_tag tag)
+        : detail::xorwow_engine_base<detail::xorwow_state>(tag) { }
+
+    FQUALIFIERS
+    ~xorwow_engine() { }
 
+protected:
     #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
     friend struct detail::engine_boxmuller_helper<xorwow_engine>;
     #endif
 
 }; // xorwow_engine class
 
+/// XORWOW engine with the same sequences as xorwow_engine but without
+/// the cached second value of the Box-Muller transform, so the state is
+/// 24 instead of 48 bytes. Normal values are generated in pairs.
+class xorwow_compact_engine : public detail::xorwow_engine_base<detail::xorwow_compact_state>
+{
+public:
+    typedef detail::xorwow_compact_state xorwow_state;
+
+    FQUALIFIERS
+    xorwow_compact_engine() : xorwow_compact_engine(ROCRAND_XORWOW_DEFAULT_SEED, 0, 0) { }
+
+    /// Initializes the internal state of the PRNG, see xorwow_engine.
+    FQUALIFIERS
+    xorwow_compact_engine(const unsigned long long seed,
+                          const unsigned long long subsequence,
+                          const unsigned long long offset)
+        : detail::xorwow_engine_base<detail::xorwow_compact_state>(seed, subsequence, offset) { }
+
+    FQUALIFIERS
+    explicit xorwow_compact_engine(detail::uninitialized_tag tag)
+        : detail::xorwow_engine_base<detail::xorwow_compact_state>(tag) { }
+
+    FQUALIFIERS
+    ~xorwow_compact_engine() { }
+
+}; // xorwow_compact_engine class
+
 } // end namespace rocrand_device
 
 /** \rocrand_internal \addtogroup rocranddevice
@@ -246,6 +418,7 @@ protected:
 
 /// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
 typedef rocrand_device::xorwow_engine rocrand_state_xorwow;
+typedef rocrand_device::xorwow_compact_engine rocrand_state_xorwow_compact;
 /// \endcond
 
 /**
@@ -268,6 +441,34 @@ void rocrand_init(const unsigned long long seed,
     *state = rocrand_state_xorwow(seed, subsequence, offset);
 }
 
+/**
+ * \brief Initialize XORWOW state without skipping ahead to the subsequence.
+ *
+ * Initializes the XORWOW generator \p state with a seed computed by hashing
+ * \p seed and \p subsequence (SplitMix64) and skips \p offset numbers.
+ * Unlike rocrand_init(), no jump to \p subsequence is computed, so the
+ * initialization is much faster, but sequences of different subsequences are
+ * statistically independent instead of guaranteed to be non-overlapping.
+ *
+ * States of subsequences 0, 1, 2... give the same numbers as engines of
+ * the host API generator with ROCRAND_ORDERING_PSEUDO_SEEDED ordering.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence (e.g. index of the thread) hashed with the seed
+ * \param offset - Absolute offset into the sequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init_fast(const unsigned long long seed,
+                       const unsigned long long subsequence,
+                       const unsigned long long offset,
+                       rocrand_state_xorwow * state)
+{
+    *state = rocrand_state_xorwow(
+        rocrand_device::detail::splitmix64_seed(seed, subsequence), 0, offset
+    );
+}
+
 /**
  * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
  * from [0; 2^32 - 1] range.
@@ -286,6 +487,28 @@ unsigned int rocrand(rocrand_state_xorwow * state)
     return state->next();
 }
 
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using XORWOW generator in \p state.
+ * State is incremented by four positions. The results are the same as of
+ * four calls of rocrand(), but the state is loaded and stored once.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand4(rocrand_state_xorwow * state)
+{
+    rocrand_state_xorwow local = *state;
+    const uint4 result = uint4 { local.next(), local.next(), local.next(), local.next() };
+    *state = local;
+    return result;
+}
+
 /**
  * \brief Updates XORWOW state to skip ahead by \p offset elements.
  *
@@ -330,6 +553,119 @@ void skipahead_subsequence(unsigned long long subsequence, rocrand_state_xorwow
      return state->discard_subsequence(sequence);
  }
 
+/**
+ * \brief Updates XORWOW states of all threads of a block to skip ahead.
+ *
+ * Updates the XORWOW state in \p state to skip ahead by \p offset elements,
+ * the result is the same as skipahead(). Must be called by all threads of
+ * the block, each thread can have its own state and offset.
+ *
+ * Jumps multiply the state by precomputed matrices of XORWOW_SIZE
+ * <tt>unsigned int</tt> values, skipahead() reads them from global memory
+ * in every thread. Here every matrix is loaded once per block to
+ * \p shared_matrix and is skipped if no thread of the block needs it,
+ * so the cost of skipping is shared by threads of the block.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ * \param shared_matrix - Pointer to shared memory for XORWOW_SIZE
+ * <tt>unsigned int</tt> values, the same for all threads of the block
+ */
+FQUALIFIERS
+void rocrand_block_skipahead(unsigned long long offset,
+                             rocrand_state_xorwow * state,
+                             unsigned int * shared_matrix)
+{
+    return state->block_discard(offset, shared_matrix);
+}
+
+/**
+ * \brief Updates XORWOW states of all threads of a block to skip ahead
+ * by subsequences.
+ *
+ * Updates the XORWOW \p state to skip ahead by \p subsequence subsequences,
+ * the result is the same as skipahead_subsequence(). Must be called by all
+ * threads of the block, see rocrand_block_skipahead().
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ * \param shared_matrix - Pointer to shared memory for XORWOW_SIZE
+ * <tt>unsigned int</tt> values, the same for all threads of the block
+ */
+FQUALIFIERS
+void rocrand_block_skipahead_subsequence(unsigned long long subsequence,
+                                         rocrand_state_xorwow * state,
+                                         unsigned int * shared_matrix)
+{
+    return state->block_discard_subsequence(subsequence, shared_matrix);
+}
+
+/**
+ * \brief Initialize compact XORWOW state.
+ *
+ * Initializes the compact XORWOW generator \p state with the given
+ * \p seed, \p subsequence, and \p offset. Sequences are the same as of
+ * rocrand_state_xorwow, but the state has no cache of the Box-Muller
+ * transform (24 instead of 48 bytes), so normal values are returned only
+ * in pairs (rocrand_normal2(), rocrand_normal_double2(), rocrand_log_normal2()
+ * and rocrand_log_normal_double2()).
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_xorwow_compact * state)
+{
+    *state = rocrand_state_xorwow_compact(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Same as rocrand() of rocrand_state_xorwow for a compact XORWOW \p state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_xorwow_compact * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates compact XORWOW state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_xorwow_compact * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates compact XORWOW state to skip ahead by \p subsequence subsequences.
+ *
+ * Each subsequence is 2^67 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_xorwow_compact * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
 #endif // ROCRAND_XORWOW_H_
 
 /** @} */ // end of group rocranddevice
@@ -29,6 +29,7 @@
 #define XORWOW_SIZE (XORWOW_M * XORWOW_N * XORWOW_N)
 #define XORWOW_JUMP_MATRICES 32
 #define XORWOW_JUMP_LOG2 2
+#define XORWOW_JUMP_MULTIPLES 1
 
 static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE] = {
     {
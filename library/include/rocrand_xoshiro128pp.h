@@ -0,0 +1,358 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_XOSHIRO128PP_H_
+#define ROCRAND_XOSHIRO128PP_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand_common.h"
+#ifdef ROCRAND_EXTERNAL_TABLES
+#include "rocrand_external_tables.h"
+#else
+#include "rocrand_xoshiro128pp_precomputed.h"
+#endif
+
+// Jump polynomials of the library, of device code or of host code
+#if defined(ROCRAND_EXTERNAL_TABLES)
+#define ROCRAND_DETAIL_XOSHIRO128PP_TABLE(name) \
+    reinterpret_cast<const unsigned int (*)[XOSHIRO128PP_N]>( \
+        ::rocrand_device::detail::precomputed_tables().xoshiro128pp_##name)
+#elif defined(__HIP_DEVICE_COMPILE__)
+#define ROCRAND_DETAIL_XOSHIRO128PP_TABLE(name) d_xoshiro128pp_##name
+#else
+#define ROCRAND_DETAIL_XOSHIRO128PP_TABLE(name) h_xoshiro128pp_##name
+#endif
+
+// D. Blackman, S. Vigna, Scrambled Linear Pseudorandom Number Generators, 2021
+// https://prng.di.unimi.it/xoshiro128plusplus.c
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+ /**
+ * \def ROCRAND_XOSHIRO128PP_DEFAULT_SEED
+ * \brief Default seed for XOSHIRO128PP PRNG.
+ */
+ #define ROCRAND_XOSHIRO128PP_DEFAULT_SEED 0ULL
+ /** @} */ // end of group rocranddevice
+
+namespace rocrand_device {
+
+class xoshiro128pp_engine
+{
+public:
+    struct xoshiro128pp_state
+    {
+        // Xoshiro values (128 bits), not all zero. Normal values are not
+        // cached, so the state is 4 registers.
+        unsigned int s[4];
+    };
+
+    FQUALIFIERS
+    xoshiro128pp_engine() : xoshiro128pp_engine(ROCRAND_XOSHIRO128PP_DEFAULT_SEED, 0, 0) { }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 2^64 numbers long.
+    FQUALIFIERS
+    xoshiro128pp_engine(const unsigned long long seed,
+                        const unsigned long long subsequence,
+                        const unsigned long long offset)
+    {
+        // 128 bits of the state are expanded from the seed by SplitMix64
+        const unsigned long long s01 = detail::splitmix64_seed(seed, 0);
+        const unsigned long long s23 = detail::splitmix64_seed(seed, 1);
+        m_state.s[0] = static_cast<unsigned int>(s01);
+        m_state.s[1] = static_cast<unsigned int>(s01 >> 32);
+        m_state.s[2] = static_cast<unsigned int>(s23);
+        m_state.s[3] = static_cast<unsigned int>(s23 >> 32);
+        // The zero state is a fixed point of the transition
+        if((m_state.s[0] | m_state.s[1] | m_state.s[2] | m_state.s[3]) == 0)
+        {
+            m_state.s[0] = 1;
+        }
+
+        discard_subsequence(subsequence);
+        discard(offset);
+    }
+
+    FQUALIFIERS
+    explicit xoshiro128pp_engine(detail::uninitialized_tag) { }
+
+    /// Advances the internal state to skip \p offset numbers.
+    FQUALIFIERS
+    void discard(unsigned long long offset)
+    {
+        // A jump takes 128 steps, the lowest 7 bits of the offset are
+        // cheaper as steps
+        const unsigned int steps = static_cast<unsigned int>(offset) & 127;
+        for(unsigned int i = 0; i < steps; i++)
+        {
+            step();
+        }
+        offset >>= 7;
+        for(unsigned int i = 7; offset > 0; i++, offset >>= 1)
+        {
+            if(offset & 1)
+            {
+                jump(ROCRAND_DETAIL_XOSHIRO128PP_TABLE(jump_polynomials)[i]);
+            }
+        }
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// A subsequence is 2^64 numbers long.
+    FQUALIFIERS
+    void discard_subsequence(unsigned long long subsequence)
+    {
+        for(unsigned int i = 0; subsequence > 0; i++, subsequence >>= 1)
+        {
+            if(subsequence & 1)
+            {
+                jump(ROCRAND_DETAIL_XOSHIRO128PP_TABLE(sequence_jump_polynomials)[i]);
+            }
+        }
+    }
+
+    FQUALIFIERS
+    unsigned int operator()()
+    {
+        return next();
+    }
+
+    FQUALIFIERS
+    unsigned int next()
+    {
+        const unsigned int result = rotl(m_state.s[0] + m_state.s[3], 7) + m_state.s[0];
+        step();
+        return result;
+    }
+
+protected:
+
+    FQUALIFIERS
+    static unsigned int rotl(const unsigned int x, const int k)
+    {
+        return (x << k) | (x >> (32 - k));
+    }
+
+    FQUALIFIERS
+    void step()
+    {
+        const unsigned int t = m_state.s[1] << 9;
+        m_state.s[2] ^= m_state.s[0];
+        m_state.s[3] ^= m_state.s[1];
+        m_state.s[1] ^= m_state.s[2];
+        m_state.s[0] ^= m_state.s[3];
+        m_state.s[2] ^= t;
+        m_state.s[3] = rotl(m_state.s[3], 11);
+    }
+
+    // The state after v steps is p(A)s, where A is the transition and
+    // p(x) = x^v mod (characteristic polynomial of A), so it is the sum of
+    // states after the steps selected by the coefficients of p.
+    // xoshiro128pp_jump_polynomials contains p of v = 2^0, 2^1... 2^63,
+    // xoshiro128pp_sequence_jump_polynomials of v = 2^64, 2^65... 2^127.
+    FQUALIFIERS
+    void jump(const unsigned int polynomial[XOSHIRO128PP_N])
+    {
+        unsigned int s[4] = { 0, 0, 0, 0 };
+        for(int i = 0; i < XOSHIRO128PP_N; i++)
+        {
+            for(int b = 0; b < 32; b++)
+            {
+                if(polynomial[i] & (1U << b))
+                {
+                    s[0] ^= m_state.s[0];
+                    s[1] ^= m_state.s[1];
+                    s[2] ^= m_state.s[2];
+                    s[3] ^= m_state.s[3];
+                }
+                step();
+            }
+        }
+        m_state.s[0] = s[0];
+        m_state.s[1] = s[1];
+        m_state.s[2] = s[2];
+        m_state.s[3] = s[3];
+    }
+
+protected:
+    // State
+    xoshiro128pp_state m_state;
+
+}; // xoshiro128pp_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::xoshiro128pp_engine rocrand_state_xoshiro128pp;
+/// \endcond
+
+/**
+ * \brief Initialize XOSHIRO128PP state.
+ *
+ * Initializes the xoshiro128++ generator \p state with the given
+ * \p seed, \p subsequence, and \p offset. The state is four 32-bit
+ * values, so it fits in registers of kernels which run out of them
+ * with larger states.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_xoshiro128pp * state)
+{
+    *state = rocrand_state_xoshiro128pp(seed, subsequence, offset);
+}
+
+/**
+ * \brief Initialize XOSHIRO128PP state without skipping ahead to the subsequence.
+ *
+ * Initializes the xoshiro128++ generator \p state with a seed computed by
+ * hashing \p seed and \p subsequence (SplitMix64) and skips \p offset numbers.
+ * Unlike rocrand_init(), no jump to \p subsequence is computed, but sequences
+ * of different subsequences are statistically independent instead of
+ * guaranteed to be non-overlapping.
+ *
+ * States of subsequences 0, 1, 2... give the same numbers as engines of
+ * the host API generator with ROCRAND_ORDERING_PSEUDO_SEEDED ordering.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence (e.g. index of the thread) hashed with the seed
+ * \param offset - Absolute offset into the sequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init_fast(const unsigned long long seed,
+                       const unsigned long long subsequence,
+                       const unsigned long long offset,
+                       rocrand_state_xoshiro128pp * state)
+{
+    *state = rocrand_state_xoshiro128pp(
+        rocrand_device::detail::splitmix64_seed(seed, subsequence), 0, offset
+    );
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using xoshiro128++ generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_xoshiro128pp * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using xoshiro128++ generator in \p state.
+ * State is incremented by four positions. The results are the same as of
+ * four calls of rocrand(), but the state is loaded and stored once.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand4(rocrand_state_xoshiro128pp * state)
+{
+    rocrand_state_xoshiro128pp local = *state;
+    const uint4 result = uint4 { local.next(), local.next(), local.next(), local.next() };
+    *state = local;
+    return result;
+}
+
+/**
+ * \brief Updates XOSHIRO128PP state to skip ahead by \p offset elements.
+ *
+ * Updates the xoshiro128++ state in \p state to skip ahead by \p offset elements.
+ * Every set bit of \p offset from bit 7 up costs 128 steps of the generator.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_xoshiro128pp * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates XOSHIRO128PP state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the xoshiro128++ \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence is 2^64 numbers long, every set bit of \p subsequence
+ * costs 128 steps of the generator.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_xoshiro128pp * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates XOSHIRO128PP state to skip ahead by \p sequence sequences.
+ *
+ * Updates the xoshiro128++ \p state skipping \p sequence sequences ahead.
+ * For xoshiro128++ each sequence is 2^64 numbers long (equal to the size of a subsequence).
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_sequence(unsigned long long sequence, rocrand_state_xoshiro128pp * state)
+{
+    return state->discard_subsequence(sequence);
+}
+
+#endif // ROCRAND_XOSHIRO128PP_H_
+
+/** @} */ // end of group rocranddevice
@@ -0,0 +1,299 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_XOSHIRO128PP_PRECOMPUTED_H_
+#define ROCRAND_XOSHIRO128PP_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/xoshiro128pp_precomputed_generator
+
+#define XOSHIRO128PP_N 4
+#define XOSHIRO128PP_JUMP_POLYNOMIALS 64
+
+static const __device__ unsigned int d_xoshiro128pp_jump_polynomials[XOSHIRO128PP_JUMP_POLYNOMIALS][XOSHIRO128PP_N] = {
+    { 2U, 0U, 0U, 0U, },
+    { 4U, 0U, 0U, 0U, },
+    { 16U, 0U, 0U, 0U, },
+    { 256U, 0U, 0U, 0U, },
+    { 65536U, 0U, 0U, 0U, },
+    { 0U, 1U, 0U, 0U, },
+    { 0U, 0U, 1U, 0U, },
+    { 3726179329U, 457743798U, 6444209U, 16541090U, },
+    { 2025656663U, 3028852833U, 2005928482U, 241710331U, },
+    { 2064381082U, 1095956291U, 1142001051U, 953332790U, },
+    { 2220493233U, 2494909345U, 1346018022U, 1601873151U, },
+    { 169805494U, 3974610062U, 2595606286U, 2014255853U, },
+    { 2412771539U, 3597356889U, 133048186U, 3946727797U, },
+    { 2317973929U, 1625385328U, 2332151419U, 3385970226U, },
+    { 3573382022U, 1471736218U, 944981821U, 3999425249U, },
+    { 2131255805U, 2716487025U, 2721218390U, 1719746739U, },
+    { 144853286U, 800342421U, 1838246622U, 1311183639U, },
+    { 3546245874U, 1182236683U, 2066282009U, 2210161357U, },
+    { 234672759U, 1177705664U, 1940343174U, 431083202U, },
+    { 3099960998U, 2548054359U, 3121466703U, 3994483052U, },
+    { 1481314991U, 1930864589U, 2049681680U, 1409157687U, },
+    { 146082473U, 2029369751U, 3056702357U, 1717219081U, },
+    { 761274862U, 1331995044U, 195740674U, 349954898U, },
+    { 4283503085U, 2363297967U, 2509669966U, 1971648065U, },
+    { 776703264U, 1817159768U, 1621245847U, 1824370327U, },
+    { 2412822957U, 2372745580U, 455772329U, 1409929324U, },
+    { 118209922U, 953968856U, 3807956978U, 439842355U, },
+    { 3740207825U, 812489595U, 1978952902U, 1856227558U, },
+    { 990979372U, 407494607U, 2204142348U, 1114715468U, },
+    { 2076605277U, 1771875338U, 3632826495U, 2296830830U, },
+    { 3692475880U, 622115474U, 1575581247U, 290669120U, },
+    { 430359565U, 4258402573U, 2493120188U, 1751976056U, },
+    { 4155498760U, 4089317304U, 1930138765U, 260763028U, },
+    { 4099953453U, 3315577123U, 2795254192U, 1394788206U, },
+    { 1373927620U, 4125291223U, 4271395541U, 2515085621U, },
+    { 3037535780U, 3022873037U, 3175091421U, 164852401U, },
+    { 1809821060U, 3301407545U, 740099432U, 3881004679U, },
+    { 426887265U, 2603580672U, 1543159070U, 1268583001U, },
+    { 4199715209U, 702080968U, 1854189321U, 3591799769U, },
+    { 2946715160U, 2567641100U, 2479991208U, 735954978U, },
+    { 1183886480U, 2214172167U, 1913490772U, 2358328443U, },
+    { 916382791U, 2986934915U, 1308690795U, 1540123162U, },
+    { 1541337923U, 459538641U, 3914034610U, 2023302629U, },
+    { 611748441U, 697029584U, 393254277U, 1152479439U, },
+    { 1569148699U, 386012366U, 185862557U, 2546836116U, },
+    { 3772336885U, 1408729496U, 4047141036U, 1215503545U, },
+    { 3435797477U, 2789879736U, 3830811246U, 1058469491U, },
+    { 109310551U, 1842802215U, 2577977742U, 2750384351U, },
+    { 3411437180U, 2275694653U, 3737500570U, 3735702690U, },
+    { 3483515409U, 4030038192U, 1994543979U, 2358225795U, },
+    { 3070178481U, 385394888U, 1146831389U, 1633142529U, },
+    { 1321653726U, 1291368736U, 2123795262U, 3380150821U, },
+    { 900210300U, 990700479U, 3301392868U, 3687574190U, },
+    { 2170815220U, 426828658U, 2340470162U, 1201554344U, },
+    { 3723274264U, 3294377217U, 575917157U, 182250116U, },
+    { 1922733467U, 2282371959U, 1306609050U, 2981087107U, },
+    { 1643877408U, 3867760468U, 795174504U, 1563762062U, },
+    { 166078129U, 3981581979U, 1211136130U, 529816671U, },
+    { 2122873400U, 1648867761U, 2874177222U, 2405338641U, },
+    { 3356857389U, 1005559742U, 372998619U, 3718099829U, },
+    { 1433082849U, 1460343567U, 4012146536U, 2174826669U, },
+    { 1950897059U, 1213996606U, 2921210641U, 749337417U, },
+    { 370481293U, 2183123861U, 4072715512U, 1044283315U, },
+    { 4222937642U, 205746531U, 4008640303U, 3466152931U, },
+};
+
+static const unsigned int h_xoshiro128pp_jump_polynomials[XOSHIRO128PP_JUMP_POLYNOMIALS][XOSHIRO128PP_N] = {
+    { 2U, 0U, 0U, 0U, },
+    { 4U, 0U, 0U, 0U, },
+    { 16U, 0U, 0U, 0U, },
+    { 256U, 0U, 0U, 0U, },
+    { 65536U, 0U, 0U, 0U, },
+    { 0U, 1U, 0U, 0U, },
+    { 0U, 0U, 1U, 0U, },
+    { 3726179329U, 457743798U, 6444209U, 16541090U, },
+    { 2025656663U, 3028852833U, 2005928482U, 241710331U, },
+    { 2064381082U, 1095956291U, 1142001051U, 953332790U, },
+    { 2220493233U, 2494909345U, 1346018022U, 1601873151U, },
+    { 169805494U, 3974610062U, 2595606286U, 2014255853U, },
+    { 2412771539U, 3597356889U, 133048186U, 3946727797U, },
+    { 2317973929U, 1625385328U, 2332151419U, 3385970226U, },
+    { 3573382022U, 1471736218U, 944981821U, 3999425249U, },
+    { 2131255805U, 2716487025U, 2721218390U, 1719746739U, },
+    { 144853286U, 800342421U, 1838246622U, 1311183639U, },
+    { 3546245874U, 1182236683U, 2066282009U, 2210161357U, },
+    { 234672759U, 1177705664U, 1940343174U, 431083202U, },
+    { 3099960998U, 2548054359U, 3121466703U, 3994483052U, },
+    { 1481314991U, 1930864589U, 2049681680U, 1409157687U, },
+    { 146082473U, 2029369751U, 3056702357U, 1717219081U, },
+    { 761274862U, 1331995044U, 195740674U, 349954898U, },
+    { 4283503085U, 2363297967U, 2509669966U, 1971648065U, },
+    { 776703264U, 1817159768U, 1621245847U, 1824370327U, },
+    { 2412822957U, 2372745580U, 455772329U, 1409929324U, },
+    { 118209922U, 953968856U, 3807956978U, 439842355U, },
+    { 3740207825U, 812489595U, 1978952902U, 1856227558U, },
+    { 990979372U, 407494607U, 2204142348U, 1114715468U, },
+    { 2076605277U, 1771875338U, 3632826495U, 2296830830U, },
+    { 3692475880U, 622115474U, 1575581247U, 290669120U, },
+    { 430359565U, 4258402573U, 2493120188U, 1751976056U, },
+    { 4155498760U, 4089317304U, 1930138765U, 260763028U, },
+    { 4099953453U, 3315577123U, 2795254192U, 1394788206U, },
+    { 1373927620U, 4125291223U, 4271395541U, 2515085621U, },
+    { 3037535780U, 3022873037U, 3175091421U, 164852401U, },
+    { 1809821060U, 3301407545U, 740099432U, 3881004679U, },
+    { 426887265U, 2603580672U, 1543159070U, 1268583001U, },
+    { 4199715209U, 702080968U, 1854189321U, 3591799769U, },
+    { 2946715160U, 2567641100U, 2479991208U, 735954978U, },
+    { 1183886480U, 2214172167U, 1913490772U, 2358328443U, },
+    { 916382791U, 2986934915U, 1308690795U, 1540123162U, },
+    { 1541337923U, 459538641U, 3914034610U, 2023302629U, },
+    { 611748441U, 697029584U, 393254277U, 1152479439U, },
+    { 1569148699U, 386012366U, 185862557U, 2546836116U, },
+    { 3772336885U, 1408729496U, 4047141036U, 1215503545U, },
+    { 3435797477U, 2789879736U, 3830811246U, 1058469491U, },
+    { 109310551U, 1842802215U, 2577977742U, 2750384351U, },
+    { 3411437180U, 2275694653U, 3737500570U, 3735702690U, },
+    { 3483515409U, 4030038192U, 1994543979U, 2358225795U, },
+    { 3070178481U, 385394888U, 1146831389U, 1633142529U, },
+    { 1321653726U, 1291368736U, 2123795262U, 3380150821U, },
+    { 900210300U, 990700479U, 3301392868U, 3687574190U, },
+    { 2170815220U, 426828658U, 2340470162U, 1201554344U, },
+    { 3723274264U, 3294377217U, 575917157U, 182250116U, },
+    { 1922733467U, 2282371959U, 1306609050U, 2981087107U, },
+    { 1643877408U, 3867760468U, 795174504U, 1563762062U, },
+    { 166078129U, 3981581979U, 1211136130U, 529816671U, },
+    { 2122873400U, 1648867761U, 2874177222U, 2405338641U, },
+    { 3356857389U, 1005559742U, 372998619U, 3718099829U, },
+    { 1433082849U, 1460343567U, 4012146536U, 2174826669U, },
+    { 1950897059U, 1213996606U, 2921210641U, 749337417U, },
+    { 370481293U, 2183123861U, 4072715512U, 1044283315U, },
+    { 4222937642U, 205746531U, 4008640303U, 3466152931U, },
+};
+
+static const __device__ unsigned int d_xoshiro128pp_sequence_jump_polynomials[XOSHIRO128PP_JUMP_POLYNOMIALS][XOSHIRO128PP_N] = {
+    { 2271477771U, 4114797267U, 1872770499U, 2012404571U, },
+    { 2608867979U, 2034763245U, 1588687088U, 2081388822U, },
+    { 438524053U, 8419542U, 418162958U, 1596532610U, },
+    { 4144334331U, 1309432151U, 3168948419U, 396924671U, },
+    { 3539359087U, 1243097197U, 908645131U, 1427505945U, },
+    { 2055188378U, 2708191997U, 235726075U, 1014830558U, },
+    { 4069410539U, 1575540848U, 2579970177U, 327448018U, },
+    { 1617590149U, 551998559U, 459568404U, 2263579817U, },
+    { 1231449804U, 931780773U, 1785072275U, 3608164548U, },
+    { 1361633353U, 1467125272U, 2437779330U, 1997228718U, },
+    { 4106363065U, 541395431U, 4146772648U, 2276047383U, },
+    { 2809164892U, 1661316785U, 1364178497U, 1408320385U, },
+    { 4010542920U, 935772115U, 3464641631U, 1632312296U, },
+    { 2807663470U, 1454162739U, 1981197291U, 1145861250U, },
+    { 999184498U, 2511705702U, 621450062U, 3788033300U, },
+    { 1638888267U, 3405478895U, 1077021077U, 1388576509U, },
+    { 507808613U, 1023734870U, 6665921U, 65922712U, },
+    { 2577140833U, 2404470580U, 545974433U, 2726692189U, },
+    { 4252479569U, 3698627452U, 2278148775U, 2277749831U, },
+    { 1555138308U, 945916044U, 1109300720U, 2221942645U, },
+    { 2037288732U, 389571960U, 2840651961U, 1361230233U, },
+    { 4252061496U, 1784698892U, 501820871U, 171412109U, },
+    { 2449708201U, 1508242478U, 2821389753U, 703356627U, },
+    { 2639160174U, 2445422003U, 4064573944U, 3007475950U, },
+    { 4128296392U, 2472158482U, 2842882022U, 2255209800U, },
+    { 4135454432U, 2198849071U, 1114452985U, 918753714U, },
+    { 2195952884U, 2390417808U, 1960473017U, 730544836U, },
+    { 454534974U, 1223439932U, 2671412837U, 463511239U, },
+    { 1592659214U, 2320807188U, 646798166U, 2085867383U, },
+    { 3971161606U, 502223574U, 1589984591U, 3414367960U, },
+    { 425751999U, 3273505019U, 778193760U, 3128822039U, },
+    { 4120871832U, 2123328134U, 3384437499U, 3263857133U, },
+    { 3039008046U, 191826335U, 3438649583U, 475530850U, },
+    { 4004569252U, 1997749795U, 3696844837U, 2549440482U, },
+    { 2660976044U, 1833523456U, 1772896741U, 56027445U, },
+    { 1081639923U, 1417496660U, 2422561179U, 1714121417U, },
+    { 1719591646U, 2325040523U, 1699857811U, 802027492U, },
+    { 4216784810U, 3668084842U, 2989739367U, 255951818U, },
+    { 1088146787U, 2383616591U, 575652433U, 3326575854U, },
+    { 1330492671U, 2070847839U, 2996704183U, 1446715047U, },
+    { 3151212122U, 3958719721U, 3532571968U, 1558393647U, },
+    { 3550241259U, 525193262U, 2510612751U, 2846658792U, },
+    { 2030863468U, 3559438613U, 3529903907U, 1918750064U, },
+    { 149942883U, 4087346881U, 1362987936U, 3393455306U, },
+    { 642992973U, 3482170987U, 1627584075U, 4165928931U, },
+    { 2827429061U, 141613015U, 404723591U, 3695009093U, },
+    { 3685168265U, 233892895U, 1124097582U, 3577998833U, },
+    { 1836294631U, 4265849511U, 4188301856U, 1485150854U, },
+    { 2793649872U, 2948900659U, 469322105U, 4177845663U, },
+    { 786447748U, 1975995965U, 2532294614U, 2099605356U, },
+    { 986770407U, 334581553U, 2037197084U, 2754330589U, },
+    { 3456425392U, 532957846U, 3063941777U, 2322350886U, },
+    { 1313970535U, 226133662U, 1073816722U, 1841807414U, },
+    { 2655849032U, 1787222887U, 2927963035U, 1824857323U, },
+    { 1515383167U, 2008984782U, 3087207276U, 1588427833U, },
+    { 36499390U, 2106123220U, 2240527870U, 1801732422U, },
+    { 2416343621U, 3083731900U, 3729441768U, 2575645228U, },
+    { 3819425011U, 902410595U, 3143336008U, 833377752U, },
+    { 2370450395U, 379492079U, 931706019U, 1647104814U, },
+    { 85193104U, 116785977U, 2472575364U, 1165399453U, },
+    { 442766971U, 96945605U, 3807710522U, 2327589114U, },
+    { 390183778U, 989678500U, 2993224431U, 415193030U, },
+    { 968341433U, 834342913U, 3646893516U, 1451673319U, },
+    { 1423449982U, 72610046U, 1005536069U, 2640189329U, },
+};
+
+static const unsigned int h_xoshiro128pp_sequence_jump_polynomials[XOSHIRO128PP_JUMP_POLYNOMIALS][XOSHIRO128PP_N] = {
+    { 2271477771U, 4114797267U, 1872770499U, 2012404571U, },
+    { 2608867979U, 2034763245U, 1588687088U, 2081388822U, },
+    { 438524053U, 8419542U, 418162958U, 1596532610U, },
+    { 4144334331U, 1309432151U, 3168948419U, 396924671U, },
+    { 3539359087U, 1243097197U, 908645131U, 1427505945U, },
+    { 2055188378U, 2708191997U, 235726075U, 1014830558U, },
+    { 4069410539U, 1575540848U, 2579970177U, 327448018U, },
+    { 1617590149U, 551998559U, 459568404U, 2263579817U, },
+    { 1231449804U, 931780773U, 1785072275U, 3608164548U, },
+    { 1361633353U, 1467125272U, 2437779330U, 1997228718U, },
+    { 4106363065U, 541395431U, 4146772648U, 2276047383U, },
+    { 2809164892U, 1661316785U, 1364178497U, 1408320385U, },
+    { 4010542920U, 935772115U, 3464641631U, 1632312296U, },
+    { 2807663470U, 1454162739U, 1981197291U, 1145861250U, },
+    { 999184498U, 2511705702U, 621450062U, 3788033300U, },
+    { 1638888267U, 3405478895U, 1077021077U, 1388576509U, },
+    { 507808613U, 1023734870U, 6665921U, 65922712U, },
+    { 2577140833U, 2404470580U, 545974433U, 2726692189U, },
+    { 4252479569U, 3698627452U, 2278148775U, 2277749831U, },
+    { 1555138308U, 945916044U, 1109300720U, 2221942645U, },
+    { 2037288732U, 389571960U, 2840651961U, 1361230233U, },
+    { 4252061496U, 1784698892U, 501820871U, 171412109U, },
+    { 2449708201U, 1508242478U, 2821389753U, 703356627U, },
+    { 2639160174U, 2445422003U, 4064573944U, 3007475950U, },
+    { 4128296392U, 2472158482U, 2842882022U, 2255209800U, },
+    { 4135454432U, 2198849071U, 1114452985U, 918753714U, },
+    { 2195952884U, 2390417808U, 1960473017U, 730544836U, },
+    { 454534974U, 1223439932U, 2671412837U, 463511239U, },
+    { 1592659214U, 2320807188U, 646798166U, 2085867383U, },
+    { 3971161606U, 502223574U, 1589984591U, 3414367960U, },
+    { 425751999U, 3273505019U, 778193760U, 3128822039U, },
+    { 4120871832U, 2123328134U, 3384437499U, 3263857133U, },
+    { 3039008046U, 191826335U, 3438649583U, 475530850U, },
+    { 4004569252U, 1997749795U, 3696844837U, 2549440482U, },
+    { 2660976044U, 1833523456U, 1772896741U, 56027445U, },
+    { 1081639923U, 1417496660U, 2422561179U, 1714121417U, },
+    { 1719591646U, 2325040523U, 1699857811U, 802027492U, },
+    { 4216784810U, 3668084842U, 2989739367U, 255951818U, },
+    { 1088146787U, 2383616591U, 575652433U, 3326575854U, },
+    { 1330492671U, 2070847839U, 2996704183U, 1446715047U, },
+    { 3151212122U, 3958719721U, 3532571968U, 1558393647U, },
+    { 3550241259U, 525193262U, 2510612751U, 2846658792U, },
+    { 2030863468U, 3559438613U, 3529903907U, 1918750064U, },
+    { 149942883U, 4087346881U, 1362987936U, 3393455306U, },
+    { 642992973U, 3482170987U, 1627584075U, 4165928931U, },
+    { 2827429061U, 141613015U, 404723591U, 3695009093U, },
+    { 3685168265U, 233892895U, 1124097582U, 3577998833U, },
+    { 1836294631U, 4265849511U, 4188301856U, 1485150854U, },
+    { 2793649872U, 2948900659U, 469322105U, 4177845663U, },
+    { 786447748U, 1975995965U, 2532294614U, 2099605356U, },
+    { 986770407U, 334581553U, 2037197084U, 2754330589U, },
+    { 3456425392U, 532957846U, 3063941777U, 2322350886U, },
+    { 1313970535U, 226133662U, 1073816722U, 1841807414U, },
+    { 2655849032U, 1787222887U, 2927963035U, 1824857323U, },
+    { 1515383167U, 2008984782U, 3087207276U, 1588427833U, },
+    { 36499390U, 2106123220U, 2240527870U, 1801732422U, },
+    { 2416343621U, 3083731900U, 3729441768U, 2575645228U, },
+    { 3819425011U, 902410595U, 3143336008U, 833377752U, },
+    { 2370450395U, 379492079U, 931706019U, 1647104814U, },
+    { 85193104U, 116785977U, 2472575364U, 1165399453U, },
+    { 442766971U, 96945605U, 3807710522U, 2327589114U, },
+    { 390183778U, 989678500U, 2993224431U, 415193030U, },
+    { 968341433U, 834342913U, 3646893516U, 1451673319U, },
+    { 1423449982U, 72610046U, 1005536069U, 2640189329U, },
+};
+
+
+#endif // ROCRAND_XOSHIRO128PP_PRECOMPUTED_H_
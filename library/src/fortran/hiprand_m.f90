@@ -66,41 +66,51 @@ module hiprand_m
             integer(c_size_t), value :: generator
         end function
 
-        function hiprandGenerate(generator, output_data, n) &
+        function hiprandGenerate_orig(generator, output_data, n) &
         bind(C, name="hiprandGenerate")
             use iso_c_binding
             implicit none
-            integer(c_int) :: hiprandGenerate
+            integer(c_int) :: hiprandGenerate_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
         end function
 
-        function hiprandGenerateUniform(generator, output_data, n) &
+        function hiprandGenerateLongLong_orig(generator, output_data, n) &
+        bind(C, name="hiprandGenerateLongLong")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: hiprandGenerateLongLong_orig
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function hiprandGenerateUniform_orig(generator, output_data, n) &
         bind(C, name="hiprandGenerateUniform")
             use iso_c_binding
             implicit none
-            integer(c_int) :: hiprandGenerateUniform
+            integer(c_int) :: hiprandGenerateUniform_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
         end function
 
-        function hiprandGenerateUniformDouble(generator, output_data, n) &
+        function hiprandGenerateUniformDouble_orig(generator, output_data, n) &
         bind(C, name="hiprandGenerateUniformDouble")
             use iso_c_binding
             implicit none
-            integer(c_int) :: hiprandGenerateUniformDouble
+            integer(c_int) :: hiprandGenerateUniformDouble_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
         end function
 
-        function hiprandGenerateNormal(generator, output_data, n, mean, &
+        function hiprandGenerateNormal_orig(generator, output_data, n, mean, &
         stddev) bind(C, name="hiprandGenerateNormal")
             use iso_c_binding
             implicit none
-            integer(c_int) :: hiprandGenerateNormal
+            integer(c_int) :: hiprandGenerateNormal_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
@@ -108,11 +118,11 @@ module hiprand_m
             real(c_float), value :: stddev
         end function
 
-        function hiprandGenerateNormalDouble(generator, output_data, n, &
+        function hiprandGenerateNormalDouble_orig(generator, output_data, n, &
         mean, stddev) bind(C, name="hiprandGenerateNormalDouble")
             use iso_c_binding
             implicit none
-            integer(c_int) :: hiprandGenerateNormalDouble
+            integer(c_int) :: hiprandGenerateNormalDouble_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
@@ -120,11 +130,11 @@ module hiprand_m
             real(c_double), value :: stddev
         end function
 
-        function hiprandGenerateLogNormal(generator, output_data, n, mean, &
+        function hiprandGenerateLogNormal_orig(generator, output_data, n, mean, &
         stddev) bind(C, name="hiprandGenerateLogNormal")
             use iso_c_binding
             implicit none
-            integer(c_int) :: hiprandGenerateLogNormal
+            integer(c_int) :: hiprandGenerateLogNormal_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
@@ -132,11 +142,11 @@ module hiprand_m
             real(c_float), value :: stddev
         end function
 
-        function hiprandGenerateLogNormalDouble(generator, output_data, n, &
+        function hiprandGenerateLogNormalDouble_orig(generator, output_data, n, &
         mean, stddev) bind(C, name="hiprandGenerateLogNormalDouble")
             use iso_c_binding
             implicit none
-            integer(c_int) :: hiprandGenerateLogNormalDouble
+            integer(c_int) :: hiprandGenerateLogNormalDouble_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
@@ -144,11 +154,11 @@ module hiprand_m
             real(c_double), value :: stddev
         end function
 
-        function hiprandGeneratePoisson(generator, output_data, n, lambda) &
+        function hiprandGeneratePoisson_orig(generator, output_data, n, lambda) &
         bind(C, name="hiprandGeneratePoisson")
             use iso_c_binding
             implicit none
-            integer(c_int) :: hiprandGeneratePoisson
+            integer(c_int) :: hiprandGeneratePoisson_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
@@ -163,11 +173,11 @@ module hiprand_m
             integer(c_size_t), value :: generator
         end function
 
-        function hiprandSetStream(generator, stream) &
+        function hiprandSetStream_orig(generator, stream) &
         bind(C, name="hiprandSetStream")
             use iso_c_binding
             implicit none
-            integer(c_int) :: hiprandSetStream
+            integer(c_int) :: hiprandSetStream_orig
             integer(c_size_t), value :: generator
             integer(c_size_t), value :: stream
         end function
@@ -224,4 +234,243 @@ module hiprand_m
             integer(c_size_t), value :: discrete_distribution
         end function
     end interface
+
+    ! Overloads for Fortran arrays in device memory (e.g. allocated by
+    ! hipfort's hipMalloc or associated with device memory by c_f_pointer),
+    ! n is the size of the array. Arrays must be contiguous, numbers are
+    ! generated without copies to the host.
+
+    interface hiprandSetStream
+        procedure hiprandSetStream_orig, hiprandSetStream_c_ptr
+    end interface
+
+    interface
+        function hiprandSetStream_c_ptr(generator, stream) &
+        bind(C, name="hiprandSetStream")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: hiprandSetStream_c_ptr
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: stream
+        end function
+    end interface
+
+    interface hiprandGenerate
+        procedure hiprandGenerate_orig, &
+            hiprandGenerate_rank_1, hiprandGenerate_rank_2
+    end interface
+
+    interface hiprandGenerateLongLong
+        procedure hiprandGenerateLongLong_orig, &
+            hiprandGenerateLongLong_rank_1, hiprandGenerateLongLong_rank_2
+    end interface
+
+    interface hiprandGenerateUniform
+        procedure hiprandGenerateUniform_orig, &
+            hiprandGenerateUniform_rank_1, hiprandGenerateUniform_rank_2
+    end interface
+
+    interface hiprandGenerateUniformDouble
+        procedure hiprandGenerateUniformDouble_orig, &
+            hiprandGenerateUniformDouble_rank_1, hiprandGenerateUniformDouble_rank_2
+    end interface
+
+    interface hiprandGenerateNormal
+        procedure hiprandGenerateNormal_orig, &
+            hiprandGenerateNormal_rank_1, hiprandGenerateNormal_rank_2
+    end interface
+
+    interface hiprandGenerateNormalDouble
+        procedure hiprandGenerateNormalDouble_orig, &
+            hiprandGenerateNormalDouble_rank_1, hiprandGenerateNormalDouble_rank_2
+    end interface
+
+    interface hiprandGenerateLogNormal
+        procedure hiprandGenerateLogNormal_orig, &
+            hiprandGenerateLogNormal_rank_1, hiprandGenerateLogNormal_rank_2
+    end interface
+
+    interface hiprandGenerateLogNormalDouble
+        procedure hiprandGenerateLogNormalDouble_orig, &
+            hiprandGenerateLogNormalDouble_rank_1, hiprandGenerateLogNormalDouble_rank_2
+    end interface
+
+    interface hiprandGeneratePoisson
+        procedure hiprandGeneratePoisson_orig, &
+            hiprandGeneratePoisson_rank_1, hiprandGeneratePoisson_rank_2
+    end interface
+
+contains
+
+    function hiprandGenerate_rank_1(generator, output_data)
+        integer(c_int) :: hiprandGenerate_rank_1
+        integer(c_size_t), intent(in) :: generator
+        integer(c_int), target, contiguous, intent(inout) :: output_data(:)
+        hiprandGenerate_rank_1 = hiprandGenerate_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function hiprandGenerate_rank_2(generator, output_data)
+        integer(c_int) :: hiprandGenerate_rank_2
+        integer(c_size_t), intent(in) :: generator
+        integer(c_int), target, contiguous, intent(inout) :: output_data(:, :)
+        hiprandGenerate_rank_2 = hiprandGenerate_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function hiprandGenerateLongLong_rank_1(generator, output_data)
+        integer(c_int) :: hiprandGenerateLongLong_rank_1
+        integer(c_size_t), intent(in) :: generator
+        integer(c_long_long), target, contiguous, intent(inout) :: output_data(:)
+        hiprandGenerateLongLong_rank_1 = hiprandGenerateLongLong_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function hiprandGenerateLongLong_rank_2(generator, output_data)
+        integer(c_int) :: hiprandGenerateLongLong_rank_2
+        integer(c_size_t), intent(in) :: generator
+        integer(c_long_long), target, contiguous, intent(inout) :: output_data(:, :)
+        hiprandGenerateLongLong_rank_2 = hiprandGenerateLongLong_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function hiprandGenerateUniform_rank_1(generator, output_data)
+        integer(c_int) :: hiprandGenerateUniform_rank_1
+        integer(c_size_t), intent(in) :: generator
+        real(c_float), target, contiguous, intent(inout) :: output_data(:)
+        hiprandGenerateUniform_rank_1 = hiprandGenerateUniform_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function hiprandGenerateUniform_rank_2(generator, output_data)
+        integer(c_int) :: hiprandGenerateUniform_rank_2
+        integer(c_size_t), intent(in) :: generator
+        real(c_float), target, contiguous, intent(inout) :: output_data(:, :)
+        hiprandGenerateUniform_rank_2 = hiprandGenerateUniform_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function hiprandGenerateUniformDouble_rank_1(generator, output_data)
+        integer(c_int) :: hiprandGenerateUniformDouble_rank_1
+        integer(c_size_t), intent(in) :: generator
+        real(c_double), target, contiguous, intent(inout) :: output_data(:)
+        hiprandGenerateUniformDouble_rank_1 = hiprandGenerateUniformDouble_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function hiprandGenerateUniformDouble_rank_2(generator, output_data)
+        integer(c_int) :: hiprandGenerateUniformDouble_rank_2
+        integer(c_size_t), intent(in) :: generator
+        real(c_double), target, contiguous, intent(inout) :: output_data(:, :)
+        hiprandGenerateUniformDouble_rank_2 = hiprandGenerateUniformDouble_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function hiprandGenerateNormal_rank_1(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: hiprandGenerateNormal_rank_1
+        integer(c_size_t), intent(in) :: generator
+        real(c_float), target, contiguous, intent(inout) :: output_data(:)
+        real(c_float), intent(in) :: mean
+        real(c_float), intent(in) :: stddev
+        hiprandGenerateNormal_rank_1 = hiprandGenerateNormal_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function hiprandGenerateNormal_rank_2(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: hiprandGenerateNormal_rank_2
+        integer(c_size_t), intent(in) :: generator
+        real(c_float), target, contiguous, intent(inout) :: output_data(:, :)
+        real(c_float), intent(in) :: mean
+        real(c_float), intent(in) :: stddev
+        hiprandGenerateNormal_rank_2 = hiprandGenerateNormal_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function hiprandGenerateNormalDouble_rank_1(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: hiprandGenerateNormalDouble_rank_1
+        integer(c_size_t), intent(in) :: generator
+        real(c_double), target, contiguous, intent(inout) :: output_data(:)
+        real(c_double), intent(in) :: mean
+        real(c_double), intent(in) :: stddev
+        hiprandGenerateNormalDouble_rank_1 = hiprandGenerateNormalDouble_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function hiprandGenerateNormalDouble_rank_2(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: hiprandGenerateNormalDouble_rank_2
+        integer(c_size_t), intent(in) :: generator
+        real(c_double), target, contiguous, intent(inout) :: output_data(:, :)
+        real(c_double), intent(in) :: mean
+        real(c_double), intent(in) :: stddev
+        hiprandGenerateNormalDouble_rank_2 = hiprandGenerateNormalDouble_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function hiprandGenerateLogNormal_rank_1(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: hiprandGenerateLogNormal_rank_1
+        integer(c_size_t), intent(in) :: generator
+        real(c_float), target, contiguous, intent(inout) :: output_data(:)
+        real(c_float), intent(in) :: mean
+        real(c_float), intent(in) :: stddev
+        hiprandGenerateLogNormal_rank_1 = hiprandGenerateLogNormal_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function hiprandGenerateLogNormal_rank_2(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: hiprandGenerateLogNormal_rank_2
+        integer(c_size_t), intent(in) :: generator
+        real(c_float), target, contiguous, intent(inout) :: output_data(:, :)
+        real(c_float), intent(in) :: mean
+        real(c_float), intent(in) :: stddev
+        hiprandGenerateLogNormal_rank_2 = hiprandGenerateLogNormal_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function hiprandGenerateLogNormalDouble_rank_1(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: hiprandGenerateLogNormalDouble_rank_1
+        integer(c_size_t), intent(in) :: generator
+        real(c_double), target, contiguous, intent(inout) :: output_data(:)
+        real(c_double), intent(in) :: mean
+        real(c_double), intent(in) :: stddev
+        hiprandGenerateLogNormalDouble_rank_1 = hiprandGenerateLogNormalDouble_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function hiprandGenerateLogNormalDouble_rank_2(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: hiprandGenerateLogNormalDouble_rank_2
+        integer(c_size_t), intent(in) :: generator
+        real(c_double), target, contiguous, intent(inout) :: output_data(:, :)
+        real(c_double), intent(in) :: mean
+        real(c_double), intent(in) :: stddev
+        hiprandGenerateLogNormalDouble_rank_2 = hiprandGenerateLogNormalDouble_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function hiprandGeneratePoisson_rank_1(generator, output_data, &
+    lambda)
+        integer(c_int) :: hiprandGeneratePoisson_rank_1
+        integer(c_size_t), intent(in) :: generator
+        integer(c_int), target, contiguous, intent(inout) :: output_data(:)
+        real(c_double), intent(in) :: lambda
+        hiprandGeneratePoisson_rank_1 = hiprandGeneratePoisson_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), lambda)
+    end function
+
+    function hiprandGeneratePoisson_rank_2(generator, output_data, &
+    lambda)
+        integer(c_int) :: hiprandGeneratePoisson_rank_2
+        integer(c_size_t), intent(in) :: generator
+        integer(c_int), target, contiguous, intent(inout) :: output_data(:, :)
+        real(c_double), intent(in) :: lambda
+        hiprandGeneratePoisson_rank_2 = hiprandGeneratePoisson_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), lambda)
+    end function
 end module hiprand_m
@@ -26,8 +26,35 @@ module rocrand_m
     integer, public :: ROCRAND_RNG_PSEUDO_MRG32K3A = 402
     integer, public :: ROCRAND_RNG_PSEUDO_MTGP32 = 403
     integer, public :: ROCRAND_RNG_PSEUDO_PHILOX4_32_10 = 404
+    integer, public :: ROCRAND_RNG_PSEUDO_THREEFRY4_32_20 = 405
+    integer, public :: ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 = 406
+    integer, public :: ROCRAND_RNG_PSEUDO_XOSHIRO128PP = 407
+    integer, public :: ROCRAND_RNG_PSEUDO_PCG32 = 408
+    integer, public :: ROCRAND_RNG_PSEUDO_MT19937 = 409
+    integer, public :: ROCRAND_RNG_PSEUDO_PHILOX4_64_10 = 410
     integer, public :: ROCRAND_RNG_QUASI_DEFAULT = 500
     integer, public :: ROCRAND_RNG_QUASI_SOBOL32 = 501
+    integer, public :: ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 = 502
+    integer, public :: ROCRAND_RNG_QUASI_SOBOL64 = 503
+    integer, public :: ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 = 504
+    integer, public :: ROCRAND_RNG_QUASI_LATTICE = 505
+    integer, public :: ROCRAND_RNG_QUASI_HALTON = 506
+
+    integer, public :: ROCRAND_ORDERING_PSEUDO_BEST = 100
+    integer, public :: ROCRAND_ORDERING_PSEUDO_DEFAULT = 101
+    integer, public :: ROCRAND_ORDERING_PSEUDO_SEEDED = 102
+    integer, public :: ROCRAND_ORDERING_PSEUDO_LEGACY = 103
+    integer, public :: ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT = 104
+    integer, public :: ROCRAND_ORDERING_QUASI_DEFAULT = 201
+    integer, public :: ROCRAND_ORDERING_QUASI_POINT_MAJOR = 202
+
+    integer, public :: ROCRAND_MANAGED_HINT_PREFETCH = 1
+    integer, public :: ROCRAND_MANAGED_HINT_READ_MOSTLY = 2
+    integer, public :: ROCRAND_MANAGED_HINT_PREFETCH_TO_HOST = 4
+
+    integer, public :: ROCRAND_DOUBLE_RESOLUTION_DEFAULT = 0
+    integer, public :: ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT = 1
+    integer, public :: ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT = 2
 
     integer, public :: ROCRAND_STATUS_SUCCESS = 0
     integer, public :: ROCRAND_STATUS_VERSION_MISMATCH  = 100
@@ -58,41 +85,73 @@ module rocrand_m
             integer(c_size_t), value :: generator
         end function
 
-        function rocrand_generate(generator, output_data, n) &
+        function rocrand_generate_orig(generator, output_data, n) &
         bind(C, name="rocrand_generate")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_generate
+            integer(c_int) :: rocrand_generate_orig
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_generate_long_long_orig(generator, output_data, n) &
+        bind(C, name="rocrand_generate_long_long")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_long_long_orig
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_generate_range_orig(generator, output_data, start, n) &
+        bind(C, name="rocrand_generate_range")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_range_orig
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(kind =8), value :: start
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_generate_long_long_range_orig(generator, output_data, &
+        start, n) bind(C, name="rocrand_generate_long_long_range")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_long_long_range_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
+            integer(kind =8), value :: start
             integer(c_size_t), value :: n
         end function
 
-        function rocrand_generate_uniform(generator, output_data, n) &
+        function rocrand_generate_uniform_orig(generator, output_data, n) &
         bind(C, name="rocrand_generate_uniform")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_generate_uniform
+            integer(c_int) :: rocrand_generate_uniform_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
         end function
 
-        function rocrand_generate_uniform_double(generator, output_data, n) &
+        function rocrand_generate_uniform_double_orig(generator, output_data, n) &
         bind(C, name="rocrand_generate_uniform_double")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_generate_uniform_double
+            integer(c_int) :: rocrand_generate_uniform_double_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
         end function
 
-        function rocrand_generate_normal(generator, output_data, n, mean, &
+        function rocrand_generate_normal_orig(generator, output_data, n, mean, &
         stddev) bind(C, name="rocrand_generate_normal")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_generate_normal
+            integer(c_int) :: rocrand_generate_normal_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
@@ -100,11 +159,11 @@ module rocrand_m
             real(c_float), value :: stddev
         end function
 
-        function rocrand_generate_normal_double(generator, output_data, n, &
+        function rocrand_generate_normal_double_orig(generator, output_data, n, &
         mean, stddev) bind(C, name="rocrand_generate_normal_double")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_generate_normal_double
+            integer(c_int) :: rocrand_generate_normal_double_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
@@ -112,11 +171,11 @@ module rocrand_m
             real(c_double), value :: stddev
         end function
 
-        function rocrand_generate_log_normal(generator, output_data, n, mean, &
+        function rocrand_generate_log_normal_orig(generator, output_data, n, mean, &
         stddev) bind(C, name="rocrand_generate_log_normal")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_generate_log_normal
+            integer(c_int) :: rocrand_generate_log_normal_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
@@ -124,107 +183,1261 @@ module rocrand_m
             real(c_float), value :: stddev
         end function
 
-        function rocrand_generate_log_normal_double(generator, output_data, n, &
+        function rocrand_generate_log_normal_double_orig(generator, output_data, n, &
         mean, stddev) bind(C, name="rocrand_generate_log_normal_double")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_generate_log_normal_double
+            integer(c_int) :: rocrand_generate_log_normal_double_orig
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_double), value :: mean
+            real(c_double), value :: stddev
+        end function
+
+        function rocrand_generate_uniform_half(generator, output_data, n) &
+        bind(C, name="rocrand_generate_uniform_half")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_uniform_half
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_generate_normal_half(generator, output_data, n, &
+        mean, stddev) bind(C, name="rocrand_generate_normal_half")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_normal_half
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_float), value :: mean
+            real(c_float), value :: stddev
+        end function
+
+        function rocrand_generate_log_normal_half(generator, output_data, n, &
+        mean, stddev) bind(C, name="rocrand_generate_log_normal_half")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_log_normal_half
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
+            real(c_float), value :: mean
+            real(c_float), value :: stddev
+        end function
+
+        function rocrand_generate_2d(generator, output_data, width, &
+        height, pitch) bind(C, name="rocrand_generate_2d")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_2d
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: width
+            integer(c_size_t), value :: height
+            integer(c_size_t), value :: pitch
+        end function
+
+        function rocrand_generate_uniform_2d(generator, output_data, width, &
+        height, pitch) bind(C, name="rocrand_generate_uniform_2d")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_uniform_2d
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: width
+            integer(c_size_t), value :: height
+            integer(c_size_t), value :: pitch
+        end function
+
+        function rocrand_generate_uniform_double_2d(generator, output_data, width, &
+        height, pitch) bind(C, name="rocrand_generate_uniform_double_2d")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_uniform_double_2d
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: width
+            integer(c_size_t), value :: height
+            integer(c_size_t), value :: pitch
+        end function
+
+        function rocrand_generate_normal_2d(generator, output_data, width, &
+        height, pitch, mean, stddev) bind(C, name="rocrand_generate_normal_2d")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_normal_2d
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: width
+            integer(c_size_t), value :: height
+            integer(c_size_t), value :: pitch
+            real(c_float), value :: mean
+            real(c_float), value :: stddev
+        end function
+
+        function rocrand_generate_normal_double_2d(generator, output_data, width, &
+        height, pitch, mean, stddev) bind(C, name="rocrand_generate_normal_double_2d")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_normal_double_2d
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: width
+            integer(c_size_t), value :: height
+            integer(c_size_t), value :: pitch
+            real(c_double), value :: mean
+            real(c_double), value :: stddev
+        end function
+
+        function rocrand_generate_log_normal_2d(generator, output_data, width, &
+        height, pitch, mean, stddev) bind(C, name="rocrand_generate_log_normal_2d")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_log_normal_2d
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: width
+            integer(c_size_t), value :: height
+            integer(c_size_t), value :: pitch
+            real(c_float), value :: mean
+            real(c_float), value :: stddev
+        end function
+
+        function rocrand_generate_log_normal_double_2d(generator, output_data, width, &
+        height, pitch, mean, stddev) bind(C, name="rocrand_generate_log_normal_double_2d")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_log_normal_double_2d
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: width
+            integer(c_size_t), value :: height
+            integer(c_size_t), value :: pitch
             real(c_double), value :: mean
             real(c_double), value :: stddev
         end function
 
-        function rocrand_generate_poisson(generator, output_data, n, lambda) &
+        function rocrand_generate_ensemble(generator, output_data, seeds, &
+        k, n) bind(C, name="rocrand_generate_ensemble")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_ensemble
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            type(c_ptr), value :: seeds
+            integer(c_size_t), value :: k
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_generate_uniform_ensemble(generator, output_data, &
+        seeds, k, n) bind(C, name="rocrand_generate_uniform_ensemble")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_uniform_ensemble
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            type(c_ptr), value :: seeds
+            integer(c_size_t), value :: k
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_generate_uniform_int_orig(generator, output_data, n, &
+        lo, hi) bind(C, name="rocrand_generate_uniform_int")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_uniform_int_orig
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            integer(c_int), value :: lo
+            integer(c_int), value :: hi
+        end function
+
+        function rocrand_generate_uniform_long_long_orig(generator, output_data, &
+        n, lo, hi) bind(C, name="rocrand_generate_uniform_long_long")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_uniform_long_long_orig
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            integer(kind =8), value :: lo
+            integer(kind =8), value :: hi
+        end function
+
+        function rocrand_generate_poisson_orig(generator, output_data, n, lambda) &
         bind(C, name="rocrand_generate_poisson")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_generate_poisson
+            integer(c_int) :: rocrand_generate_poisson_orig
             integer(c_size_t), value :: generator
             type(c_ptr), value :: output_data
             integer(c_size_t), value :: n
             real(c_double), value :: lambda
         end function
 
-        function rocrand_initialize_generator(generator) &
-        bind(C, name="rocrand_initialize_generator")
+        function rocrand_generate_poisson_array(generator, output_data, &
+        lambdas, n) bind(C, name="rocrand_generate_poisson_array")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_initialize_generator
+            integer(c_int) :: rocrand_generate_poisson_array
             integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            type(c_ptr), value :: lambdas
+            integer(c_size_t), value :: n
         end function
 
-        function rocrand_set_stream(generator, stream) &
-        bind(C, name="rocrand_set_stream")
+        function rocrand_generate_binomial_array(generator, output_data, &
+        trials, probabilities, n) bind(C, name="rocrand_generate_binomial_array")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_set_stream
+            integer(c_int) :: rocrand_generate_binomial_array
             integer(c_size_t), value :: generator
-            integer(c_size_t), value :: stream
+            type(c_ptr), value :: output_data
+            type(c_ptr), value :: trials
+            type(c_ptr), value :: probabilities
+            integer(c_size_t), value :: n
         end function
 
-        function rocrand_set_seed(generator, seed) &
-        bind(C, name="rocrand_set_seed")
+        function rocrand_generate_multinomial_array(generator, output_data, &
+        trials, probabilities, categories, n) &
+        bind(C, name="rocrand_generate_multinomial_array")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_set_seed
+            integer(c_int) :: rocrand_generate_multinomial_array
             integer(c_size_t), value :: generator
-            integer(kind =8), value :: seed
+            type(c_ptr), value :: output_data
+            type(c_ptr), value :: trials
+            type(c_ptr), value :: probabilities
+            integer(c_int), value :: categories
+            integer(c_size_t), value :: n
         end function
 
-        function rocrand_set_offset(generator, offset) &
-        bind(C, name="rocrand_set_offset")
+        function rocrand_generate_gamma(generator, output_data, n, &
+        shape, scale) bind(C, name="rocrand_generate_gamma")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_set_offset
+            integer(c_int) :: rocrand_generate_gamma
             integer(c_size_t), value :: generator
-            integer(kind =8), value :: offset
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_float), value :: shape
+            real(c_float), value :: scale
         end function
 
-        function rocrand_set_quasi_random_generator_dimensions(generator, &
-        dimensions) bind(C, name="rocrand_set_quasi_random_generator_dimensions")
+        function rocrand_generate_gamma_double(generator, output_data, n, &
+        shape, scale) bind(C, name="rocrand_generate_gamma_double")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_set_quasi_random_generator_dimensions
+            integer(c_int) :: rocrand_generate_gamma_double
             integer(c_size_t), value :: generator
-            integer(c_int), value :: dimensions
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_double), value :: shape
+            real(c_double), value :: scale
         end function
 
-        function rocrand_get_version(version) &
-        bind(C, name="rocrand_get_version")
+        function rocrand_generate_beta(generator, output_data, n, &
+        alpha, beta) bind(C, name="rocrand_generate_beta")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_get_version
-            integer(c_int) :: version
+            integer(c_int) :: rocrand_generate_beta
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_float), value :: alpha
+            real(c_float), value :: beta
         end function
 
-        function rocrand_create_poisson_distribution(lambda, &
-        discrete_distribution) bind(C, name="rocrand_create_poisson_distribution")
+        function rocrand_generate_beta_double(generator, output_data, n, &
+        alpha, beta) bind(C, name="rocrand_generate_beta_double")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_create_poisson_distribution
+            integer(c_int) :: rocrand_generate_beta_double
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_double), value :: alpha
+            real(c_double), value :: beta
+        end function
+
+        function rocrand_generate_exponential(generator, output_data, n, &
+        lambda) bind(C, name="rocrand_generate_exponential")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_exponential
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_float), value :: lambda
+        end function
+
+        function rocrand_generate_exponential_double(generator, output_data, n, &
+        lambda) bind(C, name="rocrand_generate_exponential_double")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_exponential_double
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
             real(c_double), value :: lambda
-            integer(c_size_t) :: discrete_distribution
         end function
 
-        function rocrand_create_discrete_distribution(probabilities, size, offset, &
-        discrete_distribution) bind(C, name="rocrand_create_discrete_distribution")
+        function rocrand_generate_bernoulli_bits(generator, output_data, n_bits, &
+        p) bind(C, name="rocrand_generate_bernoulli_bits")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_create_discrete_distribution
-            real(c_double), intent(in) :: probabilities
-            integer(c_int), value :: size
-            integer(c_int), value :: offset
-            integer(c_size_t), value :: discrete_distribution
+            integer(c_int) :: rocrand_generate_bernoulli_bits
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n_bits
+            real(c_double), value :: p
         end function
 
-        function rocrand_destroy_discrete_distribution(discrete_distribution) &
-        bind(C, name="rocrand_destroy_discrete_distribution")
+        function rocrand_generate_truncated_normal(generator, output_data, n, &
+        mean, stddev, a, b) bind(C, name="rocrand_generate_truncated_normal")
             use iso_c_binding
             implicit none
-            integer(c_int) :: rocrand_destroy_discrete_distribution
-            integer(c_size_t), value :: discrete_distribution
+            integer(c_int) :: rocrand_generate_truncated_normal
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_float), value :: mean
+            real(c_float), value :: stddev
+            real(c_float), value :: a
+            real(c_float), value :: b
         end function
-    end interface
+
+        function rocrand_generate_truncated_normal_double(generator, output_data, n, &
+        mean, stddev, a, b) bind(C, name="rocrand_generate_truncated_normal_double")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_truncated_normal_double
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_double), value :: mean
+            real(c_double), value :: stddev
+            real(c_double), value :: a
+            real(c_double), value :: b
+        end function
+
+        function rocrand_generate_multivariate_normal(generator, output_data, n, &
+        dimensions, mean, factor) bind(C, name="rocrand_generate_multivariate_normal")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_multivariate_normal
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            integer(c_int), value :: dimensions
+            type(c_ptr), value :: mean
+            type(c_ptr), value :: factor
+        end function
+
+        function rocrand_generate_multivariate_normal_double(generator, output_data, n, &
+        dimensions, mean, factor) bind(C, name="rocrand_generate_multivariate_normal_double")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_multivariate_normal_double
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            integer(c_int), value :: dimensions
+            type(c_ptr), value :: mean
+            type(c_ptr), value :: factor
+        end function
+
+        function rocrand_generate_categorical(generator, output_data, &
+        probabilities, batch, n_categories, ld) &
+        bind(C, name="rocrand_generate_categorical")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_categorical
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            type(c_ptr), value :: probabilities
+            integer(c_size_t), value :: batch
+            integer(c_int), value :: n_categories
+            integer(c_size_t), value :: ld
+        end function
+
+        function rocrand_generate_permutation(generator, output_data, n) &
+        bind(C, name="rocrand_generate_permutation")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_permutation
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_shuffle(generator, data, n, element_size) &
+        bind(C, name="rocrand_shuffle")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_shuffle
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: data
+            integer(c_size_t), value :: n
+            integer(c_size_t), value :: element_size
+        end function
+
+        function rocrand_sample_without_replacement(generator, output_data, &
+        k, n, weights) bind(C, name="rocrand_sample_without_replacement")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_sample_without_replacement
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: k
+            integer(c_size_t), value :: n
+            type(c_ptr), value :: weights
+        end function
+
+        function rocrand_stochastic_round_half(generator, input_data, &
+        output_data, n) bind(C, name="rocrand_stochastic_round_half")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_stochastic_round_half
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: input_data
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_stochastic_round_bfloat16(generator, input_data, &
+        output_data, n) bind(C, name="rocrand_stochastic_round_bfloat16")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_stochastic_round_bfloat16
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: input_data
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_stochastic_round_int8(generator, input_data, &
+        output_data, n, scale) bind(C, name="rocrand_stochastic_round_int8")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_stochastic_round_int8
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: input_data
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_float), value :: scale
+        end function
+
+        function rocrand_generate_batch(generator, requests, count) &
+        bind(C, name="rocrand_generate_batch")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_batch
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: requests
+            integer(c_size_t), value :: count
+        end function
+
+        function rocrand_generate_to_host(generator, request, chunk_size) &
+        bind(C, name="rocrand_generate_to_host")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_to_host
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: request
+            integer(c_size_t), value :: chunk_size
+        end function
+
+        function rocrand_reserve_sequence(generator, n, seed, position) &
+        bind(C, name="rocrand_reserve_sequence")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_reserve_sequence
+            integer(c_size_t), value :: generator
+            integer(c_size_t), value :: n
+            integer(kind =8) :: seed
+            integer(kind =8) :: position
+        end function
+
+        function rocrand_initialize_generator(generator) &
+        bind(C, name="rocrand_initialize_generator")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_initialize_generator
+            integer(c_size_t), value :: generator
+        end function
+
+        function rocrand_set_capture_safe(generator, capture_safe) &
+        bind(C, name="rocrand_set_capture_safe")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_capture_safe
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: capture_safe
+        end function
+
+        function rocrand_set_stream_orig(generator, stream) &
+        bind(C, name="rocrand_set_stream")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_stream_orig
+            integer(c_size_t), value :: generator
+            integer(c_size_t), value :: stream
+        end function
+
+        function rocrand_set_seed(generator, seed) &
+        bind(C, name="rocrand_set_seed")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_seed
+            integer(c_size_t), value :: generator
+            integer(kind =8), value :: seed
+        end function
+
+        function rocrand_prepare_seed(generator, seed) &
+        bind(C, name="rocrand_prepare_seed")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_prepare_seed
+            integer(c_size_t), value :: generator
+            integer(kind =8), value :: seed
+        end function
+
+        function rocrand_set_offset(generator, offset) &
+        bind(C, name="rocrand_set_offset")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_offset
+            integer(c_size_t), value :: generator
+            integer(kind =8), value :: offset
+        end function
+
+        function rocrand_set_ordering(generator, order) &
+        bind(C, name="rocrand_set_ordering")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_ordering
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: order
+        end function
+
+        function rocrand_set_normal_method(generator, method) &
+        bind(C, name="rocrand_set_normal_method")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_normal_method
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: method
+        end function
+
+        function rocrand_set_math_mode(generator, mode) &
+        bind(C, name="rocrand_set_math_mode")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_math_mode
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: mode
+        end function
+
+        function rocrand_set_double_resolution(generator, resolution) &
+        bind(C, name="rocrand_set_double_resolution")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_double_resolution
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: resolution
+        end function
+
+        function rocrand_set_permutation_method(generator, method) &
+        bind(C, name="rocrand_set_permutation_method")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_permutation_method
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: method
+        end function
+
+        function rocrand_set_managed_memory_hints(generator, hints) &
+        bind(C, name="rocrand_set_managed_memory_hints")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_managed_memory_hints
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: hints
+        end function
+
+        function rocrand_set_engine_count(generator, engine_count) &
+        bind(C, name="rocrand_set_engine_count")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_engine_count
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: engine_count
+        end function
+
+        function rocrand_get_generator_memory_usage(generator, bytes) &
+        bind(C, name="rocrand_get_generator_memory_usage")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_get_generator_memory_usage
+            integer(c_size_t), value :: generator
+            integer(c_size_t) :: bytes
+        end function
+
+        function rocrand_set_allocator(generator, malloc_fn, free_fn, user_data) &
+        bind(C, name="rocrand_set_allocator")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_allocator
+            integer(c_size_t), value :: generator
+            type(c_funptr), value :: malloc_fn
+            type(c_funptr), value :: free_fn
+            type(c_ptr), value :: user_data
+        end function
+
+        function rocrand_set_default_allocator(malloc_fn, free_fn, user_data) &
+        bind(C, name="rocrand_set_default_allocator")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_default_allocator
+            type(c_funptr), value :: malloc_fn
+            type(c_funptr), value :: free_fn
+            type(c_ptr), value :: user_data
+        end function
+
+        function rocrand_get_state_size(generator, bytes) &
+        bind(C, name="rocrand_get_state_size")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_get_state_size
+            integer(c_size_t), value :: generator
+            integer(c_size_t) :: bytes
+        end function
+
+        function rocrand_save_state(generator, state, stream) &
+        bind(C, name="rocrand_save_state")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_save_state
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: state
+            integer(c_size_t), value :: stream
+        end function
+
+        function rocrand_load_state(generator, state, stream) &
+        bind(C, name="rocrand_load_state")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_load_state
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: state
+            integer(c_size_t), value :: stream
+        end function
+
+        function rocrand_export_generator(generator, handle) &
+        bind(C, name="rocrand_export_generator")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_export_generator
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: handle
+        end function
+
+        function rocrand_import_generator(handle, generator) &
+        bind(C, name="rocrand_import_generator")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_import_generator
+            type(c_ptr), value :: handle
+            integer(c_size_t) :: generator
+        end function
+
+        function rocrand_fork_generator(parent, child, subsequence_id) &
+        bind(C, name="rocrand_fork_generator")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_fork_generator
+            integer(c_size_t), value :: parent
+            integer(c_size_t) :: child
+            integer(c_long_long), value :: subsequence_id
+        end function
+
+        function rocrand_acquire_stream_generator(generator, stream, lease) &
+        bind(C, name="rocrand_acquire_stream_generator")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_acquire_stream_generator
+            integer(c_size_t), value :: generator
+            integer(c_size_t), value :: stream
+            integer(c_size_t) :: lease
+        end function
+
+        function rocrand_release_stream_generator(generator, lease) &
+        bind(C, name="rocrand_release_stream_generator")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_release_stream_generator
+            integer(c_size_t), value :: generator
+            integer(c_size_t), value :: lease
+        end function
+
+        function rocrand_set_subsequence_partition(generator, rank, nranks) &
+        bind(C, name="rocrand_set_subsequence_partition")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_subsequence_partition
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: rank
+            integer(c_int), value :: nranks
+        end function
+
+        function rocrand_set_poisson_cache_size(generator, bytes) &
+        bind(C, name="rocrand_set_poisson_cache_size")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_poisson_cache_size
+            integer(c_size_t), value :: generator
+            integer(c_size_t), value :: bytes
+        end function
+
+        function rocrand_get_poisson_cache_stats(generator, hits, misses) &
+        bind(C, name="rocrand_get_poisson_cache_stats")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_get_poisson_cache_stats
+            integer(c_size_t), value :: generator
+            integer(kind =8) :: hits
+            integer(kind =8) :: misses
+        end function
+
+        function rocrand_get_generator_stats(generator, stats) &
+        bind(C, name="rocrand_get_generator_stats")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_get_generator_stats
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: stats
+        end function
+
+        function rocrand_get_telemetry_stats(rng_type, stats) &
+        bind(C, name="rocrand_get_telemetry_stats")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_get_telemetry_stats
+            integer(c_int), value :: rng_type
+            type(c_ptr), value :: stats
+        end function
+
+        function rocrand_set_quasi_random_generator_dimensions(generator, &
+        dimensions) bind(C, name="rocrand_set_quasi_random_generator_dimensions")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_quasi_random_generator_dimensions
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: dimensions
+        end function
+
+        function rocrand_set_quasi_random_generator_first_dimension(generator, &
+        first_dimension) bind(C, name="rocrand_set_quasi_random_generator_first_dimension")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_quasi_random_generator_first_dimension
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: first_dimension
+        end function
+
+        function rocrand_set_lattice_generating_vector(generator, vector, &
+        size) bind(C, name="rocrand_set_lattice_generating_vector")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_lattice_generating_vector
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: vector
+            integer(c_int), value :: size
+        end function
+
+        function rocrand_get_version(version) &
+        bind(C, name="rocrand_get_version")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_get_version
+            integer(c_int) :: version
+        end function
+
+        function rocrand_get_host_tables(tables) &
+        bind(C, name="rocrand_get_host_tables")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_get_host_tables
+            type(c_ptr) :: tables
+        end function
+
+        function rocrand_get_device_tables(tables) &
+        bind(C, name="rocrand_get_device_tables")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_get_device_tables
+            type(c_ptr) :: tables
+        end function
+
+        function rocrand_create_multi_device_generator(generator, rng_type, &
+        devices, device_count) &
+        bind(C, name="rocrand_create_multi_device_generator")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_create_multi_device_generator
+            integer(c_size_t) :: generator
+            integer(c_int), value :: rng_type
+            integer(c_int), intent(in) :: devices(*)
+            integer(c_int), value :: device_count
+        end function
+
+        function rocrand_destroy_multi_device_generator(generator) &
+        bind(C, name="rocrand_destroy_multi_device_generator")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_destroy_multi_device_generator
+            integer(c_size_t), value :: generator
+        end function
+
+        function rocrand_set_multi_device_seed(generator, seed) &
+        bind(C, name="rocrand_set_multi_device_seed")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_multi_device_seed
+            integer(c_size_t), value :: generator
+            integer(kind =8), value :: seed
+        end function
+
+        function rocrand_set_multi_device_offset(generator, offset) &
+        bind(C, name="rocrand_set_multi_device_offset")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_multi_device_offset
+            integer(c_size_t), value :: generator
+            integer(kind =8), value :: offset
+        end function
+
+        function rocrand_generate_multi_device(generator, output_data, sizes) &
+        bind(C, name="rocrand_generate_multi_device")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_multi_device
+            integer(c_size_t), value :: generator
+            type(c_ptr), intent(in) :: output_data(*)
+            integer(c_size_t), intent(in) :: sizes(*)
+        end function
+
+        function rocrand_create_poisson_distribution(lambda, &
+        discrete_distribution) bind(C, name="rocrand_create_poisson_distribution")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_create_poisson_distribution
+            real(c_double), value :: lambda
+            integer(c_size_t) :: discrete_distribution
+        end function
+
+        function rocrand_create_discrete_distribution(probabilities, size, offset, &
+        discrete_distribution) bind(C, name="rocrand_create_discrete_distribution")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_create_discrete_distribution
+            real(c_double), intent(in) :: probabilities
+            integer(c_int), value :: size
+            integer(c_int), value :: offset
+            integer(c_size_t), value :: discrete_distribution
+        end function
+
+        function rocrand_create_discrete_distribution_device(probabilities, &
+        size, offset, discrete_distribution) &
+        bind(C, name="rocrand_create_discrete_distribution_device")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_create_discrete_distribution_device
+            type(c_ptr), value :: probabilities
+            integer(c_int), value :: size
+            integer(c_int), value :: offset
+            integer(c_size_t), value :: discrete_distribution
+        end function
+
+        function rocrand_create_discrete_distribution_updatable(probabilities, &
+        size, offset, discrete_distribution) &
+        bind(C, name="rocrand_create_discrete_distribution_updatable")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_create_discrete_distribution_updatable
+            real(c_double), intent(in) :: probabilities
+            integer(c_int), value :: size
+            integer(c_int), value :: offset
+            integer(c_size_t), value :: discrete_distribution
+        end function
+
+        function rocrand_update_discrete_distribution(discrete_distribution, &
+        indices, probabilities, k) &
+        bind(C, name="rocrand_update_discrete_distribution")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_update_discrete_distribution
+            integer(c_size_t), value :: discrete_distribution
+            type(c_ptr), value :: indices
+            type(c_ptr), value :: probabilities
+            integer(c_int), value :: k
+        end function
+
+        function rocrand_destroy_discrete_distribution(discrete_distribution) &
+        bind(C, name="rocrand_destroy_discrete_distribution")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_destroy_discrete_distribution
+            integer(c_size_t), value :: discrete_distribution
+        end function
+    end interface
+
+    ! Overloads for Fortran arrays in device memory (e.g. allocated by
+    ! hipfort's hipMalloc or associated with device memory by c_f_pointer),
+    ! n is the size of the array. Arrays must be contiguous, numbers are
+    ! generated without copies to the host.
+
+    interface rocrand_set_stream
+        procedure rocrand_set_stream_orig, rocrand_set_stream_c_ptr
+    end interface
+
+    interface
+        function rocrand_set_stream_c_ptr(generator, stream) &
+        bind(C, name="rocrand_set_stream")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_stream_c_ptr
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: stream
+        end function
+    end interface
+
+    interface rocrand_generate
+        procedure rocrand_generate_orig, &
+            rocrand_generate_rank_1, rocrand_generate_rank_2
+    end interface
+
+    interface rocrand_generate_long_long
+        procedure rocrand_generate_long_long_orig, &
+            rocrand_generate_long_long_rank_1, rocrand_generate_long_long_rank_2
+    end interface
+
+    interface rocrand_generate_range
+        procedure rocrand_generate_range_orig, &
+            rocrand_generate_range_rank_1, rocrand_generate_range_rank_2
+    end interface
+
+    interface rocrand_generate_long_long_range
+        procedure rocrand_generate_long_long_range_orig, &
+            rocrand_generate_long_long_range_rank_1, rocrand_generate_long_long_range_rank_2
+    end interface
+
+    interface rocrand_generate_uniform
+        procedure rocrand_generate_uniform_orig, &
+            rocrand_generate_uniform_rank_1, rocrand_generate_uniform_rank_2
+    end interface
+
+    interface rocrand_generate_uniform_double
+        procedure rocrand_generate_uniform_double_orig, &
+            rocrand_generate_uniform_double_rank_1, rocrand_generate_uniform_double_rank_2
+    end interface
+
+    interface rocrand_generate_normal
+        procedure rocrand_generate_normal_orig, &
+            rocrand_generate_normal_rank_1, rocrand_generate_normal_rank_2
+    end interface
+
+    interface rocrand_generate_normal_double
+        procedure rocrand_generate_normal_double_orig, &
+            rocrand_generate_normal_double_rank_1, rocrand_generate_normal_double_rank_2
+    end interface
+
+    interface rocrand_generate_log_normal
+        procedure rocrand_generate_log_normal_orig, &
+            rocrand_generate_log_normal_rank_1, rocrand_generate_log_normal_rank_2
+    end interface
+
+    interface rocrand_generate_log_normal_double
+        procedure rocrand_generate_log_normal_double_orig, &
+            rocrand_generate_log_normal_double_rank_1, rocrand_generate_log_normal_double_rank_2
+    end interface
+
+    interface rocrand_generate_uniform_int
+        procedure rocrand_generate_uniform_int_orig, &
+            rocrand_generate_uniform_int_rank_1, rocrand_generate_uniform_int_rank_2
+    end interface
+
+    interface rocrand_generate_uniform_long_long
+        procedure rocrand_generate_uniform_long_long_orig, &
+            rocrand_generate_uniform_long_long_rank_1, rocrand_generate_uniform_long_long_rank_2
+    end interface
+
+    interface rocrand_generate_poisson
+        procedure rocrand_generate_poisson_orig, &
+            rocrand_generate_poisson_rank_1, rocrand_generate_poisson_rank_2
+    end interface
+
+contains
+
+    function rocrand_generate_rank_1(generator, output_data)
+        integer(c_int) :: rocrand_generate_rank_1
+        integer(c_size_t), intent(in) :: generator
+        integer(c_int), target, contiguous, intent(inout) :: output_data(:)
+        rocrand_generate_rank_1 = rocrand_generate_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function rocrand_generate_rank_2(generator, output_data)
+        integer(c_int) :: rocrand_generate_rank_2
+        integer(c_size_t), intent(in) :: generator
+        integer(c_int), target, contiguous, intent(inout) :: output_data(:, :)
+        rocrand_generate_rank_2 = rocrand_generate_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function rocrand_generate_long_long_rank_1(generator, output_data)
+        integer(c_int) :: rocrand_generate_long_long_rank_1
+        integer(c_size_t), intent(in) :: generator
+        integer(c_long_long), target, contiguous, intent(inout) :: output_data(:)
+        rocrand_generate_long_long_rank_1 = rocrand_generate_long_long_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function rocrand_generate_long_long_rank_2(generator, output_data)
+        integer(c_int) :: rocrand_generate_long_long_rank_2
+        integer(c_size_t), intent(in) :: generator
+        integer(c_long_long), target, contiguous, intent(inout) :: output_data(:, :)
+        rocrand_generate_long_long_rank_2 = rocrand_generate_long_long_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function rocrand_generate_range_rank_1(generator, output_data, &
+    start)
+        integer(c_int) :: rocrand_generate_range_rank_1
+        integer(c_size_t), intent(in) :: generator
+        integer(c_int), target, contiguous, intent(inout) :: output_data(:)
+        integer(kind =8), intent(in) :: start
+        rocrand_generate_range_rank_1 = rocrand_generate_range_orig(generator, c_loc(output_data), &
+            start, size(output_data, kind=c_size_t))
+    end function
+
+    function rocrand_generate_range_rank_2(generator, output_data, &
+    start)
+        integer(c_int) :: rocrand_generate_range_rank_2
+        integer(c_size_t), intent(in) :: generator
+        integer(c_int), target, contiguous, intent(inout) :: output_data(:, :)
+        integer(kind =8), intent(in) :: start
+        rocrand_generate_range_rank_2 = rocrand_generate_range_orig(generator, c_loc(output_data), &
+            start, size(output_data, kind=c_size_t))
+    end function
+
+    function rocrand_generate_long_long_range_rank_1(generator, output_data, &
+    start)
+        integer(c_int) :: rocrand_generate_long_long_range_rank_1
+        integer(c_size_t), intent(in) :: generator
+        integer(c_long_long), target, contiguous, intent(inout) :: output_data(:)
+        integer(kind =8), intent(in) :: start
+        rocrand_generate_long_long_range_rank_1 = rocrand_generate_long_long_range_orig(generator, c_loc(output_data), &
+            start, size(output_data, kind=c_size_t))
+    end function
+
+    function rocrand_generate_long_long_range_rank_2(generator, output_data, &
+    start)
+        integer(c_int) :: rocrand_generate_long_long_range_rank_2
+        integer(c_size_t), intent(in) :: generator
+        integer(c_long_long), target, contiguous, intent(inout) :: output_data(:, :)
+        integer(kind =8), intent(in) :: start
+        rocrand_generate_long_long_range_rank_2 = rocrand_generate_long_long_range_orig(generator, c_loc(output_data), &
+            start, size(output_data, kind=c_size_t))
+    end function
+
+    function rocrand_generate_uniform_rank_1(generator, output_data)
+        integer(c_int) :: rocrand_generate_uniform_rank_1
+        integer(c_size_t), intent(in) :: generator
+        real(c_float), target, contiguous, intent(inout) :: output_data(:)
+        rocrand_generate_uniform_rank_1 = rocrand_generate_uniform_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function rocrand_generate_uniform_rank_2(generator, output_data)
+        integer(c_int) :: rocrand_generate_uniform_rank_2
+        integer(c_size_t), intent(in) :: generator
+        real(c_float), target, contiguous, intent(inout) :: output_data(:, :)
+        rocrand_generate_uniform_rank_2 = rocrand_generate_uniform_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function rocrand_generate_uniform_double_rank_1(generator, output_data)
+        integer(c_int) :: rocrand_generate_uniform_double_rank_1
+        integer(c_size_t), intent(in) :: generator
+        real(c_double), target, contiguous, intent(inout) :: output_data(:)
+        rocrand_generate_uniform_double_rank_1 = rocrand_generate_uniform_double_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function rocrand_generate_uniform_double_rank_2(generator, output_data)
+        integer(c_int) :: rocrand_generate_uniform_double_rank_2
+        integer(c_size_t), intent(in) :: generator
+        real(c_double), target, contiguous, intent(inout) :: output_data(:, :)
+        rocrand_generate_uniform_double_rank_2 = rocrand_generate_uniform_double_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t))
+    end function
+
+    function rocrand_generate_normal_rank_1(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: rocrand_generate_normal_rank_1
+        integer(c_size_t), intent(in) :: generator
+        real(c_float), target, contiguous, intent(inout) :: output_data(:)
+        real(c_float), intent(in) :: mean
+        real(c_float), intent(in) :: stddev
+        rocrand_generate_normal_rank_1 = rocrand_generate_normal_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function rocrand_generate_normal_rank_2(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: rocrand_generate_normal_rank_2
+        integer(c_size_t), intent(in) :: generator
+        real(c_float), target, contiguous, intent(inout) :: output_data(:, :)
+        real(c_float), intent(in) :: mean
+        real(c_float), intent(in) :: stddev
+        rocrand_generate_normal_rank_2 = rocrand_generate_normal_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function rocrand_generate_normal_double_rank_1(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: rocrand_generate_normal_double_rank_1
+        integer(c_size_t), intent(in) :: generator
+        real(c_double), target, contiguous, intent(inout) :: output_data(:)
+        real(c_double), intent(in) :: mean
+        real(c_double), intent(in) :: stddev
+        rocrand_generate_normal_double_rank_1 = rocrand_generate_normal_double_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function rocrand_generate_normal_double_rank_2(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: rocrand_generate_normal_double_rank_2
+        integer(c_size_t), intent(in) :: generator
+        real(c_double), target, contiguous, intent(inout) :: output_data(:, :)
+        real(c_double), intent(in) :: mean
+        real(c_double), intent(in) :: stddev
+        rocrand_generate_normal_double_rank_2 = rocrand_generate_normal_double_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function rocrand_generate_log_normal_rank_1(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: rocrand_generate_log_normal_rank_1
+        integer(c_size_t), intent(in) :: generator
+        real(c_float), target, contiguous, intent(inout) :: output_data(:)
+        real(c_float), intent(in) :: mean
+        real(c_float), intent(in) :: stddev
+        rocrand_generate_log_normal_rank_1 = rocrand_generate_log_normal_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function rocrand_generate_log_normal_rank_2(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: rocrand_generate_log_normal_rank_2
+        integer(c_size_t), intent(in) :: generator
+        real(c_float), target, contiguous, intent(inout) :: output_data(:, :)
+        real(c_float), intent(in) :: mean
+        real(c_float), intent(in) :: stddev
+        rocrand_generate_log_normal_rank_2 = rocrand_generate_log_normal_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function rocrand_generate_log_normal_double_rank_1(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: rocrand_generate_log_normal_double_rank_1
+        integer(c_size_t), intent(in) :: generator
+        real(c_double), target, contiguous, intent(inout) :: output_data(:)
+        real(c_double), intent(in) :: mean
+        real(c_double), intent(in) :: stddev
+        rocrand_generate_log_normal_double_rank_1 = rocrand_generate_log_normal_double_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function rocrand_generate_log_normal_double_rank_2(generator, output_data, &
+    mean, stddev)
+        integer(c_int) :: rocrand_generate_log_normal_double_rank_2
+        integer(c_size_t), intent(in) :: generator
+        real(c_double), target, contiguous, intent(inout) :: output_data(:, :)
+        real(c_double), intent(in) :: mean
+        real(c_double), intent(in) :: stddev
+        rocrand_generate_log_normal_double_rank_2 = rocrand_generate_log_normal_double_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), mean, stddev)
+    end function
+
+    function rocrand_generate_uniform_int_rank_1(generator, output_data, &
+    lo, hi)
+        integer(c_int) :: rocrand_generate_uniform_int_rank_1
+        integer(c_size_t), intent(in) :: generator
+        integer(c_int), target, contiguous, intent(inout) :: output_data(:)
+        integer(c_int), intent(in) :: lo
+        integer(c_int), intent(in) :: hi
+        rocrand_generate_uniform_int_rank_1 = rocrand_generate_uniform_int_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), lo, hi)
+    end function
+
+    function rocrand_generate_uniform_int_rank_2(generator, output_data, &
+    lo, hi)
+        integer(c_int) :: rocrand_generate_uniform_int_rank_2
+        integer(c_size_t), intent(in) :: generator
+        integer(c_int), target, contiguous, intent(inout) :: output_data(:, :)
+        integer(c_int), intent(in) :: lo
+        integer(c_int), intent(in) :: hi
+        rocrand_generate_uniform_int_rank_2 = rocrand_generate_uniform_int_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), lo, hi)
+    end function
+
+    function rocrand_generate_uniform_long_long_rank_1(generator, output_data, &
+    lo, hi)
+        integer(c_int) :: rocrand_generate_uniform_long_long_rank_1
+        integer(c_size_t), intent(in) :: generator
+        integer(c_long_long), target, contiguous, intent(inout) :: output_data(:)
+        integer(kind =8), intent(in) :: lo
+        integer(kind =8), intent(in) :: hi
+        rocrand_generate_uniform_long_long_rank_1 = rocrand_generate_uniform_long_long_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), lo, hi)
+    end function
+
+    function rocrand_generate_uniform_long_long_rank_2(generator, output_data, &
+    lo, hi)
+        integer(c_int) :: rocrand_generate_uniform_long_long_rank_2
+        integer(c_size_t), intent(in) :: generator
+        integer(c_long_long), target, contiguous, intent(inout) :: output_data(:, :)
+        integer(kind =8), intent(in) :: lo
+        integer(kind =8), intent(in) :: hi
+        rocrand_generate_uniform_long_long_rank_2 = rocrand_generate_uniform_long_long_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), lo, hi)
+    end function
+
+    function rocrand_generate_poisson_rank_1(generator, output_data, &
+    lambda)
+        integer(c_int) :: rocrand_generate_poisson_rank_1
+        integer(c_size_t), intent(in) :: generator
+        integer(c_int), target, contiguous, intent(inout) :: output_data(:)
+        real(c_double), intent(in) :: lambda
+        rocrand_generate_poisson_rank_1 = rocrand_generate_poisson_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), lambda)
+    end function
+
+    function rocrand_generate_poisson_rank_2(generator, output_data, &
+    lambda)
+        integer(c_int) :: rocrand_generate_poisson_rank_2
+        integer(c_size_t), intent(in) :: generator
+        integer(c_int), target, contiguous, intent(inout) :: output_data(:, :)
+        real(c_double), intent(in) :: lambda
+        rocrand_generate_poisson_rank_2 = rocrand_generate_poisson_orig(generator, c_loc(output_data), &
+            size(output_data, kind=c_size_t), lambda)
+    end function
 end module rocrand_m
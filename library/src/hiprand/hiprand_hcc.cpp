@@ -78,17 +78,17 @@ rocrand_rng_type to_rocrand_rng_type(hiprandRngType_t rng_type)
         case HIPRAND_RNG_PSEUDO_PHILOX4_32_10:
             return ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
         case HIPRAND_RNG_PSEUDO_MT19937:
-            throw HIPRAND_STATUS_NOT_IMPLEMENTED;
+            return ROCRAND_RNG_PSEUDO_MT19937;
         case HIPRAND_RNG_QUASI_DEFAULT:
             return ROCRAND_RNG_QUASI_DEFAULT;
         case HIPRAND_RNG_QUASI_SOBOL32:
             return ROCRAND_RNG_QUASI_SOBOL32;
         case HIPRAND_RNG_QUASI_SCRAMBLED_SOBOL32:
-            throw HIPRAND_STATUS_NOT_IMPLEMENTED;
+            return ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32;
         case HIPRAND_RNG_QUASI_SOBOL64:
-            throw HIPRAND_STATUS_NOT_IMPLEMENTED;
+            return ROCRAND_RNG_QUASI_SOBOL64;
         case HIPRAND_RNG_QUASI_SCRAMBLED_SOBOL64:
-            throw HIPRAND_STATUS_NOT_IMPLEMENTED;
+            return ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64;
         default:
             throw HIPRAND_STATUS_TYPE_ERROR;
     }
@@ -114,9 +114,18 @@ hiprandCreateGenerator(hiprandGenerator_t * generator, hiprandRngType_t rng_type
 hiprandStatus_t HIPRANDAPI
 hiprandCreateGeneratorHost(hiprandGenerator_t * generator, hiprandRngType_t rng_type)
 {
-    (void) generator;
-    (void) rng_type;
-    return HIPRAND_STATUS_NOT_IMPLEMENTED;
+    try
+    {
+        return to_hiprand_status(
+            rocrand_create_generator_host(
+                (rocrand_generator *)(generator),
+                to_rocrand_rng_type(rng_type)
+            )
+        );
+    } catch(const hiprandStatus_t& error)
+    {
+        return error;
+    }
 }
 
 hiprandStatus_t HIPRANDAPI
@@ -141,6 +150,18 @@ hiprandGenerate(hiprandGenerator_t generator,
     );
 }
 
+hiprandStatus_t HIPRANDAPI
+hiprandGenerateLongLong(hiprandGenerator_t generator,
+                        unsigned long long * output_data, size_t n)
+{
+    return to_hiprand_status(
+        rocrand_generate_long_long(
+            (rocrand_generator)(generator),
+            output_data, n
+        )
+    );
+}
+
 hiprandStatus_t HIPRANDAPI
 hiprandGenerateUniform(hiprandGenerator_t generator,
                        float * output_data, size_t n)
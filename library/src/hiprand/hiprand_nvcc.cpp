@@ -150,6 +150,18 @@ hiprandGenerate(hiprandGenerator_t generator,
     );
 }
 
+hiprandStatus_t HIPRANDAPI
+hiprandGenerateLongLong(hiprandGenerator_t generator,
+                        unsigned long long * output_data, size_t n)
+{
+    return to_hiprand_status(
+        curandGenerateLongLong(
+            (curandGenerator_t)(generator),
+            output_data, n
+        )
+    );
+}
+
 hiprandStatus_t HIPRANDAPI
 hiprandGenerateUniform(hiprandGenerator_t generator,
                        float * output_data, size_t n)
@@ -0,0 +1,170 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCRAND_RNG_ALLOCATOR_H_
+#define ROCRAND_RNG_ALLOCATOR_H_
+
+#include <map>
+#include <mutex>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    inline hipError_t default_device_malloc(void ** ptr, size_t size,
+                                            hipStream_t stream, void * user_data)
+    {
+        (void)stream;
+        (void)user_data;
+        return hipMalloc(ptr, size);
+    }
+
+    inline hipError_t default_device_free(void * ptr, hipStream_t stream, void * user_data)
+    {
+        (void)stream;
+        (void)user_data;
+        return hipFree(ptr);
+    }
+
+    // Allocator of device memory set by rocrand_set_allocator() or
+    // rocrand_set_default_allocator(). Memory is allocated and freed on
+    // the stream which uses it, so stream-ordered allocators do not need
+    // synchronization. Owners of memory keep a copy of the allocator
+    // which allocated it and free the memory with that copy, so changing
+    // the allocator does not mix allocators of the same memory.
+    struct device_allocator
+    {
+        rocrand_device_malloc_fn malloc_fn;
+        rocrand_device_free_fn free_fn;
+        void * user_data;
+
+        device_allocator()
+            : malloc_fn(default_device_malloc), free_fn(default_device_free),
+              user_data(NULL) { }
+
+        // NULL functions select hipMalloc() and hipFree()
+        device_allocator(rocrand_device_malloc_fn malloc_fn,
+                         rocrand_device_free_fn free_fn,
+                         void * user_data)
+            : device_allocator()
+        {
+            if(malloc_fn != NULL && free_fn != NULL)
+            {
+                this->malloc_fn = malloc_fn;
+                this->free_fn = free_fn;
+                this->user_data = user_data;
+            }
+        }
+
+        // Allocates count values, ptr is NULL if allocation fails
+        template<class T>
+        rocrand_status allocate(T ** ptr, const size_t count, hipStream_t stream = 0) const
+        {
+            void * p = NULL;
+            if(malloc_fn(&p, sizeof(T) * count, stream, user_data) != hipSuccess || p == NULL)
+            {
+                *ptr = NULL;
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            *ptr = static_cast<T *>(p);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Memory can still be used by work enqueued to stream (hipFree
+        // waits for it, stream-ordered allocators reuse memory after it),
+        // NULL is ignored
+        void deallocate(void * ptr, hipStream_t stream = 0) const
+        {
+            if(ptr != NULL)
+            {
+                free_fn(ptr, stream, user_data);
+            }
+        }
+
+        bool operator==(const device_allocator& other) const
+        {
+            return malloc_fn == other.malloc_fn && free_fn == other.free_fn
+                && user_data == other.user_data;
+        }
+    };
+
+    inline std::mutex& default_allocator_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    inline device_allocator& default_allocator_storage()
+    {
+        static device_allocator allocator;
+        return allocator;
+    }
+
+    // Allocator of generators created after rocrand_set_default_allocator(),
+    // of discrete distributions and of tables shared by generators
+    inline device_allocator get_default_allocator()
+    {
+        std::lock_guard<std::mutex> lock(default_allocator_mutex());
+        return default_allocator_storage();
+    }
+
+    inline void set_default_allocator(const device_allocator& allocator)
+    {
+        std::lock_guard<std::mutex> lock(default_allocator_mutex());
+        default_allocator_storage() = allocator;
+    }
+
+    // Allocators of discrete distributions of the public API by their
+    // device pointers: rocrand_destroy_discrete_distribution() receives only
+    // the pointer, and the default allocator can be changed after creation
+    inline std::map<const void *, device_allocator>& distribution_allocators()
+    {
+        static std::map<const void *, device_allocator> allocators;
+        return allocators;
+    }
+
+    inline void register_distribution_allocator(const void * distribution,
+                                                const device_allocator& allocator)
+    {
+        std::lock_guard<std::mutex> lock(default_allocator_mutex());
+        distribution_allocators()[distribution] = allocator;
+    }
+
+    // Returns the allocator of distribution and forgets it
+    inline device_allocator unregister_distribution_allocator(const void * distribution)
+    {
+        std::lock_guard<std::mutex> lock(default_allocator_mutex());
+        auto it = distribution_allocators().find(distribution);
+        if(it == distribution_allocators().end())
+        {
+            return device_allocator();
+        }
+        const device_allocator allocator = it->second;
+        distribution_allocators().erase(it);
+        return allocator;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_ALLOCATOR_H_
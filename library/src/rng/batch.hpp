@@ -0,0 +1,228 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_BATCH_H_
+#define ROCRAND_RNG_BATCH_H_
+
+#include <stdint.h>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Maximum number of requests of rocrand_generate_batch() processed by
+// one kernel launch (requests are passed as a kernel argument)
+static const unsigned int max_batch_requests = 16;
+
+// Request of rocrand_generate_batch() as seen by kernels
+struct batch_request
+{
+    rocrand_distribution distribution;
+    void * data;
+    size_t n;
+    double mean;
+    double stddev;
+    // Tables of the Poisson distribution
+    rocrand_discrete_distribution_st poisson;
+};
+
+struct batch_requests
+{
+    unsigned int count;
+    // Method of normal and log-normal requests
+    rocrand_normal_method normal_method;
+    batch_request requests[max_batch_requests];
+};
+
+// Returns the total number of values of requests of a launch
+inline size_t get_batch_size(const batch_requests& batch)
+{
+    size_t size = 0;
+    for(unsigned int i = 0; i < batch.count; i++)
+    {
+        size += batch.requests[i].n;
+    }
+    return size;
+}
+
+// Type of generate_batch_kernel of an engine
+template<class Engine>
+using generate_batch_kernel_type = void (*)(Engine *, const unsigned int, const batch_requests);
+
+// Poisson distribution of a batch request
+struct batch_poisson_distribution
+{
+    const rocrand_discrete_distribution_st& dis;
+
+    __forceinline__ __device__ __host__
+    batch_poisson_distribution(const rocrand_discrete_distribution_st& dis)
+        : dis(dis) { }
+
+    __forceinline__ __device__ __host__
+    unsigned int operator()(const unsigned int x) const
+    {
+        return rocrand_device::detail::discrete_alias(x, dis);
+    }
+};
+
+// Generates a normal or log-normal request with a distribution for
+// rejection_distribution (Normal and LogNormal) by generate(data, n,
+// distribution) (generate_engine of the engine), returns false for other
+// distributions
+template<template<class> class Normal, template<class> class LogNormal, class Generate>
+__forceinline__ __device__ __host__
+bool generate_batch_rejection_normal(const Generate& generate,
+                                     const batch_request& r)
+{
+    switch(r.distribution)
+    {
+        case ROCRAND_DISTRIBUTION_NORMAL_FLOAT:
+            generate(static_cast<float *>(r.data), r.n,
+                     make_rejection_distribution<float>(
+                         Normal<float>(r.mean, r.stddev)
+                     ));
+            return true;
+        case ROCRAND_DISTRIBUTION_NORMAL_DOUBLE:
+            generate(static_cast<double *>(r.data), r.n,
+                     make_rejection_distribution<double>(
+                         Normal<double>(r.mean, r.stddev)
+                     ));
+            return true;
+        case ROCRAND_DISTRIBUTION_LOG_NORMAL_FLOAT:
+            generate(static_cast<float *>(r.data), r.n,
+                     make_rejection_distribution<float>(
+                         LogNormal<float>(r.mean, r.stddev)
+                     ));
+            return true;
+        case ROCRAND_DISTRIBUTION_LOG_NORMAL_DOUBLE:
+            generate(static_cast<double *>(r.data), r.n,
+                     make_rejection_distribution<double>(
+                         LogNormal<double>(r.mean, r.stddev)
+                     ));
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Generates a normal or log-normal request with the Ziggurat or
+// the inversion method, returns false for other distributions and
+// for the Box-Muller method (the engine generates pairs of values)
+template<class Generate>
+__forceinline__ __device__ __host__
+bool generate_batch_normal_method(const Generate& generate,
+                                  const rocrand_normal_method method,
+                                  const batch_request& r)
+{
+    if(method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
+    {
+        return generate_batch_rejection_normal<
+            normal_ziggurat_distribution, log_normal_ziggurat_distribution
+        >(generate, r);
+    }
+    if(method == ROCRAND_NORMAL_METHOD_INVERSION)
+    {
+        return generate_batch_rejection_normal<
+            normal_inversion_distribution, log_normal_inversion_distribution
+        >(generate, r);
+    }
+    return false;
+}
+
+// Checks parameters of requests
+inline rocrand_status validate_batch(const rocrand_generate_request * requests,
+                                     const size_t count)
+{
+    for(size_t i = 0; i < count; i++)
+    {
+        const rocrand_generate_request& r = requests[i];
+        switch(r.distribution)
+        {
+            case ROCRAND_DISTRIBUTION_UNIFORM_UINT:
+            case ROCRAND_DISTRIBUTION_UNIFORM_FLOAT:
+            case ROCRAND_DISTRIBUTION_UNIFORM_DOUBLE:
+            case ROCRAND_DISTRIBUTION_NORMAL_FLOAT:
+            case ROCRAND_DISTRIBUTION_LOG_NORMAL_FLOAT:
+            case ROCRAND_DISTRIBUTION_NORMAL_DOUBLE:
+            case ROCRAND_DISTRIBUTION_LOG_NORMAL_DOUBLE:
+                break;
+            case ROCRAND_DISTRIBUTION_POISSON:
+                if(r.lambda <= 0.0)
+                    return ROCRAND_STATUS_OUT_OF_RANGE;
+                break;
+            default:
+                return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+// Converts count (up to max_batch_requests) requests for a kernel launch,
+// tables of all Poisson requests of the launch stay in the cache of poisson
+// (only cached tables can be used when the launch is captured)
+template<class PoissonManager>
+inline rocrand_status prepare_batch(batch_requests& batch,
+                                    const rocrand_generate_request * requests,
+                                    const unsigned int count,
+                                    const rocrand_normal_method normal_method,
+                                    PoissonManager& poisson,
+                                    poisson_cache_state& cache,
+                                    const device_allocator& allocator,
+                                    hipStream_t stream,
+                                    const bool capturing)
+{
+    unsigned int poisson_count = 0;
+    batch.count = count;
+    batch.normal_method = normal_method;
+    for(unsigned int i = 0; i < count; i++)
+    {
+        const rocrand_generate_request& r = requests[i];
+        batch_request& b = batch.requests[i];
+        b.distribution = r.distribution;
+        b.data = r.output_data;
+        b.n = r.n;
+        b.mean = r.mean;
+        b.stddev = r.stddev;
+        b.poisson = rocrand_discrete_distribution_st();
+        if(r.distribution == ROCRAND_DISTRIBUTION_POISSON)
+        {
+            try
+            {
+                poisson.set_lambda(r.lambda, cache, allocator, stream,
+                                   capturing, ++poisson_count);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            b.poisson = poisson.dis;
+        }
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_BATCH_H_
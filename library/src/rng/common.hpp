@@ -25,6 +25,57 @@
 #define FQUALIFIERS __forceinline__ __device__ __host__
 #endif
 
+#include <rocrand.h>
 #include <rocrand_common.h>
 
+namespace rocrand_host {
+namespace detail {
+
+// Seed of engine_id-th engine when engines are seeded independently
+// (ROCRAND_ORDERING_PSEUDO_SEEDED), the same as of rocrand_init_fast()
+// with subsequence engine_id
+FQUALIFIERS
+unsigned long long seeded_engine_seed(const unsigned long long seed,
+                                      const unsigned int engine_id)
+{
+    return ::rocrand_device::detail::splitmix64_seed(seed, engine_id);
+}
+
+// Stores index-th pair of values (float2, double2) of data: with one vector
+// store when data is aligned to the size of the pair (aligned), value by
+// value otherwise, so pairs of normal values can be stored to any buffer
+template<class T, class T2>
+FQUALIFIERS
+void store_pair(T * data, const size_t index, const T2 value, const bool aligned)
+{
+    if(aligned)
+    {
+        reinterpret_cast<T2 *>(data)[index] = value;
+    }
+    else
+    {
+        data[2 * index] = value.x;
+        data[2 * index + 1] = value.y;
+    }
+}
+
+// Generates a pitched 2D array (pitch in bytes) row by row, f(row) generates
+// one row, used by generators and distributions without a 2D kernel
+template<class T, class Function>
+inline
+rocrand_status generate_rows(T * data, const size_t height, const size_t pitch,
+                             Function f)
+{
+    for(size_t r = 0; r < height; r++)
+    {
+        rocrand_status status = f(reinterpret_cast<T *>(reinterpret_cast<char *>(data) + r * pitch));
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
 #endif // ROCRAND_RNG_COMMON_H_
@@ -26,9 +26,156 @@
 #endif
 
 #define ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+#define ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 #define ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
 #define ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
 
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
 #include <rocrand_kernel.h>
 
+namespace rocrand_host {
+namespace detail {
+
+    // Engine engine_id of an array of engines_size engines used by kernels
+    // of generators. With ROCRAND_ENGINES_SOA (CMake option ENGINES_SOA)
+    // engines are stored in the structure of arrays layout of
+    // rocrand_create_states_soa(): word w of engine i is word
+    // w * engines_size + i, so neighbouring threads load and store
+    // neighbouring words. Copies of whole arrays (states, the engine cache)
+    // do not depend on the layout.
+    template<class Engine>
+    FQUALIFIERS
+    Engine load_engine(const Engine * engines,
+                       const unsigned int engines_size,
+                       const unsigned int engine_id)
+    {
+#ifdef ROCRAND_ENGINES_SOA
+        const rocrand_device::detail::states_soa<Engine> layout =
+            { reinterpret_cast<unsigned int *>(const_cast<Engine *>(engines)), engines_size };
+        return layout.load(engine_id);
+#else
+        (void)engines_size;
+        return engines[engine_id];
+#endif
+    }
+
+    template<class Engine>
+    FQUALIFIERS
+    void store_engine(Engine * engines,
+                      const unsigned int engines_size,
+                      const unsigned int engine_id,
+                      const Engine& engine)
+    {
+#ifdef ROCRAND_ENGINES_SOA
+        const rocrand_device::detail::states_soa<Engine> layout =
+            { reinterpret_cast<unsigned int *>(engines), engines_size };
+        layout.store(engine_id, engine);
+#else
+        (void)engines_size;
+        engines[engine_id] = engine;
+#endif
+    }
+
+    template<class Engine>
+    __global__
+    void fork_engines_kernel(Engine * engines,
+                             const Engine * parent_engines,
+                             const unsigned int engines_size,
+                             const unsigned long long subsequences)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if(engine_id >= engines_size)
+            return;
+
+        Engine engine = load_engine(parent_engines, engines_size, engine_id);
+        engine.discard_subsequence(subsequences);
+        store_engine(engines, engines_size, engine_id, engine);
+    }
+
+    // Initializes engines of a child generator (see rocrand_fork_generator())
+    // from engines of its parent with one skipahead instead of seeding:
+    // each engine is copied and moved ahead by subsequences subsequences
+    template<class Engine>
+    inline rocrand_status fork_engines(Engine * engines,
+                                       const Engine * parent_engines,
+                                       const size_t engines_size,
+                                       const unsigned long long subsequences,
+                                       hipStream_t stream)
+    {
+        const unsigned int threads = 256;
+        const unsigned int size = static_cast<unsigned int>(engines_size);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(fork_engines_kernel<Engine>),
+            dim3((size + threads - 1) / threads), dim3(threads), 0, stream,
+            engines, parent_engines, size, subsequences
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Engine i of a block is engine 0 of the block moved ahead by i
+    // subsequences: only the first engine is seeded and jumps to its
+    // subsequence and offset, then the block doubles the number of ready
+    // engines in log2(block size) steps, in step k engines [2^k, 2^(k+1))
+    // copy engines [0, 2^k) and jump by 2^k subsequences (one or two
+    // products with precomputed matrices). Jumps are powers of the same
+    // matrix, so states are the same as of Engine(seed, subsequence + i, offset).
+    template<class Engine>
+    __global__
+    void init_engines_by_steps_kernel(Engine * engines,
+                                      const unsigned int engines_size,
+                                      const unsigned long long seed,
+                                      const unsigned long long subsequence,
+                                      const unsigned long long offset)
+    {
+        const unsigned int block_start = hipBlockIdx_x * hipBlockDim_x;
+        const unsigned int engine_id = block_start + hipThreadIdx_x;
+
+        if(hipThreadIdx_x == 0)
+        {
+            store_engine(engines, engines_size, engine_id,
+                         Engine(seed, subsequence + block_start, offset));
+        }
+        __syncthreads();
+        // Engines written by other threads of the block are visible after
+        // the barrier
+        for(unsigned int step = 1; step < hipBlockDim_x; step *= 2)
+        {
+            if(hipThreadIdx_x >= step && hipThreadIdx_x < 2 * step && engine_id < engines_size)
+            {
+                Engine engine = load_engine(engines, engines_size, engine_id - step);
+                engine.discard_subsequence(step);
+                store_engine(engines, engines_size, engine_id, engine);
+            }
+            __syncthreads();
+        }
+    }
+
+    // Initializes engines_size engines of consecutive subsequences starting
+    // at subsequence (see init_engines_by_steps_kernel)
+    template<class Engine>
+    inline rocrand_status init_engines_by_steps(Engine * engines,
+                                                const size_t engines_size,
+                                                const unsigned long long seed,
+                                                const unsigned long long subsequence,
+                                                const unsigned long long offset,
+                                                hipStream_t stream)
+    {
+        const unsigned int threads = 256;
+        const unsigned int size = static_cast<unsigned int>(engines_size);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_engines_by_steps_kernel<Engine>),
+            dim3((size + threads - 1) / threads), dim3(threads), 0, stream,
+            engines, size, seed, subsequence, offset
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
 #endif // ROCRAND_RNG_DEVICE_ENGINES_H_
@@ -0,0 +1,150 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DEVICE_POSITION_H_
+#define ROCRAND_RNG_DEVICE_POSITION_H_
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "allocator.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    __global__
+    void advance_position_kernel(unsigned long long * position,
+                                 const unsigned long long count)
+    {
+        *position += count;
+    }
+
+    // Returns the position stored in device memory, 0 if there is none
+    __forceinline__ __device__
+    unsigned long long load_position(const unsigned long long * position)
+    {
+        return position != NULL ? *position : 0;
+    }
+
+    // Position of counter-based generators (Philox, Sobol) in capture-safe
+    // mode (see rocrand_set_capture_safe()). Kernels add the value in device
+    // memory to the position passed by the host and a kernel advances it
+    // after every generation, so a generation captured into a graph continues
+    // the sequence every time the graph is launched instead of repeating
+    // the numbers of the position the host had during capture.
+    class device_position
+    {
+    public:
+
+        device_position() : m_position(NULL), m_stream(0) { }
+
+        ~device_position()
+        {
+            m_allocator.deallocate(m_position, m_stream);
+        }
+
+        device_position(const device_position&) = delete;
+        device_position& operator=(const device_position&) = delete;
+
+        bool enabled() const
+        {
+            return m_position != NULL;
+        }
+
+        // NULL if capture-safe mode is disabled
+        const unsigned long long * get() const
+        {
+            return m_position;
+        }
+
+        // Allocates the position by allocator, it starts from 0
+        rocrand_status enable(const device_allocator& allocator, hipStream_t stream)
+        {
+            if(m_position != NULL)
+                return ROCRAND_STATUS_SUCCESS;
+            if(allocator.allocate(&m_position, 1, stream) != ROCRAND_STATUS_SUCCESS)
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            m_allocator = allocator;
+            m_stream = stream;
+            return reset(stream);
+        }
+
+        // Frees the position and returns its value, the caller adds it
+        // to its host position
+        rocrand_status disable(unsigned long long& position, hipStream_t stream)
+        {
+            position = 0;
+            if(m_position == NULL)
+                return ROCRAND_STATUS_SUCCESS;
+            rocrand_status status = ROCRAND_STATUS_SUCCESS;
+            if(hipMemcpyAsync(&position, m_position, sizeof(unsigned long long),
+                              hipMemcpyDeviceToHost, stream) != hipSuccess
+                || hipStreamSynchronize(stream) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            m_allocator.deallocate(m_position, stream);
+            m_position = NULL;
+            return status;
+        }
+
+        // Sets the position to 0 (enqueued to stream, so it can be captured
+        // as a memset node too)
+        rocrand_status reset(hipStream_t stream)
+        {
+            if(m_position == NULL)
+                return ROCRAND_STATUS_SUCCESS;
+            m_stream = stream;
+            if(hipMemsetAsync(m_position, 0, sizeof(unsigned long long), stream) != hipSuccess)
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        rocrand_status advance(const unsigned long long count, hipStream_t stream)
+        {
+            if(m_position == NULL)
+                return ROCRAND_STATUS_SUCCESS;
+            m_stream = stream;
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(advance_position_kernel),
+                dim3(1), dim3(1), 0, stream,
+                m_position, count
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        size_t memory_usage() const
+        {
+            return m_position != NULL ? sizeof(unsigned long long) : 0;
+        }
+
+    private:
+        unsigned long long * m_position;
+        device_allocator m_allocator;
+        // Stream of the last use of the position, it is freed there
+        hipStream_t m_stream;
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_DEVICE_POSITION_H_
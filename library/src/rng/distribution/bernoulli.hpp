@@ -0,0 +1,52 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_BERNOULLI_H_
+#define ROCRAND_RNG_DISTRIBUTION_BERNOULLI_H_
+
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+
+// Packed Bernoulli trials (rocrand_generate_bernoulli_bits) with the method of
+// rocrand_bernoulli_bits of the device API. Every value is 32 trials and is
+// always accepted after the same number of draws in all threads, so
+// generators which draw numbers for a whole block together (MTGP32, MT19937)
+// support it.
+struct bernoulli_bits_distribution
+{
+    rocrand_device::detail::bernoulli_bits_params params;
+
+    __forceinline__ __host__ __device__
+    bernoulli_bits_distribution(double p)
+        : params(rocrand_device::detail::make_bernoulli_bits_params(p))
+    { }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, unsigned int& result) const
+    {
+        result = rocrand_device::detail::bernoulli_bits(engine, params);
+        return true;
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BERNOULLI_H_
@@ -0,0 +1,114 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+
+// Binomial and multinomial distributions with parameters per value read from
+// device memory (rocrand_generate_binomial_array, rocrand_generate_multinomial_array),
+// with the methods of rocrand_binomial of the device API. As
+// poisson_array_distribution, values are always accepted after a variable
+// amount of numbers, so generators which draw numbers for a whole block
+// together (MTGP32, MT19937) do not support them.
+
+namespace rocrand_host {
+namespace detail {
+
+    // Uniform values of the binomial distribution of the device API
+    // from numbers of a host API engine
+    template<class Engine>
+    struct binomial_engine_uniform_source
+    {
+        Engine& engine;
+
+        __forceinline__ __host__ __device__
+        double operator()()
+        {
+            const unsigned int u1 = engine();
+            const unsigned int u2 = engine();
+            return rocrand_device::detail::uniform_distribution_double(u1, u2);
+        }
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Value i is the number of successes of trials[i] trials with probability
+// probabilities[i]
+struct binomial_array_distribution
+{
+    const unsigned int * trials;
+    const double * probabilities;
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, unsigned int& result, size_t index) const
+    {
+        rocrand_host::detail::binomial_engine_uniform_source<Engine> uniform { engine };
+        result = rocrand_device::detail::binomial_distribution(
+            uniform, trials[index], probabilities[index]
+        );
+        return true;
+    }
+};
+
+// Counts of trials[i] trials among categories with probabilities
+// probabilities[j * size + i] (j-th category of value i), conditional binomial
+// values as rocrand_multinomial of the device API. Counts of all categories
+// but the last one are stored to counts[j * size + i] directly, the count of
+// the last category is the result (the generator stores it to
+// counts[(categories - 1) * size + i]).
+struct multinomial_array_distribution
+{
+    const unsigned int * trials;
+    const double * probabilities;
+    unsigned int categories;
+    size_t size;
+    unsigned int * counts;
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, unsigned int& result, size_t index) const
+    {
+        rocrand_host::detail::binomial_engine_uniform_source<Engine> uniform { engine };
+        unsigned int remaining = trials[index];
+        double mass = 1.0;
+        for(unsigned int j = 0; j + 1 < categories; j++)
+        {
+            const double p = probabilities[j * size + index];
+            const unsigned int k = remaining > 0 && mass > 0.0
+                ? rocrand_device::detail::binomial_distribution(uniform, remaining, p / mass)
+                : 0;
+            counts[j * size + index] = k;
+            remaining -= k;
+            mass -= p;
+        }
+        result = remaining;
+        return true;
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
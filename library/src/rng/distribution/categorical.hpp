@@ -0,0 +1,211 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_CATEGORICAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_CATEGORICAL_H_
+
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+// Categorical sampling from rows of a probability matrix
+// (rocrand_generate_categorical): one uniform 32-bit number per row is
+// generated by the generator, then it is replaced by the category found by
+// inversion of the row (the first category whose prefix sum exceeds
+// u * sum of the row). No tables are built, the matrix is read twice.
+// Negative probabilities are treated as 0, rows with zero sum give 0.
+
+namespace rocrand_host {
+namespace detail {
+
+    constexpr unsigned int categorical_block_size = 256;
+
+    // One block per row: every thread sums a contiguous segment of the row,
+    // a block scan of segment sums selects the segment containing the
+    // target and its thread finds the category
+    __global__
+    __launch_bounds__(categorical_block_size)
+    void categorical_kernel(unsigned int * output,
+                            const float * probabilities,
+                            const size_t batch,
+                            const unsigned int n,
+                            const size_t ld)
+    {
+        __shared__ double sums[categorical_block_size];
+        __shared__ unsigned int found;
+        __shared__ unsigned int last;
+
+        const unsigned int tid = hipThreadIdx_x;
+        const unsigned int per_thread = (n + categorical_block_size - 1) / categorical_block_size;
+        const unsigned int begin = min(tid * per_thread, n);
+        const unsigned int end = min(begin + per_thread, n);
+
+        for(size_t row = hipBlockIdx_x; row < batch; row += hipGridDim_x)
+        {
+            const float * p = probabilities + row * ld;
+
+            double sum = 0.0;
+            unsigned int last_positive = 0;
+            for(unsigned int i = begin; i < end; i++)
+            {
+                const float v = p[i];
+                if(v > 0.0f)
+                {
+                    sum += v;
+                    last_positive = i + 1;
+                }
+            }
+            sums[tid] = sum;
+            if(tid == 0)
+            {
+                found = n;
+                last = 0;
+            }
+            __syncthreads();
+
+            // Inclusive scan of segment sums
+            for(unsigned int offset = 1; offset < categorical_block_size; offset *= 2)
+            {
+                const double v = tid >= offset ? sums[tid - offset] : 0.0;
+                __syncthreads();
+                sums[tid] += v;
+                __syncthreads();
+            }
+
+            const double total = sums[categorical_block_size - 1];
+            const double target = output[row] * ROCRAND_2POW32_INV_DOUBLE * total;
+            double running = tid > 0 ? sums[tid - 1] : 0.0;
+            if(sum > 0.0 && running <= target && target < sums[tid])
+            {
+                for(unsigned int i = begin; i < end; i++)
+                {
+                    const float v = p[i];
+                    if(v > 0.0f)
+                    {
+                        running += v;
+                        if(target < running)
+                        {
+                            atomicMin(&found, i);
+                            break;
+                        }
+                    }
+                }
+            }
+            if(last_positive > 0)
+            {
+                atomicMax(&last, last_positive);
+            }
+            __syncthreads();
+
+            if(tid == 0)
+            {
+                // Only rounding errors of the sums can leave the category
+                // not found, the last possible one is used then
+                output[row] = found < n ? found : (last > 0 ? last - 1 : 0);
+            }
+            __syncthreads();
+        }
+    }
+
+    // Replaces batch uniform numbers in output (device memory) with
+    // categories of rows of probabilities
+    inline rocrand_status categorical_transform(unsigned int * output,
+                                                const float * probabilities,
+                                                const size_t batch,
+                                                const unsigned int n,
+                                                const size_t ld,
+                                                hipStream_t stream)
+    {
+        if(batch == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        const unsigned int blocks = static_cast<unsigned int>(std::min<size_t>(batch, 65536));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(categorical_kernel),
+            dim3(blocks), dim3(categorical_block_size), 0, stream,
+            output, probabilities, batch, n, ld
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // The same for host generators, output and probabilities are in host memory
+    inline void categorical_transform_host(unsigned int * output,
+                                           const float * probabilities,
+                                           const size_t batch,
+                                           const unsigned int n,
+                                           const size_t ld)
+    {
+        for(size_t row = 0; row < batch; row++)
+        {
+            const float * p = probabilities + row * ld;
+            double total = 0.0;
+            unsigned int last_positive = 0;
+            for(unsigned int i = 0; i < n; i++)
+            {
+                if(p[i] > 0.0f)
+                {
+                    total += p[i];
+                    last_positive = i + 1;
+                }
+            }
+            const double target = output[row] * ROCRAND_2POW32_INV_DOUBLE * total;
+            unsigned int result = last_positive > 0 ? last_positive - 1 : 0;
+            double running = 0.0;
+            for(unsigned int i = 0; i < n; i++)
+            {
+                if(p[i] > 0.0f)
+                {
+                    running += p[i];
+                    if(target < running)
+                    {
+                        result = i;
+                        break;
+                    }
+                }
+            }
+            output[row] = result;
+        }
+    }
+
+    // Generates one number per row with generator and transforms them
+    template<class Generator>
+    inline rocrand_status generate_categorical(Generator * generator,
+                                               unsigned int * output,
+                                               const float * probabilities,
+                                               const size_t batch,
+                                               const unsigned int n,
+                                               const size_t ld)
+    {
+        rocrand_status status = generator->generate(output, batch);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        return categorical_transform(
+            output, probabilities, batch, n, ld, generator->get_stream()
+        );
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_DISTRIBUTION_CATEGORICAL_H_
@@ -21,6 +21,72 @@
 #ifndef ROCRAND_RNG_DISTRIBUTION_COMMON_H_
 #define ROCRAND_RNG_DISTRIBUTION_COMMON_H_
 
+#include <hip/hip_fp16.h>
+
 #include "../common.hpp"
 
+// 8 half values generated from uint4 (2 values from each unsigned int)
+struct __align__(16) half2x4
+{
+    __half2 x;
+    __half2 y;
+    __half2 z;
+    __half2 w;
+};
+
+namespace rocrand_host {
+namespace detail {
+
+    // Distributions which depend on the index of the value (parameters
+    // read from arrays) provide operator()(engine, result, index)
+    template<class Distribution, class Engine, class T>
+    __forceinline__ __host__ __device__
+    auto rejection_attempt(const Distribution& distribution,
+                           Engine& engine, T& result, size_t index, int)
+        -> decltype(distribution(engine, result, index))
+    {
+        return distribution(engine, result, index);
+    }
+
+    template<class Distribution, class Engine, class T>
+    __forceinline__ __host__ __device__
+    auto rejection_attempt(const Distribution& distribution,
+                           Engine& engine, T& result, size_t, long)
+        -> decltype(distribution(engine, result))
+    {
+        return distribution(engine, result);
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Distribution which draws a variable number of random numbers per value
+// (bounded integers, Ziggurat, Poisson). Distribution must provide
+// bool operator()(Engine& engine, T& result) or
+// bool operator()(Engine& engine, T& result, size_t index), one attempt
+// which returns false if the drawn numbers are rejected. Generators draw
+// until a value is accepted instead of transforming one number per value.
+template<class T, class Distribution>
+struct rejection_distribution
+{
+    typedef T value_type;
+
+    Distribution distribution;
+
+    // index is the position of the value in the output
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, T& result, size_t index = 0) const
+    {
+        return rocrand_host::detail::rejection_attempt(distribution, engine, result, index, 0);
+    }
+};
+
+template<class T, class Distribution>
+__forceinline__ __host__ __device__
+rejection_distribution<T, Distribution> make_rejection_distribution(const Distribution& distribution)
+{
+    return rejection_distribution<T, Distribution> { distribution };
+}
+
 #endif // ROCRAND_RNG_DISTRIBUTION_COMMON_H_
@@ -31,5 +31,9 @@
 #include <rocrand_normal.h>
 #include <rocrand_log_normal.h>
 #include <rocrand_discrete.h>
+#include <rocrand_gamma.h>
+#include <rocrand_binomial.h>
+#include <rocrand_bernoulli.h>
+#include <rocrand_truncated_normal.h>
 
 #endif // ROCRAND_RNG_DISTRIBUTION_DEVICE_DISTRIBUTIONS_H_
@@ -28,6 +28,8 @@
 #include <rocrand.h>
 
 #include "device_distributions.hpp"
+#include "discrete_device.hpp"
+#include "../allocator.hpp"
 
 // Alias method
 //
@@ -41,7 +43,9 @@ enum rocrand_discrete_method
 {
     ROCRAND_DISCRETE_METHOD_ALIAS = 1,
     ROCRAND_DISCRETE_METHOD_CDF = 2,
-    ROCRAND_DISCRETE_METHOD_UNIVERSAL = ROCRAND_DISCRETE_METHOD_ALIAS | ROCRAND_DISCRETE_METHOD_CDF
+    ROCRAND_DISCRETE_METHOD_UNIVERSAL = ROCRAND_DISCRETE_METHOD_ALIAS | ROCRAND_DISCRETE_METHOD_CDF,
+    // Fenwick tree of weights, weights can be updated
+    ROCRAND_DISCRETE_METHOD_TREE = 4
 };
 
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
@@ -55,6 +59,13 @@ public:
         probability = NULL;
         alias = NULL;
         cdf = NULL;
+        packed_alias = NULL;
+        guide_size = 0;
+        guide = NULL;
+        weights = NULL;
+        tree = NULL;
+        tree_step = 0;
+        allocator = rocrand_host::detail::get_default_allocator();
     }
 
     rocrand_discrete_distribution_base(const double * probabilities,
@@ -70,7 +81,45 @@ public:
     __host__ __device__
     ~rocrand_discrete_distribution_base() { }
 
-    void deallocate()
+    // Tables are computed on the device from (unnormalized) probabilities
+    // in device memory, only for device-side distributions
+    void init_device(const double * probabilities,
+                     const unsigned int size,
+                     const unsigned int offset)
+    {
+        this->size = size;
+        this->offset = offset;
+
+        deallocate();
+        allocate();
+        const rocrand_status status = rocrand_host::detail::build_discrete_tables(
+            probabilities, size, probability, alias, packed_alias, cdf, guide, guide_size,
+            allocator
+        );
+        if (status != ROCRAND_STATUS_SUCCESS)
+        {
+            throw status;
+        }
+    }
+
+    // Sets weights of k values to probabilities (in the same units as the
+    // initial probabilities), indices and probabilities are in device memory.
+    // Only for device-side distributions with a tree
+    void update(const unsigned int * indices,
+                const double * probabilities,
+                const unsigned int k)
+    {
+        const rocrand_status status = rocrand_host::detail::update_discrete_tree(
+            weights, tree, size, indices, probabilities, k
+        );
+        if (status != ROCRAND_STATUS_SUCCESS)
+        {
+            throw status;
+        }
+    }
+
+    // Device tables can still be used by kernels enqueued to stream
+    void deallocate(hipStream_t stream = 0)
     {
         // Explicit deallocation is used because on HCC the object is copied
         // multiple times inside hipLaunchKernelGGL, and destructor is called
@@ -89,25 +138,75 @@ public:
             {
                 delete[] cdf;
             }
-        }
-        else
-        {
-            if (probability != NULL)
+            if (packed_alias != NULL)
             {
-                hipFree(probability);
+                delete[] packed_alias;
             }
-            if (alias != NULL)
+            if (guide != NULL)
             {
-                hipFree(alias);
+                delete[] guide;
             }
-            if (cdf != NULL)
+            if (weights != NULL)
+            {
+                delete[] weights;
+            }
+            if (tree != NULL)
             {
-                hipFree(cdf);
+                delete[] tree;
             }
         }
+        else
+        {
+            allocator.deallocate(probability, stream);
+            allocator.deallocate(alias, stream);
+            allocator.deallocate(cdf, stream);
+            allocator.deallocate(packed_alias, stream);
+            allocator.deallocate(guide, stream);
+            allocator.deallocate(weights, stream);
+            allocator.deallocate(tree, stream);
+        }
         probability = NULL;
         alias = NULL;
         cdf = NULL;
+        packed_alias = NULL;
+        guide = NULL;
+        weights = NULL;
+        tree = NULL;
+    }
+
+    // Returns the number of bytes allocated for tables
+    size_t memory_usage() const
+    {
+        size_t bytes = 0;
+        if (probability != NULL)
+        {
+            bytes += sizeof(double) * size;
+        }
+        if (alias != NULL)
+        {
+            bytes += sizeof(unsigned int) * size;
+        }
+        if (cdf != NULL)
+        {
+            bytes += sizeof(double) * size;
+        }
+        if (packed_alias != NULL)
+        {
+            bytes += sizeof(unsigned long long) * size;
+        }
+        if (guide != NULL)
+        {
+            bytes += sizeof(unsigned int) * guide_size;
+        }
+        if (weights != NULL)
+        {
+            bytes += sizeof(double) * size;
+        }
+        if (tree != NULL)
+        {
+            bytes += sizeof(double) * (size + 1);
+        }
+        return bytes;
     }
 
     __forceinline__ __host__ __device__
@@ -123,6 +222,17 @@ public:
         }
     }
 
+    // Uses the 32 most significant bits of x
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned long long x) const
+    {
+        return (*this)(static_cast<unsigned int>(x >> 32));
+    }
+
+    // Allocator of device tables, the default allocator unless it is
+    // replaced before the tables are created
+    rocrand_host::detail::device_allocator allocator;
+
 protected:
 
     void init(std::vector<double> p,
@@ -134,6 +244,11 @@ protected:
 
         deallocate();
         allocate();
+        if ((Method & ROCRAND_DISCRETE_METHOD_TREE) != 0)
+        {
+            // Updates use the units of the initial probabilities
+            create_tree(p);
+        }
         normalize(p);
         if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
         {
@@ -147,9 +262,16 @@ protected:
 
     void allocate()
     {
+        // Separate probability and alias arrays are kept only for distributions
+        // of the public API (their fields can be read by applications),
+        // lookups use the packed table
         if (IsHostSide)
         {
             if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
+            {
+                packed_alias = new unsigned long long[size];
+            }
+            if (Method == ROCRAND_DISCRETE_METHOD_UNIVERSAL)
             {
                 probability = new double[size];
                 alias = new unsigned int[size];
@@ -157,28 +279,54 @@ protected:
             if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
             {
                 cdf = new double[size];
+                guide_size = size;
+                guide = new unsigned int[guide_size];
+            }
+            if ((Method & ROCRAND_DISCRETE_METHOD_TREE) != 0)
+            {
+                weights = new double[size];
+                tree = new double[size + 1];
             }
         }
         else
         {
-            hipError_t error;
             if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
             {
-                error = hipMalloc(&probability, sizeof(double) * size);
-                if (error != hipSuccess)
+                if (allocator.allocate(&packed_alias, size) != ROCRAND_STATUS_SUCCESS)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
                 }
-                error = hipMalloc(&alias, sizeof(unsigned int) * size);
-                if (error != hipSuccess)
+            }
+            if (Method == ROCRAND_DISCRETE_METHOD_UNIVERSAL)
+            {
+                if (allocator.allocate(&probability, size) != ROCRAND_STATUS_SUCCESS)
+                {
+                    throw ROCRAND_STATUS_ALLOCATION_FAILED;
+                }
+                if (allocator.allocate(&alias, size) != ROCRAND_STATUS_SUCCESS)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
                 }
             }
             if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
             {
-                error = hipMalloc(&cdf, sizeof(double) * size);
-                if (error != hipSuccess)
+                if (allocator.allocate(&cdf, size) != ROCRAND_STATUS_SUCCESS)
+                {
+                    throw ROCRAND_STATUS_ALLOCATION_FAILED;
+                }
+                guide_size = size;
+                if (allocator.allocate(&guide, guide_size) != ROCRAND_STATUS_SUCCESS)
+                {
+                    throw ROCRAND_STATUS_ALLOCATION_FAILED;
+                }
+            }
+            if ((Method & ROCRAND_DISCRETE_METHOD_TREE) != 0)
+            {
+                if (allocator.allocate(&weights, size) != ROCRAND_STATUS_SUCCESS)
+                {
+                    throw ROCRAND_STATUS_ALLOCATION_FAILED;
+                }
+                if (allocator.allocate(&tree, size + 1) != ROCRAND_STATUS_SUCCESS)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
                 }
@@ -249,26 +397,92 @@ protected:
         for (unsigned int i : small)
         {
             h_probability[i] = 1.0;
+            h_alias[i] = i;
         }
         for (unsigned int i : large)
         {
             h_probability[i] = 1.0;
+            h_alias[i] = i;
+        }
+
+        std::vector<unsigned long long> h_packed_alias(size);
+        for (unsigned int i = 0; i < size; i++)
+        {
+            h_packed_alias[i] = rocrand_host::detail::pack_alias(h_probability[i], h_alias[i], i);
+        }
+
+        if (IsHostSide)
+        {
+            std::copy(h_packed_alias.begin(), h_packed_alias.end(), packed_alias);
+            if (probability != NULL)
+            {
+                std::copy(h_probability.begin(), h_probability.end(), probability);
+                std::copy(h_alias.begin(), h_alias.end(), alias);
+            }
+        }
+        else
+        {
+            hipError_t error;
+            error = hipMemcpy(packed_alias, h_packed_alias.data(), sizeof(unsigned long long) * size, hipMemcpyDefault);
+            if (error != hipSuccess)
+            {
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            if (probability != NULL)
+            {
+                error = hipMemcpy(probability, h_probability.data(), sizeof(double) * size, hipMemcpyDefault);
+                if (error != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+                error = hipMemcpy(alias, h_alias.data(), sizeof(unsigned int) * size, hipMemcpyDefault);
+                if (error != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+            }
+        }
+    }
+
+    void create_tree(const std::vector<double>& p)
+    {
+        // Fenwick tree in O(size): each node adds its sum to its parent
+        std::vector<double> h_tree(size + 1);
+        double sum = 0.0;
+        for (unsigned int i = 0; i < size; i++)
+        {
+            h_tree[i] = p[i];
+            sum += p[i];
+        }
+        for (unsigned int i = 1; i <= size; i++)
+        {
+            const unsigned int parent = i + (i & (~i + 1));
+            if (parent <= size)
+            {
+                h_tree[parent - 1] += h_tree[i - 1];
+            }
+        }
+        h_tree[size] = sum;
+        tree_step = 1;
+        while (tree_step <= size / 2)
+        {
+            tree_step *= 2;
         }
 
         if (IsHostSide)
         {
-            std::copy(h_probability.begin(), h_probability.end(), probability);
-            std::copy(h_alias.begin(), h_alias.end(), alias);
+            std::copy(p.begin(), p.begin() + size, weights);
+            std::copy(h_tree.begin(), h_tree.end(), tree);
         }
         else
         {
             hipError_t error;
-            error = hipMemcpy(probability, h_probability.data(), sizeof(double) * size, hipMemcpyDefault);
+            error = hipMemcpy(weights, p.data(), sizeof(double) * size, hipMemcpyDefault);
             if (error != hipSuccess)
             {
                 throw ROCRAND_STATUS_INTERNAL_ERROR;
             }
-            error = hipMemcpy(alias, h_alias.data(), sizeof(unsigned int) * size, hipMemcpyDefault);
+            error = hipMemcpy(tree, h_tree.data(), sizeof(double) * (size + 1), hipMemcpyDefault);
             if (error != hipSuccess)
             {
                 throw ROCRAND_STATUS_INTERNAL_ERROR;
@@ -287,9 +501,24 @@ protected:
             h_cdf[i] = sum;
         }
 
+        // Chen-Asau guide table, guide[k] is the first value with
+        // cdf >= k / guide_size
+        std::vector<unsigned int> h_guide(guide_size);
+        unsigned int j = 0;
+        for (unsigned int k = 0; k < guide_size; k++)
+        {
+            const double x = static_cast<double>(k) / guide_size;
+            while (j < size - 1 && h_cdf[j] < x)
+            {
+                j++;
+            }
+            h_guide[k] = j;
+        }
+
         if (IsHostSide)
         {
             std::copy(h_cdf.begin(), h_cdf.end(), cdf);
+            std::copy(h_guide.begin(), h_guide.end(), guide);
         }
         else
         {
@@ -299,6 +528,11 @@ protected:
             {
                 throw ROCRAND_STATUS_INTERNAL_ERROR;
             }
+            error = hipMemcpy(guide, h_guide.data(), sizeof(unsigned int) * guide_size, hipMemcpyDefault);
+            if (error != hipSuccess)
+            {
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
         }
     }
 };
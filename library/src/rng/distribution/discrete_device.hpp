@@ -0,0 +1,581 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_DISCRETE_DEVICE_H_
+#define ROCRAND_RNG_DISTRIBUTION_DISCRETE_DEVICE_H_
+
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "../allocator.hpp"
+
+// Construction of alias tables and CDF on the device from probabilities in
+// device memory, without copying them to the host.
+//
+// Weights w[i] = size * p[i] / sum(p) are split into light (w < 1) and heavy
+// (w >= 1) items, the tables are the same as the ones of the sequential
+// sweep which fills buckets of lights (in index order) from the current
+// heavy, a heavy becomes light when its weight drops below 1 and is filled
+// from the next heavy. The sweep is determined by prefix sums of deficits
+// of lights sigma_l[i] = sum(1 - w) of lights [0, i) and excesses of heavies
+// sigma_h[j] = sum(w - 1) of heavies [0, j), so every bucket is computed
+// independently by binary searches:
+// - light i is filled from heavy j, the number of heavies with
+//   sigma_h[j + 1] < sigma_l[i];
+// - heavy j (except the last one) becomes light after the first light i
+//   with sigma_l[i + 1] > sigma_h[j + 1], its probability is
+//   1 + sigma_h[j + 1] - sigma_l[i + 1] and its alias is heavy j + 1.
+//
+// Hubschle-Schneider L., Sanders P.
+// Parallel Weighted Random Sampling, 2019
+
+namespace rocrand_host {
+namespace detail {
+
+    constexpr unsigned int discrete_block_size = 256;
+    constexpr unsigned int discrete_items_per_thread = 8;
+    constexpr unsigned int discrete_tile_size = discrete_block_size * discrete_items_per_thread;
+
+    // Entry of the packed alias table: probability in 0.32 fixed point in
+    // the low word, alias in the high word. Buckets that are never replaced
+    // by their alias get all ones and alias themselves, so the comparison
+    // in rocrand_device::detail::discrete_alias still returns the bucket.
+    __forceinline__ __host__ __device__
+    unsigned long long pack_alias(const double probability,
+                                  const unsigned int alias,
+                                  const unsigned int bucket)
+    {
+        if(probability >= 1.0)
+        {
+            return (static_cast<unsigned long long>(bucket) << 32) | 0xFFFFFFFFULL;
+        }
+        const double p = probability > 0.0 ? probability : 0.0;
+        const unsigned int fixed = static_cast<unsigned int>(p * 4294967296.0);
+        return (static_cast<unsigned long long>(alias) << 32) | fixed;
+    }
+
+    template<class T>
+    struct discrete_array_input
+    {
+        const T * values;
+
+        __forceinline__ __device__
+        T operator()(const size_t i) const
+        {
+            return values[i];
+        }
+    };
+
+    // 1 for heavy items
+    struct discrete_heavy_input
+    {
+        const double * weights;
+
+        __forceinline__ __device__
+        unsigned int operator()(const size_t i) const
+        {
+            return weights[i] >= 1.0 ? 1 : 0;
+        }
+    };
+
+    // Deficits of lights order[0, lights), excesses of heavies
+    // order[lights, size), 0 after them
+    struct discrete_deficit_input
+    {
+        const double * weights;
+        const unsigned int * order;
+        const unsigned int * heavy_count;
+        unsigned int size;
+        bool heavy;
+
+        __forceinline__ __device__
+        double operator()(const size_t k) const
+        {
+            const unsigned int heavies = *heavy_count;
+            const unsigned int lights = size - heavies;
+            if(heavy)
+            {
+                return k < heavies ? weights[order[lights + k]] - 1.0 : 0.0;
+            }
+            return k < lights ? 1.0 - weights[order[k]] : 0.0;
+        }
+    };
+
+    // Inclusive scan of one tile per block, sums of tiles are saved
+    // for the next pass
+    template<class T, class Input>
+    __global__
+    __launch_bounds__(discrete_block_size)
+    void discrete_scan_tiles_kernel(const Input input,
+                                    T * output,
+                                    T * tile_sums,
+                                    const size_t n)
+    {
+        __shared__ T tile[discrete_tile_size];
+        __shared__ T sums[discrete_block_size];
+
+        const unsigned int tid = hipThreadIdx_x;
+        const size_t tile_begin = static_cast<size_t>(hipBlockIdx_x) * discrete_tile_size;
+
+        for(unsigned int k = 0; k < discrete_items_per_thread; k++)
+        {
+            const unsigned int j = k * discrete_block_size + tid;
+            tile[j] = tile_begin + j < n ? input(tile_begin + j) : T(0);
+        }
+        __syncthreads();
+
+        T sum = T(0);
+        for(unsigned int k = 0; k < discrete_items_per_thread; k++)
+        {
+            sum += tile[tid * discrete_items_per_thread + k];
+            tile[tid * discrete_items_per_thread + k] = sum;
+        }
+        sums[tid] = sum;
+        __syncthreads();
+
+        for(unsigned int d = 1; d < discrete_block_size; d *= 2)
+        {
+            const T v = tid >= d ? sums[tid - d] : T(0);
+            __syncthreads();
+            sums[tid] += v;
+            __syncthreads();
+        }
+
+        const T prefix = tid > 0 ? sums[tid - 1] : T(0);
+        for(unsigned int k = 0; k < discrete_items_per_thread; k++)
+        {
+            tile[tid * discrete_items_per_thread + k] += prefix;
+        }
+        __syncthreads();
+
+        for(unsigned int k = 0; k < discrete_items_per_thread; k++)
+        {
+            const unsigned int j = k * discrete_block_size + tid;
+            if(tile_begin + j < n)
+            {
+                output[tile_begin + j] = tile[j];
+            }
+        }
+        if(tid == discrete_block_size - 1)
+        {
+            tile_sums[hipBlockIdx_x] = sums[tid];
+        }
+    }
+
+    template<class T>
+    __global__
+    __launch_bounds__(discrete_block_size)
+    void discrete_add_tile_prefixes_kernel(T * output,
+                                           const T * scanned_tile_sums,
+                                           const size_t n)
+    {
+        if(hipBlockIdx_x == 0)
+        {
+            return;
+        }
+        const T prefix = scanned_tile_sums[hipBlockIdx_x - 1];
+        const size_t tile_begin = static_cast<size_t>(hipBlockIdx_x) * discrete_tile_size;
+        for(unsigned int k = 0; k < discrete_items_per_thread; k++)
+        {
+            const size_t i = tile_begin + k * discrete_block_size + hipThreadIdx_x;
+            if(i < n)
+            {
+                output[i] += prefix;
+            }
+        }
+    }
+
+    // output[i] = input(0) + ... + input(i)
+    template<class T, class Input>
+    inline rocrand_status discrete_inclusive_scan(const Input input,
+                                                  T * output,
+                                                  const size_t n,
+                                                  const device_allocator& allocator)
+    {
+        const size_t tiles = (n + discrete_tile_size - 1) / discrete_tile_size;
+        T * tile_sums;
+        if(allocator.allocate(&tile_sums, tiles) != ROCRAND_STATUS_SUCCESS)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(discrete_scan_tiles_kernel<T, Input>),
+            dim3(tiles), dim3(discrete_block_size), 0, 0,
+            input, output, tile_sums, n
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+        {
+            status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        if(status == ROCRAND_STATUS_SUCCESS && tiles > 1)
+        {
+            status = discrete_inclusive_scan(discrete_array_input<T> { tile_sums }, tile_sums, tiles,
+                                             allocator);
+            if(status == ROCRAND_STATUS_SUCCESS)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(discrete_add_tile_prefixes_kernel<T>),
+                    dim3(tiles), dim3(discrete_block_size), 0, 0,
+                    output, tile_sums, n
+                );
+                if(hipPeekAtLastError() != hipSuccess)
+                {
+                    status = ROCRAND_STATUS_LAUNCH_FAILURE;
+                }
+            }
+        }
+
+        allocator.deallocate(tile_sums);
+        return status;
+    }
+
+    // Weights with average 1 and the normalized CDF
+    __global__
+    void discrete_weights_kernel(const double * probabilities,
+                                 const double * total,
+                                 double * cdf,
+                                 double * weights,
+                                 const unsigned int size)
+    {
+        const double sum = *total;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        for(unsigned int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < size; i += stride)
+        {
+            weights[i] = probabilities[i] * size / sum;
+            cdf[i] = cdf[i] / sum;
+        }
+    }
+
+    // Stable partition: lights to order[0, lights), heavies to order[lights, size)
+    __global__
+    void discrete_partition_kernel(const double * weights,
+                                   const unsigned int * heavy_scan,
+                                   unsigned int * order,
+                                   const unsigned int size)
+    {
+        const unsigned int lights = size - heavy_scan[size - 1];
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        for(unsigned int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < size; i += stride)
+        {
+            const bool heavy = weights[i] >= 1.0;
+            // Heavies before i
+            const unsigned int h = heavy_scan[i] - (heavy ? 1 : 0);
+            order[heavy ? lights + h : i - h] = i;
+        }
+    }
+
+    // Number of values of sorted values[0, n) less than x
+    __forceinline__ __device__
+    unsigned int discrete_count_less(const double * values, unsigned int n, const double x)
+    {
+        unsigned int lo = 0;
+        while(lo < n)
+        {
+            const unsigned int mid = (lo + n) / 2;
+            if(values[mid] < x)
+                lo = mid + 1;
+            else
+                n = mid;
+        }
+        return lo;
+    }
+
+    // Number of values of sorted values[0, n) less than or equal to x
+    __forceinline__ __device__
+    unsigned int discrete_count_less_equal(const double * values, unsigned int n, const double x)
+    {
+        unsigned int lo = 0;
+        while(lo < n)
+        {
+            const unsigned int mid = (lo + n) / 2;
+            if(values[mid] <= x)
+                lo = mid + 1;
+            else
+                n = mid;
+        }
+        return lo;
+    }
+
+    // Guide table of the CDF, guide[k] is the first value with
+    // cdf >= k / guide_size
+    __global__
+    void discrete_guide_kernel(const double * cdf,
+                               unsigned int * guide,
+                               const unsigned int guide_size,
+                               const unsigned int size)
+    {
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        for(unsigned int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; k < guide_size; k += stride)
+        {
+            const double x = static_cast<double>(k) / guide_size;
+            const unsigned int i = discrete_count_less(cdf, size, x);
+            guide[k] = i < size ? i : size - 1;
+        }
+    }
+
+    // sigma_l[k] and sigma_h[k] are inclusive sums of deficits and excesses,
+    // i.e. sigma[k + 1] of the description above
+    __global__
+    void discrete_alias_kernel(const double * weights,
+                               const unsigned int * order,
+                               const unsigned int * heavy_scan,
+                               const double * sigma_l,
+                               const double * sigma_h,
+                               double * probability,
+                               unsigned int * alias,
+                               unsigned long long * packed_alias,
+                               const unsigned int size)
+    {
+        const unsigned int heavies = heavy_scan[size - 1];
+        const unsigned int lights = size - heavies;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        for(unsigned int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; k < size; k += stride)
+        {
+            const unsigned int i = order[k];
+            double p;
+            unsigned int a;
+            if(heavies == 0)
+            {
+                // Rounding errors only, all weights are close to 1
+                p = 1.0;
+                a = i;
+            }
+            else if(k < lights)
+            {
+                const double deficits = k > 0 ? sigma_l[k - 1] : 0.0;
+                const unsigned int j = discrete_count_less(sigma_h, heavies - 1, deficits);
+                p = weights[i];
+                a = order[lights + j];
+            }
+            else
+            {
+                const unsigned int j = k - lights;
+                const unsigned int l = j + 1 < heavies
+                    ? discrete_count_less_equal(sigma_l, lights, sigma_h[j])
+                    : lights;
+                if(l < lights)
+                {
+                    p = 1.0 + sigma_h[j] - sigma_l[l];
+                    a = order[lights + j + 1];
+                }
+                else
+                {
+                    p = 1.0;
+                    a = i;
+                }
+            }
+            if(probability != NULL)
+            {
+                probability[i] = p;
+                alias[i] = a;
+            }
+            packed_alias[i] = pack_alias(p, a, i);
+        }
+    }
+
+    // Computes tables of size values from unnormalized probabilities in
+    // device memory, packed_alias (and then probability and alias) or cdf
+    // (and then guide) can be NULL
+    inline rocrand_status build_discrete_tables(const double * probabilities,
+                                                const unsigned int size,
+                                                double * probability,
+                                                unsigned int * alias,
+                                                unsigned long long * packed_alias,
+                                                double * cdf,
+                                                unsigned int * guide,
+                                                const unsigned int guide_size,
+                                                const device_allocator& allocator)
+    {
+        const unsigned int threads = discrete_block_size;
+        const unsigned int blocks = std::min<unsigned int>((size + threads - 1) / threads, 4096);
+
+        double * weights = NULL;
+        double * scan = NULL;
+        double * total = NULL;
+        double * sigma_l = NULL;
+        double * sigma_h = NULL;
+        unsigned int * heavy_scan = NULL;
+        unsigned int * order = NULL;
+
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        if(allocator.allocate(&weights, size) != ROCRAND_STATUS_SUCCESS
+            || allocator.allocate(&total, 1) != ROCRAND_STATUS_SUCCESS
+            || (cdf == NULL && allocator.allocate(&scan, size) != ROCRAND_STATUS_SUCCESS))
+        {
+            status = ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        double * sums = cdf != NULL ? cdf : scan;
+
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = discrete_inclusive_scan(discrete_array_input<double> { probabilities }, sums, size,
+                                             allocator);
+        }
+        if(status == ROCRAND_STATUS_SUCCESS
+            && hipMemcpy(total, sums + size - 1, sizeof(double), hipMemcpyDeviceToDevice) != hipSuccess)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(discrete_weights_kernel),
+                dim3(blocks), dim3(threads), 0, 0,
+                probabilities, total, sums, weights, size
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        if(status == ROCRAND_STATUS_SUCCESS && guide != NULL)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(discrete_guide_kernel),
+                dim3(std::min<unsigned int>((guide_size + threads - 1) / threads, 4096)),
+                dim3(threads), 0, 0,
+                cdf, guide, guide_size, size
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        if(status == ROCRAND_STATUS_SUCCESS && packed_alias != NULL)
+        {
+            if(allocator.allocate(&heavy_scan, size) != ROCRAND_STATUS_SUCCESS
+                || allocator.allocate(&order, size) != ROCRAND_STATUS_SUCCESS
+                || allocator.allocate(&sigma_l, size) != ROCRAND_STATUS_SUCCESS
+                || allocator.allocate(&sigma_h, size) != ROCRAND_STATUS_SUCCESS)
+            {
+                status = ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            if(status == ROCRAND_STATUS_SUCCESS)
+            {
+                status = discrete_inclusive_scan(discrete_heavy_input { weights }, heavy_scan, size,
+                                                 allocator);
+            }
+            if(status == ROCRAND_STATUS_SUCCESS)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(discrete_partition_kernel),
+                    dim3(blocks), dim3(threads), 0, 0,
+                    weights, heavy_scan, order, size
+                );
+                if(hipPeekAtLastError() != hipSuccess)
+                    status = ROCRAND_STATUS_LAUNCH_FAILURE;
+            }
+            if(status == ROCRAND_STATUS_SUCCESS)
+            {
+                status = discrete_inclusive_scan(
+                    discrete_deficit_input { weights, order, heavy_scan + size - 1, size, false },
+                    sigma_l, size, allocator
+                );
+            }
+            if(status == ROCRAND_STATUS_SUCCESS)
+            {
+                status = discrete_inclusive_scan(
+                    discrete_deficit_input { weights, order, heavy_scan + size - 1, size, true },
+                    sigma_h, size, allocator
+                );
+            }
+            if(status == ROCRAND_STATUS_SUCCESS)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(discrete_alias_kernel),
+                    dim3(blocks), dim3(threads), 0, 0,
+                    weights, order, heavy_scan, sigma_l, sigma_h,
+                    probability, alias, packed_alias, size
+                );
+                if(hipPeekAtLastError() != hipSuccess)
+                    status = ROCRAND_STATUS_LAUNCH_FAILURE;
+            }
+        }
+
+        if(hipDeviceSynchronize() != hipSuccess && status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        allocator.deallocate(weights);
+        allocator.deallocate(scan);
+        allocator.deallocate(total);
+        allocator.deallocate(sigma_l);
+        allocator.deallocate(sigma_h);
+        allocator.deallocate(heavy_scan);
+        allocator.deallocate(order);
+        return status;
+    }
+
+    // Indices must be unique within one update
+    __global__
+    void discrete_update_kernel(double * weights,
+                                double * tree,
+                                const unsigned int size,
+                                const unsigned int * indices,
+                                const double * probabilities,
+                                const unsigned int k)
+    {
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        for(unsigned int t = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; t < k; t += stride)
+        {
+            const unsigned int i = indices[t];
+            if(i >= size)
+                continue;
+            const double delta = probabilities[t] - weights[i];
+            weights[i] = probabilities[t];
+            // Nodes covering i, other updates can share them
+            for(unsigned int j = i + 1; j <= size; j += j & (~j + 1))
+            {
+                atomicAdd(tree + j - 1, delta);
+            }
+            atomicAdd(tree + size, delta);
+        }
+    }
+
+    // Sets weights of k values of the tree of an updatable distribution,
+    // O(k log size) work. The update is asynchronous (null stream).
+    inline rocrand_status update_discrete_tree(double * weights,
+                                               double * tree,
+                                               const unsigned int size,
+                                               const unsigned int * indices,
+                                               const double * probabilities,
+                                               const unsigned int k)
+    {
+        if(k == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        const unsigned int threads = discrete_block_size;
+        const unsigned int blocks = std::min<unsigned int>((k + threads - 1) / threads, 4096);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(discrete_update_kernel),
+            dim3(blocks), dim3(threads), 0, 0,
+            weights, tree, size, indices, probabilities, k
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_DISTRIBUTION_DISCRETE_DEVICE_H_
@@ -0,0 +1,179 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_GAMMA_H_
+#define ROCRAND_RNG_DISTRIBUTION_GAMMA_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+
+// Gamma, beta and exponential distributions of the host API, distributions
+// with rejection (see rejection_distribution). Every attempt draws the same
+// amount of numbers regardless of the result, so the generators which draw
+// numbers for a whole block together (MTGP32, MT19937) can use them, and
+// threads which retry do not shift the numbers of other threads.
+
+namespace rocrand_host {
+namespace detail {
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    void draw_uniform(Engine& engine, float& result)
+    {
+        result = rocrand_device::detail::uniform_distribution(engine());
+    }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    void draw_uniform(Engine& engine, double& result)
+    {
+        const unsigned int v1 = engine();
+        const unsigned int v2 = engine();
+        result = rocrand_device::detail::uniform_distribution_double(v1, v2);
+    }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    void draw_normal(Engine& engine, float& result)
+    {
+        const unsigned int v1 = engine();
+        const unsigned int v2 = engine();
+        result = rocrand_device::detail::box_muller(v1, v2).x;
+    }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    void draw_normal(Engine& engine, double& result)
+    {
+        uint4 v;
+        v.x = engine();
+        v.y = engine();
+        v.z = engine();
+        v.w = engine();
+        result = rocrand_device::detail::box_muller_double(v).x;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// One attempt of the method of Marsaglia and Tsang (3 numbers for float,
+// 6 for double), shapes less than 1 draw one more uniform value u for
+// the value of shape + 1 multiplied by u^(1 / shape).
+template<class T>
+struct gamma_distribution
+{
+    T shape;
+    T scale;
+    T d;
+    T c;
+
+    __forceinline__ __host__ __device__
+    gamma_distribution(T shape, T scale)
+        : shape(shape), scale(scale),
+          d((shape < T(1) ? shape + T(1) : shape) - T(1) / T(3)),
+          c(T(1) / sqrt(T(9) * d))
+    { }
+
+    // Candidate of the standard distribution of max(shape, shape + 1) and
+    // the uniform value for shapes less than 1 (1 otherwise)
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool attempt(Engine& engine, T& value, T& u_shape) const
+    {
+        T x, u;
+        rocrand_host::detail::draw_normal(engine, x);
+        rocrand_host::detail::draw_uniform(engine, u);
+        u_shape = T(1);
+        if(shape < T(1))
+        {
+            rocrand_host::detail::draw_uniform(engine, u_shape);
+        }
+        return rocrand_device::detail::gamma_marsaglia_tsang(x, u, d, c, value);
+    }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, T& result) const
+    {
+        T value, u_shape;
+        const bool accepted = attempt(engine, value, u_shape);
+        if(shape < T(1))
+        {
+            value *= pow(u_shape, T(1) / shape);
+        }
+        result = scale * value;
+        return accepted;
+    }
+};
+
+// X / (X + Y) of gamma values X and Y with shapes alpha and beta, one
+// attempt for both of them, computed from logarithms because values of
+// small shapes underflow
+template<class T>
+struct beta_distribution
+{
+    gamma_distribution<T> x;
+    gamma_distribution<T> y;
+
+    __forceinline__ __host__ __device__
+    beta_distribution(T alpha, T beta)
+        : x(alpha, T(1)), y(beta, T(1))
+    { }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, T& result) const
+    {
+        T value_x, u_x, value_y, u_y;
+        const bool accepted_x = x.attempt(engine, value_x, u_x);
+        const bool accepted_y = y.attempt(engine, value_y, u_y);
+        const T log_x = log(value_x) + log(u_x) / x.shape;
+        const T log_y = log(value_y) + log(u_y) / y.shape;
+        result = T(1) / (T(1) + exp(log_y - log_x));
+        return accepted_x && accepted_y;
+    }
+};
+
+// Inversion, every attempt is accepted (one number for float, two for double)
+template<class T>
+struct exponential_distribution
+{
+    T lambda;
+
+    __forceinline__ __host__ __device__
+    exponential_distribution(T lambda)
+        : lambda(lambda)
+    { }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, T& result) const
+    {
+        T u;
+        rocrand_host::detail::draw_uniform(engine, u);
+        result = -log(u) / lambda;
+        return true;
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_GAMMA_H_
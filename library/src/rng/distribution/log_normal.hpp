@@ -41,7 +41,7 @@ struct log_normal_distribution<float>
                                    mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
-    float2 operator()(const unsigned int x, const unsigned int y)
+    float2 operator()(const unsigned int x, const unsigned int y) const
     {
         float2 v = rocrand_device::detail::box_muller(x, y);
         v.x = expf(mean + (stddev * v.x));
@@ -50,7 +50,7 @@ struct log_normal_distribution<float>
     }
 
     __forceinline__ __host__ __device__
-    float4 operator()(const uint4 x)
+    float4 operator()(const uint4 x) const
     {
         float2 v = rocrand_device::detail::box_muller(x.x, x.y);
         float2 w = rocrand_device::detail::box_muller(x.z, x.w);
@@ -63,7 +63,15 @@ struct log_normal_distribution<float>
     }
 
     __forceinline__ __host__ __device__
-    float operator()(unsigned int x)
+    float operator()(unsigned int x) const
+    {
+        float v = rocrand_device::detail::normal_distribution(x);
+        v = expf(mean + (stddev * v));
+        return v;
+    }
+
+    __forceinline__ __host__ __device__
+    float operator()(unsigned long long x) const
     {
         float v = rocrand_device::detail::normal_distribution(x);
         v = expf(mean + (stddev * v));
@@ -82,7 +90,7 @@ struct log_normal_distribution<double>
                                     mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
-    double2 operator()(const uint4 x)
+    double2 operator()(const uint4 x) const
     {
         double2 v = rocrand_device::detail::box_muller_double(x);
         v.x = exp(mean + (stddev * v.x));
@@ -91,7 +99,15 @@ struct log_normal_distribution<double>
     }
 
     __forceinline__ __host__ __device__
-    double operator()(unsigned int x)
+    double operator()(unsigned int x) const
+    {
+        double v = rocrand_device::detail::normal_distribution_double(x);
+        v = exp(mean + (stddev * v));
+        return v;
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(unsigned long long x) const
     {
         double v = rocrand_device::detail::normal_distribution_double(x);
         v = exp(mean + (stddev * v));
@@ -99,6 +115,63 @@ struct log_normal_distribution<double>
     }
 };
 
+// Two half values from each unsigned int (Box-Muller transform of
+// its 16-bit halves), parameters and the transform use float
+template<>
+struct log_normal_distribution<__half2>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    log_normal_distribution<__half2>(float mean, float stddev) :
+                      mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    __half2 operator()(const unsigned int x) const
+    {
+        float2 v = rocrand_device::detail::box_muller_half(x);
+        return __floats2half2_rn(expf(mean + (stddev * v.x)), expf(mean + (stddev * v.y)));
+    }
+
+    __forceinline__ __host__ __device__
+    half2x4 operator()(const uint4 x) const
+    {
+        return half2x4 {
+            (*this)(x.x),
+            (*this)(x.y),
+            (*this)(x.z),
+            (*this)(x.w)
+        };
+    }
+};
+
+// One half value per number, used by quasi-random generators
+template<>
+struct log_normal_distribution<__half>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    log_normal_distribution<__half>(float mean, float stddev) :
+                     mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    __half operator()(const unsigned int x) const
+    {
+        float v = rocrand_device::detail::normal_distribution(x);
+        return __float2half(expf(mean + (stddev * v)));
+    }
+
+    __forceinline__ __host__ __device__
+    __half operator()(const unsigned long long x) const
+    {
+        float v = rocrand_device::detail::normal_distribution(x);
+        return __float2half(expf(mean + (stddev * v)));
+    }
+};
+
 template<class T>
 struct mrg_log_normal_distribution;
 
@@ -113,7 +186,7 @@ struct mrg_log_normal_distribution<float>
                                        mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
-    float2 operator()(const unsigned int x, const unsigned int y)
+    float2 operator()(const unsigned int x, const unsigned int y) const
     {
         float2 v = rocrand_device::detail::mrg_normal_distribution2(x, y);
         v.x = expf(mean + (stddev * v.x));
@@ -133,7 +206,7 @@ struct mrg_log_normal_distribution<double>
                                         mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
-    double2 operator()(const unsigned int x, const unsigned int y)
+    double2 operator()(const unsigned int x, const unsigned int y) const
     {
         double2 v = rocrand_device::detail::mrg_normal_distribution_double2(x, y);
         v.x = exp(mean + (stddev * v.x));
@@ -142,4 +215,24 @@ struct mrg_log_normal_distribution<double>
     }
 };
 
+template<>
+struct mrg_log_normal_distribution<__half2>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    mrg_log_normal_distribution<__half2>(float mean = 0.0f, float stddev = 1.0f) :
+                          mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    __half2 operator()(const unsigned int x) const
+    {
+        float2 v = rocrand_device::detail::box_muller_half(
+            static_cast<unsigned int>(x * ROCRAND_MRG32K3A_UINT_NORM)
+        );
+        return __floats2half2_rn(expf(mean + (stddev * v.x)), expf(mean + (stddev * v.y)));
+    }
+};
+
 #endif // ROCRAND_RNG_DISTRIBUTION_LOG_NORMAL_H_
@@ -0,0 +1,156 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_MULTIVARIATE_NORMAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_MULTIVARIATE_NORMAL_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+
+// Largest number of dimensions of rocrand_generate_multivariate_normal
+#define ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS 64
+
+namespace rocrand_host {
+namespace detail {
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    void draw_normal2(Engine& engine, float& x, float& y)
+    {
+        const unsigned int v1 = engine();
+        const unsigned int v2 = engine();
+        const float2 v = rocrand_device::detail::box_muller(v1, v2);
+        x = v.x;
+        y = v.y;
+    }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    void draw_normal2(Engine& engine, double& x, double& y)
+    {
+        uint4 u;
+        u.x = engine();
+        u.y = engine();
+        u.z = engine();
+        u.w = engine();
+        const double2 v = rocrand_device::detail::box_muller_double(u);
+        x = v.x;
+        y = v.y;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Correlated normal vectors mean + factor * z of standard normal vectors z
+// (distribution with rejection, see rejection_distribution, every value is
+// accepted): every thread draws z of its vector in registers and multiplies
+// it by the lower triangular factor, so the uncorrelated values are never
+// stored. All threads read the same elements of factor and mean at the same
+// time, these loads are served by the cache.
+// Vectors are stored by component, as columns of an n x dimensions
+// column-major matrix: component j of vector i is stored to
+// output[j * size + i] directly (j < dimensions - 1), the last component is
+// the result (the generator stores it to output[(dimensions - 1) * size + i]).
+// MaxDimensions bounds dimensions at compile time, so loops over z are
+// unrolled and z is kept in registers.
+template<class T, unsigned int MaxDimensions>
+struct multivariate_normal_distribution
+{
+    unsigned int dimensions;
+    const T * mean;
+    // Lower triangular column-major dimensions x dimensions matrix
+    const T * factor;
+    size_t size;
+    T * output;
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, T& result, size_t index) const
+    {
+        T z[MaxDimensions];
+        #pragma unroll
+        for(unsigned int k = 0; k < MaxDimensions; k += 2)
+        {
+            if(k < dimensions)
+            {
+                rocrand_host::detail::draw_normal2(engine, z[k], z[k + 1]);
+            }
+        }
+
+        #pragma unroll
+        for(unsigned int j = 0; j < MaxDimensions; j++)
+        {
+            if(j < dimensions)
+            {
+                T y = mean[j];
+                #pragma unroll
+                for(unsigned int k = 0; k <= j; k++)
+                {
+                    y += factor[k * dimensions + j] * z[k];
+                }
+                if(j + 1 < dimensions)
+                {
+                    output[j * size + index] = y;
+                }
+                else
+                {
+                    result = y;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// Chooses the smallest MaxDimensions of multivariate_normal_distribution for
+// dimensions and generates it by Generator::generate_multivariate_normal
+template<class Generator, class T>
+rocrand_status generate_multivariate_normal_dimensions(Generator& generator,
+                                                       T * data, size_t data_size,
+                                                       unsigned int dimensions,
+                                                       const T * mean,
+                                                       const T * factor)
+{
+    if(dimensions <= 4)
+    {
+        return generator.generate_multivariate_normal(data, data_size,
+            multivariate_normal_distribution<T, 4> { dimensions, mean, factor, data_size, data });
+    }
+    else if(dimensions <= 16)
+    {
+        return generator.generate_multivariate_normal(data, data_size,
+            multivariate_normal_distribution<T, 16> { dimensions, mean, factor, data_size, data });
+    }
+    else if(dimensions <= ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS)
+    {
+        return generator.generate_multivariate_normal(data, data_size,
+            multivariate_normal_distribution<T, ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS> {
+                dimensions, mean, factor, data_size, data
+            });
+    }
+    return ROCRAND_STATUS_OUT_OF_RANGE;
+}
+
+#endif // ROCRAND_RNG_DISTRIBUTION_MULTIVARIATE_NORMAL_H_
@@ -41,7 +41,7 @@ struct normal_distribution<float>
                                mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
-    float2 operator()(const unsigned int x, const unsigned int y)
+    float2 operator()(const unsigned int x, const unsigned int y) const
     {
         float2 v = rocrand_device::detail::box_muller(x, y);
         v.x = mean + v.x * stddev;
@@ -50,7 +50,7 @@ struct normal_distribution<float>
     }
 
     __forceinline__ __host__ __device__
-    float2 operator()(const uint2 x)
+    float2 operator()(const uint2 x) const
     {
         float2 v = rocrand_device::detail::box_muller(x.x, x.y);
         v.x = mean + v.x * stddev;
@@ -59,7 +59,7 @@ struct normal_distribution<float>
     }
 
     __forceinline__ __host__ __device__
-    float4 operator()(const uint4 x)
+    float4 operator()(const uint4 x) const
     {
         float2 v = rocrand_device::detail::box_muller(x.x, x.y);
         float2 w = rocrand_device::detail::box_muller(x.z, x.w);
@@ -72,7 +72,14 @@ struct normal_distribution<float>
     }
 
     __forceinline__ __host__ __device__
-    float operator()(const unsigned int x)
+    float operator()(const unsigned int x) const
+    {
+        float v = rocrand_device::detail::normal_distribution(x);
+        return mean + v * stddev;
+    }
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned long long x) const
     {
         float v = rocrand_device::detail::normal_distribution(x);
         return mean + v * stddev;
@@ -90,7 +97,7 @@ struct normal_distribution<double>
                                 mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
-    double2 operator()(uint4 x)
+    double2 operator()(uint4 x) const
     {
         double2 v = rocrand_device::detail::box_muller_double(x);
         v.x = mean + v.x * stddev;
@@ -99,11 +106,75 @@ struct normal_distribution<double>
     }
 
     __forceinline__ __host__ __device__
-    double operator()(const unsigned int x)
+    double operator()(const unsigned int x) const
     {
         double v = rocrand_device::detail::normal_distribution_double(x);
         return mean + v * stddev;
     }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned long long x) const
+    {
+        double v = rocrand_device::detail::normal_distribution_double(x);
+        return mean + v * stddev;
+    }
+};
+
+// Two half values from each unsigned int (Box-Muller transform of
+// its 16-bit halves), parameters and the transform use float
+template<>
+struct normal_distribution<__half2>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    normal_distribution<__half2>(float mean = 0.0f, float stddev = 1.0f) :
+                      mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    __half2 operator()(const unsigned int x) const
+    {
+        float2 v = rocrand_device::detail::box_muller_half(x);
+        return __floats2half2_rn(mean + v.x * stddev, mean + v.y * stddev);
+    }
+
+    __forceinline__ __host__ __device__
+    half2x4 operator()(const uint4 x) const
+    {
+        return half2x4 {
+            (*this)(x.x),
+            (*this)(x.y),
+            (*this)(x.z),
+            (*this)(x.w)
+        };
+    }
+};
+
+// One half value per number, used by quasi-random generators
+template<>
+struct normal_distribution<__half>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    normal_distribution<__half>(float mean = 0.0f, float stddev = 1.0f) :
+                     mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    __half operator()(const unsigned int x) const
+    {
+        float v = rocrand_device::detail::normal_distribution(x);
+        return __float2half(mean + v * stddev);
+    }
+
+    __forceinline__ __host__ __device__
+    __half operator()(const unsigned long long x) const
+    {
+        float v = rocrand_device::detail::normal_distribution(x);
+        return __float2half(mean + v * stddev);
+    }
 };
 
 template<class T>
@@ -120,7 +191,7 @@ struct mrg_normal_distribution<float>
                                    mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
-    float2 operator()(const unsigned int x, const unsigned int y)
+    float2 operator()(const unsigned int x, const unsigned int y) const
     {
         float2 v = rocrand_device::detail::mrg_normal_distribution2(x, y);
         v.x = mean + v.x * stddev;
@@ -140,7 +211,7 @@ struct mrg_normal_distribution<double>
                                     mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
-    double2 operator()(const unsigned int x, const unsigned int y)
+    double2 operator()(const unsigned int x, const unsigned int y) const
     {
         double2 v = rocrand_device::detail::mrg_normal_distribution_double2(x, y);
         v.x = mean + v.x * stddev;
@@ -149,4 +220,24 @@ struct mrg_normal_distribution<double>
     }
 };
 
+template<>
+struct mrg_normal_distribution<__half2>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    mrg_normal_distribution<__half2>(float mean = 0.0f, float stddev = 1.0f) :
+                          mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    __half2 operator()(const unsigned int x) const
+    {
+        float2 v = rocrand_device::detail::box_muller_half(
+            static_cast<unsigned int>(x * ROCRAND_MRG32K3A_UINT_NORM)
+        );
+        return __floats2half2_rn(mean + v.x * stddev, mean + v.y * stddev);
+    }
+};
+
 #endif // ROCRAND_RNG_DISTRIBUTION_NORMAL_H_
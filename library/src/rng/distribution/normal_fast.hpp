@@ -0,0 +1,214 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_NORMAL_FAST_H_
+#define ROCRAND_RNG_DISTRIBUTION_NORMAL_FAST_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+#include "normal.hpp"
+#include "log_normal.hpp"
+
+// Distributions of ROCRAND_MATH_MODE_FAST: Box-Muller transforms of float
+// and half values use __logf and __expf intrinsics on the device (see
+// box_muller_fast()), other types are the same as in the accurate mode.
+
+template<class T>
+struct normal_fast_distribution : normal_distribution<T>
+{
+    using normal_distribution<T>::normal_distribution;
+};
+
+template<>
+struct normal_fast_distribution<float> : normal_distribution<float>
+{
+    using normal_distribution<float>::normal_distribution;
+    using normal_distribution<float>::operator();
+
+    __forceinline__ __host__ __device__
+    float2 operator()(const unsigned int x, const unsigned int y) const
+    {
+        float2 v = rocrand_device::detail::box_muller_fast(x, y);
+        v.x = mean + v.x * stddev;
+        v.y = mean + v.y * stddev;
+        return v;
+    }
+
+    __forceinline__ __host__ __device__
+    float2 operator()(const uint2 x) const
+    {
+        return (*this)(x.x, x.y);
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 x) const
+    {
+        float2 v = (*this)(x.x, x.y);
+        float2 w = (*this)(x.z, x.w);
+        return float4 { v.x, v.y, w.x, w.y };
+    }
+};
+
+template<>
+struct normal_fast_distribution<__half2> : normal_distribution<__half2>
+{
+    using normal_distribution<__half2>::normal_distribution;
+
+    __forceinline__ __host__ __device__
+    __half2 operator()(const unsigned int x) const
+    {
+        float2 v = rocrand_device::detail::box_muller_half_fast(x);
+        return __floats2half2_rn(mean + v.x * stddev, mean + v.y * stddev);
+    }
+
+    __forceinline__ __host__ __device__
+    half2x4 operator()(const uint4 x) const
+    {
+        return half2x4 { (*this)(x.x), (*this)(x.y), (*this)(x.z), (*this)(x.w) };
+    }
+};
+
+template<class T>
+struct log_normal_fast_distribution : log_normal_distribution<T>
+{
+    using log_normal_distribution<T>::log_normal_distribution;
+};
+
+template<>
+struct log_normal_fast_distribution<float> : log_normal_distribution<float>
+{
+    using log_normal_distribution<float>::log_normal_distribution;
+    using log_normal_distribution<float>::operator();
+
+    __forceinline__ __host__ __device__
+    float2 operator()(const unsigned int x, const unsigned int y) const
+    {
+        float2 v = rocrand_device::detail::box_muller_fast(x, y);
+        v.x = rocrand_device::detail::exp_fast(mean + (stddev * v.x));
+        v.y = rocrand_device::detail::exp_fast(mean + (stddev * v.y));
+        return v;
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 x) const
+    {
+        float2 v = (*this)(x.x, x.y);
+        float2 w = (*this)(x.z, x.w);
+        return float4 { v.x, v.y, w.x, w.y };
+    }
+};
+
+template<>
+struct log_normal_fast_distribution<__half2> : log_normal_distribution<__half2>
+{
+    using log_normal_distribution<__half2>::log_normal_distribution;
+
+    __forceinline__ __host__ __device__
+    __half2 operator()(const unsigned int x) const
+    {
+        float2 v = rocrand_device::detail::box_muller_half_fast(x);
+        return __floats2half2_rn(rocrand_device::detail::exp_fast(mean + (stddev * v.x)),
+                                 rocrand_device::detail::exp_fast(mean + (stddev * v.y)));
+    }
+
+    __forceinline__ __host__ __device__
+    half2x4 operator()(const uint4 x) const
+    {
+        return half2x4 { (*this)(x.x), (*this)(x.y), (*this)(x.z), (*this)(x.w) };
+    }
+};
+
+template<class T>
+struct mrg_normal_fast_distribution : mrg_normal_distribution<T>
+{
+    using mrg_normal_distribution<T>::mrg_normal_distribution;
+};
+
+template<>
+struct mrg_normal_fast_distribution<float> : mrg_normal_distribution<float>
+{
+    using mrg_normal_distribution<float>::mrg_normal_distribution;
+
+    __forceinline__ __host__ __device__
+    float2 operator()(const unsigned int x, const unsigned int y) const
+    {
+        float2 v = rocrand_device::detail::mrg_normal_distribution2_fast(x, y);
+        v.x = mean + v.x * stddev;
+        v.y = mean + v.y * stddev;
+        return v;
+    }
+};
+
+template<>
+struct mrg_normal_fast_distribution<__half2> : mrg_normal_distribution<__half2>
+{
+    using mrg_normal_distribution<__half2>::mrg_normal_distribution;
+
+    __forceinline__ __host__ __device__
+    __half2 operator()(const unsigned int x) const
+    {
+        float2 v = rocrand_device::detail::box_muller_half_fast(
+            static_cast<unsigned int>(x * ROCRAND_MRG32K3A_UINT_NORM)
+        );
+        return __floats2half2_rn(mean + v.x * stddev, mean + v.y * stddev);
+    }
+};
+
+template<class T>
+struct mrg_log_normal_fast_distribution : mrg_log_normal_distribution<T>
+{
+    using mrg_log_normal_distribution<T>::mrg_log_normal_distribution;
+};
+
+template<>
+struct mrg_log_normal_fast_distribution<float> : mrg_log_normal_distribution<float>
+{
+    using mrg_log_normal_distribution<float>::mrg_log_normal_distribution;
+
+    __forceinline__ __host__ __device__
+    float2 operator()(const unsigned int x, const unsigned int y) const
+    {
+        float2 v = rocrand_device::detail::mrg_normal_distribution2_fast(x, y);
+        v.x = rocrand_device::detail::exp_fast(mean + (stddev * v.x));
+        v.y = rocrand_device::detail::exp_fast(mean + (stddev * v.y));
+        return v;
+    }
+};
+
+template<>
+struct mrg_log_normal_fast_distribution<__half2> : mrg_log_normal_distribution<__half2>
+{
+    using mrg_log_normal_distribution<__half2>::mrg_log_normal_distribution;
+
+    __forceinline__ __host__ __device__
+    __half2 operator()(const unsigned int x) const
+    {
+        float2 v = rocrand_device::detail::box_muller_half_fast(
+            static_cast<unsigned int>(x * ROCRAND_MRG32K3A_UINT_NORM)
+        );
+        return __floats2half2_rn(rocrand_device::detail::exp_fast(mean + (stddev * v.x)),
+                                 rocrand_device::detail::exp_fast(mean + (stddev * v.y)));
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_NORMAL_FAST_H_
@@ -0,0 +1,97 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_NORMAL_INVERSION_H_
+#define ROCRAND_RNG_DISTRIBUTION_NORMAL_INVERSION_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+
+// Normal distribution computed by the inverse normal CDF (one 32-bit
+// number per float, two numbers per double), used with
+// rejection_distribution like the Ziggurat distributions. Values are never
+// rejected, so the number of consumed random numbers is fixed.
+template<class T>
+struct normal_inversion_distribution;
+
+template<>
+struct normal_inversion_distribution<float>
+{
+    const float mean;
+    const float stddev;
+
+    __forceinline__ __host__ __device__
+    normal_inversion_distribution(float mean = 0.0f, float stddev = 1.0f)
+        : mean(mean), stddev(stddev) {}
+
+    template<class Engine>
+    __forceinline__ __device__
+    bool operator()(Engine& engine, float& result) const
+    {
+        result = mean + stddev * rocrand_device::detail::normal_inverse_cdf(engine());
+        return true;
+    }
+};
+
+template<>
+struct normal_inversion_distribution<double>
+{
+    const double mean;
+    const double stddev;
+
+    __forceinline__ __host__ __device__
+    normal_inversion_distribution(double mean = 0.0, double stddev = 1.0)
+        : mean(mean), stddev(stddev) {}
+
+    template<class Engine>
+    __forceinline__ __device__
+    bool operator()(Engine& engine, double& result) const
+    {
+        const unsigned int v1 = engine();
+        const unsigned int v2 = engine();
+        result = mean + stddev * rocrand_device::detail::normal_inverse_cdf_double(v1, v2);
+        return true;
+    }
+};
+
+template<class T>
+struct log_normal_inversion_distribution
+{
+    const normal_inversion_distribution<T> normal;
+
+    __forceinline__ __host__ __device__
+    log_normal_inversion_distribution(T mean, T stddev)
+        : normal(mean, stddev) {}
+
+    template<class Engine>
+    __forceinline__ __device__
+    bool operator()(Engine& engine, T& result) const
+    {
+        T z;
+        normal(engine, z);
+        result = exp(z);
+        return true;
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_NORMAL_INVERSION_H_
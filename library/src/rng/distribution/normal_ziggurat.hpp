@@ -0,0 +1,330 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_NORMAL_ZIGGURAT_H_
+#define ROCRAND_RNG_DISTRIBUTION_NORMAL_ZIGGURAT_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+
+// Ziggurat method of Marsaglia and Tsang for the normal distribution with
+// 128 layers. Most values cost one table lookup and one multiplication,
+// exp and log are computed only for values in wedges and in the tail
+// (about 1.2% of candidates).
+//
+// Layer i (0 < i < 128) covers [0, x[i]) x [f(x[i]), f(x[i+1])), the base
+// layer 0 is the rectangle [0, x[1]) with the tail beyond r = x[1], its
+// total area is the area v of all layers, x[0] = v / f(r).
+// f(x) = exp(-x^2 / 2).
+
+#define ROCRAND_ZIGGURAT_LAYERS 128
+#define ROCRAND_ZIGGURAT_R 3.442619855899
+
+static __constant__ float d_ziggurat_x_float[ROCRAND_ZIGGURAT_LAYERS + 1] = {
+    3.71308625f, 3.44261986f, 3.22308498f, 3.08322886f,
+    2.97869625f, 2.89434401f, 2.82312535f, 2.76116937f,
+    2.70611357f, 2.65640641f, 2.61097225f, 2.56903363f,
+    2.53000967f, 2.49345452f, 2.45901818f, 2.42642065f,
+    2.39543428f, 2.36587137f, 2.33757524f, 2.31041368f,
+    2.28427406f, 2.25905957f, 2.2346864f, 2.21108141f,
+    2.18818043f, 2.16592679f, 2.14427018f, 2.12316571f,
+    2.10257314f, 2.08245624f, 2.06278227f, 2.04352154f,
+    2.02464697f, 2.00613387f, 1.98795957f, 1.97010326f,
+    1.95254573f, 1.93526923f, 1.9182573f, 1.90149465f,
+    1.88496704f, 1.86866114f, 1.85256451f, 1.83666546f,
+    1.820953f, 1.80541676f, 1.79004698f, 1.7748344f,
+    1.75977022f, 1.74484613f, 1.73005416f, 1.71538674f,
+    1.70083662f, 1.68639685f, 1.67206075f, 1.65782192f,
+    1.64367416f, 1.62961148f, 1.6156281f, 1.60171838f,
+    1.58787686f, 1.57409822f, 1.56037722f, 1.54670878f,
+    1.53308788f, 1.51950958f, 1.50596904f, 1.49246142f,
+    1.47898198f, 1.46552596f, 1.45208864f, 1.43866532f,
+    1.42525125f, 1.41184171f, 1.39843191f, 1.38501704f,
+    1.3715922f, 1.35815245f, 1.34469275f, 1.33120795f,
+    1.31769278f, 1.30414185f, 1.29054959f, 1.27691027f,
+    1.26321796f, 1.2494665f, 1.23564948f, 1.22176023f,
+    1.20779175f, 1.19373671f, 1.17958738f, 1.16533564f,
+    1.15097284f, 1.13648985f, 1.12187692f, 1.10712365f,
+    1.09221888f, 1.07715062f, 1.06190596f, 1.0464709f,
+    1.03083024f, 1.0149674f, 0.998864233f, 0.982500804f,
+    0.965855079f, 0.948902626f, 0.931616197f, 0.913965251f,
+    0.895915353f, 0.877427429f, 0.858456843f, 0.838952214f,
+    0.818853907f, 0.798092061f, 0.776583988f, 0.754230664f,
+    0.730911911f, 0.706479611f, 0.680747919f, 0.653478639f,
+    0.624358597f, 0.592962942f, 0.558692178f, 0.520656039f,
+    0.477437837f, 0.426547986f, 0.362871431f, 0.272320865f,
+    0.0f
+};
+
+static __constant__ float d_ziggurat_f_float[ROCRAND_ZIGGURAT_LAYERS + 1] = {
+    0.00101435256f, 0.00266962908f, 0.00554899522f, 0.00862448441f,
+    0.0118394787f, 0.015167298f, 0.0185921027f, 0.0221033046f,
+    0.0256932919f, 0.0293563174f, 0.0330878861f, 0.0368843888f,
+    0.0407428681f, 0.0446608622f, 0.0486362959f, 0.0526674019f,
+    0.0567526635f, 0.0608907703f, 0.0650805852f, 0.0693211174f,
+    0.0736115019f, 0.0779509825f, 0.0823388982f, 0.0867746719f,
+    0.0912578008f, 0.0957878491f, 0.100364441f, 0.104987255f,
+    0.109656021f, 0.114370512f, 0.119130547f, 0.12393598f,
+    0.128786706f, 0.133682653f, 0.13862378f, 0.14361008f,
+    0.148641574f, 0.153718312f, 0.158840371f, 0.164007855f,
+    0.169220892f, 0.174479638f, 0.179784272f, 0.185134997f,
+    0.19053204f, 0.195975653f, 0.20146611f, 0.207003709f,
+    0.212588773f, 0.218221647f, 0.223902699f, 0.229632325f,
+    0.235410942f, 0.241238994f, 0.247116948f, 0.253045299f,
+    0.259024567f, 0.265055302f, 0.271138079f, 0.277273503f,
+    0.283462208f, 0.28970486f, 0.296002157f, 0.302354828f,
+    0.308763638f, 0.315229388f, 0.321752916f, 0.328335098f,
+    0.334976853f, 0.341679141f, 0.348442968f, 0.355269385f,
+    0.362159495f, 0.369114454f, 0.37613547f, 0.383223811f,
+    0.390380808f, 0.397607856f, 0.404906421f, 0.41227804f,
+    0.419724332f, 0.427246998f, 0.43484783f, 0.442528715f,
+    0.450291644f, 0.458138716f, 0.466072153f, 0.474094301f,
+    0.482207646f, 0.490414825f, 0.498718635f, 0.507122051f,
+    0.515628238f, 0.524240573f, 0.532962659f, 0.541798355f,
+    0.550751793f, 0.559827413f, 0.569029991f, 0.578364681f,
+    0.587837054f, 0.597453151f, 0.607219537f, 0.617143371f,
+    0.627232485f, 0.637495477f, 0.647941821f, 0.658582f,
+    0.669427667f, 0.680491841f, 0.691789143f, 0.703336099f,
+    0.715151507f, 0.727256918f, 0.739677244f, 0.752441559f,
+    0.765584174f, 0.779146086f, 0.793177012f, 0.807738295f,
+    0.822907211f, 0.838783605f, 0.855500608f, 0.873243049f,
+    0.892281651f, 0.913043648f, 0.936282682f, 0.963599693f,
+    1.0f
+};
+
+static __constant__ double d_ziggurat_x_double[ROCRAND_ZIGGURAT_LAYERS + 1] = {
+    3.7130862467425505, 3.4426198558990002, 3.2230849845811416, 3.0832288582168683,
+    2.9786962526477803, 2.8943440070215289, 2.8231253505489105, 2.7611693723871769,
+    2.7061135731218195, 2.6564064112613597, 2.6109722484318474, 2.5690336259249378,
+    2.5300096723888275, 2.4934545220953721, 2.4590181774118305, 2.4264206455337498,
+    2.3954342780110625, 2.3658713701176386, 2.3375752413392368, 2.310413683698763,
+    2.2842740596774718, 2.2590595738691985, 2.2346863955909795, 2.2110814088787034,
+    2.1881804320760492, 2.1659267937489219, 2.1442701823603953, 2.1231657086739766,
+    2.1025731351892385, 2.0824562379920168, 2.0627822745083084, 2.0435215366550676,
+    2.0246469733773855, 2.0061338699634721, 1.9879595741276199, 1.9701032608543265,
+    1.9525457295535567, 1.9352692282966228, 1.9182573008645099, 1.9014946531051511,
+    1.884967035707759, 1.8686611409944887, 1.8525645117280911, 1.836665460258446,
+    1.8209529965961255, 1.8054167642192285, 1.7900469825998586, 1.7748343955860695,
+    1.7597702248995934, 1.7448461281138004, 1.7300541605637305, 1.7153867407136676,
+    1.7008366185699169, 1.6863968467791681, 1.6720607540976009, 1.6578219209540241,
+    1.6436741568628686, 1.6296114794706347, 1.615628095043161, 1.6017183802213781,
+    1.5878768648905761, 1.5740982160230008, 1.5603772223661689, 1.5467087798599104,
+    1.5330878776740433, 1.5195095847659401, 1.5059690368632033, 1.492461423781354,
+    1.4789819769899242, 1.4655259573427108, 1.4520886428892246, 1.4386653166845635,
+    1.4252512545140601, 1.4118417124470577, 1.3984319141310053, 1.3850170377326518,
+    1.3715922024273426, 1.3581524543301435, 1.344692751753547, 1.3312079496656273,
+    1.3176927832094141, 1.3041418501286168, 1.2905495919261964, 1.2769102735601556,
+    1.2632179614546211, 1.2494664995730682, 1.2356494832633627, 1.2217602305399964,
+    1.2077917504159497, 1.1937367078331287, 1.1795873846639882, 1.1653356361647524,
+    1.1509728421488674, 1.1364898520131608, 1.1218769225825422, 1.107123647534036,
+    1.0922188769072774, 1.0771506248928957, 1.0619059636948243, 1.0464709007640454,
+    1.0308302360681956, 1.0149673952513305, 0.99886423349298359, 0.98250080351542901,
+    0.9658550794011499, 0.94890262551130644, 0.93161619661515083, 0.91396525102303228,
+    0.89591535258093769, 0.87742742911292337, 0.85845684319381321, 0.83895221429757738,
+    0.81885390670035729, 0.79809206064405691, 0.77658398789475991, 0.75423066445405562,
+    0.73091191064248884, 0.70647961133543646, 0.68074791866915463, 0.65347863873997525,
+    0.6243585973360507, 0.59296294247144832, 0.55869217840818519, 0.52065603876206057,
+    0.47743783729668982, 0.42654798635542351, 0.36287143109703196, 0.27232086481396467,
+    0.0
+};
+
+static __constant__ double d_ziggurat_f_double[ROCRAND_ZIGGURAT_LAYERS + 1] = {
+    0.0010143525641203774, 0.0026696290838809228, 0.0055489952207713449, 0.0086244844128598851,
+    0.011839478657884862, 0.015167298010546568, 0.018592102737011288, 0.022103304615927098,
+    0.025693291935934271, 0.02935631744000685, 0.033087886146225751, 0.036884388786656203,
+    0.040742868074444175, 0.044660862200491425, 0.048636295859867805, 0.052667401903051012,
+    0.056752663481049848, 0.060890770348040406, 0.065080585213068073, 0.069321117393577908,
+    0.073611501884113403, 0.077950982513973394, 0.082338898242235656, 0.086774671894780178,
+    0.091257800826830257, 0.095787849121731439, 0.10036444102865587, 0.10498725540942132,
+    0.10965602101484027, 0.11437051244886601, 0.11913054670765083, 0.12393598020286782,
+    0.12878670619594321, 0.13368265258343937, 0.1386237799845946, 0.14361008009062776,
+    0.14864157424234226, 0.15371831220818166, 0.1588403711394793, 0.16400785468342038,
+    0.169220892237365, 0.1744796383307895, 0.17978427212329545, 0.18513499700899219,
+    0.19053204031913715, 0.19597565311627774, 0.20146611007431367, 0.20700370943992652,
+    0.2125887730717303, 0.2182216465543054, 0.22390269938500842, 0.22963232523211613,
+    0.23541094226347908, 0.24123899354543982, 0.24711694751232141, 0.25304529850732577,
+    0.25902456739620483, 0.26505530225558921, 0.27113807913838461, 0.27727350291918812,
+    0.28346220822323298, 0.28970486044295984, 0.29600215684693298, 0.30235482778648354,
+    0.30876363800618112, 0.31522938806501088, 0.32175291587598492, 0.3283350983728503,
+    0.33497685331358917, 0.34167914123155041, 0.34844296754632659, 0.35526938484791709,
+    0.36215949536931757, 0.36911445366447221, 0.37613546951056259, 0.3832238110559012,
+    0.39038080823731458, 0.39760785649387331, 0.40490642080722294, 0.412278040102661,
+    0.41972433204957438, 0.42724699830499607, 0.43484783024999091, 0.44252871527546844,
+    0.45029164368203922, 0.45813871626787206, 0.46607215268945612, 0.47409430069301695,
+    0.48220764632948521, 0.49041482528384411, 0.4987186354709795, 0.50712205107556896,
+    0.51562823824400184, 0.52424057267298407, 0.53296265938383613, 0.5417983550254255,
+    0.55075179311460454, 0.55982741270408687, 0.56902999106795094, 0.57836468111976314,
+    0.58783705443470657, 0.59745315094451668, 0.60721953662512029, 0.61714337081888093,
+    0.62723248524992725, 0.6374954773350423, 0.64794182111022247, 0.65858200005008805,
+    0.66942766734889037, 0.68049184099733406, 0.69178914343667508, 0.70333609901615812,
+    0.7151515074104986, 0.72725691834418482, 0.73967724367264731, 0.75244155917461142,
+    0.7655841738977045, 0.7791460859296877, 0.79317701177130506, 0.80773829468296054,
+    0.82290721138140899, 0.83878360529598961, 0.85550060786945059, 0.87324304891006954,
+    0.8922816507840261, 0.9130436479717402, 0.93628268168505957, 0.96359969312708615,
+    1.0
+};
+
+namespace rocrand_host {
+namespace detail {
+
+// Samples the tail of the normal distribution beyond r
+template<class RealType, class Uniform>
+__forceinline__ __device__
+RealType ziggurat_tail(Uniform uniform)
+{
+    const RealType r = static_cast<RealType>(ROCRAND_ZIGGURAT_R);
+    RealType x, y;
+    do
+    {
+        x = -log(uniform()) / r;
+        y = -log(uniform());
+    } while(y + y < x * x);
+    return r + x;
+}
+
+// One candidate of the standard normal distribution from one 32-bit
+// number: 7 bits select the layer, 25 bits give the signed position
+// in the layer. Returns false if the candidate is rejected in a wedge.
+template<class Engine>
+__forceinline__ __device__
+bool ziggurat_standard_normal(Engine& engine, float& result)
+{
+    const unsigned int v = engine();
+    const unsigned int i = v & (ROCRAND_ZIGGURAT_LAYERS - 1);
+    const float u = static_cast<int>(v & ~(ROCRAND_ZIGGURAT_LAYERS - 1)) * 4.656612873e-10f; // 2^-31
+    const float x = u * d_ziggurat_x_float[i];
+    if(fabsf(x) < d_ziggurat_x_float[i + 1])
+    {
+        result = x;
+        return true;
+    }
+    auto uniform = [&engine]() { return rocrand_device::detail::uniform_distribution(engine()); };
+    if(i == 0)
+    {
+        const float t = ziggurat_tail<float>(uniform);
+        result = u < 0.0f ? -t : t;
+        return true;
+    }
+    const float y = d_ziggurat_f_float[i]
+        + uniform() * (d_ziggurat_f_float[i + 1] - d_ziggurat_f_float[i]);
+    if(y < expf(-0.5f * x * x))
+    {
+        result = x;
+        return true;
+    }
+    return false;
+}
+
+// The same from two 32-bit numbers: 7 bits select the layer, 57 bits
+// give the signed position in the layer.
+template<class Engine>
+__forceinline__ __device__
+bool ziggurat_standard_normal(Engine& engine, double& result)
+{
+    const unsigned int v1 = engine();
+    const unsigned int v2 = engine();
+    const unsigned int i = v1 & (ROCRAND_ZIGGURAT_LAYERS - 1);
+    const unsigned long long v =
+        (static_cast<unsigned long long>(v2) << 32) | (v1 & ~(ROCRAND_ZIGGURAT_LAYERS - 1));
+    const double u = static_cast<long long>(v) * 1.0842021724855044e-19; // 2^-63
+    const double x = u * d_ziggurat_x_double[i];
+    if(fabs(x) < d_ziggurat_x_double[i + 1])
+    {
+        result = x;
+        return true;
+    }
+    auto uniform = [&engine]() {
+        const unsigned int w1 = engine();
+        const unsigned int w2 = engine();
+        return rocrand_device::detail::uniform_distribution_double(w1, w2);
+    };
+    if(i == 0)
+    {
+        const double t = ziggurat_tail<double>(uniform);
+        result = u < 0.0 ? -t : t;
+        return true;
+    }
+    const double y = d_ziggurat_f_double[i]
+        + uniform() * (d_ziggurat_f_double[i + 1] - d_ziggurat_f_double[i]);
+    if(y < exp(-0.5 * x * x))
+    {
+        result = x;
+        return true;
+    }
+    return false;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Normal distribution computed by the Ziggurat method, used with
+// rejection_distribution.
+template<class T>
+struct normal_ziggurat_distribution
+{
+    const T mean;
+    const T stddev;
+
+    __forceinline__ __host__ __device__
+    normal_ziggurat_distribution(T mean = 0, T stddev = 1)
+        : mean(mean), stddev(stddev) {}
+
+    template<class Engine>
+    __forceinline__ __device__
+    bool operator()(Engine& engine, T& result) const
+    {
+        T z;
+        if(!rocrand_host::detail::ziggurat_standard_normal(engine, z))
+        {
+            return false;
+        }
+        result = mean + stddev * z;
+        return true;
+    }
+};
+
+template<class T>
+struct log_normal_ziggurat_distribution
+{
+    const T mean;
+    const T stddev;
+
+    __forceinline__ __host__ __device__
+    log_normal_ziggurat_distribution(T mean, T stddev)
+        : mean(mean), stddev(stddev) {}
+
+    template<class Engine>
+    __forceinline__ __device__
+    bool operator()(Engine& engine, T& result) const
+    {
+        T z;
+        if(!rocrand_host::detail::ziggurat_standard_normal(engine, z))
+        {
+            return false;
+        }
+        result = exp(mean + stddev * z);
+        return true;
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_NORMAL_ZIGGURAT_H_
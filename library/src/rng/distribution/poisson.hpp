@@ -23,11 +23,15 @@
 
 #include <climits>
 #include <algorithm>
+#include <list>
 #include <vector>
 
 #include <rocrand.h>
 
+#include "common.hpp"
 #include "discrete.hpp"
+#include "../generator_type.hpp"
+#include "../profiling.hpp"
 
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
 class rocrand_poisson_distribution : public rocrand_discrete_distribution_base<Method, IsHostSide>
@@ -109,38 +113,214 @@ protected:
     }
 };
 
-// Handles caching of precomputed tables for the distribution and recomputes
-// them only when lambda is changed (as these computations, device memory
-// allocations and copying take time).
+// Handles caching of precomputed tables for the distribution (as these
+// computations, device memory allocations and copying take time).
+// Tables of recently used lambdas are kept while their total size does
+// not exceed cache.max_bytes of the generator (least recently used tables
+// are freed first), one manager caches tables of one Method.
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
 class poisson_distribution_manager
 {
 public:
 
-    rocrand_poisson_distribution<Method, IsHostSide> dis;
+    typedef rocrand_poisson_distribution<Method, IsHostSide> distribution_type;
+
+    // Tables of the last lambda passed to set_lambda()
+    distribution_type dis;
 
     poisson_distribution_manager()
-        : lambda(0.0)
     { }
 
     ~poisson_distribution_manager()
     {
-        dis.deallocate();
+        for(auto& e : entries)
+        {
+            e.dis.deallocate(e.stream);
+        }
+    }
+
+    // Tables in host memory (host generators)
+    void set_lambda(double lambda, poisson_cache_state& cache)
+    {
+        set_lambda(lambda, cache, rocrand_host::detail::device_allocator(), 0);
+    }
+
+    // Tables of a new lambda are allocated by allocator, tables are freed
+    // on the stream which used them last (stream of the generator).
+    // The keep most recently used tables are never freed here, because
+    // they can be used by the launch being prepared (rocrand_generate_batch).
+    // Tables can not be built while the stream is captured into a graph
+    // (capturing), only cached lambdas can be used then.
+    void set_lambda(double lambda, poisson_cache_state& cache,
+                    const rocrand_host::detail::device_allocator& allocator,
+                    hipStream_t stream, bool capturing = false, size_t keep = 1)
+    {
+        ROCRAND_PROFILING_NAMED_RANGE("poisson_distribution_manager::set_lambda", lambda);
+        auto it = std::find_if(
+            entries.begin(), entries.end(),
+            [lambda](const entry& e) { return e.lambda == lambda; }
+        );
+        if(it != entries.end())
+        {
+            cache.hits++;
+            it->stream = stream;
+            entries.splice(entries.begin(), entries, it);
+        }
+        else if(capturing)
+        {
+            throw ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        else
+        {
+            cache.misses++;
+            rocrand_host::detail::scoped_host_timer timer(cache.build_time);
+            entries.push_front(entry { lambda, distribution_type(), stream });
+            entries.front().dis.allocator = allocator;
+            try
+            {
+                entries.front().dis.set_lambda(lambda);
+            }
+            catch(rocrand_status status)
+            {
+                entries.front().dis.deallocate(stream);
+                entries.pop_front();
+                throw status;
+            }
+        }
+        dis = entries.front().dis;
+
+        size_t bytes = memory_usage();
+        while(entries.size() > std::max<size_t>(keep, 1) && bytes > cache.max_bytes)
+        {
+            bytes -= entries.back().dis.memory_usage();
+            entries.back().dis.deallocate(entries.back().stream);
+            entries.pop_back();
+        }
     }
 
-    void set_lambda(double new_lambda)
+    // Returns the number of bytes allocated for all cached tables
+    size_t memory_usage() const
     {
-        const bool changed = lambda != new_lambda;
-        if (changed)
+        size_t bytes = 0;
+        for(const auto& e : entries)
         {
-            lambda = new_lambda;
-            dis.set_lambda(lambda);
+            bytes += e.dis.memory_usage();
         }
+        return bytes;
     }
 
 private:
 
+    struct entry
+    {
+        double lambda;
+        distribution_type dis;
+        // Stream of the last generation which used the tables
+        hipStream_t stream;
+    };
+
+    // Most recently used tables first
+    std::list<entry> entries;
+};
+
+// Table-free Poisson distribution for lambda >= lambda_threshold_small
+// (distribution with rejection, see rejection_distribution): rejection
+// method PA of A. C. Atkinson (as poisson_distribution_large of the device
+// API) up to lambda_threshold_huge, normal approximation above it.
+// Constants of PA are computed on the host once per generation, so changing
+// lambda does not require building and copying tables.
+struct poisson_rejection_distribution
+{
     double lambda;
+    double sqrt_lambda;
+    double beta;
+    double alpha;
+    double k;
+    double log_lambda;
+
+    __forceinline__ __host__ __device__
+    poisson_rejection_distribution(double lambda)
+        : lambda(lambda),
+          sqrt_lambda(sqrt(lambda)),
+          beta(ROCRAND_PI_DOUBLE / sqrt(3.0 * lambda)),
+          alpha(beta * lambda),
+          k(log(0.767 - 3.36 / lambda) - lambda - log(beta)),
+          log_lambda(log(lambda))
+    { }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, unsigned int& result) const
+    {
+        const unsigned int u1 = engine();
+        const unsigned int u2 = engine();
+        const double u = rocrand_device::detail::uniform_distribution_double(u1, u2);
+
+        if(lambda > rocrand_device::detail::lambda_threshold_huge)
+        {
+            const double n = rocrand_device::detail::normal_inverse_cdf_double(u1, u2);
+            result = static_cast<unsigned int>(round(sqrt_lambda * n + lambda));
+            return true;
+        }
+
+        const double x = (alpha - log((1.0 - u) / u)) / beta;
+        const double n = floor(x + 0.5);
+        if(n < 0)
+        {
+            return false;
+        }
+        const unsigned int v1 = engine();
+        const unsigned int v2 = engine();
+        const double v = rocrand_device::detail::uniform_distribution_double(v1, v2);
+        const double y = alpha - beta * x;
+        const double t = 1.0 + exp(y);
+        const double lhs = y + log(v / (t * t));
+        const double rhs = k + n * log_lambda - rocrand_device::detail::lgamma_approx(n + 1.0);
+        if(lhs <= rhs)
+        {
+            result = static_cast<unsigned int>(n);
+            return true;
+        }
+        return false;
+    }
+};
+
+// Poisson distribution with a lambda per value read from device memory
+// (rocrand_generate_poisson_array), with the methods of rocrand_poisson
+// of the device API: Knuth's method for lambda < lambda_threshold_small,
+// poisson_rejection_distribution above. Threads diverge only where
+// neighboring lambdas are in different ranges. Values of non-positive
+// lambdas are 0.
+struct poisson_array_distribution
+{
+    const double * lambdas;
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, unsigned int& result, size_t index) const
+    {
+        const double lambda = lambdas[index];
+        if(lambda >= rocrand_device::detail::lambda_threshold_small)
+        {
+            const poisson_rejection_distribution distribution(lambda);
+            while(!distribution(engine, result)) { }
+            return true;
+        }
+
+        const double limit = exp(-lambda);
+        unsigned int k = 0;
+        double product = 1.0;
+        do
+        {
+            const unsigned int u1 = engine();
+            const unsigned int u2 = engine();
+            k++;
+            product *= rocrand_device::detail::uniform_distribution_double(u1, u2);
+        }
+        while(product > limit);
+        result = k - 1;
+        return true;
+    }
 };
 
 #endif // ROCRAND_RNG_DISTRIBUTION_POISSON_H_
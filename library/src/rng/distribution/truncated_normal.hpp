@@ -0,0 +1,66 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_TRUNCATED_NORMAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_TRUNCATED_NORMAL_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+#include "gamma.hpp"
+
+// Normal distribution truncated to [a, b] (distribution with rejection, see
+// rejection_distribution) with the methods of rocrand_truncated_normal of
+// the device API. The regime is chosen once per generation: values of
+// central intervals are always accepted and use one uniform value (one
+// number for float, two for double), so counter-based generators compute
+// all values of a group of 4 numbers from it as normal_distribution does.
+// Attempts of tail intervals use two uniform values, threads which retry
+// draw numbers only for their own values.
+template<class T>
+struct truncated_normal_distribution
+{
+    rocrand_device::detail::truncated_normal_params<T> params;
+
+    __forceinline__ __host__ __device__
+    truncated_normal_distribution(T mean, T stddev, T a, T b)
+        : params(mean, stddev, a, b)
+    { }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, T& result) const
+    {
+        T u;
+        rocrand_host::detail::draw_uniform(engine, u);
+        if(!params.tail)
+        {
+            result = params.central(u);
+            return true;
+        }
+        T v;
+        rocrand_host::detail::draw_uniform(engine, v);
+        return params.tail_attempt(u, v, result);
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_TRUNCATED_NORMAL_H_
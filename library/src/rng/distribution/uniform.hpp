@@ -46,6 +46,26 @@ struct uniform_distribution<unsigned int>
     }
 };
 
+template<>
+struct uniform_distribution<unsigned long long>
+{
+    __forceinline__ __host__ __device__
+    unsigned long long operator()(const unsigned long long v) const
+    {
+        return v;
+    }
+
+    // Pairs of numbers, the first one is the lower half
+    __forceinline__ __host__ __device__
+    ulonglong2 operator()(const uint4 v) const
+    {
+        return ulonglong2 {
+            v.x | (static_cast<unsigned long long>(v.y) << 32),
+            v.z | (static_cast<unsigned long long>(v.w) << 32)
+        };
+    }
+};
+
 // For unsigned integer between 0 and UINT_MAX, returns value between
 // 0.0f and 1.0f, excluding 0.0f and including 1.0f.
 template<>
@@ -57,6 +77,13 @@ struct uniform_distribution<float>
         return rocrand_device::detail::uniform_distribution(v);
     }
 
+    // Uses the 32 most significant bits of v
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned long long v) const
+    {
+        return rocrand_device::detail::uniform_distribution(v);
+    }
+
     __forceinline__ __host__ __device__
     float4 operator()(const uint4 v) const
     {
@@ -113,6 +140,70 @@ struct uniform_distribution<double>
     }
 };
 
+// Doubles of ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT: one double per number
+// (multiples of 2^-32), so vectorized generators store 4 doubles per 4 numbers
+struct uniform_double_fast_distribution
+{
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        return rocrand_device::detail::uniform_distribution_double(v);
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v) const
+    {
+        return rocrand_device::detail::uniform_distribution_double4(v);
+    }
+};
+
+// Doubles of ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT: one double per two
+// numbers, used by generators which draw one number per double by default
+struct uniform_double_full_distribution : uniform_distribution<double>
+{
+};
+
+// For unsigned integer between 0 and UINT_MAX, returns two half values
+// between 0.0 and 1.0, excluding 0.0 and including 1.0, one from each
+// 16-bit half of the integer.
+template<>
+struct uniform_distribution<__half2>
+{
+    __forceinline__ __host__ __device__
+    __half2 operator()(const unsigned int v) const
+    {
+        return rocrand_device::detail::uniform_distribution_half2(v);
+    }
+
+    __forceinline__ __host__ __device__
+    half2x4 operator()(const uint4 v) const
+    {
+        return half2x4 {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+// One half value per number, used by quasi-random generators
+template<>
+struct uniform_distribution<__half>
+{
+    __forceinline__ __host__ __device__
+    __half operator()(const unsigned int v) const
+    {
+        return rocrand_device::detail::uniform_distribution_half(v);
+    }
+
+    __forceinline__ __host__ __device__
+    __half operator()(const unsigned long long v) const
+    {
+        return rocrand_device::detail::uniform_distribution_half(v);
+    }
+};
+
 // MRG32K3A constants
 #ifndef ROCRAND_MRG32K3A_NORM_DOUBLE
 #define ROCRAND_MRG32K3A_NORM_DOUBLE (2.3283065498378288e-10) // 1/ROCRAND_MRG32K3A_M1
@@ -158,4 +249,102 @@ struct mrg_uniform_distribution<double>
     }
 };
 
+// Numbers of MRG32K3A are scaled to [0, UINT_MAX] before they are
+// split into 16-bit halves
+template<>
+struct mrg_uniform_distribution<__half2>
+{
+    __forceinline__ __host__ __device__
+    __half2 operator()(const unsigned int v) const
+    {
+        return rocrand_device::detail::uniform_distribution_half2(
+            static_cast<unsigned int>(v * ROCRAND_MRG32K3A_UINT_NORM)
+        );
+    }
+};
+
+// Integers uniformly distributed in [lo, hi) computed by Lemire's
+// multiply-shift method, the rejection threshold is computed on host
+// so kernels do not need any division. hi must be greater than lo.
+template<class T>
+struct uniform_int_distribution;
+
+template<>
+struct uniform_int_distribution<unsigned int>
+{
+    unsigned int lo;
+    unsigned int range;
+    unsigned int threshold;
+
+    uniform_int_distribution(const unsigned int lo, const unsigned int hi)
+        : lo(lo), range(hi - lo), threshold((0U - (hi - lo)) % (hi - lo))
+    {
+    }
+
+    // Draws one number from engine, returns false if it is rejected
+    // (pseudo-random generators draw until a number is accepted)
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, unsigned int& result) const
+    {
+        if(!rocrand_device::detail::uniform_int_accept(engine(), range, threshold, result))
+        {
+            return false;
+        }
+        result += lo;
+        return true;
+    }
+
+    // Multiply-shift without rejection for quasi-random generators,
+    // it keeps one value per point and the order of points
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned int v) const
+    {
+        return lo + static_cast<unsigned int>(
+            (static_cast<unsigned long long>(v) * range) >> 32
+        );
+    }
+
+    // Uses the 32 most significant bits of v
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned long long v) const
+    {
+        return (*this)(static_cast<unsigned int>(v >> 32));
+    }
+};
+
+template<>
+struct uniform_int_distribution<unsigned long long>
+{
+    unsigned long long lo;
+    unsigned long long range;
+    unsigned long long threshold;
+
+    uniform_int_distribution(const unsigned long long lo, const unsigned long long hi)
+        : lo(lo), range(hi - lo), threshold((0ULL - (hi - lo)) % (hi - lo))
+    {
+    }
+
+    // Each candidate is drawn from two 32-bit numbers
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool operator()(Engine& engine, unsigned long long& result) const
+    {
+        unsigned long long x = engine();
+        x = (x << 32) | engine();
+        if(!rocrand_device::detail::uniform_int_accept(x, range, threshold, result))
+        {
+            return false;
+        }
+        result += lo;
+        return true;
+    }
+
+    __forceinline__ __host__ __device__
+    unsigned long long operator()(const unsigned long long v) const
+    {
+        return lo + rocrand_device::detail::mul_hi_u64(v, range);
+    }
+};
+
 #endif // ROCRAND_RNG_DISTRIBUTION_UNIFORM_H_
@@ -23,8 +23,16 @@
 
 #include "distribution/uniform.hpp"
 #include "distribution/normal.hpp"
+#include "distribution/normal_ziggurat.hpp"
+#include "distribution/normal_inversion.hpp"
 #include "distribution/log_normal.hpp"
+#include "distribution/normal_fast.hpp"
 #include "distribution/discrete.hpp"
 #include "distribution/poisson.hpp"
+#include "distribution/gamma.hpp"
+#include "distribution/binomial.hpp"
+#include "distribution/bernoulli.hpp"
+#include "distribution/truncated_normal.hpp"
+#include "distribution/multivariate_normal.hpp"
 
 #endif // ROCRAND_RNG_DISTRIBUTION_S_H_
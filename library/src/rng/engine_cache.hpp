@@ -0,0 +1,297 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_ENGINE_CACHE_H_
+#define ROCRAND_RNG_ENGINE_CACHE_H_
+
+// Cache of initialized engines in files of the directory of the environment
+// variable ROCRAND_STATE_CACHE_DIR (disabled if it is not set or empty).
+// init() of XORWOW, MRG32k3a and MTGP32 generators loads engines of a file
+// whose key (type, seed, offset, number of engines, ...) matches instead of
+// running initialization kernels, and stores engines after initialization
+// when there is no file yet. A file is memory-mapped and copied to the device
+// with one copy. Engines are stored by a callback of the stream without
+// waiting for the initialization; files are written to a unique temporary
+// name and renamed, so processes and threads which start concurrently never
+// read incomplete files; files which can not be read or written are ignored.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Identifies files of the cache ("RREC")
+    constexpr unsigned int engine_cache_magic = 0x52524543;
+
+    // Everything engines depend on, it is the header of a file and its name
+    // is a hash of it. Engines of a different library version or layout
+    // (engine_bytes) are never loaded.
+    struct engine_cache_key
+    {
+        unsigned int magic;
+        unsigned int version;
+        rocrand_rng_type rng_type;
+        // sizeof of one engine
+        unsigned int engine_bytes;
+        unsigned long long engines_size;
+        unsigned long long seed;
+        unsigned long long offset;
+        // First subsequence (XORWOW, MRG32k3a) or parameter set (MTGP32)
+        // of the partition and children of the generator
+        unsigned long long subsequence;
+        // 1 for ROCRAND_ORDERING_PSEUDO_SEEDED
+        unsigned int seeded;
+        // 1 for the structure of arrays layout (ROCRAND_ENGINES_SOA)
+        unsigned int engines_soa;
+    };
+
+    inline engine_cache_key make_engine_cache_key(const rocrand_rng_type rng_type,
+                                                  const size_t engine_bytes,
+                                                  const size_t engines_size,
+                                                  const unsigned long long seed,
+                                                  const unsigned long long offset,
+                                                  const unsigned long long subsequence,
+                                                  const bool seeded)
+    {
+        engine_cache_key key;
+        std::memset(&key, 0, sizeof(key));
+        key.magic = engine_cache_magic;
+        key.version = ROCRAND_VERSION;
+        key.rng_type = rng_type;
+        key.engine_bytes = static_cast<unsigned int>(engine_bytes);
+        key.engines_size = engines_size;
+        key.seed = seed;
+        key.offset = offset;
+        key.subsequence = subsequence;
+        key.seeded = seeded ? 1 : 0;
+#ifdef ROCRAND_ENGINES_SOA
+        key.engines_soa = 1;
+#endif
+        return key;
+    }
+
+    // Directory of the cache, NULL if the cache is disabled
+    inline const char * engine_cache_dir()
+    {
+        static const std::string dir = []() {
+            const char * value = std::getenv("ROCRAND_STATE_CACHE_DIR");
+            return std::string(value != NULL ? value : "");
+        }();
+        return dir.empty() ? NULL : dir.c_str();
+    }
+
+    // <dir>/rocrand-engines-<FNV-1a hash of the key>.bin
+    inline std::string engine_cache_path(const char * dir, const engine_cache_key& key)
+    {
+        const unsigned char * bytes = reinterpret_cast<const unsigned char *>(&key);
+        unsigned long long hash = 0xCBF29CE484222325ULL;
+        for(size_t i = 0; i < sizeof(key); i++)
+        {
+            hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+        }
+        char name[64];
+        std::snprintf(name, sizeof(name), "/rocrand-engines-%016llx.bin", hash);
+        return std::string(dir) + name;
+    }
+
+#if !defined(_WIN32)
+
+    // Copies engines of the file of key to engines (engines_bytes bytes in
+    // device memory) on stream, returns false if there is no matching file.
+    // The mapping is removed after the copy is completed.
+    inline bool load_cached_engines(const engine_cache_key& key,
+                                    void * engines, const size_t engines_bytes,
+                                    hipStream_t stream)
+    {
+        const char * dir = engine_cache_dir();
+        if(dir == NULL)
+            return false;
+
+        const int fd = ::open(engine_cache_path(dir, key).c_str(), O_RDONLY);
+        if(fd < 0)
+            return false;
+        const size_t file_bytes = sizeof(key) + engines_bytes;
+        struct stat file_stat;
+        if(::fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) != file_bytes)
+        {
+            ::close(fd);
+            return false;
+        }
+        void * mapping = ::mmap(NULL, file_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if(mapping == MAP_FAILED)
+            return false;
+
+        const char * data = static_cast<const char *>(mapping);
+        const bool loaded = std::memcmp(data, &key, sizeof(key)) == 0
+            && hipMemcpyAsync(engines, data + sizeof(key), engines_bytes,
+                              hipMemcpyHostToDevice, stream) == hipSuccess
+            && hipStreamSynchronize(stream) == hipSuccess;
+        ::munmap(mapping, file_bytes);
+        return loaded;
+    }
+
+    // Writes bytes of data to a unique temporary file of the directory of
+    // path and renames it to path, so readers never see incomplete files
+    inline void write_cached_engines(const std::string& path, const char * data, size_t bytes)
+    {
+        std::string temporary = path + ".XXXXXX";
+        const int fd = ::mkstemp(&temporary[0]);
+        if(fd < 0)
+            return;
+        // mkstemp creates files readable only by the owner
+        bool written = ::fchmod(fd, 0644) == 0;
+        while(written && bytes > 0)
+        {
+            const ssize_t count = ::write(fd, data, bytes);
+            written = count > 0;
+            if(written)
+            {
+                data += count;
+                bytes -= static_cast<size_t>(count);
+            }
+        }
+        if(::close(fd) != 0 || !written || std::rename(temporary.c_str(), path.c_str()) != 0)
+        {
+            std::remove(temporary.c_str());
+        }
+    }
+
+    // A store enqueued by store_cached_engines(): engines are copied to
+    // pinned memory after the key, the file is written by a callback
+    struct engine_cache_store
+    {
+        std::string path;
+        char * data;
+        size_t bytes;
+    };
+
+    // Stores whose files are written, HIP functions can not be called by
+    // callbacks of streams, so their pinned memory is freed by the next store
+    inline std::mutex& completed_engine_cache_stores_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    inline std::vector<engine_cache_store *>& completed_engine_cache_stores()
+    {
+        static std::vector<engine_cache_store *> stores;
+        return stores;
+    }
+
+    inline void free_engine_cache_store(engine_cache_store * store)
+    {
+        hipHostFree(store->data);
+        delete store;
+    }
+
+    inline void engine_cache_store_callback(hipStream_t, hipError_t status, void * user_data)
+    {
+        engine_cache_store * store = static_cast<engine_cache_store *>(user_data);
+        if(status == hipSuccess)
+        {
+            write_cached_engines(store->path, store->data, store->bytes);
+        }
+        std::lock_guard<std::mutex> lock(completed_engine_cache_stores_mutex());
+        completed_engine_cache_stores().push_back(store);
+    }
+
+    // Enqueues the copy of initialized engines (work of stream) and the
+    // write of the file of key if it does not exist, the host does not wait
+    // for the initialization
+    inline void store_cached_engines(const engine_cache_key& key,
+                                     const void * engines, const size_t engines_bytes,
+                                     hipStream_t stream)
+    {
+        const char * dir = engine_cache_dir();
+        if(dir == NULL)
+            return;
+
+        std::vector<engine_cache_store *> completed;
+        {
+            std::lock_guard<std::mutex> lock(completed_engine_cache_stores_mutex());
+            completed.swap(completed_engine_cache_stores());
+        }
+        for(engine_cache_store * completed_store : completed)
+        {
+            free_engine_cache_store(completed_store);
+        }
+
+        const std::string path = engine_cache_path(dir, key);
+        if(::access(path.c_str(), F_OK) == 0)
+            return;
+
+        engine_cache_store * store = new engine_cache_store;
+        store->path = path;
+        store->bytes = sizeof(key) + engines_bytes;
+        if(hipHostMalloc(reinterpret_cast<void **>(&store->data), store->bytes) != hipSuccess)
+        {
+            delete store;
+            return;
+        }
+        std::memcpy(store->data, &key, sizeof(key));
+        if(hipMemcpyAsync(store->data + sizeof(key), engines, engines_bytes,
+                          hipMemcpyDeviceToHost, stream) != hipSuccess)
+        {
+            free_engine_cache_store(store);
+            return;
+        }
+        // The copy may still be in progress, the memory is freed by
+        // a later store after the callback is completed
+        if(hipStreamAddCallback(stream, engine_cache_store_callback, store, 0) != hipSuccess)
+        {
+            hipStreamSynchronize(stream);
+            free_engine_cache_store(store);
+        }
+    }
+
+#else
+
+    inline bool load_cached_engines(const engine_cache_key&, void *, const size_t, hipStream_t)
+    {
+        return false;
+    }
+
+    inline void store_cached_engines(const engine_cache_key&, const void *, const size_t, hipStream_t)
+    {
+    }
+
+#endif
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_ENGINE_CACHE_H_
@@ -0,0 +1,58 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_GENERATOR_CORE_H_
+#define ROCRAND_RNG_GENERATOR_CORE_H_
+
+#include <hip/hip_runtime.h>
+#include <hip/hip_fp16.h>
+#include <rocrand.h>
+
+// Core generation functions (rocrand_generate(), uniform, normal and
+// log-normal values of all types) of device generators. They are declared
+// here and defined only in generator_core_instances.hpp, which is included by
+// one source file per generator (rocrand_<generator>.cpp) with explicit
+// instantiations for its type. So kernels of these functions of every
+// generator are in the separate code object of its source file instead of
+// the code object of rocrand.cpp, and with deferred loading of the HIP
+// runtime (HIP_ENABLE_DEFERRED_LOADING, on by default) only code objects of
+// generators which are actually used are loaded.
+
+namespace rocrand_host {
+namespace detail {
+
+    template<class Generator>
+    rocrand_status generate_core(Generator * generator, unsigned int * data, size_t n);
+
+    template<class Generator, class T>
+    rocrand_status generate_uniform_core(Generator * generator, T * data, size_t n);
+
+    template<class Generator, class T, class Param>
+    rocrand_status generate_normal_core(Generator * generator, T * data, size_t n,
+                                        Param mean, Param stddev);
+
+    template<class Generator, class T, class Param>
+    rocrand_status generate_log_normal_core(Generator * generator, T * data, size_t n,
+                                            Param mean, Param stddev);
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_GENERATOR_CORE_H_
@@ -0,0 +1,88 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_GENERATOR_CORE_INSTANCES_H_
+#define ROCRAND_RNG_GENERATOR_CORE_INSTANCES_H_
+
+#include "generator_core.hpp"
+#include "generators.hpp"
+
+// Definitions of core generation functions (see generator_core.hpp), only
+// source files of generators include this file
+
+namespace rocrand_host {
+namespace detail {
+
+    template<class Generator>
+    rocrand_status generate_core(Generator * generator, unsigned int * data, size_t n)
+    {
+        return generator->generate(data, n);
+    }
+
+    template<class Generator, class T>
+    rocrand_status generate_uniform_core(Generator * generator, T * data, size_t n)
+    {
+        return generator->generate_uniform(data, n);
+    }
+
+    template<class Generator, class T, class Param>
+    rocrand_status generate_normal_core(Generator * generator, T * data, size_t n,
+                                        Param mean, Param stddev)
+    {
+        return generator->generate_normal(data, n, mean, stddev);
+    }
+
+    template<class Generator, class T, class Param>
+    rocrand_status generate_log_normal_core(Generator * generator, T * data, size_t n,
+                                            Param mean, Param stddev)
+    {
+        return generator->generate_log_normal(data, n, mean, stddev);
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Instantiates core functions of floating-point values of Generator
+#define ROCRAND_INSTANTIATE_GENERATOR_CORE(Generator) \
+    template rocrand_status rocrand_host::detail::generate_uniform_core<Generator, float>( \
+        Generator *, float *, size_t); \
+    template rocrand_status rocrand_host::detail::generate_uniform_core<Generator, double>( \
+        Generator *, double *, size_t); \
+    template rocrand_status rocrand_host::detail::generate_uniform_core<Generator, __half>( \
+        Generator *, __half *, size_t); \
+    template rocrand_status rocrand_host::detail::generate_normal_core<Generator, float, float>( \
+        Generator *, float *, size_t, float, float); \
+    template rocrand_status rocrand_host::detail::generate_normal_core<Generator, double, double>( \
+        Generator *, double *, size_t, double, double); \
+    template rocrand_status rocrand_host::detail::generate_normal_core<Generator, __half, float>( \
+        Generator *, __half *, size_t, float, float); \
+    template rocrand_status rocrand_host::detail::generate_log_normal_core<Generator, float, float>( \
+        Generator *, float *, size_t, float, float); \
+    template rocrand_status rocrand_host::detail::generate_log_normal_core<Generator, double, double>( \
+        Generator *, double *, size_t, double, double); \
+    template rocrand_status rocrand_host::detail::generate_log_normal_core<Generator, __half, float>( \
+        Generator *, __half *, size_t, float, float);
+
+// Instantiates rocrand_generate() of generators of 32-bit numbers
+#define ROCRAND_INSTANTIATE_GENERATOR_CORE_UINT(Generator) \
+    template rocrand_status rocrand_host::detail::generate_core<Generator>( \
+        Generator *, unsigned int *, size_t);
+
+#endif // ROCRAND_RNG_GENERATOR_CORE_INSTANCES_H_
@@ -0,0 +1,157 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_GENERATOR_DISPATCH_H_
+#define ROCRAND_RNG_GENERATOR_DISPATCH_H_
+
+#include <type_traits>
+
+#include <hip/hip_runtime.h>
+#include <hip/hip_fp16.h>
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+#include "generator_core.hpp"
+#include "generators.hpp"
+
+// Function tables of device generators. The table of a generator is set when
+// it is created (new_generator()), so core generation functions of the C API
+// make one indirect call instead of comparing rng_type with every type.
+
+namespace rocrand_host {
+namespace detail {
+
+    struct generator_dispatch
+    {
+        hipStream_t (*get_stream)(const rocrand_generator_base_type *);
+
+        // NULL if the generator does not have rocrand_generate()
+        rocrand_status (*generate)(rocrand_generator_base_type *, unsigned int *, size_t);
+
+        rocrand_status (*generate_uniform)(rocrand_generator_base_type *, float *, size_t);
+        rocrand_status (*generate_uniform_double)(rocrand_generator_base_type *, double *, size_t);
+        rocrand_status (*generate_uniform_half)(rocrand_generator_base_type *, __half *, size_t);
+
+        rocrand_status (*generate_normal)(rocrand_generator_base_type *, float *, size_t,
+                                          float, float);
+        rocrand_status (*generate_normal_double)(rocrand_generator_base_type *, double *, size_t,
+                                                 double, double);
+        rocrand_status (*generate_normal_half)(rocrand_generator_base_type *, __half *, size_t,
+                                               float, float);
+
+        rocrand_status (*generate_log_normal)(rocrand_generator_base_type *, float *, size_t,
+                                              float, float);
+        rocrand_status (*generate_log_normal_double)(rocrand_generator_base_type *, double *, size_t,
+                                                     double, double);
+        rocrand_status (*generate_log_normal_half)(rocrand_generator_base_type *, __half *, size_t,
+                                                   float, float);
+    };
+
+    // Generators of 64-bit numbers without rocrand_generate()
+    template<class Generator>
+    struct generator_has_generate : std::true_type { };
+    template<>
+    struct generator_has_generate<rocrand_sobol64> : std::false_type { };
+    template<>
+    struct generator_has_generate<rocrand_scrambled_sobol64> : std::false_type { };
+
+    // Entries of the table of Generator, core functions are instantiated in
+    // the source file of the generator (see generator_core_instances.hpp)
+    template<class Generator>
+    struct generator_dispatch_entries
+    {
+        typedef rocrand_status (*generate_type)(rocrand_generator_base_type *, unsigned int *, size_t);
+
+        static hipStream_t get_stream(const rocrand_generator_base_type * generator)
+        {
+            return static_cast<const Generator *>(generator)->get_stream();
+        }
+
+        static rocrand_status generate(rocrand_generator_base_type * generator,
+                                       unsigned int * data, size_t n)
+        {
+            return generate_core(static_cast<Generator *>(generator), data, n);
+        }
+
+        static generate_type generate_entry(std::true_type)
+        {
+            return &generate;
+        }
+
+        static generate_type generate_entry(std::false_type)
+        {
+            return NULL;
+        }
+
+        template<class T>
+        static rocrand_status generate_uniform(rocrand_generator_base_type * generator,
+                                               T * data, size_t n)
+        {
+            return generate_uniform_core(static_cast<Generator *>(generator), data, n);
+        }
+
+        template<class T, class Param>
+        static rocrand_status generate_normal(rocrand_generator_base_type * generator,
+                                              T * data, size_t n, Param mean, Param stddev)
+        {
+            return generate_normal_core(static_cast<Generator *>(generator), data, n, mean, stddev);
+        }
+
+        template<class T, class Param>
+        static rocrand_status generate_log_normal(rocrand_generator_base_type * generator,
+                                                  T * data, size_t n, Param mean, Param stddev)
+        {
+            return generate_log_normal_core(static_cast<Generator *>(generator), data, n, mean, stddev);
+        }
+    };
+
+    template<class Generator>
+    inline const generator_dispatch * get_generator_dispatch()
+    {
+        typedef generator_dispatch_entries<Generator> entries;
+        static const generator_dispatch table = {
+            &entries::get_stream,
+            entries::generate_entry(generator_has_generate<Generator>()),
+            &entries::template generate_uniform<float>,
+            &entries::template generate_uniform<double>,
+            &entries::template generate_uniform<__half>,
+            &entries::template generate_normal<float, float>,
+            &entries::template generate_normal<double, double>,
+            &entries::template generate_normal<__half, float>,
+            &entries::template generate_log_normal<float, float>,
+            &entries::template generate_log_normal<double, double>,
+            &entries::template generate_log_normal<__half, float>
+        };
+        return &table;
+    }
+
+    // Creates a device generator with its function table
+    template<class Generator>
+    inline Generator * new_generator()
+    {
+        Generator * generator = new Generator();
+        generator->dispatch = get_generator_dispatch<Generator>();
+        return generator;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_GENERATOR_DISPATCH_H_
@@ -0,0 +1,191 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_GENERATOR_STATE_H_
+#define ROCRAND_RNG_GENERATOR_STATE_H_
+
+#include <cstddef>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Identifies memory which contains a saved state ("RRST"), states of
+    // libraries built with ROCRAND_ENGINES_SOA have engines in a different
+    // layout ("RRSS")
+#ifdef ROCRAND_ENGINES_SOA
+    constexpr unsigned int generator_state_magic = 0x52525353;
+#else
+    constexpr unsigned int generator_state_magic = 0x52525354;
+#endif
+
+    // Header of a state saved by rocrand_save_state(), engines of the
+    // generator follow it (if they were initialized). All counters are kept
+    // on the host, so the header is written from the host and read back
+    // by rocrand_load_state(), engines are copied by the device.
+    struct generator_state_header
+    {
+        unsigned int magic;
+        rocrand_rng_type rng_type;
+        rocrand_ordering order;
+        rocrand_normal_method normal_method;
+        rocrand_math_mode math_mode;
+        rocrand_double_resolution double_resolution;
+        // Dimensions of quasi-random generators, 1 for others
+        unsigned int dimensions;
+        // Set by rocrand_set_engine_count(), 0 if not set
+        unsigned int engine_count;
+        // 0 if the generator was not initialized (engines are not saved)
+        unsigned int initialized;
+        // First dimension of quasi-random generators, 0 for others
+        unsigned int first_dimension;
+        unsigned long long seed;
+        unsigned long long offset;
+        // Position of counter-based generators (numbers generated by Philox,
+        // offset of the next point of Sobol generators)
+        unsigned long long position;
+        // Value of the position in device memory of capture-safe mode,
+        // written by the device (see device_position)
+        unsigned long long device_position;
+        unsigned long long engines_size;
+    };
+
+    inline size_t get_state_size(const size_t engines_bytes)
+    {
+        return sizeof(generator_state_header) + engines_bytes;
+    }
+
+    // Saving and loading are not captured: the header is copied from host
+    // memory which does not exist when the graph is launched
+    inline bool is_stream_capturing(hipStream_t stream)
+    {
+        hipStreamCaptureStatus status = hipStreamCaptureStatusNone;
+        return hipStreamIsCapturing(stream, &status) == hipSuccess
+            && status != hipStreamCaptureStatusNone;
+    }
+
+    // Enqueues copies of the header, of the position in device memory
+    // (device_position can be NULL) and of engines_bytes bytes of engines
+    // to state (device or host memory) on stream
+    inline rocrand_status save_state(void * state,
+                                     const generator_state_header& header,
+                                     const unsigned long long * device_position,
+                                     const void * engines, const size_t engines_bytes,
+                                     hipStream_t stream)
+    {
+        if(is_stream_capturing(stream))
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        char * dst = static_cast<char *>(state);
+        // The header is copied from pageable memory, the copy of its
+        // contents is completed when hipMemcpyAsync returns
+        if(hipMemcpyAsync(dst, &header, sizeof(header), hipMemcpyDefault, stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        if(device_position != NULL
+            && hipMemcpyAsync(dst + offsetof(generator_state_header, device_position),
+                              device_position, sizeof(unsigned long long),
+                              hipMemcpyDefault, stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(engines_bytes > 0
+            && hipMemcpyAsync(dst + sizeof(header), engines, engines_bytes,
+                              hipMemcpyDefault, stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Settings of a header are values which can be set for generators
+    // of rng_type, so a corrupted header is rejected before it is used
+    inline bool is_valid_state_header(const generator_state_header& header,
+                                      const rocrand_rng_type rng_type)
+    {
+        bool quasi_order;
+        switch(header.order)
+        {
+            case ROCRAND_ORDERING_PSEUDO_BEST:
+            case ROCRAND_ORDERING_PSEUDO_DEFAULT:
+            case ROCRAND_ORDERING_PSEUDO_SEEDED:
+            case ROCRAND_ORDERING_PSEUDO_LEGACY:
+            case ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT:
+                quasi_order = false;
+                break;
+            case ROCRAND_ORDERING_QUASI_DEFAULT:
+            case ROCRAND_ORDERING_QUASI_POINT_MAJOR:
+                quasi_order = true;
+                break;
+            default:
+                return false;
+        }
+        return quasi_order == (rng_type >= ROCRAND_RNG_QUASI_DEFAULT)
+            && (header.normal_method == ROCRAND_NORMAL_METHOD_BOX_MULLER
+                || header.normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT
+                || header.normal_method == ROCRAND_NORMAL_METHOD_INVERSION)
+            && (header.math_mode == ROCRAND_MATH_MODE_ACCURATE
+                || header.math_mode == ROCRAND_MATH_MODE_FAST)
+            && (header.double_resolution == ROCRAND_DOUBLE_RESOLUTION_DEFAULT
+                || header.double_resolution == ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT
+                || header.double_resolution == ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT)
+            && header.dimensions > 0;
+    }
+
+    // Copies the header of a saved state to the host and waits for it,
+    // the state must be saved by a generator of rng_type. Generators check
+    // their counters and the size of engines before they restore the header.
+    inline rocrand_status load_state_header(const void * state,
+                                            const rocrand_rng_type rng_type,
+                                            generator_state_header& header,
+                                            hipStream_t stream)
+    {
+        if(is_stream_capturing(stream))
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        if(hipMemcpyAsync(&header, state, sizeof(header), hipMemcpyDefault, stream) != hipSuccess
+            || hipStreamSynchronize(stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(header.magic != generator_state_magic || header.rng_type != rng_type
+            || !is_valid_state_header(header, rng_type))
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Enqueues the copy of engines of a saved state
+    inline rocrand_status load_state_engines(const void * state,
+                                             void * engines, const size_t engines_bytes,
+                                             hipStream_t stream)
+    {
+        const char * src = static_cast<const char *>(state) + sizeof(generator_state_header);
+        if(hipMemcpyAsync(engines, src, engines_bytes, hipMemcpyDefault, stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_GENERATOR_STATE_H_
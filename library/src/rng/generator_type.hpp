@@ -21,17 +21,226 @@
 #ifndef ROCRAND_RNG_GENERATOR_TYPE_H_
 #define ROCRAND_RNG_GENERATOR_TYPE_H_
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
+#include "allocator.hpp"
+#include "generator_state.hpp"
+#include "stream_leases.hpp"
+
+// Memory limit and statistics of the cache of Poisson tables of a generator
+// (see poisson_distribution_manager)
+struct poisson_cache_state
+{
+    size_t max_bytes;
+    unsigned long long hits;
+    unsigned long long misses;
+    // Host time of creation of tables (misses) in seconds
+    double build_time;
+};
+
+// Counters of a generator returned by rocrand_get_generator_stats()
+struct generator_stats_state
+{
+    // Numbers generated by kernels (or by host generators)
+    unsigned long long samples;
+    // Launches of generation and initialization kernels
+    unsigned long long launches;
+    // Initializations of engines or tables of the generator
+    unsigned long long inits;
+    // Host time of initializations in seconds
+    double init_time;
+};
+
+namespace rocrand_host {
+namespace detail {
+
+    // Function table of a device generator (see generator_dispatch.hpp)
+    struct generator_dispatch;
+
+    // Kernel launches are checked by hipPeekAtLastError() in builds without
+    // NDEBUG and when the ROCRAND_CHECK_LAUNCHES environment variable is set.
+    // Otherwise failures are reported by the next synchronization of the
+    // generator's stream, as failures of the kernels themselves are.
+    inline bool launch_checks_enabled()
+    {
+#ifndef NDEBUG
+        return true;
+#else
+        static const bool enabled = []() {
+            const char * value = std::getenv("ROCRAND_CHECK_LAUNCHES");
+            return value != NULL && value[0] != '\0' && std::strcmp(value, "0") != 0;
+        }();
+        return enabled;
+#endif
+    }
+
+    // Returns true if the last kernel launch failed (see launch_checks_enabled())
+    inline bool launch_failed()
+    {
+        return launch_checks_enabled() && hipPeekAtLastError() != hipSuccess;
+    }
+
+    // Name of a generator type in profiler ranges and telemetry
+    inline const char * rng_type_name(const rocrand_rng_type rng_type)
+    {
+        switch(rng_type)
+        {
+            case ROCRAND_RNG_PSEUDO_XORWOW: return "xorwow";
+            case ROCRAND_RNG_PSEUDO_MRG32K3A: return "mrg32k3a";
+            case ROCRAND_RNG_PSEUDO_MTGP32: return "mtgp32";
+            case ROCRAND_RNG_PSEUDO_PHILOX4_32_10: return "philox4x32_10";
+            case ROCRAND_RNG_PSEUDO_THREEFRY4_32_20: return "threefry4x32_20";
+            case ROCRAND_RNG_PSEUDO_THREEFRY2_64_20: return "threefry2x64_20";
+            case ROCRAND_RNG_PSEUDO_PHILOX4_64_10: return "philox4x64_10";
+            case ROCRAND_RNG_PSEUDO_XOSHIRO128PP: return "xoshiro128pp";
+            case ROCRAND_RNG_PSEUDO_PCG32: return "pcg32";
+            case ROCRAND_RNG_PSEUDO_MT19937: return "mt19937";
+            case ROCRAND_RNG_QUASI_SOBOL32: return "sobol32";
+            case ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32: return "scrambled_sobol32";
+            case ROCRAND_RNG_QUASI_SOBOL64: return "sobol64";
+            case ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64: return "scrambled_sobol64";
+            case ROCRAND_RNG_QUASI_LATTICE: return "lattice";
+            case ROCRAND_RNG_QUASI_HALTON: return "halton";
+            default: return "unknown";
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Default limit of memory used by cached Poisson tables of a generator
+constexpr size_t default_poisson_cache_bytes = 32 * 1024 * 1024;
+
 struct rocrand_generator_base_type
 {
-    rocrand_generator_base_type(rocrand_rng_type rng_type) : rng_type(rng_type) {}
+    rocrand_generator_base_type(rocrand_rng_type rng_type, bool host = false)
+        : rng_type(rng_type), host(host),
+          poisson_cache { default_poisson_cache_bytes, 0, 0, 0.0 },
+          stats { 0, 0, 0, 0.0 },
+          allocator(rocrand_host::detail::get_default_allocator()),
+          leases(NULL),
+          permutation_method(ROCRAND_PERMUTATION_METHOD_FEISTEL),
+          managed_hints(ROCRAND_MANAGED_HINT_PREFETCH),
+          ipc_state(NULL), ipc_state_size(0), dispatch(NULL) {}
     const rocrand_rng_type rng_type;
+    // Generator runs on the host and generates to host memory
+    const bool host;
+    // Set by rocrand_set_poisson_cache_size(), used by all generators
+    poisson_cache_state poisson_cache;
+    // Returned by rocrand_get_generator_stats()
+    generator_stats_state stats;
+    // Allocator of device memory (see rocrand_set_allocator()), memory of
+    // generators is allocated and freed on their stream
+    rocrand_host::detail::device_allocator allocator;
+    // Generators leased to streams (see rocrand_acquire_stream_generator()),
+    // created by the first lease
+    std::atomic<rocrand_host::detail::stream_leases *> leases;
+    // Set by rocrand_set_permutation_method(), used by rocrand_generate_permutation()
+    // and rocrand_shuffle()
+    rocrand_permutation_method permutation_method;
+    // Set by rocrand_set_managed_memory_hints(), flags of rocrand_managed_hint
+    // applied to output in managed memory
+    unsigned int managed_hints;
+    // State saved by rocrand_export_generator(), allocated by hipMalloc()
+    // (not by the allocator) because it is shared by an IPC handle
+    void * ipc_state;
+    size_t ipc_state_size;
+    // Function table of device generators, set when they are created,
+    // NULL for host generators
+    const rocrand_host::detail::generator_dispatch * dispatch;
 
-    virtual ~rocrand_generator_base_type() {}
+    // Returns leases of the generator, concurrent first calls create them once
+    rocrand_host::detail::stream_leases * get_leases()
+    {
+        rocrand_host::detail::stream_leases * current = leases.load(std::memory_order_acquire);
+        if(current != NULL)
+            return current;
+        rocrand_host::detail::stream_leases * created =
+            new(std::nothrow) rocrand_host::detail::stream_leases();
+        if(created == NULL)
+            return NULL;
+        if(!leases.compare_exchange_strong(current, created, std::memory_order_acq_rel))
+        {
+            delete created;
+            return current;
+        }
+        return created;
+    }
+
+    // Memory allocated before is freed by the allocator which allocated it,
+    // generators with engines reallocate them (see rocrand_xorwow)
+    rocrand_status set_allocator(const rocrand_host::detail::device_allocator& new_allocator)
+    {
+        allocator = new_allocator;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Counts a kernel launch which generates samples numbers
+    void count_launch(const size_t samples = 0)
+    {
+        stats.launches++;
+        stats.samples += samples;
+    }
+
+    virtual ~rocrand_generator_base_type()
+    {
+        delete leases.load();
+        if(ipc_state != NULL)
+            hipFree(ipc_state);
+    }
 };
 
+namespace rocrand_host {
+namespace detail {
+
+    // Adds the host time of its scope in seconds to total
+    class scoped_host_timer
+    {
+    public:
+        explicit scoped_host_timer(double& total)
+            : m_total(total), m_start(std::chrono::steady_clock::now()) {}
+
+        ~scoped_host_timer()
+        {
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - m_start;
+            m_total += elapsed.count();
+        }
+
+        scoped_host_timer(const scoped_host_timer&) = delete;
+        scoped_host_timer& operator=(const scoped_host_timer&) = delete;
+
+    private:
+        double& m_total;
+        const std::chrono::steady_clock::time_point m_start;
+    };
+
+    // Counts an initialization of a generator and its host time, placed
+    // at the beginning of init() after the check of initialized state
+    class init_stats_scope
+    {
+    public:
+        explicit init_stats_scope(generator_stats_state& stats)
+            : m_timer(stats.init_time)
+        {
+            stats.inits++;
+        }
+
+    private:
+        scoped_host_timer m_timer;
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
 // rocRAND random number generator base class
 template<rocrand_rng_type GeneratorType = ROCRAND_RNG_PSEUDO_PHILOX4_32_10>
 struct rocrand_generator_type : public rocrand_generator_base_type
@@ -42,7 +251,13 @@ struct rocrand_generator_type : public rocrand_generator_base_type
                            unsigned long long offset = 0,
                            hipStream_t stream = 0)
         : base_type(GeneratorType),
-          m_seed(seed), m_offset(offset), m_stream(stream)
+          m_order(GeneratorType >= ROCRAND_RNG_QUASI_DEFAULT
+                  ? ROCRAND_ORDERING_QUASI_DEFAULT
+                  : ROCRAND_ORDERING_PSEUDO_DEFAULT),
+          m_seed(seed), m_offset(offset), m_stream(stream),
+          m_normal_method(ROCRAND_NORMAL_METHOD_BOX_MULLER),
+          m_math_mode(ROCRAND_MATH_MODE_ACCURATE),
+          m_double_resolution(ROCRAND_DOUBLE_RESOLUTION_DEFAULT)
     {
 
     }
@@ -63,6 +278,26 @@ struct rocrand_generator_type : public rocrand_generator_base_type
         return m_offset;
     }
 
+    rocrand_ordering get_order() const
+    {
+        return m_order;
+    }
+
+    /// True if the generator uses the same grid on all devices, as before
+    /// orderings were added (ROCRAND_ORDERING_PSEUDO_DEFAULT and
+    /// ROCRAND_ORDERING_PSEUDO_LEGACY). The grid of other orderings is
+    /// chosen for the device.
+    bool legacy_order() const
+    {
+        return legacy_order(m_order);
+    }
+
+    static bool legacy_order(rocrand_ordering order)
+    {
+        return order == ROCRAND_ORDERING_PSEUDO_DEFAULT
+            || order == ROCRAND_ORDERING_PSEUDO_LEGACY;
+    }
+
     hipStream_t get_stream() const
     {
         return m_stream;
@@ -73,11 +308,109 @@ struct rocrand_generator_type : public rocrand_generator_base_type
         m_stream = stream;
     }
 
+    /// Returns true if work of the generator's stream is being captured
+    /// into a graph. Host-side setup (engine initialization, building of
+    /// tables) must not be captured, because it would be replayed or would
+    /// not be replayed at all, so it fails with ROCRAND_STATUS_LAUNCH_FAILURE.
+    bool is_capturing() const
+    {
+        hipStreamCaptureStatus status = hipStreamCaptureStatusNone;
+        return hipStreamIsCapturing(m_stream, &status) == hipSuccess
+            && status != hipStreamCaptureStatusNone;
+    }
+
+    rocrand_normal_method get_normal_method() const
+    {
+        return m_normal_method;
+    }
+
+    /// Normal generation does not depend on the state of the generator,
+    /// so the state is not reset.
+    rocrand_status set_normal_method(rocrand_normal_method method)
+    {
+        m_normal_method = method;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_math_mode get_math_mode() const
+    {
+        return m_math_mode;
+    }
+
+    /// Only transforms of numbers are changed, so the state is not reset.
+    rocrand_status set_math_mode(rocrand_math_mode mode)
+    {
+        m_math_mode = mode;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_double_resolution get_double_resolution() const
+    {
+        return m_double_resolution;
+    }
+
+    /// Only the number of consumed numbers per double is changed, the state
+    /// of the generator is not reset.
+    rocrand_status set_double_resolution(rocrand_double_resolution resolution)
+    {
+        m_double_resolution = resolution;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
 protected:
+    /// Returns the header of a state saved by save_state() of the generator
+    /// with settings of the base type, generators add their counters.
+    rocrand_host::detail::generator_state_header make_state_header() const
+    {
+        rocrand_host::detail::generator_state_header header = {};
+        header.magic = rocrand_host::detail::generator_state_magic;
+        header.rng_type = rng_type;
+        header.order = m_order;
+        header.normal_method = m_normal_method;
+        header.math_mode = m_math_mode;
+        header.double_resolution = m_double_resolution;
+        header.dimensions = 1;
+        header.seed = m_seed;
+        header.offset = m_offset;
+        return header;
+    }
+
+    /// Restores settings of the base type from the header of a loaded state.
+    void restore_state_settings(const rocrand_host::detail::generator_state_header& header)
+    {
+        m_order = header.order;
+        m_normal_method = header.normal_method;
+        m_math_mode = header.math_mode;
+        m_double_resolution = header.double_resolution;
+        m_seed = header.seed;
+        m_offset = header.offset;
+    }
+
+    /// Copies settings of \p parent to a child generator created by
+    /// rocrand_fork_generator(), the allocator is set by the child.
+    void copy_settings(const rocrand_generator_type& parent)
+    {
+        m_order = parent.m_order;
+        m_normal_method = parent.m_normal_method;
+        m_math_mode = parent.m_math_mode;
+        m_double_resolution = parent.m_double_resolution;
+        m_seed = parent.m_seed;
+        m_offset = parent.m_offset;
+        m_stream = parent.m_stream;
+        poisson_cache.max_bytes = parent.poisson_cache.max_bytes;
+    }
+
     // ordering type
+    rocrand_ordering m_order;
     unsigned long long m_seed;
     unsigned long long m_offset;
     hipStream_t m_stream;
+    // method of normal and log-normal generation (pseudo-random generators)
+    rocrand_normal_method m_normal_method;
+    // precision of transcendental functions of distributions
+    rocrand_math_mode m_math_mode;
+    // numbers per uniformly distributed double (pseudo-random generators)
+    rocrand_double_resolution m_double_resolution;
 };
 
 #endif // ROCRAND_RNG_GENERATOR_TYPE_H_
@@ -24,7 +24,13 @@
 #include "philox4x32_10.hpp"
 #include "mrg32k3a.hpp"
 #include "xorwow.hpp"
+#include "small_state.hpp"
 #include "sobol32.hpp"
+#include "scrambled_sobol32.hpp"
+#include "sobol64.hpp"
+#include "scrambled_sobol64.hpp"
 #include "mtgp32.hpp"
+#include "mt19937.hpp"
+#include "lattice_halton.hpp"
 
 #endif // ROCRAND_RNG_GENERATORS_H_
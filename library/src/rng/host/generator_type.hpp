@@ -0,0 +1,270 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_HOST_GENERATOR_TYPE_H_
+#define ROCRAND_RNG_HOST_GENERATOR_TYPE_H_
+
+#include <algorithm>
+#include <cstddef>
+
+#include <rocrand.h>
+
+#include "../generator_type.hpp"
+#include "thread_pool.hpp"
+
+// Base class of host generators, rocrand.cpp calls host generators
+// through this interface instead of dispatching on rng_type
+struct rocrand_host_generator_base_type : public rocrand_generator_base_type
+{
+    rocrand_host_generator_base_type(rocrand_rng_type rng_type,
+                                     unsigned long long seed,
+                                     unsigned long long offset)
+        : rocrand_generator_base_type(rng_type, true),
+          m_seed(seed), m_offset(offset)
+    {
+
+    }
+
+    unsigned long long get_seed() const
+    {
+        return m_seed;
+    }
+
+    unsigned long long get_offset() const
+    {
+        return m_offset;
+    }
+
+    virtual rocrand_status init() = 0;
+    virtual rocrand_status set_seed(unsigned long long seed) = 0;
+    virtual rocrand_status set_offset(unsigned long long offset) = 0;
+    virtual rocrand_status set_dimensions(unsigned int dimensions) = 0;
+    virtual rocrand_status set_order(rocrand_ordering order) = 0;
+    virtual rocrand_status set_engine_count(unsigned int engine_count) = 0;
+    // Returns the number of bytes of host memory allocated by the generator
+    virtual size_t get_memory_usage() const = 0;
+
+    virtual rocrand_status generate(unsigned int * data, size_t data_size) = 0;
+    virtual rocrand_status generate_range(unsigned int * data,
+                                          unsigned long long start,
+                                          size_t data_size) = 0;
+    virtual rocrand_status generate_uniform(float * data, size_t data_size) = 0;
+    virtual rocrand_status generate_uniform(double * data, size_t data_size) = 0;
+    virtual rocrand_status generate_normal(float * data, size_t data_size,
+                                           float mean, float stddev) = 0;
+    virtual rocrand_status generate_normal(double * data, size_t data_size,
+                                           double mean, double stddev) = 0;
+    virtual rocrand_status generate_log_normal(float * data, size_t data_size,
+                                               float mean, float stddev) = 0;
+    virtual rocrand_status generate_log_normal(double * data, size_t data_size,
+                                               double mean, double stddev) = 0;
+    virtual rocrand_status generate_poisson(unsigned int * data, size_t data_size,
+                                            double lambda) = 0;
+
+protected:
+    unsigned long long m_seed;
+    unsigned long long m_offset;
+};
+
+// Implements the interface of host generators using templated functions
+// of Derived, which mirror the functions of device generators.
+//
+// Derived must provide init_impl(), set_seed_impl(), set_offset_impl(),
+// set_dimensions_impl(), set_order_impl(), set_engine_count_impl(),
+// get_memory_usage_impl(), generate_uniform_impl<T>()
+// (also used for unsigned int), generate_range_impl(), generate_normal_impl<T>(),
+// generate_log_normal_impl<T>() and generate_poisson_impl().
+template<class Derived, rocrand_rng_type GeneratorType>
+struct rocrand_host_generator_type : public rocrand_host_generator_base_type
+{
+    using base_type = rocrand_host_generator_base_type;
+
+    rocrand_host_generator_type(unsigned long long seed = 0,
+                                unsigned long long offset = 0)
+        : base_type(GeneratorType, seed, offset)
+    {
+
+    }
+
+    /// Return generator's type
+    constexpr rocrand_rng_type type() const
+    {
+        return rng_type;
+    }
+
+    rocrand_status init() override
+    {
+        return derived().init_impl();
+    }
+
+    rocrand_status set_seed(unsigned long long seed) override
+    {
+        return derived().set_seed_impl(seed);
+    }
+
+    rocrand_status set_offset(unsigned long long offset) override
+    {
+        return derived().set_offset_impl(offset);
+    }
+
+    rocrand_status set_dimensions(unsigned int dimensions) override
+    {
+        return derived().set_dimensions_impl(dimensions);
+    }
+
+    // Host generators use the legacy ordering or the device-independent
+    // ordering, all other orderings with the same results are accepted
+    rocrand_status set_order(rocrand_ordering order) override
+    {
+        if(order == ROCRAND_ORDERING_PSEUDO_SEEDED
+            || order == ROCRAND_ORDERING_QUASI_POINT_MAJOR)
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        return derived().set_order_impl(order);
+    }
+
+    rocrand_status set_engine_count(unsigned int engine_count) override
+    {
+        return derived().set_engine_count_impl(engine_count);
+    }
+
+    size_t get_memory_usage() const override
+    {
+        return derived().get_memory_usage_impl();
+    }
+
+    rocrand_status generate(unsigned int * data, size_t data_size) override
+    {
+        return count_samples(
+            derived().template generate_uniform_impl<unsigned int>(data, data_size), data_size);
+    }
+
+    rocrand_status generate_range(unsigned int * data,
+                                  unsigned long long start,
+                                  size_t data_size) override
+    {
+        return count_samples(
+            derived().generate_range_impl(data, start, data_size), data_size);
+    }
+
+    rocrand_status generate_uniform(float * data, size_t data_size) override
+    {
+        return count_samples(
+            derived().template generate_uniform_impl<float>(data, data_size), data_size);
+    }
+
+    rocrand_status generate_uniform(double * data, size_t data_size) override
+    {
+        return count_samples(
+            derived().template generate_uniform_impl<double>(data, data_size), data_size);
+    }
+
+    rocrand_status generate_normal(float * data, size_t data_size,
+                                   float mean, float stddev) override
+    {
+        return count_samples(
+            derived().template generate_normal_impl<float>(data, data_size, mean, stddev), data_size);
+    }
+
+    rocrand_status generate_normal(double * data, size_t data_size,
+                                   double mean, double stddev) override
+    {
+        return count_samples(
+            derived().template generate_normal_impl<double>(data, data_size, mean, stddev), data_size);
+    }
+
+    rocrand_status generate_log_normal(float * data, size_t data_size,
+                                       float mean, float stddev) override
+    {
+        return count_samples(
+            derived().template generate_log_normal_impl<float>(data, data_size, mean, stddev), data_size);
+    }
+
+    rocrand_status generate_log_normal(double * data, size_t data_size,
+                                       double mean, double stddev) override
+    {
+        return count_samples(
+            derived().template generate_log_normal_impl<double>(data, data_size, mean, stddev), data_size);
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size,
+                                    double lambda) override
+    {
+        return count_samples(
+            derived().generate_poisson_impl(data, data_size, lambda), data_size);
+    }
+
+private:
+    // Counts the numbers of a successful generation
+    rocrand_status count_samples(const rocrand_status status, const size_t data_size)
+    {
+        if(status == ROCRAND_STATUS_SUCCESS)
+            stats.samples += data_size;
+        return status;
+    }
+
+    Derived& derived()
+    {
+        return *static_cast<Derived *>(this);
+    }
+
+    const Derived& derived() const
+    {
+        return *static_cast<const Derived *>(this);
+    }
+};
+
+namespace rocrand_host {
+namespace detail {
+
+// Runs f(engine_id, row, size) for all engines of a generator with the
+// layout of the device generate kernels: numbers of engine_id-th engine
+// are stored at engine_id + k * engines (row_size elements per k).
+// f generates numbers of [row, row + size) elements, engines are split
+// between threads and numbers are generated in tiles of rows, so stores
+// of neighbouring engines are close in memory.
+template<class Function>
+inline void parallel_for_engines(const size_t engines,
+                                 const size_t row_size,
+                                 const size_t n,
+                                 Function f)
+{
+    constexpr size_t tile_rows = 64;
+    thread_pool::instance().parallel_for(
+        engines, 256,
+        [&](size_t begin, size_t end)
+        {
+            for(size_t row = 0; row < n; row += tile_rows * row_size)
+            {
+                const size_t size = std::min(n - row, tile_rows * row_size);
+                for(size_t engine_id = begin; engine_id < end; engine_id++)
+                {
+                    f(engine_id, row, size);
+                }
+            }
+        }
+    );
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_HOST_GENERATOR_TYPE_H_
@@ -0,0 +1,265 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_HOST_MTGP32_H_
+#define ROCRAND_RNG_HOST_MTGP32_H_
+
+#include <algorithm>
+#include <vector>
+
+#include <rocrand.h>
+#include <rocrand_mtgp32_11213.h>
+
+#include "generator_type.hpp"
+#include "thread_pool.hpp"
+#include "../mtgp32.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Computes on the host the numbers generated by all threads of a block
+    // in one call of mtgp32_engine::next()
+    struct mtgp32_host_engine : public ::rocrand_device::mtgp32_engine
+    {
+        // Threads of a block (hipBlockDim_x) of the device generator, it is
+        // always used by the orderings which do not depend on the device
+        static const unsigned int block_size = 256;
+
+        void next_block(unsigned int * values)
+        {
+            // Threads are emulated in order, the recursion guarantees that
+            // numbers read by a thread are not written by other threads
+            // of the same step
+            const int pos = pos_tbl;
+            const int offset = m_state.offset;
+            for(unsigned int t = 0; t < block_size; t++)
+            {
+                const unsigned int r =
+                    para_rec(m_state.status[(t + offset) & MTGP_MASK],
+                             m_state.status[(t + offset + 1) & MTGP_MASK],
+                             m_state.status[(t + offset + pos) & MTGP_MASK]);
+                m_state.status[(t + offset + MTGP_N) & MTGP_MASK] = r;
+                values[t] = temper(r, m_state.status[(t + offset + pos - 1) & MTGP_MASK]);
+            }
+            m_state.offset = (offset + block_size) & MTGP_MASK;
+        }
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Host generator, produces the same sequences as rocrand_mtgp32
+// with the default grid (s_blocks engines) or with the device-independent ordering
+class rocrand_mtgp32_host
+    : public rocrand_host_generator_type<rocrand_mtgp32_host, ROCRAND_RNG_PSEUDO_MTGP32>
+{
+public:
+    using base_type = rocrand_host_generator_type<rocrand_mtgp32_host, ROCRAND_RNG_PSEUDO_MTGP32>;
+    using engine_type = ::rocrand_host::detail::mtgp32_host_engine;
+
+    rocrand_mtgp32_host(unsigned long long seed = 0,
+                        unsigned long long offset = 0)
+        : base_type(seed, offset),
+          m_engines_initialized(false), m_engines(s_blocks),
+          m_order(ROCRAND_ORDERING_PSEUDO_DEFAULT), m_engine_count(0)
+    {
+
+    }
+
+    rocrand_status set_seed_impl(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Offset is not supported by MTGP32
+    rocrand_status set_offset_impl(unsigned long long)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status set_dimensions_impl(unsigned int)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status set_order_impl(rocrand_ordering order)
+    {
+        m_order = order;
+        resize_engines();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_engine_count_impl(unsigned int engine_count)
+    {
+        if(engine_count > MTGP_BN_MAX)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_engine_count = engine_count;
+        resize_engines();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    size_t get_memory_usage_impl() const
+    {
+        return sizeof(engine_type) * m_engines.size() + m_poisson.memory_usage();
+    }
+
+    rocrand_status init_impl()
+    {
+        if (m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+        rocrand_host::detail::init_stats_scope init_scope(stats);
+
+        // Same seeds as rocrand_make_state_mtgp32
+        const unsigned long long seed = m_seed ^ (m_seed >> 32);
+        for(size_t i = 0; i < m_engines.size(); i++)
+        {
+            rocrand_device::rocrand_mtgp32_init_engine(
+                m_engines[i], mtgp32dc_params_fast_11213,
+                static_cast<int>(i), (unsigned int)seed + i + 1
+            );
+        }
+
+        m_engines_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        rocrand_status status = init_impl();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        // Group g of block_size numbers (index = g * block_size + t) is
+        // generated by engine g % engines, all numbers of the last group
+        // are generated but only the first ones stored
+        constexpr size_t block_size = engine_type::block_size;
+        const size_t engines = m_engines.size();
+        const size_t groups = (data_size + block_size - 1) / block_size;
+        rocrand_host::detail::thread_pool::instance().parallel_for(
+            engines, 1,
+            [&](size_t begin, size_t end)
+            {
+                Distribution chunk_distribution = distribution;
+                unsigned int values[block_size];
+                for(size_t engine_id = begin; engine_id < end; engine_id++)
+                {
+                    engine_type& engine = m_engines[engine_id];
+                    for(size_t g = engine_id; g < groups; g += engines)
+                    {
+                        engine.next_block(values);
+                        const size_t index = g * block_size;
+                        const size_t size = std::min(block_size, data_size - index);
+                        for(size_t t = 0; t < size; t++)
+                        {
+                            data[index + t] = chunk_distribution(values[t]);
+                        }
+                    }
+                }
+            }
+        );
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // MTGP32 does not support skipping ahead (as rocrand_mtgp32)
+    rocrand_status generate_range_impl(unsigned int *, unsigned long long, size_t)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_impl(T * data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal_impl(T * data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal_impl(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson_impl(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda, poisson_cache);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+private:
+    bool m_engines_initialized;
+    std::vector<engine_type> m_engines;
+    rocrand_ordering m_order;
+    // Number of engines set by set_engine_count(), 0 if not set
+    unsigned int m_engine_count;
+
+    // Default grid of rocrand_mtgp32
+    #ifdef __HIP_PLATFORM_NVCC__
+    static const uint32_t s_blocks = 64;
+    #else
+    static const uint32_t s_blocks = 512;
+    #endif
+
+    // Cache of Poisson tables of recently used lambdas
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> m_poisson;
+
+    // Same number of engines as rocrand_mtgp32
+    void resize_engines()
+    {
+        const size_t engines_size =
+            m_engine_count != 0
+                ? size_t(m_engine_count)
+                : m_order == ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT
+                    ? size_t(rocrand_mtgp32::device_independent_engines)
+                    : size_t(s_blocks);
+        if(engines_size != m_engines.size())
+        {
+            m_engines.resize(engines_size);
+            m_engines_initialized = false;
+        }
+    }
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_HOST_MTGP32_H_
@@ -0,0 +1,580 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_HOST_PHILOX4X32_10_H_
+#define ROCRAND_RNG_HOST_PHILOX4X32_10_H_
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+#include "thread_pool.hpp"
+#include "../philox4x32_10.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) \
+    && !defined(__HIP_DEVICE_COMPILE__) && !defined(__CUDACC__)
+    #define ROCRAND_HOST_SIMD_X86
+    #include <immintrin.h>
+#endif
+
+namespace rocrand_host {
+namespace detail {
+
+    // Computes 10 Philox rounds for count consecutive counters starting
+    // from counter (subsequence 0): out[i] = ten_rounds(counter + i, key).
+    inline void philox4x32_10_blocks_scalar(const uint2 key,
+                                            const unsigned long long counter,
+                                            const size_t count,
+                                            uint4 * out)
+    {
+        for(size_t i = 0; i < count; i++)
+        {
+            const unsigned long long c = counter + i;
+            out[i] = ::rocrand_device::detail::philox4x32_10_ten_rounds(
+                uint4 { static_cast<unsigned int>(c), static_cast<unsigned int>(c >> 32), 0, 0 },
+                key
+            );
+        }
+    }
+
+#ifdef ROCRAND_HOST_SIMD_X86
+
+    // Vectorized versions process Lanes counters at once, lane j of x0..x3
+    // contains the j-th component of the state of the j-th counter.
+
+    __attribute__((target("avx2")))
+    inline __m256i philox4x32_10_mulhi_avx2(const __m256i a, const __m256i m)
+    {
+        // 64-bit products of even and odd lanes, high halves are blended
+        const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(a, m), 32);
+        const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+        return _mm256_blend_epi32(even, odd, 0xAA);
+    }
+
+    __attribute__((target("avx2")))
+    inline void philox4x32_10_blocks_avx2(const uint2 key,
+                                          const unsigned long long counter,
+                                          const size_t count,
+                                          uint4 * out)
+    {
+        constexpr size_t lanes = 8;
+        const __m256i m0 = _mm256_set1_epi32(static_cast<int>(ROCRAND_PHILOX_M4x32_0));
+        const __m256i m1 = _mm256_set1_epi32(static_cast<int>(ROCRAND_PHILOX_M4x32_1));
+
+        size_t i = 0;
+        for(; i + lanes <= count; i += lanes)
+        {
+            alignas(32) unsigned int c0[lanes];
+            alignas(32) unsigned int c1[lanes];
+            for(size_t j = 0; j < lanes; j++)
+            {
+                const unsigned long long c = counter + i + j;
+                c0[j] = static_cast<unsigned int>(c);
+                c1[j] = static_cast<unsigned int>(c >> 32);
+            }
+            __m256i x0 = _mm256_load_si256(reinterpret_cast<const __m256i *>(c0));
+            __m256i x1 = _mm256_load_si256(reinterpret_cast<const __m256i *>(c1));
+            __m256i x2 = _mm256_setzero_si256();
+            __m256i x3 = _mm256_setzero_si256();
+            uint2 k = key;
+            for(int round = 0; round < 10; round++)
+            {
+                const __m256i k0 = _mm256_set1_epi32(static_cast<int>(k.x));
+                const __m256i k1 = _mm256_set1_epi32(static_cast<int>(k.y));
+                const __m256i hi0 = philox4x32_10_mulhi_avx2(x0, m0);
+                const __m256i hi1 = philox4x32_10_mulhi_avx2(x2, m1);
+                const __m256i lo0 = _mm256_mullo_epi32(x0, m0);
+                const __m256i lo1 = _mm256_mullo_epi32(x2, m1);
+                x0 = _mm256_xor_si256(_mm256_xor_si256(hi1, x1), k0);
+                x1 = lo1;
+                x2 = _mm256_xor_si256(_mm256_xor_si256(hi0, x3), k1);
+                x3 = lo0;
+                k = ::rocrand_device::detail::philox4x32_10_bumpkey(k);
+            }
+            alignas(32) unsigned int r[4][lanes];
+            _mm256_store_si256(reinterpret_cast<__m256i *>(r[0]), x0);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(r[1]), x1);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(r[2]), x2);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(r[3]), x3);
+            for(size_t j = 0; j < lanes; j++)
+            {
+                out[i + j] = uint4 { r[0][j], r[1][j], r[2][j], r[3][j] };
+            }
+        }
+        philox4x32_10_blocks_scalar(key, counter + i, count - i, out + i);
+    }
+
+    __attribute__((target("avx512f")))
+    inline __m512i philox4x32_10_mulhi_avx512(const __m512i a, const __m512i m)
+    {
+        const __m512i even = _mm512_srli_epi64(_mm512_mul_epu32(a, m), 32);
+        const __m512i odd = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), m);
+        return _mm512_mask_blend_epi32(0xAAAA, even, odd);
+    }
+
+    __attribute__((target("avx512f")))
+    inline void philox4x32_10_blocks_avx512(const uint2 key,
+                                            const unsigned long long counter,
+                                            const size_t count,
+                                            uint4 * out)
+    {
+        constexpr size_t lanes = 16;
+        const __m512i m0 = _mm512_set1_epi32(static_cast<int>(ROCRAND_PHILOX_M4x32_0));
+        const __m512i m1 = _mm512_set1_epi32(static_cast<int>(ROCRAND_PHILOX_M4x32_1));
+
+        size_t i = 0;
+        for(; i + lanes <= count; i += lanes)
+        {
+            alignas(64) unsigned int c0[lanes];
+            alignas(64) unsigned int c1[lanes];
+            for(size_t j = 0; j < lanes; j++)
+            {
+                const unsigned long long c = counter + i + j;
+                c0[j] = static_cast<unsigned int>(c);
+                c1[j] = static_cast<unsigned int>(c >> 32);
+            }
+            __m512i x0 = _mm512_load_si512(c0);
+            __m512i x1 = _mm512_load_si512(c1);
+            __m512i x2 = _mm512_setzero_si512();
+            __m512i x3 = _mm512_setzero_si512();
+            uint2 k = key;
+            for(int round = 0; round < 10; round++)
+            {
+                const __m512i k0 = _mm512_set1_epi32(static_cast<int>(k.x));
+                const __m512i k1 = _mm512_set1_epi32(static_cast<int>(k.y));
+                const __m512i hi0 = philox4x32_10_mulhi_avx512(x0, m0);
+                const __m512i hi1 = philox4x32_10_mulhi_avx512(x2, m1);
+                const __m512i lo0 = _mm512_mullo_epi32(x0, m0);
+                const __m512i lo1 = _mm512_mullo_epi32(x2, m1);
+                x0 = _mm512_xor_si512(_mm512_xor_si512(hi1, x1), k0);
+                x1 = lo1;
+                x2 = _mm512_xor_si512(_mm512_xor_si512(hi0, x3), k1);
+                x3 = lo0;
+                k = ::rocrand_device::detail::philox4x32_10_bumpkey(k);
+            }
+            alignas(64) unsigned int r[4][lanes];
+            _mm512_store_si512(r[0], x0);
+            _mm512_store_si512(r[1], x1);
+            _mm512_store_si512(r[2], x2);
+            _mm512_store_si512(r[3], x3);
+            for(size_t j = 0; j < lanes; j++)
+            {
+                out[i + j] = uint4 { r[0][j], r[1][j], r[2][j], r[3][j] };
+            }
+        }
+        philox4x32_10_blocks_scalar(key, counter + i, count - i, out + i);
+    }
+
+#endif // ROCRAND_HOST_SIMD_X86
+
+    typedef void (*philox4x32_10_blocks_type)(const uint2, const unsigned long long,
+                                              const size_t, uint4 *);
+
+    // Selects the widest implementation supported by the CPU
+    inline philox4x32_10_blocks_type get_philox4x32_10_blocks()
+    {
+        #ifdef ROCRAND_HOST_SIMD_X86
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f"))
+            return philox4x32_10_blocks_avx512;
+        if(__builtin_cpu_supports("avx2"))
+            return philox4x32_10_blocks_avx2;
+        #endif
+        return philox4x32_10_blocks_scalar;
+    }
+
+    inline void philox4x32_10_blocks(const uint2 key,
+                                     const unsigned long long counter,
+                                     const size_t count,
+                                     uint4 * out)
+    {
+        static const philox4x32_10_blocks_type blocks = get_philox4x32_10_blocks();
+        blocks(key, counter, count, out);
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Host generator, produces the same sequences as rocrand_philox4x32_10,
+// with engines of the legacy orderings (16 threads per engine of the
+// default grid) or counter-based with other orderings
+class rocrand_philox4x32_10_host
+    : public rocrand_host_generator_type<rocrand_philox4x32_10_host, ROCRAND_RNG_PSEUDO_PHILOX4_32_10>
+{
+public:
+    using base_type = rocrand_host_generator_type<rocrand_philox4x32_10_host, ROCRAND_RNG_PSEUDO_PHILOX4_32_10>;
+    using engine_type = ::rocrand_host::detail::philox4x32_10_device_engine;
+
+    rocrand_philox4x32_10_host(unsigned long long seed = 0,
+                               unsigned long long offset = 0)
+        : base_type(seed, offset),
+          m_position(0),
+          m_order(ROCRAND_ORDERING_PSEUDO_DEFAULT),
+          m_engines_initialized(false)
+    {
+
+    }
+
+    rocrand_status set_seed_impl(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_position = 0;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_offset_impl(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_position = 0;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_dimensions_impl(unsigned int)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    // Results of counter-based orderings do not depend on the ordering,
+    // the legacy orderings use engines
+    rocrand_status set_order_impl(rocrand_ordering order)
+    {
+        m_order = order;
+        m_position = 0;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // The number of engines of the legacy orderings is fixed
+    rocrand_status set_engine_count_impl(unsigned int)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    size_t get_memory_usage_impl() const
+    {
+        return sizeof(engine_type) * m_engines.size() + m_poisson.memory_usage();
+    }
+
+    rocrand_status init_impl()
+    {
+        if(!use_engines() || m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+        rocrand_host::detail::init_stats_scope init_scope(stats);
+
+        m_engines.resize(s_threads * s_blocks / s_threads_per_engine);
+        rocrand_host::detail::thread_pool::instance().parallel_for(
+            m_engines.size(), 64,
+            [&](size_t begin, size_t end)
+            {
+                for(size_t engine_id = begin; engine_id < end; engine_id++)
+                {
+                    m_engines[engine_id] = engine_type(m_seed, engine_id, m_offset);
+                }
+            }
+        );
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        // TypeX can be uint4, float4, double2
+        typedef decltype(std::declval<Distribution&>()(uint4())) TypeX;
+        constexpr unsigned int x = sizeof(TypeX) / sizeof(T);
+
+        if(use_engines())
+        {
+            rocrand_status status = init_impl();
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            generate_engines(data, data_size, distribution);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        generate_at(m_offset + m_position, data, data_size, distribution);
+
+        // Every started group of numbers is consumed
+        m_position += 4 * ((data_size + x - 1) / x);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Numbers are computed directly from their counters, not available
+    // with engines of the legacy orderings
+    rocrand_status generate_range_impl(unsigned int * data,
+                                       unsigned long long start,
+                                       size_t data_size)
+    {
+        if(use_engines())
+            return ROCRAND_STATUS_TYPE_ERROR;
+        uniform_distribution<unsigned int> udistribution;
+        generate_at(m_offset + start, data, data_size, udistribution);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_impl(T * data, size_t data_size)
+    {
+        uniform_distribution<T> udistribution;
+        return generate(data, data_size, udistribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal_impl(T * data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal_impl(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson_impl(unsigned int * data, size_t data_size, double lambda)
+    {
+        // Large lambda: rejection as on the device, no tables are built
+        if(lambda >= rocrand_device::detail::lambda_threshold_small)
+        {
+            poisson_rejection_distribution distribution(lambda);
+            return generate_rejection(data, data_size,
+                                      make_rejection_distribution<unsigned int>(distribution));
+        }
+
+        try
+        {
+            m_poisson.set_lambda(lambda, poisson_cache);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        typedef rocrand_host::detail::philox4x32_10_distribution4<
+            decltype(m_poisson.dis)
+        > distribution_type;
+        return generate(data, data_size, distribution_type { m_poisson.dis });
+    }
+
+private:
+    // Number of random numbers generated since the last reset
+    unsigned long long m_position;
+    rocrand_ordering m_order;
+    bool m_engines_initialized;
+    std::vector<engine_type> m_engines;
+
+    // Number of groups of 4 numbers computed at once by a thread
+    static const size_t s_block_size = 256;
+
+    // Grid of engines of rocrand_philox4x32_10 with the legacy orderings
+    static const uint32_t s_threads = 256;
+    static const uint32_t s_blocks = 1024;
+    static const uint32_t s_threads_per_engine = 16;
+
+    bool use_engines() const
+    {
+        return m_order == ROCRAND_ORDERING_PSEUDO_DEFAULT
+            || m_order == ROCRAND_ORDERING_PSEUDO_LEGACY;
+    }
+
+    // Same key as rocrand_philox4x32_10::counter_key()
+    uint2 counter_key() const
+    {
+        const unsigned long long key = use_engines()
+            ? ::rocrand_device::detail::splitmix64_seed(m_seed, ~0ULL)
+            : m_seed;
+        return uint2 {
+            static_cast<unsigned int>(key),
+            static_cast<unsigned int>(key >> 32)
+        };
+    }
+
+    // Same numbers as generate_legacy_kernel, every thread of the kernel
+    // is computed by the task of its engine
+    template<class T, class Distribution>
+    void generate_engines(T * data, size_t data_size,
+                          const Distribution& distribution)
+    {
+        typedef decltype(std::declval<Distribution&>()(uint4())) TypeX;
+        constexpr unsigned int x = sizeof(TypeX) / sizeof(T);
+        const size_t stride = s_threads * s_blocks;
+        const size_t vectors = data_size / x;
+        const size_t tail_size = data_size % x;
+
+        rocrand_host::detail::thread_pool::instance().parallel_for(
+            m_engines.size(), 64,
+            [&](size_t begin, size_t end)
+            {
+                for(size_t engine_id = begin; engine_id < end; engine_id++)
+                {
+                    engine_type smallest_engine;
+                    size_t smallest_last = stride;
+                    for(unsigned int lane = 0; lane < s_threads_per_engine; lane++)
+                    {
+                        Distribution thread_distribution = distribution;
+                        engine_type engine = m_engines[engine_id];
+                        if(lane > 0)
+                        {
+                            engine.discard(4 * lane);
+                        }
+                        size_t index = engine_id * s_threads_per_engine + lane;
+                        while(index < vectors)
+                        {
+                            const TypeX result =
+                                thread_distribution(engine.next4_leap(s_threads_per_engine));
+                            std::memcpy(data + index * x, &result, sizeof(TypeX));
+                            index += stride;
+                        }
+                        if(index == vectors && tail_size > 0)
+                        {
+                            const TypeX result = thread_distribution(engine.next4());
+                            std::memcpy(data + index * x, &result, sizeof(T) * tail_size);
+                        }
+                        if(index - vectors < smallest_last)
+                        {
+                            smallest_last = index - vectors;
+                            smallest_engine = engine;
+                        }
+                    }
+                    m_engines[engine_id] = smallest_engine;
+                }
+            }
+        );
+    }
+
+    // Cache of Poisson tables of recently used lambdas
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> m_poisson;
+
+    template<class T, class Distribution>
+    void generate_at(const unsigned long long position,
+                     T * data, size_t data_size,
+                     const Distribution& distribution)
+    {
+        // TypeX can be uint4, float4, double2
+        typedef decltype(std::declval<Distribution&>()(uint4())) TypeX;
+        constexpr unsigned int x = sizeof(TypeX) / sizeof(T);
+
+        const unsigned long long counter = position / 4;
+        const unsigned int substate = static_cast<unsigned int>(position % 4);
+        const uint2 key = counter_key();
+
+        const size_t vectors = (data_size + x - 1) / x;
+        rocrand_host::detail::thread_pool::instance().parallel_for(
+            vectors, s_block_size,
+            [&](size_t begin, size_t end)
+            {
+                // Distributions with state (Box-Muller) are copied per chunk
+                Distribution chunk_distribution = distribution;
+                uint4 raw[s_block_size + 1];
+                for(size_t block = begin; block < end; block += s_block_size)
+                {
+                    const size_t count = std::min(static_cast<size_t>(s_block_size), end - block);
+                    // Numbers of one vector span two blocks when substate != 0
+                    rocrand_host::detail::philox4x32_10_blocks(
+                        key, counter + block, count + (substate != 0 ? 1 : 0), raw
+                    );
+                    for(size_t i = 0; i < count; i++)
+                    {
+                        const uint4 r = substate == 0
+                            ? raw[i]
+                            : rocrand_host::detail::philox4x32_10_combine(raw[i], raw[i + 1], substate);
+                        const TypeX result = chunk_distribution(r);
+                        const size_t index = (block + i) * x;
+                        // The tail stores only last 1,..,(x-1) numbers
+                        const size_t size = std::min<size_t>(x, data_size - index);
+                        std::memcpy(data + index, &result, sizeof(T) * size);
+                    }
+                }
+            }
+        );
+    }
+
+    // Values of distributions with rejection (as generate_rejection_kernel of
+    // rocrand_philox4x32_10), every started group of 4 numbers is consumed
+    // regardless of rejections
+    template<class T, class Distribution>
+    rocrand_status generate_rejection(T * data, size_t data_size,
+                                      const rejection_distribution<T, Distribution>& distribution)
+    {
+        // count can be 1 or 2 (numbers per value), x can be 4 or 2
+        constexpr unsigned int count = sizeof(T) / sizeof(unsigned int);
+        constexpr unsigned int x = 4 / count;
+
+        const unsigned long long position = m_offset + m_position;
+        const unsigned long long counter = position / 4;
+        const unsigned int substate = static_cast<unsigned int>(position % 4);
+        const uint2 key = counter_key();
+
+        const size_t groups = (data_size + x - 1) / x;
+        rocrand_host::detail::thread_pool::instance().parallel_for(
+            groups, s_block_size,
+            [&](size_t begin, size_t end)
+            {
+                uint4 raw[s_block_size + 1];
+                for(size_t block = begin; block < end; block += s_block_size)
+                {
+                    const size_t size = std::min(static_cast<size_t>(s_block_size), end - block);
+                    rocrand_host::detail::philox4x32_10_blocks(
+                        key, counter + block, size + (substate != 0 ? 1 : 0), raw
+                    );
+                    for(size_t i = 0; i < size; i++)
+                    {
+                        const uint4 v = substate == 0
+                            ? raw[i]
+                            : rocrand_host::detail::philox4x32_10_combine(raw[i], raw[i + 1], substate);
+                        const size_t index = block + i;
+                        for(unsigned int lane = 0; lane < x; lane++)
+                        {
+                            if(index * x + lane < data_size)
+                            {
+                                rocrand_host::detail::philox4x32_10_rejection_engine engine(
+                                    v, key, counter + index, lane, count
+                                );
+                                T value;
+                                while(!distribution(engine, value, index * x + lane)) { }
+                                data[index * x + lane] = value;
+                            }
+                        }
+                    }
+                }
+            }
+        );
+
+        m_position += 4 * groups;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_HOST_PHILOX4X32_10_H_
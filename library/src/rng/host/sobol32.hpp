@@ -0,0 +1,203 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_HOST_SOBOL32_H_
+#define ROCRAND_RNG_HOST_SOBOL32_H_
+
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+#include "thread_pool.hpp"
+#include "../sobol_host_tables.hpp"
+#include "../sobol32.hpp"
+
+// Host generator, produces the same sequences as rocrand_sobol32
+class rocrand_sobol32_host
+    : public rocrand_host_generator_type<rocrand_sobol32_host, ROCRAND_RNG_QUASI_SOBOL32>
+{
+public:
+    using base_type = rocrand_host_generator_type<rocrand_sobol32_host, ROCRAND_RNG_QUASI_SOBOL32>;
+    using engine_type = ::rocrand_host::detail::sobol32_device_engine;
+
+    rocrand_sobol32_host(unsigned long long offset = 0)
+        : base_type(0, offset),
+          m_initialized(false),
+          m_dimensions(1)
+    {
+        // Fails if ROCRAND_SOBOL_TABLES could not be loaded
+        rocrand_host::detail::get_valid_sobol_host_tables();
+    }
+
+    // Seed is not supported by quasi-random generators
+    rocrand_status set_seed_impl(unsigned long long)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status set_offset_impl(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_dimensions_impl(unsigned int dimensions)
+    {
+        m_dimensions = dimensions;
+        m_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Only the dimension-major ordering is supported
+    rocrand_status set_order_impl(rocrand_ordering)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // There are no engines to configure
+    rocrand_status set_engine_count_impl(unsigned int)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    size_t get_memory_usage_impl() const
+    {
+        return m_poisson.memory_usage();
+    }
+
+    rocrand_status init_impl()
+    {
+        if (m_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+        rocrand_host::detail::init_stats_scope init_scope(stats);
+
+        m_current_offset = static_cast<unsigned int>(m_offset);
+        m_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init_impl();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        generate_at(m_current_offset, data, data_size, distribution);
+
+        m_current_offset += data_size / m_dimensions;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_range_impl(unsigned int * data,
+                                       unsigned long long start,
+                                       size_t data_size)
+    {
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        uniform_distribution<unsigned int> udistribution;
+        generate_at(static_cast<unsigned int>(m_offset + start), data, data_size, udistribution);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_impl(T * data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal_impl(T * data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal_impl(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson_impl(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda, poisson_cache);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+private:
+    bool m_initialized;
+    unsigned int m_dimensions;
+    unsigned int m_current_offset;
+
+    // Cache of Poisson tables of recently used lambdas
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF, true> m_poisson;
+
+    template<class T, class Distribution>
+    void generate_at(const unsigned int offset,
+                     T * data, size_t data_size,
+                     const Distribution& distribution)
+    {
+        // Numbers of dimension d are stored in [d * size, (d + 1) * size)
+        const size_t size = data_size / m_dimensions;
+        const unsigned int * direction_vectors =
+            rocrand_host::detail::get_sobol_host_tables().sobol32_direction_vectors;
+        rocrand_host::detail::thread_pool::instance().parallel_for(
+            size, 4096,
+            [&](size_t begin, size_t end)
+            {
+                Distribution chunk_distribution = distribution;
+                for(unsigned int d = 0; d < m_dimensions; d++)
+                {
+                    engine_type engine(
+                        direction_vectors + d * 32,
+                        offset + static_cast<unsigned int>(begin)
+                    );
+                    T * dimension_data = data + d * size;
+                    for(size_t i = begin; i < end; i++)
+                    {
+                        dimension_data[i] = chunk_distribution(engine.current());
+                        engine.discard();
+                    }
+                }
+            }
+        );
+    }
+
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_HOST_SOBOL32_H_
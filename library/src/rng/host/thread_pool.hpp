@@ -0,0 +1,191 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_HOST_THREAD_POOL_H_
+#define ROCRAND_RNG_HOST_THREAD_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rocrand_host {
+namespace detail {
+
+// Fixed-size pool of worker threads used by host generators.
+//
+// parallel_for splits [0, size) into chunks which are processed by
+// the workers and the calling thread, it returns when all chunks are done.
+// Only one parallel_for runs at a time, concurrent calls are serialized.
+class thread_pool
+{
+public:
+    explicit thread_pool(unsigned int threads = std::thread::hardware_concurrency())
+        : m_stop(false), m_generation(0), m_job(NULL), m_active(0)
+    {
+        // The calling thread is one of workers
+        threads = std::max(threads, 1U);
+        for(unsigned int i = 1; i < threads; i++)
+        {
+            m_workers.emplace_back(&thread_pool::worker_loop, this);
+        }
+    }
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for(std::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    unsigned int size() const
+    {
+        return static_cast<unsigned int>(m_workers.size()) + 1;
+    }
+
+    // Calls f(begin, end) for consecutive chunks of [0, size), each chunk
+    // contains at least min_chunk elements (except the last one).
+    void parallel_for(const size_t size,
+                      const size_t min_chunk,
+                      const std::function<void(size_t, size_t)>& f)
+    {
+        if(size == 0)
+            return;
+
+        const size_t max_chunks = (size + min_chunk - 1) / std::max<size_t>(min_chunk, 1);
+        // A few chunks per thread for load balancing
+        const size_t chunks = std::min<size_t>(max_chunks, 4 * size_t(this->size()));
+        if(chunks <= 1 || m_workers.empty())
+        {
+            f(0, size);
+            return;
+        }
+
+        std::lock_guard<std::mutex> run_lock(m_run_mutex);
+
+        job j;
+        j.f = &f;
+        j.size = size;
+        j.chunk = (size + chunks - 1) / chunks;
+        j.chunks = (size + j.chunk - 1) / j.chunk;
+        j.next = 0;
+        j.remaining = j.chunks;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_job = &j;
+            m_generation++;
+        }
+        m_wake.notify_all();
+
+        run_chunks(j);
+
+        // Wait until all chunks are done and no worker references the job
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_job = NULL;
+        m_done.wait(lock, [&] { return j.remaining.load() == 0 && m_active == 0; });
+    }
+
+    // Pool shared by all host generators
+    static thread_pool& instance()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+private:
+    struct job
+    {
+        const std::function<void(size_t, size_t)> * f;
+        size_t size;
+        size_t chunk;
+        size_t chunks;
+        std::atomic<size_t> next;
+        std::atomic<size_t> remaining;
+    };
+
+    void run_chunks(job& j)
+    {
+        size_t c;
+        while((c = j.next.fetch_add(1)) < j.chunks)
+        {
+            const size_t begin = c * j.chunk;
+            const size_t end = std::min(j.size, begin + j.chunk);
+            (*j.f)(begin, end);
+            if(j.remaining.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_done.notify_all();
+            }
+        }
+    }
+
+    void worker_loop()
+    {
+        unsigned long long generation = 0;
+        while(true)
+        {
+            job * j;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [&] { return m_stop || (m_job != NULL && m_generation != generation); });
+                if(m_stop)
+                    return;
+                generation = m_generation;
+                j = m_job;
+                m_active++;
+            }
+            run_chunks(*j);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_active--;
+            }
+            m_done.notify_all();
+        }
+    }
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_run_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    bool m_stop;
+    unsigned long long m_generation;
+    job * m_job;
+    // Number of workers running chunks of m_job
+    unsigned int m_active;
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_HOST_THREAD_POOL_H_
@@ -0,0 +1,272 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_HOST_XORWOW_H_
+#define ROCRAND_RNG_HOST_XORWOW_H_
+
+#include <vector>
+
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+#include "thread_pool.hpp"
+#include "../xorwow.hpp"
+
+// Host generator, produces the same sequences as rocrand_xorwow
+// with the default grid (s_threads * s_blocks engines) or with the device-independent ordering
+class rocrand_xorwow_host
+    : public rocrand_host_generator_type<rocrand_xorwow_host, ROCRAND_RNG_PSEUDO_XORWOW>
+{
+public:
+    using base_type = rocrand_host_generator_type<rocrand_xorwow_host, ROCRAND_RNG_PSEUDO_XORWOW>;
+    using engine_type = ::rocrand_host::detail::xorwow_device_engine;
+
+    rocrand_xorwow_host(unsigned long long seed = 0,
+                        unsigned long long offset = 0)
+        : base_type(seed, offset),
+          m_engines_initialized(false), m_engines(s_threads * s_blocks),
+          m_order(ROCRAND_ORDERING_PSEUDO_DEFAULT), m_engine_count(0)
+    {
+
+    }
+
+    rocrand_status set_seed_impl(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_offset_impl(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_dimensions_impl(unsigned int)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status set_order_impl(rocrand_ordering order)
+    {
+        m_order = order;
+        resize_engines();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_engine_count_impl(unsigned int engine_count)
+    {
+        m_engine_count = engine_count;
+        resize_engines();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    size_t get_memory_usage_impl() const
+    {
+        return sizeof(engine_type) * m_engines.size() + m_poisson.memory_usage();
+    }
+
+    rocrand_status init_impl()
+    {
+        if (m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+        rocrand_host::detail::init_stats_scope init_scope(stats);
+
+        init_engines(m_engines, 0, 0);
+
+        m_engines_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        rocrand_status status = init_impl();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        generate_engines(m_engines, data, data_size, distribution);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution>
+    rocrand_status generate_normal(T * data, size_t data_size,
+                                   const Distribution& distribution)
+    {
+        rocrand_status status = init_impl();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        const unsigned int stride = static_cast<unsigned int>(m_engines.size());
+        rocrand_host::detail::parallel_for_engines(
+            m_engines.size(), 2 * size_t(stride), data_size,
+            [&](size_t engine_id, size_t row, size_t size)
+            {
+                Distribution engine_distribution = distribution;
+                rocrand_host::detail::generate_engine_normal(
+                    m_engines[engine_id], engine_id, stride,
+                    data + row, size, engine_distribution
+                );
+            }
+        );
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Same rotation of engines as rocrand_xorwow::generate_range()
+    rocrand_status generate_range_impl(unsigned int * data,
+                                       unsigned long long start,
+                                       size_t data_size)
+    {
+        std::vector<engine_type> engines(m_engines.size());
+        init_engines(engines, start / engines.size(), start % engines.size());
+
+        uniform_distribution<unsigned int> udistribution;
+        generate_engines(engines, data, data_size, udistribution);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_impl(T * data, size_t data_size)
+    {
+        uniform_distribution<T> udistribution;
+        return generate(data, data_size, udistribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal_impl(T * data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate_normal(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal_impl(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev);
+        return generate_normal(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson_impl(unsigned int * data, size_t data_size, double lambda)
+    {
+        // Large lambda: rejection as on the device, no tables are built
+        if(lambda >= rocrand_device::detail::lambda_threshold_small)
+        {
+            poisson_rejection_distribution distribution(lambda);
+            return generate(data, data_size,
+                            make_rejection_distribution<unsigned int>(distribution));
+        }
+
+        try
+        {
+            m_poisson.set_lambda(lambda, poisson_cache);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+private:
+    bool m_engines_initialized;
+    std::vector<engine_type> m_engines;
+    rocrand_ordering m_order;
+    // Number of engines set by set_engine_count(), 0 if not set
+    unsigned int m_engine_count;
+
+    // Default grid of rocrand_xorwow
+    #ifdef __HIP_PLATFORM_NVCC__
+    static const uint32_t s_threads = 64;
+    static const uint32_t s_blocks = 64;
+    #else
+    static const uint32_t s_threads = 256;
+    static const uint32_t s_blocks = 512;
+    #endif
+
+    // Cache of Poisson tables of recently used lambdas
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> m_poisson;
+
+    // Engines are rotated by first_engine positions, see init_engines_kernel
+    void init_engines(std::vector<engine_type>& engines,
+                      const unsigned long long offset,
+                      const size_t first_engine)
+    {
+        const size_t engines_size = engines.size();
+        rocrand_host::detail::thread_pool::instance().parallel_for(
+            engines_size, 64,
+            [&](size_t begin, size_t end)
+            {
+                for(size_t engine_id = begin; engine_id < end; engine_id++)
+                {
+                    const size_t subsequence = (first_engine + engine_id) % engines_size;
+                    const unsigned long long engine_offset =
+                        m_offset + offset + (first_engine + engine_id >= engines_size ? 1 : 0);
+                    engines[engine_id] = engine_type(m_seed, subsequence, engine_offset);
+                }
+            }
+        );
+    }
+
+    template<class T, class Distribution>
+    void generate_engines(std::vector<engine_type>& engines,
+                          T * data, size_t data_size,
+                          const Distribution& distribution)
+    {
+        const unsigned int stride = static_cast<unsigned int>(engines.size());
+        rocrand_host::detail::parallel_for_engines(
+            engines.size(), stride, data_size,
+            [&](size_t engine_id, size_t row, size_t size)
+            {
+                rocrand_host::detail::generate_engine(
+                    engines[engine_id], engine_id, stride,
+                    data + row, size, distribution
+                );
+            }
+        );
+    }
+
+    // Same number of engines as rocrand_xorwow
+    void resize_engines()
+    {
+        const size_t engines_size =
+            m_engine_count != 0
+                ? size_t(m_engine_count)
+                : m_order == ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT
+                    ? size_t(rocrand_xorwow::device_independent_engines)
+                    : size_t(s_threads * s_blocks);
+        if(engines_size != m_engines.size())
+        {
+            m_engines.resize(engines_size);
+            m_engines_initialized = false;
+        }
+    }
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_HOST_XORWOW_H_
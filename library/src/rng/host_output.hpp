@@ -0,0 +1,224 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_HOST_OUTPUT_H_
+#define ROCRAND_RNG_HOST_OUTPUT_H_
+
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "allocator.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Default number of values of a chunk of rocrand_generate_to_host()
+    constexpr size_t default_host_chunk_size = 16 * 1024 * 1024;
+
+    // Buffers of the pipeline of generate_to_host(): every chunk is generated
+    // into one of two device buffers on the generator's stream and copied to
+    // the host on a separate stream, so generation of the next chunk overlaps
+    // the copy. Pageable host memory is not copied asynchronously, so chunks
+    // are copied through two pinned staging buffers and then by the host.
+    class host_output_pipeline
+    {
+    public:
+        host_output_pipeline()
+            : m_copy_stream(0), m_stream(0)
+        {
+            for(int i = 0; i < 2; i++)
+            {
+                m_buffers[i] = NULL;
+                m_staging[i] = NULL;
+                m_generated[i] = NULL;
+                m_copied[i] = NULL;
+            }
+        }
+
+        ~host_output_pipeline()
+        {
+            if(m_copy_stream != 0)
+            {
+                hipStreamSynchronize(m_copy_stream);
+                hipStreamDestroy(m_copy_stream);
+            }
+            for(int i = 0; i < 2; i++)
+            {
+                m_allocator.deallocate(m_buffers[i], m_stream);
+                if(m_staging[i] != NULL) hipHostFree(m_staging[i]);
+                if(m_generated[i] != NULL) hipEventDestroy(m_generated[i]);
+                if(m_copied[i] != NULL) hipEventDestroy(m_copied[i]);
+            }
+        }
+
+        host_output_pipeline(const host_output_pipeline&) = delete;
+        host_output_pipeline& operator=(const host_output_pipeline&) = delete;
+
+        // Device buffers are allocated by allocator and used on stream
+        rocrand_status allocate(const size_t chunk_bytes, const bool staged,
+                                const device_allocator& allocator, hipStream_t stream)
+        {
+            m_allocator = allocator;
+            m_stream = stream;
+            if(hipStreamCreateWithFlags(&m_copy_stream, hipStreamNonBlocking) != hipSuccess)
+            {
+                m_copy_stream = 0;
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            for(int i = 0; i < 2; i++)
+            {
+                if(m_allocator.allocate(&m_buffers[i], chunk_bytes, m_stream) != ROCRAND_STATUS_SUCCESS)
+                {
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                }
+                if(staged && hipHostMalloc(&m_staging[i], chunk_bytes) != hipSuccess)
+                {
+                    m_staging[i] = NULL;
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                }
+                if(hipEventCreateWithFlags(&m_generated[i], hipEventDisableTiming) != hipSuccess)
+                {
+                    m_generated[i] = NULL;
+                    return ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+                if(hipEventCreateWithFlags(&m_copied[i], hipEventDisableTiming) != hipSuccess)
+                {
+                    m_copied[i] = NULL;
+                    return ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Generates n values of value_size bytes to host memory output
+        // in chunks of chunk_size values, generate(buffer, count) enqueues
+        // generation of count values to stream
+        template<class Generate>
+        rocrand_status run(char * output, const size_t n,
+                           const size_t value_size, const size_t chunk_size,
+                           hipStream_t stream, Generate generate)
+        {
+            const bool staged = m_staging[0] != NULL;
+            const size_t chunks = (n + chunk_size - 1) / chunk_size;
+            for(size_t k = 0; k < chunks; k++)
+            {
+                const int b = static_cast<int>(k % 2);
+                const size_t first = k * chunk_size;
+                const size_t count = std::min(chunk_size, n - first);
+
+                // The buffer is reused after the copy of chunk k - 2
+                if(k >= 2 && hipStreamWaitEvent(stream, m_copied[b], 0) != hipSuccess)
+                    return ROCRAND_STATUS_INTERNAL_ERROR;
+                rocrand_status status = generate(m_buffers[b], count);
+                if(status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+                if(hipEventRecord(m_generated[b], stream) != hipSuccess
+                    || hipStreamWaitEvent(m_copy_stream, m_generated[b], 0) != hipSuccess)
+                    return ROCRAND_STATUS_INTERNAL_ERROR;
+
+                void * destination = staged ? m_staging[b] : output + first * value_size;
+                if(hipMemcpyAsync(destination, m_buffers[b], count * value_size,
+                                  hipMemcpyDeviceToHost, m_copy_stream) != hipSuccess
+                    || hipEventRecord(m_copied[b], m_copy_stream) != hipSuccess)
+                    return ROCRAND_STATUS_INTERNAL_ERROR;
+
+                // The previous chunk is moved from its staging buffer while
+                // this one is generated and copied
+                if(staged && k >= 1)
+                {
+                    status = unstage(output, k - 1, n, value_size, chunk_size);
+                    if(status != ROCRAND_STATUS_SUCCESS)
+                        return status;
+                }
+            }
+
+            if(staged && chunks > 0)
+                return unstage(output, chunks - 1, n, value_size, chunk_size);
+            if(hipStreamSynchronize(m_copy_stream) != hipSuccess)
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+    private:
+        rocrand_status unstage(char * output, const size_t k, const size_t n,
+                               const size_t value_size, const size_t chunk_size)
+        {
+            const int b = static_cast<int>(k % 2);
+            const size_t first = k * chunk_size;
+            const size_t count = std::min(chunk_size, n - first);
+            if(hipEventSynchronize(m_copied[b]) != hipSuccess)
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            std::memcpy(output + first * value_size, m_staging[b], count * value_size);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipStream_t m_copy_stream;
+        device_allocator m_allocator;
+        // Stream of generation, buffers are freed there
+        hipStream_t m_stream;
+        char * m_buffers[2];
+        void * m_staging[2];
+        hipEvent_t m_generated[2];
+        hipEvent_t m_copied[2];
+    };
+
+    // Returns true if host memory ptr is pinned (allocated by hipHostMalloc
+    // or registered by hipHostRegister), so it can be a target of
+    // asynchronous copies
+    inline bool is_pinned(const void * ptr)
+    {
+        hipPointerAttribute_t attributes;
+        if(hipPointerGetAttributes(&attributes, ptr) != hipSuccess)
+        {
+            // Pageable memory is unknown to HIP, the error is cleared
+            hipGetLastError();
+            return false;
+        }
+        return attributes.memoryType == hipMemoryTypeHost;
+    }
+
+    template<class Generate>
+    inline rocrand_status generate_to_host(void * output, const size_t n,
+                                           const size_t value_size, size_t chunk_size,
+                                           const device_allocator& allocator,
+                                           hipStream_t stream, Generate generate)
+    {
+        if(n == 0)
+            return ROCRAND_STATUS_SUCCESS;
+        if(chunk_size == 0)
+            chunk_size = default_host_chunk_size;
+        chunk_size = std::min(chunk_size, n);
+
+        host_output_pipeline pipeline;
+        rocrand_status status = pipeline.allocate(chunk_size * value_size, !is_pinned(output),
+                                                  allocator, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        return pipeline.run(static_cast<char *>(output), n, value_size, chunk_size,
+                            stream, generate);
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_HOST_OUTPUT_H_
@@ -0,0 +1,441 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_LATTICE_HALTON_H_
+#define ROCRAND_RNG_LATTICE_HALTON_H_
+
+#include <algorithm>
+#include <vector>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+#include "profiling.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Korobov generating vector (1, a, a^2, ...) mod 2^32 of built-in
+    // lattices, a is chosen by the weighted P2 criterion of lattices
+    // of 2^6 to 2^16 points in 12 dimensions
+    constexpr unsigned int lattice_korobov_generator = 3741945653U;
+
+    constexpr unsigned int point_set_block_size = 256;
+
+    FQUALIFIERS
+    unsigned int lattice_reverse_bits(unsigned int x)
+    {
+    #if defined(__HIP_DEVICE_COMPILE__)
+        return __brev(x);
+    #else
+        x = ((x >> 1) & 0x55555555U) | ((x & 0x55555555U) << 1);
+        x = ((x >> 2) & 0x33333333U) | ((x & 0x33333333U) << 2);
+        x = ((x >> 4) & 0x0F0F0F0FU) | ((x & 0x0F0F0F0FU) << 4);
+        x = ((x >> 8) & 0x00FF00FFU) | ((x & 0x00FF00FFU) << 8);
+        return (x >> 16) | (x << 16);
+    #endif
+    }
+
+    // Random numbers of parameters of dimension, the seed is the key
+    // (stream distinguishes point sets)
+    inline uint4 point_set_random(const unsigned long long seed,
+                                  const unsigned int dimension,
+                                  const unsigned int stream)
+    {
+        return ::rocrand_device::detail::philox4x32_10_ten_rounds(
+            uint4 { dimension, stream, 0, 0 },
+            uint2 { static_cast<unsigned int>(seed), static_cast<unsigned int>(seed >> 32) }
+        );
+    }
+
+    // Extensible rank-1 lattice in base 2 with a random shift: coordinate d
+    // of point i is frac(phi(i) * z_d + shift_d), where phi(i) is the radical
+    // inverse of i in base 2, so the first 2^m points of the sequence are
+    // a shifted lattice rule of 2^m points. In 32-bit fixed point it is
+    // one bit reversal, one multiply and one add (both mod 2^32).
+    struct lattice_points
+    {
+        struct params
+        {
+            unsigned int vector;
+            unsigned int shift;
+        };
+
+        static const char * init_name() { return "lattice::init"; }
+
+        // vector is the user-supplied generating vector (empty for
+        // the built-in one), shifts are drawn from Philox4x32-10
+        static rocrand_status make_params(std::vector<params>& out,
+                                          const unsigned int dimensions,
+                                          const unsigned long long seed,
+                                          const std::vector<unsigned int>& vector)
+        {
+            if(!vector.empty() && vector.size() < dimensions)
+                return ROCRAND_STATUS_OUT_OF_RANGE;
+
+            out.resize(dimensions);
+            unsigned int z = 1;
+            for(unsigned int d = 0; d < dimensions; d++)
+            {
+                out[d].vector = vector.empty() ? z : vector[d];
+                out[d].shift = point_set_random(seed, d, 0).x;
+                z *= lattice_korobov_generator;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        FQUALIFIERS
+        static unsigned int point(const params p, const unsigned int index)
+        {
+            return lattice_reverse_bits(index) * p.vector + p.shift;
+        }
+    };
+
+    // Halton sequence with digit scrambling: coordinate d is the radical
+    // inverse of the point index in the d-th prime base, every digit is
+    // multiplied by a random factor of the dimension modulo the base
+    // (the factor of base 2 is always 1).
+    struct halton_points
+    {
+        struct params
+        {
+            unsigned int base;
+            unsigned int multiplier;
+        };
+
+        static const char * init_name() { return "halton::init"; }
+
+        static rocrand_status make_params(std::vector<params>& out,
+                                          const unsigned int dimensions,
+                                          const unsigned long long seed,
+                                          const std::vector<unsigned int>& vector)
+        {
+            (void)vector;
+            out.resize(dimensions);
+            unsigned int prime = 1;
+            for(unsigned int d = 0; d < dimensions; d++)
+            {
+                bool is_prime;
+                do
+                {
+                    prime++;
+                    is_prime = true;
+                    for(unsigned int q = 2; q * q <= prime && is_prime; q++)
+                    {
+                        is_prime = prime % q != 0;
+                    }
+                } while(!is_prime);
+                out[d].base = prime;
+                out[d].multiplier = 1 + point_set_random(seed, d, 1).x % (prime - 1);
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // The scrambled digits are reversed to an integer R of K digits
+        // (K is the number of digits of index), the result is R / base^K
+        // in 32-bit fixed point. base^K <= base * 2^32 < 2^53, so R / base^K
+        // is computed exactly enough in double precision.
+        FQUALIFIERS
+        static unsigned int point(const params p, unsigned int index)
+        {
+            unsigned long long reversed = 0;
+            unsigned long long scale = 1;
+            while(index > 0)
+            {
+                const unsigned int digit = index % p.base;
+                index /= p.base;
+                reversed = reversed * p.base
+                    + (static_cast<unsigned long long>(digit) * p.multiplier) % p.base;
+                scale *= p.base;
+            }
+            const double x = static_cast<double>(reversed) / static_cast<double>(scale);
+            return static_cast<unsigned int>(x * 4294967296.0);
+        }
+    };
+
+    // Element i of the output is point i / inner_size, dimension i % inner_size
+    // in point-major ordering, and dimension i / inner_size, point i % inner_size
+    // in dimension-major ordering. Every point is computed from its index,
+    // so threads store consecutive elements in both orderings; the quotient
+    // and the remainder are divided once and then advanced by the stride.
+    template<class Points, class Type, class Distribution>
+    __global__
+    __launch_bounds__(point_set_block_size)
+    void generate_point_set_kernel(Type * data, const size_t size,
+                                   const size_t inner_size,
+                                   const bool point_major,
+                                   const typename Points::params * params,
+                                   const unsigned int first_point,
+                                   Distribution distribution)
+    {
+        const size_t stride = static_cast<size_t>(hipGridDim_x) * hipBlockDim_x;
+        const size_t stride_outer = stride / inner_size;
+        const size_t stride_inner = stride % inner_size;
+
+        size_t index = static_cast<size_t>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
+        size_t outer = index / inner_size;
+        size_t inner = index % inner_size;
+        while(index < size)
+        {
+            const size_t point = point_major ? outer : inner;
+            const size_t dimension = point_major ? inner : outer;
+            // The sequence has 2^32 points, so offsets wrap around
+            data[index] = distribution(
+                Points::point(params[dimension], first_point + static_cast<unsigned int>(point))
+            );
+
+            index += stride;
+            outer += stride_outer;
+            inner += stride_inner;
+            if(inner >= inner_size)
+            {
+                inner -= inner_size;
+                outer++;
+            }
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Quasi-random point set whose points are computed from their indices
+// by Points::point() with per-dimension parameters (rank-1 lattices and
+// Halton sequences, see lattice_points and halton_points). Parameters are
+// randomized by the seed and copied to the device by init().
+template<rocrand_rng_type RngType, class Points>
+class rocrand_point_set_generator : public rocrand_generator_type<RngType>
+{
+public:
+    using base_type = rocrand_generator_type<RngType>;
+    using params_type = typename Points::params;
+
+    using base_type::rng_type;
+    using base_type::allocator;
+    using base_type::poisson_cache;
+    using base_type::count_launch;
+    using base_type::is_capturing;
+
+    rocrand_point_set_generator(unsigned long long seed = 0,
+                                unsigned long long offset = 0,
+                                hipStream_t stream = 0)
+        : base_type(seed, offset, stream),
+          m_initialized(false),
+          m_dimensions(1),
+          m_current_offset(0),
+          m_params(NULL),
+          m_params_size(0)
+    {
+    }
+
+    ~rocrand_point_set_generator()
+    {
+        allocator.deallocate(m_params, m_stream);
+    }
+
+    void reset()
+    {
+        m_initialized = false;
+    }
+
+    /// Changes the seed (the random shift of lattices, digit scrambling
+    /// of Halton sequences) and resets the generator.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_initialized = false;
+    }
+
+    void set_dimensions(unsigned int dimensions)
+    {
+        m_dimensions = dimensions;
+        m_initialized = false;
+    }
+
+    /// Sets the generating vector of lattices (at least as many values as
+    /// dimensions, checked by init()), an empty vector selects the built-in one.
+    void set_generating_vector(const unsigned int * vector, unsigned int size)
+    {
+        m_generating_vector.assign(vector, vector + size);
+        m_initialized = false;
+    }
+
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        m_order = order;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if(m_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+        ROCRAND_PROFILING_NAMED_RANGE(Points::init_name());
+
+        rocrand_status status =
+            Points::make_params(m_host_params, m_dimensions, m_seed, m_generating_vector);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        if(m_params_size < m_dimensions)
+        {
+            allocator.deallocate(m_params, m_stream);
+            m_params_size = 0;
+            if(allocator.allocate(&m_params, m_dimensions, m_stream) != ROCRAND_STATUS_SUCCESS)
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            m_params_size = m_dimensions;
+        }
+        if(hipMemcpyAsync(m_params, m_host_params.data(), sizeof(params_type) * m_dimensions,
+                          hipMemcpyHostToDevice, m_stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
+        m_current_offset = m_offset;
+        m_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        if(data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        const uint32_t max_blocks = 4096;
+        const uint32_t threads = ::rocrand_host::detail::point_set_block_size;
+        const uint32_t blocks =
+            static_cast<uint32_t>(std::min<size_t>(max_blocks, (data_size + threads - 1) / threads));
+
+        const size_t points = data_size / m_dimensions;
+        const bool point_major = m_order == ROCRAND_ORDERING_QUASI_POINT_MAJOR;
+        if(data_size > 0)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_point_set_kernel<Points>),
+                dim3(blocks), dim3(threads), 0, m_stream,
+                data, data_size, point_major ? static_cast<size_t>(m_dimensions) : points,
+                point_major, m_params, static_cast<unsigned int>(m_current_offset),
+                distribution
+            );
+            // Check kernel status
+            if(rocrand_host::detail::launch_failed())
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+            count_launch(data_size);
+        }
+
+        m_current_offset += points;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    // Each half value is generated from one point coordinate
+    rocrand_status generate_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        normal_distribution<__half> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_log_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        log_normal_distribution<__half> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class IntType>
+    rocrand_status generate_uniform_int(IntType * data, size_t data_size,
+                                        IntType lo, IntType hi)
+    {
+        uniform_int_distribution<IntType> distribution(lo, hi);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda, poisson_cache, allocator, m_stream, is_capturing());
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+protected:
+    using base_type::m_order;
+    using base_type::m_seed;
+    using base_type::m_offset;
+    using base_type::m_stream;
+
+private:
+    bool m_initialized;
+    unsigned int m_dimensions;
+    unsigned long long m_current_offset;
+    std::vector<unsigned int> m_generating_vector;
+    // Kept until the next init(), the copy to m_params may be in flight
+    std::vector<params_type> m_host_params;
+    params_type * m_params;
+    unsigned int m_params_size;
+
+    // Cache of Poisson tables of recently used lambdas
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_poisson;
+};
+
+typedef rocrand_point_set_generator<
+    ROCRAND_RNG_QUASI_LATTICE, rocrand_host::detail::lattice_points
+> rocrand_lattice;
+typedef rocrand_point_set_generator<
+    ROCRAND_RNG_QUASI_HALTON, rocrand_host::detail::halton_points
+> rocrand_halton;
+
+#endif // ROCRAND_RNG_LATTICE_HALTON_H_
@@ -0,0 +1,261 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_LAUNCH_CONFIG_H_
+#define ROCRAND_RNG_LAUNCH_CONFIG_H_
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+// Grid used by a generator for its kernels.
+struct launch_config
+{
+    unsigned int threads;
+    unsigned int blocks;
+    // Device the config was computed for, cu_count is 0 if unknown
+    int device_id;
+    unsigned int cu_count;
+};
+
+// Entry of the per-architecture tuning table.
+//
+// arch is gcnArch (e.g. 803, 900, 906) on HCC and major * 10 + minor
+// (e.g. 60, 70) on NVCC, 0 matches any architecture. When blocks_per_cu
+// is 0 the number of blocks per compute unit is taken from the occupancy
+// of the kernel.
+struct launch_config_entry
+{
+    int arch;
+    rocrand_rng_type rng_type;
+    unsigned int threads;
+    unsigned int blocks_per_cu;
+};
+
+// The built-in table can be replaced at build time by defining
+// ROCRAND_LAUNCH_CONFIG_TABLE as the path of a file containing the
+// initializer list of launch_config_entry.
+static const launch_config_entry launch_config_table[] =
+{
+#ifdef ROCRAND_LAUNCH_CONFIG_TABLE
+    #include ROCRAND_LAUNCH_CONFIG_TABLE
+#elif defined(__HIP_PLATFORM_NVCC__)
+    { 0, ROCRAND_RNG_PSEUDO_PHILOX4_32_10, 256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_THREEFRY4_32_20, 256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_THREEFRY2_64_20, 256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_PHILOX4_64_10, 256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_XORWOW,        64,  0 },
+    { 0, ROCRAND_RNG_PSEUDO_XOSHIRO128PP,  256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_PCG32,         256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_MRG32K3A,      128, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_MTGP32,        256, 1 },
+    { 0, ROCRAND_RNG_PSEUDO_MT19937,       256, 0 },
+#else
+    { 803, ROCRAND_RNG_PSEUDO_XORWOW,      256, 4 },
+    { 803, ROCRAND_RNG_PSEUDO_MRG32K3A,    256, 4 },
+    { 0, ROCRAND_RNG_PSEUDO_PHILOX4_32_10, 256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_THREEFRY4_32_20, 256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_THREEFRY2_64_20, 256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_PHILOX4_64_10, 256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_XORWOW,        256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_XOSHIRO128PP,  256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_PCG32,         256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_MRG32K3A,      256, 0 },
+    { 0, ROCRAND_RNG_PSEUDO_MTGP32,        256, 8 },
+    { 0, ROCRAND_RNG_PSEUDO_MT19937,       256, 0 },
+#endif
+};
+
+struct device_info
+{
+    int device_id;
+    int arch;
+    unsigned int cu_count;
+    unsigned int warp_size;
+};
+
+// Returns false if the current device can not be queried.
+inline bool get_device_info(device_info& info)
+{
+    int device_id;
+    hipDeviceProp_t props;
+    if(hipGetDevice(&device_id) != hipSuccess
+        || hipGetDeviceProperties(&props, device_id) != hipSuccess)
+    {
+        return false;
+    }
+    info.device_id = device_id;
+    #ifdef __HIP_PLATFORM_NVCC__
+    info.arch = props.major * 10 + props.minor;
+    #else
+    info.arch = props.gcnArch;
+    #endif
+    info.cu_count = static_cast<unsigned int>(std::max(props.multiProcessorCount, 1));
+    info.warp_size = static_cast<unsigned int>(std::max(props.warpSize, 1));
+    return true;
+}
+
+inline const launch_config_entry * find_launch_config_entry(int arch,
+                                                            rocrand_rng_type rng_type)
+{
+    const launch_config_entry * generic = NULL;
+    for(const launch_config_entry& entry : launch_config_table)
+    {
+        if(entry.rng_type != rng_type)
+            continue;
+        if(entry.arch == arch)
+            return &entry;
+        if(entry.arch == 0 && generic == NULL)
+            generic = &entry;
+    }
+    return generic;
+}
+
+// Returns the number of blocks of kernel that can be resident on one
+// compute unit of the current device (cached per device and kernel),
+// 0 if it can not be determined.
+template<class Kernel>
+inline unsigned int get_blocks_per_cu(int device_id, Kernel kernel, unsigned int threads)
+{
+    typedef std::pair<int, std::pair<const void *, unsigned int>> key_type;
+    static std::mutex cache_mutex;
+    static std::map<key_type, unsigned int> cache;
+
+    const key_type key(device_id,
+        std::make_pair(reinterpret_cast<const void *>(kernel), threads));
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto it = cache.find(key);
+    if(it != cache.end())
+        return it->second;
+
+    int blocks = 0;
+    if(hipOccupancyMaxActiveBlocksPerMultiprocessor(&blocks, kernel, threads, 0) != hipSuccess)
+    {
+        // Clear the error so it is not reported by hipPeekAtLastError
+        (void)hipGetLastError();
+        blocks = 0;
+    }
+    const unsigned int result = static_cast<unsigned int>(std::max(blocks, 0));
+    cache[key] = result;
+    return result;
+}
+
+// Computes the grid of a generator on the current device.
+//
+// defaults is used when the device can not be queried (and for the
+// thread count when the tuning table has no entry for rng_type).
+// The number of blocks is rounded up to a multiple of block_multiple
+// and clamped to max_blocks.
+template<class Kernel>
+inline launch_config get_launch_config(rocrand_rng_type rng_type,
+                                       Kernel kernel,
+                                       const launch_config defaults,
+                                       const unsigned int block_multiple = 1,
+                                       const unsigned int max_blocks = 65536)
+{
+    device_info info;
+    if(!get_device_info(info))
+        return defaults;
+
+    launch_config config = defaults;
+    config.device_id = info.device_id;
+    config.cu_count = info.cu_count;
+    unsigned int blocks_per_cu = 0;
+    const launch_config_entry * entry = find_launch_config_entry(info.arch, rng_type);
+    if(entry != NULL)
+    {
+        // Threads are rounded up to whole wavefronts
+        config.threads = (entry->threads + info.warp_size - 1) / info.warp_size * info.warp_size;
+        blocks_per_cu = entry->blocks_per_cu;
+    }
+    if(blocks_per_cu == 0)
+    {
+        blocks_per_cu = get_blocks_per_cu(info.device_id, kernel, config.threads);
+    }
+    if(blocks_per_cu == 0)
+    {
+        config.threads = defaults.threads;
+        return config;
+    }
+
+    unsigned int blocks = info.cu_count * blocks_per_cu;
+    blocks = (blocks + block_multiple - 1) / block_multiple * block_multiple;
+    config.blocks = std::max(block_multiple, std::min(blocks, max_blocks));
+    return config;
+}
+
+// Number of engines which produce numbers when items work items (values
+// or pairs of values) are stored with stride engines_size, engines after
+// them are neither loaded nor stored by generate kernels.
+__forceinline__ __device__ __host__
+unsigned int get_active_engines(const unsigned int engines_size, const size_t items)
+{
+    return items < engines_size ? static_cast<unsigned int>(items) : engines_size;
+}
+
+// Returns the number of blocks to launch kernel with: blocks limited to
+// the number of blocks of that kernel that can be resident on the device
+// at the same time, so every instantiation of a generate kernel runs
+// as a single wave. Small requests of items threads with work (groups of
+// numbers or active engines) do not launch blocks without work.
+template<class Kernel>
+inline unsigned int get_launch_blocks(Kernel kernel, const launch_config& config,
+                                      const size_t items = static_cast<size_t>(-1))
+{
+    unsigned int blocks = config.blocks;
+    if(config.cu_count != 0)
+    {
+        const unsigned int blocks_per_cu =
+            get_blocks_per_cu(config.device_id, kernel, config.threads);
+        if(blocks_per_cu != 0)
+            blocks = std::min(blocks, config.cu_count * blocks_per_cu);
+    }
+    const size_t needed = items / config.threads + (items % config.threads != 0 ? 1 : 0);
+    return static_cast<unsigned int>(std::max<size_t>(1, std::min<size_t>(blocks, needed)));
+}
+
+// Type of generate kernels, used to select one instantiation from
+// the overloaded kernels of all generators
+template<class Engine, class Type, class Distribution>
+using generate_kernel_type = void (*)(Engine *, const unsigned int,
+                                      Type *, const size_t, Distribution);
+
+// get_launch_blocks for a generate kernel given as an overload set
+// (e.g. generate_normal_kernel), the instantiation is resolved by
+// the explicit template arguments.
+template<class Engine, class Type, class Distribution>
+inline unsigned int get_generate_blocks(generate_kernel_type<Engine, Type, Distribution> kernel,
+                                        const launch_config& config,
+                                        const size_t items = static_cast<size_t>(-1))
+{
+    return get_launch_blocks(kernel, config, items);
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_LAUNCH_CONFIG_H_
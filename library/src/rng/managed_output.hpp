@@ -0,0 +1,113 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_MANAGED_OUTPUT_H_
+#define ROCRAND_RNG_MANAGED_OUTPUT_H_
+
+#include <cstddef>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Returns true if ptr is managed memory (allocated by hipMallocManaged)
+    inline bool is_managed(const void * ptr)
+    {
+        hipPointerAttribute_t attributes;
+        if(hipPointerGetAttributes(&attributes, ptr) != hipSuccess)
+        {
+            // Pageable memory is unknown to HIP, the error is cleared
+            hipGetLastError();
+            return false;
+        }
+        return attributes.isManaged != 0;
+    }
+
+    // Output of a device generator in managed memory is migrated to the
+    // current device before generation, so kernels do not fault page by
+    // page, and hints of rocrand_set_managed_memory_hints() are applied
+    // after generation (the destructor runs when the generation is enqueued).
+    // Hints are best effort: failures of prefetches and advice do not
+    // change the result of generation and their errors are cleared.
+    // Prefetches are not captured into graphs of the generator's stream.
+    class managed_output
+    {
+    public:
+        managed_output(const unsigned int hints, void * ptr, const size_t bytes,
+                       hipStream_t stream)
+            : m_hints(0), m_ptr(ptr), m_bytes(bytes), m_stream(stream), m_device(0)
+        {
+            // Output in device memory (the common case) needs only one query
+            if(hints == 0 || ptr == NULL || bytes == 0 || !is_managed(ptr)
+                || is_capturing(stream) || hipGetDevice(&m_device) != hipSuccess)
+            {
+                return;
+            }
+            m_hints = hints;
+            if(m_hints & ROCRAND_MANAGED_HINT_PREFETCH)
+            {
+                check(hipMemPrefetchAsync(m_ptr, m_bytes, m_device, m_stream));
+            }
+        }
+
+        ~managed_output()
+        {
+            if(m_hints & ROCRAND_MANAGED_HINT_READ_MOSTLY)
+            {
+                check(hipMemAdvise(m_ptr, m_bytes, hipMemAdviseSetReadMostly, m_device));
+            }
+            if(m_hints & ROCRAND_MANAGED_HINT_PREFETCH_TO_HOST)
+            {
+                check(hipMemPrefetchAsync(m_ptr, m_bytes, hipCpuDeviceId, m_stream));
+            }
+        }
+
+        managed_output(const managed_output&) = delete;
+        managed_output& operator=(const managed_output&) = delete;
+
+    private:
+        static bool is_capturing(hipStream_t stream)
+        {
+            hipStreamCaptureStatus status = hipStreamCaptureStatusNone;
+            return hipStreamIsCapturing(stream, &status) != hipSuccess
+                || status != hipStreamCaptureStatusNone;
+        }
+
+        static void check(const hipError_t error)
+        {
+            // Devices without concurrent managed access do not support
+            // prefetches and advice, generation is correct without them
+            if(error != hipSuccess)
+                hipGetLastError();
+        }
+
+        unsigned int m_hints;
+        void * m_ptr;
+        size_t m_bytes;
+        hipStream_t m_stream;
+        int m_device;
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_MANAGED_OUTPUT_H_
@@ -28,8 +28,15 @@
 #include <rocrand_mrg32k3a_precomputed.h>
 
 #include "generator_type.hpp"
+#include "profiling.hpp"
 #include "device_engines.hpp"
+#include "common.hpp"
 #include "distributions.hpp"
+#include "batch.hpp"
+#include "launch_config.hpp"
+#include "prepared_engines.hpp"
+#include "range_engines.hpp"
+#include "engine_cache.hpp"
 
 namespace rocrand_host {
 namespace detail {
@@ -38,58 +45,166 @@ namespace detail {
 
     __global__
     void init_engines_kernel(mrg32k3a_device_engine * engines,
-                            unsigned long long seed,
-                            unsigned long long offset)
+                             const unsigned int engines_size,
+                             const unsigned int engines_count,
+                             unsigned long long seed,
+                             unsigned long long offset,
+                             const unsigned int first_engine,
+                             const unsigned long long subsequence_shift,
+                             bool seeded)
     {
+        // Only the first engines_count engines are initialized (engines
+        // of a short range)
         const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        engines[engine_id] = mrg32k3a_device_engine(seed, engine_id, offset);
+        if(engine_id >= engines_count)
+            return;
+
+        // Engines are rotated by first_engine positions when a range of
+        // the sequence is generated, engines which wrap around start one
+        // number later
+        const unsigned int subsequence = (first_engine + engine_id) % engines_size;
+        const unsigned long long engine_offset =
+            offset + (first_engine + engine_id >= engines_size ? 1 : 0);
+        if(seeded)
+        {
+            // Independent seeds, no skipahead to the subsequence (except
+            // the subsequences of a child generator)
+            store_engine(engines, engines_size, engine_id,
+                         mrg32k3a_device_engine(seeded_engine_seed(seed, subsequence),
+                                                subsequence_shift, engine_offset));
+        }
+        else
+        {
+            store_engine(engines, engines_size, engine_id,
+                         mrg32k3a_device_engine(seed, subsequence_shift + subsequence, engine_offset));
+        }
     }
 
+    // Generates numbers of engine_id-th engine of a grid with stride engines,
+    // used by generate kernels and by the host generator
     template<class Type, class Distribution>
-    __global__
-    void generate_kernel(mrg32k3a_device_engine * engines,
+    __forceinline__ __device__ __host__
+    void generate_engine(mrg32k3a_device_engine& engine,
+                         const unsigned int engine_id,
+                         const unsigned int stride,
                          Type * data, const size_t n,
-                         const Distribution distribution)
+                         const Distribution& distribution)
     {
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
         unsigned int index = engine_id;
-        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        while(index < n)
+        {
+            data[index] = distribution(engine());
+            // Next position
+            index += stride;
+        }
+    }
 
-        // Load device engine
-        mrg32k3a_device_engine engine = engines[engine_id];
+    // Returns numbers of MRG32K3A scaled to [0, UINT_MAX]
+    struct mrg32k3a_uint_engine
+    {
+        mrg32k3a_device_engine& engine;
 
+        __forceinline__ __device__ __host__
+        unsigned int operator()()
+        {
+            return static_cast<unsigned int>(engine() * ROCRAND_MRG32K3A_UINT_NORM);
+        }
+    };
+
+    // Doubles of resolutions other than the default one are computed from
+    // numbers scaled to [0, UINT_MAX] as in the device API
+    __forceinline__ __device__ __host__
+    void generate_engine(mrg32k3a_device_engine& engine,
+                         const unsigned int engine_id,
+                         const unsigned int stride,
+                         double * data, const size_t n,
+                         const uniform_double_fast_distribution& distribution)
+    {
+        mrg32k3a_uint_engine uint_engine { engine };
+        unsigned int index = engine_id;
         while(index < n)
         {
-            data[index] = distribution(engine());
+            data[index] = distribution(uint_engine());
             // Next position
             index += stride;
         }
+    }
 
-        // Save engine with its state
-        engines[engine_id] = engine;
+    __forceinline__ __device__ __host__
+    void generate_engine(mrg32k3a_device_engine& engine,
+                         const unsigned int engine_id,
+                         const unsigned int stride,
+                         double * data, const size_t n,
+                         const uniform_double_full_distribution& distribution)
+    {
+        mrg32k3a_uint_engine uint_engine { engine };
+        unsigned int index = engine_id;
+        while(index < n)
+        {
+            const unsigned int v1 = uint_engine();
+            const unsigned int v2 = uint_engine();
+            data[index] = distribution(v1, v2);
+            // Next position
+            index += stride;
+        }
+    }
+
+    // Distributions with rejection: numbers are drawn until one is accepted
+    template<class Type, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_engine(mrg32k3a_device_engine& engine,
+                         const unsigned int engine_id,
+                         const unsigned int stride,
+                         Type * data, const size_t n,
+                         const rejection_distribution<Type, Distribution>& distribution)
+    {
+        mrg32k3a_uint_engine uint_engine { engine };
+        unsigned int index = engine_id;
+        while(index < n)
+        {
+            Type value;
+            while(!distribution(uint_engine, value, index)) { }
+            data[index] = value;
+            // Next position
+            index += stride;
+        }
     }
 
     template<class RealType, class Distribution>
-    __global__
-    void generate_normal_kernel(mrg32k3a_device_engine * engines,
+    __forceinline__ __device__ __host__
+    void generate_engine_normal(mrg32k3a_device_engine& engine,
+                                const unsigned int engine_id,
+                                const unsigned int stride,
                                 RealType * data, const size_t n,
-                                Distribution distribution)
+                                Distribution& distribution)
     {
-        typedef decltype(distribution(engines->next(), engines->next())) RealType2;
+        typedef decltype(distribution(engine.next(), engine.next())) RealType2;
 
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
         unsigned int index = engine_id;
-        unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
-        // Load device engine
-        mrg32k3a_device_engine engine = engines[engine_id];
-
-        RealType2 * data2 = (RealType2 *)data;
-        while(index < (n / 2))
+        const bool aligned = (uintptr_t)data % sizeof(RealType2) == 0;
+        // Two pairs (4 values) per iteration: numbers of both pairs are drawn
+        // first, so their Box-Muller transforms (log, sqrt, sincos and exp of
+        // log-normal) are independent and overlap. Values and their positions
+        // are the same as with one pair per iteration.
+        while(index + stride < (n / 2))
         {
-            data2[index] = distribution(engine(), engine());
+            const unsigned int v1 = engine();
+            const unsigned int v2 = engine();
+            const unsigned int v3 = engine();
+            const unsigned int v4 = engine();
+            const RealType2 result1 = distribution(v1, v2);
+            const RealType2 result2 = distribution(v3, v4);
+            store_pair(data, index, result1, aligned);
+            store_pair(data, index + stride, result2, aligned);
             // Next position
-            index += stride;
+            index += 2 * stride;
+        }
+        if(index < (n / 2))
+        {
+            const unsigned int v1 = engine();
+            const unsigned int v2 = engine();
+            store_pair(data, index, distribution(v1, v2), aligned);
         }
 
         // First work-item saves the tail when n is not a multiple of 2
@@ -99,9 +214,168 @@ namespace detail {
             // Save the tail
             data[n - 1] = result.x;
         }
+    }
+
+    template<class Type, class Distribution>
+    __global__
+    void generate_kernel(mrg32k3a_device_engine * engines,
+                         const unsigned int engines_size,
+                         Type * data, const size_t n,
+                         const Distribution distribution)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int threads = hipGridDim_x * hipBlockDim_x;
+        const unsigned int active_engines = get_active_engines(engines_size, n);
+
+        // Numbers of engine_id-th engine are stored with stride engines_size,
+        // threads run several engines when the grid is smaller than the number
+        // of engines, so results do not depend on the grid
+        for(unsigned int engine_id = thread_id; engine_id < active_engines; engine_id += threads)
+        {
+            // Load device engine
+            mrg32k3a_device_engine engine = load_engine(engines, engines_size, engine_id);
+
+            generate_engine(engine, engine_id, engines_size, data, n, distribution);
+
+            // Save engine with its state
+            store_engine(engines, engines_size, engine_id, engine);
+        }
+    }
+
+    template<class RealType, class Distribution>
+    __global__
+    void generate_normal_kernel(mrg32k3a_device_engine * engines,
+                                const unsigned int engines_size,
+                                RealType * data, const size_t n,
+                                Distribution distribution)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int threads = hipGridDim_x * hipBlockDim_x;
+        // Pairs of values, the first engine stores the tail
+        const unsigned int active_engines = get_active_engines(engines_size, (n + 1) / 2);
+
+        // Numbers of engine_id-th engine are stored with stride engines_size,
+        // threads run several engines when the grid is smaller than the number
+        // of engines, so results do not depend on the grid
+        for(unsigned int engine_id = thread_id; engine_id < active_engines; engine_id += threads)
+        {
+            // Load device engine
+            mrg32k3a_device_engine engine = load_engine(engines, engines_size, engine_id);
+
+            generate_engine_normal(engine, engine_id, engines_size, data, n, distribution);
+
+            // Save engine with its state
+            store_engine(engines, engines_size, engine_id, engine);
+        }
+    }
+
+    // Generates a request of a batch by generate_engine
+    struct mrg32k3a_batch_generate
+    {
+        mrg32k3a_device_engine& engine;
+        const unsigned int engine_id;
+        const unsigned int stride;
+
+        template<class Type, class Distribution>
+        __forceinline__ __device__ __host__
+        void operator()(Type * data, const size_t n, const Distribution& distribution) const
+        {
+            generate_engine(engine, engine_id, stride, data, n, distribution);
+        }
+    };
+
+    // Generates numbers of all requests of a batch in order, so the results
+    // are the same as of separate generate calls
+    __forceinline__ __device__ __host__
+    void generate_batch_engine(mrg32k3a_device_engine& engine,
+                               const unsigned int engine_id,
+                               const unsigned int stride,
+                               const batch_requests& batch)
+    {
+        for(unsigned int i = 0; i < batch.count; i++)
+        {
+            const batch_request& r = batch.requests[i];
+            if(generate_batch_normal_method(mrg32k3a_batch_generate { engine, engine_id, stride },
+                                            batch.normal_method, r))
+            {
+                continue;
+            }
+            switch(r.distribution)
+            {
+                case ROCRAND_DISTRIBUTION_UNIFORM_UINT:
+                    generate_engine(engine, engine_id, stride,
+                                    static_cast<unsigned int *>(r.data), r.n,
+                                    mrg_uniform_distribution<unsigned int>());
+                    break;
+                case ROCRAND_DISTRIBUTION_UNIFORM_FLOAT:
+                    generate_engine(engine, engine_id, stride,
+                                    static_cast<float *>(r.data), r.n,
+                                    mrg_uniform_distribution<float>());
+                    break;
+                case ROCRAND_DISTRIBUTION_UNIFORM_DOUBLE:
+                    generate_engine(engine, engine_id, stride,
+                                    static_cast<double *>(r.data), r.n,
+                                    mrg_uniform_distribution<double>());
+                    break;
+                case ROCRAND_DISTRIBUTION_NORMAL_FLOAT:
+                {
+                    mrg_normal_distribution<float> distribution(r.mean, r.stddev);
+                    generate_engine_normal(engine, engine_id, stride,
+                                           static_cast<float *>(r.data), r.n,
+                                           distribution);
+                    break;
+                }
+                case ROCRAND_DISTRIBUTION_NORMAL_DOUBLE:
+                {
+                    mrg_normal_distribution<double> distribution(r.mean, r.stddev);
+                    generate_engine_normal(engine, engine_id, stride,
+                                           static_cast<double *>(r.data), r.n,
+                                           distribution);
+                    break;
+                }
+                case ROCRAND_DISTRIBUTION_LOG_NORMAL_FLOAT:
+                {
+                    mrg_log_normal_distribution<float> distribution(r.mean, r.stddev);
+                    generate_engine_normal(engine, engine_id, stride,
+                                           static_cast<float *>(r.data), r.n,
+                                           distribution);
+                    break;
+                }
+                case ROCRAND_DISTRIBUTION_LOG_NORMAL_DOUBLE:
+                {
+                    mrg_log_normal_distribution<double> distribution(r.mean, r.stddev);
+                    generate_engine_normal(engine, engine_id, stride,
+                                           static_cast<double *>(r.data), r.n,
+                                           distribution);
+                    break;
+                }
+                case ROCRAND_DISTRIBUTION_POISSON:
+                    generate_engine(engine, engine_id, stride,
+                                    static_cast<unsigned int *>(r.data), r.n,
+                                    batch_poisson_distribution(r.poisson));
+                    break;
+            }
+        }
+    }
+
+    __global__
+    void generate_batch_kernel(mrg32k3a_device_engine * engines,
+                               const unsigned int engines_size,
+                               const batch_requests batch)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int threads = hipGridDim_x * hipBlockDim_x;
+
+        for(unsigned int engine_id = thread_id; engine_id < engines_size; engine_id += threads)
+        {
+            // Load device engine
+            mrg32k3a_device_engine engine = load_engine(engines, engines_size, engine_id);
 
-        // Save engine with its state
-        engines[engine_id] = engine;
+            generate_batch_engine(engine, engine_id, engines_size, batch);
+
+            // Save engine with its state
+            store_engine(engines, engines_size, engine_id, engine);
+        }
     }
 
 } // end namespace detail
@@ -113,15 +387,22 @@ public:
     using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_MRG32K3A>;
     using engine_type = ::rocrand_host::detail::mrg32k3a_device_engine;
 
+    // Number of engines with ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT,
+    // the same on all devices and platforms (and equal to the legacy
+    // number of engines on HCC)
+    static const unsigned int device_independent_engines = 256 * 512;
+
     rocrand_mrg32k3a(unsigned long long seed = 12345,
                      unsigned long long offset = 0,
                      hipStream_t stream = 0)
         : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL), m_engines_size(s_threads * s_blocks)
+          m_engines_initialized(false), m_engines(NULL), m_engine_count(0),
+          m_subsequence_shift(0)
     {
+        m_config = get_config();
+        m_engines_size = get_engines_size(m_config);
         // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
-        if(error != hipSuccess)
+        if(allocator.allocate(&m_engines, m_engines_size, m_stream) != ROCRAND_STATUS_SUCCESS)
         {
             throw ROCRAND_STATUS_ALLOCATION_FAILED;
         }
@@ -133,7 +414,8 @@ public:
 
     ~rocrand_mrg32k3a()
     {
-        hipFree(m_engines);
+        allocator.deallocate(m_engines, m_stream);
+        m_range_engines.release(m_stream);
     }
 
     void reset()
@@ -152,29 +434,229 @@ public:
             seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
         }
         m_seed = seed;
-        m_engines_initialized = false;
+        // Engines prepared by prepare_seed() are used without initialization
+        m_engines_initialized = m_prepared.swap(seed, m_engines, m_engines_size, m_stream);
     }
 
     void set_offset(unsigned long long offset)
     {
         m_offset = offset;
         m_engines_initialized = false;
+        m_prepared.invalidate();
     }
 
-    rocrand_status init()
+    /// Engines of \p rank start at subsequence rank * ((2^64 - 1) / \p nranks),
+    /// subsequences of ranks do not overlap as long as engines and children
+    /// created by fork() stay in the block of the rank.
+    void set_subsequence_partition(unsigned int rank, unsigned int nranks)
     {
-        if (m_engines_initialized)
+        m_subsequence_shift = rank * (~0ULL / nranks);
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+    }
+
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        const rocrand_ordering previous_order = m_order;
+        m_order = order;
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+        const rocrand_status status = update_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            m_order = previous_order;
+        }
+        return status;
+    }
+
+    /// Sets the number of engines, 0 restores the number of engines
+    /// of the ordering. Results depend only on the number of engines, so
+    /// they are the same on all devices for the same number.
+    rocrand_status set_engine_count(unsigned int engine_count)
+    {
+        const unsigned int previous_engine_count = m_engine_count;
+        m_engine_count = engine_count;
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+        const rocrand_status status = update_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            m_engine_count = previous_engine_count;
+        }
+        return status;
+    }
+
+    /// Returns the number of bytes of device memory allocated by the generator.
+    size_t get_memory_usage() const
+    {
+        return sizeof(engine_type) * m_engines_size
+            + m_prepared.memory_usage()
+            + m_range_engines.memory_usage()
+            + m_poisson.memory_usage();
+    }
+
+    /// Sets the allocator of device memory, engines are reallocated by it
+    /// and the state of the generator is reset. Poisson tables and other
+    /// memory allocated before are freed by their allocators.
+    rocrand_status set_allocator(const rocrand_host::detail::device_allocator& new_allocator)
+    {
+        if(new_allocator == allocator)
             return ROCRAND_STATUS_SUCCESS;
+        // The generator is not changed if the new allocator fails
+        engine_type * engines = NULL;
+        if(new_allocator.allocate(&engines, m_engines_size, m_stream) != ROCRAND_STATUS_SUCCESS)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        m_engines_initialized = false;
+        m_prepared.release();
+        m_range_engines.release(m_stream);
+        allocator.deallocate(m_engines, m_stream);
+        m_engines = engines;
+        allocator = new_allocator;
+        return ROCRAND_STATUS_SUCCESS;
+    }
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, m_seed, m_offset
+    /// Returns the number of bytes of a state saved by save_state().
+    size_t get_state_size() const
+    {
+        return rocrand_host::detail::get_state_size(sizeof(engine_type) * m_engines_size);
+    }
+
+    /// Saves seed, offset, ordering, number of engines and engines (if they
+    /// are initialized) to \p state, copies are enqueued to \p stream.
+    rocrand_status save_state(void * state, hipStream_t stream) const
+    {
+        rocrand_host::detail::generator_state_header header = make_state_header();
+        header.engine_count = m_engine_count;
+        header.initialized = m_engines_initialized ? 1 : 0;
+        header.engines_size = m_engines_size;
+        return rocrand_host::detail::save_state(
+            state, header, NULL, m_engines,
+            m_engines_initialized ? sizeof(engine_type) * m_engines_size : 0, stream
         );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
+    }
+
+    /// Restores a state saved by save_state(), engines are copied on \p stream
+    /// without initialization. The number of engines must be the same as when
+    /// the state was saved (orderings which depend on the device may differ).
+    rocrand_status load_state(const void * state, hipStream_t stream)
+    {
+        rocrand_host::detail::generator_state_header header;
+        rocrand_status status =
+            rocrand_host::detail::load_state_header(state, rng_type, header, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        // Engines of the state must fit engines of its settings, the
+        // generator is not changed otherwise
+        const size_t engines_size = get_engines_size(
+            get_config(header.order, header.engine_count), header.order, header.engine_count
+        );
+        if(header.engines_size != engines_size)
+            return ROCRAND_STATUS_TYPE_ERROR;
+
+        restore_state_settings(header);
+        m_engine_count = header.engine_count;
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+        status = update_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(header.initialized == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        status = rocrand_host::detail::load_state_engines(
+            state, m_engines, sizeof(engine_type) * m_engines_size, stream
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Initializes engines of \p seed in a second buffer on a separate
+    /// stream, the next set_seed() of the same seed swaps them in
+    /// without initialization.
+    rocrand_status prepare_seed(unsigned long long seed)
+    {
+        if(seed == 0)
+        {
+            seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
+        }
+        rocrand_status status = m_prepared.begin(m_engines_size, allocator);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        status = init_engines(m_prepared.engines(), 0, 0, seed, m_prepared.stream(), m_engines_size);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        return m_prepared.end(seed);
+    }
+
+    /// Initializes the generator as a child of \p parent (see
+    /// rocrand_fork_generator()): settings are copied, engines are copied
+    /// from the current engines of \p parent and skipped ahead on the device
+    /// by (subsequence_id + 1) times the number of engines subsequences,
+    /// so sequences of the parent and of its children do not overlap.
+    rocrand_status fork(rocrand_mrg32k3a& parent, unsigned long long subsequence_id)
+    {
+        ROCRAND_PROFILING_NAMED_RANGE("mrg32k3a::fork");
+        copy_settings(parent);
+        m_engine_count = parent.m_engine_count;
+        rocrand_status status = set_allocator(parent.allocator);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        status = update_engines();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        // Engines of the parent are used on the same stream
+        status = parent.init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        const unsigned long long subsequences = (subsequence_id + 1) * m_engines_size;
+        m_subsequence_shift = parent.m_subsequence_shift + subsequences;
+        status = rocrand_host::detail::fork_engines(
+            m_engines, parent.m_engines, m_engines_size, subsequences, m_stream
+        );
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        count_launch();
+        m_engines_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if (m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+        ROCRAND_PROFILING_NAMED_RANGE("mrg32k3a::init");
+        rocrand_host::detail::init_stats_scope init_scope(stats);
+        // A captured initialization would reset engines on every launch
+        // of the graph
+        if (is_capturing())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
+        // Engines of the same settings may be cached by an earlier process
+        const rocrand_host::detail::engine_cache_key cache_key =
+            rocrand_host::detail::make_engine_cache_key(
+                rng_type, sizeof(engine_type), m_engines_size, m_seed, m_offset,
+                m_subsequence_shift, m_order == ROCRAND_ORDERING_PSEUDO_SEEDED
+            );
+        const size_t engines_bytes = sizeof(engine_type) * m_engines_size;
+        if (rocrand_host::detail::load_cached_engines(cache_key, m_engines, engines_bytes, m_stream))
+        {
+            m_engines_initialized = true;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        rocrand_status status = init_engines(m_engines, 0, 0, m_seed, m_stream, m_engines_size);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        rocrand_host::detail::store_cached_engines(cache_key, m_engines, engines_bytes, m_stream);
+
         m_engines_initialized = true;
 
         return ROCRAND_STATUS_SUCCESS;
@@ -188,16 +670,40 @@ public:
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
+        return generate_engines(m_engines, data, data_size, distribution);
+    }
+
+    /// Generates numbers [start, start + data_size) of the sequence returned
+    /// by generate() after initialization without changing the state of the
+    /// generator, engines of the range are skipped ahead in a temporary buffer.
+    rocrand_status generate_range(unsigned int * data,
+                                  unsigned long long start,
+                                  size_t data_size)
+    {
+        if(data_size == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        // Engines of ranges are allocated by the first range (not in
+        // captured graphs) and kept by the generator
+        if(!m_range_engines.reserved(m_engines_size) && is_capturing())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        rocrand_status status = m_range_engines.reserve(m_engines_size, allocator, m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
 
-        return ROCRAND_STATUS_SUCCESS;
+        // start-th number is generated by engine start % m_engines_size
+        // after start / m_engines_size numbers, only engines which
+        // generate numbers of the range are initialized
+        engine_type * engines = m_range_engines.engines();
+        status = init_engines(engines, start / m_engines_size,
+                              static_cast<unsigned int>(start % m_engines_size),
+                              m_seed, m_stream,
+                              rocrand_host::detail::get_active_engines(m_engines_size, data_size));
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        mrg_uniform_distribution<unsigned int> udistribution;
+        return generate_engines(engines, data, data_size, udistribution);
     }
 
     template<class T>
@@ -207,67 +713,220 @@ public:
         return generate(data, data_size, udistribution);
     }
 
+    /// Doubles are computed from one number normalized by ROCRAND_MRG32K3A_M1.
+    /// Numbers scaled to [0, UINT_MAX] are used for the other resolutions,
+    /// as by rocrand_uniform_double_fast() and rocrand_uniform_double_full().
+    rocrand_status generate_uniform(double * data, size_t data_size)
+    {
+        if(m_double_resolution == ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT)
+        {
+            uniform_double_fast_distribution distribution;
+            return generate(data, data_size, distribution);
+        }
+        if(m_double_resolution == ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT)
+        {
+            uniform_double_full_distribution distribution;
+            return generate(data, data_size, distribution);
+        }
+
+        mrg_uniform_distribution<double> udistribution;
+        return generate(data, data_size, udistribution);
+    }
+
     template<class T>
     rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
     {
-        // data_size must be even
-        // data must be aligned to 2 * sizeof(T) bytes
-        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(T))) != 0)
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
         {
-            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+            normal_ziggurat_distribution<T> distribution(mean, stddev);
+            return generate(data, data_size, make_rejection_distribution<T>(distribution));
+        }
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_INVERSION)
+        {
+            normal_inversion_distribution<T> distribution(mean, stddev);
+            return generate(data, data_size, make_rejection_distribution<T>(distribution));
         }
 
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
-            return status;
+        if(m_math_mode == ROCRAND_MATH_MODE_FAST)
+        {
+            mrg_normal_fast_distribution<T> distribution(mean, stddev);
+            return generate_box_muller(data, data_size, distribution);
+        }
 
         mrg_normal_distribution<T> distribution(mean, stddev);
-
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
-
-        return ROCRAND_STATUS_SUCCESS;
+        return generate_box_muller(data, data_size, distribution);
     }
 
     template<class T>
     rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
     {
-        // data_size must be even
-        // data must be aligned to 2 * sizeof(T) bytes
-        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(T))) != 0)
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
         {
-            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+            log_normal_ziggurat_distribution<T> distribution(mean, stddev);
+            return generate(data, data_size, make_rejection_distribution<T>(distribution));
+        }
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_INVERSION)
+        {
+            log_normal_inversion_distribution<T> distribution(mean, stddev);
+            return generate(data, data_size, make_rejection_distribution<T>(distribution));
+        }
+
+        if(m_math_mode == ROCRAND_MATH_MODE_FAST)
+        {
+            mrg_log_normal_fast_distribution<T> distribution(mean, stddev);
+            return generate_box_muller(data, data_size, distribution);
         }
 
+        mrg_log_normal_distribution<T> distribution(mean, stddev);
+        return generate_box_muller(data, data_size, distribution);
+    }
+
+    // Normal and log-normal values of the Box-Muller transform (see
+    // generate_normal() and generate_log_normal())
+    template<class T, class Distribution>
+    rocrand_status generate_box_muller(T * data, size_t data_size,
+                                       const Distribution& distribution)
+    {
         rocrand_status status = init();
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
-        mrg_log_normal_distribution<T> distribution(mean, stddev);
-
+        const unsigned int blocks =
+            rocrand_host::detail::get_generate_blocks<engine_type, T, Distribution>(
+                rocrand_host::detail::generate_normal_kernel, m_config,
+                rocrand_host::detail::get_active_engines(m_engines_size, (data_size + 1) / 2)
+            );
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            dim3(blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size),
+            data, data_size, distribution
         );
         // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
+        if(rocrand_host::detail::launch_failed())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch(data_size);
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    // Half values are generated in pairs from 32-bit numbers (16 bits
+    // per value), so data_size must be even and data must be aligned
+    // to 2 * sizeof(__half) bytes
+    rocrand_status generate_uniform(__half * data, size_t data_size)
+    {
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(__half))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        mrg_uniform_distribution<__half2> distribution;
+        return generate(reinterpret_cast<__half2 *>(data), data_size / 2, distribution);
+    }
+
+    rocrand_status generate_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(__half))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        mrg_normal_distribution<__half2> distribution(mean, stddev);
+        return generate(reinterpret_cast<__half2 *>(data), data_size / 2, distribution);
+    }
+
+    rocrand_status generate_log_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(__half))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        mrg_log_normal_distribution<__half2> distribution(mean, stddev);
+        return generate(reinterpret_cast<__half2 *>(data), data_size / 2, distribution);
+    }
+
+    template<class IntType>
+    rocrand_status generate_uniform_int(IntType * data, size_t data_size,
+                                        IntType lo, IntType hi)
+    {
+        uniform_int_distribution<IntType> distribution(lo, hi);
+        return generate(data, data_size,
+                        make_rejection_distribution<IntType>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T * data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate(data, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    // 32 trials with probability p per value, bits rounded up to whole values
+    rocrand_status generate_bernoulli_bits(unsigned int * data, size_t bits, double p)
+    {
+        bernoulli_bits_distribution distribution(p);
+        return generate(data, (bits + 31) / 32,
+                        make_rejection_distribution<unsigned int>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T a, T b)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, a, b);
+        return generate(data, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    // Vectors are columns of a data_size x dimensions column-major matrix
+    template<class T>
+    rocrand_status generate_multivariate_normal(T * data, size_t data_size,
+                                                unsigned int dimensions,
+                                                const T * mean, const T * factor)
+    {
+        return generate_multivariate_normal_dimensions(*this, data, data_size,
+                                                       dimensions, mean, factor);
+    }
+
+    template<class T, unsigned int MaxDimensions>
+    rocrand_status generate_multivariate_normal(T * data, size_t data_size,
+                                                const multivariate_normal_distribution<T, MaxDimensions>& distribution)
+    {
+        return generate(data + (distribution.dimensions - 1) * data_size, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
+        // Large lambda: rejection on the device, no tables are built
+        if(lambda >= rocrand_device::detail::lambda_threshold_small)
+        {
+            poisson_rejection_distribution distribution(lambda);
+            return generate(data, data_size,
+                            make_rejection_distribution<unsigned int>(distribution));
+        }
+
         try
         {
-            m_poisson.set_lambda(lambda);
+            m_poisson.set_lambda(lambda, poisson_cache, allocator, m_stream, is_capturing());
         }
         catch(rocrand_status status)
         {
@@ -276,10 +935,102 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    // Every value has its own lambda, lambdas is in device memory
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size,
+                                    const double * lambdas)
+    {
+        poisson_array_distribution distribution { lambdas };
+        return generate(data, data_size,
+                        make_rejection_distribution<unsigned int>(distribution));
+    }
+
+    // Every value has its own number of trials and probability,
+    // trials and probabilities are in device memory
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     const unsigned int * trials,
+                                     const double * probabilities)
+    {
+        binomial_array_distribution distribution { trials, probabilities };
+        return generate(data, data_size,
+                        make_rejection_distribution<unsigned int>(distribution));
+    }
+
+    // Counts of categories of a value are data_size values apart
+    rocrand_status generate_multinomial(unsigned int * data, size_t data_size,
+                                        const unsigned int * trials,
+                                        const double * probabilities,
+                                        unsigned int categories)
+    {
+        multinomial_array_distribution distribution {
+            trials, probabilities, categories, data_size, data
+        };
+        return generate(data + (categories - 1) * data_size, data_size,
+                        make_rejection_distribution<unsigned int>(distribution));
+    }
+
+    /// Generates numbers of requests in order (see rocrand_generate_batch()),
+    /// up to max_batch_requests requests are processed by one kernel launch.
+    rocrand_status generate_batch(const rocrand_generate_request * requests,
+                                  size_t count)
+    {
+        rocrand_status status = rocrand_host::detail::validate_batch(requests, count);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        const unsigned int blocks =
+            rocrand_host::detail::get_launch_blocks(
+                static_cast<rocrand_host::detail::generate_batch_kernel_type<engine_type>>(
+                    rocrand_host::detail::generate_batch_kernel
+                ),
+                m_config
+            );
+        for(size_t begin = 0; begin < count; begin += rocrand_host::detail::max_batch_requests)
+        {
+            const unsigned int batch_count = static_cast<unsigned int>(
+                std::min<size_t>(rocrand_host::detail::max_batch_requests, count - begin)
+            );
+            rocrand_host::detail::batch_requests batch;
+            status = rocrand_host::detail::prepare_batch(batch, requests + begin, batch_count,
+                                                         m_normal_method,
+                                                         m_poisson, poisson_cache,
+                                                         allocator, m_stream, is_capturing());
+            if (status != ROCRAND_STATUS_SUCCESS)
+                return status;
+
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_batch_kernel),
+                dim3(blocks), dim3(m_config.threads), 0, m_stream,
+                m_engines, static_cast<unsigned int>(m_engines_size), batch
+            );
+            // Check kernel status
+            if(rocrand_host::detail::launch_failed())
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+            count_launch(rocrand_host::detail::get_batch_size(batch));
+        }
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
 private:
     bool m_engines_initialized;
     engine_type * m_engines;
     size_t m_engines_size;
+    rocrand_host::detail::launch_config m_config;
+    // Number of engines set by set_engine_count(), 0 if not set
+    unsigned int m_engine_count;
+    // First subsequence of engines, not 0 for children created by fork()
+    // and for partitions set by set_subsequence_partition()
+    unsigned long long m_subsequence_shift;
+    // Engines of the next seed (see prepare_seed())
+    rocrand_host::detail::prepared_engines<engine_type> m_prepared;
+    // Engines of generate_range()
+    rocrand_host::detail::range_engines<engine_type> m_range_engines;
+
+    // Grid used when the device can not be queried
     #ifdef __HIP_PLATFORM_NVCC__
     static const uint32_t s_threads = 128;
     static const uint32_t s_blocks = 128;
@@ -287,10 +1038,140 @@ private:
     static const uint32_t s_threads = 256;
     static const uint32_t s_blocks = 512;
     #endif
+    // Threads per block of the init kernel
+    static const uint32_t s_init_threads = 256;
 
-    // For caching of Poisson for consecutive generations with the same lambda
+    // Cache of Poisson tables, also used by requests of batches
     poisson_distribution_manager<> m_poisson;
 
+    rocrand_status init_engines(engine_type * engines,
+                                unsigned long long offset,
+                                unsigned int first_engine,
+                                unsigned long long seed,
+                                hipStream_t stream,
+                                size_t engines_count)
+    {
+        const bool seeded = m_order == ROCRAND_ORDERING_PSEUDO_SEEDED;
+        if(!seeded && first_engine == 0 && engines_count == m_engines_size)
+        {
+            // Engines are consecutive subsequences, most of them are
+            // computed from their neighbours in one jump
+            rocrand_status status = rocrand_host::detail::init_engines_by_steps(
+                engines, m_engines_size, seed, m_subsequence_shift, m_offset + offset, stream
+            );
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            count_launch();
+
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const unsigned int engines_size = static_cast<unsigned int>(m_engines_size);
+        const unsigned int count = static_cast<unsigned int>(engines_count);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+            dim3((count + s_init_threads - 1) / s_init_threads),
+            dim3(s_init_threads), 0, stream,
+            engines, engines_size, count, seed, m_offset + offset, first_engine,
+            m_subsequence_shift, seeded
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution>
+    rocrand_status generate_engines(engine_type * engines,
+                                    T * data, size_t data_size,
+                                    const Distribution& distribution)
+    {
+        const unsigned int blocks =
+            rocrand_host::detail::get_generate_blocks<engine_type, T, Distribution>(
+                rocrand_host::detail::generate_kernel, m_config,
+                rocrand_host::detail::get_active_engines(m_engines_size, data_size)
+            );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+            dim3(blocks), dim3(m_config.threads), 0, m_stream,
+            engines, static_cast<unsigned int>(m_engines_size),
+            data, data_size, distribution
+        );
+        // Check kernel status
+        if(rocrand_host::detail::launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch(data_size);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // The legacy ordering uses the same grid on all devices
+    rocrand_host::detail::launch_config get_config() const
+    {
+        return get_config(m_order, m_engine_count);
+    }
+
+    rocrand_host::detail::launch_config get_config(rocrand_ordering order,
+                                                   unsigned int engine_count) const
+    {
+        if(legacy_order(order))
+        {
+            return { s_threads, s_blocks, 0, 0 };
+        }
+        return rocrand_host::detail::get_launch_config(
+            ROCRAND_RNG_PSEUDO_MRG32K3A,
+            static_cast<
+                rocrand_host::detail::generate_kernel_type<
+                    engine_type, unsigned int, mrg_uniform_distribution<unsigned int>
+                >
+            >(rocrand_host::detail::generate_kernel),
+            { s_threads, s_blocks, 0, 0 }
+        );
+    }
+
+    size_t get_engines_size(const rocrand_host::detail::launch_config& config) const
+    {
+        return get_engines_size(config, m_order, m_engine_count);
+    }
+
+    size_t get_engines_size(const rocrand_host::detail::launch_config& config,
+                            rocrand_ordering order,
+                            unsigned int engine_count) const
+    {
+        if(engine_count != 0)
+        {
+            return engine_count;
+        }
+        if(order == ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT)
+        {
+            return device_independent_engines;
+        }
+        return config.threads * config.blocks;
+    }
+
+    // Computes the grid and reallocates engines when their number is changed
+    rocrand_status update_engines()
+    {
+        const rocrand_host::detail::launch_config config = get_config();
+        const size_t engines_size = get_engines_size(config);
+        if(engines_size != m_engines_size)
+        {
+            // The old engines and grid are kept if the allocation fails
+            engine_type * engines = NULL;
+            if(allocator.allocate(&engines, engines_size, m_stream) != ROCRAND_STATUS_SUCCESS)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            allocator.deallocate(m_engines, m_stream);
+            m_engines = engines;
+            m_engines_size = engines_size;
+        }
+        m_config = config;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     // m_seed from base_type
     // m_offset from base_type
 };
@@ -0,0 +1,955 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/*
+ * M. Matsumoto and T. Nishimura, Mersenne Twister: A 623-dimensionally
+ * equidistributed uniform pseudo-random number generator, 1998
+ *
+ * H. Haramoto, M. Matsumoto, T. Nishimura, F. Panneton, P. L'Ecuyer,
+ * Efficient Jump Ahead for F2-Linear Random Number Generators, 2008
+ */
+
+#ifndef ROCRAND_RNG_MT19937_H_
+#define ROCRAND_RNG_MT19937_H_
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+#include "profiling.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+#include "launch_config.hpp"
+#include "prepared_engines.hpp"
+#include "sobol_tables.hpp"
+#include "rocrand_mt19937_precomputed.h"
+
+#define MT19937_M 397
+#define MT19937_MATRIX_A 0x9908b0dfU
+#define MT19937_UPPER_MASK 0x80000000U
+#define MT19937_LOWER_MASK 0x7fffffffU
+
+// Threads per block of the init kernel, each thread computes
+// MT19937_INIT_VALUES values of the jumped state
+#define MT19937_INIT_THREADS 256
+#define MT19937_INIT_VALUES ((MT19937_N + MT19937_INIT_THREADS - 1) / MT19937_INIT_THREADS)
+// Values of the sequence kept in shared memory during jumps
+#define MT19937_JUMP_RING 2048
+// Words of the jump polynomial processed between generations of values
+// (MT19937_JUMP_CHUNK * 32 + MT19937_N values must fit in the ring)
+#define MT19937_JUMP_CHUNK 32
+
+namespace rocrand_host {
+namespace detail {
+
+    // Engine of the block-cooperative MT19937 generator: the last MT19937_N
+    // values of its sequence (before tempering) in a ring buffer. The
+    // whole block generates numbers of one engine, so the state (2.5 KB)
+    // is in shared memory only while the block generates, and registers
+    // of threads do not hold any part of it.
+    struct mt19937_engine
+    {
+        unsigned int mt[MT19937_N];
+        // Position of the oldest value in mt
+        unsigned int index;
+
+        // Copies the engine, called by all threads of the block
+        __forceinline__ __device__
+        void copy(const mt19937_engine * engine)
+        {
+            for(unsigned int i = hipThreadIdx_x; i < MT19937_N; i += hipBlockDim_x)
+            {
+                mt[i] = engine->mt[i];
+            }
+            if(hipThreadIdx_x == 0)
+            {
+                index = engine->index;
+            }
+            __syncthreads();
+        }
+
+        __forceinline__ __device__ __host__
+        static unsigned int next_value(const unsigned int x0,
+                                       const unsigned int x1,
+                                       const unsigned int xm)
+        {
+            const unsigned int y = (x0 & MT19937_UPPER_MASK) | (x1 & MT19937_LOWER_MASK);
+            return xm ^ (y >> 1) ^ ((y & 1U) ? MT19937_MATRIX_A : 0U);
+        }
+
+        __forceinline__ __device__ __host__
+        static unsigned int temper(unsigned int y)
+        {
+            y ^= y >> 11;
+            y ^= (y << 7) & 0x9d2c5680U;
+            y ^= (y << 15) & 0xefc60000U;
+            y ^= y >> 18;
+            return y;
+        }
+
+        // Generates the next hipBlockDim_x numbers of the sequence, thread i
+        // gets the i-th of them. Must be called by all threads of the block.
+        //
+        // A value depends on the value MT19937_N - MT19937_M positions back,
+        // so at most MT19937_N - MT19937_M values are computed in parallel.
+        __forceinline__ __device__
+        unsigned int operator()()
+        {
+            const unsigned int first_index = index;
+            unsigned int result = 0;
+            for(unsigned int first = 0; first < hipBlockDim_x; first += MT19937_N - MT19937_M)
+            {
+                const bool active = hipThreadIdx_x >= first
+                    && hipThreadIdx_x < first + MT19937_N - MT19937_M;
+                const unsigned int i = (first_index + hipThreadIdx_x) % MT19937_N;
+                unsigned int value = 0;
+                if(active)
+                {
+                    value = next_value(
+                        mt[i], mt[(i + 1) % MT19937_N], mt[(i + MT19937_M) % MT19937_N]
+                    );
+                }
+                // mt[i + 1] is replaced by the next thread
+                __syncthreads();
+                if(active)
+                {
+                    mt[i] = value;
+                    result = value;
+                }
+                if(hipThreadIdx_x == 0 && first + MT19937_N - MT19937_M >= hipBlockDim_x)
+                {
+                    index = (first_index + hipBlockDim_x) % MT19937_N;
+                }
+                __syncthreads();
+            }
+            return temper(result);
+        }
+    };
+
+    // Moves the state (values x_0...x_{MT19937_N - 1} in ring) ahead by
+    // the distance of polynomial. The jumped state is sum c_i * T^i(x),
+    // T^i(x) are values x_i...x_{i + MT19937_N - 1} of the sequence, so
+    // value k of the result is the xor of x_{i + k} over coefficients
+    // c_i = 1: values of the sequence are generated by the block and each
+    // thread accumulates its values of the result.
+    __forceinline__ __device__
+    void mt19937_jump(unsigned int * ring, const unsigned int * polynomial)
+    {
+        const unsigned int mask = MT19937_JUMP_RING - 1;
+        unsigned int result[MT19937_INIT_VALUES];
+        for(unsigned int v = 0; v < MT19937_INIT_VALUES; v++)
+        {
+            result[v] = 0;
+        }
+
+        unsigned int generated = MT19937_N;
+        for(unsigned int first_word = 0; first_word < MT19937_N; first_word += MT19937_JUMP_CHUNK)
+        {
+            const unsigned int last_word = min(first_word + MT19937_JUMP_CHUNK, static_cast<unsigned int>(MT19937_N));
+            // Values up to x_{32 * last_word - 1 + MT19937_N - 1} are needed
+            const unsigned int needed = 32 * last_word + MT19937_N - 1;
+            while(generated < needed)
+            {
+                const unsigned int count = min(static_cast<unsigned int>(MT19937_N - MT19937_M), needed - generated);
+                if(hipThreadIdx_x < count)
+                {
+                    const unsigned int n = generated + hipThreadIdx_x;
+                    ring[n & mask] = mt19937_engine::next_value(
+                        ring[(n - MT19937_N) & mask],
+                        ring[(n - MT19937_N + 1) & mask],
+                        ring[(n - MT19937_N + MT19937_M) & mask]
+                    );
+                }
+                generated += count;
+                __syncthreads();
+            }
+
+            for(unsigned int w = first_word; w < last_word; w++)
+            {
+                unsigned int bits = polynomial[w];
+                while(bits != 0)
+                {
+                    const unsigned int i = w * 32 + __ffs(bits) - 1;
+                    bits &= bits - 1;
+                    for(unsigned int v = 0; v < MT19937_INIT_VALUES; v++)
+                    {
+                        const unsigned int k = hipThreadIdx_x + v * MT19937_INIT_THREADS;
+                        if(k < MT19937_N)
+                            result[v] ^= ring[(i + k) & mask];
+                    }
+                }
+            }
+            // Values of this chunk are replaced by the next generation
+            __syncthreads();
+        }
+
+        for(unsigned int v = 0; v < MT19937_INIT_VALUES; v++)
+        {
+            const unsigned int k = hipThreadIdx_x + v * MT19937_INIT_THREADS;
+            if(k < MT19937_N)
+                ring[k] = result[v];
+        }
+        __syncthreads();
+    }
+
+    // Initializes engines on the device, one block per engine: the state of
+    // init_genrand(seed) is moved ahead by (first_engine + engine_id) *
+    // 2^MT19937_JUMP_LOG2 with one jump per nonzero bit of the sum
+    __global__
+    __launch_bounds__(MT19937_INIT_THREADS)
+    void init_engines_kernel(mt19937_engine * engines,
+                             const unsigned int * jump_polynomials,
+                             const unsigned int first_engine,
+                             unsigned long long seed)
+    {
+        const unsigned int engine_id = hipBlockIdx_x;
+        const unsigned int jumps = first_engine + engine_id;
+        __shared__ unsigned int ring[MT19937_JUMP_RING];
+
+        if(hipThreadIdx_x == 0)
+        {
+            seed = seed ^ (seed >> 32);
+            ring[0] = static_cast<unsigned int>(seed);
+            for(unsigned int i = 1; i < MT19937_N; i++)
+            {
+                ring[i] = 1812433253U * (ring[i - 1] ^ (ring[i - 1] >> 30)) + i;
+            }
+        }
+        __syncthreads();
+
+        for(unsigned int k = 0; k < MT19937_JUMP_POLYNOMIALS; k++)
+        {
+            if(jumps & (1U << k))
+            {
+                mt19937_jump(ring, jump_polynomials + k * MT19937_N);
+            }
+        }
+
+        for(unsigned int i = hipThreadIdx_x; i < MT19937_N; i += hipBlockDim_x)
+        {
+            engines[engine_id].mt[i] = ring[i];
+        }
+        if(hipThreadIdx_x == 0)
+        {
+            engines[engine_id].index = 0;
+        }
+    }
+
+    template<class Distribution>
+    __forceinline__ __device__
+    auto mt19937_next_value(mt19937_engine& engine,
+                            const Distribution& distribution)
+        -> decltype(distribution(engine()))
+    {
+        return distribution(engine());
+    }
+
+    // Two numbers per double (ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT)
+    __forceinline__ __device__
+    double mt19937_next_value(mt19937_engine& engine,
+                              const uniform_double_full_distribution& distribution)
+    {
+        const unsigned int v1 = engine();
+        const unsigned int v2 = engine();
+        return distribution(v1, v2);
+    }
+
+    // Distributions with rejection: numbers of the engine are shared by
+    // the whole block, so all threads draw together until every thread
+    // has accepted a value (see mtgp32_next_value)
+    template<class Type, class Distribution>
+    __forceinline__ __device__
+    Type mt19937_next_value(mt19937_engine& engine,
+                            const rejection_distribution<Type, Distribution>& distribution)
+    {
+        __shared__ unsigned int rejected;
+
+        Type value = 0;
+        bool accepted = false;
+        while(true)
+        {
+            Type candidate;
+            const bool candidate_accepted = distribution(engine, candidate);
+            if(!accepted && candidate_accepted)
+            {
+                value = candidate;
+                accepted = true;
+            }
+
+            if(hipThreadIdx_x == 0)
+                rejected = 0;
+            __syncthreads();
+            if(!accepted)
+                rejected = 1;
+            __syncthreads();
+            const bool done = rejected == 0;
+            __syncthreads();
+            if(done)
+                return value;
+        }
+    }
+
+    // Every call of the engine produces BlockSize consecutive numbers
+    // of its sequence, the layout is the same as of MTGP32.
+    template<unsigned int BlockSize, class Type, class Distribution>
+    __global__
+    __launch_bounds__(BlockSize)
+    void generate_kernel(mt19937_engine * engines,
+                         const unsigned int engines_size,
+                         Type * data,
+                         const size_t size,
+                         const size_t size_up, // size rounded up to the nearest multiple of BlockSize
+                         const size_t size_down, // size rounded down to the nearest multiple of BlockSize
+                         Distribution distribution)
+    {
+        const unsigned int stride = engines_size * BlockSize;
+        // Blocks of BlockSize values
+        const unsigned int active_engines = get_active_engines(engines_size, size_up / BlockSize);
+
+        __shared__ mt19937_engine engine;
+        for(unsigned int engine_id = hipBlockIdx_x; engine_id < active_engines; engine_id += hipGridDim_x)
+        {
+            size_t index = engine_id * BlockSize + hipThreadIdx_x;
+
+            // Load device engine
+            engine.copy(&engines[engine_id]);
+
+            while(index < size_down)
+            {
+                data[index] = mt19937_next_value(engine, distribution);
+                // Next position
+                index += stride;
+            }
+            while(index < size_up)
+            {
+                auto value = mt19937_next_value(engine, distribution);
+                if(index < size)
+                    data[index] = value;
+                // Next position
+                index += stride;
+            }
+
+            // Save engine with its state
+            engines[engine_id].copy(&engine);
+        }
+    }
+
+    template<class Type, class Distribution>
+    using mt19937_generate_kernel_type = void (*)(mt19937_engine *,
+                                                  const unsigned int,
+                                                  Type *,
+                                                  const size_t,
+                                                  const size_t,
+                                                  const size_t,
+                                                  Distribution);
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_mt19937 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_MT19937>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_MT19937>;
+    using engine_type = ::rocrand_host::detail::mt19937_engine;
+
+    // Maximum number of engines, engines are 2^MT19937_JUMP_LOG2 numbers apart
+    static const unsigned int max_engines = 1U << MT19937_JUMP_POLYNOMIALS;
+    // Number of engines with ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT
+    static const unsigned int device_independent_engines = 512;
+
+    rocrand_mt19937(unsigned long long seed = 0,
+                    unsigned long long offset = 0,
+                    hipStream_t stream = 0)
+        : base_type(seed, offset, stream),
+          m_engines_initialized(false), m_engines(NULL),
+          m_jump_polynomials(&h_mt19937_jump_polynomials[0][0], MT19937_N, MT19937_JUMP_POLYNOMIALS),
+          m_engine_count(0),
+          m_first_engine(0),
+          m_partition_engines(max_engines)
+    {
+        m_config = get_config();
+        m_engines_size = get_engines_size(m_config);
+        // Allocate device random number engines
+        if(allocator.allocate(&m_engines, m_engines_size, m_stream) != ROCRAND_STATUS_SUCCESS)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+    }
+
+    ~rocrand_mt19937()
+    {
+        allocator.deallocate(m_engines, m_stream);
+    }
+
+    void reset()
+    {
+        m_engines_initialized = false;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        // Engines prepared by prepare_seed() are used without initialization
+        m_engines_initialized = m_prepared.swap(seed, m_engines, m_engines_size, m_stream);
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+    }
+
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        const rocrand_ordering previous_order = m_order;
+        m_order = order;
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+        const rocrand_status status = update_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            m_order = previous_order;
+        }
+        return status;
+    }
+
+    /// Sets the number of engines (at most max_engines), 0 restores the
+    /// number of engines of the ordering.
+    rocrand_status set_engine_count(unsigned int engine_count)
+    {
+        if(engine_count > max_engines)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        const unsigned int previous_engine_count = m_engine_count;
+        m_engine_count = engine_count;
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+        const rocrand_status status = update_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            m_engine_count = previous_engine_count;
+        }
+        return status;
+    }
+
+    /// Engines of \p rank are engines [rank * P, (rank + 1) * P) of the seed
+    /// (2^MT19937_JUMP_LOG2 numbers apart) where P is max_engines / \p nranks,
+    /// the number of engines is limited by P.
+    rocrand_status set_subsequence_partition(unsigned int rank, unsigned int nranks)
+    {
+        if(nranks > max_engines)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_partition_engines = max_engines / nranks;
+        m_first_engine = rank * m_partition_engines;
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+        return update_engines();
+    }
+
+    /// Returns the number of bytes of device memory allocated by the generator.
+    size_t get_memory_usage() const
+    {
+        return sizeof(engine_type) * m_engines_size
+            + m_jump_polynomials.size_bytes()
+            + m_prepared.memory_usage()
+            + m_poisson.memory_usage();
+    }
+
+    /// Sets the allocator of device memory, engines are reallocated by it
+    /// and the state of the generator is reset.
+    rocrand_status set_allocator(const rocrand_host::detail::device_allocator& new_allocator)
+    {
+        if(new_allocator == allocator)
+            return ROCRAND_STATUS_SUCCESS;
+        // The generator is not changed if the new allocator fails
+        engine_type * engines = NULL;
+        if(new_allocator.allocate(&engines, m_engines_size, m_stream) != ROCRAND_STATUS_SUCCESS)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        m_engines_initialized = false;
+        m_prepared.release();
+        allocator.deallocate(m_engines, m_stream);
+        m_engines = engines;
+        allocator = new_allocator;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns the number of bytes of a state saved by save_state().
+    size_t get_state_size() const
+    {
+        return rocrand_host::detail::get_state_size(sizeof(engine_type) * m_engines_size);
+    }
+
+    /// Saves seed, offset, ordering, number of engines and engines (if they
+    /// are initialized) to \p state, copies are enqueued to \p stream.
+    rocrand_status save_state(void * state, hipStream_t stream) const
+    {
+        rocrand_host::detail::generator_state_header header = make_state_header();
+        header.engine_count = m_engine_count;
+        header.initialized = m_engines_initialized ? 1 : 0;
+        header.engines_size = m_engines_size;
+        return rocrand_host::detail::save_state(
+            state, header, NULL, m_engines,
+            m_engines_initialized ? sizeof(engine_type) * m_engines_size : 0, stream
+        );
+    }
+
+    /// Restores a state saved by save_state(), engines are copied on \p stream
+    /// without initialization.
+    rocrand_status load_state(const void * state, hipStream_t stream)
+    {
+        rocrand_host::detail::generator_state_header header;
+        rocrand_status status =
+            rocrand_host::detail::load_state_header(state, rng_type, header, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        // Engines of the state must fit engines of its settings, the
+        // generator is not changed otherwise
+        const size_t engines_size = get_engines_size(
+            get_config(header.order, header.engine_count), header.order, header.engine_count
+        );
+        if(header.engines_size != engines_size)
+            return ROCRAND_STATUS_TYPE_ERROR;
+
+        restore_state_settings(header);
+        m_engine_count = header.engine_count;
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+        status = update_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(header.initialized == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        status = rocrand_host::detail::load_state_engines(
+            state, m_engines, sizeof(engine_type) * m_engines_size, stream
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Initializes engines of \p seed in a second buffer on a separate
+    /// stream, the next set_seed() of the same seed swaps them in
+    /// without initialization.
+    rocrand_status prepare_seed(unsigned long long seed)
+    {
+        rocrand_status status = m_prepared.begin(m_engines_size, allocator);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        status = init_engines(m_prepared.engines(), seed, m_prepared.stream());
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        return m_prepared.end(seed);
+    }
+
+    /// Initializes the generator as a child of \p parent (see
+    /// rocrand_fork_generator()): settings are copied and the seed of the
+    /// child is derived from the seed of \p parent and \p subsequence_id.
+    /// Engines of the child are initialized with jumps when it is used.
+    rocrand_status fork(rocrand_mt19937& parent, unsigned long long subsequence_id)
+    {
+        copy_settings(parent);
+        m_seed = ::rocrand_device::detail::splitmix64_seed(parent.m_seed, subsequence_id);
+        m_engine_count = parent.m_engine_count;
+        m_first_engine = parent.m_first_engine;
+        m_partition_engines = parent.m_partition_engines;
+        m_engines_initialized = false;
+        rocrand_status status = set_allocator(parent.allocator);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        return update_engines();
+    }
+
+    rocrand_status init()
+    {
+        if (m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+        ROCRAND_PROFILING_NAMED_RANGE("mt19937::init");
+        rocrand_host::detail::init_stats_scope init_scope(stats);
+        // A captured initialization would reset engines on every launch
+        // of the graph
+        if (is_capturing())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        rocrand_status status = init_engines(m_engines, m_seed, m_stream);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        m_engines_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        switch(m_config.threads)
+        {
+            case 64: return generate_impl<64>(data, data_size, distribution);
+            case 128: return generate_impl<128>(data, data_size, distribution);
+            default: return generate_impl<s_threads>(data, data_size, distribution);
+        }
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    /// Doubles are computed from one number, or from two numbers
+    /// with ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT.
+    rocrand_status generate_uniform(double * data, size_t data_size)
+    {
+        if(m_double_resolution == ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT)
+        {
+            uniform_double_full_distribution distribution;
+            return generate(data, data_size, distribution);
+        }
+
+        uniform_distribution<double> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        if(m_math_mode == ROCRAND_MATH_MODE_FAST)
+        {
+            normal_fast_distribution<T> distribution(mean, stddev);
+            return generate(data, data_size, distribution);
+        }
+
+        normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        if(m_math_mode == ROCRAND_MATH_MODE_FAST)
+        {
+            log_normal_fast_distribution<T> distribution(mean, stddev);
+            return generate(data, data_size, distribution);
+        }
+
+        log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    // Half values are generated in pairs from 32-bit numbers (16 bits
+    // per value), so data_size must be even and data must be aligned
+    // to 2 * sizeof(__half) bytes
+    rocrand_status generate_uniform(__half * data, size_t data_size)
+    {
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(__half))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        uniform_distribution<__half2> distribution;
+        return generate(reinterpret_cast<__half2 *>(data), data_size / 2, distribution);
+    }
+
+    rocrand_status generate_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(__half))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        normal_distribution<__half2> distribution(mean, stddev);
+        return generate(reinterpret_cast<__half2 *>(data), data_size / 2, distribution);
+    }
+
+    rocrand_status generate_log_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(__half))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        log_normal_distribution<__half2> distribution(mean, stddev);
+        return generate(reinterpret_cast<__half2 *>(data), data_size / 2, distribution);
+    }
+
+    template<class IntType>
+    rocrand_status generate_uniform_int(IntType * data, size_t data_size,
+                                        IntType lo, IntType hi)
+    {
+        uniform_int_distribution<IntType> distribution(lo, hi);
+        return generate(data, data_size,
+                        make_rejection_distribution<IntType>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T * data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate(data, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    // 32 trials with probability p per value, bits rounded up to whole values
+    rocrand_status generate_bernoulli_bits(unsigned int * data, size_t bits, double p)
+    {
+        bernoulli_bits_distribution distribution(p);
+        return generate(data, (bits + 31) / 32,
+                        make_rejection_distribution<unsigned int>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T a, T b)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, a, b);
+        return generate(data, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    // Vectors are columns of a data_size x dimensions column-major matrix
+    template<class T>
+    rocrand_status generate_multivariate_normal(T * data, size_t data_size,
+                                                unsigned int dimensions,
+                                                const T * mean, const T * factor)
+    {
+        return generate_multivariate_normal_dimensions(*this, data, data_size,
+                                                       dimensions, mean, factor);
+    }
+
+    template<class T, unsigned int MaxDimensions>
+    rocrand_status generate_multivariate_normal(T * data, size_t data_size,
+                                                const multivariate_normal_distribution<T, MaxDimensions>& distribution)
+    {
+        return generate(data + (distribution.dimensions - 1) * data_size, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda, poisson_cache, allocator, m_stream, is_capturing());
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+private:
+    bool m_engines_initialized;
+    engine_type * m_engines;
+    size_t m_engines_size;
+    // Jump polynomials stay in device memory (shared by all MT19937
+    // generators of the device), engines are initialized on the device
+    rocrand_host::detail::sobol_device_table<unsigned int> m_jump_polynomials;
+    rocrand_host::detail::launch_config m_config;
+    // Number of engines set by set_engine_count(), 0 if not set
+    unsigned int m_engine_count;
+    // Engines of the partition set by set_subsequence_partition()
+    unsigned int m_first_engine;
+    unsigned int m_partition_engines;
+    // Engines of the next seed (see prepare_seed())
+    rocrand_host::detail::prepared_engines<engine_type> m_prepared;
+
+    // Grid used when the device can not be queried
+    static const uint32_t s_threads = 256;
+    static const uint32_t s_blocks = 512;
+
+    // Cache of Poisson tables of recently used lambdas
+    poisson_distribution_manager<> m_poisson;
+
+    template<unsigned int BlockSize, class T, class Distribution>
+    rocrand_status generate_impl(T * data, size_t data_size,
+                                 const Distribution& distribution)
+    {
+        const size_t remainder_value = data_size%BlockSize;
+        const size_t size_rounded_down = data_size - remainder_value;
+        // if remainder is 0, then data_size is a multiple of BlockSize, and
+        // in this case size_rounded_up must be data_size
+        const size_t size_rounded_up =
+            remainder_value == 0 ? data_size : size_rounded_down + BlockSize;
+
+        // One block per engine which produces numbers
+        const unsigned int active_engines = rocrand_host::detail::get_active_engines(
+            static_cast<unsigned int>(m_engines_size), size_rounded_up / BlockSize
+        );
+        const unsigned int blocks = rocrand_host::detail::get_launch_blocks(
+            static_cast<rocrand_host::detail::mt19937_generate_kernel_type<T, Distribution>>(
+                rocrand_host::detail::generate_kernel<BlockSize>
+            ),
+            m_config,
+            static_cast<size_t>(active_engines) * BlockSize
+        );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<BlockSize>),
+            dim3(blocks), dim3(BlockSize), 0, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size),
+            data, data_size, size_rounded_up,
+            size_rounded_down, distribution
+        );
+        // Check kernel status
+        if(rocrand_host::detail::launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch(data_size);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // There is one engine per block, the number of engines is limited
+    // by the number of jump polynomials. The legacy ordering uses the same
+    // grid on all devices.
+    rocrand_host::detail::launch_config get_config() const
+    {
+        return get_config(m_order, m_engine_count);
+    }
+
+    rocrand_host::detail::launch_config get_config(rocrand_ordering order,
+                                                   unsigned int engine_count) const
+    {
+        if(legacy_order(order))
+        {
+            return { s_threads, s_blocks, 0, 0 };
+        }
+        return rocrand_host::detail::get_launch_config(
+            ROCRAND_RNG_PSEUDO_MT19937,
+            static_cast<
+                rocrand_host::detail::mt19937_generate_kernel_type<
+                    unsigned int, uniform_distribution<unsigned int>
+                >
+            >(rocrand_host::detail::generate_kernel<s_threads>),
+            { s_threads, s_blocks, 0, 0 },
+            1, max_engines
+        );
+    }
+
+    size_t get_engines_size(const rocrand_host::detail::launch_config& config) const
+    {
+        return get_engines_size(config, m_order, m_engine_count);
+    }
+
+    size_t get_engines_size(const rocrand_host::detail::launch_config& config,
+                            rocrand_ordering order,
+                            unsigned int engine_count) const
+    {
+        size_t engines_size = config.blocks;
+        if(engine_count != 0)
+        {
+            engines_size = engine_count;
+        }
+        else if(order == ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT)
+        {
+            engines_size = device_independent_engines;
+        }
+        // Engines of a partition do not reach the next partition
+        return std::min<size_t>(engines_size, m_partition_engines);
+    }
+
+    rocrand_status init_engines(engine_type * engines,
+                                unsigned long long seed,
+                                hipStream_t stream)
+    {
+        // Engines jump by bits of their index, only polynomials of the
+        // highest index are needed
+        unsigned int polynomials = 0;
+        while(polynomials < MT19937_JUMP_POLYNOMIALS
+            && (1ULL << polynomials) < m_first_engine + m_engines_size)
+        {
+            polynomials++;
+        }
+        rocrand_status status = m_jump_polynomials.prepare(std::max(polynomials, 1U), stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+            dim3(static_cast<unsigned int>(m_engines_size)),
+            dim3(MT19937_INIT_THREADS), 0, stream,
+            engines, m_jump_polynomials.get(), m_first_engine, seed
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Computes the grid and reallocates engines when their number is changed
+    rocrand_status update_engines()
+    {
+        const rocrand_host::detail::launch_config config = get_config();
+        const size_t engines_size = get_engines_size(config);
+        if(engines_size != m_engines_size)
+        {
+            // The old engines and grid are kept if the allocation fails
+            engine_type * engines = NULL;
+            if(allocator.allocate(&engines, engines_size, m_stream) != ROCRAND_STATUS_SUCCESS)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            allocator.deallocate(m_engines, m_stream);
+            m_engines = engines;
+            m_engines_size = engines_size;
+        }
+        m_config = config;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_MT19937_H_
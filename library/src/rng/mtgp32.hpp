@@ -62,51 +62,154 @@
 #include <rocrand_mtgp32_11213.h>
 
 #include "generator_type.hpp"
+#include "profiling.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "launch_config.hpp"
+#include "prepared_engines.hpp"
+#include "engine_cache.hpp"
+#include "sobol_tables.hpp"
 
 namespace rocrand_host {
 namespace detail {
 
     typedef ::rocrand_device::mtgp32_engine mtgp32_device_engine;
     typedef ::rocrand_device::mtgp32_state mtgp32_state;
+    typedef ::rocrand_device::mtgp32_fast_params mtgp32_fast_params;
 
+    // Initializes engines on the device with the same states as
+    // rocrand_make_state_mtgp32 (one thread per engine)
+    __global__
+    void init_engines_kernel(mtgp32_device_engine * engines,
+                             const unsigned int engines_size,
+                             const mtgp32_fast_params * params,
+                             unsigned long long seed)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if(engine_id >= engines_size)
+            return;
+
+        seed = seed ^ (seed >> 32);
+        ::rocrand_device::rocrand_mtgp32_init_engine(
+            engines[engine_id], params, engine_id,
+            (unsigned int)seed + engine_id + 1
+        );
+    }
+
+    template<class Distribution>
+    __forceinline__ __device__
+    auto mtgp32_next_value(mtgp32_device_engine& engine,
+                           const Distribution& distribution)
+        -> decltype(distribution(engine()))
+    {
+        return distribution(engine());
+    }
+
+    // Two numbers per double (ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT)
+    __forceinline__ __device__
+    double mtgp32_next_value(mtgp32_device_engine& engine,
+                             const uniform_double_full_distribution& distribution)
+    {
+        const unsigned int v1 = engine();
+        const unsigned int v2 = engine();
+        return distribution(v1, v2);
+    }
+
+    // Distributions with rejection: numbers of the engine are shared by
+    // the whole block, so all threads draw together until every thread
+    // has accepted a value. Every attempt must draw the same number of
+    // numbers in all threads (engine() synchronizes the block), so
+    // distributions with a variable number of draws per attempt
+    // (Ziggurat, Poisson) are not used with MTGP32.
     template<class Type, class Distribution>
+    __forceinline__ __device__
+    Type mtgp32_next_value(mtgp32_device_engine& engine,
+                           const rejection_distribution<Type, Distribution>& distribution)
+    {
+        __shared__ unsigned int rejected;
+
+        Type value = 0;
+        bool accepted = false;
+        while(true)
+        {
+            Type candidate;
+            const bool candidate_accepted = distribution(engine, candidate);
+            if(!accepted && candidate_accepted)
+            {
+                value = candidate;
+                accepted = true;
+            }
+
+            if(hipThreadIdx_x == 0)
+                rejected = 0;
+            __syncthreads();
+            if(!accepted)
+                rejected = 1;
+            __syncthreads();
+            const bool done = rejected == 0;
+            __syncthreads();
+            if(done)
+                return value;
+        }
+    }
+
+    // BlockSize is the number of threads of the engine: every call of the
+    // engine produces BlockSize consecutive numbers of its sequence.
+    template<unsigned int BlockSize, class Type, class Distribution>
     __global__
+    __launch_bounds__(BlockSize)
     void generate_kernel(mtgp32_device_engine * engines,
+                         const unsigned int engines_size,
                          Type * data,
                          const size_t size,
-                         const size_t size_up, // size rounded up to the nearest multiple of hipBlockDim_x
-                         const size_t size_down, // size rounded down to the nearest multiple of hipBlockDim_x
+                         const size_t size_up, // size rounded up to the nearest multiple of BlockSize
+                         const size_t size_down, // size rounded down to the nearest multiple of BlockSize
                          Distribution distribution)
     {
-        const unsigned int engine_id = hipBlockIdx_x;
-        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        const unsigned int stride = engines_size * BlockSize;
+        // Blocks of BlockSize values
+        const unsigned int active_engines = get_active_engines(engines_size, size_up / BlockSize);
 
-        // Load device engine
         __shared__ mtgp32_device_engine engine;
-        engine.copy(&engines[engine_id]);
-
-        while(index < size_down)
-        {
-            data[index] = distribution(engine());
-            // Next position
-            index += stride;
-        }
-        while(index < size_up)
+        // Numbers of engine_id-th engine are stored with stride engines_size * BlockSize,
+        // blocks run several engines when the grid is smaller than the number
+        // of engines, so results do not depend on the grid
+        for(unsigned int engine_id = hipBlockIdx_x; engine_id < active_engines; engine_id += hipGridDim_x)
         {
-            auto value = distribution(engine());
-            if(index < size)
-                data[index] = value;
-            // Next position
-            index += stride;
+            unsigned int index = engine_id * BlockSize + hipThreadIdx_x;
+
+            // Load device engine
+            engine.copy(&engines[engine_id]);
+
+            while(index < size_down)
+            {
+                data[index] = mtgp32_next_value(engine, distribution);
+                // Next position
+                index += stride;
+            }
+            while(index < size_up)
+            {
+                auto value = mtgp32_next_value(engine, distribution);
+                if(index < size)
+                    data[index] = value;
+                // Next position
+                index += stride;
+            }
+
+            // Save engine with its state
+            engines[engine_id].copy(&engine);
         }
-
-        // Save engine with its state
-        engines[engine_id].copy(&engine);
     }
 
+    template<class Type, class Distribution>
+    using mtgp32_generate_kernel_type = void (*)(mtgp32_device_engine *,
+                                                 const unsigned int,
+                                                 Type *,
+                                                 const size_t,
+                                                 const size_t,
+                                                 const size_t,
+                                                 Distribution);
+
 } // end namespace detail
 } // end namespace rocrand_host
 
@@ -116,15 +219,25 @@ public:
     using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_MTGP32>;
     using engine_type = ::rocrand_host::detail::mtgp32_device_engine;
 
+    // Number of engines with ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT,
+    // the same on all devices and platforms (and equal to the legacy
+    // number of engines on HCC)
+    static const unsigned int device_independent_engines = 512;
+
     rocrand_mtgp32(unsigned long long seed = 0,
                    unsigned long long offset = 0,
                    hipStream_t stream = 0)
         : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL), m_engines_size(s_blocks)
+          m_engines_initialized(false), m_engines(NULL),
+          m_params(mtgp32dc_params_fast_11213, 1, params_count),
+          m_engine_count(0),
+          m_first_params(0),
+          m_partition_params(params_count)
     {
+        m_config = get_config();
+        m_engines_size = get_engines_size(m_config);
         // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
-        if(error != hipSuccess)
+        if(allocator.allocate(&m_engines, m_engines_size, m_stream) != ROCRAND_STATUS_SUCCESS)
         {
             throw ROCRAND_STATUS_ALLOCATION_FAILED;
         }
@@ -132,7 +245,7 @@ public:
 
     ~rocrand_mtgp32()
     {
-        hipFree(m_engines);
+        allocator.deallocate(m_engines, m_stream);
     }
 
     void reset()
@@ -147,25 +260,220 @@ public:
     void set_seed(unsigned long long seed)
     {
         m_seed = seed;
-        m_engines_initialized = false;
+        // Engines prepared by prepare_seed() are used without initialization
+        m_engines_initialized = m_prepared.swap(seed, m_engines, m_engines_size, m_stream);
     }
 
     void set_offset(unsigned long long offset)
     {
         m_offset = offset;
         m_engines_initialized = false;
+        m_prepared.invalidate();
+    }
+
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        const rocrand_ordering previous_order = m_order;
+        m_order = order;
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+        const rocrand_status status = update_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            m_order = previous_order;
+        }
+        return status;
+    }
+
+    /// Sets the number of engines (at most MTGP_BN_MAX, engines use different
+    /// parameters), 0 restores the number of engines of the ordering.
+    /// Results depend only on the number of engines, so they are the same
+    /// on all devices for the same number.
+    rocrand_status set_engine_count(unsigned int engine_count)
+    {
+        if(engine_count > MTGP_BN_MAX)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        const unsigned int previous_engine_count = m_engine_count;
+        m_engine_count = engine_count;
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+        const rocrand_status status = update_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            m_engine_count = previous_engine_count;
+        }
+        return status;
+    }
+
+    /// Engines of \p rank use parameter sets [rank * P, (rank + 1) * P) where P
+    /// is the number of parameter sets divided by \p nranks, the number of
+    /// engines is limited by P. Sequences of different parameter sets are
+    /// independent, so ranks do not share sequences.
+    rocrand_status set_subsequence_partition(unsigned int rank, unsigned int nranks)
+    {
+        if(nranks > params_count)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_partition_params = params_count / nranks;
+        m_first_params = rank * m_partition_params;
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+        return update_engines();
+    }
+
+    /// Returns the number of bytes of device memory allocated by the generator.
+    size_t get_memory_usage() const
+    {
+        return sizeof(engine_type) * m_engines_size
+            + m_params.size_bytes()
+            + m_prepared.memory_usage()
+            + m_poisson.memory_usage();
+    }
+
+    /// Sets the allocator of device memory, engines are reallocated by it
+    /// and the state of the generator is reset. Poisson tables and other
+    /// memory allocated before are freed by their allocators.
+    rocrand_status set_allocator(const rocrand_host::detail::device_allocator& new_allocator)
+    {
+        if(new_allocator == allocator)
+            return ROCRAND_STATUS_SUCCESS;
+        // The generator is not changed if the new allocator fails
+        engine_type * engines = NULL;
+        if(new_allocator.allocate(&engines, m_engines_size, m_stream) != ROCRAND_STATUS_SUCCESS)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        m_engines_initialized = false;
+        m_prepared.release();
+        allocator.deallocate(m_engines, m_stream);
+        m_engines = engines;
+        allocator = new_allocator;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns the number of bytes of a state saved by save_state().
+    size_t get_state_size() const
+    {
+        return rocrand_host::detail::get_state_size(sizeof(engine_type) * m_engines_size);
+    }
+
+    /// Saves seed, offset, ordering, number of engines and engines (if they
+    /// are initialized) to \p state, copies are enqueued to \p stream.
+    rocrand_status save_state(void * state, hipStream_t stream) const
+    {
+        rocrand_host::detail::generator_state_header header = make_state_header();
+        header.engine_count = m_engine_count;
+        header.initialized = m_engines_initialized ? 1 : 0;
+        header.engines_size = m_engines_size;
+        return rocrand_host::detail::save_state(
+            state, header, NULL, m_engines,
+            m_engines_initialized ? sizeof(engine_type) * m_engines_size : 0, stream
+        );
+    }
+
+    /// Restores a state saved by save_state(), engines are copied on \p stream
+    /// without initialization. The number of engines must be the same as when
+    /// the state was saved (orderings which depend on the device may differ).
+    rocrand_status load_state(const void * state, hipStream_t stream)
+    {
+        rocrand_host::detail::generator_state_header header;
+        rocrand_status status =
+            rocrand_host::detail::load_state_header(state, rng_type, header, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        // Engines of the state must fit engines of its settings, the
+        // generator is not changed otherwise
+        const size_t engines_size = get_engines_size(
+            get_config(header.order, header.engine_count), header.order, header.engine_count
+        );
+        if(header.engines_size != engines_size)
+            return ROCRAND_STATUS_TYPE_ERROR;
+
+        restore_state_settings(header);
+        m_engine_count = header.engine_count;
+        m_engines_initialized = false;
+        m_prepared.invalidate();
+        status = update_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(header.initialized == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        status = rocrand_host::detail::load_state_engines(
+            state, m_engines, sizeof(engine_type) * m_engines_size, stream
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Initializes engines of \p seed in a second buffer on a separate
+    /// stream, the next set_seed() of the same seed swaps them in
+    /// without initialization.
+    rocrand_status prepare_seed(unsigned long long seed)
+    {
+        rocrand_status status = m_prepared.begin(m_engines_size, allocator);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        status = init_engines(m_prepared.engines(), seed, m_prepared.stream());
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        return m_prepared.end(seed);
+    }
+
+    /// Initializes the generator as a child of \p parent (see
+    /// rocrand_fork_generator()): settings are copied and the seed of the
+    /// child is derived from the seed of \p parent and \p subsequence_id.
+    /// MTGP32 has no skipahead, engines of the child are initialized from
+    /// parameters shared with the parent when the child is used.
+    rocrand_status fork(rocrand_mtgp32& parent, unsigned long long subsequence_id)
+    {
+        copy_settings(parent);
+        m_seed = ::rocrand_device::detail::splitmix64_seed(parent.m_seed, subsequence_id);
+        m_engine_count = parent.m_engine_count;
+        m_first_params = parent.m_first_params;
+        m_partition_params = parent.m_partition_params;
+        m_engines_initialized = false;
+        rocrand_status status = set_allocator(parent.allocator);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        return update_engines();
     }
 
     rocrand_status init()
     {
         if (m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
+        ROCRAND_PROFILING_NAMED_RANGE("mtgp32::init");
+        rocrand_host::detail::init_stats_scope init_scope(stats);
+        // A captured initialization would reset engines on every launch
+        // of the graph
+        if (is_capturing())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
 
-        rocrand_status status;
+        // Engines of the same settings may be cached by an earlier process
+        const rocrand_host::detail::engine_cache_key cache_key =
+            rocrand_host::detail::make_engine_cache_key(
+                rng_type, sizeof(engine_type), m_engines_size, m_seed, 0,
+                m_first_params, m_order == ROCRAND_ORDERING_PSEUDO_SEEDED
+            );
+        const size_t engines_bytes = sizeof(engine_type) * m_engines_size;
+        if (rocrand_host::detail::load_cached_engines(cache_key, m_engines, engines_bytes, m_stream))
+        {
+            m_engines_initialized = true;
+            return ROCRAND_STATUS_SUCCESS;
+        }
 
-        status = rocrand_make_state_mtgp32(m_engines, mtgp32dc_params_fast_11213, m_engines_size, m_seed);
-        if(status != ROCRAND_STATUS_SUCCESS)
-            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        rocrand_status status = init_engines(m_engines, m_seed, m_stream);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        rocrand_host::detail::store_cached_engines(cache_key, m_engines, engines_bytes, m_stream);
 
         m_engines_initialized = true;
 
@@ -180,24 +488,12 @@ public:
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
-        const size_t remainder_value = data_size%s_threads;
-        const size_t size_rounded_down = data_size - remainder_value;
-        // if remainder is 0, then data_size is a multiple of s_threads, and
-        // in this case size_rounded_up must be data_size
-        const size_t size_rounded_up =
-            remainder_value == 0 ? data_size : size_rounded_down + s_threads;
-
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, size_rounded_up,
-            size_rounded_down, distribution
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
-
-        return ROCRAND_STATUS_SUCCESS;
+        switch(m_config.threads)
+        {
+            case 64: return generate_impl<64>(data, data_size, distribution);
+            case 128: return generate_impl<128>(data, data_size, distribution);
+            default: return generate_impl<s_threads>(data, data_size, distribution);
+        }
     }
 
     template<class T>
@@ -207,9 +503,29 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    /// Doubles are computed from one number, or from two numbers
+    /// with ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT.
+    rocrand_status generate_uniform(double * data, size_t data_size)
+    {
+        if(m_double_resolution == ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT)
+        {
+            uniform_double_full_distribution distribution;
+            return generate(data, data_size, distribution);
+        }
+
+        uniform_distribution<double> distribution;
+        return generate(data, data_size, distribution);
+    }
+
     template<class T>
     rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
     {
+        if(m_math_mode == ROCRAND_MATH_MODE_FAST)
+        {
+            normal_fast_distribution<T> distribution(mean, stddev);
+            return generate(data, data_size, distribution);
+        }
+
         normal_distribution<T> distribution(mean, stddev);
         return generate(data, data_size, distribution);
     }
@@ -217,15 +533,125 @@ public:
     template<class T>
     rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
     {
+        if(m_math_mode == ROCRAND_MATH_MODE_FAST)
+        {
+            log_normal_fast_distribution<T> distribution(mean, stddev);
+            return generate(data, data_size, distribution);
+        }
+
         log_normal_distribution<T> distribution(mean, stddev);
         return generate(data, data_size, distribution);
     }
 
+    // Half values are generated in pairs from 32-bit numbers (16 bits
+    // per value), so data_size must be even and data must be aligned
+    // to 2 * sizeof(__half) bytes
+    rocrand_status generate_uniform(__half * data, size_t data_size)
+    {
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(__half))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        uniform_distribution<__half2> distribution;
+        return generate(reinterpret_cast<__half2 *>(data), data_size / 2, distribution);
+    }
+
+    rocrand_status generate_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(__half))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        normal_distribution<__half2> distribution(mean, stddev);
+        return generate(reinterpret_cast<__half2 *>(data), data_size / 2, distribution);
+    }
+
+    rocrand_status generate_log_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(__half))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        log_normal_distribution<__half2> distribution(mean, stddev);
+        return generate(reinterpret_cast<__half2 *>(data), data_size / 2, distribution);
+    }
+
+    template<class IntType>
+    rocrand_status generate_uniform_int(IntType * data, size_t data_size,
+                                        IntType lo, IntType hi)
+    {
+        uniform_int_distribution<IntType> distribution(lo, hi);
+        return generate(data, data_size,
+                        make_rejection_distribution<IntType>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T * data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate(data, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    // 32 trials with probability p per value, bits rounded up to whole values
+    rocrand_status generate_bernoulli_bits(unsigned int * data, size_t bits, double p)
+    {
+        bernoulli_bits_distribution distribution(p);
+        return generate(data, (bits + 31) / 32,
+                        make_rejection_distribution<unsigned int>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T a, T b)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, a, b);
+        return generate(data, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
+    // Vectors are columns of a data_size x dimensions column-major matrix
+    template<class T>
+    rocrand_status generate_multivariate_normal(T * data, size_t data_size,
+                                                unsigned int dimensions,
+                                                const T * mean, const T * factor)
+    {
+        return generate_multivariate_normal_dimensions(*this, data, data_size,
+                                                       dimensions, mean, factor);
+    }
+
+    template<class T, unsigned int MaxDimensions>
+    rocrand_status generate_multivariate_normal(T * data, size_t data_size,
+                                                const multivariate_normal_distribution<T, MaxDimensions>& distribution)
+    {
+        return generate(data + (distribution.dimensions - 1) * data_size, data_size,
+                        make_rejection_distribution<T>(distribution));
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
         {
-            m_poisson.set_lambda(lambda);
+            m_poisson.set_lambda(lambda, poisson_cache, allocator, m_stream, is_capturing());
         }
         catch(rocrand_status status)
         {
@@ -238,6 +664,19 @@ private:
     bool m_engines_initialized;
     engine_type * m_engines;
     size_t m_engines_size;
+    // Parameters stay in device memory (shared by all MTGP32 generators of
+    // the device), so engines are initialized on the device
+    rocrand_host::detail::sobol_device_table<rocrand_host::detail::mtgp32_fast_params> m_params;
+    rocrand_host::detail::launch_config m_config;
+    // Number of engines set by set_engine_count(), 0 if not set
+    unsigned int m_engine_count;
+    // Parameter sets of the partition set by set_subsequence_partition()
+    unsigned int m_first_params;
+    unsigned int m_partition_params;
+    // Engines of the next seed (see prepare_seed())
+    rocrand_host::detail::prepared_engines<engine_type> m_prepared;
+
+    // Grid used when the device can not be queried
     #ifdef __HIP_PLATFORM_NVCC__
     static const uint32_t s_threads = 256;
     static const uint32_t s_blocks = 64;
@@ -245,10 +684,206 @@ private:
     static const uint32_t s_threads = 256;
     static const uint32_t s_blocks = 512;
     #endif
+    // Threads per block of the init kernel
+    static const uint32_t s_init_threads = 64;
+    // Number of parameter sets (engines use different parameters)
+    static const unsigned int params_count =
+        sizeof(mtgp32dc_params_fast_11213) / sizeof(mtgp32dc_params_fast_11213[0]);
 
-    // For caching of Poisson for consecutive generations with the same lambda
+    // Cache of Poisson tables of recently used lambdas
     poisson_distribution_manager<> m_poisson;
 
+    template<unsigned int BlockSize, class T, class Distribution>
+    rocrand_status generate_impl(T * data, size_t data_size,
+                                 const Distribution& distribution)
+    {
+        const size_t remainder_value = data_size%BlockSize;
+        const size_t size_rounded_down = data_size - remainder_value;
+        // if remainder is 0, then data_size is a multiple of BlockSize, and
+        // in this case size_rounded_up must be data_size
+        const size_t size_rounded_up =
+            remainder_value == 0 ? data_size : size_rounded_down + BlockSize;
+
+        // One block per engine which produces numbers
+        const unsigned int active_engines = rocrand_host::detail::get_active_engines(
+            static_cast<unsigned int>(m_engines_size), size_rounded_up / BlockSize
+        );
+        const unsigned int blocks = rocrand_host::detail::get_launch_blocks(
+            static_cast<rocrand_host::detail::mtgp32_generate_kernel_type<T, Distribution>>(
+                rocrand_host::detail::generate_kernel<BlockSize>
+            ),
+            m_config,
+            static_cast<size_t>(active_engines) * BlockSize
+        );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<BlockSize>),
+            dim3(blocks), dim3(BlockSize), 0, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size),
+            data, data_size, size_rounded_up,
+            size_rounded_down, distribution
+        );
+        // Check kernel status
+        if(rocrand_host::detail::launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch(data_size);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Number of blocks of BlockSize threads of the generate kernel
+    // resident on one compute unit, 0 if unknown
+    template<unsigned int BlockSize>
+    static unsigned int get_generate_blocks_per_cu(const rocrand_host::detail::launch_config& config)
+    {
+        return rocrand_host::detail::get_blocks_per_cu(
+            config.device_id,
+            static_cast<
+                rocrand_host::detail::mtgp32_generate_kernel_type<
+                    unsigned int, uniform_distribution<unsigned int>
+                >
+            >(rocrand_host::detail::generate_kernel<BlockSize>),
+            BlockSize
+        );
+    }
+
+    // Selects the block size (MTGP_TN or a smaller power of two) with
+    // the most resident threads on the device. With large 256-thread blocks
+    // the shared engines (status of MTGP_STATE values each) and registers
+    // can limit occupancy, smaller blocks run more engines per compute unit.
+    // Every engine still generates the same sequence, but numbers are
+    // interleaved by blocks of config.threads values.
+    static void select_block_size(rocrand_host::detail::launch_config& config)
+    {
+        const unsigned int block_sizes[] = { s_threads, 128, 64 };
+        const unsigned int blocks_per_cu[] = {
+            get_generate_blocks_per_cu<s_threads>(config),
+            get_generate_blocks_per_cu<128>(config),
+            get_generate_blocks_per_cu<64>(config)
+        };
+        unsigned int best = 0;
+        size_t best_threads = 0;
+        for(unsigned int i = 0; i < 3; i++)
+        {
+            // There is one engine per block
+            const size_t blocks = std::min<size_t>(
+                static_cast<size_t>(config.cu_count) * blocks_per_cu[i], MTGP_BN_MAX
+            );
+            // Larger blocks are preferred if occupancy is the same
+            if(blocks * block_sizes[i] > best_threads)
+            {
+                best = i;
+                best_threads = blocks * block_sizes[i];
+            }
+        }
+        if(best != 0)
+        {
+            config.threads = block_sizes[best];
+            config.blocks = static_cast<unsigned int>(best_threads / block_sizes[best]);
+        }
+    }
+
+    // There is one engine per block, the number of engines is limited
+    // by the number of parameter sets. The legacy ordering uses the same
+    // grid on all devices.
+    rocrand_host::detail::launch_config get_config() const
+    {
+        return get_config(m_order, m_engine_count);
+    }
+
+    rocrand_host::detail::launch_config get_config(rocrand_ordering order,
+                                                   unsigned int engine_count) const
+    {
+        if(legacy_order(order))
+        {
+            return { s_threads, s_blocks, 0, 0 };
+        }
+        rocrand_host::detail::launch_config config = rocrand_host::detail::get_launch_config(
+            ROCRAND_RNG_PSEUDO_MTGP32,
+            static_cast<
+                rocrand_host::detail::mtgp32_generate_kernel_type<
+                    unsigned int, uniform_distribution<unsigned int>
+                >
+            >(rocrand_host::detail::generate_kernel<s_threads>),
+            { s_threads, s_blocks, 0, 0 },
+            1, MTGP_BN_MAX
+        );
+        // The engine runs with at most MTGP_TN threads per block
+        config.threads = s_threads;
+        // Results of the device independent ordering and of a number of
+        // engines set by the user must not depend on the device
+        if(order != ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT
+            && engine_count == 0 && config.cu_count != 0)
+        {
+            select_block_size(config);
+        }
+        return config;
+    }
+
+    size_t get_engines_size(const rocrand_host::detail::launch_config& config) const
+    {
+        return get_engines_size(config, m_order, m_engine_count);
+    }
+
+    size_t get_engines_size(const rocrand_host::detail::launch_config& config,
+                            rocrand_ordering order,
+                            unsigned int engine_count) const
+    {
+        size_t engines_size = config.blocks;
+        if(engine_count != 0)
+        {
+            engines_size = engine_count;
+        }
+        else if(order == ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT)
+        {
+            engines_size = device_independent_engines;
+        }
+        // Engines of a partition use only its parameter sets
+        return std::min<size_t>(engines_size, m_partition_params);
+    }
+
+    rocrand_status init_engines(engine_type * engines,
+                                unsigned long long seed,
+                                hipStream_t stream)
+    {
+        const unsigned int engines_size = static_cast<unsigned int>(m_engines_size);
+        rocrand_status status = m_params.prepare(params_count, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+            dim3((engines_size + s_init_threads - 1) / s_init_threads),
+            dim3(s_init_threads), 0, stream,
+            engines, engines_size, m_params.get() + m_first_params, seed
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Computes the grid and reallocates engines when their number is changed
+    rocrand_status update_engines()
+    {
+        const rocrand_host::detail::launch_config config = get_config();
+        const size_t engines_size = get_engines_size(config);
+        if(engines_size != m_engines_size)
+        {
+            // The old engines and grid are kept if the allocation fails
+            engine_type * engines = NULL;
+            if(allocator.allocate(&engines, engines_size, m_stream) != ROCRAND_STATUS_SUCCESS)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            allocator.deallocate(m_engines, m_stream);
+            m_engines = engines;
+            m_engines_size = engines_size;
+        }
+        m_config = config;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     // m_seed from base_type
     // m_offset from base_type
 };
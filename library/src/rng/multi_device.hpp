@@ -0,0 +1,205 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCRAND_RNG_MULTI_DEVICE_H_
+#define ROCRAND_RNG_MULTI_DEVICE_H_
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+// Generator whose sequence is split across several devices
+// (rocrand_create_multi_device_generator). Every device has its own
+// generator of the same type, seed and offset, and its own stream. One
+// generate() call fills a shard on every device with consecutive ranges
+// of the sequence using generate_range(), so the combined output is the
+// same as of one generator on one device, and devices run in parallel.
+struct rocrand_multi_device_generator_base_type
+{
+    rocrand_multi_device_generator_base_type(rocrand_rng_type rng_type)
+        : rng_type(rng_type), m_position(0) {}
+
+    ~rocrand_multi_device_generator_base_type()
+    {
+        destroy();
+    }
+
+    const rocrand_rng_type rng_type;
+
+    // Types which support rocrand_generate_range()
+    static bool is_supported(rocrand_rng_type rng_type)
+    {
+        return rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+            || rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
+            || rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+            || rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+            || rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A
+            || rng_type == ROCRAND_RNG_PSEUDO_XORWOW
+            || rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+            || rng_type == ROCRAND_RNG_PSEUDO_PCG32
+            || rng_type == ROCRAND_RNG_QUASI_SOBOL32
+            || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32;
+    }
+
+    rocrand_status create(const int * devices, unsigned int device_count)
+    {
+        int current_device;
+        if(hipGetDevice(&current_device) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        for(unsigned int i = 0; i < device_count && status == ROCRAND_STATUS_SUCCESS; i++)
+        {
+            if(hipSetDevice(devices[i]) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_OUT_OF_RANGE;
+                break;
+            }
+            hipStream_t stream;
+            if(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+                break;
+            }
+            m_streams.push_back(stream);
+            m_devices.push_back(devices[i]);
+
+            rocrand_generator generator;
+            status = rocrand_create_generator(&generator, rng_type);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                break;
+            m_generators.push_back(generator);
+            status = rocrand_set_stream(generator, stream);
+            // Philox4x32-10 supports ranges only with counter-based ordering
+            if(status == ROCRAND_STATUS_SUCCESS && rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+                status = rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_BEST);
+        }
+
+        hipSetDevice(current_device);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            destroy();
+        return status;
+    }
+
+    rocrand_status set_seed(unsigned long long seed)
+    {
+        return for_each_generator(
+            [seed](rocrand_generator generator) { return rocrand_set_seed(generator, seed); }
+        );
+    }
+
+    rocrand_status set_offset(unsigned long long offset)
+    {
+        return for_each_generator(
+            [offset](rocrand_generator generator) { return rocrand_set_offset(generator, offset); }
+        );
+    }
+
+    // Shard i of sizes[i] numbers is generated to output_data[i] in memory
+    // of device i, the function returns when all shards are ready
+    rocrand_status generate(unsigned int * const * output_data, const size_t * sizes)
+    {
+        int current_device;
+        if(hipGetDevice(&current_device) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
+        // All shards are launched first, then waited for
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        unsigned long long start = m_position;
+        for(size_t i = 0; i < m_generators.size() && status == ROCRAND_STATUS_SUCCESS; i++)
+        {
+            if(sizes[i] == 0)
+                continue;
+            if(hipSetDevice(m_devices[i]) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+                break;
+            }
+            status = rocrand_generate_range(m_generators[i], output_data[i], start, sizes[i]);
+            start += sizes[i];
+        }
+        for(size_t i = 0; i < m_generators.size(); i++)
+        {
+            hipSetDevice(m_devices[i]);
+            if(hipStreamSynchronize(m_streams[i]) != hipSuccess
+                && status == ROCRAND_STATUS_SUCCESS)
+            {
+                status = ROCRAND_STATUS_LAUNCH_FAILURE;
+            }
+        }
+        hipSetDevice(current_device);
+
+        if(status == ROCRAND_STATUS_SUCCESS)
+            m_position = start;
+        return status;
+    }
+
+    size_t device_count() const
+    {
+        return m_generators.size();
+    }
+
+private:
+    template<class Function>
+    rocrand_status for_each_generator(Function function)
+    {
+        int current_device;
+        if(hipGetDevice(&current_device) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        for(size_t i = 0; i < m_generators.size() && status == ROCRAND_STATUS_SUCCESS; i++)
+        {
+            hipSetDevice(m_devices[i]);
+            status = function(m_generators[i]);
+        }
+        hipSetDevice(current_device);
+
+        m_position = 0;
+        return status;
+    }
+
+    void destroy()
+    {
+        int current_device;
+        hipGetDevice(&current_device);
+        for(size_t i = 0; i < m_devices.size(); i++)
+        {
+            hipSetDevice(m_devices[i]);
+            if(i < m_generators.size())
+                rocrand_destroy_generator(m_generators[i]);
+            hipStreamDestroy(m_streams[i]);
+        }
+        hipSetDevice(current_device);
+        m_generators.clear();
+        m_streams.clear();
+        m_devices.clear();
+    }
+
+    std::vector<int> m_devices;
+    std::vector<hipStream_t> m_streams;
+    std::vector<rocrand_generator> m_generators;
+    // Position of the next number in the sequence
+    unsigned long long m_position;
+};
+
+#endif // ROCRAND_RNG_MULTI_DEVICE_H_
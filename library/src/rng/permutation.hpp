@@ -0,0 +1,460 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCRAND_RNG_PERMUTATION_H_
+#define ROCRAND_RNG_PERMUTATION_H_
+
+#include <algorithm>
+#include <stdint.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "device_engines.hpp"
+
+// Random permutations of [0, n) (rocrand_generate_permutation) and shuffles
+// of arrays (rocrand_shuffle). Keys of a permutation are
+// permutation_key_count numbers of the generator, so every call gives
+// a new permutation and the generator advances as by rocrand_generate().
+//
+// ROCRAND_PERMUTATION_METHOD_FEISTEL: value i is f(i) of a bijection f of
+// [0, 2^(2 * half_bits)), the smallest even power of 2 not below n, computed
+// by a balanced Feistel network with Philox multiplications as the round
+// function. Values outside [0, n) are mapped again (cycle walking, less than
+// 4 evaluations on average), so f is a bijection of [0, n) which every
+// thread evaluates independently. Permutations are pseudo-random but not
+// uniform among all n! permutations.
+//
+// ROCRAND_PERMUTATION_METHOD_EXACT: segments of permutation_segment_size
+// values are shuffled by Fisher-Yates, then pairs of adjacent shuffled runs
+// are merged by MergeShuffle (Bacher et al., 2015) until one run is left.
+// Every step keeps permutations exactly uniform, draws are made by Philox
+// streams with the key of the permutation (one subsequence per segment or
+// pair). Merges of a level run in parallel, the last levels have few pairs,
+// so the method is slower than the Feistel network for large n.
+
+namespace rocrand_host {
+namespace detail {
+
+    constexpr unsigned int permutation_block_size = 256;
+    constexpr unsigned int permutation_max_blocks = 65536;
+    constexpr unsigned int permutation_feistel_rounds = 24;
+    // Round keys of the Feistel network and the seed of Philox streams
+    constexpr unsigned int permutation_key_count = 32;
+    constexpr unsigned int permutation_segment_size = 256;
+
+    struct feistel_bijection
+    {
+        unsigned int keys[permutation_feistel_rounds];
+        unsigned int half_bits;
+        unsigned long long int n;
+
+        __forceinline__ __device__ __host__
+        feistel_bijection(const unsigned int * keys,
+                          const unsigned int half_bits,
+                          const unsigned long long int n)
+            : half_bits(half_bits), n(n)
+        {
+            for(unsigned int r = 0; r < permutation_feistel_rounds; r++)
+            {
+                this->keys[r] = keys[r];
+            }
+        }
+
+        __forceinline__ __device__ __host__
+        unsigned int operator()(const unsigned int index) const
+        {
+            const unsigned int mask = (1U << half_bits) - 1U;
+            unsigned int value = index;
+            do
+            {
+                unsigned int left = value >> half_bits;
+                unsigned int right = value & mask;
+                for(unsigned int r = 0; r < permutation_feistel_rounds; r++)
+                {
+                    const unsigned long long int product =
+                        static_cast<unsigned long long int>(right ^ keys[r]) * 0xD2511F53ULL;
+                    const unsigned int f =
+                        static_cast<unsigned int>(product >> 32) ^ static_cast<unsigned int>(product);
+                    const unsigned int next = left ^ (f & mask);
+                    left = right;
+                    right = next;
+                }
+                value = (left << half_bits) | right;
+            } while(value >= n);
+            return value;
+        }
+    };
+
+    // Half of the bits of the domain of the Feistel network of n values
+    inline unsigned int get_feistel_half_bits(const size_t n)
+    {
+        unsigned int bits = 0;
+        while((1ULL << bits) < n)
+        {
+            bits++;
+        }
+        return std::max(1U, (bits + 1) / 2);
+    }
+
+    // Coin flips and bounded integers of exact permutations
+    struct permutation_source
+    {
+        rocrand_device::philox4x32_10_engine engine;
+        unsigned int bits;
+        unsigned int bits_left;
+
+        __forceinline__ __device__
+        permutation_source(const unsigned int * keys, const unsigned long long int subsequence)
+            : engine(keys[permutation_feistel_rounds]
+                       | (static_cast<unsigned long long int>(keys[permutation_feistel_rounds + 1]) << 32),
+                     subsequence, 0),
+              bits(0), bits_left(0)
+        { }
+
+        __forceinline__ __device__
+        bool coin()
+        {
+            if(bits_left == 0)
+            {
+                bits = engine();
+                bits_left = 32;
+            }
+            const bool result = (bits & 1) != 0;
+            bits >>= 1;
+            bits_left--;
+            return result;
+        }
+
+        // Uniform from [0, range) without bias (Lemire's method)
+        __forceinline__ __device__
+        unsigned int bounded(const unsigned int range)
+        {
+            unsigned long long int m = static_cast<unsigned long long int>(engine()) * range;
+            if(static_cast<unsigned int>(m) < range)
+            {
+                const unsigned int threshold = (0U - range) % range;
+                while(static_cast<unsigned int>(m) < threshold)
+                {
+                    m = static_cast<unsigned long long int>(engine()) * range;
+                }
+            }
+            return static_cast<unsigned int>(m >> 32);
+        }
+    };
+
+    __global__
+    __launch_bounds__(permutation_block_size)
+    void permutation_feistel_kernel(unsigned int * output,
+                                    const size_t n,
+                                    const unsigned int * keys,
+                                    const unsigned int half_bits)
+    {
+        const feistel_bijection bijection(keys, half_bits, n);
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+        for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < n; i += stride)
+        {
+            output[i] = bijection(static_cast<unsigned int>(i));
+        }
+    }
+
+    // Identity values of a segment per thread shuffled by Fisher-Yates
+    __global__
+    __launch_bounds__(permutation_block_size)
+    void permutation_segment_kernel(unsigned int * output,
+                                    const size_t n,
+                                    const unsigned int * keys)
+    {
+        const size_t segments = (n + permutation_segment_size - 1) / permutation_segment_size;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+        for(size_t s = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; s < segments; s += stride)
+        {
+            permutation_source source(keys, s);
+            unsigned int * values = output + s * permutation_segment_size;
+            const size_t remaining = n - s * permutation_segment_size;
+            const unsigned int size = remaining < permutation_segment_size
+                ? static_cast<unsigned int>(remaining)
+                : permutation_segment_size;
+            values[0] = static_cast<unsigned int>(s * permutation_segment_size);
+            for(unsigned int j = 1; j < size; j++)
+            {
+                const unsigned int k = source.bounded(j + 1);
+                values[j] = values[k];
+                values[k] = static_cast<unsigned int>(s * permutation_segment_size + j);
+            }
+        }
+    }
+
+    // MergeShuffle of pairs of adjacent shuffled runs of width values,
+    // the subsequences of pairs of a level follow the level
+    __global__
+    __launch_bounds__(permutation_block_size)
+    void permutation_merge_kernel(unsigned int * output,
+                                  const size_t n,
+                                  const size_t width,
+                                  const unsigned int level,
+                                  const unsigned int * keys)
+    {
+        const size_t pairs = (n + 2 * width - 1) / (2 * width);
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+        for(size_t p = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; p < pairs; p += stride)
+        {
+            const size_t begin = p * 2 * width;
+            if(begin + width >= n)
+            {
+                continue;
+            }
+            permutation_source source(keys, (static_cast<unsigned long long int>(level) << 32) | p);
+            unsigned int * values = output + begin;
+            const size_t size = n - begin < 2 * width ? n - begin : 2 * width;
+            // Values are taken from both runs by coin flips until one
+            // of them is exhausted, the rest is inserted by Fisher-Yates
+            size_t i = 0;
+            size_t j = width;
+            while(true)
+            {
+                if(source.coin())
+                {
+                    if(j == size)
+                        break;
+                    const unsigned int t = values[i];
+                    values[i] = values[j];
+                    values[j] = t;
+                    j++;
+                }
+                else if(i == j)
+                {
+                    break;
+                }
+                i++;
+            }
+            for(; i < size; i++)
+            {
+                const unsigned int k = source.bounded(static_cast<unsigned int>(i + 1));
+                const unsigned int t = values[i];
+                values[i] = values[k];
+                values[k] = t;
+            }
+        }
+    }
+
+    // Values are copied from input in the order of the permutation, which is
+    // either stored in permutation or computed by the Feistel network
+    template<class Word>
+    __global__
+    __launch_bounds__(permutation_block_size)
+    void shuffle_kernel(Word * output,
+                        const Word * input,
+                        const size_t n,
+                        const size_t words,
+                        const unsigned int * permutation,
+                        const unsigned int * keys,
+                        const unsigned int half_bits)
+    {
+        const feistel_bijection bijection(keys, half_bits, n);
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+        for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < n; i += stride)
+        {
+            const size_t source = permutation != NULL
+                ? permutation[i]
+                : bijection(static_cast<unsigned int>(i));
+            for(size_t w = 0; w < words; w++)
+            {
+                output[i * words + w] = input[source * words + w];
+            }
+        }
+    }
+
+    inline unsigned int get_permutation_blocks(const size_t threads)
+    {
+        return static_cast<unsigned int>(std::min<size_t>(
+            (threads + permutation_block_size - 1) / permutation_block_size,
+            permutation_max_blocks
+        ));
+    }
+
+    // Stores a permutation of [0, n) to output, keys are in device memory
+    inline rocrand_status permute(rocrand_generator_base_type * generator,
+                                  unsigned int * output,
+                                  const size_t n,
+                                  const unsigned int * keys,
+                                  hipStream_t stream)
+    {
+        if(generator->permutation_method == ROCRAND_PERMUTATION_METHOD_FEISTEL)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(permutation_feistel_kernel),
+                dim3(get_permutation_blocks(n)), dim3(permutation_block_size), 0, stream,
+                output, n, keys, get_feistel_half_bits(n)
+            );
+            generator->count_launch();
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const size_t segments = (n + permutation_segment_size - 1) / permutation_segment_size;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(permutation_segment_kernel),
+            dim3(get_permutation_blocks(segments)), dim3(permutation_block_size), 0, stream,
+            output, n, keys
+        );
+        generator->count_launch();
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        unsigned int level = 1;
+        for(size_t width = permutation_segment_size; width < n; width *= 2, level++)
+        {
+            const size_t pairs = (n + 2 * width - 1) / (2 * width);
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(permutation_merge_kernel),
+                dim3(get_permutation_blocks(pairs)), dim3(permutation_block_size), 0, stream,
+                output, n, width, level, keys
+            );
+            generator->count_launch();
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Allocates and generates keys of a permutation
+    template<class Generator>
+    inline rocrand_status generate_permutation_keys(Generator * generator, unsigned int ** keys)
+    {
+        if(generator->allocator.allocate(keys, permutation_key_count, generator->get_stream())
+            != ROCRAND_STATUS_SUCCESS)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        const rocrand_status status = generator->generate(*keys, permutation_key_count);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            generator->allocator.deallocate(*keys, generator->get_stream());
+            *keys = NULL;
+        }
+        return status;
+    }
+
+    template<class Generator>
+    inline rocrand_status generate_permutation(Generator * generator,
+                                               unsigned int * output,
+                                               const size_t n)
+    {
+        if(n == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        unsigned int * keys;
+        rocrand_status status = generate_permutation_keys(generator, &keys);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        status = permute(generator, output, n, keys, generator->get_stream());
+        generator->allocator.deallocate(keys, generator->get_stream());
+        return status;
+    }
+
+    template<class Word>
+    inline rocrand_status shuffle_words(rocrand_generator_base_type * generator,
+                                        Word * data,
+                                        const size_t n,
+                                        const size_t words,
+                                        const unsigned int * keys,
+                                        hipStream_t stream)
+    {
+        const rocrand_host::detail::device_allocator& allocator = generator->allocator;
+        Word * copy;
+        if(allocator.allocate(&copy, n * words, stream) != ROCRAND_STATUS_SUCCESS)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        unsigned int * permutation = NULL;
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        if(generator->permutation_method == ROCRAND_PERMUTATION_METHOD_EXACT)
+        {
+            if(allocator.allocate(&permutation, n, stream) != ROCRAND_STATUS_SUCCESS)
+                status = ROCRAND_STATUS_ALLOCATION_FAILED;
+            else
+                status = permute(generator, permutation, n, keys, stream);
+        }
+        if(status == ROCRAND_STATUS_SUCCESS
+            && hipMemcpyAsync(copy, data, n * words * sizeof(Word),
+                              hipMemcpyDeviceToDevice, stream) != hipSuccess)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(shuffle_kernel<Word>),
+                dim3(get_permutation_blocks(n)), dim3(permutation_block_size), 0, stream,
+                data, copy, n, words, permutation, keys, get_feistel_half_bits(n)
+            );
+            generator->count_launch();
+            if(hipPeekAtLastError() != hipSuccess)
+                status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        allocator.deallocate(permutation, stream);
+        allocator.deallocate(copy, stream);
+        return status;
+    }
+
+    // Elements are copied by the widest words which divide their size
+    // and the alignment of data
+    template<class Generator>
+    inline rocrand_status shuffle(Generator * generator,
+                                  void * data,
+                                  const size_t n,
+                                  const size_t element_size)
+    {
+        if(n == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        unsigned int * keys;
+        rocrand_status status = generate_permutation_keys(generator, &keys);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        hipStream_t stream = generator->get_stream();
+        const size_t alignment = element_size | reinterpret_cast<uintptr_t>(data);
+        if(alignment % sizeof(unsigned long long int) == 0)
+        {
+            status = shuffle_words(generator, static_cast<unsigned long long int *>(data),
+                                   n, element_size / sizeof(unsigned long long int),
+                                   keys, stream);
+        }
+        else if(alignment % sizeof(unsigned int) == 0)
+        {
+            status = shuffle_words(generator, static_cast<unsigned int *>(data),
+                                   n, element_size / sizeof(unsigned int),
+                                   keys, stream);
+        }
+        else
+        {
+            status = shuffle_words(generator, static_cast<unsigned char *>(data),
+                                   n, element_size, keys, stream);
+        }
+        generator->allocator.deallocate(keys, stream);
+        return status;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_PERMUTATION_H_
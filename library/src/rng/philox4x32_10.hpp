@@ -54,13 +54,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define ROCRAND_RNG_PHILOX4X32_10_H_
 
 #include <algorithm>
+#include <utility>
 #include <hip/hip_runtime.h>
 
 #include <rocrand.h>
 
 #include "generator_type.hpp"
 #include "device_engines.hpp"
+#include "common.hpp"
 #include "distributions.hpp"
+#include "launch_config.hpp"
+#include "device_position.hpp"
 
 namespace rocrand_host {
 namespace detail {
@@ -95,6 +99,20 @@ namespace detail {
         double w;
     };
 
+    struct ulonglong2_unaligned
+    {
+        unsigned long long x;
+        unsigned long long y;
+    };
+
+    struct half2x4_unaligned
+    {
+        __half2 x;
+        __half2 y;
+        __half2 z;
+        __half2 w;
+    };
+
     template<class T>
     struct unaligned_type
     {
@@ -125,17 +143,18 @@ namespace detail {
         typedef double4_unaligned type;
     };
 
-    inline __device__ unsigned int warp_reduce_min(unsigned int val, int size) {
-      for (int offset = size/2; offset > 0; offset /= 2) {
-        #if defined(__HIP_PLATFORM_NVCC__) && __CUDACC_VER_MAJOR__ >= 9
-        unsigned int temp = __shfl_xor_sync(0xffffffff, (int)val, offset);
-        #else
-        unsigned int temp = __shfl_xor((int)val, offset);
-        #endif
-        val = (temp < val) ? temp : val;
-      }
-      return val;
-    }
+    template<>
+    struct unaligned_type<ulonglong2>
+    {
+        typedef ulonglong2_unaligned type;
+    };
+
+    template<>
+    struct unaligned_type<half2x4>
+    {
+        typedef half2x4_unaligned type;
+    };
+
 
     struct philox4x32_10_device_engine : public ::rocrand_device::philox4x32_10_engine
     {
@@ -169,28 +188,52 @@ namespace detail {
         // m_state from base class
     };
 
+    inline __device__ unsigned int warp_reduce_min(unsigned int val, int size) {
+      for (int offset = size/2; offset > 0; offset /= 2) {
+        #if defined(__HIP_PLATFORM_NVCC__) && __CUDACC_VER_MAJOR__ >= 9
+        unsigned int temp = __shfl_xor_sync(0xffffffff, (int)val, offset);
+        #else
+        unsigned int temp = __shfl_xor((int)val, offset);
+        #endif
+        val = (temp < val) ? temp : val;
+      }
+      return val;
+    }
+
+    // Engines of ROCRAND_ORDERING_PSEUDO_DEFAULT and ROCRAND_ORDERING_PSEUDO_LEGACY:
+    // engine engine_id starts at subsequence subsequence_shift + engine_id
     __global__
-    void init_engines_kernel(philox4x32_10_device_engine * engines,
-                             const unsigned long long seed,
-                             const unsigned long long offset)
+    void init_legacy_engines_kernel(philox4x32_10_device_engine * engines,
+                                    const unsigned long long seed,
+                                    const unsigned long long subsequence_shift,
+                                    const unsigned long long offset)
     {
         const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        engines[engine_id] = philox4x32_10_device_engine(seed, engine_id, offset);
+        engines[engine_id] = philox4x32_10_device_engine(
+            seed, subsequence_shift + engine_id, offset
+        );
     }
 
-    template<unsigned int ThreadsPerEngine, class Distribution>
+    // Every engine is shared by ThreadsPerEngine consecutive threads, thread
+    // computes every ThreadsPerEngine-th group of 4 numbers of the engine
+    // (the sequence of the legacy ordering)
+    template<unsigned int ThreadsPerEngine, class Type, class Distribution>
     __global__
-    void generate_kernel(philox4x32_10_device_engine * engines,
-                         double * data, const size_t n,
-                         Distribution distribution)
+    void generate_legacy_kernel(philox4x32_10_device_engine * engines,
+                                Type * data, const size_t n,
+                                Distribution distribution)
     {
         typedef philox4x32_10_device_engine DeviceEngineType;
-        typedef decltype(distribution(uint4())) Type2;
-        typedef typename unaligned_type<Type2>::type Type2_unaligned;
+        // TypeX can be uint4, float4, double2, half2x4, ulonglong2
+        typedef decltype(distribution(uint4())) TypeX;
+        typedef typename unaligned_type<TypeX>::type TypeX_unaligned;
+        // x can be 2 or 4
+        constexpr unsigned int x = sizeof(TypeX) / sizeof(Type);
 
-        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
         const unsigned int engine_id = index/ThreadsPerEngine;
         const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        const size_t vectors = n / x;
 
         // Load device engine
         DeviceEngineType engine = engines[engine_id];
@@ -200,44 +243,48 @@ namespace detail {
             engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
         }
 
-        if(((uintptr_t)data)%(sizeof(Type2)) == 0)
+        if(((uintptr_t)data)%(sizeof(TypeX)) == 0)
         {
-            Type2 * data2 = (Type2 *)data;
-            while(index < (n/2))
+            TypeX * dataX = (TypeX *)data;
+            while(index < vectors)
             {
-                data2[index] = distribution(engine.next4_leap(ThreadsPerEngine));
+                dataX[index] = distribution(engine.next4_leap(ThreadsPerEngine));
                 // Next position
                 index += stride;
             }
         }
         else
         {
-            Type2_unaligned * data2 = (Type2_unaligned *)data;
-            while(index < (n/2))
+            TypeX_unaligned * dataX = (TypeX_unaligned *)data;
+            while(index < vectors)
             {
-                Type2 result = distribution(engine.next4_leap(ThreadsPerEngine));
-                data2[index] = *(Type2_unaligned*)(&result);  // reinterpret as Type4_unaligned
+                TypeX result = distribution(engine.next4_leap(ThreadsPerEngine));
+                dataX[index] = *(TypeX_unaligned*)(&result);  // reinterpret as TypeX_unaligned
                 // Next position
                 index += stride;
             }
         }
 
-        // Find thread with the smallest state of the engine which id is engine_id
-        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
-        const bool smallest_state = (index == index_min);
+        // Find thread with the smallest state of the engine which id is engine_id,
+        // indices of all threads are in [vectors, vectors + stride)
+        const unsigned int last = static_cast<unsigned int>(index - vectors);
+        const bool smallest_state = (last == warp_reduce_min(last, ThreadsPerEngine));
 
-        // Check if we need to save tail (last 1 random number).
+        // Check if we need to save tail (last 1,..,(x-1) random numbers).
         // Those numbers should be generated by the thread that would
-        // save next uint4 if n was equal n+1 (index < (n/2) would be
+        // save next TypeX if n was equal n+(x-1) (index < (n/x) would be
         // true in such situation).
-        // If this condition is met, then we know that (index == index_min)
-        // is also true for that thread, so we don't need to check that.
-        auto tail_size = n & 1;
-        if((index == n/2) && tail_size > 0)
+        // If this condition is met, then we know that the thread has
+        // the smallest state, so we don't need to check that.
+        const size_t tail_size = n % x;
+        if(index == vectors && tail_size > 0)
         {
-            Type2 result = distribution(engine.next4());
+            TypeX result = distribution(engine.next4());
             // Save the tail
-            data[n - tail_size] = result.x;
+            for(size_t i = 0; i < tail_size; i++)
+            {
+                data[n - tail_size + i] = (&result.x)[i];
+            }
         }
 
         // Save engine
@@ -245,272 +292,735 @@ namespace detail {
             engines[engine_id] = engine;
     }
 
-    template<unsigned int ThreadsPerEngine, class Type, class Distribution>
-    __global__
-    void generate_kernel(philox4x32_10_device_engine * engines,
-                         Type * data, const size_t n,
-                         Distribution distribution)
+    // Counter-based generators of this file differ only in the block
+    // function, which computes groups groups of 4 numbers for a 128-bit
+    // counter and a 64-bit key, engine_type has the same sequences in the
+    // device API. Only Philox4x32-10 keeps engines (see
+    // generate_legacy_kernel) with the legacy orderings (legacy_engines).
+    struct philox4x32_10_block
     {
-        typedef philox4x32_10_device_engine DeviceEngineType;
-        typedef decltype(distribution(uint4())) Type4;
-        typedef typename unaligned_type<Type4>::type Type4_unaligned;
+        typedef philox4x32_10_device_engine engine_type;
+        static constexpr unsigned int groups = 1;
+        static constexpr bool legacy_engines = true;
 
-        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        const unsigned int engine_id = index/ThreadsPerEngine;
-        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        __forceinline__ __device__ __host__
+        static void apply(const uint4 counter, const uint2 key, uint4 * result)
+        {
+            result[0] = ::rocrand_device::detail::philox4x32_10_ten_rounds(counter, key);
+        }
+    };
 
-        // Load device engine
-        DeviceEngineType engine = engines[engine_id];
-        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+    struct threefry4x32_20_block
+    {
+        typedef ::rocrand_device::threefry4x32_20_engine engine_type;
+        static constexpr unsigned int groups = 1;
+        static constexpr bool legacy_engines = false;
+
+        __forceinline__ __device__ __host__
+        static void apply(const uint4 counter, const uint2 key, uint4 * result)
         {
-            // Skips hipThreadIdx_x%ThreadsPerEngine states
-            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+            result[0] = ::rocrand_device::detail::threefry4x32_20_rounds_type::apply(counter, key);
         }
+    };
+
+    struct threefry2x64_20_block
+    {
+        typedef ::rocrand_device::threefry2x64_20_engine engine_type;
+        static constexpr unsigned int groups = 1;
+        static constexpr bool legacy_engines = false;
 
-        if(((uintptr_t)data)%(sizeof(Type4)) == 0)
+        __forceinline__ __device__ __host__
+        static void apply(const uint4 counter, const uint2 key, uint4 * result)
         {
-            Type4 * data4 = (Type4 *)data;
-            while(index < (n/4))
-            {
-                data4[index] = distribution(engine.next4_leap(ThreadsPerEngine));
-                // Next position
-                index += stride;
-            }
+            result[0] = ::rocrand_device::detail::threefry2x64_20_rounds_type::apply(counter, key);
         }
-        else
+    };
+
+    // 8 numbers (4 64-bit values) per counter, so doubles and 64-bit
+    // values take one round function per 4 values
+    struct philox4x64_10_block
+    {
+        typedef ::rocrand_device::philox4x64_10_engine engine_type;
+        static constexpr unsigned int groups = 2;
+        static constexpr bool legacy_engines = false;
+
+        __forceinline__ __device__ __host__
+        static void apply(const uint4 counter, const uint2 key, uint4 * result)
         {
-            Type4_unaligned * data4 = (Type4_unaligned *)data;
-            while(index < (n/4))
-            {
-                Type4 result = distribution(engine.next4_leap(ThreadsPerEngine));
-                data4[index] = *(Type4_unaligned*)(&result);  // reinterpret as Type4_unaligned
-                // Next position
-                index += stride;
-            }
+            ::rocrand_device::detail::philox4x64_10_apply(counter, key, result);
         }
+    };
 
-        // Find thread with the smallest state of the engine which id is engine_id
-        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
-        const bool smallest_state = (index == index_min);
+    // Returns 4 numbers starting at substate-th number of r and
+    // continuing in r_next, substate must be in [1, 3]
+    __forceinline__ __device__ __host__
+    uint4 philox4x32_10_combine(const uint4 r,
+                                const uint4 r_next,
+                                const unsigned int substate)
+    {
+        switch(substate)
+        {
+            case 1:
+                return uint4 { r.y, r.z, r.w, r_next.x };
+            case 2:
+                return uint4 { r.z, r.w, r_next.x, r_next.y };
+            default:
+                return uint4 { r.w, r_next.x, r_next.y, r_next.z };
+        }
+    }
 
-        // Check if we need to save tail (last 1,2,3 random number).
-        // Those numbers should be generated by the thread that would
-        // save next uint4 if n was equal n+3 (index < (n/4) would be
-        // true in such situation).
-        // If this condition is met, then we know that (index == index_min)
-        // is also true for that thread, so we don't need to check that.
-        auto tail_size = n & 3;
-        if((index == n/4) && tail_size > 0)
+    // Computes 4 * Block::groups consecutive random numbers starting at
+    // position 4 * Block::groups * counter + substate of subsequence 0 for
+    // the given key. substate must be the same for all threads (it is
+    // kernel argument).
+    template<class Block>
+    __forceinline__ __device__ __host__
+    void stateless_next(const uint2 key,
+                        const unsigned long long counter,
+                        const unsigned int substate,
+                        uint4 * result)
+    {
+        constexpr unsigned int groups = Block::groups;
+        const uint4 c = uint4 {
+            static_cast<unsigned int>(counter),
+            static_cast<unsigned int>(counter >> 32),
+            0, 0
+        };
+        if(substate == 0)
         {
-            Type4 result = distribution(engine.next4());
-            // Save the tail
-            data[n - tail_size] = result.x;
-            if(tail_size > 1) data[n - tail_size + 1] = result.y;
-            if(tail_size > 2) data[n - tail_size + 2] = result.z;
+            Block::apply(c, key, result);
+            return;
         }
 
-        // Save engine
-        if(smallest_state)
-            engines[engine_id] = engine;
+        // Numbers of the counter followed by numbers of the next counter
+        uint4 r[2 * groups];
+        Block::apply(c, key, r);
+        const unsigned long long counter_next = counter + 1;
+        const uint4 c_next = uint4 {
+            static_cast<unsigned int>(counter_next),
+            static_cast<unsigned int>(counter_next >> 32),
+            0, 0
+        };
+        Block::apply(c_next, key, r + groups);
+
+        const unsigned int shift = substate / 4;
+        const unsigned int rest = substate % 4;
+        for(unsigned int g = 0; g < groups; g++)
+        {
+            result[g] = rest == 0
+                ? r[g + shift]
+                : philox4x32_10_combine(r[g + shift], r[g + shift + 1], rest);
+        }
     }
 
-    template<unsigned int ThreadsPerEngine, class RealType, class Distribution>
+    // Applies Distribution, which transforms one unsigned int,
+    // to each of 4 random numbers
+    template<class Distribution>
+    struct philox4x32_10_distribution4
+    {
+        Distribution distribution;
+
+        __forceinline__ __device__ __host__
+        uint4 operator()(const uint4 v) const
+        {
+            return uint4 {
+                distribution(v.x),
+                distribution(v.y),
+                distribution(v.z),
+                distribution(v.w)
+            };
+        }
+    };
+
+    // Counter-based generation: no engine state is stored between
+    // launches, index-th group of 4 random numbers is computed directly
+    // from counter + index. device_position (capture-safe mode) is added
+    // to position.
+    template<class Block, class Type, class Distribution>
     __global__
-    void generate_normal_kernel(philox4x32_10_device_engine * engines,
-                                RealType * data, const size_t n,
-                                Distribution distribution)
+    void generate_kernel(const uint2 key,
+                         const unsigned long long position,
+                         const unsigned long long * device_position,
+                         Type * data, const size_t n,
+                         Distribution distribution)
     {
-        typedef philox4x32_10_device_engine DeviceEngineType;
-        // RealTypeX can be float4, double2
-        typedef decltype(distribution(uint4())) RealTypeX;
+        // TypeX can be uint4, float4, double2, half2x4, ulonglong2
+        typedef decltype(distribution(uint4())) TypeX;
+        typedef typename unaligned_type<TypeX>::type TypeX_unaligned;
         // x can be 2 or 4
-        const unsigned x = sizeof(RealTypeX) / sizeof(RealType);
+        constexpr unsigned int x = sizeof(TypeX) / sizeof(Type);
+        // Every thread stores groups TypeX values per counter
+        constexpr unsigned int groups = Block::groups;
 
-        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        const unsigned int engine_id = index/ThreadsPerEngine;
-        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        const unsigned long long p = position + load_position(device_position);
+        const unsigned long long counter = p / (4 * groups);
+        const unsigned int substate = static_cast<unsigned int>(p % (4 * groups));
 
-        // Load device engine
-        DeviceEngineType engine = engines[engine_id];
-        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+        const size_t vectors = n / (x * groups);
+
+        if(((uintptr_t)data)%(sizeof(TypeX)) == 0)
         {
-            // Skips hipThreadIdx_x%ThreadsPerEngine states
-            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+            TypeX * dataX = (TypeX *)data;
+            while(index < vectors)
+            {
+                uint4 r[groups];
+                stateless_next<Block>(key, counter + index, substate, r);
+                for(unsigned int g = 0; g < groups; g++)
+                {
+                    dataX[index * groups + g] = distribution(r[g]);
+                }
+                // Next position
+                index += stride;
+            }
         }
-
-        RealTypeX * dataX = (RealTypeX *)data;
-        while(index < (n/x))
+        else
         {
-            dataX[index] = distribution(engine.next4_leap(ThreadsPerEngine));
-            // Next position
-            index += stride;
+            TypeX_unaligned * dataX = (TypeX_unaligned *)data;
+            while(index < vectors)
+            {
+                uint4 r[groups];
+                stateless_next<Block>(key, counter + index, substate, r);
+                for(unsigned int g = 0; g < groups; g++)
+                {
+                    TypeX result = distribution(r[g]);
+                    dataX[index * groups + g] = *(TypeX_unaligned*)(&result); // reinterpret as TypeX_unaligned
+                }
+                // Next position
+                index += stride;
+            }
         }
 
-        // Find thread with the smallest state of the engine which id is engine_id
-        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
-        const bool smallest_state = index == index_min;
-
-        // Check if we need to save tail (last 1,..,(x-1) random number).
-        // Those numbers should be generated by the thread that would
-        // save next uint4 if n was equal n+(x-1) (index < (n/x) would be
-        // true in such situation).
-        // If this condition is met, then we know that (index == index_min)
-        // is also true for that thread, so we don't need to check that.
-        auto tail_size = n & (x - 1);
-        if((index == n/4) && tail_size > 0)
+        // Save the tail (last 1,..,(x * groups - 1) random numbers), it is
+        // generated by the thread that would save next TypeX values if n was
+        // equal n+(x * groups - 1).
+        const size_t tail_size = n % (x * groups);
+        if(index == vectors && tail_size > 0)
         {
-            RealTypeX result = distribution(engine.next4());
-            // Save the tail
-            data[n - tail_size] = (&result.x)[0]; // .x
-            if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
-            if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
+            uint4 r[groups];
+            stateless_next<Block>(key, counter + index, substate, r);
+            TypeX result[groups];
+            for(unsigned int g = 0; g < groups; g++)
+            {
+                result[g] = distribution(r[g]);
+            }
+            for(size_t i = 0; i < tail_size; i++)
+            {
+                data[n - tail_size + i] = (&result[i / x].x)[i % x];
+            }
         }
+    }
 
-        // Save engine
-        if(smallest_state)
-            engines[engine_id] = engine;
+    template<class Type, class Distribution>
+    using philox4x32_10_generate_kernel_type = void (*)(const uint2,
+                                                        const unsigned long long,
+                                                        const unsigned long long *,
+                                                        Type *, const size_t,
+                                                        Distribution);
+
+    // Generates a pitched 2D array: row r gets the numbers of the r-th of
+    // height consecutive generations of width numbers (every row starts
+    // at a new group of 4 numbers), so rows are stored with vector stores
+    template<class Block, class Type, class Distribution>
+    __global__
+    void generate_2d_kernel(const uint2 key,
+                            const unsigned long long position,
+                            const unsigned long long * device_position,
+                            char * data, const size_t width,
+                            const size_t height, const size_t pitch,
+                            Distribution distribution)
+    {
+        typedef decltype(distribution(uint4())) TypeX;
+        typedef typename unaligned_type<TypeX>::type TypeX_unaligned;
+        constexpr unsigned int x = sizeof(TypeX) / sizeof(Type);
+        constexpr unsigned int groups = Block::groups;
+
+        const unsigned long long p = position + load_position(device_position);
+        const unsigned long long counter = p / (4 * groups);
+        const unsigned int substate = static_cast<unsigned int>(p % (4 * groups));
+
+        const size_t row_vectors = (width + x - 1) / x;
+        const size_t vectors = row_vectors * height;
+        const size_t counters = (vectors + groups - 1) / groups;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+        for(size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            index < counters;
+            index += stride)
+        {
+            uint4 r[groups];
+            stateless_next<Block>(key, counter + index, substate, r);
+            for(unsigned int g = 0; g < groups && index * groups + g < vectors; g++)
+            {
+                const size_t vector = index * groups + g;
+                Type * row = (Type *)(data + (vector / row_vectors) * pitch);
+                const size_t column = (vector % row_vectors) * x;
+                TypeX result = distribution(r[g]);
+                if(column + x <= width)
+                {
+                    if(((uintptr_t)(row + column)) % sizeof(TypeX) == 0)
+                        *(TypeX *)(row + column) = result;
+                    else
+                        *(TypeX_unaligned *)(row + column) = *(TypeX_unaligned *)(&result);
+                }
+                else
+                {
+                    // The tail of the row
+                    for(size_t i = 0; column + i < width; i++)
+                    {
+                        row[column + i] = (&result.x)[i];
+                    }
+                }
+            }
+        }
     }
 
-    template <unsigned int ThreadsPerEngine, class Distribution>
+    template<class Type, class Distribution>
+    using philox4x32_10_generate_2d_kernel_type = void (*)(const uint2,
+                                                           const unsigned long long,
+                                                           const unsigned long long *,
+                                                           char *, const size_t,
+                                                           const size_t, const size_t,
+                                                           Distribution);
+
+    // Generates rows of n numbers, row r gets the numbers of a generator
+    // with seed seeds[r] starting at position. One thread computes one counter
+    // of one row, the key is read from seeds (no state per row is needed).
+    template<class Block, class Type, class Distribution>
     __global__
-    void generate_poisson_kernel(philox4x32_10_device_engine * engines,
-                                 unsigned int * data, const size_t n,
-                                 const Distribution distribution)
+    void generate_ensemble_kernel(const unsigned long long * seeds,
+                                  const unsigned long long position,
+                                  Type * data, const size_t k, const size_t n,
+                                  Distribution distribution)
     {
-        typedef philox4x32_10_device_engine DeviceEngineType;
+        typedef decltype(distribution(uint4())) TypeX;
+        typedef typename unaligned_type<TypeX>::type TypeX_unaligned;
+        constexpr unsigned int x = sizeof(TypeX) / sizeof(Type);
+        constexpr unsigned int groups = Block::groups;
+
+        const unsigned long long counter = position / (4 * groups);
+        const unsigned int substate = static_cast<unsigned int>(position % (4 * groups));
+
+        const size_t row_vectors = (n + x - 1) / x;
+        const size_t row_counters = (row_vectors + groups - 1) / groups;
+        const size_t counters = row_counters * k;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+        for(size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            index < counters;
+            index += stride)
+        {
+            const size_t row = index / row_counters;
+            const size_t row_index = index % row_counters;
+            const unsigned long long seed = seeds[row];
+            const uint2 key = uint2 {
+                static_cast<unsigned int>(seed),
+                static_cast<unsigned int>(seed >> 32)
+            };
+            uint4 r[groups];
+            stateless_next<Block>(key, counter + row_index, substate, r);
+            Type * row_data = data + row * n;
+            for(unsigned int g = 0; g < groups && row_index * groups + g < row_vectors; g++)
+            {
+                const size_t column = (row_index * groups + g) * x;
+                TypeX result = distribution(r[g]);
+                if(column + x <= n)
+                {
+                    if(((uintptr_t)(row_data + column)) % sizeof(TypeX) == 0)
+                        *(TypeX *)(row_data + column) = result;
+                    else
+                        *(TypeX_unaligned *)(row_data + column) = *(TypeX_unaligned *)(&result);
+                }
+                else
+                {
+                    // The tail of the row
+                    for(size_t i = 0; column + i < n; i++)
+                    {
+                        row_data[column + i] = (&result.x)[i];
+                    }
+                }
+            }
+        }
+    }
 
-        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        const unsigned int engine_id = index/ThreadsPerEngine;
-        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    template<class Type, class Distribution>
+    using philox4x32_10_generate_ensemble_kernel_type = void (*)(const unsigned long long *,
+                                                                 const unsigned long long,
+                                                                 Type *, const size_t,
+                                                                 const size_t,
+                                                                 Distribution);
+
+    // Numbers for one value of a distribution with rejection: first count
+    // numbers of v starting at lane * count, then (only after rejections) numbers computed from
+    // counters that the generator does not use: the first two words are the
+    // index of the group of 4 numbers v, the third word is the lane,
+    // the highest bit of the fourth word is set.
+    template<class Block>
+    struct counter_based_rejection_engine
+    {
+        uint4 v;
+        uint4 r[Block::groups];
+        uint2 key;
+        unsigned long long counter;
+        unsigned int lane;
+        unsigned int count;
+        unsigned int next;
 
-        // Load device engine
-        DeviceEngineType engine = engines[engine_id];
-        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        __forceinline__ __device__ __host__
+        counter_based_rejection_engine(const uint4 v,
+                                       const uint2 key,
+                                       const unsigned long long counter,
+                                       const unsigned int lane,
+                                       const unsigned int count)
+            : v(v), key(key), counter(counter), lane(lane), count(count), next(0)
         {
-            // Skips hipThreadIdx_x%ThreadsPerEngine states
-            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+
         }
 
-        if(((uintptr_t)data)%(sizeof(uint4)) == 0)
+        __forceinline__ __device__ __host__
+        unsigned int operator()()
         {
-            uint4 * data4 = (uint4 *)data;
-            while(index < (n / 4))
+            if(next < count)
             {
-                const uint4 u4 = engine.next4();
-                const uint4 result = uint4 {
-                    distribution(u4.x),
-                    distribution(u4.y),
-                    distribution(u4.z),
-                    distribution(u4.w)
-                };
-                data4[index] = result;
-                index += stride;
+                return (&v.x)[lane * count + next++];
             }
-        }
-        else
-        {
-            uint4_unaligned * data4 = (uint4_unaligned *)data;
-            while(index < (n / 4))
+            constexpr unsigned int numbers = 4 * Block::groups;
+            const unsigned int retry = next++ - count;
+            if(retry % numbers == 0)
             {
-                const uint4 u4 = engine.next4();
-                const uint4 result = uint4 {
-                    distribution(u4.x),
-                    distribution(u4.y),
-                    distribution(u4.z),
-                    distribution(u4.w)
+                const uint4 c = uint4 {
+                    static_cast<unsigned int>(counter),
+                    static_cast<unsigned int>(counter >> 32),
+                    lane,
+                    0x80000000U | (retry / numbers)
                 };
-                data4[index] = *(uint4_unaligned*)(&result); // reinterpret as uint4_unaligned
-                index += stride;
+                Block::apply(c, key, r);
             }
+            return (&r[(retry % numbers) / 4].x)[retry % 4];
         }
+    };
+
+    typedef counter_based_rejection_engine<philox4x32_10_block> philox4x32_10_rejection_engine;
 
-        // Find thread with the smallest state of the engine which id is engine_id
-        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
-        const bool smallest_state = index == index_min;
+    // Every group of 4 numbers gives 4 32-bit or 2 64-bit values,
+    // rejected numbers do not change positions of the following values.
+    template<class Block, class Type, class Distribution>
+    __global__
+    void generate_rejection_kernel(const uint2 key,
+                                   const unsigned long long position,
+                                   const unsigned long long * device_position,
+                                   Type * data, const size_t n,
+                                   const rejection_distribution<Type, Distribution> distribution)
+    {
+        // count can be 1 or 2 (numbers per value), x can be 4 or 2
+        constexpr unsigned int count = sizeof(Type) / sizeof(unsigned int);
+        constexpr unsigned int x = 4 / count;
+        constexpr unsigned int groups = Block::groups;
 
-        // First work-item saves the tail when n is not a multiple of 4
-        auto tail_size = n & 3;
-        if((index == n/4) == 0 && tail_size > 0)
+        const unsigned long long p = position + load_position(device_position);
+        const unsigned long long counter = p / (4 * groups);
+        const unsigned int substate = static_cast<unsigned int>(p % (4 * groups));
+
+        size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+        const size_t vectors = (n + x - 1) / x;
+        const size_t counters = (vectors + groups - 1) / groups;
+
+        while(index < counters)
         {
-            const uint4 u4 = engine.next4();
-            const uint4 result = uint4 {
-                distribution(u4.x),
-                distribution(u4.y),
-                distribution(u4.z),
-                distribution(u4.w)
-            };
-            data[n - tail_size] = (&result.x)[0]; // .x
-            if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
-            if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
+            uint4 r[groups];
+            stateless_next<Block>(key, counter + index, substate, r);
+            for(unsigned int g = 0; g < groups; g++)
+            {
+                const size_t vector = index * groups + g;
+                for(unsigned int lane = 0; lane < x; lane++)
+                {
+                    if(vector * x + lane < n)
+                    {
+                        counter_based_rejection_engine<Block> engine(
+                            r[g], key, (counter + index) * groups + g, lane, count
+                        );
+                        Type value;
+                        while(!distribution(engine, value, vector * x + lane)) { }
+                        data[vector * x + lane] = value;
+                    }
+                }
+            }
+            // Next position
+            index += stride;
         }
-
-        // Save engine with its state
-        if(smallest_state)
-            engines[engine_id] = engine;
     }
 
+    template<class Type, class Distribution>
+    using philox4x32_10_generate_rejection_kernel_type =
+        void (*)(const uint2,
+                 const unsigned long long,
+                 const unsigned long long *,
+                 Type *, const size_t,
+                 const rejection_distribution<Type, Distribution>);
+
 } // end namespace detail
 } // end namespace rocrand_host
 
-class rocrand_philox4x32_10 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>
+// Counter-based generator with the counter/key structure of Philox4x32-10,
+// numbers are computed by Block::apply() (Philox4x32-10, Threefry4x32-20,
+// Threefry2x64-20 or Philox4x64-10, see philox4x32_10_block).
+// Philox4x32-10 with ROCRAND_ORDERING_PSEUDO_DEFAULT and
+// ROCRAND_ORDERING_PSEUDO_LEGACY keeps the engines of earlier releases
+// (16 threads per engine), other orderings are counter-based.
+template<rocrand_rng_type RngType, class Block>
+class rocrand_counter_based_generator : public rocrand_generator_type<RngType>
 {
     static constexpr unsigned int s_threads_per_engine = 16;
 
 public:
-    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>;
-    using engine_type = ::rocrand_host::detail::philox4x32_10_device_engine;
-
-    rocrand_philox4x32_10(unsigned long long seed = 0,
-                          unsigned long long offset = 0,
-                          hipStream_t stream = 0)
+    using base_type = rocrand_generator_type<RngType>;
+    using engine_type = typename Block::engine_type;
+    using legacy_engine_type = ::rocrand_host::detail::philox4x32_10_device_engine;
+
+    using base_type::rng_type;
+    using base_type::allocator;
+    using base_type::poisson_cache;
+    using base_type::stats;
+    using base_type::count_launch;
+    using base_type::is_capturing;
+    using base_type::legacy_order;
+
+    rocrand_counter_based_generator(unsigned long long seed = 0,
+                                    unsigned long long offset = 0,
+                                    hipStream_t stream = 0)
         : base_type(seed, offset, stream),
+          m_partition_offset(0),
+          m_position(0),
           m_engines_initialized(false), m_engines(NULL),
-          m_engines_size(s_threads * s_blocks / s_threads_per_engine)
+          m_engines_size(s_threads * s_blocks / s_threads_per_engine),
+          m_subsequence_shift(0)
     {
-        // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
-        }
+        m_config = get_config();
     }
 
-    ~rocrand_philox4x32_10()
+    ~rocrand_counter_based_generator()
     {
-        hipFree(m_engines);
+        allocator.deallocate(m_engines, m_stream);
     }
 
     void reset()
     {
+        m_position = 0;
+        m_device_position.reset(m_stream);
         m_engines_initialized = false;
     }
 
+    /// True if numbers are generated by engines of the legacy orderings
+    /// (Philox4x32-10 only), see generate_legacy_kernel.
+    bool use_engines() const
+    {
+        return Block::legacy_engines && legacy_order();
+    }
+
     /// Changes seed to \p seed and resets generator state.
     void set_seed(unsigned long long seed)
     {
         m_seed = seed;
-        m_engines_initialized = false;
+        reset();
     }
 
     void set_offset(unsigned long long offset)
     {
         m_offset = offset;
+        reset();
+    }
+
+    /// Numbers of \p rank are [rank * B, (rank + 1) * B) where B is
+    /// (2^64 - 1) / \p nranks rounded down to whole counters, the offset is
+    /// added. Counters of ranks are disjoint, so are counters of rejections.
+    /// Engines of \p rank start at subsequence rank * ((2^64 - 1) / \p nranks).
+    void set_subsequence_partition(unsigned int rank, unsigned int nranks)
+    {
+        const unsigned long long counter_size = 4 * Block::groups;
+        m_partition_offset = rank * (~0ULL / nranks / counter_size * counter_size);
+        m_subsequence_shift = rank * (~0ULL / nranks);
+        reset();
+    }
+
+    /// Results of counter-based orderings do not depend on the ordering,
+    /// only the grid is changed. Legacy orderings of Philox4x32-10 use engines.
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        m_order = order;
+        reset();
+        m_config = get_config();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns the number of bytes of device memory allocated by the generator,
+    /// engines are allocated by the first generation with engines.
+    size_t get_memory_usage() const
+    {
+        return (m_engines != NULL ? sizeof(legacy_engine_type) * m_engines_size : 0)
+            + m_device_position.memory_usage()
+            + m_poisson.memory_usage();
+    }
+
+    /// Sets the allocator of device memory, allocated engines are moved
+    /// to memory of \p new_allocator. The generator is not changed if
+    /// the allocation fails.
+    rocrand_status set_allocator(const rocrand_host::detail::device_allocator& new_allocator)
+    {
+        if(new_allocator == allocator)
+            return ROCRAND_STATUS_SUCCESS;
+        if(m_engines == NULL)
+            return base_type::set_allocator(new_allocator);
+
+        legacy_engine_type * engines = NULL;
+        if(new_allocator.allocate(&engines, m_engines_size, m_stream) != ROCRAND_STATUS_SUCCESS)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        if(m_engines_initialized
+           && hipMemcpyAsync(engines, m_engines, sizeof(legacy_engine_type) * m_engines_size,
+                             hipMemcpyDeviceToDevice, m_stream) != hipSuccess)
+        {
+            new_allocator.deallocate(engines, m_stream);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        allocator.deallocate(m_engines, m_stream);
+        m_engines = engines;
+        return base_type::set_allocator(new_allocator);
+    }
+
+    /// In capture-safe mode the position is stored in device memory,
+    /// so generations captured into a graph continue the sequence.
+    rocrand_status set_capture_safe(bool capture_safe)
+    {
+        if(is_capturing())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        if(capture_safe)
+            return m_device_position.enable(allocator, m_stream);
+
+        unsigned long long position;
+        rocrand_status status = m_device_position.disable(position, m_stream);
+        m_position += position;
+        return status;
+    }
+
+    /// Returns the number of bytes of a state saved by save_state(),
+    /// engines are saved with the legacy orderings, otherwise only counters.
+    size_t get_state_size() const
+    {
+        return rocrand_host::detail::get_state_size(
+            use_engines() ? sizeof(legacy_engine_type) * m_engines_size : 0
+        );
+    }
+
+    /// Saves seed, offset, ordering, position and engines (if they are
+    /// initialized) to \p state, copies are enqueued to \p stream (in
+    /// capture-safe mode the position in device memory is copied by the device).
+    rocrand_status save_state(void * state, hipStream_t stream) const
+    {
+        rocrand_host::detail::generator_state_header header = make_state_header();
+        header.position = m_position;
+        if(!use_engines())
+        {
+            header.initialized = 1;
+            return rocrand_host::detail::save_state(
+                state, header, m_device_position.get(), NULL, 0, stream
+            );
+        }
+
+        header.initialized = m_engines_initialized ? 1 : 0;
+        header.engines_size = m_engines_size;
+        return rocrand_host::detail::save_state(
+            state, header, m_device_position.get(), m_engines,
+            m_engines_initialized ? sizeof(legacy_engine_type) * m_engines_size : 0, stream
+        );
+    }
+
+    /// Restores a state saved by save_state(), the whole position is moved
+    /// to the host and the position in device memory is reset. Engines
+    /// are copied on \p stream without initialization.
+    rocrand_status load_state(const void * state, hipStream_t stream)
+    {
+        rocrand_host::detail::generator_state_header header;
+        rocrand_status status =
+            rocrand_host::detail::load_state_header(state, rng_type, header, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        // Engines are saved only with the legacy orderings, the generator
+        // is not changed if the state does not match
+        const bool engines = Block::legacy_engines && legacy_order(header.order);
+        if(header.engines_size != (engines ? m_engines_size : 0))
+            return ROCRAND_STATUS_TYPE_ERROR;
+
+        restore_state_settings(header);
+        m_config = get_config();
+        m_position = header.position + header.device_position;
         m_engines_initialized = false;
+        status = m_device_position.reset(m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(!use_engines() || header.initialized == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        status = allocate_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        status = rocrand_host::detail::load_state_engines(
+            state, m_engines, sizeof(legacy_engine_type) * m_engines_size, stream
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
     }
 
+    /// Initializes the generator as a child of \p parent (see
+    /// rocrand_fork_generator()): settings are copied and the key of the
+    /// child is derived from the seed of \p parent and \p subsequence_id,
+    /// counters of the child start at the offset of \p parent.
+    /// With the legacy orderings the seed is kept and engines of the child
+    /// start (subsequence_id + 1) times the number of engines subsequences
+    /// after engines of \p parent, so their sequences do not overlap.
+    rocrand_status fork(rocrand_counter_based_generator& parent, unsigned long long subsequence_id)
+    {
+        copy_settings(parent);
+        m_partition_offset = parent.m_partition_offset;
+        m_config = get_config();
+        if(use_engines())
+        {
+            m_subsequence_shift = parent.m_subsequence_shift
+                + (subsequence_id + 1) * m_engines_size;
+        }
+        else
+        {
+            m_seed = ::rocrand_device::detail::splitmix64_seed(parent.m_seed, subsequence_id);
+        }
+        reset();
+        return set_allocator(parent.allocator);
+    }
+
+    /// Counter-based orderings have no engine state to initialize,
+    /// engines of the legacy orderings are allocated and initialized.
     rocrand_status init()
     {
-        if(m_engines_initialized)
+        if(!use_engines() || m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
+        rocrand_host::detail::init_stats_scope init_scope(stats);
+        // A captured initialization would reset engines on every launch
+        // of the graph
+        if(is_capturing())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        rocrand_status status = allocate_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
 
         hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+            HIP_KERNEL_NAME(rocrand_host::detail::init_legacy_engines_kernel),
             dim3(s_blocks/s_threads_per_engine), dim3(s_threads), 0, m_stream,
-            m_engines, m_seed, m_offset
+            m_engines, m_seed, m_subsequence_shift, m_offset
         );
         // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
+        if(rocrand_host::detail::launch_failed())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch();
 
         m_engines_initialized = true;
         return ROCRAND_STATUS_SUCCESS;
@@ -520,22 +1030,67 @@ public:
     rocrand_status generate(T * data, size_t data_size,
                             const Distribution& distribution = Distribution())
     {
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
+        typedef decltype(std::declval<Distribution&>()(uint4())) TypeX;
+        constexpr unsigned int x = sizeof(TypeX) / sizeof(T);
+
+        if(use_engines())
+            return generate_engines(data, data_size, distribution);
+
+        rocrand_status status = generate_at(m_partition_offset + m_offset + m_position,
+                                            m_device_position.get(),
+                                            data, data_size, distribution);
+        if(status != ROCRAND_STATUS_SUCCESS)
             return status;
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        // Every started group of numbers is consumed
+        return advance(4 * ((data_size + x - 1) / x));
+    }
 
+    /// Returns the seed and the position of the next number, and advances
+    /// the generator as generate() of data_size unsigned ints does, so
+    /// the numbers can be computed outside of the library.
+    /// The host does not know the position in capture-safe mode.
+    rocrand_status reserve(size_t data_size,
+                           unsigned long long& seed,
+                           unsigned long long& position)
+    {
+        if(m_device_position.enabled() || use_engines())
+            return ROCRAND_STATUS_TYPE_ERROR;
+
+        seed = m_seed;
+        position = m_partition_offset + m_offset + m_position;
+        m_position += 4 * ((data_size + 3) / 4);
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    /// Generates numbers [start, start + data_size) of the sequence returned
+    /// by generate() after initialization without changing the state of the
+    /// generator, numbers are computed directly from their counters.
+    /// Not available with engines of the legacy orderings.
+    rocrand_status generate_range(unsigned int * data,
+                                  unsigned long long start,
+                                  size_t data_size)
+    {
+        if(use_engines())
+            return ROCRAND_STATUS_TYPE_ERROR;
+        uniform_distribution<unsigned int> udistribution;
+        return generate_at(m_partition_offset + m_offset + start, NULL,
+                           data, data_size, udistribution);
+    }
+
+    /// The same for 64-bit numbers (pairs of consecutive 32-bit numbers,
+    /// the first one is the lower half), \p start is the index of a 64-bit number.
+    rocrand_status generate_range(unsigned long long * data,
+                                  unsigned long long start,
+                                  size_t data_size)
+    {
+        if(use_engines())
+            return ROCRAND_STATUS_TYPE_ERROR;
+        uniform_distribution<unsigned long long> udistribution;
+        return generate_at(m_partition_offset + m_offset + 2 * start, NULL,
+                           data, data_size, udistribution);
+    }
+
     template<class T>
     rocrand_status generate_uniform(T * data, size_t data_size)
     {
@@ -543,102 +1098,557 @@ public:
         return generate(data, data_size, udistribution);
     }
 
+    /// Doubles are computed from two numbers, or from one number
+    /// with ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT.
+    rocrand_status generate_uniform(double * data, size_t data_size)
+    {
+        if(m_double_resolution == ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT)
+        {
+            uniform_double_fast_distribution distribution;
+            return generate(data, data_size, distribution);
+        }
+
+        uniform_distribution<double> udistribution;
+        return generate(data, data_size, udistribution);
+    }
+
     template<class T>
     rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
     {
-        // data_size must be even
-        // data must be aligned to 2 * sizeof(T) bytes
-        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(T))) != 0)
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
         {
-            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+            normal_ziggurat_distribution<T> distribution(mean, stddev);
+            return generate_rejection(data, data_size, make_rejection_distribution<T>(distribution));
+        }
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_INVERSION)
+        {
+            normal_inversion_distribution<T> distribution(mean, stddev);
+            return generate_rejection(data, data_size, make_rejection_distribution<T>(distribution));
         }
 
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
-            return status;
+        if(m_math_mode == ROCRAND_MATH_MODE_FAST)
+        {
+            normal_fast_distribution<T> distribution(mean, stddev);
+            return generate(data, data_size, distribution);
+        }
 
         normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            log_normal_ziggurat_distribution<T> distribution(mean, stddev);
+            return generate_rejection(data, data_size, make_rejection_distribution<T>(distribution));
+        }
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_INVERSION)
+        {
+            log_normal_inversion_distribution<T> distribution(mean, stddev);
+            return generate_rejection(data, data_size, make_rejection_distribution<T>(distribution));
+        }
+
+        if(m_math_mode == ROCRAND_MATH_MODE_FAST)
+        {
+            log_normal_fast_distribution<T> distribution(mean, stddev);
+            return generate(data, data_size, distribution);
+        }
+
+        log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
 
+    /// Generates a pitched 2D array (pitch in bytes), the results are the same
+    /// as of height calls of generate() with width numbers, one per row.
+    template<class T, class Distribution>
+    rocrand_status generate_2d(T * data, size_t width, size_t height, size_t pitch,
+                               const Distribution& distribution)
+    {
+        typedef decltype(std::declval<const Distribution&>()(uint4())) TypeX;
+        constexpr unsigned int x = sizeof(TypeX) / sizeof(T);
+
+        if(use_engines())
+        {
+            return rocrand_host::detail::generate_rows(data, height, pitch, [&](T * row)
+            {
+                return generate(row, width, distribution);
+            });
+        }
+
+        const uint2 key = counter_key();
+        const size_t vectors = ((width + x - 1) / x) * height;
+
+        // One thread per counter (Block::groups vectors)
+        const unsigned int blocks = rocrand_host::detail::get_launch_blocks(
+            static_cast<rocrand_host::detail::philox4x32_10_generate_2d_kernel_type<T, Distribution>>(
+                rocrand_host::detail::generate_2d_kernel<Block, T, Distribution>
+            ),
+            m_config,
+            (vectors + Block::groups - 1) / Block::groups
+        );
         hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_2d_kernel<Block, T, Distribution>),
+            dim3(blocks), dim3(m_config.threads), 0, m_stream,
+            key, m_partition_offset + m_offset + m_position, m_device_position.get(),
+            reinterpret_cast<char *>(data), width, height, pitch, distribution
         );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
+        if(rocrand_host::detail::launch_failed())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch(width * height);
 
+        return advance(4 * vectors);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_2d(T * data, size_t width, size_t height, size_t pitch)
+    {
+        uniform_distribution<T> udistribution;
+        return generate_2d(data, width, height, pitch, udistribution);
+    }
+
+    /// Generates k rows of \p n numbers, row r gets the numbers of a generator
+    /// with the settings of this one and seed \p seeds[r] (device memory),
+    /// the seed is the key of the row. The state of the generator is not changed.
+    /// Not available with engines of the legacy orderings (they need a state per seed).
+    template<class T, class Distribution>
+    rocrand_status generate_ensemble(T * data, const unsigned long long * seeds,
+                                     size_t k, size_t n,
+                                     const Distribution& distribution)
+    {
+        typedef decltype(std::declval<const Distribution&>()(uint4())) TypeX;
+        constexpr unsigned int x = sizeof(TypeX) / sizeof(T);
+
+        if(use_engines())
+            return ROCRAND_STATUS_TYPE_ERROR;
+        if(k == 0 || n == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        const size_t row_vectors = (n + x - 1) / x;
+        const size_t counters = (row_vectors + Block::groups - 1) / Block::groups * k;
+        const unsigned int blocks = rocrand_host::detail::get_launch_blocks(
+            static_cast<rocrand_host::detail::philox4x32_10_generate_ensemble_kernel_type<T, Distribution>>(
+                rocrand_host::detail::generate_ensemble_kernel<Block, T, Distribution>
+            ),
+            m_config,
+            counters
+        );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_ensemble_kernel<Block, T, Distribution>),
+            dim3(blocks), dim3(m_config.threads), 0, m_stream,
+            seeds, m_partition_offset + m_offset, data, k, n, distribution
+        );
+        if(rocrand_host::detail::launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch(k * n);
         return ROCRAND_STATUS_SUCCESS;
     }
 
     template<class T>
-    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    rocrand_status generate_uniform_ensemble(T * data, const unsigned long long * seeds,
+                                             size_t k, size_t n)
+    {
+        uniform_distribution<T> udistribution;
+        return generate_ensemble(data, seeds, k, n, udistribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal_2d(T * data, size_t width, size_t height, size_t pitch,
+                                      T mean, T stddev)
     {
-        // data_size must be even
-        // data must be aligned to 2 * sizeof(T) bytes
-        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(T))) != 0)
+        if(m_normal_method != ROCRAND_NORMAL_METHOD_BOX_MULLER)
         {
-            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+            return rocrand_host::detail::generate_rows(data, height, pitch, [&](T * row)
+            {
+                return generate_normal(row, width, mean, stddev);
+            });
         }
 
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
-            return status;
+        if(m_math_mode == ROCRAND_MATH_MODE_FAST)
+        {
+            normal_fast_distribution<T> distribution(mean, stddev);
+            return generate_2d(data, width, height, pitch, distribution);
+        }
+
+        normal_distribution<T> distribution(mean, stddev);
+        return generate_2d(data, width, height, pitch, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal_2d(T * data, size_t width, size_t height, size_t pitch,
+                                          T mean, T stddev)
+    {
+        if(m_normal_method != ROCRAND_NORMAL_METHOD_BOX_MULLER)
+        {
+            return rocrand_host::detail::generate_rows(data, height, pitch, [&](T * row)
+            {
+                return generate_log_normal(row, width, mean, stddev);
+            });
+        }
+
+        if(m_math_mode == ROCRAND_MATH_MODE_FAST)
+        {
+            log_normal_fast_distribution<T> distribution(mean, stddev);
+            return generate_2d(data, width, height, pitch, distribution);
+        }
 
         log_normal_distribution<T> distribution(mean, stddev);
+        return generate_2d(data, width, height, pitch, distribution);
+    }
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+    // Half values are generated in pairs from 32-bit numbers (16 bits
+    // per value), so data_size must be even and data must be aligned
+    // to 2 * sizeof(__half) bytes
+    rocrand_status generate_uniform(__half * data, size_t data_size)
+    {
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(__half))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
 
-        return ROCRAND_STATUS_SUCCESS;
+        uniform_distribution<__half2> distribution;
+        return generate(reinterpret_cast<__half2 *>(data), data_size / 2, distribution);
+    }
+
+    rocrand_status generate_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(__half))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        normal_distribution<__half2> distribution(mean, stddev);
+        return generate(reinterpret_cast<__half2 *>(data), data_size / 2, distribution);
+    }
+
+    rocrand_status generate_log_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(__half))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        log_normal_distribution<__half2> distribution(mean, stddev);
+        return generate(reinterpret_cast<__half2 *>(data), data_size / 2, distribution);
+    }
+
+    template<class IntType>
+    rocrand_status generate_uniform_int(IntType * data, size_t data_size,
+                                        IntType lo, IntType hi)
+    {
+        uniform_int_distribution<IntType> distribution(lo, hi);
+        return generate_rejection(data, data_size,
+                                  make_rejection_distribution<IntType>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate_rejection(data, data_size,
+                                  make_rejection_distribution<T>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T * data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate_rejection(data, data_size,
+                                  make_rejection_distribution<T>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate_rejection(data, data_size,
+                                  make_rejection_distribution<T>(distribution));
+    }
+
+    // 32 trials with probability p per value, bits rounded up to whole values
+    rocrand_status generate_bernoulli_bits(unsigned int * data, size_t bits, double p)
+    {
+        bernoulli_bits_distribution distribution(p);
+        return generate_rejection(data, (bits + 31) / 32,
+                                  make_rejection_distribution<unsigned int>(distribution));
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T a, T b)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, a, b);
+        return generate_rejection(data, data_size,
+                                  make_rejection_distribution<T>(distribution));
+    }
+
+    // Vectors are columns of a data_size x dimensions column-major matrix
+    template<class T>
+    rocrand_status generate_multivariate_normal(T * data, size_t data_size,
+                                                unsigned int dimensions,
+                                                const T * mean, const T * factor)
+    {
+        return generate_multivariate_normal_dimensions(*this, data, data_size,
+                                                       dimensions, mean, factor);
+    }
+
+    template<class T, unsigned int MaxDimensions>
+    rocrand_status generate_multivariate_normal(T * data, size_t data_size,
+                                                const multivariate_normal_distribution<T, MaxDimensions>& distribution)
+    {
+        return generate_rejection(data + (distribution.dimensions - 1) * data_size, data_size,
+                                  make_rejection_distribution<T>(distribution));
     }
 
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
-            return status;
+        // Large lambda: rejection on the device, no tables are built
+        if(lambda >= rocrand_device::detail::lambda_threshold_small)
+        {
+            poisson_rejection_distribution distribution(lambda);
+            return generate_rejection(data, data_size,
+                                      make_rejection_distribution<unsigned int>(distribution));
+        }
 
         try
         {
-            m_poisson.set_lambda(lambda);
+            m_poisson.set_lambda(lambda, poisson_cache, allocator, m_stream, is_capturing());
         }
         catch(rocrand_status status)
         {
             return status;
         }
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, m_poisson.dis
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        typedef rocrand_host::detail::philox4x32_10_distribution4<
+            decltype(m_poisson.dis)
+        > distribution_type;
+        return generate(data, data_size, distribution_type { m_poisson.dis });
+    }
 
-        return ROCRAND_STATUS_SUCCESS;
+    // Every value has its own lambda, lambdas is in device memory
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size,
+                                    const double * lambdas)
+    {
+        poisson_array_distribution distribution { lambdas };
+        return generate_rejection(data, data_size,
+                                  make_rejection_distribution<unsigned int>(distribution));
     }
 
+    // Every value has its own number of trials and probability,
+    // trials and probabilities are in device memory
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     const unsigned int * trials,
+                                     const double * probabilities)
+    {
+        binomial_array_distribution distribution { trials, probabilities };
+        return generate_rejection(data, data_size,
+                                  make_rejection_distribution<unsigned int>(distribution));
+    }
+
+    // Counts of categories of a value are data_size values apart
+    rocrand_status generate_multinomial(unsigned int * data, size_t data_size,
+                                        const unsigned int * trials,
+                                        const double * probabilities,
+                                        unsigned int categories)
+    {
+        multinomial_array_distribution distribution {
+            trials, probabilities, categories, data_size, data
+        };
+        return generate_rejection(data + (categories - 1) * data_size, data_size,
+                                  make_rejection_distribution<unsigned int>(distribution));
+    }
+
+protected:
+    using base_type::m_order;
+    using base_type::m_seed;
+    using base_type::m_offset;
+    using base_type::m_stream;
+    using base_type::m_normal_method;
+    using base_type::m_math_mode;
+    using base_type::m_double_resolution;
+    using base_type::make_state_header;
+    using base_type::restore_state_settings;
+    using base_type::copy_settings;
+
 private:
+    // First number of the partition set by set_subsequence_partition()
+    unsigned long long m_partition_offset;
+    // Number of random numbers generated since the last reset
+    // (in capture-safe mode m_device_position is added)
+    unsigned long long m_position;
+    rocrand_host::detail::device_position m_device_position;
+    rocrand_host::detail::launch_config m_config;
+
+    // Engines of the legacy orderings, allocated by the first initialization
     bool m_engines_initialized;
-    engine_type * m_engines;
+    legacy_engine_type * m_engines;
     const size_t m_engines_size;
+    // Subsequence of the first engine (see set_subsequence_partition())
+    unsigned long long m_subsequence_shift;
 
+    // Grid used when the device can not be queried
     const static uint32_t s_threads = 256;
     const static uint32_t s_blocks = 1024;
 
-    // For caching of Poisson for consecutive generations with the same lambda
+    // Cache of Poisson tables of recently used lambdas
     poisson_distribution_manager<> m_poisson;
 
+    rocrand_host::detail::launch_config get_config() const
+    {
+        if(legacy_order())
+        {
+            return { s_threads, s_blocks, 0, 0 };
+        }
+        return rocrand_host::detail::get_launch_config(
+            RngType,
+            static_cast<
+                rocrand_host::detail::philox4x32_10_generate_kernel_type<
+                    unsigned int, uniform_distribution<unsigned int>
+                >
+            >(rocrand_host::detail::generate_kernel<Block>),
+            { s_threads, s_blocks, 0, 0 }
+        );
+    }
+
+    // Allocates engines of the legacy orderings if they are not allocated yet
+    rocrand_status allocate_engines()
+    {
+        if(m_engines != NULL)
+            return ROCRAND_STATUS_SUCCESS;
+        return allocator.allocate(&m_engines, m_engines_size, m_stream);
+    }
+
+    // Key of counter-based generation, with engines distributions with
+    // rejection are counter-based with a key derived from the seed, so
+    // their numbers do not overlap subsequences of engines
+    uint2 counter_key() const
+    {
+        const unsigned long long key = use_engines()
+            ? ::rocrand_device::detail::splitmix64_seed(m_seed, ~0ULL)
+            : m_seed;
+        return uint2 {
+            static_cast<unsigned int>(key),
+            static_cast<unsigned int>(key >> 32)
+        };
+    }
+
+    // Numbers of engines of the legacy orderings, the grid is fixed
+    // because engine_id and the lane depend on it
+    template<class T, class Distribution>
+    rocrand_status generate_engines(T * data, size_t data_size,
+                                    const Distribution& distribution)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_legacy_kernel<s_threads_per_engine>),
+            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, data_size, distribution
+        );
+        // Check kernel status
+        if(rocrand_host::detail::launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch(data_size);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Moves the position of the next number, on the device in capture-safe
+    // mode
+    rocrand_status advance(const unsigned long long count)
+    {
+        if(m_device_position.enabled())
+            return m_device_position.advance(count, m_stream);
+        m_position += count;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Values of the stream of subsequence 0 starting from position
+    // (+ device_position if it is not NULL) are generated, 4 numbers at a time
+    template<class T, class Distribution>
+    rocrand_status generate_at(const unsigned long long position,
+                               const unsigned long long * device_position,
+                               T * data, size_t data_size,
+                               const Distribution& distribution)
+    {
+        typedef decltype(std::declval<const Distribution&>()(uint4())) TypeX;
+        constexpr unsigned int x = sizeof(TypeX) / sizeof(T);
+
+        const uint2 key = counter_key();
+
+        // One thread per counter (including the tail)
+        const unsigned int blocks = rocrand_host::detail::get_launch_blocks(
+            static_cast<rocrand_host::detail::philox4x32_10_generate_kernel_type<T, Distribution>>(
+                rocrand_host::detail::generate_kernel<Block>
+            ),
+            m_config,
+            (data_size + x * Block::groups - 1) / (x * Block::groups)
+        );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<Block>),
+            dim3(blocks), dim3(m_config.threads), 0, m_stream,
+            key, position, device_position,
+            data, data_size, distribution
+        );
+        // Check kernel status
+        if(rocrand_host::detail::launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch(data_size);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Values of distributions with rejection, every started group of
+    // 4 numbers is consumed regardless of rejections
+    template<class T, class Distribution>
+    rocrand_status generate_rejection(T * data, size_t data_size,
+                                      const rejection_distribution<T, Distribution>& distribution)
+    {
+        // x can be 4 (32-bit values) or 2 (64-bit values)
+        constexpr unsigned int x = 4 * sizeof(unsigned int) / sizeof(T);
+
+        const uint2 key = counter_key();
+        const unsigned long long position = m_partition_offset + m_offset + m_position;
+
+        const unsigned int blocks = rocrand_host::detail::get_launch_blocks(
+            static_cast<rocrand_host::detail::philox4x32_10_generate_rejection_kernel_type<T, Distribution>>(
+                rocrand_host::detail::generate_rejection_kernel<Block>
+            ),
+            m_config,
+            (data_size + x * Block::groups - 1) / (x * Block::groups)
+        );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_rejection_kernel<Block>),
+            dim3(blocks), dim3(m_config.threads), 0, m_stream,
+            key, position, m_device_position.get(),
+            data, data_size, distribution
+        );
+        // Check kernel status
+        if(rocrand_host::detail::launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch(data_size);
+
+        return advance(4 * ((data_size + x - 1) / x));
+    }
+
     // m_seed from base_type
     // m_offset from base_type
 };
 
+typedef rocrand_counter_based_generator<
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10, rocrand_host::detail::philox4x32_10_block
+> rocrand_philox4x32_10;
+typedef rocrand_counter_based_generator<
+    ROCRAND_RNG_PSEUDO_THREEFRY4_32_20, rocrand_host::detail::threefry4x32_20_block
+> rocrand_threefry4x32_20;
+typedef rocrand_counter_based_generator<
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20, rocrand_host::detail::threefry2x64_20_block
+> rocrand_threefry2x64_20;
+typedef rocrand_counter_based_generator<
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10, rocrand_host::detail::philox4x64_10_block
+> rocrand_philox4x64_10;
+
 #endif // ROCRAND_RNG_PHILOX4X32_10_H_
@@ -0,0 +1,196 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_PRECOMPUTED_TABLES_H_
+#define ROCRAND_RNG_PRECOMPUTED_TABLES_H_
+
+#include <map>
+#include <mutex>
+#include <vector>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+#include <rocrand_xorwow.h>
+#include <rocrand_mrg32k3a.h>
+#include <rocrand_xoshiro128pp.h>
+
+#include "sobol_host_tables.hpp"
+
+// Tables of the library for rocrand_get_host_tables() and
+// rocrand_get_device_tables(), device code compiled with
+// ROCRAND_EXTERNAL_TABLES uses them instead of its own copies.
+
+namespace rocrand_host {
+namespace detail {
+
+    inline rocrand_precomputed_tables make_precomputed_tables_layout()
+    {
+        rocrand_precomputed_tables tables = {};
+        tables.xorwow_jump_log2 = XORWOW_JUMP_LOG2;
+        tables.xorwow_jump_multiples = XORWOW_JUMP_MULTIPLES;
+        tables.mrg32k3a_jump_log2 = MRG323A_JUMP_LOG2;
+        tables.sobol_dimensions = get_sobol_host_tables().dimensions;
+        return tables;
+    }
+
+    inline const rocrand_precomputed_tables * get_host_tables()
+    {
+        static const rocrand_precomputed_tables tables = []()
+        {
+            rocrand_precomputed_tables t = make_precomputed_tables_layout();
+            t.xorwow_jump_matrices = &h_xorwow_jump_matrices[0][0];
+            t.xorwow_sequence_jump_matrices = &h_xorwow_sequence_jump_matrices[0][0];
+            t.mrg32k3a_A1 = h_A1;
+            t.mrg32k3a_A2 = h_A2;
+            t.mrg32k3a_A1P67 = h_A1P67;
+            t.mrg32k3a_A2P67 = h_A2P67;
+            t.mrg32k3a_A1P127 = h_A1P127;
+            t.mrg32k3a_A2P127 = h_A2P127;
+            t.xoshiro128pp_jump_polynomials = &h_xoshiro128pp_jump_polynomials[0][0];
+            t.xoshiro128pp_sequence_jump_polynomials
+                = &h_xoshiro128pp_sequence_jump_polynomials[0][0];
+            const sobol_host_tables& sobol = get_sobol_host_tables();
+            t.sobol32_direction_vectors = sobol.sobol32_direction_vectors;
+            t.sobol64_direction_vectors = sobol.sobol64_direction_vectors;
+            t.scrambled_sobol32_constants = sobol.scrambled_sobol32_constants;
+            t.scrambled_sobol64_constants = sobol.scrambled_sobol64_constants;
+            return t;
+        }();
+        return &tables;
+    }
+
+    // Device tables of the current device which are allocated by the library
+    class device_tables_builder
+    {
+    public:
+        ~device_tables_builder()
+        {
+            // Tables of a failed build
+            for(void * table : m_allocations)
+                hipFree(table);
+        }
+
+        template<class T>
+        bool symbol(const T *& table, const void * symbol)
+        {
+            void * address = NULL;
+            if(hipGetSymbolAddress(&address, symbol) != hipSuccess)
+                return false;
+            table = static_cast<const T *>(address);
+            return true;
+        }
+
+        template<class T>
+        rocrand_status copy(const T *& table, const T * host_table, const size_t size)
+        {
+            T * device_table = NULL;
+            if(hipMalloc(&device_table, sizeof(T) * size) != hipSuccess)
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            m_allocations.push_back(device_table);
+            if(hipMemcpy(device_table, host_table, sizeof(T) * size,
+                         hipMemcpyHostToDevice) != hipSuccess)
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            table = device_table;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Tables are used until the process exits
+        void release()
+        {
+            m_allocations.clear();
+        }
+
+    private:
+        std::vector<void *> m_allocations;
+    };
+
+    inline rocrand_status build_device_tables(rocrand_precomputed_tables& tables)
+    {
+        tables = make_precomputed_tables_layout();
+        device_tables_builder builder;
+        if(!builder.symbol(tables.xorwow_jump_matrices, HIP_SYMBOL(d_xorwow_jump_matrices))
+            || !builder.symbol(tables.xorwow_sequence_jump_matrices,
+                               HIP_SYMBOL(d_xorwow_sequence_jump_matrices))
+            || !builder.symbol(tables.mrg32k3a_A1, HIP_SYMBOL(d_A1))
+            || !builder.symbol(tables.mrg32k3a_A2, HIP_SYMBOL(d_A2))
+            || !builder.symbol(tables.mrg32k3a_A1P67, HIP_SYMBOL(d_A1P67))
+            || !builder.symbol(tables.mrg32k3a_A2P67, HIP_SYMBOL(d_A2P67))
+            || !builder.symbol(tables.mrg32k3a_A1P127, HIP_SYMBOL(d_A1P127))
+            || !builder.symbol(tables.mrg32k3a_A2P127, HIP_SYMBOL(d_A2P127))
+            || !builder.symbol(tables.xoshiro128pp_jump_polynomials,
+                               HIP_SYMBOL(d_xoshiro128pp_jump_polynomials))
+            || !builder.symbol(tables.xoshiro128pp_sequence_jump_polynomials,
+                               HIP_SYMBOL(d_xoshiro128pp_sequence_jump_polynomials)))
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        const sobol_host_tables& sobol = get_sobol_host_tables();
+        const size_t dimensions = sobol.dimensions;
+        rocrand_status status;
+        if((status = builder.copy(tables.sobol32_direction_vectors,
+                                  sobol.sobol32_direction_vectors, dimensions * 32))
+                != ROCRAND_STATUS_SUCCESS
+            || (status = builder.copy(tables.sobol64_direction_vectors,
+                                      sobol.sobol64_direction_vectors, dimensions * 64))
+                != ROCRAND_STATUS_SUCCESS
+            || (status = builder.copy(tables.scrambled_sobol32_constants,
+                                      sobol.scrambled_sobol32_constants, dimensions))
+                != ROCRAND_STATUS_SUCCESS
+            || (status = builder.copy(tables.scrambled_sobol64_constants,
+                                      sobol.scrambled_sobol64_constants, dimensions))
+                != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        builder.release();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Tables are built once per device, returned pointers stay valid
+    // until the process exits
+    inline rocrand_status get_device_tables(const rocrand_precomputed_tables ** tables)
+    {
+        int device_id;
+        if(hipGetDevice(&device_id) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
+        static std::mutex cache_mutex;
+        static std::map<int, rocrand_precomputed_tables> cache;
+
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = cache.find(device_id);
+        if(it == cache.end())
+        {
+            rocrand_precomputed_tables device_tables;
+            const rocrand_status status = build_device_tables(device_tables);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            it = cache.emplace(device_id, device_tables).first;
+        }
+        *tables = &it->second;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_PRECOMPUTED_TABLES_H_
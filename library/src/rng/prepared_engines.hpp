@@ -0,0 +1,172 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCRAND_RNG_PREPARED_ENGINES_H_
+#define ROCRAND_RNG_PREPARED_ENGINES_H_
+
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "allocator.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Second buffer of engines of a generator with engine states, used by
+// rocrand_prepare_seed(): engines of the next seed are initialized on a
+// separate stream while the current engines are still in use, set_seed()
+// of the same seed then swaps buffers without launching the init kernel.
+// Events order the buffers between the two streams: the generator's
+// stream waits until prepared engines are ready, and initialization of
+// the next seed waits until kernels using the swapped out engines finish.
+template<class Engine>
+class prepared_engines
+{
+public:
+
+    prepared_engines()
+        : m_engines(NULL), m_size(0), m_stream(NULL),
+          m_ready(NULL), m_released(NULL), m_valid(false), m_seed(0) { }
+
+    ~prepared_engines()
+    {
+        release();
+        if(m_stream != NULL)
+            hipStreamDestroy(m_stream);
+        if(m_ready != NULL)
+            hipEventDestroy(m_ready);
+        if(m_released != NULL)
+            hipEventDestroy(m_released);
+    }
+
+    // Allocates size engines by allocator (the allocator of engines of
+    // the generator, so swapped buffers are freed by the same allocator),
+    // the returned buffer must be initialized on stream() and then
+    // committed by end()
+    rocrand_status begin(size_t size, const device_allocator& allocator)
+    {
+        m_valid = false;
+        if(m_stream == NULL)
+        {
+            if(hipStreamCreateWithFlags(&m_stream, hipStreamNonBlocking) != hipSuccess
+                || hipEventCreateWithFlags(&m_ready, hipEventDisableTiming) != hipSuccess
+                || hipEventCreateWithFlags(&m_released, hipEventDisableTiming) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+        }
+        // Swapped out engines can still be used by the generator's stream
+        if(hipStreamWaitEvent(m_stream, m_released, 0) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        if(size != m_size || !(allocator == m_allocator))
+        {
+            m_allocator.deallocate(m_engines, m_stream);
+            m_engines = NULL;
+            m_size = 0;
+            if(allocator.allocate(&m_engines, size, m_stream) != ROCRAND_STATUS_SUCCESS)
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            m_allocator = allocator;
+            m_size = size;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status end(unsigned long long seed)
+    {
+        if(hipEventRecord(m_ready, m_stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        m_seed = seed;
+        m_valid = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Swaps prepared engines of seed with engines of the generator,
+    // returns false if they were not prepared for this seed and size
+    bool swap(unsigned long long seed, Engine *& engines, size_t size, hipStream_t stream)
+    {
+        if(!m_valid || m_seed != seed || m_size != size)
+        {
+            m_valid = false;
+            return false;
+        }
+        m_valid = false;
+        if(hipStreamWaitEvent(stream, m_ready, 0) != hipSuccess)
+            return false;
+        std::swap(engines, m_engines);
+        hipEventRecord(m_released, stream);
+        return true;
+    }
+
+    // Prepared engines become invalid when the offset, ordering or
+    // number of engines is changed
+    void invalidate()
+    {
+        m_valid = false;
+    }
+
+    // Frees prepared engines (e.g. when the allocator of the generator
+    // is changed), they are freed after kernels using them are completed
+    void release()
+    {
+        m_valid = false;
+        if(m_engines != NULL)
+        {
+            hipStreamWaitEvent(m_stream, m_released, 0);
+            m_allocator.deallocate(m_engines, m_stream);
+        }
+        m_engines = NULL;
+        m_size = 0;
+    }
+
+    Engine * engines() const
+    {
+        return m_engines;
+    }
+
+    hipStream_t stream() const
+    {
+        return m_stream;
+    }
+
+    size_t memory_usage() const
+    {
+        return sizeof(Engine) * m_size;
+    }
+
+private:
+    Engine * m_engines;
+    size_t m_size;
+    device_allocator m_allocator;
+    hipStream_t m_stream;
+    // Recorded on m_stream after initialization of prepared engines
+    hipEvent_t m_ready;
+    // Recorded on the generator's stream when engines are swapped out
+    hipEvent_t m_released;
+    bool m_valid;
+    unsigned long long m_seed;
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_PREPARED_ENGINES_H_
@@ -0,0 +1,170 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_PROFILING_H_
+#define ROCRAND_RNG_PROFILING_H_
+
+// Profiler ranges (roctx on ROCm, NVTX on CUDA) around host API calls and
+// host-side setup, so they are visible in timelines of rocprof and nsys.
+// Ranges are compiled only if the library is built with ENABLE_ROCTX
+// (ROCRAND_ENABLE_ROCTX is defined) and pushed only if the environment
+// variable ROCRAND_ROCTX is set to a value other than 0:
+//
+//   ROCRAND_PROFILING_RANGE(generator, n);       // "<function>(<type>, <n>)"
+//   ROCRAND_PROFILING_NAMED_RANGE("name", ...);  // "name(...)"
+//   ROCRAND_PROFILING_NAMED_RANGE(__func__);     // "<function>"
+//
+// Without ENABLE_ROCTX the macros expand to nothing.
+
+#ifdef ROCRAND_ENABLE_ROCTX
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+
+#if defined(__HIP_PLATFORM_NVCC__)
+#include <nvToolsExt.h>
+#else
+#include <roctx.h>
+#endif
+
+namespace rocrand_host {
+namespace detail {
+
+    inline bool profiling_enabled()
+    {
+        static const bool enabled = []() {
+            const char * value = std::getenv("ROCRAND_ROCTX");
+            return value != NULL && value[0] != '\0' && std::strcmp(value, "0") != 0;
+        }();
+        return enabled;
+    }
+
+    // Pushes a range in the constructor and pops it in the destructor
+    class profiling_range
+    {
+    public:
+        explicit profiling_range(const char * name)
+            : m_pushed(profiling_enabled())
+        {
+            if(m_pushed) push(name);
+        }
+
+        profiling_range(const char * name, const rocrand_rng_type rng_type)
+            : m_pushed(profiling_enabled())
+        {
+            if(m_pushed) push(std::string(name) + "(" + rng_type_name(rng_type) + ")");
+        }
+
+        profiling_range(const char * name, const rocrand_rng_type rng_type, const size_t n)
+            : m_pushed(profiling_enabled())
+        {
+            if(m_pushed)
+            {
+                push(std::string(name) + "(" + rng_type_name(rng_type) + ", "
+                     + std::to_string(n) + ")");
+            }
+        }
+
+        // Generators of the host API, the generator can be NULL
+        profiling_range(const char * name, const rocrand_generator_base_type * generator)
+            : m_pushed(profiling_enabled())
+        {
+            if(m_pushed)
+            {
+                push(std::string(name) + "("
+                     + (generator == NULL ? "NULL" : rng_type_name(generator->rng_type))
+                     + (generator != NULL && generator->host ? ", host" : "") + ")");
+            }
+        }
+
+        profiling_range(const char * name, const rocrand_generator_base_type * generator,
+                        const size_t n)
+            : m_pushed(profiling_enabled())
+        {
+            if(m_pushed)
+            {
+                push(std::string(name) + "("
+                     + (generator == NULL ? "NULL" : rng_type_name(generator->rng_type))
+                     + (generator != NULL && generator->host ? ", host" : "") + ", "
+                     + std::to_string(n) + ")");
+            }
+        }
+
+        profiling_range(const char * name, const size_t value)
+            : m_pushed(profiling_enabled())
+        {
+            if(m_pushed) push(std::string(name) + "(" + std::to_string(value) + ")");
+        }
+
+        profiling_range(const char * name, const double value)
+            : m_pushed(profiling_enabled())
+        {
+            if(m_pushed) push(std::string(name) + "(" + std::to_string(value) + ")");
+        }
+
+        ~profiling_range()
+        {
+            if(m_pushed)
+            {
+#if defined(__HIP_PLATFORM_NVCC__)
+                nvtxRangePop();
+#else
+                roctxRangePop();
+#endif
+            }
+        }
+
+        profiling_range(const profiling_range&) = delete;
+        profiling_range& operator=(const profiling_range&) = delete;
+
+    private:
+        void push(const std::string& name)
+        {
+#if defined(__HIP_PLATFORM_NVCC__)
+            nvtxRangePushA(name.c_str());
+#else
+            roctxRangePushA(name.c_str());
+#endif
+        }
+
+        const bool m_pushed;
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#define ROCRAND_PROFILING_RANGE(...) \
+    ::rocrand_host::detail::profiling_range rocrand_profiling_range_(__func__, __VA_ARGS__)
+#define ROCRAND_PROFILING_NAMED_RANGE(name, ...) \
+    ::rocrand_host::detail::profiling_range rocrand_profiling_range_(name, ##__VA_ARGS__)
+
+#else // ROCRAND_ENABLE_ROCTX
+
+#define ROCRAND_PROFILING_RANGE(...)
+#define ROCRAND_PROFILING_NAMED_RANGE(name, ...)
+
+#endif // ROCRAND_ENABLE_ROCTX
+
+#endif // ROCRAND_RNG_PROFILING_H_
@@ -0,0 +1,95 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_RANGE_ENGINES_H_
+#define ROCRAND_RNG_RANGE_ENGINES_H_
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "allocator.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Engines of rocrand_generate_range(), separate from the engines of the
+// generator's sequence. They are allocated by the first range and kept by
+// the generator, so later ranges only launch the init and generate kernels
+// (freeing device memory can synchronize the device). Ranges of the
+// generator's stream are ordered by the stream. The generator frees them
+// by release() on its stream.
+template<class Engine>
+class range_engines
+{
+public:
+
+    range_engines()
+        : m_engines(NULL), m_size(0) { }
+
+    // Allocates size engines by allocator if they are not allocated yet
+    rocrand_status reserve(size_t size, const device_allocator& allocator, hipStream_t stream)
+    {
+        if(size == m_size)
+            return ROCRAND_STATUS_SUCCESS;
+        Engine * engines = NULL;
+        if(allocator.allocate(&engines, size, stream) != ROCRAND_STATUS_SUCCESS)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        m_allocator.deallocate(m_engines, stream);
+        m_engines = engines;
+        m_size = size;
+        m_allocator = allocator;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Frees engines (when the generator is destroyed or its allocator
+    // is changed), they are freed after kernels using them are completed
+    void release(hipStream_t stream)
+    {
+        if(m_engines != NULL)
+            m_allocator.deallocate(m_engines, stream);
+        m_engines = NULL;
+        m_size = 0;
+    }
+
+    bool reserved(size_t size) const
+    {
+        return size == m_size;
+    }
+
+    Engine * engines() const
+    {
+        return m_engines;
+    }
+
+    size_t memory_usage() const
+    {
+        return sizeof(Engine) * m_size;
+    }
+
+private:
+    Engine * m_engines;
+    size_t m_size;
+    device_allocator m_allocator;
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_RANGE_ENGINES_H_
@@ -0,0 +1,1075 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_MT19937_PRECOMPUTED_H_
+#define ROCRAND_MT19937_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/mt19937_precomputed_generator
+
+#define MT19937_N 624
+#define MT19937_JUMP_LOG2 1000
+#define MT19937_JUMP_POLYNOMIALS 13
+
+static const unsigned int h_mt19937_jump_polynomials[MT19937_JUMP_POLYNOMIALS][MT19937_N] = {
+    {
+        1029216725U, 522129096U, 1404193697U, 1706379128U, 3314573488U, 2604108850U, 3090990978U, 3181204109U,
+        2984008756U, 608304318U, 867100621U, 4046633987U, 4223820612U, 4268457878U, 3301256689U, 1502767414U,
+        3431140940U, 188919160U, 2173903033U, 837433747U, 943607293U, 2825535438U, 901180903U, 2421943118U,
+        2908849482U, 1039887392U, 3297035407U, 903498576U, 2653072081U, 3724788723U, 2604177601U, 587170307U,
+        3250657055U, 3248786954U, 2058794874U, 18661818U, 562487613U, 2448240587U, 1071942063U, 3595017572U,
+        1994289799U, 2292169297U, 1213482744U, 3656846818U, 3688575320U, 3524595825U, 1073438965U, 859054615U,
+        845079987U, 322434944U, 2583500348U, 2207547427U, 4177385418U, 1288038780U, 3466186929U, 2456019680U,
+        1264386637U, 3636459472U, 107689006U, 2126194601U, 3087247302U, 2724059645U, 2080849047U, 3114100635U,
+        2627201493U, 1535563991U, 2189134141U, 1333548919U, 1809065994U, 3928003338U, 2087223576U, 647502406U,
+        3056762245U, 388370514U, 4125277855U, 3071792922U, 926571255U, 2998240158U, 3308958641U, 1374305334U,
+        3749118758U, 2258693984U, 2483994993U, 909674788U, 1256281987U, 2560394231U, 3622828937U, 539303311U,
+        4090494437U, 837205051U, 2928713932U, 1926787019U, 34325321U, 3450540371U, 4280415047U, 2835692028U,
+        175484597U, 809188447U, 2585296606U, 337426131U, 625992022U, 1110750311U, 1294021552U, 1945050692U,
+        1135016274U, 1848058151U, 1537438840U, 3486676268U, 1755797346U, 4181694260U, 1440192629U, 3668260760U,
+        2854534857U, 3214244736U, 3251548264U, 3714644284U, 4083386659U, 1259294739U, 2649763573U, 2370916873U,
+        2618628564U, 3594310361U, 792134222U, 3979941812U, 970820887U, 3663235505U, 790463237U, 3065922752U,
+        3532591371U, 2389075976U, 685731465U, 1734834746U, 1353630292U, 3841655356U, 1819234095U, 399464405U,
+        1446869701U, 476325435U, 2970281823U, 2705953581U, 1704833952U, 1918954895U, 3687071416U, 3304023765U,
+        1258357236U, 4008314010U, 3710583590U, 1703610445U, 2511886692U, 3918867322U, 829265889U, 766509333U,
+        55036854U, 2550057992U, 1164958637U, 1748270415U, 3558310617U, 1510560400U, 1283288056U, 927549277U,
+        837162419U, 1741873588U, 349209985U, 2192529193U, 1978207889U, 1753613241U, 190201501U, 2549573584U,
+        194344865U, 1028286659U, 2998657866U, 2290817620U, 4048037181U, 1367853287U, 2038308136U, 1358291528U,
+        192351983U, 2619082574U, 3269794584U, 906254701U, 2164220590U, 3852893434U, 1491299659U, 2344573403U,
+        2516397223U, 1780004872U, 2314016267U, 1215157659U, 51447709U, 927513112U, 1004865947U, 1436209747U,
+        3674614748U, 3275573763U, 605832265U, 381484501U, 2253301451U, 3473185021U, 1266510952U, 510531085U,
+        4109594641U, 1498233384U, 3033167331U, 2131876864U, 3282252986U, 3260985073U, 4227042666U, 2520880485U,
+        1067613945U, 2990555370U, 1595379228U, 1969289555U, 1992297759U, 1778487164U, 2664987192U, 2431164921U,
+        1036484734U, 2469087657U, 1967780222U, 1592879442U, 1269786519U, 4084857297U, 1625960265U, 110162508U,
+        920262913U, 1473693224U, 2095784886U, 2989020267U, 393300500U, 1002202756U, 4110887408U, 2885049256U,
+        2055540831U, 311212683U, 803271720U, 2744421197U, 1051278631U, 4292472425U, 3358995867U, 2856998533U,
+        2339176045U, 3241516608U, 740984423U, 4014162526U, 1904866665U, 1157031161U, 1275160429U, 3919494428U,
+        3490846131U, 1461530785U, 1559848507U, 3330244117U, 419807390U, 3846420416U, 3089157897U, 1113444652U,
+        1257775293U, 308744983U, 1576269290U, 4182974072U, 1775167248U, 1493583137U, 543530399U, 3116031432U,
+        917804283U, 2598843653U, 2644969579U, 880154326U, 195078218U, 3532194249U, 1596410091U, 3680182939U,
+        52683460U, 381104116U, 3714297290U, 1398459305U, 2089802413U, 1077540944U, 1346125844U, 3986492893U,
+        1545051663U, 289541234U, 1041771332U, 1492634494U, 3361759900U, 255869165U, 4281826409U, 1457425988U,
+        765856349U, 943554361U, 1443323161U, 3668285050U, 3459403493U, 1374408769U, 3083669382U, 3300399960U,
+        1289557049U, 2989496717U, 2795486783U, 3932574368U, 1721177978U, 3999216079U, 3844488565U, 1717574618U,
+        116517682U, 891733457U, 1137341075U, 3276351633U, 2048139433U, 664654100U, 589898357U, 508983173U,
+        3267443173U, 2812932244U, 2566863415U, 1898827513U, 2184456091U, 2134971173U, 1314047493U, 3391617371U,
+        2478907860U, 3432577181U, 4261128070U, 3379044895U, 600394055U, 153123004U, 3731990392U, 299336186U,
+        4125207772U, 3679219098U, 1168209063U, 2441086490U, 4153226549U, 2321999497U, 2309334351U, 4176384666U,
+        2652525635U, 3793989429U, 3129665927U, 3974540366U, 2737708715U, 2433820939U, 3690523827U, 3093279590U,
+        3036531234U, 1563478665U, 3645240351U, 3016835161U, 273675067U, 162114906U, 2193349900U, 1871638569U,
+        3096346678U, 793875303U, 2339815410U, 100249085U, 1722339442U, 637013952U, 2873738132U, 3721106298U,
+        2646843430U, 3491789486U, 2990419294U, 2251122805U, 1536931109U, 4243511051U, 25885289U, 596802905U,
+        2002286535U, 370564836U, 1759027666U, 3456768695U, 388434211U, 826549762U, 2374840048U, 1697577629U,
+        3035618719U, 3064080302U, 1800955072U, 476335829U, 463039200U, 2111528703U, 3484087860U, 3942472574U,
+        3154760815U, 1071500399U, 1566322789U, 1169676444U, 1472069703U, 123102300U, 3654871654U, 2435500710U,
+        3353438369U, 2040560132U, 2288650163U, 13035973U, 2681498120U, 783723614U, 3041763169U, 2937279248U,
+        4101752652U, 1922175093U, 1160022407U, 3379551019U, 2021502874U, 3951981293U, 3674368882U, 3068475020U,
+        2549112595U, 1666431610U, 1260184267U, 3878851572U, 2994773238U, 1539408592U, 3633482332U, 3370095865U,
+        2167813464U, 1531670989U, 4006000224U, 3463300769U, 2060275495U, 1435355468U, 69475960U, 1623128723U,
+        2219110812U, 1201934882U, 1057497264U, 3731280046U, 2697519036U, 2367859878U, 4134881123U, 1243599012U,
+        3370031344U, 2910908187U, 1531536532U, 2400539390U, 4222447284U, 20047703U, 3562375423U, 417021134U,
+        2462440119U, 2535276001U, 975464169U, 2852739557U, 2548800096U, 3784914638U, 2500325665U, 3797427025U,
+        4042178109U, 2039182918U, 2367533087U, 1134886724U, 3634423388U, 3976413250U, 2022599540U, 2647364784U,
+        415335199U, 3084319555U, 1569708351U, 3239809338U, 1007359543U, 707156807U, 1241234428U, 3263892651U,
+        472784716U, 3301766507U, 3499443931U, 3407546768U, 1876920365U, 4225797613U, 3367424086U, 305501587U,
+        1190890334U, 265011268U, 1754954769U, 3737308394U, 3076847697U, 1244979347U, 941066606U, 2497879539U,
+        3381472333U, 3725597878U, 253267726U, 514464225U, 790981316U, 1987789928U, 2065722793U, 454218687U,
+        3525572688U, 1706286297U, 3087631726U, 314391120U, 1105987335U, 736911215U, 2249682905U, 2686365079U,
+        1165221994U, 785053494U, 961789486U, 88294512U, 1699074985U, 3792963073U, 51618349U, 610567379U,
+        1589213486U, 1823098003U, 2073762580U, 1111167154U, 4181734794U, 4171846168U, 1320045705U, 997890739U,
+        2156361933U, 185721865U, 1915374404U, 4057533289U, 3560798770U, 2849975382U, 1809861887U, 1964430320U,
+        3408374226U, 967707415U, 2738102631U, 835097565U, 2637290561U, 1524983030U, 3464387119U, 2433346985U,
+        60609505U, 3052142732U, 1900303590U, 1803685713U, 1867303085U, 3173209923U, 1825897451U, 458609197U,
+        2105351303U, 1367536812U, 4014554385U, 784522876U, 1032892797U, 4171408091U, 307809392U, 1214412250U,
+        2754736917U, 2981801791U, 2487630185U, 3634777240U, 504339528U, 1550255491U, 3686039743U, 1735365327U,
+        1389429416U, 1223457762U, 3665507888U, 2543339378U, 2238367949U, 2801102803U, 641825506U, 2711693758U,
+        777376077U, 1130075864U, 86368344U, 1626190345U, 1539362016U, 2703985618U, 2778026802U, 1763944318U,
+        3624523630U, 2111736528U, 2848594016U, 3176663754U, 196701010U, 3164487546U, 2207820579U, 87832435U,
+        1727127858U, 3365601538U, 3265329059U, 1080503126U, 194072428U, 3386254035U, 4134310486U, 702816622U,
+        776370178U, 1231714894U, 1531741947U, 1738954280U, 200443523U, 284302204U, 1702806249U, 3105215202U,
+        1307238869U, 1179417895U, 1990684421U, 1132694580U, 4048540110U, 113215138U, 1529714098U, 197924472U,
+        2250696373U, 1327025978U, 3266174835U, 3374821961U, 3178374230U, 2564314985U, 3933395891U, 2141134656U,
+        4207163270U, 2203439490U, 3776849164U, 1803048808U, 2568241634U, 1575670936U, 1551736809U, 946548044U,
+        1223491097U, 2572766365U, 1805008719U, 2641888330U, 3858779640U, 3925260371U, 742182709U, 1U,
+    },
+    {
+        2557940171U, 2249380855U, 3937381170U, 720354938U, 508658949U, 1386263032U, 2513673681U, 3541320887U,
+        3263719128U, 3420191639U, 2128386724U, 1018485059U, 3352423627U, 72441062U, 3014365041U, 3713425917U,
+        2254706658U, 3984934728U, 1639690288U, 1196308236U, 534788268U, 3639040924U, 2513123716U, 1800122151U,
+        2899509395U, 1411924795U, 4068379009U, 3001969690U, 2285093995U, 233878165U, 1359471539U, 3926488574U,
+        1777625790U, 3684384557U, 3926509155U, 1711349918U, 2783982159U, 1852565523U, 1925571524U, 2182638020U,
+        2668328845U, 2416660719U, 2167265091U, 3942257851U, 1303273222U, 1508730590U, 1333208380U, 2247933788U,
+        3667227277U, 1623128014U, 1649976756U, 339337833U, 3866033799U, 2029220643U, 11447513U, 946930267U,
+        3606678477U, 3639384164U, 3298418812U, 1669944639U, 762133230U, 2786185824U, 636828174U, 3619216365U,
+        101672316U, 1723584770U, 638209112U, 3122832554U, 936943284U, 3469167003U, 3294647061U, 3211029430U,
+        3531936560U, 1189452647U, 843490649U, 3629421443U, 3101955565U, 319113378U, 3649409525U, 659309319U,
+        2930470241U, 255340300U, 2889694545U, 1731897945U, 2571811446U, 2851605450U, 2453612041U, 1630998065U,
+        587863904U, 3774041568U, 368065139U, 4069288453U, 392193153U, 1923002598U, 3641688993U, 4208960073U,
+        1370529666U, 4218977533U, 1233419234U, 2457868629U, 4149164751U, 2615814097U, 232476165U, 2023411537U,
+        1876524306U, 3156150712U, 3461065438U, 3050991186U, 2460244253U, 621713396U, 2386459098U, 1709494871U,
+        2996882565U, 3429074041U, 2658734649U, 1255907965U, 3516964637U, 1190936641U, 1459808810U, 1417381954U,
+        2960269389U, 3802677992U, 3569613961U, 4236771017U, 22499420U, 242496276U, 921768164U, 2465141485U,
+        1941601693U, 2088589268U, 3293479218U, 4039082047U, 3828610048U, 2082741781U, 1584672645U, 2150639799U,
+        3864789087U, 3319316195U, 940888107U, 481178890U, 1791368754U, 1443157684U, 2011298026U, 3234572635U,
+        2446454844U, 3531808513U, 2737256479U, 4038242982U, 2673085623U, 2331317184U, 1447910736U, 1799087418U,
+        1909165194U, 3268204657U, 3046472663U, 3146108045U, 3455518266U, 808147832U, 1262878802U, 3233537241U,
+        1225519930U, 1664233378U, 3791253360U, 1199128922U, 2825894993U, 2530499693U, 3694060236U, 1191279243U,
+        2866749090U, 413966720U, 3541134570U, 3319722963U, 2775488802U, 547932073U, 619280756U, 4277406625U,
+        1876965797U, 2377832710U, 1922918326U, 3533659639U, 2931904966U, 1800968446U, 2675761764U, 1374375940U,
+        395475708U, 4132691336U, 4182096139U, 3805964042U, 1377602269U, 493216321U, 4042283966U, 3322643176U,
+        3733297620U, 2982410708U, 3596898502U, 3001715849U, 1756959469U, 3563060899U, 1423344349U, 2394136849U,
+        981019825U, 2422062289U, 2237311716U, 3301747280U, 3724729697U, 3212776043U, 618193110U, 1725731043U,
+        4150222882U, 377592173U, 2883447883U, 1121400765U, 356841876U, 938336582U, 790082872U, 3121387326U,
+        2618046598U, 1792674090U, 2763572536U, 1028195472U, 4103415641U, 2591176953U, 2003847824U, 742058128U,
+        3343721126U, 3927402270U, 2606585347U, 1314060003U, 2120452412U, 3261791147U, 3796066707U, 950016574U,
+        1779121912U, 2850730477U, 2912581642U, 1951693187U, 1745280275U, 712678049U, 2029320264U, 1877595636U,
+        2176485224U, 296870524U, 1604775290U, 1349880284U, 2996290699U, 2208344133U, 1763652231U, 305826599U,
+        2409173290U, 2848320187U, 2500836013U, 1312465670U, 3356261825U, 3735463891U, 533952376U, 1284557951U,
+        788050727U, 1947364163U, 1072830844U, 259719203U, 580081376U, 2599711883U, 2456272317U, 926048432U,
+        2211743558U, 2523826862U, 2884986577U, 3942140926U, 311823471U, 3495468497U, 2003572313U, 1264485859U,
+        4281876787U, 3674059592U, 623201829U, 2009257111U, 2327135291U, 1492999508U, 2155200466U, 3653137343U,
+        2026562195U, 3329617201U, 388144604U, 2554124545U, 2254312512U, 4158826926U, 3125433189U, 2061832245U,
+        1032477329U, 3327470358U, 3742878280U, 2321710687U, 1218016768U, 2956061168U, 355121962U, 2694729949U,
+        3157123951U, 3448898245U, 1257847657U, 309664142U, 2480767443U, 1611868813U, 1013840410U, 129275890U,
+        3933985901U, 675310657U, 2580340666U, 3229456079U, 3526193877U, 1755412705U, 119353059U, 1005097496U,
+        1682143323U, 26260831U, 523224944U, 4005970713U, 3236694337U, 94958199U, 2592575403U, 2481765112U,
+        666922788U, 1566695580U, 1672309675U, 1655525618U, 437908481U, 3156840903U, 2352057951U, 2143074282U,
+        3213081134U, 1583488633U, 1026577298U, 2299844414U, 225076726U, 1425827006U, 2218417293U, 377948008U,
+        118292317U, 1568765122U, 2089033745U, 1552806350U, 3294597966U, 1400559802U, 2288964385U, 2986420595U,
+        4183460537U, 1337323872U, 2990849262U, 876476953U, 2982791453U, 1737522210U, 2534852542U, 2531966107U,
+        1226098153U, 4160162877U, 2632900697U, 1144512467U, 1001393417U, 3611434304U, 4008857030U, 3656347825U,
+        822184606U, 700840191U, 3195178424U, 845839907U, 2880372710U, 1195952477U, 4120965604U, 3142832997U,
+        3891415705U, 871376232U, 3007146688U, 3582317268U, 83995081U, 3322809112U, 4121422225U, 4289063167U,
+        4030603656U, 2499939111U, 3572801922U, 2811385633U, 501536U, 3326829166U, 982797400U, 661737025U,
+        3917676552U, 1951564535U, 1506250409U, 651112929U, 1238890415U, 1766846172U, 3735790235U, 1961392524U,
+        1258624613U, 2249776639U, 3079969881U, 983012682U, 2971335420U, 1305449862U, 1022728748U, 1739784138U,
+        1979660247U, 3132333053U, 1465925571U, 1473996347U, 2143236011U, 753096637U, 2086029028U, 2970048877U,
+        683166622U, 3126439570U, 2457728113U, 681364988U, 3604381136U, 1505666706U, 2710654944U, 1856436102U,
+        577870348U, 1581571240U, 3805860295U, 1541337376U, 663198850U, 3662834591U, 1272268159U, 2895756825U,
+        2286210469U, 2863349871U, 270592274U, 546891713U, 2929769032U, 731510406U, 3418960854U, 2807982115U,
+        3400900800U, 2794686698U, 4071015516U, 820776866U, 3645947828U, 1639927900U, 2477259543U, 4250833486U,
+        2481532642U, 3249311310U, 3146281554U, 703051722U, 4117876376U, 3647223180U, 3954432562U, 1938784745U,
+        1680871366U, 1257787849U, 853870767U, 1988262880U, 1979313824U, 1160101527U, 3436778475U, 3714650720U,
+        2330653549U, 43582114U, 1564273755U, 3087748760U, 1149476029U, 3913644662U, 2248567676U, 2358804363U,
+        1515761343U, 2001198092U, 2966348935U, 2424208280U, 2831913859U, 26277968U, 2329127446U, 1995064007U,
+        1017729359U, 3469222038U, 1994226641U, 3995701401U, 3390874656U, 433367554U, 2200952425U, 2711601939U,
+        2098814347U, 477473003U, 3830118526U, 841068277U, 3546888089U, 223832749U, 953605559U, 162166618U,
+        859816149U, 2176037965U, 3962187149U, 2855879570U, 632408492U, 843639499U, 509536391U, 1068973894U,
+        2833994862U, 157869199U, 58068954U, 55881939U, 4239864593U, 3478375203U, 104854667U, 3327430645U,
+        2238187992U, 2546786376U, 1917698343U, 1382845575U, 2557759253U, 2615524139U, 2023686870U, 3550966053U,
+        531294916U, 3327334251U, 495154388U, 766003842U, 2110728003U, 3410422866U, 1798136465U, 2224637159U,
+        2419659139U, 3189259569U, 4278669804U, 254398837U, 3742274863U, 2140995926U, 4070821689U, 2484723822U,
+        4120000898U, 1615185973U, 1520532819U, 1572492446U, 827316516U, 185335300U, 3521325564U, 404937241U,
+        456637581U, 3965581759U, 2514583931U, 3577281031U, 484464453U, 560958959U, 3668608304U, 3521937143U,
+        255057199U, 2332910980U, 1451243385U, 1699226886U, 3273314672U, 2662990212U, 2906622110U, 141416488U,
+        1886875826U, 367434897U, 3240627785U, 4035506090U, 2158472163U, 3424587263U, 1656666220U, 1953541832U,
+        2933348544U, 1062325826U, 1761838621U, 1650764477U, 307570497U, 2111456037U, 3844115837U, 2906932227U,
+        1855070659U, 577844014U, 1351628790U, 885926805U, 576237670U, 2510572872U, 1349008934U, 2791847887U,
+        1519789559U, 2506594332U, 1595822106U, 1369520377U, 861039505U, 75321286U, 3729339151U, 855186603U,
+        373154155U, 1117284755U, 1178093678U, 2010433419U, 2073838442U, 2006590475U, 4191625843U, 1167679148U,
+        2192233214U, 2370011177U, 1382637545U, 594423904U, 3411956851U, 2318968220U, 240593102U, 1295256012U,
+        3124548362U, 731122584U, 539233776U, 2585382902U, 3060164035U, 4082060658U, 3194833064U, 1947474838U,
+        2079211666U, 42580008U, 4031452423U, 3441808266U, 3012664269U, 2361210020U, 163622649U, 2262640683U,
+        1833451741U, 2101148775U, 1083879832U, 3031189624U, 1500001024U, 1680454241U, 2939653390U, 0U,
+    },
+    {
+        4293469694U, 668563678U, 3296074492U, 3650151137U, 3615038085U, 3590379290U, 4011718688U, 329956327U,
+        1810578225U, 3530148389U, 1389597870U, 1465792548U, 3526002458U, 3471066634U, 802465156U, 3154269916U,
+        290966237U, 3959622902U, 2010566276U, 3337218107U, 2069147638U, 849795563U, 469120564U, 2919772457U,
+        3486090843U, 3781805632U, 900167103U, 2553531797U, 3279632566U, 1161244112U, 1014662555U, 2771579163U,
+        1618675303U, 967448201U, 152406174U, 1056819255U, 90775973U, 2341676778U, 3493606620U, 2629720125U,
+        2152944697U, 466480391U, 1335090907U, 1592490559U, 340271875U, 4214996667U, 1944462857U, 4262838815U,
+        3856611439U, 4032954788U, 617025424U, 4027098958U, 1593474973U, 3115282202U, 308590421U, 1876990364U,
+        429499508U, 2112382162U, 3156048770U, 1757716750U, 1782545925U, 708522460U, 2228081853U, 1487315849U,
+        1735393844U, 3638819454U, 3566500233U, 3813558687U, 365272110U, 3923026226U, 3677015176U, 3535889221U,
+        2182618589U, 434412478U, 1154018439U, 156279245U, 2749178361U, 405266629U, 240194039U, 957027070U,
+        3749277381U, 764245172U, 3579102252U, 1815871777U, 1215379816U, 3216488464U, 497285970U, 953951339U,
+        1680740574U, 101700813U, 1796879175U, 962575031U, 2085679220U, 49021784U, 2254101950U, 2103492730U,
+        3390865099U, 1063262266U, 3532021957U, 3672809847U, 1145195992U, 368078774U, 1129387047U, 3386749871U,
+        3847304613U, 206134231U, 2435806407U, 1683705486U, 2880658290U, 4188373208U, 1441956988U, 1949027510U,
+        1276202160U, 1956372691U, 3735475706U, 3673333760U, 2705046228U, 430544778U, 1851274976U, 1512272557U,
+        366253001U, 2496494697U, 2723905196U, 1459595482U, 1224242949U, 3951459822U, 623553335U, 442095057U,
+        549593025U, 1650013275U, 510816710U, 526522574U, 4229819359U, 3376364532U, 1248146077U, 2207799486U,
+        3667805104U, 3896904101U, 170482233U, 1836644186U, 538977582U, 3015471661U, 1748315906U, 4059779559U,
+        3116726022U, 2148130507U, 3714958506U, 1307724792U, 2899908604U, 2642961326U, 133058759U, 746651722U,
+        3213571192U, 3360177151U, 4120235052U, 2929528622U, 2679918232U, 1103378000U, 3973091270U, 2192983758U,
+        177003986U, 2128307241U, 632003651U, 235387917U, 2144185005U, 2902760781U, 3778280393U, 2827363149U,
+        696285092U, 3322054066U, 547439734U, 3392407143U, 89905768U, 3338412452U, 1986042659U, 1898544880U,
+        208173037U, 2638207233U, 2868336086U, 1414911144U, 2787075281U, 2200157748U, 628897792U, 2301724794U,
+        2075838896U, 1829227505U, 200250666U, 2471408126U, 758160442U, 4015528263U, 3638732587U, 1115167657U,
+        3801504392U, 768216316U, 35220413U, 2310255299U, 2269791050U, 3582039305U, 3981218521U, 3372356937U,
+        2890919533U, 988222762U, 828788147U, 2362345497U, 813529436U, 1703868569U, 3023516945U, 3826824799U,
+        4221828884U, 1956927106U, 2539499780U, 3768208014U, 3200678709U, 3161524703U, 1311831622U, 1519960301U,
+        3803230057U, 426818012U, 3914377689U, 102327692U, 2179698554U, 207261891U, 1498725764U, 846805850U,
+        1758276104U, 2752585886U, 1041790516U, 3134408722U, 1182908079U, 2190904601U, 1197816528U, 1000326250U,
+        2232511313U, 2020804591U, 2018050983U, 1655883866U, 2101434183U, 3129951390U, 2171050675U, 2374334102U,
+        2425564016U, 1611899213U, 2970754171U, 2405576514U, 3029201686U, 3569978285U, 3535522798U, 515728420U,
+        516396978U, 488770405U, 1353863128U, 1473892941U, 338419307U, 1347265567U, 4178577091U, 2401296331U,
+        831557355U, 2823723064U, 1154581487U, 4164839269U, 3071774172U, 1392973182U, 1092980269U, 1343938214U,
+        2705211951U, 2308714775U, 3136227880U, 649309203U, 3090273203U, 3251264759U, 2183871949U, 2355761792U,
+        3005785023U, 466534466U, 798372475U, 735197560U, 289412774U, 301206690U, 594321264U, 2916282243U,
+        2375374380U, 161430508U, 3356022496U, 1455872463U, 2078693307U, 1407623727U, 2898135255U, 3915304892U,
+        1053336317U, 3919023823U, 3696801656U, 577136585U, 2995709622U, 1016486783U, 291126436U, 3031801501U,
+        73886634U, 4258920801U, 144577668U, 823557610U, 2649200441U, 672532564U, 2556204280U, 988263189U,
+        1085911873U, 1769117505U, 2719470446U, 3640692837U, 584316751U, 2307409906U, 356736666U, 3470986687U,
+        999908825U, 3698607428U, 1959435679U, 1272631056U, 2619728056U, 3193373011U, 2556814048U, 4124982969U,
+        2173693571U, 154259345U, 696722444U, 866962278U, 1359405803U, 4227931238U, 3695277187U, 2862556460U,
+        586279746U, 1155906711U, 3480404305U, 4154465890U, 3192907130U, 223872910U, 2303312194U, 1255098511U,
+        334485442U, 3622946125U, 2243687677U, 861810274U, 3539810560U, 1031814639U, 3860724023U, 422390664U,
+        3363424053U, 2781522217U, 2805060698U, 1959527280U, 3537429078U, 3830716568U, 3635049332U, 1285383588U,
+        719989945U, 2740220069U, 287366755U, 1037002886U, 1355767616U, 3967974046U, 2533860372U, 1734388081U,
+        84216572U, 1636252981U, 4011242239U, 2962310762U, 2281533903U, 2698383666U, 4077209350U, 819791833U,
+        2041733032U, 3080455472U, 953208635U, 1592373157U, 213117951U, 3924245997U, 1173636549U, 1768539979U,
+        438682298U, 2404265880U, 2920064979U, 3959741886U, 664436590U, 3838663558U, 155329114U, 405116199U,
+        2011604357U, 3018426152U, 642047790U, 1116421703U, 2167130117U, 379535425U, 3813635568U, 399326271U,
+        2453637021U, 681577174U, 1711941029U, 4092570245U, 722472059U, 2408028395U, 2291975401U, 2716575320U,
+        575910687U, 3642165736U, 277593058U, 570344808U, 3118165704U, 2319785653U, 3430827103U, 4142602072U,
+        1768185871U, 1044721821U, 1720170898U, 4015106759U, 1850722470U, 2169860239U, 1200266743U, 344179523U,
+        4150937687U, 2998999438U, 543062702U, 236550652U, 199247054U, 199445655U, 897578818U, 1706230308U,
+        635797919U, 3835257676U, 2179625136U, 1759306410U, 2753478001U, 686522855U, 3342436168U, 2479985269U,
+        369829125U, 2693680115U, 3517643170U, 693335754U, 2527496630U, 149361177U, 1147265267U, 2852814887U,
+        2363475966U, 2410957155U, 15460730U, 130543559U, 2282980218U, 3770399804U, 1346627340U, 3589398225U,
+        3918409540U, 1638697384U, 4215233483U, 3877112023U, 2898017989U, 599053124U, 340786165U, 1156100956U,
+        857576570U, 3903401559U, 1876084216U, 874760112U, 1522981528U, 639965261U, 1074673956U, 3075597791U,
+        2544976529U, 1852309516U, 2283082813U, 1416166925U, 859758125U, 3163130773U, 890511984U, 1138899380U,
+        3073583691U, 1275006821U, 1565392698U, 600450926U, 1742508547U, 985939855U, 1728985892U, 2298630695U,
+        2752481502U, 3024546871U, 979833659U, 402714717U, 944194799U, 3161839425U, 154437330U, 2634186149U,
+        1583603925U, 2419207586U, 1946338344U, 410930734U, 3916169336U, 3117589434U, 3066247914U, 2026981518U,
+        3072264985U, 82208446U, 1807055473U, 502200964U, 3042658240U, 1150218166U, 1129906958U, 1529636628U,
+        3122371878U, 3115983557U, 1902719454U, 4000465905U, 2944101774U, 2229926615U, 2806245747U, 2118076496U,
+        462327823U, 916160603U, 3851365032U, 2042532894U, 2526326118U, 2548736910U, 2817680089U, 2494978441U,
+        1147644279U, 3139827064U, 2978428360U, 4115244657U, 1686655012U, 1958198791U, 1217772470U, 3314178518U,
+        3652269737U, 1436556917U, 3809712513U, 1234428738U, 420212155U, 1621943818U, 428732479U, 2888344247U,
+        3843546847U, 3603342499U, 1841630230U, 3163120070U, 2568662255U, 1635830586U, 3498167897U, 1219570120U,
+        3607403239U, 3284393102U, 362278202U, 1190362809U, 891223717U, 470839684U, 2869524590U, 751214322U,
+        1383619072U, 1104415495U, 3322690097U, 264840416U, 1884149554U, 3113601348U, 4280719020U, 2393414203U,
+        1662765192U, 644198897U, 3464652117U, 2690037970U, 3236078036U, 2030141762U, 453647601U, 288184473U,
+        2167089838U, 1717310463U, 700777629U, 3656170099U, 879242144U, 684272280U, 2257797583U, 3395439467U,
+        1692587889U, 3698660650U, 3368922112U, 837670241U, 613027928U, 1797455952U, 1028124546U, 2915072825U,
+        700502936U, 1546285145U, 1838857126U, 1251486041U, 410868070U, 2402366756U, 2425731181U, 1242949004U,
+        958505288U, 2177199759U, 3107024970U, 3925162761U, 3231313557U, 2730827450U, 1843861568U, 1561316528U,
+        2505184322U, 2971432854U, 4268684387U, 1776441539U, 644326759U, 2985142947U, 2382204247U, 3811416948U,
+        4121737866U, 612843417U, 2096087345U, 570728547U, 935945719U, 522659462U, 488482927U, 2122165744U,
+        1341261516U, 1079751564U, 2339015312U, 3675404039U, 593111069U, 466067023U, 2531125452U, 0U,
+    },
+    {
+        1175525476U, 1810444303U, 3488858424U, 2992405873U, 1390249190U, 339556625U, 60378788U, 1997538833U,
+        3654306729U, 4264252705U, 2635255764U, 687846522U, 2440544004U, 1748421499U, 1605952941U, 3245044456U,
+        1023256608U, 880911800U, 2948486493U, 876160793U, 3761114289U, 3041788530U, 2201728056U, 3044620351U,
+        3572135276U, 2538374571U, 1318354937U, 593187567U, 1042761770U, 1642574125U, 302604182U, 2738868791U,
+        1957465996U, 389865474U, 2673104950U, 1598730523U, 139917042U, 2245639869U, 3401918633U, 3648831385U,
+        150954611U, 2949755529U, 4203944385U, 2164334266U, 4008870221U, 3872872116U, 1660904888U, 4219468104U,
+        76756872U, 4274840164U, 1210539099U, 4000456168U, 1777465012U, 3290377034U, 1042009492U, 4127387853U,
+        3750041730U, 4193281878U, 907240289U, 4154912826U, 4116290909U, 1861283835U, 1510502610U, 2532732793U,
+        659734858U, 1814261094U, 3310591690U, 180660699U, 3741778906U, 623214582U, 3619437332U, 2299511093U,
+        4289594573U, 2544919321U, 4246819926U, 3809522811U, 3884584216U, 3521864657U, 1127071471U, 159881267U,
+        343435833U, 3933090558U, 2622771367U, 3067177284U, 11035266U, 1128672443U, 1533160825U, 1816488583U,
+        1941455144U, 1862845998U, 2446466916U, 1724299831U, 456467770U, 2696597185U, 3276351351U, 3204125148U,
+        3144411260U, 2162352888U, 1988712747U, 626187637U, 202457371U, 2868283621U, 3890407057U, 1378828195U,
+        2655913465U, 1144189025U, 900225447U, 409825486U, 770796633U, 2806955174U, 591983007U, 2840250913U,
+        2677776025U, 2090227895U, 179892489U, 3899926040U, 2007894939U, 3619736285U, 3906774608U, 622199277U,
+        1634334742U, 1787459362U, 874523510U, 1712743474U, 2993908347U, 1572143242U, 695451358U, 1232808937U,
+        2498158946U, 2838992238U, 3108494517U, 3679106894U, 4012146170U, 1352929516U, 1089525321U, 4049712002U,
+        3982677140U, 657286003U, 3527536860U, 3435714469U, 1577094237U, 2229164364U, 4218115283U, 277601955U,
+        2247743774U, 973566031U, 1587480495U, 3126459835U, 1307556836U, 3305157320U, 661036006U, 874943670U,
+        3039001383U, 1871686725U, 649616392U, 629801637U, 957066049U, 1222346408U, 677344963U, 1638859389U,
+        3001628440U, 3422275730U, 3831150990U, 3865068563U, 3345087803U, 1744079918U, 1420479243U, 2972898814U,
+        979471324U, 260253251U, 1622797547U, 3309875759U, 3725291825U, 3865081149U, 1970461481U, 2938820062U,
+        265220221U, 260308197U, 3301948517U, 3063966691U, 2997710631U, 1699816405U, 2830854476U, 1435390774U,
+        1932182377U, 2698921904U, 2803834295U, 298861851U, 2730305715U, 1193176753U, 2955295444U, 469594247U,
+        1604715570U, 1770080677U, 433097992U, 312988914U, 4101365659U, 3225736237U, 2805845506U, 4208843036U,
+        918699700U, 3613077043U, 2196990056U, 1268453616U, 2815585684U, 2667647419U, 2295019642U, 2548718262U,
+        1981555569U, 3384315029U, 3503485929U, 3626008859U, 130991751U, 4277203456U, 3181018215U, 3445066203U,
+        3641038665U, 1144422747U, 2926649835U, 2929606150U, 3808974889U, 2142846359U, 2403977189U, 1950996081U,
+        2152389933U, 26309362U, 2365811470U, 3934609347U, 1372870047U, 1589897560U, 458254051U, 677713423U,
+        1804347404U, 4037181225U, 471604574U, 544123087U, 1764951137U, 1022183077U, 2821074452U, 4088109457U,
+        3087816118U, 3728995757U, 2815710434U, 1967438660U, 3608246772U, 1895818545U, 284271057U, 2022581344U,
+        2999487791U, 2431901326U, 542072086U, 2336485579U, 868475548U, 3709538582U, 1058224731U, 1698560484U,
+        486275129U, 1164605517U, 982523768U, 1385592773U, 2476135602U, 1914833809U, 198834782U, 2970364315U,
+        313088086U, 2500095677U, 2831510849U, 201544471U, 174175192U, 956693243U, 3133465156U, 2634999149U,
+        2324533089U, 1511081505U, 598890280U, 127428428U, 2549309681U, 105750658U, 1292248215U, 1824570299U,
+        2759060139U, 82554387U, 2741926899U, 2455978408U, 1448948487U, 2343332751U, 251091447U, 129598413U,
+        244308385U, 3226578822U, 740529495U, 1513474290U, 625115011U, 26872632U, 905845678U, 2968399914U,
+        2837804028U, 2662322125U, 3837288695U, 4176162193U, 1391284845U, 3975330624U, 4120080824U, 2637983794U,
+        2535323088U, 3267864465U, 3914181150U, 1348292967U, 3264195149U, 29100665U, 1427420493U, 3241566350U,
+        4031284145U, 2325254871U, 1952080422U, 30409206U, 2967963272U, 2481898360U, 3601916018U, 1158717113U,
+        586900516U, 970109485U, 1667621077U, 1497924246U, 1736627997U, 195583293U, 2106970925U, 1489604661U,
+        3963746265U, 4211265879U, 1676452101U, 548920612U, 4070437285U, 3446824487U, 2828115433U, 1088095000U,
+        3389296689U, 2756008827U, 4276810274U, 1740851763U, 3009169799U, 284986893U, 1714896317U, 352867265U,
+        4285420121U, 2942895181U, 916469872U, 98391798U, 2574407943U, 2608873547U, 3341386772U, 3483685775U,
+        3817082209U, 815579301U, 3109579902U, 2033744338U, 820028163U, 1678420777U, 590990382U, 340079484U,
+        2672844558U, 2603410972U, 3081231755U, 1812769388U, 1603058243U, 458777788U, 2530967487U, 2151880122U,
+        3731935176U, 2480950058U, 3478847640U, 528437544U, 2445841156U, 4290207026U, 3005652777U, 2756437684U,
+        851597276U, 910708061U, 143534402U, 801917247U, 2028859564U, 1577388077U, 2349790413U, 415364474U,
+        2705542364U, 2694727341U, 1310121845U, 3214984179U, 1013089161U, 4141261897U, 3457612539U, 29263867U,
+        2118263967U, 1384121296U, 813374115U, 3683174091U, 1199833770U, 1340749519U, 299680786U, 1561036943U,
+        4126593641U, 3760828820U, 2338010671U, 1882864897U, 1594614284U, 2737893143U, 1320313707U, 3545317855U,
+        637544502U, 1467711677U, 3091718559U, 1522190670U, 2576454924U, 3203603436U, 571908085U, 1647631468U,
+        2471468634U, 2996388373U, 1259719159U, 2363766282U, 50917661U, 2256520686U, 463929357U, 2220359054U,
+        1430354006U, 1925860289U, 1384493793U, 2608890842U, 368958703U, 204000317U, 2011054296U, 1324973712U,
+        637906668U, 2097436975U, 2613537014U, 4154013102U, 1460519160U, 1395790688U, 3070520865U, 1169460429U,
+        3115504445U, 3754896678U, 174807635U, 518924428U, 3763578826U, 1756089485U, 4144974665U, 1793753139U,
+        1170149364U, 1846692070U, 1197654136U, 3734945669U, 2386463570U, 3645368767U, 919348990U, 2852186154U,
+        3668407591U, 3275127667U, 1266107162U, 2231102322U, 3410374771U, 2395990964U, 1649633582U, 2544307101U,
+        3528060842U, 3527965911U, 2473339476U, 2727534661U, 2067736586U, 4248179070U, 1079438085U, 937805603U,
+        682829183U, 227003797U, 2471935548U, 3137854187U, 3696069679U, 402581910U, 1193780850U, 4117871210U,
+        353984482U, 2651485447U, 162424781U, 777956500U, 654794893U, 3794190784U, 20972405U, 18165668U,
+        298713104U, 3727611126U, 1846986290U, 3398730036U, 2414808101U, 3994533234U, 832566961U, 3449564819U,
+        2377673898U, 1639946533U, 115630395U, 1811146746U, 3123165529U, 1599260155U, 2424694080U, 1535960575U,
+        3932821059U, 585055130U, 544751025U, 1302809141U, 3942066353U, 307453298U, 480208033U, 3712231307U,
+        1242389854U, 1076219044U, 3704700288U, 875633234U, 266142377U, 784509345U, 516661757U, 2700062829U,
+        1453079735U, 2306664409U, 2179687691U, 2281886494U, 3655878114U, 3625171425U, 2433207369U, 2265983546U,
+        2981836207U, 166989325U, 3980739100U, 3011872393U, 3361433191U, 1328334510U, 1978319885U, 2074121744U,
+        189700989U, 1734939648U, 945552478U, 3268169582U, 468589132U, 1553176255U, 3547878709U, 4203824092U,
+        4179907489U, 2098452143U, 3405487911U, 352480963U, 444338993U, 1756997622U, 3884469828U, 249415116U,
+        1380769319U, 1486078610U, 3426508207U, 2952342519U, 2336777256U, 1669660248U, 66647267U, 4149467087U,
+        2154552047U, 2406125378U, 1283127777U, 2382555060U, 3510460866U, 1079903894U, 1792271298U, 1405446211U,
+        1580124655U, 2883496544U, 260797368U, 2287285536U, 2387426583U, 287177374U, 2900659954U, 969252470U,
+        4100158056U, 228219449U, 2600539621U, 758136397U, 456291249U, 687641968U, 909633047U, 3925043763U,
+        2154179812U, 2850742654U, 813339805U, 3219827611U, 2741953929U, 433973735U, 2299702456U, 2506775075U,
+        980761958U, 2781732076U, 456881438U, 3921036514U, 1892986823U, 930427304U, 4227229796U, 1586960042U,
+        2416126918U, 4208054024U, 1572390329U, 4263451072U, 739761026U, 1657986589U, 1693207197U, 3266658381U,
+        1840697738U, 2520292748U, 2926830250U, 3706440721U, 2483481274U, 1309483169U, 2635988543U, 2706808098U,
+        1915554772U, 4038587259U, 905593943U, 719452232U, 1836397268U, 1795988787U, 1338873002U, 1U,
+    },
+    {
+        4165148272U, 3959324584U, 2327226271U, 1211139900U, 56665464U, 2702700831U, 1581666058U, 342103445U,
+        3661184696U, 3022531594U, 3452632238U, 815238269U, 2311550878U, 3937667237U, 2276679811U, 3046218846U,
+        3152253938U, 2771142464U, 3548756515U, 3214326730U, 360442824U, 962095899U, 2958483181U, 3725166636U,
+        1176824608U, 2417163938U, 1674891189U, 2159605105U, 1140096945U, 3831317153U, 2432346537U, 2234309448U,
+        1871932241U, 2839823155U, 112884030U, 549043314U, 1338574378U, 2436862830U, 404377633U, 3063394886U,
+        834895205U, 3008308972U, 3171000314U, 3946606633U, 3683214947U, 3867651765U, 727259218U, 165277413U,
+        4221449171U, 3895094971U, 3117701547U, 2073815057U, 2852593685U, 3776491842U, 4156341459U, 4237533733U,
+        2981614630U, 476578181U, 3344150379U, 3602398432U, 3155978494U, 3879866532U, 594425354U, 2520923146U,
+        3692693192U, 1779717093U, 2170754602U, 649984780U, 2287987407U, 3922391543U, 4056707862U, 1512063010U,
+        282697390U, 377173651U, 259558407U, 2270088028U, 742955094U, 2794505086U, 3286994026U, 2820852329U,
+        1855359115U, 308344184U, 1230142566U, 3736075803U, 2892220656U, 103390103U, 750964062U, 3224362779U,
+        1319589029U, 1540963510U, 2768325521U, 1169131249U, 1665299355U, 3968459962U, 1904614652U, 2050934563U,
+        1519978932U, 3013573336U, 2833229394U, 1185644033U, 1680515201U, 60501175U, 62415516U, 2193673696U,
+        751664612U, 1284944965U, 2047495992U, 1314822836U, 2945683479U, 3263696804U, 3347395214U, 1965474480U,
+        2600331499U, 775894947U, 1464747591U, 4168347021U, 3300661431U, 2815116795U, 2562778729U, 3024089043U,
+        2163029067U, 1779047823U, 2226961477U, 3291996526U, 2589278254U, 1208913551U, 438435870U, 1689250335U,
+        2480461591U, 473863233U, 2401764707U, 2619842634U, 1190576713U, 2680751356U, 1414427281U, 1999787148U,
+        2178163526U, 4053536957U, 3225166366U, 1620925793U, 3954790803U, 3287897324U, 3228591353U, 3181099516U,
+        4109087070U, 2441857533U, 3680595155U, 157616772U, 2502454733U, 1837142101U, 4144411740U, 3996341093U,
+        3788068376U, 2804959838U, 3813315428U, 2685503896U, 3286715932U, 1139011318U, 986465728U, 971402898U,
+        730457285U, 1388712728U, 3328307655U, 3503633932U, 914938754U, 611842852U, 3433835495U, 2528335134U,
+        3825093769U, 1218520982U, 1579899242U, 865961872U, 2553319278U, 1561809725U, 80487074U, 3099962591U,
+        931826252U, 3066219299U, 2059099744U, 259032728U, 3565355113U, 2210449184U, 2233113313U, 3899179761U,
+        2601934766U, 647502845U, 827285450U, 671240573U, 1184634397U, 2980101353U, 113219135U, 578972907U,
+        354577115U, 3949608012U, 3661574416U, 479408449U, 1153591090U, 727059138U, 4292161207U, 1706420135U,
+        4250269251U, 1799348155U, 2251546983U, 1559628457U, 340006494U, 3481351017U, 4124227602U, 2063356796U,
+        748171805U, 2605477081U, 1571513325U, 3301796651U, 2484973107U, 1759690087U, 3236908029U, 688975919U,
+        4129537807U, 451443979U, 960498472U, 2577189865U, 2455914346U, 2546518362U, 387291371U, 4188833185U,
+        1104101717U, 2837704393U, 1361419591U, 4278524522U, 375772867U, 2176422411U, 1947652500U, 1311542151U,
+        1325003706U, 4127109436U, 4134862631U, 1270446859U, 3879026487U, 2100729287U, 539559445U, 2409213355U,
+        3734565550U, 1980134010U, 2624128038U, 1826803221U, 3719438397U, 2118260344U, 672324394U, 4231910166U,
+        3295703865U, 1458866767U, 2576027864U, 1055915782U, 208378359U, 1725187101U, 3720121323U, 518036718U,
+        180894282U, 97483569U, 3255494672U, 3474078833U, 1279323223U, 2401400642U, 449488365U, 2363857681U,
+        1912409678U, 2143630859U, 1801020419U, 1462068652U, 1234491731U, 496607058U, 2660870246U, 1508498490U,
+        868034737U, 1984761995U, 2655213270U, 3628288381U, 1385494820U, 55858452U, 1104964244U, 3346440782U,
+        3577511962U, 317597972U, 1717189256U, 3724668115U, 3132935165U, 4203013739U, 713481359U, 2054344878U,
+        601575665U, 2650126490U, 1777356085U, 2461172825U, 2961399866U, 3319566798U, 144384693U, 2084003494U,
+        3059819772U, 1349782872U, 3322722856U, 334880172U, 974347526U, 2224106907U, 2336302087U, 1677682422U,
+        2267003265U, 1017588685U, 1818395770U, 742536839U, 2216081013U, 57111033U, 1477664417U, 2372860757U,
+        1394519623U, 209027789U, 3503232265U, 1982025129U, 1142592547U, 3228062081U, 2744969000U, 442207403U,
+        931495328U, 4136890325U, 2272506130U, 1861968376U, 1773149549U, 4289707071U, 655169221U, 2242849853U,
+        1722886073U, 338761380U, 900465154U, 2489084549U, 3549245125U, 2096601810U, 4245757167U, 639505573U,
+        450382122U, 1532952011U, 961163112U, 172113360U, 3625537424U, 3701479636U, 3554988608U, 115800679U,
+        3718814397U, 3676721508U, 1947278863U, 3557553879U, 2719540166U, 1640852209U, 3696198519U, 491308575U,
+        1886768505U, 1706109125U, 685742611U, 1402757617U, 3148058516U, 812948667U, 614924249U, 1114702200U,
+        4197815197U, 2386037278U, 2760242697U, 3524508613U, 604645059U, 2482025740U, 2162858758U, 2937958072U,
+        3792311879U, 2559009722U, 3704627533U, 238799U, 3511745914U, 1021570903U, 1574312059U, 1372889339U,
+        860196035U, 3698484877U, 1226226258U, 1278158700U, 3196659004U, 25701642U, 10089626U, 1196204538U,
+        1596970845U, 547733523U, 2526184814U, 2541497487U, 1889162941U, 1433928195U, 2542664341U, 449999008U,
+        4131318036U, 1114807725U, 4076100257U, 729148734U, 3307799231U, 811639743U, 4107744390U, 4014116176U,
+        2323616662U, 2108136981U, 416011005U, 2238500369U, 3915875530U, 605367518U, 1419154534U, 2150637071U,
+        2862977532U, 2405225028U, 2685327039U, 3086374193U, 2433354781U, 960985775U, 3288962701U, 34276580U,
+        4260234049U, 1672891273U, 2692796519U, 1128128181U, 3983208049U, 3803061672U, 4064774401U, 2384455721U,
+        2756473080U, 141817175U, 2796015417U, 86543727U, 1416340041U, 1814194873U, 2177831296U, 1821412716U,
+        1323364380U, 3892997491U, 2286745555U, 2345642436U, 2994061109U, 2574692658U, 2310028834U, 1170634576U,
+        1063792661U, 1827007044U, 2608088555U, 2459280755U, 4146971881U, 1275131052U, 3542327501U, 1260617929U,
+        657005030U, 4022619609U, 1202753029U, 237577369U, 1188041398U, 554587214U, 2869071787U, 129097878U,
+        2153412502U, 1441874014U, 2162116983U, 494770887U, 932571500U, 2470221686U, 2723702164U, 3449074643U,
+        3251172628U, 3827993293U, 2759431560U, 2351956375U, 3959910012U, 2492009983U, 2822421406U, 4070348127U,
+        2904414556U, 1359017623U, 3285384877U, 3154557502U, 3069735357U, 3945855295U, 1297444204U, 2847508802U,
+        956009714U, 4281960352U, 155521056U, 275221667U, 2967655681U, 3328306778U, 3033131735U, 1699437747U,
+        1555727184U, 2092334532U, 922993371U, 244980802U, 4169262838U, 1987714072U, 46263104U, 1993846516U,
+        191972346U, 2091131749U, 3016423480U, 2896597415U, 1977174776U, 1316374571U, 3595046095U, 3409079020U,
+        790874075U, 2170760213U, 2179814151U, 1733030119U, 597981608U, 262655713U, 3503879784U, 1944338749U,
+        3325894508U, 852143802U, 2704328868U, 3908854901U, 2470441266U, 424123000U, 2971451826U, 2067520146U,
+        769847154U, 2783023127U, 2268483362U, 1566718106U, 49966108U, 1194931231U, 106453222U, 4294870478U,
+        1528619518U, 1414076918U, 1992840609U, 2620808875U, 2547387624U, 3158941485U, 2257563957U, 1739242420U,
+        2986690090U, 3409860791U, 3429837288U, 427860263U, 1683617719U, 2015389484U, 1662055103U, 733347764U,
+        119777991U, 137915448U, 328463238U, 151910319U, 3324532326U, 132066926U, 3733389111U, 2033847580U,
+        945453980U, 369646857U, 3490221787U, 2410070051U, 714517608U, 2235630256U, 3765446407U, 4034055781U,
+        3798937931U, 840341162U, 545183289U, 1724948297U, 1397962214U, 80792687U, 472365310U, 1045271669U,
+        4047394706U, 3353775519U, 1418824163U, 697117083U, 4016141348U, 1353713421U, 2638692508U, 3859123057U,
+        839117852U, 2228465670U, 2861869568U, 1268386566U, 771948902U, 3066548419U, 1041561796U, 941557725U,
+        1182176672U, 1491229960U, 499480648U, 2364257885U, 794515464U, 1939169779U, 3841604368U, 2432732126U,
+        654388340U, 3261277457U, 2300427210U, 858028356U, 3802560712U, 4266893679U, 376302124U, 2849527568U,
+        3176975050U, 1860620062U, 1412477404U, 2152460246U, 779615322U, 3370720268U, 3025575544U, 2729568750U,
+        1992766234U, 3464354950U, 1901380001U, 2652529131U, 2445506895U, 3610555915U, 2818717238U, 288917778U,
+        1944989563U, 1124287382U, 199380641U, 4234088361U, 2331630351U, 294960581U, 3847199157U, 1U,
+    },
+    {
+        3280628790U, 1551098606U, 2603896698U, 1640342470U, 3425686340U, 3253937010U, 3666145661U, 1055093736U,
+        472405773U, 40393468U, 4058399406U, 535025686U, 4152501762U, 2161474868U, 3396453204U, 2960426471U,
+        1441281542U, 3127988113U, 3791313261U, 2754577097U, 3868216395U, 2511733852U, 3160247631U, 67145087U,
+        650184539U, 4225448644U, 672642382U, 1903212031U, 2448203255U, 2292564476U, 2024248151U, 2065925900U,
+        2088191230U, 3020356201U, 3258745796U, 3851437678U, 4267786635U, 1940965693U, 2440553419U, 2835262544U,
+        759298907U, 704470778U, 3292276347U, 2845067863U, 3260569311U, 2425745196U, 16559199U, 72897622U,
+        51532794U, 3207668190U, 748476570U, 1644895613U, 3954905803U, 1690159515U, 1121381012U, 3003952099U,
+        4250537838U, 1138564200U, 2053263801U, 803533157U, 1802210436U, 3520501089U, 1648323345U, 3099033293U,
+        4208236471U, 3735870148U, 3120648151U, 4182335270U, 4273377658U, 3308982496U, 3995483503U, 1162756827U,
+        3274615651U, 3073263323U, 3480611580U, 2126050605U, 2055082851U, 3885684450U, 1650902055U, 2272497033U,
+        954666861U, 972846177U, 3321827353U, 641366333U, 3515782548U, 4050236526U, 72716828U, 3663228340U,
+        2349121639U, 3213851065U, 470652087U, 3600189149U, 2979552799U, 145093375U, 4277498815U, 1370825679U,
+        2841211071U, 1575408204U, 181781673U, 3807194148U, 3622564518U, 2580988341U, 907268525U, 1219773440U,
+        2163657231U, 575008465U, 3365698403U, 4229820269U, 871638923U, 2209537819U, 2852510233U, 1668606054U,
+        316807547U, 3951999565U, 2933151701U, 2393050029U, 892688784U, 12251637U, 2371528548U, 642780233U,
+        677065645U, 373619022U, 2562654449U, 2613889099U, 3703415281U, 1342947400U, 517980240U, 1618050536U,
+        3270075043U, 3303482558U, 2512441252U, 2389767786U, 3534114654U, 3959263840U, 2271078532U, 591804339U,
+        3667184362U, 3288195574U, 1466870730U, 1532130075U, 1685657161U, 3068205558U, 900204065U, 3797738441U,
+        106796262U, 2837197351U, 218776718U, 2970843033U, 263057600U, 1058829910U, 383780537U, 3811955778U,
+        744447340U, 4121174347U, 2077329750U, 753891983U, 3302009499U, 794887134U, 2198300555U, 119621655U,
+        86388651U, 1987512105U, 4055333515U, 4132410893U, 2291091141U, 1967851992U, 3593573443U, 2977749720U,
+        1296818407U, 1356694366U, 3200310086U, 4285475970U, 692643511U, 3082499546U, 579786760U, 3134148153U,
+        201787916U, 1418313718U, 247216862U, 3214093748U, 3144514804U, 2750086049U, 722899310U, 699933268U,
+        675356352U, 4216882873U, 343620684U, 1170718329U, 1241530614U, 2066584384U, 3540627528U, 4065840048U,
+        3827350770U, 2488417121U, 916199455U, 3509900376U, 3583856062U, 2931865083U, 1495359585U, 1692712138U,
+        2831009581U, 3726999728U, 3101742721U, 1429310940U, 3792902758U, 1103541338U, 1069683499U, 1603570324U,
+        3206065787U, 3148445268U, 3531821502U, 1472281773U, 840408906U, 514657972U, 1446765043U, 1846197138U,
+        722775924U, 3011863484U, 2815970732U, 1146522644U, 820828012U, 2113616852U, 1670149379U, 591321236U,
+        2172756055U, 2187078184U, 3740539393U, 2462225409U, 607628781U, 1488395365U, 1981566589U, 1456595318U,
+        3536122160U, 2575632187U, 330064135U, 999307215U, 1590714123U, 74975626U, 257476925U, 1944266062U,
+        2035770695U, 3699890788U, 1972297305U, 63929551U, 1530566870U, 2515163899U, 3909117248U, 1966148225U,
+        728832392U, 3000134995U, 3429155695U, 2652751901U, 2304207898U, 4069125833U, 1702384567U, 872391000U,
+        467445852U, 2762639243U, 775031812U, 484545200U, 2481174417U, 2500612386U, 1415390131U, 2905080331U,
+        1449800124U, 480633435U, 1244139639U, 234509394U, 2245680677U, 731475366U, 1756607105U, 2664445896U,
+        1475003513U, 3045234548U, 2457302414U, 3333712040U, 3572904727U, 1192628540U, 4250536513U, 2865387414U,
+        2441714556U, 882555697U, 1789576240U, 540846808U, 2964424553U, 1349922813U, 3385424764U, 1574558077U,
+        385511359U, 2067524285U, 3299311888U, 2594951740U, 3381313653U, 3780217072U, 2434210398U, 103488367U,
+        2749136825U, 36000394U, 4265514633U, 935479195U, 218582770U, 1598717736U, 1441167970U, 2400444367U,
+        1719623945U, 68114108U, 553152160U, 336178480U, 3812000625U, 3251936209U, 3347863859U, 3430893626U,
+        488171321U, 207171123U, 2305367340U, 1183087154U, 3735183758U, 3559548647U, 745075594U, 1821094055U,
+        175178232U, 3688363939U, 2686630850U, 3362557379U, 101589310U, 2165045566U, 936329772U, 1444723180U,
+        2096257599U, 1172205068U, 1041732581U, 3821623600U, 2587551922U, 1848522486U, 1993465584U, 1171679255U,
+        575003308U, 1733318083U, 3825148364U, 163677940U, 4291941982U, 3511523073U, 3705838383U, 4252373873U,
+        2198362049U, 1438444801U, 3599366009U, 1881947562U, 3216515173U, 415667079U, 3089133227U, 1421869755U,
+        1275875876U, 4117788809U, 120773564U, 703835598U, 2210478373U, 2248298337U, 3448151402U, 1996488833U,
+        854005678U, 2091857147U, 2962487838U, 3476767164U, 840810143U, 1864963562U, 3813198201U, 417238264U,
+        355332322U, 2377414300U, 3686032748U, 1505232258U, 2295022515U, 3428267479U, 361449700U, 2985681301U,
+        2719435731U, 1853609644U, 1284503315U, 1490055659U, 1089970694U, 2614134027U, 816618756U, 3660199130U,
+        1967528121U, 1644137530U, 4219392065U, 56859736U, 1396276147U, 970445695U, 1413097204U, 3710088422U,
+        1365845818U, 2126050300U, 3802836220U, 180889732U, 3325482249U, 1595564197U, 2607039072U, 1691673082U,
+        2912412410U, 4281202258U, 1360157235U, 4187869065U, 2470519129U, 2981189056U, 3985075990U, 240893937U,
+        697164092U, 60222225U, 316105103U, 2064634063U, 1686875456U, 1770268154U, 771802348U, 1615081502U,
+        1027893522U, 829406040U, 2870281557U, 1948579954U, 3029662128U, 2511307063U, 3348043148U, 1929355047U,
+        509301282U, 116990490U, 1874572181U, 335223792U, 2046702356U, 3098148104U, 607333618U, 1206056508U,
+        1451830088U, 3526250842U, 1372795521U, 687123482U, 3849715225U, 1035328865U, 3231167206U, 3511477198U,
+        521799274U, 1472546179U, 1289883979U, 74145933U, 2312968210U, 2033821133U, 3850633053U, 2973963118U,
+        1251538804U, 2583215117U, 1661901491U, 1709282004U, 2662275675U, 2169126499U, 2930202549U, 1290259299U,
+        424899552U, 1329063412U, 727424808U, 2462014625U, 910249877U, 1906994364U, 846206818U, 1594322257U,
+        59029794U, 141576670U, 4179791063U, 453226700U, 337588638U, 2809519539U, 3972772817U, 2442184719U,
+        600226859U, 3175035247U, 324601146U, 877387062U, 3914874810U, 3185190797U, 1308490888U, 688606583U,
+        1777554375U, 379469466U, 509755750U, 2353954155U, 2337538372U, 1404543675U, 1921673861U, 101249812U,
+        132247337U, 570487323U, 1017494844U, 3237626542U, 1283673460U, 4164302003U, 3820392688U, 4209356585U,
+        280687655U, 454525910U, 2459812018U, 3683997948U, 709589820U, 308388950U, 3400370988U, 789590772U,
+        704855380U, 3272630077U, 2253470984U, 1349867750U, 2180717905U, 1221321823U, 114176432U, 2546025875U,
+        3701356590U, 1566127786U, 1698274571U, 1516016280U, 2375540809U, 1125875331U, 3175902128U, 4256784580U,
+        3991250237U, 1560704586U, 1296896184U, 2417162065U, 3456083852U, 3623309261U, 4271771573U, 100898975U,
+        2964751281U, 3379583387U, 2655068695U, 3157989803U, 2181484102U, 2603143405U, 679827745U, 4270572390U,
+        548458982U, 174658023U, 3649538173U, 3560937445U, 952605152U, 1741248419U, 3380747020U, 621644190U,
+        2990375284U, 3543383962U, 563221038U, 2531344680U, 1209246460U, 2703202714U, 3820395428U, 3544916941U,
+        904603027U, 2871402827U, 2449976151U, 1372461591U, 2303203657U, 1322508376U, 98475731U, 4157691546U,
+        1997058635U, 1289118855U, 3226326352U, 1970597539U, 4098200402U, 22911410U, 3964357645U, 3465005445U,
+        3463316254U, 2279944535U, 1612733270U, 3827640566U, 589392970U, 2665132181U, 2085569645U, 1350089145U,
+        1821083630U, 1256429931U, 3021064092U, 2050963929U, 578415109U, 4199012415U, 2828628516U, 763354309U,
+        4138993397U, 1492528181U, 1700727791U, 2566123892U, 1896411621U, 3329465406U, 1296050084U, 2694317588U,
+        1997167570U, 3987554924U, 3185076745U, 1796018142U, 85887295U, 3300563272U, 648051454U, 3831910437U,
+        3286643615U, 2227757655U, 734989733U, 4116081956U, 185946336U, 150265009U, 2431660946U, 3555108492U,
+        3316718249U, 3588111587U, 1492677908U, 2898651403U, 1747113462U, 2066408999U, 2122367421U, 2581830463U,
+        2553040107U, 2241877553U, 4078307712U, 540238496U, 1844750686U, 4273502089U, 1035331731U, 0U,
+    },
+    {
+        416958780U, 1422409160U, 1452174984U, 3629108298U, 3016361413U, 2624698362U, 2995844879U, 3090494126U,
+        1770231398U, 2731034078U, 2105364665U, 1681319701U, 2914519048U, 900456069U, 1027734174U, 3452785729U,
+        2339015431U, 3148363019U, 1132559606U, 985191810U, 1451423290U, 4096708033U, 701748032U, 3165131995U,
+        3610361776U, 2247970973U, 1934363839U, 3466487443U, 3007584574U, 1954074384U, 2425540517U, 1495586898U,
+        4048887821U, 1275549725U, 2055640024U, 1696266079U, 827831922U, 3784397320U, 3562136646U, 2189596062U,
+        1819367092U, 2897219328U, 3290954176U, 390265189U, 783499177U, 4190864892U, 3219528094U, 3844198342U,
+        3570890330U, 2800078588U, 3229666353U, 497245013U, 681610813U, 3372827964U, 2469941927U, 1354002441U,
+        2258995181U, 4101781110U, 3498663369U, 3023216251U, 82994835U, 3834336113U, 2741837216U, 3109076644U,
+        332544550U, 1867717957U, 255040833U, 2807624740U, 90121862U, 85540149U, 3641337801U, 1875957787U,
+        1931155431U, 1698731169U, 2409569577U, 1836552898U, 3246564283U, 2128741150U, 3048419532U, 3719219032U,
+        1242639192U, 2779544299U, 2401314412U, 3590288632U, 4285988877U, 4070558929U, 2744896319U, 1624378959U,
+        2604680260U, 1152589420U, 1217489701U, 434661631U, 4265558299U, 304100618U, 1269157127U, 3961043141U,
+        3166915288U, 1263058385U, 834844045U, 1650264498U, 177468438U, 588909432U, 1949535516U, 3651169326U,
+        2532816348U, 3663463767U, 2908840310U, 2145481854U, 1560803982U, 1077836369U, 1284537700U, 2470653995U,
+        3911968698U, 2110118700U, 1778359666U, 800670841U, 3299218025U, 653484739U, 511215745U, 3348284967U,
+        227735927U, 1290133728U, 998733959U, 3522715649U, 853589843U, 1200153427U, 3166677536U, 922980737U,
+        182052954U, 4076113876U, 2202158285U, 484151628U, 3931848879U, 360651122U, 1618783351U, 2632095160U,
+        4228546434U, 2758960181U, 2389498778U, 4022277010U, 1446521826U, 2251914093U, 1980226276U, 1019930502U,
+        2605764555U, 244655208U, 2990271765U, 1887081259U, 2039442387U, 1729701942U, 2827106346U, 2470500622U,
+        970771756U, 847677185U, 1395692071U, 2880008945U, 3072993947U, 4154797639U, 893768710U, 4048680446U,
+        1807214167U, 3517411085U, 3563773863U, 3700378722U, 1481317642U, 3867754564U, 3894905236U, 2719144377U,
+        1964408024U, 2083480723U, 1340954760U, 2899343819U, 3648851839U, 714137989U, 238944815U, 146858762U,
+        210715866U, 3176134670U, 1862337555U, 3798033588U, 684549227U, 1706888776U, 774921241U, 1215835547U,
+        4112302692U, 722901079U, 2979098618U, 96030620U, 867497159U, 3466740965U, 3216538574U, 3264780063U,
+        963102001U, 2627546641U, 261203898U, 3120306045U, 2589218432U, 3911269605U, 98005425U, 1137210018U,
+        2055246249U, 1629378724U, 2050837092U, 3236172850U, 2636501638U, 4283464780U, 87581008U, 4243468083U,
+        1757211284U, 402971219U, 1256352953U, 2561886538U, 2037869017U, 2924121330U, 40913612U, 1201164421U,
+        4061135079U, 2134269759U, 943303548U, 1433502933U, 1079954685U, 747652507U, 3672726791U, 449795591U,
+        3282284101U, 1090919757U, 1336267344U, 283379370U, 2592022042U, 2099611360U, 602264411U, 3949325430U,
+        374987231U, 178417657U, 2257181407U, 2852821999U, 2509508430U, 558430969U, 528837501U, 3601563201U,
+        236735246U, 1431954542U, 25953841U, 1082323963U, 1713546182U, 472663958U, 4242013649U, 672364024U,
+        3981598507U, 1007784875U, 2123527645U, 544801482U, 578705352U, 3256610725U, 2539864510U, 1283459127U,
+        4241614995U, 231553337U, 984458473U, 3896923193U, 2391844700U, 3496153225U, 1585706252U, 1524607291U,
+        1804158662U, 303374335U, 3679148678U, 3895898804U, 2846436982U, 895051106U, 2403755000U, 2955624770U,
+        1020911865U, 3909349758U, 345906552U, 3758153194U, 1913757031U, 812484749U, 3735443444U, 2713315041U,
+        4029274835U, 3117001202U, 877497720U, 2776870776U, 2026984724U, 1603979168U, 172818623U, 1467708707U,
+        749157289U, 3917009146U, 1564015981U, 2474154062U, 298294643U, 3011194980U, 644650956U, 985782383U,
+        2194423162U, 1847472583U, 3965912651U, 2551326110U, 1168908886U, 119259119U, 3007913582U, 936650801U,
+        3893920550U, 4183045315U, 3331897942U, 2204621100U, 2503114616U, 439723742U, 1220365363U, 2448727552U,
+        169619002U, 1575843904U, 518954425U, 934797244U, 2977133267U, 340006877U, 172414842U, 1766719995U,
+        3316250971U, 3184181646U, 1065327998U, 2494336494U, 1494717664U, 1453198910U, 2851530727U, 3087758534U,
+        1831238399U, 598610789U, 4033883818U, 3057018353U, 3194558795U, 1591198420U, 729973450U, 2741507856U,
+        1404831095U, 560839312U, 3697707193U, 754622286U, 2695205063U, 90571693U, 847214022U, 4231507370U,
+        1199588940U, 3276350650U, 3489509690U, 103229107U, 2083146391U, 2687113390U, 30602735U, 665893385U,
+        1324283797U, 4277111901U, 3658404143U, 3305149932U, 1328044441U, 470062616U, 1074210911U, 1288509132U,
+        1287490336U, 3251231339U, 2193017039U, 2610102517U, 2952715334U, 3944116104U, 3346588669U, 2638728355U,
+        2189598330U, 3282826511U, 1451329652U, 2480524628U, 2604478781U, 2043212957U, 2239931217U, 3969357540U,
+        1273917827U, 3092782016U, 136954485U, 578555584U, 2987957377U, 3331965508U, 1435865560U, 3588137910U,
+        4206656318U, 1091435046U, 2733047796U, 1493747186U, 163271259U, 4140116980U, 1249033621U, 2127306217U,
+        2690529542U, 242080101U, 3032193528U, 3329626791U, 2496575171U, 3674741232U, 739735527U, 658112263U,
+        3846505462U, 3425403786U, 3600676020U, 1061035454U, 688874988U, 2173083696U, 29717070U, 1611522166U,
+        120301816U, 2230327883U, 758085431U, 2990165821U, 2109921511U, 1169953112U, 997229352U, 3978196661U,
+        1073927711U, 2106130848U, 224196592U, 2762216718U, 546764765U, 637775656U, 4072724098U, 1903352724U,
+        683251806U, 3159483816U, 571780147U, 2740709678U, 2985629454U, 2741791237U, 2224202792U, 3623940952U,
+        1140367234U, 2581571348U, 675588277U, 2733113393U, 843591907U, 2078684356U, 519986595U, 2660059995U,
+        4194857514U, 599792998U, 310388895U, 3206084070U, 3814907356U, 795246058U, 3322860949U, 2043860991U,
+        282369514U, 582286270U, 1516844756U, 3057412450U, 3437936847U, 3669755488U, 39596176U, 817865180U,
+        2602855205U, 985399556U, 3276678446U, 2760246569U, 2948279162U, 2529365950U, 4209749375U, 3000249225U,
+        2233944737U, 1043169948U, 3836318607U, 968748999U, 1426697764U, 3087128548U, 671495667U, 2605848568U,
+        1093184851U, 2406509535U, 990458473U, 2202237082U, 1963342287U, 2893612709U, 597294162U, 2138789655U,
+        290803896U, 563701772U, 2933142887U, 1584797216U, 1351185723U, 2794339697U, 1586901899U, 2237721368U,
+        2519710718U, 3117378569U, 1235237490U, 2649673223U, 356958980U, 3157287738U, 143523943U, 3537846190U,
+        1062916131U, 1020744239U, 1937378875U, 1878666943U, 342037608U, 3725838587U, 3210053974U, 1695159511U,
+        3007484164U, 1387305737U, 2204480811U, 1672508448U, 269207754U, 4219698272U, 903422962U, 3639307238U,
+        772269200U, 36770988U, 823124105U, 1378816193U, 3441571028U, 1447351712U, 2345415845U, 277714626U,
+        1395602668U, 2796954910U, 2407020015U, 2791619802U, 615083426U, 1032832520U, 403745850U, 1143440106U,
+        1647009487U, 3180370293U, 725647191U, 3586508242U, 633235736U, 2447926813U, 1651021671U, 4192258643U,
+        4055234553U, 1803346064U, 412159695U, 944909871U, 3175059735U, 1879554979U, 1317409435U, 2915810527U,
+        3435234840U, 2592320891U, 3653361870U, 727828919U, 3043558745U, 3450723469U, 1139794835U, 1654212077U,
+        4166875924U, 3967185135U, 70495586U, 2967351421U, 251780834U, 777959107U, 1248138755U, 3496861791U,
+        851003073U, 1967555369U, 3851901142U, 3426859738U, 2113239185U, 1052413637U, 102952356U, 3802544053U,
+        1023781912U, 370858266U, 234980815U, 1753704342U, 1948091137U, 3313211374U, 2177357060U, 978709457U,
+        1762292549U, 4036316100U, 3611285221U, 56742329U, 3021404638U, 2832984174U, 1680112053U, 1837384486U,
+        1829652584U, 4059589992U, 1035736068U, 2951969546U, 1398340608U, 421924349U, 3559664158U, 2241798120U,
+        821226427U, 937852573U, 173702985U, 3084331099U, 4193094744U, 308902416U, 2704734472U, 1005740592U,
+        3089747364U, 267347140U, 943708203U, 3125896333U, 3667559730U, 81936971U, 1129038608U, 538646443U,
+        57074597U, 339564983U, 4169968829U, 2325845464U, 2359856526U, 3562550066U, 1003003589U, 356270725U,
+        3581205756U, 1671143357U, 2202246779U, 1930696437U, 2216810727U, 2539263140U, 1694134370U, 1U,
+    },
+    {
+        3670841617U, 3155150674U, 1760629329U, 1019279826U, 885641592U, 1152632757U, 3285403113U, 1869848473U,
+        1330511602U, 1998017379U, 399052589U, 4214612230U, 1173392752U, 1119284031U, 3300092745U, 3254394980U,
+        1492005384U, 74842333U, 827273316U, 3644405359U, 2648590115U, 36062168U, 3701748854U, 2488841978U,
+        4291959500U, 3248509507U, 366980679U, 2353924266U, 430032702U, 139198081U, 4014184365U, 2865076981U,
+        354644742U, 3524329131U, 3510071538U, 341129753U, 3874053468U, 2080132691U, 1416403632U, 1748818360U,
+        2915617988U, 1433847591U, 2703357977U, 3921571043U, 2146904131U, 4096902797U, 2234251199U, 4055144262U,
+        3123339738U, 2295382980U, 3656725460U, 2584557213U, 3732781006U, 2664289363U, 4261154748U, 1774999744U,
+        1110801310U, 2144630037U, 3324723598U, 1923351301U, 411119242U, 4239167443U, 3452866161U, 94925022U,
+        3982920685U, 2514498140U, 2930356402U, 869519973U, 2333555343U, 3957124091U, 3091456137U, 67613708U,
+        2993276290U, 2555135287U, 2994623016U, 2333908168U, 790853918U, 1078315119U, 2836175358U, 904428505U,
+        3764165331U, 785397927U, 2090312227U, 3324870169U, 268506367U, 90370244U, 725789374U, 1071101757U,
+        2496413698U, 1244910641U, 1189411867U, 1538749030U, 3804018859U, 52161604U, 71856952U, 2044583590U,
+        991111584U, 16559920U, 2109673361U, 2716776631U, 400442736U, 134499980U, 1277516465U, 3595229070U,
+        3270683287U, 3767638199U, 1437815331U, 867681859U, 1883902248U, 1692858389U, 2133303610U, 1042433868U,
+        334023988U, 4220777333U, 2590218982U, 1512842971U, 3147838545U, 2863714248U, 4143945543U, 137621616U,
+        973751067U, 6668135U, 772582504U, 1797337828U, 2354455440U, 2444370243U, 1213701725U, 2356115227U,
+        2094646370U, 2385056482U, 3106420800U, 2320639116U, 3437739516U, 426476110U, 740550305U, 3002241959U,
+        2753121610U, 3504980856U, 2132409961U, 3819400007U, 3182624398U, 613830119U, 3895135893U, 1654527167U,
+        3737344477U, 4065683791U, 926396986U, 2890296788U, 4090373060U, 2114699896U, 2637972661U, 2211225613U,
+        1396066564U, 1888227951U, 2247007168U, 333128278U, 4112262091U, 3905117393U, 2593251182U, 2330347861U,
+        3927758086U, 2352895927U, 899311269U, 4227814993U, 3721009026U, 1102389631U, 1454617662U, 3577326747U,
+        2506067815U, 198508013U, 1279399527U, 3334790930U, 2133599630U, 3706898371U, 631228283U, 3606070994U,
+        356431236U, 3266955038U, 1696684554U, 3301219943U, 2751049285U, 3724236430U, 3017119143U, 149684994U,
+        1299251247U, 2631138110U, 3521858220U, 3404667648U, 3413875030U, 1829871292U, 420575321U, 3188530303U,
+        952179915U, 41925344U, 2293707237U, 2786268035U, 2805913479U, 318169800U, 3367536682U, 1458209205U,
+        1087057194U, 2982273150U, 3206453683U, 3268311095U, 212031037U, 3950574362U, 3151878120U, 1094358501U,
+        659528705U, 3080359245U, 1522864380U, 1455078194U, 218586354U, 3796046172U, 749704785U, 4212519917U,
+        2558133346U, 343704047U, 2308463891U, 3653132423U, 2402623891U, 534298088U, 806698314U, 3020666221U,
+        732184529U, 3296029484U, 709030582U, 4112622448U, 1881834057U, 3800973026U, 1419108686U, 3869920404U,
+        3824478346U, 228166494U, 2039222865U, 456935912U, 1617802927U, 3413041510U, 1027740849U, 2205298689U,
+        57280813U, 1674967176U, 39026461U, 3434161705U, 4132748298U, 753493711U, 1719742747U, 2554576578U,
+        2357031814U, 1766424239U, 3014812145U, 3838455783U, 3143050910U, 3979698184U, 1021958502U, 1285904299U,
+        411664674U, 3789980317U, 2271539115U, 1586725967U, 2541385179U, 4090208776U, 654645845U, 2919935712U,
+        1502377820U, 2660127457U, 1532366594U, 4092559146U, 717073460U, 2400028793U, 1334442250U, 2572107307U,
+        3046590948U, 2344832350U, 311295243U, 3225493639U, 2460566754U, 520210036U, 3174326377U, 1246546656U,
+        3517106101U, 514656147U, 3932520382U, 1190363036U, 1309056736U, 2314350217U, 2690362782U, 3525071724U,
+        4204992417U, 4109656184U, 973640294U, 341517986U, 2239711560U, 2321652851U, 3796782495U, 1912675804U,
+        3429250817U, 335588848U, 1020138237U, 798110654U, 3415160474U, 3354587415U, 2105986422U, 470025650U,
+        709638237U, 3385789749U, 3136712932U, 3072673369U, 4078065668U, 3015257373U, 2535675055U, 4244848356U,
+        1938319650U, 2158740630U, 2920040158U, 733151119U, 3308112150U, 2799848386U, 1760900069U, 1171602559U,
+        4108662489U, 315806988U, 3486705937U, 3673686149U, 521881530U, 1657887404U, 1959188823U, 2507091358U,
+        3787597926U, 366499809U, 2422836784U, 4121032662U, 2176268141U, 2176923525U, 406874872U, 2586518383U,
+        1841588369U, 1439399714U, 3527258223U, 2992342219U, 3007064654U, 3920475788U, 522832533U, 242708099U,
+        4271220714U, 3333902298U, 4080103524U, 3575874190U, 1426444417U, 1709113421U, 3824189511U, 3259940482U,
+        1939468292U, 3621266794U, 685319083U, 700470329U, 1680039884U, 3489348072U, 569813841U, 1145722696U,
+        1917742670U, 411309810U, 1942623901U, 1646078776U, 4225635168U, 3455429346U, 3190598843U, 382145390U,
+        3892188612U, 2832538092U, 1512807812U, 1911236868U, 2026509528U, 1292414602U, 1204096708U, 3098553632U,
+        198285303U, 1210573216U, 4280837630U, 3407104788U, 1640490674U, 1226651881U, 937146617U, 2547431529U,
+        3142750237U, 2770106171U, 1588986092U, 1348142404U, 4167661221U, 3112199364U, 2386301315U, 1383343871U,
+        2955652821U, 2996965094U, 2026717868U, 1373619623U, 2868284647U, 4005684953U, 4002569254U, 3113479482U,
+        4127448193U, 2770836814U, 786941452U, 3846051566U, 1958436328U, 3206622024U, 4055273917U, 2150246467U,
+        1592816544U, 622971364U, 33454006U, 155000636U, 644047135U, 595101763U, 1395317348U, 24321523U,
+        1841488916U, 2446700211U, 39951258U, 1818455587U, 1263821592U, 4110749208U, 1521488580U, 323912493U,
+        769577309U, 2701172587U, 3088656710U, 1254278905U, 113780431U, 3072266251U, 3545934491U, 1154141146U,
+        3921125288U, 1306671794U, 2161109413U, 1269170811U, 2552649518U, 3710296295U, 718919452U, 3805869098U,
+        2190387905U, 3298388641U, 604753117U, 1147959784U, 3438101613U, 3728017083U, 3379142955U, 3323413901U,
+        3036739870U, 1148856344U, 2304701033U, 2393924197U, 3676045437U, 2758666394U, 823715251U, 2634556223U,
+        3402303943U, 886247560U, 1946756735U, 2995553141U, 1648275177U, 1755950945U, 3862121914U, 2239284846U,
+        3842989378U, 2531491761U, 2289578115U, 426818591U, 1138501498U, 3733502344U, 4169084765U, 95698394U,
+        2362282183U, 2792418781U, 3376148372U, 1461558536U, 3921176910U, 3351323889U, 4083440881U, 1720188105U,
+        2278387554U, 1687565293U, 3293094827U, 881489352U, 2451581931U, 728005866U, 1488475937U, 1164154483U,
+        3990944909U, 3688832873U, 1391147985U, 2526815792U, 3629441549U, 1442829942U, 203625305U, 62811816U,
+        477899785U, 1733124908U, 2388957656U, 4228117823U, 3355675026U, 4052298974U, 191229478U, 704698061U,
+        105416234U, 2844397359U, 3210944490U, 4183357406U, 621909987U, 3357904216U, 3929958768U, 2682858174U,
+        2831103529U, 1657650784U, 3222966883U, 2696647247U, 1428937216U, 2027429760U, 3090584092U, 2841464451U,
+        1738392817U, 3658841706U, 155483741U, 1461495994U, 3179480044U, 70378574U, 2116921045U, 3290685746U,
+        1691113951U, 2235285043U, 2585339484U, 1094789844U, 408628523U, 2801362899U, 3246017216U, 1751593317U,
+        3936508668U, 2272878605U, 2493381267U, 2346624252U, 1741538775U, 2109399243U, 1320496442U, 2904987361U,
+        3953987777U, 1717084989U, 4046260870U, 2855341920U, 2207654506U, 663202706U, 139925001U, 1101834088U,
+        287706292U, 1851649192U, 249743288U, 2092905311U, 3760512957U, 4175814225U, 3475077427U, 432985443U,
+        1665393415U, 591781644U, 2332501265U, 2804097178U, 3995655334U, 654500239U, 4140824723U, 1763463125U,
+        1500779440U, 1066878560U, 3781681202U, 2353689545U, 4072196709U, 1813130703U, 2578064494U, 916372618U,
+        3776431108U, 2917873354U, 1430020918U, 3600271983U, 1958450185U, 2139209894U, 2910228701U, 594903880U,
+        1298015603U, 4195858954U, 2564465839U, 1527581969U, 3768519759U, 920652421U, 3634625600U, 3398497900U,
+        1827183135U, 1138997401U, 3528025038U, 2253236881U, 126213891U, 994305291U, 1637143606U, 3919233311U,
+        758269112U, 127716842U, 4098461272U, 2735385631U, 2589027447U, 36868051U, 2757373698U, 2130919436U,
+        2199397122U, 3744991735U, 3408367020U, 2687157396U, 3434093866U, 3309816296U, 3447646294U, 3542451292U,
+        2733154299U, 1154371115U, 2048364786U, 3419181763U, 2535860583U, 1436130084U, 3912005484U, 1U,
+    },
+    {
+        4179262220U, 2950574337U, 1430272061U, 1393638109U, 960928996U, 3911358619U, 3552540600U, 3371893163U,
+        3204169711U, 2437449599U, 4100739606U, 824734059U, 1687975334U, 2472878574U, 3806029030U, 2677307222U,
+        152315557U, 3968145840U, 397372048U, 1786798793U, 655704265U, 4238562123U, 1221715938U, 2149072112U,
+        1467312971U, 1154566853U, 270816266U, 1009263217U, 352324600U, 2694000566U, 1997157942U, 951791399U,
+        2956887689U, 1427151002U, 2117385934U, 3807384446U, 3514085627U, 1689049058U, 3533809503U, 1786807385U,
+        2542982468U, 4159605922U, 2661289301U, 2332044232U, 2795077492U, 3675764533U, 1477564354U, 3092991050U,
+        1811317850U, 3224620600U, 3165909832U, 4199170209U, 3819839108U, 2645742622U, 2290321707U, 3123816651U,
+        1632572219U, 2759455442U, 770632557U, 1942607041U, 671735653U, 4037808424U, 1939984455U, 786215864U,
+        1714035570U, 158034177U, 1517892592U, 2482153637U, 2237067282U, 3809236043U, 2135565617U, 48466802U,
+        1292404818U, 1019927035U, 2113486911U, 2004372579U, 3364368799U, 1911060994U, 805863484U, 1700434508U,
+        3838203959U, 1332945163U, 2846044744U, 1373643352U, 3751709708U, 946049303U, 1689473567U, 72457984U,
+        574476913U, 1381266044U, 1891991838U, 2541129459U, 287700383U, 3503085533U, 3876812690U, 1212246087U,
+        965874781U, 1893896725U, 584379921U, 2644752503U, 339456564U, 2435812887U, 3013294702U, 1702021281U,
+        2388007259U, 1357059686U, 3151568341U, 1149971404U, 2188471993U, 4290866371U, 2336591638U, 2661324185U,
+        104562709U, 2544217472U, 3483694084U, 2871661010U, 4163650917U, 3567363113U, 3516476045U, 2123678170U,
+        502346948U, 1835794539U, 1347848635U, 2018990125U, 3493586612U, 559353709U, 4008100638U, 3365012966U,
+        1152687525U, 2946781468U, 3077032289U, 901561431U, 3108888066U, 2607146765U, 1986380619U, 3854185777U,
+        4209483437U, 3841347380U, 620257920U, 1278386409U, 1209048892U, 126273386U, 2521815062U, 895466549U,
+        3921250163U, 2012978539U, 3112894503U, 53585189U, 2206374563U, 3310461324U, 216087744U, 3812712635U,
+        2146265999U, 3446947048U, 1589385595U, 696165965U, 1811388797U, 2351975165U, 649291874U, 1879495323U,
+        3315876772U, 265750667U, 4145739398U, 2295466364U, 2270558173U, 108573784U, 3929307323U, 4083438369U,
+        3287707225U, 980363215U, 3689937127U, 2830333050U, 2076572691U, 385933109U, 1854369813U, 3857384996U,
+        2292006380U, 2295945440U, 519390003U, 3929452723U, 3951023093U, 1377207620U, 3382760585U, 3968923204U,
+        751561849U, 304823282U, 4006317210U, 2061073401U, 4115008613U, 3097418074U, 924440164U, 836771222U,
+        1369720490U, 551622175U, 3148847551U, 1442132982U, 2283228000U, 1229946115U, 3281041280U, 2919240665U,
+        2114174325U, 321942131U, 2540555651U, 13612496U, 60585556U, 413144155U, 496668301U, 1851913343U,
+        1715192591U, 3586266778U, 898278577U, 1489466663U, 654264606U, 1482603546U, 3184195556U, 2412520413U,
+        175136102U, 4060121633U, 4286128685U, 3367285689U, 3495842933U, 1899212733U, 1633744885U, 2619465361U,
+        650596362U, 3630842190U, 4248503239U, 1467000387U, 1346913337U, 3772593099U, 778834009U, 3090099677U,
+        3057566369U, 300743409U, 555125411U, 676271580U, 815235361U, 3016503857U, 2337985844U, 4121186044U,
+        3379055544U, 1229710843U, 523022214U, 1521910376U, 979704999U, 289048518U, 1829927297U, 742106492U,
+        4294343146U, 1300424003U, 935063827U, 1172727855U, 3090039533U, 1901013776U, 4255685611U, 3455780477U,
+        3403975295U, 1874117186U, 2755969570U, 3897638770U, 605212502U, 4050683432U, 1968027426U, 1192509123U,
+        1704506207U, 3635208850U, 973975164U, 3961147023U, 2234658256U, 3622484949U, 1651088984U, 2055470132U,
+        4253401144U, 3600483965U, 3444973727U, 169839089U, 1525170965U, 2690437995U, 1798912565U, 2155952224U,
+        719833317U, 4263628799U, 2566160719U, 4052607650U, 3789339200U, 2513709197U, 593609560U, 521101714U,
+        3479861245U, 167106579U, 3382881040U, 1505497734U, 67844014U, 2265063337U, 3006593761U, 2160124531U,
+        909960113U, 3497969444U, 49983519U, 3189967771U, 1324508216U, 2575870094U, 439411476U, 1911440195U,
+        2494254800U, 2003939327U, 1225857332U, 2626385936U, 1993315341U, 1838136133U, 3493998486U, 35633365U,
+        1053560215U, 3038879112U, 1640590375U, 1150886826U, 917861164U, 3760405801U, 4128442002U, 1696145583U,
+        3616600358U, 3258213892U, 3551073707U, 732739923U, 4262548797U, 1142502543U, 552140869U, 118923049U,
+        276356776U, 2960044431U, 3061993227U, 3273474395U, 1788497886U, 3917216916U, 2318642423U, 3880363688U,
+        3074080704U, 1572193598U, 3567536981U, 2144428025U, 2495617080U, 1939139558U, 2566453459U, 1628797619U,
+        1573803255U, 3310453799U, 2527251215U, 188768607U, 3305572430U, 3202675739U, 129445318U, 1127473353U,
+        530697873U, 1309256346U, 2133432010U, 608197063U, 3626792064U, 3486779245U, 4164355326U, 3874094069U,
+        783521981U, 2594982292U, 3281203246U, 304433131U, 2162469084U, 2119139337U, 3160811142U, 49197283U,
+        1183295315U, 2478432898U, 3316848121U, 2691653029U, 2335528922U, 2200665772U, 1677790368U, 142207939U,
+        2312796657U, 454111161U, 2522637159U, 2709619992U, 2050438344U, 2445779044U, 1410854510U, 1162158587U,
+        744598997U, 1541815153U, 3225649799U, 1029471470U, 818397662U, 2389618929U, 1237445464U, 2099653742U,
+        1479586097U, 5765590U, 3114279776U, 2728583074U, 2054766254U, 3489490822U, 3519499877U, 3786834516U,
+        274009276U, 1349197786U, 1216975879U, 372188210U, 3233239338U, 1515689268U, 4232408805U, 935646935U,
+        2576446544U, 564249726U, 3927752907U, 893183076U, 1146878861U, 1810741420U, 2781000919U, 759757591U,
+        2216101601U, 3653315433U, 1646962331U, 262865794U, 1079904318U, 2855663053U, 3034827960U, 2737038102U,
+        3388070820U, 1239445249U, 1027880539U, 2988065676U, 2281662925U, 3707122786U, 2005099086U, 302309409U,
+        12994916U, 4290062566U, 580807165U, 3740708507U, 1417616211U, 2921884140U, 150788359U, 2559249599U,
+        3732935632U, 4233231190U, 3903921129U, 3305763198U, 557213394U, 1045271641U, 1119707399U, 3176851798U,
+        607542414U, 3359853890U, 1752205586U, 881982752U, 3011924925U, 3124953206U, 3824746553U, 1497700302U,
+        3095391862U, 2514530361U, 1004346068U, 571683111U, 2333250845U, 3996358572U, 3361587475U, 484681961U,
+        583837810U, 3601007827U, 3067227198U, 5676104U, 2140600746U, 333721718U, 3810741057U, 3642279370U,
+        2986524560U, 1399351198U, 2532619435U, 952216152U, 846040967U, 2333881422U, 552443296U, 4082190774U,
+        1548504442U, 1301816265U, 1200689258U, 140148891U, 426228569U, 3640822051U, 4015281753U, 1074573116U,
+        1506393765U, 1685218235U, 2915855937U, 2144173686U, 2239622397U, 263442087U, 2299872856U, 2977086191U,
+        962364107U, 1441225537U, 3141909100U, 2338994441U, 2746835372U, 2202224293U, 2853621055U, 2341464513U,
+        1785060826U, 2137418073U, 2139492888U, 1541909147U, 3029830955U, 1155265177U, 2801591726U, 3158834325U,
+        179898911U, 4124682809U, 1431269645U, 3903312540U, 4198779265U, 1274007627U, 1275563608U, 1037111229U,
+        967339577U, 651306454U, 1347801721U, 3574641481U, 1039098187U, 2034249994U, 3376819798U, 2350713697U,
+        41032338U, 818939926U, 3727655895U, 2258970399U, 3686644497U, 3096002934U, 3990371416U, 577810397U,
+        4293298692U, 13462444U, 4131326797U, 3839443132U, 3547147424U, 4145342116U, 3947571142U, 2983036276U,
+        4084497562U, 2192631449U, 3020457316U, 446040907U, 1355915099U, 598538143U, 2051093121U, 605821131U,
+        3415948145U, 1983209917U, 3761151439U, 2177993846U, 828343227U, 2134783009U, 3633034113U, 1112148267U,
+        4138226666U, 1593578800U, 1416717012U, 2105458169U, 1738170493U, 424521778U, 3859216678U, 3857811848U,
+        3349492309U, 1417679765U, 2110405U, 3660134979U, 3583663314U, 1561940954U, 3863386312U, 146748146U,
+        3201735089U, 2132241718U, 3960673723U, 4033964068U, 699463047U, 300114670U, 4205067026U, 3835033660U,
+        3614470781U, 1262961767U, 3264632923U, 3220835503U, 2931138979U, 2523715964U, 1541038886U, 428013463U,
+        47029728U, 1998713978U, 3121596798U, 1492395122U, 3452723163U, 770493038U, 2348143077U, 3085701086U,
+        504655778U, 3930327962U, 4053084197U, 596502301U, 2976112291U, 2113577613U, 3614130813U, 4089987238U,
+        3690287202U, 2663056764U, 3879949915U, 2978141448U, 3226726120U, 3319570306U, 544534267U, 2269801977U,
+        549717017U, 2164087367U, 2144191274U, 4236490561U, 4099221917U, 3643124252U, 102074219U, 1U,
+    },
+    {
+        3086508431U, 2015310406U, 526360219U, 2028916618U, 1693564911U, 3336389317U, 3993813725U, 1702049388U,
+        2563554196U, 3506522683U, 3393003392U, 410612014U, 2894970494U, 1204448630U, 2832276799U, 3080635385U,
+        3843493978U, 4217508575U, 614859326U, 244699583U, 3542468286U, 2693353332U, 748826598U, 1272013913U,
+        759097984U, 687615057U, 804391170U, 923598107U, 3359434058U, 2235646799U, 2902762683U, 1345437009U,
+        1566372103U, 928370839U, 928067664U, 797478587U, 2444347585U, 3477155734U, 3815375044U, 1990332426U,
+        1616139470U, 462846357U, 2829684419U, 2862113347U, 1989680769U, 3289712422U, 3010720327U, 2344316425U,
+        3033918353U, 1735461871U, 1193549335U, 53723209U, 3193846701U, 493809631U, 2850046350U, 4206644267U,
+        3663836470U, 399796205U, 845791037U, 4165961899U, 3862254572U, 2688342795U, 4260455245U, 2060030719U,
+        1008345071U, 1572927252U, 3312870757U, 3786577422U, 3029793994U, 1464453610U, 66149535U, 3249020519U,
+        954175898U, 1631089822U, 1316180924U, 2423401501U, 1127805473U, 921418366U, 2842077981U, 3327954431U,
+        2883642655U, 1728822012U, 610176918U, 1423347741U, 3459605710U, 671450090U, 2894789502U, 1580458727U,
+        3611355431U, 3804955967U, 51561512U, 2146046473U, 3755808154U, 2926097751U, 438567291U, 1690176658U,
+        1546990904U, 2309217239U, 1374778828U, 117010103U, 1169464159U, 3373601895U, 3646137757U, 1424078161U,
+        1949228284U, 656816412U, 3377567610U, 1759952307U, 4208823878U, 3046106039U, 2182486222U, 2553406848U,
+        1326584146U, 4284746045U, 1430347413U, 1149459809U, 1612558396U, 4211173524U, 745228560U, 3604524519U,
+        3659139515U, 1350189899U, 1365905034U, 67028478U, 1691135254U, 1684751406U, 1611860602U, 706208999U,
+        1564801987U, 4292227168U, 42830203U, 1435916141U, 3030447843U, 3390446793U, 2411953043U, 1485429228U,
+        1873964605U, 1978843095U, 989429992U, 4172838237U, 429494037U, 3472686589U, 3186590596U, 3381201593U,
+        819706106U, 2734024532U, 4089824604U, 2227717753U, 1287949266U, 2356991894U, 449295516U, 3470238102U,
+        201863314U, 1395565557U, 3679619670U, 3939856927U, 3883820071U, 3661332599U, 3638335480U, 1156492540U,
+        2146165100U, 2679039567U, 2381308098U, 2159964073U, 3201978414U, 4046024686U, 476337300U, 2940513844U,
+        4046587482U, 1507082744U, 2943590954U, 730601666U, 2947850524U, 2239416268U, 1811452653U, 2393574418U,
+        1652088909U, 3020520852U, 1756839114U, 4131127626U, 3419249955U, 238093651U, 1680681144U, 1543073452U,
+        913515126U, 3104946606U, 3959272919U, 1845573013U, 4212034816U, 2199918067U, 119844950U, 1745628197U,
+        3026630338U, 2298567500U, 2604574827U, 4118096023U, 2924729723U, 3497641118U, 3042792913U, 1185149622U,
+        1950893746U, 1978363963U, 1259998939U, 1389680302U, 1196047250U, 3269299855U, 489574614U, 1330155341U,
+        1807132678U, 3825636931U, 3610417723U, 3584884797U, 3180495610U, 1099978055U, 1018842916U, 2338952920U,
+        2868683839U, 3624040373U, 31512193U, 4129430892U, 4117581544U, 2192014286U, 172241981U, 2735274813U,
+        2004249492U, 1434456846U, 3741461936U, 157581044U, 206729093U, 1461928288U, 3817962819U, 198740955U,
+        1811560149U, 3486186085U, 1242284381U, 673238179U, 2758031648U, 728907862U, 4162948556U, 1880394703U,
+        2024764539U, 958499330U, 3865386747U, 2696121198U, 103515315U, 2921194415U, 512003347U, 1934561011U,
+        668164041U, 2785027972U, 638349564U, 1293353425U, 483719383U, 1116674706U, 1312661964U, 2955247062U,
+        3583526694U, 4091958572U, 327293238U, 1189989935U, 897044822U, 2531150017U, 3389347148U, 3170042101U,
+        2753773716U, 1295898396U, 3696002264U, 2368750298U, 1001376615U, 2790606236U, 439009261U, 1313113601U,
+        1356436516U, 1564122542U, 2748528078U, 554952265U, 648632148U, 1289896157U, 1863890294U, 1991634880U,
+        4233448442U, 3639898352U, 2583255840U, 4268927154U, 2043292641U, 2809434582U, 1560898326U, 195132279U,
+        2588487793U, 2583959563U, 2874700079U, 2071181389U, 253019010U, 2764545561U, 357957048U, 1834596134U,
+        558471644U, 2528921332U, 3401436693U, 2969231651U, 2136648444U, 1155170590U, 1640342872U, 290215389U,
+        1881687660U, 585134228U, 2111411859U, 2424948602U, 4158755581U, 51516940U, 3883913325U, 1767840185U,
+        3262797685U, 1411216825U, 2304271574U, 3252512672U, 1758960602U, 353698525U, 2396775932U, 2866363294U,
+        1218879075U, 928627601U, 3426421097U, 3775320436U, 281274289U, 1630566393U, 99230877U, 3656354035U,
+        1308705260U, 260365524U, 3809574850U, 3050511215U, 3591914744U, 1428968544U, 625563224U, 980115825U,
+        578162824U, 2573983064U, 1850655188U, 1809930910U, 2980159298U, 1442852363U, 1176022833U, 1346337269U,
+        582059786U, 1328473688U, 211905596U, 3298650985U, 4130459375U, 1112365537U, 3336068787U, 1636129746U,
+        971346048U, 505251205U, 3448216462U, 2101858254U, 962690503U, 837645218U, 3402886812U, 1327007256U,
+        2919533052U, 3654539145U, 1602061175U, 3893154917U, 4265661847U, 936851897U, 3494915121U, 1547479264U,
+        2413451641U, 3960704399U, 3857567022U, 1420885458U, 2514550128U, 3306892088U, 1120566447U, 2348466281U,
+        2333366586U, 1388574441U, 3319806292U, 3818389851U, 506813719U, 215315972U, 1075151704U, 3703536463U,
+        206896110U, 3074717095U, 4095690804U, 1348783884U, 3169985172U, 3772757006U, 3256072918U, 1202822631U,
+        3066939561U, 2249535256U, 1172290927U, 3725125421U, 1461297966U, 832512991U, 3944301417U, 718442286U,
+        2684564112U, 992339030U, 576378884U, 2875763218U, 78253440U, 1322578422U, 1961662637U, 3863922738U,
+        4198453463U, 2558294082U, 117541885U, 3279237135U, 1579734977U, 704633787U, 362772723U, 4118079172U,
+        867650048U, 2065514254U, 3730902128U, 742340689U, 1993116306U, 3027127292U, 2668032143U, 586288061U,
+        4134071292U, 2946121236U, 241835708U, 1457450443U, 468628408U, 2099938863U, 1458585343U, 600632559U,
+        370018455U, 396627205U, 3719346440U, 1043784468U, 1376738899U, 2516704889U, 2060056459U, 3572929761U,
+        2529840467U, 1144419792U, 836817219U, 516890474U, 4017384983U, 1645716749U, 3343299534U, 1220627782U,
+        3755329440U, 1871252492U, 3469899555U, 2846760511U, 423566193U, 1703994895U, 532951219U, 2282110612U,
+        720004845U, 2342060723U, 435830695U, 3840292685U, 1054284469U, 720595941U, 1006731842U, 2905617728U,
+        2568113739U, 232475397U, 1027723465U, 246887790U, 704384182U, 462374611U, 2176946333U, 33119461U,
+        93803065U, 3856181255U, 667274513U, 3704770057U, 4164729259U, 3206222077U, 3723119479U, 2069591940U,
+        213310125U, 14892653U, 1332621539U, 1237473589U, 873691351U, 2053092261U, 745192580U, 3464935560U,
+        1017302876U, 346015020U, 1565496809U, 1704220338U, 2000143564U, 858348299U, 2037732189U, 1940799828U,
+        4039312948U, 3744291758U, 1711466854U, 1991571454U, 304375126U, 931880843U, 4143577449U, 620129402U,
+        2976122160U, 232195892U, 293977528U, 812771218U, 1549433019U, 2292445779U, 572849237U, 274814901U,
+        2228366859U, 1478232001U, 4240520014U, 215733683U, 3100274133U, 2431787335U, 384700770U, 1956962886U,
+        549942619U, 4156068212U, 1988538400U, 2939522987U, 2696951636U, 1326905223U, 4225384153U, 2110144994U,
+        885433989U, 2390207771U, 3310276688U, 2494567722U, 2711877465U, 1332965826U, 3083448489U, 2506298825U,
+        2028114702U, 4005703532U, 3712368398U, 2314219885U, 100977694U, 1051395868U, 4123921440U, 3177502449U,
+        3453656049U, 255369095U, 524058107U, 3479311830U, 2548767617U, 2206161941U, 4193209519U, 4146311015U,
+        1549878761U, 648503093U, 2142174205U, 1321126208U, 3486277393U, 1683034212U, 3596919373U, 1076390290U,
+        2493366318U, 3790440521U, 2505717120U, 4159181366U, 3005239389U, 3779965267U, 3822971267U, 743506720U,
+        2659499666U, 1647379334U, 3186447252U, 4216742904U, 2132905363U, 1202540136U, 3595021948U, 188518722U,
+        4126061306U, 958585565U, 3513535901U, 2164893785U, 3262597401U, 1446941453U, 299436020U, 2047487825U,
+        3963583862U, 1920595299U, 1149036405U, 797014240U, 4039878861U, 2227002732U, 844416844U, 3837815753U,
+        3720115712U, 1980367231U, 4211688344U, 3590375207U, 4219901351U, 3201834916U, 888700329U, 1917258756U,
+        14235913U, 948720878U, 440749944U, 3756906628U, 1916776022U, 1088932747U, 1846009233U, 1178402696U,
+        1328562415U, 4067859807U, 135824166U, 1204051933U, 1233373378U, 2665655278U, 3219516851U, 3779894006U,
+        2290647480U, 8542185U, 3785624790U, 3854500120U, 3803277342U, 1724629118U, 3340606825U, 1U,
+    },
+    {
+        180506637U, 2903832516U, 1843039895U, 2110670432U, 2603347885U, 2421657500U, 1130253091U, 2993476762U,
+        1761643921U, 2752098521U, 652613112U, 1163972919U, 3632612565U, 3351084943U, 1388866893U, 2117540385U,
+        381345189U, 1540156601U, 4076798784U, 3857352587U, 3763267434U, 649534200U, 2082271667U, 3420932965U,
+        1521242649U, 3054206337U, 317437765U, 4247491615U, 211903771U, 638799405U, 4106369166U, 1519755111U,
+        12124098U, 584079677U, 2210806686U, 3343763044U, 3954734949U, 702916675U, 1680087347U, 3507757658U,
+        245310739U, 578451162U, 1617579240U, 3376068992U, 100091481U, 2712464376U, 2143169623U, 588977687U,
+        3115611556U, 2219984047U, 3339498757U, 1358671097U, 2964383128U, 2865294420U, 2014694595U, 3623084500U,
+        2659843631U, 3985291128U, 1776673837U, 3549957127U, 182361496U, 3048930783U, 215277918U, 6824029U,
+        1094612084U, 393508129U, 195403814U, 3043164353U, 3180087469U, 211010544U, 2194448791U, 4071761522U,
+        2901010550U, 3439922705U, 1155496424U, 1662914263U, 2210326787U, 423193032U, 2626084941U, 4155235294U,
+        727891805U, 2513668028U, 3417818128U, 3821973945U, 3665875903U, 2955811710U, 1149472680U, 1211852034U,
+        3661784876U, 1261051119U, 2159458380U, 2177181936U, 1714644725U, 3234699999U, 4062147710U, 3276302522U,
+        449215522U, 2021439692U, 348001262U, 3216567096U, 1872292121U, 2946487414U, 1516127178U, 3066014119U,
+        2253438326U, 4212342582U, 1427037742U, 785217436U, 3545442613U, 2942999827U, 2704787072U, 3558185652U,
+        3779292817U, 686098370U, 3711240552U, 510629032U, 1183775088U, 4095953871U, 2240660449U, 2215153080U,
+        3178990615U, 4221057753U, 294608907U, 2434239781U, 1744925201U, 1838943116U, 357400547U, 1674691002U,
+        1409242164U, 3357027260U, 1687651444U, 147539672U, 2366842603U, 1310633273U, 4019957089U, 598397341U,
+        4278054231U, 2592541623U, 3976253655U, 643086168U, 902142265U, 1109218972U, 2646318523U, 2660235758U,
+        2841365085U, 2026587431U, 1994141914U, 1627978859U, 3962142223U, 1510647342U, 950891300U, 3912668635U,
+        1921101330U, 4105686028U, 3764630523U, 1876187182U, 4137251193U, 938415691U, 3414912036U, 3601484423U,
+        1620108226U, 1424743187U, 3069822723U, 2946428236U, 1095999258U, 3989054281U, 2101906144U, 2540215389U,
+        3290057901U, 1689709581U, 4083421748U, 4188276725U, 2672246542U, 4057340902U, 1858039365U, 3146770043U,
+        2479970422U, 2882328659U, 4168507984U, 4282957236U, 3398513631U, 3239467077U, 3462326120U, 2135338593U,
+        1511660712U, 3241381215U, 336153714U, 2297813771U, 1945584121U, 2915138657U, 1859950269U, 846408927U,
+        2588222281U, 1303459572U, 1696458090U, 4098458988U, 47497097U, 2219367983U, 1382356880U, 40698269U,
+        2955210625U, 3317022145U, 3066912883U, 3286061570U, 2393731556U, 2994230570U, 2754368517U, 2348912777U,
+        3369579244U, 4292575768U, 1520673782U, 2975808120U, 2471552990U, 1171669761U, 3365587073U, 2479526288U,
+        3073250320U, 1829715635U, 1064957393U, 1729117421U, 466526326U, 3322575289U, 3228864532U, 4165050U,
+        468665023U, 2280113778U, 463864889U, 563976578U, 1991865994U, 544572799U, 1431698477U, 1059094183U,
+        3747181101U, 1586860792U, 154607080U, 650842570U, 3712557558U, 304150413U, 3328095751U, 3892209050U,
+        2865056892U, 63308339U, 2870156867U, 1117688624U, 2686833977U, 1340238142U, 1558670283U, 2589264533U,
+        1028238135U, 2032294851U, 1676496809U, 2704291258U, 3857316950U, 591124593U, 390674088U, 3650686246U,
+        1319084123U, 2669352248U, 3396390298U, 1018279959U, 3607205350U, 3703135247U, 1592033166U, 206513603U,
+        1374031727U, 2588634725U, 1029625462U, 154705372U, 1621353566U, 2876295019U, 1505080438U, 1012637519U,
+        1745940950U, 2452328874U, 2733521640U, 1378835365U, 902630539U, 3754102739U, 1204229122U, 3811821781U,
+        4038324403U, 27472906U, 4083825093U, 192994777U, 3193277033U, 3448468213U, 2790926187U, 2649713743U,
+        406494257U, 3999072814U, 1221989546U, 189468261U, 1111906004U, 2717292052U, 2251942031U, 961040244U,
+        3719001374U, 2343676784U, 483873230U, 3095045289U, 586083373U, 1797967568U, 3191953358U, 2778324159U,
+        207728641U, 2435449136U, 2643361060U, 4113629944U, 1661099470U, 2951575674U, 868496077U, 118283264U,
+        1792434971U, 189897557U, 1280859255U, 3428375580U, 3991134656U, 2837518424U, 2057609987U, 2117366373U,
+        933193582U, 2676514106U, 2255118709U, 3618876791U, 3053348235U, 3857958577U, 3030264959U, 2362975889U,
+        2507767001U, 4251632779U, 4249903166U, 533587274U, 1402511515U, 3252830768U, 3722580416U, 1062369474U,
+        3946099000U, 3695522838U, 1297811540U, 3675095115U, 3778336341U, 3741568542U, 3742322412U, 2638909167U,
+        2571811145U, 1903154974U, 3853900325U, 2747723794U, 2892967272U, 3519881336U, 434500160U, 4111542890U,
+        599387892U, 3260245061U, 1248767121U, 1329978850U, 1451615972U, 1522696418U, 685287700U, 679424704U,
+        1564516415U, 539594567U, 3691354916U, 4177293588U, 2021479361U, 1516791755U, 1409062818U, 1461315122U,
+        2944731603U, 729091746U, 1326089665U, 2225652073U, 3635392140U, 3513397335U, 2482949651U, 1356930471U,
+        2235915983U, 3147369729U, 2872919557U, 2256966671U, 468929536U, 2933926053U, 3785894907U, 1109423999U,
+        3693917411U, 1529494890U, 2301308146U, 3708418561U, 454912838U, 3686562504U, 3949803826U, 4029540707U,
+        49383431U, 299209098U, 3113865361U, 2319957838U, 2109364336U, 254511133U, 3074577784U, 3429285256U,
+        3782136216U, 3405669957U, 207688003U, 3632430963U, 3389471125U, 2647219449U, 2335752018U, 2700822641U,
+        3928018572U, 3232857177U, 188882119U, 2799314216U, 3739837732U, 266196828U, 909437784U, 3571068579U,
+        3770168929U, 2348744734U, 3052962637U, 4093344694U, 390577760U, 2476341106U, 2534837547U, 4254522628U,
+        1889144705U, 3106677939U, 3027335212U, 970722740U, 385763436U, 3542868045U, 280587380U, 411054294U,
+        1449855194U, 2870991258U, 956167812U, 2825770947U, 2691287812U, 3199063857U, 2491808776U, 316933901U,
+        10654218U, 1573822098U, 3068341758U, 853519170U, 2913754590U, 3584246588U, 1708428346U, 86643777U,
+        926118617U, 3982558679U, 2629031011U, 1784703225U, 49656646U, 1122832274U, 587843292U, 3785814622U,
+        2220223984U, 3522408175U, 2317350274U, 2927455694U, 532888875U, 1164719374U, 3325855754U, 1765926223U,
+        3089454392U, 3210333314U, 923881769U, 3888973817U, 2334458798U, 2763058473U, 3194044115U, 1209337627U,
+        824274667U, 1790541120U, 3682092574U, 1010751735U, 3126511950U, 2247720013U, 2110109797U, 1398929029U,
+        664211062U, 2509467812U, 3631856175U, 4202845447U, 2272043739U, 1703742604U, 2918838176U, 16076033U,
+        4278003729U, 2874298386U, 1524808972U, 1063363352U, 1557198557U, 1274529472U, 2161707736U, 3233854155U,
+        3512131879U, 163174813U, 1674421226U, 2920912460U, 2492973087U, 2060074841U, 3542683472U, 3792608937U,
+        2544189788U, 3282281161U, 1500481900U, 866721909U, 2560754695U, 1749153714U, 1317258634U, 137927254U,
+        1534001061U, 3657496558U, 2761248279U, 765285605U, 3381912088U, 893350690U, 2519182074U, 1993423160U,
+        3430108756U, 3157719460U, 55736620U, 4146208233U, 1004643683U, 1469905187U, 1685035378U, 3167565677U,
+        689055932U, 2172476238U, 2958777379U, 1153045645U, 3779901299U, 3198339412U, 2543856330U, 2404860895U,
+        1347542790U, 1532552427U, 2191566951U, 704072061U, 2471590623U, 3010855157U, 911541641U, 4118109503U,
+        237686788U, 3425726689U, 2301277761U, 1017607491U, 1645854861U, 769215669U, 2383243819U, 3630913918U,
+        1432208433U, 3330494563U, 3139759643U, 2481974868U, 2761797663U, 2276556006U, 3557608429U, 4104349974U,
+        3789508125U, 2038284655U, 3039926952U, 858786015U, 2633231310U, 533438840U, 803246744U, 3532717103U,
+        2262245609U, 3718901357U, 1681589307U, 700106287U, 3236579447U, 2893655161U, 2584638457U, 3769508294U,
+        225707449U, 2968812586U, 3719273582U, 792256182U, 892458320U, 3684267531U, 3229366647U, 3113520010U,
+        327659919U, 3434483169U, 987991455U, 3876240139U, 2450833603U, 2892044233U, 418841427U, 2126749438U,
+        1061656699U, 3300631274U, 492229128U, 2679147062U, 3320555218U, 3794049371U, 1434233169U, 2257600201U,
+        1348420002U, 903853476U, 862034276U, 732407508U, 3524805189U, 1175699592U, 4043396088U, 344782559U,
+        2063427220U, 648653742U, 2938423240U, 1822952671U, 1333886141U, 3169908352U, 3405567287U, 3831933754U,
+        2990921556U, 1002423446U, 3259025772U, 1542828249U, 3660401263U, 190274156U, 288601120U, 1U,
+    },
+    {
+        18101422U, 3659834181U, 2353328368U, 2900365488U, 90196999U, 365187444U, 384283177U, 702591387U,
+        3431215935U, 2831273204U, 2088222904U, 314033980U, 2209479469U, 3363532321U, 181240850U, 714913935U,
+        2963037827U, 3475956696U, 3469795915U, 660416973U, 1093465984U, 3694145861U, 1341725702U, 634525672U,
+        1063072096U, 3936957271U, 2061180589U, 2488067604U, 1611430234U, 2102557769U, 1936680151U, 830501936U,
+        881333741U, 2653706919U, 2641718217U, 348125872U, 3045313857U, 925276734U, 4169129533U, 1554229887U,
+        579650607U, 3496858230U, 440995549U, 1851272760U, 3540615583U, 1998887968U, 113382425U, 4254097237U,
+        1740766854U, 1905418128U, 2030310832U, 4266327557U, 2412173686U, 2031240411U, 3030949310U, 1224072986U,
+        2584228925U, 2820161759U, 3164044753U, 415652022U, 130227163U, 2909744568U, 1004847849U, 214620787U,
+        2006388170U, 3598953590U, 548527239U, 1606697712U, 2771072374U, 2311481397U, 873803972U, 3293881023U,
+        1181685663U, 4274352194U, 57892133U, 3572586863U, 4078390046U, 1824293882U, 117116292U, 2136795953U,
+        1588569448U, 749949893U, 2205434531U, 998315467U, 3816364847U, 4265274561U, 1708005340U, 1871677789U,
+        3795731519U, 1943591261U, 1521444671U, 3015210348U, 2764185002U, 1055296600U, 3813224628U, 2003736921U,
+        878970395U, 2696154560U, 365869081U, 561289691U, 3448376698U, 2786251069U, 2413056499U, 4038594048U,
+        1403881571U, 4266733952U, 637642008U, 2231564065U, 2408674292U, 3482037406U, 2888885668U, 539920892U,
+        3393023349U, 2808883058U, 659084090U, 3167972349U, 355575692U, 3912696397U, 1745663056U, 2788567267U,
+        2470317441U, 1589072821U, 2172311984U, 3284174869U, 478008004U, 3997239513U, 1265253431U, 1493783414U,
+        1960531278U, 3411297152U, 4145696767U, 2242603387U, 2840126441U, 1354054115U, 318084152U, 1779248052U,
+        53138697U, 4108713742U, 3439604456U, 1673131096U, 976476474U, 1041212512U, 1115415456U, 3155060072U,
+        800562886U, 3250080988U, 2896249955U, 1178363063U, 1618530451U, 2178847084U, 3203552346U, 3384467818U,
+        3453611289U, 3489740786U, 2986776946U, 2610965185U, 1519398151U, 3312598335U, 1833881904U, 447784800U,
+        3645501143U, 3781415062U, 1294779171U, 1817011181U, 3945491010U, 1160068329U, 886816342U, 3842223735U,
+        912865357U, 3426931217U, 4012344419U, 645882808U, 1827782877U, 2797392534U, 593981603U, 3609690373U,
+        644492875U, 954325880U, 494645116U, 4139895094U, 408386971U, 1877116226U, 1432944639U, 1437884575U,
+        3269646251U, 3144370164U, 533552508U, 1094254973U, 1565973739U, 1478963925U, 2896679771U, 1096873002U,
+        3872033292U, 2472006256U, 4187886623U, 2946190237U, 3410952678U, 3866332794U, 3528371133U, 3324178632U,
+        2446165332U, 4196097916U, 3972371232U, 113601368U, 3858133024U, 2541392303U, 1071042142U, 463594463U,
+        3589442169U, 1666415988U, 1527449967U, 3939032157U, 3180800139U, 3591187530U, 1723991017U, 2035449742U,
+        3805722473U, 3897428597U, 1603587004U, 2593177734U, 2160931455U, 1359801460U, 3776931708U, 4157240656U,
+        1032137063U, 2581028174U, 1353668540U, 548948000U, 922777101U, 3166273933U, 592615929U, 4122660941U,
+        1308530331U, 42070111U, 4015403970U, 1526199277U, 335792460U, 494449490U, 2699957390U, 2186671616U,
+        2951667245U, 4071034287U, 1219180153U, 3800542967U, 3157166689U, 1269286413U, 3037431931U, 2353783254U,
+        341052493U, 2489824184U, 4037423044U, 3146233940U, 1058723690U, 3095608256U, 965334498U, 64381559U,
+        170018922U, 4260974651U, 2586698394U, 2694678679U, 2237093394U, 808342183U, 1862486096U, 1175910758U,
+        3592859068U, 1574930727U, 3132299086U, 2584274281U, 2831042493U, 2476698510U, 665816766U, 781396043U,
+        2478095522U, 2641185251U, 511715941U, 723984879U, 220248364U, 2904097875U, 815277107U, 1297956515U,
+        2689024701U, 3493319934U, 2661865482U, 2697123295U, 3549346006U, 1031334857U, 1120194976U, 1162027142U,
+        2977640335U, 2547512824U, 2075356929U, 4284981323U, 3415631369U, 2344999792U, 585855932U, 2591571322U,
+        18033771U, 2789141418U, 3269857069U, 1363062892U, 3594894835U, 3671120940U, 2281696715U, 1123307683U,
+        4204539824U, 1494375149U, 1510715537U, 1286013347U, 3538902217U, 1774353217U, 3466074046U, 12983220U,
+        724065871U, 3283888306U, 2996072982U, 728817278U, 2028552423U, 1870323182U, 2942152047U, 4076198918U,
+        1673499280U, 833903668U, 1871024037U, 1311304163U, 262788516U, 109775516U, 3839311751U, 386147399U,
+        1734541016U, 3452815322U, 1340377318U, 3530141224U, 3668801214U, 1832904541U, 936381799U, 2257636936U,
+        154427345U, 1323753542U, 48628412U, 561242710U, 3776443305U, 1143209548U, 2622882644U, 1572283103U,
+        1225876205U, 970207289U, 171639773U, 1323329623U, 3468579310U, 3345482957U, 589594892U, 3325824318U,
+        1573475087U, 986891619U, 1843542467U, 3034114297U, 2643290192U, 1217375968U, 509360015U, 2841933612U,
+        4036365933U, 415008810U, 823779897U, 3043458485U, 427592728U, 3070170157U, 964714196U, 4211927879U,
+        855866165U, 775978085U, 2254721516U, 4264219036U, 4258272426U, 3940402018U, 1106627381U, 2536327383U,
+        3379627307U, 1234894903U, 3678766607U, 3020283187U, 2846017506U, 2368404604U, 543149850U, 1428358009U,
+        4200735820U, 784117446U, 2202845879U, 3793171492U, 3603797432U, 3386892207U, 1868605852U, 2684867620U,
+        2079200418U, 2420648279U, 1847002897U, 1839327751U, 1203741309U, 2489325092U, 2996051706U, 1224451186U,
+        264280009U, 3684151744U, 3773548312U, 2942567408U, 484017747U, 1801291886U, 2547441176U, 1034346813U,
+        514352085U, 678237594U, 60506585U, 1500782853U, 1479196314U, 2239199400U, 1197201677U, 1461506859U,
+        272301223U, 2392676630U, 1230985643U, 1174413346U, 1619582468U, 2233261936U, 3012520574U, 1851101824U,
+        267567990U, 589362116U, 2996533034U, 368514986U, 1056577239U, 3161296750U, 570022659U, 3386269837U,
+        4047619506U, 3777068604U, 2153732527U, 2754358338U, 1553108615U, 2577896721U, 432117136U, 4173430699U,
+        1194542907U, 1715058255U, 874336195U, 1600856656U, 248774945U, 798453129U, 385151410U, 3851337792U,
+        439277980U, 1527667261U, 1998892714U, 795635411U, 3007663301U, 3679260445U, 2021297196U, 2334180375U,
+        4280926673U, 3248951461U, 1007567325U, 1353483091U, 3641322404U, 1579804678U, 22006127U, 690324048U,
+        2433681202U, 3025681952U, 1267688542U, 724069014U, 4028562463U, 2047636588U, 1484149115U, 331492623U,
+        1663140081U, 1440034922U, 1369925838U, 3221243062U, 826254733U, 3670969380U, 1522142990U, 2784278746U,
+        2455543210U, 1031113440U, 2069072955U, 2980251354U, 2529060651U, 3058689324U, 3523345109U, 3749769494U,
+        3406670150U, 2004724472U, 1371026421U, 1792502396U, 183648905U, 2034485275U, 3682753404U, 381882749U,
+        488042251U, 3635243795U, 250522149U, 1706913947U, 894938568U, 1187677690U, 1729364362U, 2814950446U,
+        790117699U, 2133086657U, 3061574671U, 299421362U, 2774295368U, 297352325U, 409201525U, 1301575887U,
+        1322083772U, 2659281667U, 1268279111U, 2692915077U, 4180423174U, 3608948669U, 1377400726U, 943402850U,
+        634687363U, 2899357562U, 369680007U, 809476048U, 2282678624U, 431055653U, 917744815U, 348337139U,
+        3191812854U, 1830802780U, 3249028897U, 1082065584U, 973355580U, 3199328514U, 1408224559U, 1313624589U,
+        2859434818U, 3384019594U, 371321081U, 2267050510U, 1811659175U, 1275181181U, 1481656003U, 193680505U,
+        4008097456U, 2502169544U, 3803346441U, 230046182U, 895638275U, 642793578U, 1086839901U, 889019807U,
+        1030223610U, 3522163135U, 1656681140U, 1405616766U, 3882599375U, 2783158933U, 2320772738U, 3213284286U,
+        3082405445U, 468758355U, 1915715517U, 1615435340U, 2604237599U, 3588828715U, 3005336464U, 218882590U,
+        1023645601U, 2956872852U, 1027533828U, 2651384330U, 3220485997U, 3267841135U, 2731755558U, 4072198463U,
+        1286571081U, 951829105U, 3398648304U, 792713634U, 396164996U, 2811932536U, 1061354732U, 1890189601U,
+        333440044U, 1208012119U, 3467303890U, 3993706135U, 3624619056U, 4221892065U, 2720376656U, 981562990U,
+        3528669603U, 824075675U, 977820611U, 1484004457U, 4153553060U, 1141893181U, 4043005753U, 2250986127U,
+        2807025431U, 2079054808U, 3841369107U, 3155585986U, 1506200692U, 405370125U, 2748589190U, 1996469726U,
+        198140603U, 2506501600U, 198975635U, 4021487581U, 2398536842U, 2318334552U, 3732548301U, 3028045539U,
+        480020392U, 4090654887U, 3342451737U, 1005602392U, 391326386U, 3498967654U, 270893210U, 0U,
+    },
+    {
+        2324019099U, 1326097872U, 2834290817U, 3288483208U, 989094270U, 4077861202U, 2462579503U, 104427085U,
+        256635984U, 3887042567U, 3487975865U, 328027385U, 1971430245U, 2779715392U, 1942563743U, 101379599U,
+        3390568046U, 3783703057U, 3083967367U, 1769317655U, 1552128709U, 1417486976U, 86236769U, 4286497744U,
+        3489271189U, 316758099U, 3472163618U, 395586937U, 320311666U, 2645860954U, 922669176U, 1934511577U,
+        599309953U, 3539834921U, 2442031863U, 2812499117U, 1570315831U, 1090076542U, 212255465U, 36692535U,
+        2302997523U, 584396854U, 2713272510U, 831749936U, 2601330102U, 4107120147U, 3055550044U, 2747070180U,
+        2757699901U, 2461131821U, 2455334291U, 1763027551U, 1156072417U, 1157773737U, 133957898U, 143893704U,
+        4225359048U, 3070759515U, 1658807177U, 2252794259U, 2613238193U, 1542917062U, 1708097999U, 2166296029U,
+        1663659277U, 1023652534U, 2140633428U, 2605166770U, 1331942135U, 376431508U, 2747805301U, 1171284256U,
+        848693170U, 565436271U, 1517772843U, 1467600049U, 4289581590U, 3737000562U, 1683761423U, 489413758U,
+        1589793337U, 198136028U, 2925629535U, 1228914040U, 576079797U, 1020456246U, 2069960827U, 1643354482U,
+        3805608821U, 2948061346U, 1167180233U, 1438962767U, 1669094667U, 951128057U, 40152471U, 1948756803U,
+        1485978017U, 2226264124U, 1642343075U, 261715624U, 3479991550U, 211317057U, 2445953821U, 3876791401U,
+        125294515U, 3664444926U, 773398497U, 1347193801U, 90540016U, 2414854366U, 3497826151U, 530357874U,
+        2742699571U, 2403992748U, 2933283328U, 3260058199U, 823590266U, 4172484765U, 1420116447U, 921316170U,
+        809117226U, 2024322647U, 2424728671U, 1441366702U, 2163577098U, 2363317325U, 2786286882U, 3614608525U,
+        762671642U, 857617083U, 1945401581U, 4124724112U, 1301357912U, 2163651483U, 3926917984U, 877820556U,
+        2145865904U, 4089499561U, 1049470019U, 3095932765U, 4224486329U, 319943413U, 1571716845U, 2289155114U,
+        2806644027U, 1972346599U, 2599002324U, 3039253801U, 4278616585U, 3323497587U, 3043012613U, 3565956859U,
+        2700856929U, 4155039796U, 1649886287U, 653151910U, 1515846446U, 781386804U, 2314155078U, 3092560524U,
+        2521249282U, 1818879760U, 1445892784U, 1707778225U, 3144745303U, 2545791815U, 1450786759U, 3316667693U,
+        1585266894U, 3594617986U, 489736046U, 4168933581U, 222759985U, 2720344405U, 4262176183U, 4224913732U,
+        2876870442U, 783627466U, 418541035U, 2112768279U, 2798377215U, 1354979346U, 4261238388U, 543509348U,
+        3703019991U, 80743676U, 2378457364U, 2536247867U, 4058953977U, 3205125576U, 355196158U, 1939978134U,
+        3988958390U, 3304457756U, 2808956303U, 2810738816U, 3783438952U, 1078295026U, 1537514391U, 1334326119U,
+        1348274934U, 2877494410U, 894139436U, 2482948139U, 295487918U, 169015270U, 3540858103U, 305652141U,
+        1702497185U, 1918650968U, 3164096490U, 1217132533U, 2374332522U, 2451951043U, 3865436534U, 3044100922U,
+        2090677061U, 1007766497U, 2384754490U, 2318621595U, 3142845233U, 964180372U, 3593800394U, 4184347675U,
+        2277816706U, 201527472U, 1133381115U, 93967296U, 1582011111U, 1777385163U, 646264050U, 1681329877U,
+        106977532U, 3477663142U, 298909716U, 3795119476U, 107301741U, 3435870222U, 2373706588U, 949911119U,
+        4289437251U, 1108937065U, 1865396901U, 3534140647U, 3172898111U, 3870222145U, 1888938315U, 822381277U,
+        1304210931U, 1554086853U, 4017443270U, 407732161U, 4063111215U, 1039182332U, 3742289672U, 1494277055U,
+        666718257U, 1436373118U, 1730450069U, 2112702859U, 2089345215U, 3610635726U, 2343828131U, 3503269260U,
+        1482836160U, 13408334U, 2828562429U, 2443007781U, 1884907276U, 400715933U, 3092357635U, 3489307301U,
+        3703112299U, 2991681909U, 199101233U, 2357572245U, 2533065095U, 232349663U, 2308144859U, 3867141356U,
+        3409009840U, 885499845U, 3692216027U, 1451574580U, 2343029468U, 1909432611U, 355119662U, 857928128U,
+        3785580985U, 2643041012U, 2794885253U, 2718164835U, 2062861885U, 3194128857U, 1459102365U, 1783459676U,
+        1777214151U, 1085656178U, 1333264499U, 3075203179U, 3577393917U, 2126886253U, 1896903409U, 4089427718U,
+        3254525880U, 2136988205U, 562994894U, 2653447909U, 2243921157U, 744573501U, 963881448U, 326283550U,
+        3693494669U, 2220321037U, 705998973U, 4034635492U, 522473392U, 923369715U, 3770574213U, 3670755543U,
+        774773379U, 2422927353U, 251650631U, 1469431908U, 3678769626U, 2201494888U, 3831969848U, 2089778748U,
+        3889238810U, 3501308847U, 2916511515U, 293690829U, 1963461355U, 3206214599U, 403689907U, 3824073171U,
+        2427949256U, 2550917296U, 166213827U, 2439418527U, 3873294197U, 1762731560U, 3781007064U, 2450658860U,
+        436636393U, 1819821262U, 2480147640U, 3065208134U, 3351745660U, 1834467673U, 1648200247U, 3960609011U,
+        998639882U, 3061076042U, 4131510336U, 1400603844U, 2701598652U, 1619424084U, 3966514296U, 2124262351U,
+        1825429477U, 3118307448U, 2482583207U, 1846697969U, 2556293378U, 3682738800U, 581513184U, 484718535U,
+        2414281573U, 2478372182U, 3029970330U, 3999209197U, 1417286445U, 4286873520U, 2425704154U, 4148193481U,
+        2206491149U, 1174769551U, 3948525981U, 2211793033U, 2334404030U, 1357303985U, 889357229U, 4044168328U,
+        4066719583U, 2767090958U, 4033337651U, 1254379154U, 390112470U, 3445405408U, 2436487114U, 1100605264U,
+        187619187U, 3928364322U, 3782505905U, 3586777104U, 2472861097U, 2314037622U, 3832912715U, 2136208875U,
+        3581235865U, 2286810679U, 3567186717U, 3267349830U, 3885521706U, 325570454U, 854906807U, 3148972222U,
+        990519370U, 3211870835U, 1667241925U, 1289068356U, 1426267281U, 999478616U, 145388027U, 2793785507U,
+        3959982741U, 3611180667U, 1022650914U, 1791660210U, 3219435971U, 2109273939U, 3107311496U, 1111959523U,
+        1051745283U, 2931480331U, 1964118415U, 2264747758U, 653021669U, 3261712886U, 412967946U, 347873574U,
+        1324526629U, 1985203350U, 1136620734U, 3036069453U, 55476905U, 3073758567U, 2182053988U, 3691105980U,
+        2569913938U, 2280110980U, 4183426578U, 920277592U, 1190192170U, 322642020U, 3170320754U, 1082763340U,
+        1882422848U, 2615131663U, 1548002904U, 3291836869U, 3889224213U, 220673106U, 2892729388U, 3418256364U,
+        1260175025U, 4200585595U, 3209336371U, 3150221437U, 136955517U, 3585208072U, 3579736972U, 1706582217U,
+        3558952829U, 3723893676U, 2492325554U, 2859531966U, 2515428553U, 3927636478U, 783867096U, 3877535313U,
+        1552069299U, 183570279U, 3994912108U, 97314243U, 1429378617U, 1351602540U, 2628684253U, 1044359510U,
+        3550814017U, 441592832U, 3870790938U, 4063464599U, 3163695795U, 3814180517U, 2433017885U, 121913134U,
+        1116626787U, 4157434662U, 1951579754U, 1483295430U, 2066477126U, 1560667373U, 3228788388U, 379210972U,
+        751883889U, 2886608099U, 297723239U, 3232440293U, 1350973516U, 119324381U, 813427066U, 1702289755U,
+        2559333212U, 3766594902U, 2864591283U, 442045435U, 4231284756U, 1319050826U, 2329246958U, 3253610U,
+        1718096628U, 3707126259U, 795638542U, 2706548521U, 1294228404U, 466625830U, 972449863U, 882733469U,
+        1640650160U, 364133468U, 4075762816U, 2637192345U, 3544830470U, 1998583300U, 3066915753U, 98938264U,
+        920892142U, 206855912U, 1313143297U, 396115929U, 849497860U, 216369210U, 3737669089U, 3328336046U,
+        2482833086U, 1064311094U, 3972829237U, 2697278448U, 2799443668U, 3431795556U, 1994986456U, 2470036518U,
+        3457453417U, 3642231644U, 54263245U, 3392763963U, 3431496741U, 4238999377U, 3245146913U, 342605272U,
+        3062139570U, 2745162503U, 1701495733U, 3289984707U, 3711451977U, 1847134424U, 657023227U, 860770992U,
+        1493574445U, 169038393U, 2760088351U, 389716909U, 1376789985U, 3434500175U, 3060289242U, 1294313379U,
+        3363489107U, 2477903924U, 2285839417U, 2399731510U, 3934718851U, 3482904772U, 3723634339U, 3777134828U,
+        463074621U, 672521150U, 1212550168U, 73919162U, 2012504150U, 3237205352U, 3716978991U, 3995054475U,
+        2139704832U, 2323715860U, 250482392U, 1761862713U, 3464334597U, 865537335U, 1853627400U, 4174167359U,
+        1136384461U, 4167833590U, 2941608550U, 3212868139U, 804695782U, 1661620156U, 921392519U, 814584521U,
+        3115596534U, 932308977U, 4268257141U, 2436701951U, 4056831034U, 365242514U, 2110175081U, 302555187U,
+        747529507U, 3654186905U, 3665831488U, 1465609988U, 4189009974U, 901519970U, 91535589U, 1771003150U,
+        3884430975U, 2868412516U, 1650593247U, 1868903223U, 847373317U, 2705665226U, 3140497414U, 0U,
+    },
+};
+
+
+#endif // ROCRAND_MT19937_PRECOMPUTED_H_
@@ -0,0 +1,484 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCRAND_RNG_SAMPLE_H_
+#define ROCRAND_RNG_SAMPLE_H_
+
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "permutation.hpp"
+
+// Samples of k distinct indices of [0, n) (rocrand_sample_without_replacement),
+// stored in increasing order. Keys are the keys of permutations (see
+// permutation.hpp), all work is done by kernels on the stream of the generator.
+//
+// Uniform samples with k <= sample_floyd_max_k: Floyd's algorithm in one
+// thread with a hash set in shared memory, then a bitonic sort of the block.
+//
+// Weighted samples and uniform samples with larger k: every index has a key,
+// the sample is the k smallest keys. Keys of weighted samples are
+// -log(u) / w (Efraimidis-Spirakis: exponential clocks with rate w), keys of
+// uniform samples are u, where u is the Philox hash of the index. Keys are
+// recomputed by every pass instead of being stored. The k-th smallest key is
+// found by radix selection (4 passes of 8 bits, histograms of blocks are
+// added to one histogram in device memory), then blocks store indices of
+// smaller keys and the first indices of keys equal to it.
+// Indices with non-positive weights have infinite keys and are selected
+// only when fewer than k weights are positive.
+
+namespace rocrand_host {
+namespace detail {
+
+    constexpr unsigned int sample_block_size = 256;
+    constexpr unsigned int sample_max_blocks = 1024;
+    constexpr unsigned int sample_floyd_max_k = 2048;
+    constexpr unsigned int sample_floyd_table_bits = 12;
+    constexpr unsigned int sample_empty = 0xFFFFFFFFU;
+
+    // Radix selection of the k-th smallest key and offsets of blocks,
+    // stored in device memory
+    struct sample_select_state
+    {
+        unsigned int histogram[256];
+        // Digits of the key found so far
+        unsigned int prefix;
+        // Keys equal to prefix which are selected (after the last pass)
+        unsigned int needed;
+    };
+
+    __forceinline__ __device__
+    unsigned int sample_key(const size_t index,
+                            const uint2 philox_key,
+                            const float * weights)
+    {
+        const uint4 hash = rocrand_philox4x32_10_hash(
+            rocrand_philox4x32_10_counter(0, index), philox_key
+        );
+        if(weights == NULL)
+            return hash.x;
+
+        const float weight = weights[index];
+        if(!(weight > 0.0f))
+            return 0x7F800000U; // +inf
+        union { float f; unsigned int u; } key;
+        key.f = -log(rocrand_device::detail::uniform_distribution(hash.x)) / weight;
+        return key.u;
+    }
+
+    __forceinline__ __device__
+    uint2 sample_philox_key(const unsigned int * keys)
+    {
+        return uint2 { keys[permutation_feistel_rounds], keys[permutation_feistel_rounds + 1] };
+    }
+
+    // Returns false if value is already in table
+    __forceinline__ __device__
+    bool sample_insert(unsigned int * table, const unsigned int value)
+    {
+        const unsigned int mask = (1U << sample_floyd_table_bits) - 1U;
+        unsigned int slot = (value * 2654435761U) >> (32 - sample_floyd_table_bits);
+        while(table[slot] != sample_empty)
+        {
+            if(table[slot] == value)
+                return false;
+            slot = (slot + 1) & mask;
+        }
+        table[slot] = value;
+        return true;
+    }
+
+    __global__
+    __launch_bounds__(sample_block_size)
+    void sample_floyd_kernel(unsigned int * output,
+                             const unsigned int k,
+                             const size_t n,
+                             const unsigned int * keys)
+    {
+        __shared__ unsigned int table[1U << sample_floyd_table_bits];
+        __shared__ unsigned int values[sample_floyd_max_k];
+
+        const unsigned int tid = hipThreadIdx_x;
+        for(unsigned int i = tid; i < (1U << sample_floyd_table_bits); i += sample_block_size)
+        {
+            table[i] = sample_empty;
+        }
+        unsigned int size = 1;
+        while(size < k)
+        {
+            size *= 2;
+        }
+        for(unsigned int i = k + tid; i < size; i += sample_block_size)
+        {
+            values[i] = sample_empty;
+        }
+        __syncthreads();
+
+        if(tid == 0)
+        {
+            permutation_source source(keys, 0);
+            unsigned int count = 0;
+            for(size_t j = n - k; j < n; j++)
+            {
+                const unsigned int t = source.bounded(static_cast<unsigned int>(j + 1));
+                const unsigned int value = sample_insert(table, t) ? t : static_cast<unsigned int>(j);
+                if(value != t)
+                {
+                    sample_insert(table, value);
+                }
+                values[count++] = value;
+            }
+        }
+        __syncthreads();
+
+        // Bitonic sort of size values
+        for(unsigned int width = 2; width <= size; width *= 2)
+        {
+            for(unsigned int stride = width / 2; stride > 0; stride /= 2)
+            {
+                for(unsigned int i = tid; i < size; i += sample_block_size)
+                {
+                    const unsigned int j = i ^ stride;
+                    if(j > i)
+                    {
+                        const bool ascending = (i & width) == 0;
+                        if((values[i] > values[j]) == ascending)
+                        {
+                            const unsigned int t = values[i];
+                            values[i] = values[j];
+                            values[j] = t;
+                        }
+                    }
+                }
+                __syncthreads();
+            }
+        }
+
+        for(unsigned int i = tid; i < k; i += sample_block_size)
+        {
+            output[i] = values[i];
+        }
+    }
+
+    __global__
+    __launch_bounds__(sample_block_size)
+    void sample_histogram_kernel(sample_select_state * state,
+                                 const size_t n,
+                                 const unsigned int * keys,
+                                 const float * weights,
+                                 const unsigned int shift)
+    {
+        __shared__ unsigned int histogram[256];
+
+        const unsigned int tid = hipThreadIdx_x;
+        histogram[tid] = 0;
+        __syncthreads();
+
+        const uint2 philox_key = sample_philox_key(keys);
+        // Digits above shift are already selected
+        const unsigned int mask = shift == 24 ? 0U : (0xFFFFFFFFU << (shift + 8));
+        const unsigned int prefix = state->prefix & mask;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+        for(size_t i = hipBlockIdx_x * hipBlockDim_x + tid; i < n; i += stride)
+        {
+            const unsigned int key = sample_key(i, philox_key, weights);
+            if((key & mask) == prefix)
+            {
+                atomicAdd(&histogram[(key >> shift) & 0xFF], 1U);
+            }
+        }
+        __syncthreads();
+
+        if(histogram[tid] > 0)
+        {
+            atomicAdd(&state->histogram[tid], histogram[tid]);
+        }
+    }
+
+    __global__
+    __launch_bounds__(sample_block_size)
+    void sample_init_kernel(sample_select_state * state, const unsigned int k)
+    {
+        const unsigned int tid = hipThreadIdx_x;
+        state->histogram[tid] = 0;
+        if(tid == 0)
+        {
+            state->prefix = 0;
+            state->needed = k;
+        }
+    }
+
+    // Selects the digit of the k-th smallest key and clears the histogram
+    __global__
+    __launch_bounds__(sample_block_size)
+    void sample_select_kernel(sample_select_state * state,
+                              const unsigned int shift)
+    {
+        const unsigned int tid = hipThreadIdx_x;
+        if(tid == 0)
+        {
+            unsigned int below = 0;
+            unsigned int digit = 0;
+            while(below + state->histogram[digit] < state->needed)
+            {
+                below += state->histogram[digit];
+                digit++;
+            }
+            state->prefix |= digit << shift;
+            state->needed -= below;
+        }
+        __syncthreads();
+        state->histogram[tid] = 0;
+    }
+
+    // Exclusive scan of values of threads of a block, total is the sum
+    __forceinline__ __device__
+    unsigned int sample_block_scan(const unsigned int value,
+                                   unsigned int * shared,
+                                   unsigned int& total)
+    {
+        const unsigned int tid = hipThreadIdx_x;
+        shared[tid] = value;
+        __syncthreads();
+        for(unsigned int offset = 1; offset < sample_block_size; offset *= 2)
+        {
+            const unsigned int other = tid >= offset ? shared[tid - offset] : 0;
+            __syncthreads();
+            shared[tid] += other;
+            __syncthreads();
+        }
+        const unsigned int result = shared[tid] - value;
+        total = shared[sample_block_size - 1];
+        __syncthreads();
+        return result;
+    }
+
+    // Block b processes indices [b * chunk, (b + 1) * chunk) in tiles of
+    // sample_block_size. With output == NULL blocks count keys smaller than
+    // and equal to the threshold (counts[2 * b], counts[2 * b + 1]),
+    // otherwise they store selected indices (counts are offsets of blocks:
+    // selected indices and equal keys of previous blocks).
+    __global__
+    __launch_bounds__(sample_block_size)
+    void sample_store_kernel(unsigned int * output,
+                             unsigned int * counts,
+                             const sample_select_state * state,
+                             const size_t n,
+                             const size_t chunk,
+                             const unsigned int * keys,
+                             const float * weights)
+    {
+        __shared__ unsigned int shared[sample_block_size];
+
+        const unsigned int tid = hipThreadIdx_x;
+        const uint2 philox_key = sample_philox_key(keys);
+        const unsigned int threshold = state->prefix;
+        const unsigned int needed = state->needed;
+        const size_t begin = hipBlockIdx_x * chunk;
+        const size_t end = begin + chunk < n ? begin + chunk : n;
+
+        unsigned int selected = output == NULL ? 0 : counts[2 * hipBlockIdx_x];
+        unsigned int equal = output == NULL ? 0 : counts[2 * hipBlockIdx_x + 1];
+        for(size_t tile = begin; tile < end; tile += sample_block_size)
+        {
+            const size_t i = tile + tid;
+            const unsigned int key = i < end ? sample_key(i, philox_key, weights) : 0xFFFFFFFFU;
+            const bool is_less = i < end && key < threshold;
+            const bool is_equal = i < end && key == threshold;
+
+            unsigned int equal_total;
+            const unsigned int equal_rank = equal + sample_block_scan(is_equal, shared, equal_total);
+            const bool is_selected = is_less || (is_equal && equal_rank < needed);
+            if(output == NULL)
+            {
+                unsigned int less_total;
+                sample_block_scan(is_less, shared, less_total);
+                selected += less_total;
+            }
+            else
+            {
+                unsigned int selected_total;
+                const unsigned int position = selected + sample_block_scan(is_selected, shared, selected_total);
+                if(is_selected)
+                {
+                    output[position] = static_cast<unsigned int>(i);
+                }
+                selected += selected_total;
+            }
+            equal += equal_total;
+        }
+
+        if(output == NULL && tid == 0)
+        {
+            counts[2 * hipBlockIdx_x] = selected;
+            counts[2 * hipBlockIdx_x + 1] = equal;
+        }
+    }
+
+    // Replaces counts of blocks with their offsets
+    __global__
+    __launch_bounds__(sample_block_size)
+    void sample_offsets_kernel(unsigned int * counts,
+                               const sample_select_state * state,
+                               const unsigned int blocks)
+    {
+        if(hipThreadIdx_x != 0)
+            return;
+
+        unsigned int selected = 0;
+        unsigned int equal = 0;
+        for(unsigned int b = 0; b < blocks; b++)
+        {
+            const unsigned int less = counts[2 * b];
+            const unsigned int block_equal = counts[2 * b + 1];
+            const unsigned int taken = state->needed > equal
+                ? min(state->needed - equal, block_equal)
+                : 0;
+            counts[2 * b] = selected;
+            counts[2 * b + 1] = equal;
+            selected += less + taken;
+            equal += block_equal;
+        }
+    }
+
+    inline rocrand_status sample_select(rocrand_generator_base_type * generator,
+                                        unsigned int * output,
+                                        const size_t k,
+                                        const size_t n,
+                                        const float * weights,
+                                        const unsigned int * keys,
+                                        hipStream_t stream)
+    {
+        const unsigned int blocks = static_cast<unsigned int>(std::min<size_t>(
+            (n + sample_block_size - 1) / sample_block_size, sample_max_blocks
+        ));
+        const size_t tiles = (n + sample_block_size - 1) / sample_block_size;
+        const size_t chunk = (tiles + blocks - 1) / blocks * sample_block_size;
+
+        const rocrand_host::detail::device_allocator& allocator = generator->allocator;
+        sample_select_state * state;
+        if(allocator.allocate(&state, 1, stream) != ROCRAND_STATUS_SUCCESS)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        unsigned int * counts;
+        if(allocator.allocate(&counts, 2 * blocks, stream) != ROCRAND_STATUS_SUCCESS)
+        {
+            allocator.deallocate(state, stream);
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(sample_init_kernel),
+            dim3(1), dim3(sample_block_size), 0, stream,
+            state, static_cast<unsigned int>(k)
+        );
+        generator->count_launch();
+        if(hipPeekAtLastError() != hipSuccess)
+            status = ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        for(int shift = 24; shift >= 0 && status == ROCRAND_STATUS_SUCCESS; shift -= 8)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(sample_histogram_kernel),
+                dim3(blocks), dim3(sample_block_size), 0, stream,
+                state, n, keys, weights, shift
+            );
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(sample_select_kernel),
+                dim3(1), dim3(sample_block_size), 0, stream,
+                state, shift
+            );
+            generator->count_launch();
+            generator->count_launch();
+            if(hipPeekAtLastError() != hipSuccess)
+                status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(sample_store_kernel),
+                dim3(blocks), dim3(sample_block_size), 0, stream,
+                NULL, counts, state, n, chunk, keys, weights
+            );
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(sample_offsets_kernel),
+                dim3(1), dim3(sample_block_size), 0, stream,
+                counts, state, blocks
+            );
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(sample_store_kernel),
+                dim3(blocks), dim3(sample_block_size), 0, stream,
+                output, counts, state, n, chunk, keys, weights
+            );
+            generator->count_launch();
+            generator->count_launch();
+            generator->count_launch();
+            if(hipPeekAtLastError() != hipSuccess)
+                status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        allocator.deallocate(counts, stream);
+        allocator.deallocate(state, stream);
+        return status;
+    }
+
+    template<class Generator>
+    inline rocrand_status sample_without_replacement(Generator * generator,
+                                                     unsigned int * output,
+                                                     const size_t k,
+                                                     const size_t n,
+                                                     const float * weights)
+    {
+        if(k == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        unsigned int * keys;
+        rocrand_status status = generate_permutation_keys(generator, &keys);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        hipStream_t stream = generator->get_stream();
+        if(weights == NULL && k <= sample_floyd_max_k)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(sample_floyd_kernel),
+                dim3(1), dim3(sample_block_size), 0, stream,
+                output, static_cast<unsigned int>(k), n, keys
+            );
+            generator->count_launch();
+            if(hipPeekAtLastError() != hipSuccess)
+                status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        else
+        {
+            status = sample_select(generator, output, k, n, weights, keys, stream);
+        }
+        generator->allocator.deallocate(keys, stream);
+        return status;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_SAMPLE_H_
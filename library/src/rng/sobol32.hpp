@@ -25,11 +25,14 @@
 #include <hip/hip_runtime.h>
 
 #include <rocrand.h>
-#include <rocrand_sobol_precomputed.h>
 
 #include "generator_type.hpp"
+#include "profiling.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "sobol_tables.hpp"
+#include "sobol_host_tables.hpp"
+#include "device_position.hpp"
 
 namespace rocrand_host {
 namespace detail {
@@ -39,8 +42,10 @@ namespace detail {
     template<class Type, class Distribution>
     __global__
     void generate_kernel(Type * data, const size_t n,
+                         const bool point_major,
                          const unsigned int * direction_vectors,
-                         const unsigned int offset,
+                         const unsigned long long offset,
+                         const unsigned long long * device_position,
                          Distribution distribution)
     {
         const unsigned int dimension = hipBlockIdx_y;
@@ -56,18 +61,110 @@ namespace detail {
         }
         __syncthreads();
 
-        sobol32_device_engine engine(vectors, offset + engine_id);
+        // Offset of the first point (capture-safe mode adds device_position),
+        // the sequence has 2^32 points, so offsets wrap around
+        const unsigned int first_point = static_cast<unsigned int>(offset + load_position(device_position));
+        sobol32_device_engine engine(vectors, first_point + engine_id);
 
-        const unsigned int start = dimension * n;
+        // Points of a dimension are contiguous in dimension-major ordering,
+        // dimensions of a point are contiguous in point-major ordering
+        const size_t start = point_major ? dimension : dimension * n;
+        const size_t step = point_major ? hipGridDim_y : 1;
         unsigned int index = engine_id;
         while(index < n)
         {
-            data[start + index] = distribution(engine.current());
+            data[start + index * step] = distribution(engine.current());
             engine.discard_stride(stride);
             index += stride;
         }
     }
 
+    // A block of the tiled kernel computes tiles of sobol_tile_points
+    // consecutive points of sobol_tile_dimensions dimensions
+    constexpr unsigned int sobol_tile_dimensions = 32;
+    constexpr unsigned int sobol_tile_points = 64;
+    constexpr unsigned int sobol_tile_block_size = 256;
+
+    // Used for many dimensions with few points, where blocks of generate_kernel
+    // (one dimension per block) are mostly idle, and for point-major ordering.
+    // Every thread computes a run of consecutive points of one dimension
+    // (one Gray code step per point), the tile is staged in shared memory
+    // and stored with consecutive threads writing consecutive elements
+    // in both orderings.
+    template<class Type, class Distribution>
+    __global__
+    __launch_bounds__(sobol_tile_block_size)
+    void generate_tiled_kernel(Type * data, const size_t n,
+                               const unsigned int dimensions,
+                               const bool point_major,
+                               const unsigned int * direction_vectors,
+                               const unsigned long long offset,
+                               const unsigned long long * device_position,
+                               Distribution distribution)
+    {
+        constexpr unsigned int runs = sobol_tile_block_size / sobol_tile_dimensions;
+        constexpr unsigned int run_points = sobol_tile_points / runs;
+
+        const unsigned int first_dimension = hipBlockIdx_y * sobol_tile_dimensions;
+        const unsigned int tile_dimensions = min(sobol_tile_dimensions, dimensions - first_dimension);
+
+        __shared__ unsigned int vectors[sobol_tile_dimensions * 32];
+        // Padded to avoid bank conflicts when threads of consecutive
+        // dimensions write their points
+        __shared__ Type tile[sobol_tile_dimensions][sobol_tile_points + 1];
+
+        for(unsigned int i = hipThreadIdx_x; i < tile_dimensions * 32; i += hipBlockDim_x)
+        {
+            vectors[i] = direction_vectors[first_dimension * 32 + i];
+        }
+        __syncthreads();
+
+        const unsigned int first_point = static_cast<unsigned int>(offset + load_position(device_position));
+        const unsigned int dimension = hipThreadIdx_x % sobol_tile_dimensions;
+        const unsigned int run_start = (hipThreadIdx_x / sobol_tile_dimensions) * run_points;
+
+        for(size_t tile_start = static_cast<size_t>(hipBlockIdx_x) * sobol_tile_points;
+            tile_start < n;
+            tile_start += static_cast<size_t>(hipGridDim_x) * sobol_tile_points)
+        {
+            const unsigned int tile_points =
+                static_cast<unsigned int>(min(n - tile_start, static_cast<size_t>(sobol_tile_points)));
+            if(dimension < tile_dimensions && run_start < tile_points)
+            {
+                // The sequence has 2^32 points, so offsets wrap around
+                sobol32_device_engine engine(
+                    vectors + dimension * 32,
+                    first_point + static_cast<unsigned int>(tile_start) + run_start
+                );
+                const unsigned int run_end = min(run_start + run_points, tile_points);
+                for(unsigned int p = run_start; p < run_end; p++)
+                {
+                    tile[dimension][p] = distribution(engine.current());
+                    engine.discard();
+                }
+            }
+            __syncthreads();
+
+            const unsigned int tile_size = tile_points * tile_dimensions;
+            for(unsigned int i = hipThreadIdx_x; i < tile_size; i += hipBlockDim_x)
+            {
+                if(point_major)
+                {
+                    const unsigned int p = i / tile_dimensions;
+                    const unsigned int d = i % tile_dimensions;
+                    data[(tile_start + p) * dimensions + first_dimension + d] = tile[d][p];
+                }
+                else
+                {
+                    const unsigned int d = i / tile_points;
+                    const unsigned int p = i % tile_points;
+                    data[(first_dimension + d) * n + tile_start + p] = tile[d][p];
+                }
+            }
+            __syncthreads();
+        }
+    }
+
 } // end namespace detail
 } // end namespace rocrand_host
 
@@ -81,25 +178,16 @@ public:
                     hipStream_t stream = 0)
         : base_type(0, offset, stream),
           m_initialized(false),
-          m_dimensions(1)
+          m_dimensions(1),
+          m_first_dimension(0),
+          m_partition_offset(0),
+          m_direction_vectors(rocrand_host::detail::get_valid_sobol_host_tables().sobol32_direction_vectors, 32,
+                              rocrand_host::detail::get_valid_sobol_host_tables().dimensions)
     {
-        // Allocate direction vectors
-        hipError_t error;
-        error = hipMalloc(&m_direction_vectors, sizeof(unsigned int) * SOBOL_N);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
-        }
-        error = hipMemcpy(m_direction_vectors, h_sobol32_direction_vectors, sizeof(unsigned int) * SOBOL_N, hipMemcpyHostToDevice);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_INTERNAL_ERROR;
-        }
     }
 
     ~rocrand_sobol32()
     {
-        hipFree(m_direction_vectors);
     }
 
     void reset()
@@ -107,6 +195,31 @@ public:
         m_initialized = false;
     }
 
+    /// In capture-safe mode the offset of the next point is stored in device
+    /// memory, so generations captured into a graph continue the sequence.
+    /// Tables of the current dimensions are copied to the device here.
+    rocrand_status set_capture_safe(bool capture_safe)
+    {
+        if(is_capturing())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(!capture_safe)
+        {
+            unsigned long long position;
+            status = m_device_position.disable(position, m_stream);
+            m_current_offset += position;
+            return status;
+        }
+
+        status = prepare_tables();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        return m_device_position.enable(allocator, m_stream);
+    }
+
     void set_offset(unsigned long long offset)
     {
         m_offset = offset;
@@ -119,15 +232,92 @@ public:
         m_initialized = false;
     }
 
+    /// Dimensions [first_dimension, first_dimension + dimensions) of
+    /// the sequence are generated, tables are checked when they are prepared.
+    void set_first_dimension(unsigned int first_dimension)
+    {
+        m_first_dimension = first_dimension;
+        m_initialized = false;
+    }
+
+    /// Points of \p rank are [rank * B, (rank + 1) * B) where B is 2^32 / \p nranks
+    /// (points of the sequence repeat after 2^32), the offset is added.
+    void set_subsequence_partition(unsigned int rank, unsigned int nranks)
+    {
+        m_partition_offset = rank * ((1ULL << 32) / nranks);
+        m_initialized = false;
+    }
+
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        m_order = order;
+        m_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns the number of bytes of device memory allocated by the generator,
+    /// including tables shared with other generators of the device.
+    size_t get_memory_usage() const
+    {
+        return m_direction_vectors.size_bytes()
+            + m_device_position.memory_usage()
+            + m_poisson.memory_usage();
+    }
+
+    /// Returns the number of bytes of a state saved by save_state(),
+    /// Sobol generators have no engines, only counters are saved.
+    size_t get_state_size() const
+    {
+        return rocrand_host::detail::get_state_size(0);
+    }
+
+    /// Saves offset, ordering, dimensions (with the first dimension) and the offset of the next point
+    /// to \p state, copies are enqueued to \p stream (in capture-safe mode
+    /// the position in device memory is copied by the device).
+    rocrand_status save_state(void * state, hipStream_t stream) const
+    {
+        rocrand_host::detail::generator_state_header header = make_state_header();
+        header.dimensions = m_dimensions;
+        header.first_dimension = m_first_dimension;
+        header.initialized = m_initialized ? 1 : 0;
+        header.position = m_current_offset;
+        return rocrand_host::detail::save_state(
+            state, header, m_device_position.get(), NULL, 0, stream
+        );
+    }
+
+    /// Restores a state saved by save_state(), the whole offset of the next
+    /// point is moved to the host and the position in device memory is reset.
+    rocrand_status load_state(const void * state, hipStream_t stream)
+    {
+        rocrand_host::detail::generator_state_header header;
+        rocrand_status status =
+            rocrand_host::detail::load_state_header(state, rng_type, header, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        restore_state_settings(header);
+        m_dimensions = header.dimensions;
+        m_first_dimension = header.first_dimension;
+        m_initialized = header.initialized != 0;
+        m_current_offset = header.position + header.device_position;
+        return m_device_position.reset(m_stream);
+    }
+
     rocrand_status init()
     {
         if (m_initialized)
             return ROCRAND_STATUS_SUCCESS;
+        ROCRAND_PROFILING_NAMED_RANGE("sobol32::init");
+        rocrand_host::detail::init_stats_scope init_scope(stats);
+        // The device offset would be reset on every launch of the graph
+        if (m_device_position.enabled() && is_capturing())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
 
-        m_current_offset = static_cast<unsigned int>(m_offset);
+        m_current_offset = m_partition_offset + m_offset;
         m_initialized = true;
 
-        return ROCRAND_STATUS_SUCCESS;
+        return m_device_position.reset(m_stream);
     }
 
     template<class T, class Distribution = uniform_distribution<T> >
@@ -141,35 +331,30 @@ public:
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
-        #ifdef __HIP_PLATFORM_NVCC__
-        const uint32_t threads = 64;
-        const uint32_t max_blocks = 4096;
-        #else
-        const uint32_t threads = 256;
-        const uint32_t max_blocks = 4096;
-        #endif
+        status = generate_at(m_current_offset, m_device_position.get(),
+                             data, data_size, distribution);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
 
-        const size_t size = data_size / m_dimensions;
-        const uint32_t blocks = std::min(max_blocks, static_cast<uint32_t>((size + threads - 1) / threads));
+        if (m_device_position.enabled())
+            return m_device_position.advance(data_size / m_dimensions, m_stream);
+        m_current_offset += data_size / m_dimensions;
 
-        // blocks_x must be power of 2 because strided discard (leap frog)
-        // supports only power of 2 jumps
-        const uint32_t blocks_x = next_power2((blocks + m_dimensions - 1) / m_dimensions);
-        const uint32_t blocks_y = m_dimensions;
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
-            data, size,
-            static_cast<const unsigned int*>(m_direction_vectors), m_current_offset,
-            distribution
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
 
-        m_current_offset += size;
+    /// Generates points [start, start + data_size / dimensions) of the sequence
+    /// returned by generate() after initialization without changing the state
+    /// of the generator.
+    rocrand_status generate_range(unsigned int * data,
+                                  unsigned long long start,
+                                  size_t data_size)
+    {
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
 
-        return ROCRAND_STATUS_SUCCESS;
+        uniform_distribution<unsigned int> udistribution;
+        return generate_at(m_partition_offset + m_offset + start, NULL, data, data_size, udistribution);
     }
 
     template<class T>
@@ -193,11 +378,32 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    // Each half value is generated from one number of the sequence
+    rocrand_status generate_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        normal_distribution<__half> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_log_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        log_normal_distribution<__half> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class IntType>
+    rocrand_status generate_uniform_int(IntType * data, size_t data_size,
+                                        IntType lo, IntType hi)
+    {
+        uniform_int_distribution<IntType> distribution(lo, hi);
+        return generate(data, data_size, distribution);
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
         {
-            m_poisson.set_lambda(lambda);
+            m_poisson.set_lambda(lambda, poisson_cache, allocator, m_stream, is_capturing());
         }
         catch(rocrand_status status)
         {
@@ -209,14 +415,96 @@ public:
 private:
     bool m_initialized;
     unsigned int m_dimensions;
-    unsigned int m_current_offset;
-    unsigned int * m_direction_vectors;
-
-    // For caching of Poisson for consecutive generations with the same lambda
+    // Index of the first generated dimension of the sequence
+    unsigned int m_first_dimension;
+    // First point of the partition set by set_subsequence_partition()
+    unsigned long long m_partition_offset;
+    unsigned long long m_current_offset;
+    // Added to m_current_offset in capture-safe mode
+    ::rocrand_host::detail::device_position m_device_position;
+    // Shared with other generators of the device, dimensions are copied
+    // to the device when they are used for the first time
+    ::rocrand_host::detail::sobol_device_table<unsigned int> m_direction_vectors;
+
+    // Cache of Poisson tables of recently used lambdas
     poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_poisson;
 
     // m_offset from base_type
 
+    template<class T, class Distribution>
+    rocrand_status generate_at(const unsigned long long offset,
+                               const unsigned long long * device_position,
+                               T * data, size_t data_size,
+                               const Distribution& distribution)
+    {
+        rocrand_status status = prepare_tables();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        #ifdef __HIP_PLATFORM_NVCC__
+        const uint32_t threads = 64;
+        const uint32_t max_blocks = 4096;
+        #else
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+        #endif
+
+        const size_t size = data_size / m_dimensions;
+        const uint32_t blocks = std::min(max_blocks, static_cast<uint32_t>((size + threads - 1) / threads));
+        const bool point_major = m_order == ROCRAND_ORDERING_QUASI_POINT_MAJOR;
+
+        // blocks_x must be power of 2 because strided discard (leap frog)
+        // supports only power of 2 jumps
+        const uint32_t blocks_x = next_power2((blocks + m_dimensions - 1) / m_dimensions);
+        const uint32_t blocks_y = m_dimensions;
+        // The tiled kernel is used when less than half of the threads
+        // of generate_kernel would have points, and for point-major
+        // ordering of several dimensions (strided stores otherwise)
+        const bool tiled = (point_major && m_dimensions > 1)
+            || size * 2 < static_cast<size_t>(blocks_x) * threads;
+        if(tiled)
+        {
+            const uint32_t tile_dimensions = ::rocrand_host::detail::sobol_tile_dimensions;
+            const uint32_t tile_points = ::rocrand_host::detail::sobol_tile_points;
+            const uint32_t tiles_y = (m_dimensions + tile_dimensions - 1) / tile_dimensions;
+            const size_t tiles_x = (size + tile_points - 1) / tile_points;
+            const uint32_t max_tiles_x = std::max(1U, max_blocks / tiles_y);
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_tiled_kernel),
+                dim3(static_cast<uint32_t>(std::min<size_t>(tiles_x, max_tiles_x)), tiles_y),
+                dim3(::rocrand_host::detail::sobol_tile_block_size), 0, m_stream,
+                data, size, m_dimensions, point_major,
+                m_direction_vectors.get() + static_cast<size_t>(m_first_dimension) * 32,
+                offset, device_position,
+                distribution
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+                dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
+                data, size, point_major,
+                m_direction_vectors.get() + static_cast<size_t>(m_first_dimension) * 32,
+                offset, device_position,
+                distribution
+            );
+        }
+        // Check kernel status
+        if(rocrand_host::detail::launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch(data_size);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Makes direction vectors of the current dimensions available
+    // to kernels launched to m_stream
+    rocrand_status prepare_tables()
+    {
+        return m_direction_vectors.prepare(m_first_dimension + m_dimensions, m_stream);
+    }
+
     size_t next_power2(size_t x)
     {
         size_t power = 1;
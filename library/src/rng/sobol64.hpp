@@ -0,0 +1,406 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SOBOL64_H_
+#define ROCRAND_RNG_SOBOL64_H_
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+#include "profiling.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+#include "sobol_tables.hpp"
+#include "sobol_host_tables.hpp"
+#include "device_position.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    typedef ::rocrand_device::sobol64_engine<true> sobol64_device_engine;
+
+    template<class Type, class Distribution>
+    __global__
+    void generate_kernel(Type * data, const size_t n,
+                         const bool point_major,
+                         const unsigned long long * direction_vectors,
+                         const unsigned long long offset,
+                         const unsigned long long * device_position,
+                         Distribution distribution)
+    {
+        const unsigned int dimension = hipBlockIdx_y;
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Each thread of the current block use the same direction vectors
+        // (the dimension is determined by hipBlockIdx_y)
+        __shared__ unsigned long long vectors[64];
+        if (hipThreadIdx_x < 64)
+        {
+            vectors[hipThreadIdx_x] = direction_vectors[dimension * 64 + hipThreadIdx_x];
+        }
+        __syncthreads();
+
+        // Offset of the first point (capture-safe mode adds device_position)
+        const unsigned long long first_point = offset + load_position(device_position);
+        sobol64_device_engine engine(vectors, first_point + engine_id);
+
+        // Points of a dimension are contiguous in dimension-major ordering,
+        // dimensions of a point are contiguous in point-major ordering
+        const size_t start = point_major ? dimension : dimension * n;
+        const size_t step = point_major ? hipGridDim_y : 1;
+        size_t index = engine_id;
+        while(index < n)
+        {
+            data[start + index * step] = distribution(engine.current());
+            engine.discard_stride(stride);
+            index += stride;
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_sobol64 : public rocrand_generator_type<ROCRAND_RNG_QUASI_SOBOL64>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_QUASI_SOBOL64>;
+    using engine_type = ::rocrand_host::detail::sobol64_device_engine;
+
+    rocrand_sobol64(unsigned long long offset = 0,
+                    hipStream_t stream = 0)
+        : base_type(0, offset, stream),
+          m_initialized(false),
+          m_dimensions(1),
+          m_first_dimension(0),
+          m_partition_offset(0),
+          m_direction_vectors(rocrand_host::detail::get_valid_sobol_host_tables().sobol64_direction_vectors, 64,
+                              rocrand_host::detail::get_valid_sobol_host_tables().dimensions)
+    {
+    }
+
+    ~rocrand_sobol64()
+    {
+    }
+
+    void reset()
+    {
+        m_initialized = false;
+    }
+
+    /// In capture-safe mode the offset of the next point is stored in device
+    /// memory, so generations captured into a graph continue the sequence.
+    /// Tables of the current dimensions are copied to the device here.
+    rocrand_status set_capture_safe(bool capture_safe)
+    {
+        if(is_capturing())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(!capture_safe)
+        {
+            unsigned long long position;
+            status = m_device_position.disable(position, m_stream);
+            m_current_offset += static_cast<unsigned long long>(position);
+            return status;
+        }
+
+        status = prepare_tables();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        return m_device_position.enable(allocator, m_stream);
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_initialized = false;
+    }
+
+    void set_dimensions(unsigned int dimensions)
+    {
+        m_dimensions = dimensions;
+        m_initialized = false;
+    }
+
+    /// Dimensions [first_dimension, first_dimension + dimensions) of
+    /// the sequence are generated, tables are checked when they are prepared.
+    void set_first_dimension(unsigned int first_dimension)
+    {
+        m_first_dimension = first_dimension;
+        m_initialized = false;
+    }
+
+    /// Points of \p rank are [rank * B, (rank + 1) * B) where B is
+    /// (2^64 - 1) / \p nranks, the offset is added.
+    void set_subsequence_partition(unsigned int rank, unsigned int nranks)
+    {
+        m_partition_offset = rank * (~0ULL / nranks);
+        m_initialized = false;
+    }
+
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        m_order = order;
+        m_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns the number of bytes of device memory allocated by the generator,
+    /// including tables shared with other generators of the device.
+    size_t get_memory_usage() const
+    {
+        return m_direction_vectors.size_bytes()
+            + m_device_position.memory_usage()
+            + m_poisson.memory_usage();
+    }
+
+    /// Returns the number of bytes of a state saved by save_state(),
+    /// Sobol generators have no engines, only counters are saved.
+    size_t get_state_size() const
+    {
+        return rocrand_host::detail::get_state_size(0);
+    }
+
+    /// Saves offset, ordering, dimensions (with the first dimension) and the offset of the next point
+    /// to \p state, copies are enqueued to \p stream (in capture-safe mode
+    /// the position in device memory is copied by the device).
+    rocrand_status save_state(void * state, hipStream_t stream) const
+    {
+        rocrand_host::detail::generator_state_header header = make_state_header();
+        header.dimensions = m_dimensions;
+        header.first_dimension = m_first_dimension;
+        header.initialized = m_initialized ? 1 : 0;
+        header.position = m_current_offset;
+        return rocrand_host::detail::save_state(
+            state, header, m_device_position.get(), NULL, 0, stream
+        );
+    }
+
+    /// Restores a state saved by save_state(), the whole offset of the next
+    /// point is moved to the host and the position in device memory is reset.
+    rocrand_status load_state(const void * state, hipStream_t stream)
+    {
+        rocrand_host::detail::generator_state_header header;
+        rocrand_status status =
+            rocrand_host::detail::load_state_header(state, rng_type, header, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        restore_state_settings(header);
+        m_dimensions = header.dimensions;
+        m_first_dimension = header.first_dimension;
+        m_initialized = header.initialized != 0;
+        m_current_offset = header.position + header.device_position;
+        return m_device_position.reset(m_stream);
+    }
+
+    rocrand_status init()
+    {
+        if (m_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+        ROCRAND_PROFILING_NAMED_RANGE("sobol64::init");
+        rocrand_host::detail::init_stats_scope init_scope(stats);
+        // The device offset would be reset on every launch of the graph
+        if (m_device_position.enabled() && is_capturing())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_current_offset = m_partition_offset + m_offset;
+        m_initialized = true;
+
+        return m_device_position.reset(m_stream);
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        status = generate_at(m_current_offset, m_device_position.get(),
+                             data, data_size, distribution);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        if (m_device_position.enabled())
+            return m_device_position.advance(data_size / m_dimensions, m_stream);
+        m_current_offset += data_size / m_dimensions;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Generates points [start, start + data_size / dimensions) of the sequence
+    /// returned by generate() after initialization without changing the state
+    /// of the generator.
+    rocrand_status generate_range(unsigned long long * data,
+                                  unsigned long long start,
+                                  size_t data_size)
+    {
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        uniform_distribution<unsigned long long> udistribution;
+        return generate_at(m_partition_offset + m_offset + start, NULL, data, data_size, udistribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    // Each half value is generated from one number of the sequence
+    rocrand_status generate_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        normal_distribution<__half> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_log_normal(__half * data, size_t data_size, float mean, float stddev)
+    {
+        log_normal_distribution<__half> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class IntType>
+    rocrand_status generate_uniform_int(IntType * data, size_t data_size,
+                                        IntType lo, IntType hi)
+    {
+        uniform_int_distribution<IntType> distribution(lo, hi);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda, poisson_cache, allocator, m_stream, is_capturing());
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+private:
+    bool m_initialized;
+    unsigned int m_dimensions;
+    // Index of the first generated dimension of the sequence
+    unsigned int m_first_dimension;
+    // First point of the partition set by set_subsequence_partition()
+    unsigned long long m_partition_offset;
+    unsigned long long m_current_offset;
+    // Added to m_current_offset in capture-safe mode
+    ::rocrand_host::detail::device_position m_device_position;
+    // Shared with other generators of the device, dimensions are copied
+    // to the device when they are used for the first time
+    ::rocrand_host::detail::sobol_device_table<unsigned long long> m_direction_vectors;
+
+    // Cache of Poisson tables of recently used lambdas
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_poisson;
+
+    // m_offset from base_type
+
+    template<class T, class Distribution>
+    rocrand_status generate_at(const unsigned long long offset,
+                               const unsigned long long * device_position,
+                               T * data, size_t data_size,
+                               const Distribution& distribution)
+    {
+        rocrand_status status = prepare_tables();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        #ifdef __HIP_PLATFORM_NVCC__
+        const uint32_t threads = 64;
+        const uint32_t max_blocks = 4096;
+        #else
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+        #endif
+
+        const size_t size = data_size / m_dimensions;
+        const uint32_t blocks = std::min(max_blocks, static_cast<uint32_t>((size + threads - 1) / threads));
+
+        // blocks_x must be power of 2 because strided discard (leap frog)
+        // supports only power of 2 jumps
+        const uint32_t blocks_x = next_power2((blocks + m_dimensions - 1) / m_dimensions);
+        const uint32_t blocks_y = m_dimensions;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+            dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
+            data, size, m_order == ROCRAND_ORDERING_QUASI_POINT_MAJOR,
+            m_direction_vectors.get() + static_cast<size_t>(m_first_dimension) * 64,
+            offset, device_position,
+            distribution
+        );
+        // Check kernel status
+        if(rocrand_host::detail::launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        count_launch(data_size);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Makes direction vectors of the current dimensions available
+    // to kernels launched to m_stream
+    rocrand_status prepare_tables()
+    {
+        return m_direction_vectors.prepare(m_first_dimension + m_dimensions, m_stream);
+    }
+
+    size_t next_power2(size_t x)
+    {
+        size_t power = 1;
+        while (power < x)
+        {
+            power *= 2;
+        }
+        return power;
+    }
+};
+
+#endif // ROCRAND_RNG_SOBOL64_H_
@@ -0,0 +1,81 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SOBOL_HOST_TABLES_H_
+#define ROCRAND_RNG_SOBOL_HOST_TABLES_H_
+
+#include <rocrand.h>
+
+// Host tables of Sobol generators (direction vectors and scramble constants).
+// They are defined in rocrand_sobol_tables.cpp only, so the large precomputed
+// headers are compiled once instead of in every translation unit using them.
+//
+// If the environment variable ROCRAND_SOBOL_TABLES is set to the path of a
+// file written by tools/sobol_direction_vector_generator (--binary), tables
+// are loaded from it when they are used for the first time; its number of
+// dimensions can exceed SOBOL_DIM. If the file cannot be loaded (missing,
+// truncated or not a tables file), status is ROCRAND_STATUS_INTERNAL_ERROR
+// and creation of Sobol generators fails (see get_valid_sobol_host_tables()),
+// other users of the tables get the embedded tables of SOBOL_DIM dimensions.
+
+namespace rocrand_host {
+namespace detail {
+
+    struct sobol_host_tables
+    {
+        unsigned int dimensions;
+        const unsigned int * sobol32_direction_vectors; // 32 per dimension
+        const unsigned long long int * sobol64_direction_vectors; // 64 per dimension
+        const unsigned int * scrambled_sobol32_constants; // 1 per dimension
+        const unsigned long long int * scrambled_sobol64_constants; // 1 per dimension
+        rocrand_status status; // Result of loading ROCRAND_SOBOL_TABLES
+    };
+
+    const sobol_host_tables& get_sobol_host_tables();
+
+    // Tables of Sobol generators, throws the status of loading
+    // ROCRAND_SOBOL_TABLES if the file is set but could not be loaded
+    inline const sobol_host_tables& get_valid_sobol_host_tables()
+    {
+        const sobol_host_tables& tables = get_sobol_host_tables();
+        if(tables.status != ROCRAND_STATUS_SUCCESS)
+        {
+            throw tables.status;
+        }
+        return tables;
+    }
+
+    // Dimensions supported by quasi-random generators of rng_type
+    inline unsigned int max_quasi_dimensions(rocrand_rng_type rng_type)
+    {
+        if(rng_type == ROCRAND_RNG_QUASI_SOBOL32
+            || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+            || rng_type == ROCRAND_RNG_QUASI_SOBOL64
+            || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+        {
+            return get_sobol_host_tables().dimensions;
+        }
+        return 20000;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_SOBOL_HOST_TABLES_H_
@@ -0,0 +1,212 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SOBOL_TABLES_H_
+#define ROCRAND_RNG_SOBOL_TABLES_H_
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "allocator.hpp"
+#include "profiling.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Device copy of a precomputed table of Sobol generators (direction vectors
+// or scramble constants, or parameters of MTGP32 engines with one "dimension"
+// per engine) shared by all generators of the same device.
+//
+// The table is allocated by the default allocator when the first generator
+// using it on a device is created and freed with the last one. Values of dimensions are copied
+// to the device asynchronously when a generator uses them for the first
+// time (see prepare()), so generators with few dimensions do not wait
+// for the whole table.
+template<class T>
+class sobol_device_table
+{
+public:
+    // host_table contains dimension_size values for each of dimensions
+    // dimensions.
+    sobol_device_table(const T * host_table,
+                       const size_t dimension_size,
+                       const unsigned int dimensions)
+        : m_host_table(host_table),
+          m_dimension_size(dimension_size),
+          m_dimensions(dimensions),
+          m_prepared_dimensions(0),
+          m_prepared_stream(0)
+    {
+        if(hipGetDevice(&m_device_id) != hipSuccess)
+        {
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        ROCRAND_PROFILING_NAMED_RANGE("sobol_device_table::prepare", static_cast<size_t>(dimensions));
+        std::lock_guard<std::mutex> lock(get_mutex());
+        entry& e = get_entries()[key()];
+        if(e.references == 0)
+        {
+            e.allocator = get_default_allocator();
+            // The table is used on streams of all generators of the device
+            if(e.allocator.allocate(&e.data, m_dimension_size * m_dimensions) != ROCRAND_STATUS_SUCCESS
+                || hipStreamSynchronize(0) != hipSuccess)
+            {
+                e.allocator.deallocate(e.data);
+                get_entries().erase(key());
+                throw ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            if(hipEventCreateWithFlags(&e.uploaded_event, hipEventDisableTiming) != hipSuccess)
+            {
+                e.allocator.deallocate(e.data);
+                get_entries().erase(key());
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            e.uploaded_dimensions = 0;
+        }
+        e.references++;
+        m_data = e.data;
+    }
+
+    ~sobol_device_table()
+    {
+        std::lock_guard<std::mutex> lock(get_mutex());
+        auto it = get_entries().find(key());
+        if(it != get_entries().end() && --it->second.references == 0)
+        {
+            hipEventDestroy(it->second.uploaded_event);
+            // Kernels of other streams can still use the table
+            hipDeviceSynchronize();
+            it->second.allocator.deallocate(it->second.data);
+            get_entries().erase(it);
+        }
+    }
+
+    sobol_device_table(const sobol_device_table&) = delete;
+    sobol_device_table& operator=(const sobol_device_table&) = delete;
+
+    const T * get() const
+    {
+        return m_data;
+    }
+
+    // Size of the device table (shared by all generators of the device)
+    size_t size_bytes() const
+    {
+        return sizeof(T) * m_dimension_size * m_dimensions;
+    }
+
+    // Makes the first dimensions of the table available to kernels
+    // launched to stream after this call.
+    rocrand_status prepare(const unsigned int dimensions, hipStream_t stream)
+    {
+        if(dimensions <= m_prepared_dimensions && stream == m_prepared_stream)
+            return ROCRAND_STATUS_SUCCESS;
+        if(dimensions > m_dimensions)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        // Copies and waits for other streams must be done before the stream
+        // is captured into a graph
+        hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+        if(hipStreamIsCapturing(stream, &capture) != hipSuccess
+            || capture != hipStreamCaptureStatusNone)
+        {
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        std::lock_guard<std::mutex> lock(get_mutex());
+        entry& e = get_entries()[key()];
+        // Values can be copied by other generators to other streams
+        if(e.uploaded_dimensions > 0
+            && hipStreamWaitEvent(stream, e.uploaded_event, 0) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(dimensions > e.uploaded_dimensions)
+        {
+            const size_t begin = m_dimension_size * e.uploaded_dimensions;
+            const size_t size = m_dimension_size * (dimensions - e.uploaded_dimensions);
+            if(hipMemcpyAsync(e.data + begin, m_host_table + begin, sizeof(T) * size,
+                              hipMemcpyHostToDevice, stream) != hipSuccess
+                || hipEventRecord(e.uploaded_event, stream) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            e.uploaded_dimensions = dimensions;
+        }
+        m_prepared_dimensions = stream == m_prepared_stream
+            ? std::max(m_prepared_dimensions, dimensions)
+            : dimensions;
+        m_prepared_stream = stream;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+private:
+    struct entry
+    {
+        T * data;
+        // The first uploaded_dimensions dimensions are copied to the device
+        // (or copies are enqueued before uploaded_event)
+        unsigned int uploaded_dimensions;
+        hipEvent_t uploaded_event;
+        size_t references;
+        device_allocator allocator;
+
+        entry() : data(NULL), uploaded_dimensions(0), uploaded_event(0), references(0) { }
+    };
+
+    typedef std::pair<int, const T *> key_type;
+
+    key_type key() const
+    {
+        return key_type(m_device_id, m_host_table);
+    }
+
+    static std::mutex& get_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::map<key_type, entry>& get_entries()
+    {
+        static std::map<key_type, entry> entries;
+        return entries;
+    }
+
+    const T * m_host_table;
+    size_t m_dimension_size;
+    unsigned int m_dimensions;
+    int m_device_id;
+    T * m_data;
+
+    // Dimensions available to kernels launched to m_prepared_stream
+    unsigned int m_prepared_dimensions;
+    hipStream_t m_prepared_stream;
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_SOBOL_TABLES_H_
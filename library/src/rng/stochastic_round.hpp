@@ -0,0 +1,190 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_STOCHASTIC_ROUND_H_
+#define ROCRAND_RNG_STOCHASTIC_ROUND_H_
+
+#include <algorithm>
+#include <math.h>
+
+#include <hip/hip_runtime.h>
+#include <hip/hip_fp16.h>
+#include <rocrand.h>
+
+#include "device_engines.hpp"
+
+// Conversions of floats with stochastic rounding (rocrand_stochastic_round_half,
+// rocrand_stochastic_round_bfloat16, rocrand_stochastic_round_int8): a value
+// between two representable values a < b is rounded to b with probability
+// (x - a) / (b - a). Random numbers are Philox hashes of groups of 4 values
+// (see rocrand_philox4x32_10_hash) with a key of 2 numbers of the generator,
+// so the input is read once and no random numbers are stored. Keys are
+// generated by the generator, which advances as by rocrand_generate().
+
+namespace rocrand_host {
+namespace detail {
+
+    constexpr unsigned int stochastic_round_block_size = 256;
+    constexpr unsigned int stochastic_round_max_blocks = 65536;
+
+    // u = (r >> 8) / 2^24 is exact, values have at most 24 significant bits,
+    // so P(u < fraction) = fraction
+    __forceinline__ __device__
+    bool stochastic_round_up(const float fraction, const unsigned int r)
+    {
+        return static_cast<float>(r >> 8) * 5.9604644775390625e-8f < fraction;
+    }
+
+    struct stochastic_round_half_op
+    {
+        typedef __half output_type;
+
+        __forceinline__ __device__
+        __half operator()(const float x, const unsigned int r) const
+        {
+            const float a = fabsf(x);
+            // Infinity, NaN and values beyond the largest half are rounded
+            // to nearest
+            if(!(a < 65504.0f))
+                return __float2half(x);
+            // Spacing of halfs around a (subnormal spacing below 2^-14)
+            int exponent;
+            frexpf(a, &exponent);
+            const float spacing = ldexpf(1.0f, max(exponent - 11, -24));
+            float lower = floorf(a / spacing) * spacing;
+            if(stochastic_round_up((a - lower) / spacing, r))
+                lower += spacing;
+            return __float2half(copysignf(lower, x));
+        }
+    };
+
+    // bfloat16 is the upper half of a float, adding 16 random bits before
+    // truncation rounds up with the probability of the lower bits
+    struct stochastic_round_bfloat16_op
+    {
+        typedef unsigned short output_type;
+
+        __forceinline__ __device__
+        unsigned short operator()(const float x, const unsigned int r) const
+        {
+            union { float f; unsigned int u; } bits;
+            bits.f = x;
+            if((bits.u & 0x7F800000U) == 0x7F800000U && (bits.u & 0x007FFFFFU) != 0)
+                return static_cast<unsigned short>((bits.u >> 16) | 0x0040U); // quiet NaN
+            if((bits.u & 0x7F800000U) == 0x7F800000U)
+                return static_cast<unsigned short>(bits.u >> 16);
+            return static_cast<unsigned short>((bits.u + (r >> 16)) >> 16);
+        }
+    };
+
+    // x / scale rounded to an integer of [-128, 127], NaN gives 0
+    struct stochastic_round_int8_op
+    {
+        typedef signed char output_type;
+        float scale;
+
+        __forceinline__ __device__
+        signed char operator()(const float x, const unsigned int r) const
+        {
+            const float y = fminf(fmaxf(x / scale, -128.0f), 127.0f);
+            if(y != y)
+                return 0;
+            const float lower = floorf(y);
+            const float value = stochastic_round_up(y - lower, r) ? lower + 1.0f : lower;
+            return static_cast<signed char>(value);
+        }
+    };
+
+    // One Philox hash per group of 4 values
+    template<class Op>
+    __global__
+    __launch_bounds__(stochastic_round_block_size)
+    void stochastic_round_kernel(const float * input,
+                                 typename Op::output_type * output,
+                                 const size_t n,
+                                 const unsigned int * keys,
+                                 const Op op)
+    {
+        const uint2 key = uint2 { keys[0], keys[1] };
+        const size_t groups = (n + 3) / 4;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+        for(size_t g = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; g < groups; g += stride)
+        {
+            const uint4 hash = rocrand_philox4x32_10_hash(
+                rocrand_philox4x32_10_counter(0, g), key
+            );
+            const unsigned int r[4] = { hash.x, hash.y, hash.z, hash.w };
+            const size_t begin = g * 4;
+            if(begin + 4 <= n)
+            {
+                for(unsigned int j = 0; j < 4; j++)
+                {
+                    output[begin + j] = op(input[begin + j], r[j]);
+                }
+            }
+            else
+            {
+                for(unsigned int j = 0; begin + j < n; j++)
+                {
+                    output[begin + j] = op(input[begin + j], r[j]);
+                }
+            }
+        }
+    }
+
+    template<class Generator, class Op>
+    inline rocrand_status stochastic_round(Generator * generator,
+                                           const float * input,
+                                           typename Op::output_type * output,
+                                           const size_t n,
+                                           const Op op)
+    {
+        if(n == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        hipStream_t stream = generator->get_stream();
+        unsigned int * keys;
+        if(generator->allocator.allocate(&keys, 2, stream) != ROCRAND_STATUS_SUCCESS)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        rocrand_status status = generator->generate(keys, 2);
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            const size_t groups = (n + 3) / 4;
+            const unsigned int blocks = static_cast<unsigned int>(std::min<size_t>(
+                (groups + stochastic_round_block_size - 1) / stochastic_round_block_size,
+                stochastic_round_max_blocks
+            ));
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(stochastic_round_kernel<Op>),
+                dim3(blocks), dim3(stochastic_round_block_size), 0, stream,
+                input, output, n, keys, op
+            );
+            generator->count_launch(n);
+            if(hipPeekAtLastError() != hipSuccess)
+                status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        generator->allocator.deallocate(keys, stream);
+        return status;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_STOCHASTIC_ROUND_H_
@@ -0,0 +1,162 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_STREAM_LEASES_H_
+#define ROCRAND_RNG_STREAM_LEASES_H_
+
+#include <atomic>
+#include <mutex>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Generators leased to streams by rocrand_acquire_stream_generator().
+    // Slot k holds the child forked with subsequence_id k, so every slot has
+    // its own deterministic substream; released children keep their state
+    // and are leased again without initialization. Slots are reserved
+    // lock-free, only the first lease of a slot (the fork) takes a lock.
+    class stream_leases
+    {
+    public:
+        static const unsigned int max_leases = 64;
+
+        stream_leases()
+        {
+            for(unsigned int k = 0; k < max_leases; k++)
+            {
+                m_states[k].store(slot_empty, std::memory_order_relaxed);
+                m_children[k].store(NULL, std::memory_order_relaxed);
+                m_events[k] = NULL;
+            }
+        }
+
+        ~stream_leases()
+        {
+            for(unsigned int k = 0; k < max_leases; k++)
+            {
+                rocrand_generator child = m_children[k].load(std::memory_order_relaxed);
+                if(child != NULL)
+                {
+                    (void)rocrand_destroy_generator(child);
+                }
+                if(m_events[k] != NULL)
+                {
+                    (void)hipEventDestroy(m_events[k]);
+                }
+            }
+        }
+
+        stream_leases(const stream_leases&) = delete;
+        stream_leases& operator=(const stream_leases&) = delete;
+
+        // Reserves the free slot with the lowest index, fork(k, child) creates
+        // the child of an empty slot. The child is moved to stream after the
+        // work of its previous lease.
+        template<class Fork, class SetStream>
+        rocrand_status acquire(hipStream_t stream,
+                               rocrand_generator& lease,
+                               Fork fork,
+                               SetStream set_stream)
+        {
+            for(unsigned int k = 0; k < max_leases; k++)
+            {
+                int state = m_states[k].load(std::memory_order_acquire);
+                if(state == slot_leased
+                    || !m_states[k].compare_exchange_strong(state, slot_leased,
+                                                            std::memory_order_acq_rel))
+                {
+                    continue;
+                }
+
+                rocrand_generator child = m_children[k].load(std::memory_order_relaxed);
+                if(state == slot_empty)
+                {
+                    std::lock_guard<std::mutex> lock(m_fork_mutex);
+                    child = NULL;
+                    rocrand_status status = fork(k, child);
+                    if(status == ROCRAND_STATUS_SUCCESS
+                        && hipEventCreateWithFlags(&m_events[k], hipEventDisableTiming) != hipSuccess)
+                    {
+                        status = ROCRAND_STATUS_INTERNAL_ERROR;
+                    }
+                    if(status != ROCRAND_STATUS_SUCCESS)
+                    {
+                        if(child != NULL)
+                        {
+                            (void)rocrand_destroy_generator(child);
+                        }
+                        m_states[k].store(slot_empty, std::memory_order_release);
+                        return status;
+                    }
+                    m_children[k].store(child, std::memory_order_release);
+                }
+                else if(hipStreamWaitEvent(stream, m_events[k], 0) != hipSuccess)
+                {
+                    m_states[k].store(slot_idle, std::memory_order_release);
+                    return ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+                set_stream(child, stream);
+                m_streams[k] = stream;
+                lease = child;
+                return ROCRAND_STATUS_SUCCESS;
+            }
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        // Returns the slot of lease, the next lease waits for work enqueued
+        // to the stream of this lease
+        rocrand_status release(rocrand_generator lease)
+        {
+            for(unsigned int k = 0; k < max_leases; k++)
+            {
+                if(m_children[k].load(std::memory_order_acquire) != lease
+                    || m_states[k].load(std::memory_order_acquire) != slot_leased)
+                {
+                    continue;
+                }
+                const bool recorded = hipEventRecord(m_events[k], m_streams[k]) == hipSuccess;
+                m_states[k].store(slot_idle, std::memory_order_release);
+                return recorded ? ROCRAND_STATUS_SUCCESS : ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+    private:
+        static const int slot_empty = 0;
+        static const int slot_leased = 1;
+        static const int slot_idle = 2;
+
+        std::atomic<int> m_states[max_leases];
+        // Set by the first lease of the slot, read by release() of any slot
+        std::atomic<rocrand_generator> m_children[max_leases];
+        // Written only by the owner of the slot (see m_states)
+        hipEvent_t m_events[max_leases];
+        hipStream_t m_streams[max_leases];
+        // Forks read engines of the parent, they are not concurrent
+        std::mutex m_fork_mutex;
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_STREAM_LEASES_H_
@@ -0,0 +1,467 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_TELEMETRY_H_
+#define ROCRAND_RNG_TELEMETRY_H_
+
+// Process-wide counters of device generators by generator type, returned by
+// rocrand_get_telemetry_stats() and reported to the callback of
+// rocrand_set_telemetry_callback() and to the JSON file of the environment
+// variable ROCRAND_TELEMETRY_FILE. They are collected by scopes of host API
+// calls, nested calls are counted once:
+//
+//   ROCRAND_TELEMETRY_SCOPE(generator, bytes, stream);  // generation
+//   ROCRAND_TELEMETRY_INIT_SCOPE(generator);            // initialization
+//
+// Counters are compiled only if the library is built with ENABLE_TELEMETRY
+// (ROCRAND_ENABLE_TELEMETRY is defined), otherwise the macros expand to
+// nothing.
+
+#ifdef ROCRAND_ENABLE_TELEMETRY
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Counters of one generator type, times in seconds
+    struct telemetry_counters
+    {
+        rocrand_rng_type rng_type;
+        unsigned long long calls;
+        unsigned long long samples;
+        unsigned long long bytes;
+        unsigned long long timed_calls;
+        unsigned long long timed_samples;
+        double kernel_time;
+        unsigned long long inits;
+        double init_time;
+        unsigned long long table_rebuilds;
+        double table_time;
+    };
+
+    // Events around a timed call whose kernels may not be completed yet
+    struct telemetry_timed_call
+    {
+        rocrand_rng_type rng_type;
+        unsigned long long samples;
+        hipEvent_t start;
+        hipEvent_t stop;
+    };
+
+    inline rocrand_telemetry_stats to_telemetry_stats(const telemetry_counters& counters)
+    {
+        rocrand_telemetry_stats stats;
+        stats.rng_type = counters.rng_type;
+        stats.calls = counters.calls;
+        stats.samples = counters.samples;
+        stats.bytes = counters.bytes;
+        stats.timed_calls = counters.timed_calls;
+        stats.kernel_time = counters.kernel_time * 1000.0;
+        stats.average_kernel_time = counters.timed_calls == 0
+            ? 0.0 : stats.kernel_time / counters.timed_calls;
+        stats.samples_per_second = counters.kernel_time <= 0.0
+            ? 0.0 : counters.timed_samples / counters.kernel_time;
+        stats.inits = counters.inits;
+        stats.init_time = counters.init_time * 1000.0;
+        stats.table_rebuilds = counters.table_rebuilds;
+        stats.table_time = counters.table_time * 1000.0;
+        return stats;
+    }
+
+    // Counters of all generator types. Every sample_rate-th generation call
+    // of the process is timed by events recorded to the generator's stream,
+    // they are queried (never waited for) by later calls, so the host is not
+    // synchronized with the device. Reports (the callback and the JSON file)
+    // are made by calls which end at least interval seconds after the
+    // previous report, the library starts no threads. Environment variables:
+    //   ROCRAND_TELEMETRY_SAMPLE_RATE - sample_rate (default 16, 0 disables timing)
+    //   ROCRAND_TELEMETRY_INTERVAL - interval in seconds (default 10)
+    //   ROCRAND_TELEMETRY_FILE - path of the JSON file, "%p" is replaced
+    //   by the process id, the file is also written at exit
+    class telemetry
+    {
+    public:
+        // Never destroyed: the JSON file is written at exit by an atexit
+        // function, events are not destroyed after the runtime is unloaded
+        static telemetry& instance()
+        {
+            static telemetry * const t = new telemetry();
+            return *t;
+        }
+
+        // Returns true and records the start event if the call is timed
+        bool start_timing(hipStream_t stream, hipEvent_t& start, hipEvent_t& stop)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if(m_sample_rate == 0 || m_calls_to_timing-- != 0)
+                    return false;
+                m_calls_to_timing = m_sample_rate - 1;
+                if(m_pending.size() >= max_pending_calls)
+                    return false;
+                if(!acquire_event(start))
+                    return false;
+                if(!acquire_event(stop))
+                {
+                    m_free_events.push_back(start);
+                    return false;
+                }
+            }
+            // Events of captured calls would be nodes of the graph
+            hipStreamCaptureStatus status = hipStreamCaptureStatusNone;
+            if(hipStreamIsCapturing(stream, &status) != hipSuccess
+                || status != hipStreamCaptureStatusNone
+                || hipEventRecord(start, stream) != hipSuccess)
+            {
+                // The stream can belong to another device than the events
+                hipEventDestroy(start);
+                hipEventDestroy(stop);
+                return false;
+            }
+            return true;
+        }
+
+        void add(const telemetry_counters& delta,
+                 const bool timed, hipStream_t stream, hipEvent_t start, hipEvent_t stop)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            telemetry_counters& counters = get_counters(delta.rng_type);
+            counters.calls += delta.calls;
+            counters.samples += delta.samples;
+            counters.bytes += delta.bytes;
+            counters.inits += delta.inits;
+            counters.init_time += delta.init_time;
+            counters.table_rebuilds += delta.table_rebuilds;
+            counters.table_time += delta.table_time;
+            if(timed)
+            {
+                if(hipEventRecord(stop, stream) == hipSuccess)
+                {
+                    const telemetry_timed_call call = { delta.rng_type, delta.samples, start, stop };
+                    m_pending.push_back(call);
+                }
+                else
+                {
+                    hipEventDestroy(start);
+                    hipEventDestroy(stop);
+                }
+            }
+            query_pending();
+            report(lock, false);
+        }
+
+        rocrand_status get_stats(const rocrand_rng_type rng_type, rocrand_telemetry_stats& stats)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            query_pending();
+            stats = to_telemetry_stats(get_counters(rng_type));
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        void set_callback(rocrand_telemetry_callback callback, void * user_data,
+                          const double interval)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_callback = callback;
+            m_user_data = user_data;
+            m_interval = interval;
+        }
+
+        // Writes the JSON file with completed timed calls, HIP is not used
+        void write_at_exit()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_callback = NULL;
+            report(lock, true);
+        }
+
+    private:
+        static constexpr size_t max_pending_calls = 64;
+
+        telemetry()
+            : m_sample_rate(get_env("ROCRAND_TELEMETRY_SAMPLE_RATE", 16)),
+              m_calls_to_timing(0),
+              m_interval(static_cast<double>(get_env("ROCRAND_TELEMETRY_INTERVAL", 10))),
+              m_last_report(std::chrono::steady_clock::now()),
+              m_callback(NULL), m_user_data(NULL)
+        {
+            const char * path = std::getenv("ROCRAND_TELEMETRY_FILE");
+            if(path != NULL)
+            {
+                m_path = path;
+                const size_t pid_pos = m_path.find("%p");
+                if(pid_pos != std::string::npos)
+                {
+#if !defined(_WIN32)
+                    m_path.replace(pid_pos, 2, std::to_string(getpid()));
+#endif
+                }
+            }
+            if(!m_path.empty())
+            {
+                std::atexit([]() { telemetry::instance().write_at_exit(); });
+            }
+        }
+
+        static unsigned int get_env(const char * name, const unsigned int default_value)
+        {
+            const char * value = std::getenv(name);
+            if(value == NULL || value[0] == '\0')
+                return default_value;
+            return static_cast<unsigned int>(std::strtoul(value, NULL, 10));
+        }
+
+        telemetry_counters& get_counters(const rocrand_rng_type rng_type)
+        {
+            for(telemetry_counters& counters : m_counters)
+            {
+                if(counters.rng_type == rng_type)
+                    return counters;
+            }
+            telemetry_counters counters = {};
+            counters.rng_type = rng_type;
+            m_counters.push_back(counters);
+            return m_counters.back();
+        }
+
+        bool acquire_event(hipEvent_t& event)
+        {
+            if(!m_free_events.empty())
+            {
+                event = m_free_events.back();
+                m_free_events.pop_back();
+                return true;
+            }
+            return hipEventCreate(&event) == hipSuccess;
+        }
+
+        // Adds times of completed timed calls
+        void query_pending()
+        {
+            size_t kept = 0;
+            for(size_t i = 0; i < m_pending.size(); i++)
+            {
+                const telemetry_timed_call& call = m_pending[i];
+                const hipError_t error = hipEventQuery(call.stop);
+                if(error == hipErrorNotReady)
+                {
+                    // Not an error of the application, it is not reported
+                    // by later checks of launches. Only this error is
+                    // cleared, earlier errors of the application are kept.
+                    if(hipPeekAtLastError() == hipErrorNotReady)
+                        hipGetLastError();
+                    m_pending[kept++] = call;
+                    continue;
+                }
+                float milliseconds = 0.0f;
+                if(error == hipSuccess
+                    && hipEventElapsedTime(&milliseconds, call.start, call.stop) == hipSuccess)
+                {
+                    telemetry_counters& counters = get_counters(call.rng_type);
+                    counters.timed_calls++;
+                    counters.timed_samples += call.samples;
+                    counters.kernel_time += milliseconds / 1000.0;
+                    m_free_events.push_back(call.start);
+                    m_free_events.push_back(call.stop);
+                }
+                else
+                {
+                    hipEventDestroy(call.start);
+                    hipEventDestroy(call.stop);
+                }
+            }
+            m_pending.resize(kept);
+        }
+
+        // Reports counters if the interval has passed (or always if forced),
+        // the callback is called and the file is written without the lock
+        void report(std::unique_lock<std::mutex>& lock, const bool force)
+        {
+            if(m_callback == NULL && m_path.empty())
+                return;
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            const std::chrono::duration<double> elapsed = now - m_last_report;
+            if(!force && elapsed.count() < m_interval)
+                return;
+            m_last_report = now;
+
+            std::vector<rocrand_telemetry_stats> stats;
+            for(const telemetry_counters& counters : m_counters)
+            {
+                stats.push_back(to_telemetry_stats(counters));
+            }
+            const rocrand_telemetry_callback callback = m_callback;
+            void * const user_data = m_user_data;
+            lock.unlock();
+
+            if(callback != NULL)
+            {
+                callback(stats.data(), stats.size(), user_data);
+            }
+            if(!m_path.empty())
+            {
+                std::lock_guard<std::mutex> file_lock(m_file_mutex);
+                write_json(stats);
+            }
+        }
+
+        // The file is replaced by a complete file, readers never see
+        // a partially written one
+        void write_json(const std::vector<rocrand_telemetry_stats>& stats)
+        {
+            const std::string tmp_path = m_path + ".tmp";
+            std::FILE * file = std::fopen(tmp_path.c_str(), "w");
+            if(file == NULL)
+                return;
+            std::fprintf(file, "{\n  \"version\": %d,\n  \"generators\": [", ROCRAND_VERSION);
+            for(size_t i = 0; i < stats.size(); i++)
+            {
+                const rocrand_telemetry_stats& s = stats[i];
+                std::fprintf(file,
+                    "%s\n    {\"type\": \"%s\", \"calls\": %llu, \"samples\": %llu, "
+                    "\"bytes\": %llu, \"timed_calls\": %llu, \"kernel_time_ms\": %.6f, "
+                    "\"average_kernel_time_ms\": %.6f, \"samples_per_second\": %.6e, "
+                    "\"inits\": %llu, \"init_time_ms\": %.6f, "
+                    "\"table_rebuilds\": %llu, \"table_time_ms\": %.6f}",
+                    i == 0 ? "" : ",", rng_type_name(s.rng_type), s.calls, s.samples,
+                    s.bytes, s.timed_calls, s.kernel_time,
+                    s.average_kernel_time, s.samples_per_second,
+                    s.inits, s.init_time,
+                    s.table_rebuilds, s.table_time);
+            }
+            std::fprintf(file, "\n  ]\n}\n");
+            if(std::fclose(file) != 0)
+            {
+                std::remove(tmp_path.c_str());
+                return;
+            }
+#if defined(_WIN32)
+            std::remove(m_path.c_str());
+#endif
+            std::rename(tmp_path.c_str(), m_path.c_str());
+        }
+
+        std::mutex m_mutex;
+        std::mutex m_file_mutex;
+        std::vector<telemetry_counters> m_counters;
+        std::vector<telemetry_timed_call> m_pending;
+        std::vector<hipEvent_t> m_free_events;
+        const unsigned int m_sample_rate;
+        unsigned int m_calls_to_timing;
+        double m_interval;
+        std::chrono::steady_clock::time_point m_last_report;
+        rocrand_telemetry_callback m_callback;
+        void * m_user_data;
+        std::string m_path;
+    };
+
+    // Adds counters of a host API call of a device generator: bytes of
+    // output and differences of the generator's counters of
+    // rocrand_get_generator_stats() (numbers, initializations, Poisson
+    // tables), which are updated by init() methods and kernels
+    class telemetry_scope
+    {
+    public:
+        telemetry_scope(const rocrand_generator_base_type * generator,
+                        const size_t bytes, hipStream_t stream,
+                        const bool generation = true)
+            : m_outer(depth()++ == 0 && !generator->host), m_generator(generator), m_bytes(bytes),
+              m_stream(stream), m_generation(generation), m_timed(false),
+              m_start(NULL), m_stop(NULL),
+              m_stats(generator->stats), m_poisson_cache(generator->poisson_cache)
+        {
+            if(m_outer && m_generation)
+            {
+                m_timed = telemetry::instance().start_timing(m_stream, m_start, m_stop);
+            }
+        }
+
+        ~telemetry_scope()
+        {
+            depth()--;
+            if(!m_outer)
+                return;
+            const generator_stats_state& stats = m_generator->stats;
+            const poisson_cache_state& poisson_cache = m_generator->poisson_cache;
+            telemetry_counters delta = {};
+            delta.rng_type = m_generator->rng_type;
+            delta.calls = m_generation ? 1 : 0;
+            delta.samples = stats.samples - m_stats.samples;
+            delta.bytes = m_bytes;
+            delta.inits = stats.inits - m_stats.inits;
+            delta.init_time = stats.init_time - m_stats.init_time;
+            delta.table_rebuilds = poisson_cache.misses - m_poisson_cache.misses;
+            delta.table_time = poisson_cache.build_time - m_poisson_cache.build_time;
+            telemetry::instance().add(delta, m_timed, m_stream, m_start, m_stop);
+        }
+
+        telemetry_scope(const telemetry_scope&) = delete;
+        telemetry_scope& operator=(const telemetry_scope&) = delete;
+
+    private:
+        static unsigned int& depth()
+        {
+            static thread_local unsigned int value = 0;
+            return value;
+        }
+
+        const bool m_outer;
+        const rocrand_generator_base_type * m_generator;
+        const size_t m_bytes;
+        hipStream_t m_stream;
+        const bool m_generation;
+        bool m_timed;
+        hipEvent_t m_start;
+        hipEvent_t m_stop;
+        const generator_stats_state m_stats;
+        const poisson_cache_state m_poisson_cache;
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#define ROCRAND_TELEMETRY_SCOPE(generator, bytes, stream) \
+    ::rocrand_host::detail::telemetry_scope rocrand_telemetry_scope_(generator, bytes, stream)
+#define ROCRAND_TELEMETRY_INIT_SCOPE(generator) \
+    ::rocrand_host::detail::telemetry_scope rocrand_telemetry_scope_(generator, 0, 0, false)
+
+#else // ROCRAND_ENABLE_TELEMETRY
+
+#define ROCRAND_TELEMETRY_SCOPE(generator, bytes, stream)
+#define ROCRAND_TELEMETRY_INIT_SCOPE(generator)
+
+#endif // ROCRAND_ENABLE_TELEMETRY
+
+#endif // ROCRAND_RNG_TELEMETRY_H_
@@ -21,10 +21,120 @@
 #include <hip/hip_runtime.h>
 
 #include "rng/generators.hpp"
+#include "rng/generator_core.hpp"
+#include "rng/generator_dispatch.hpp"
+#include "rng/host/generators.hpp"
+#include "rng/distribution/categorical.hpp"
+#include "rng/permutation.hpp"
+#include "rng/sample.hpp"
+#include "rng/stochastic_round.hpp"
+#include "rng/multi_device.hpp"
+#include "rng/host_output.hpp"
+#include "rng/managed_output.hpp"
+#include "rng/profiling.hpp"
+#include "rng/telemetry.hpp"
+#include "rng/precomputed_tables.hpp"
 
 #include <rocrand.h>
 #include <new>
 
+// Returns the stream of a device generator
+static hipStream_t
+generator_stream(rocrand_generator generator)
+{
+    if(generator->dispatch == NULL)
+    {
+        return 0;
+    }
+    return generator->dispatch->get_stream(generator);
+}
+
+// Output of device generators in managed memory is prefetched to the device
+// before generation and hints of rocrand_set_managed_memory_hints() are
+// applied when the generation is enqueued (at the end of the scope)
+#define ROCRAND_MANAGED_OUTPUT(generator, output, bytes)                           \
+    ::rocrand_host::detail::managed_output rocrand_managed_output_(                \
+        (generator)->host ? 0 : (generator)->managed_hints, output, bytes,        \
+        (generator)->host ? 0 : generator_stream(generator))
+
+// Keys of stochastic rounding are generated by device pseudo-random generators
+template<class Op>
+static rocrand_status
+stochastic_round(rocrand_generator generator,
+                 const float * input_data,
+                 typename Op::output_type * output_data, size_t n,
+                 const Op op)
+{
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return rocrand_host::detail::stochastic_round(
+            static_cast<rocrand_philox4x32_10 *>(generator), input_data, output_data, n, op
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return rocrand_host::detail::stochastic_round(
+            static_cast<rocrand_threefry4x32_20 *>(generator), input_data, output_data, n, op
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return rocrand_host::detail::stochastic_round(
+            static_cast<rocrand_threefry2x64_20 *>(generator), input_data, output_data, n, op
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return rocrand_host::detail::stochastic_round(
+            static_cast<rocrand_philox4x64_10 *>(generator), input_data, output_data, n, op
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return rocrand_host::detail::stochastic_round(
+            static_cast<rocrand_mrg32k3a *>(generator), input_data, output_data, n, op
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return rocrand_host::detail::stochastic_round(
+            static_cast<rocrand_xorwow *>(generator), input_data, output_data, n, op
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return rocrand_host::detail::stochastic_round(
+            static_cast<rocrand_xoshiro128pp *>(generator), input_data, output_data, n, op
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return rocrand_host::detail::stochastic_round(
+            static_cast<rocrand_pcg32 *>(generator), input_data, output_data, n, op
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return rocrand_host::detail::stochastic_round(
+            static_cast<rocrand_mtgp32 *>(generator), input_data, output_data, n, op
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return rocrand_host::detail::stochastic_round(
+            static_cast<rocrand_mt19937 *>(generator), input_data, output_data, n, op
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
 #if defined(__cplusplus)
 extern "C" {
 #endif /* __cplusplus */
@@ -32,29 +142,118 @@ extern "C" {
 rocrand_status ROCRANDAPI
 rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_type)
 {
+    ROCRAND_PROFILING_RANGE(rng_type);
+    try
+    {
+        if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_philox4x32_10>();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_threefry4x32_20>();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_threefry2x64_20>();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_philox4x64_10>();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_mrg32k3a>();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_XORWOW
+                    || rng_type == ROCRAND_RNG_PSEUDO_DEFAULT)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_xorwow>();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_xoshiro128pp>();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_pcg32>();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL32
+                    || rng_type == ROCRAND_RNG_QUASI_DEFAULT)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_sobol32>();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_scrambled_sobol32>();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_sobol64>();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_scrambled_sobol64>();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_LATTICE)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_lattice>();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_HALTON)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_halton>();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_mtgp32>();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+        {
+            *generator = rocrand_host::detail::new_generator<rocrand_mt19937>();
+        }
+        else
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_generator_host(rocrand_generator * generator, rocrand_rng_type rng_type)
+{
+    ROCRAND_PROFILING_RANGE(rng_type);
     try
     {
         if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
         {
-            *generator = new rocrand_philox4x32_10();
+            *generator = new rocrand_philox4x32_10_host();
         }
         else if(rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
         {
-            *generator = new rocrand_mrg32k3a();
+            *generator = new rocrand_mrg32k3a_host();
         }
         else if(rng_type == ROCRAND_RNG_PSEUDO_XORWOW
                     || rng_type == ROCRAND_RNG_PSEUDO_DEFAULT)
         {
-            *generator = new rocrand_xorwow();
+            *generator = new rocrand_xorwow_host();
         }
         else if(rng_type == ROCRAND_RNG_QUASI_SOBOL32
                     || rng_type == ROCRAND_RNG_QUASI_DEFAULT)
         {
-            *generator = new rocrand_sobol32();
+            *generator = new rocrand_sobol32_host();
         }
         else if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
         {
-            *generator = new rocrand_mtgp32();
+            *generator = new rocrand_mtgp32_host();
         }
         else
         {
@@ -75,6 +274,7 @@ rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_typ
 rocrand_status ROCRANDAPI
 rocrand_destroy_generator(rocrand_generator generator)
 {
+    ROCRAND_PROFILING_RANGE(generator);
     try
     {
         delete(generator);
@@ -90,174 +290,264 @@ rocrand_status ROCRANDAPI
 rocrand_generate(rocrand_generator generator,
                  unsigned int * output_data, size_t n)
 {
+    ROCRAND_PROFILING_RANGE(generator, n);
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(generator->host)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate(output_data, n);
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->generate(output_data, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+
+    const rocrand_host::detail::generator_dispatch * dispatch = generator->dispatch;
+    if(dispatch->generate == NULL)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate(output_data, n);
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    return dispatch->generate(generator, output_data, n);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_long_long(rocrand_generator generator,
+                           unsigned long long * output_data, size_t n)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate(output_data, n);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+
+    if(generator->host)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate(output_data, n);
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate(output_data, n);
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate(output_data, n);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_uniform(rocrand_generator generator,
-                         float * output_data, size_t n)
+rocrand_generate_range(rocrand_generator generator,
+                       unsigned int * output_data,
+                       unsigned long long start, size_t n)
 {
+    ROCRAND_PROFILING_RANGE(generator, n);
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    if(generator->host)
+    {
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->generate_range(output_data, start, n);
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
         rocrand_philox4x32_10 * philox4x32_10_generator =
             static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_uniform(output_data, n);
+        return philox4x32_10_generator->generate_range(output_data, start, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_range(output_data, start, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_range(output_data, start, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_range(output_data, start, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
         rocrand_mrg32k3a * mrg32k3a_generator =
             static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_uniform(output_data, n);
+        return mrg32k3a_generator->generate_range(output_data, start, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
         rocrand_xorwow * rocrand_xorwow_generator =
             static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+        return rocrand_xorwow_generator->generate_range(output_data, start, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_range(output_data, start, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_range(output_data, start, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
         rocrand_sobol32 * rocrand_sobol32_generator =
             static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+        return rocrand_sobol32_generator->generate_range(output_data, start, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_range(output_data, start, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+        // Can't skip ahead in MTGP32
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        // Can't skip ahead in MT19937
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_uniform_double(rocrand_generator generator,
-                                double * output_data, size_t n)
+rocrand_generate_long_long_range(rocrand_generator generator,
+                                 unsigned long long * output_data,
+                                 unsigned long long start, size_t n)
 {
+    ROCRAND_PROFILING_RANGE(generator, n);
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
-    {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_uniform(output_data, n);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    if(generator->host)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_uniform(output_data, n);
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_range(output_data, start, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_range(output_data, start, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_range(output_data, start, n);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_normal(rocrand_generator generator,
-                        float * output_data, size_t n,
-                        float mean, float stddev)
+rocrand_generate_uniform(rocrand_generator generator,
+                         float * output_data, size_t n)
 {
+    ROCRAND_PROFILING_RANGE(generator, n);
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(generator->host)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_normal(output_data, n,
-                                                        mean, stddev);
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->generate_uniform(output_data, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    return generator->dispatch->generate_uniform(generator, output_data, n);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double(rocrand_generator generator,
+                                double * output_data, size_t n)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_normal(output_data, n,
-                                                   mean, stddev);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+
+    if(generator->host)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->generate_uniform(output_data, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    return generator->dispatch->generate_uniform_double(generator, output_data, n);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal(rocrand_generator generator,
+                        float * output_data, size_t n,
+                        float mean, float stddev)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_normal(output_data, n,
-                                                          mean, stddev);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+
+    if(generator->host)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->generate_normal(output_data, n, mean, stddev);
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    return generator->dispatch->generate_normal(generator, output_data, n, mean, stddev);
 }
 
 rocrand_status ROCRANDAPI
@@ -265,359 +555,4740 @@ rocrand_generate_normal_double(rocrand_generator generator,
                                double * output_data, size_t n,
                                double mean, double stddev)
 {
+    ROCRAND_PROFILING_RANGE(generator, n);
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(generator->host)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_normal(output_data, n,
-                                                        mean, stddev);
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->generate_normal(output_data, n, mean, stddev);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    return generator->dispatch->generate_normal_double(generator, output_data, n, mean, stddev);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal(rocrand_generator generator,
+                            float * output_data, size_t n,
+                            float mean, float stddev)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_normal(output_data, n,
-                                                   mean, stddev);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+
+    if(generator->host)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->generate_log_normal(output_data, n, mean, stddev);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    return generator->dispatch->generate_log_normal(generator, output_data, n, mean, stddev);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_double(rocrand_generator generator,
+                                   double * output_data, size_t n,
+                                   double mean, double stddev)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_normal(output_data, n,
-                                                          mean, stddev);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+
+    if(generator->host)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->generate_log_normal(output_data, n, mean, stddev);
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    return generator->dispatch->generate_log_normal_double(generator, output_data, n, mean, stddev);
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_log_normal(rocrand_generator generator,
-                            float * output_data, size_t n,
-                            float mean, float stddev)
+rocrand_generate_uniform_half(rocrand_generator generator,
+                              __half * output_data, size_t n)
 {
+    ROCRAND_PROFILING_RANGE(generator, n);
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    if(generator->host)
+    {
+        // Half-precision generation is not supported by host generators
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    return generator->dispatch->generate_uniform_half(generator, output_data, n);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_half(rocrand_generator generator,
+                             __half * output_data, size_t n,
+                             float mean, float stddev)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->host)
+    {
+        // Half-precision generation is not supported by host generators
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    return generator->dispatch->generate_normal_half(generator, output_data, n, mean, stddev);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_half(rocrand_generator generator,
+                                 __half * output_data, size_t n,
+                                 float mean, float stddev)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->host)
+    {
+        // Half-precision generation is not supported by host generators
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    return generator->dispatch->generate_log_normal_half(generator, output_data, n, mean, stddev);
+}
+
+// Checks the layout of a pitched 2D array of rocrand_generate_*_2d()
+static rocrand_status
+validate_2d(size_t width, size_t pitch, size_t value_size)
+{
+    if(pitch < width * value_size || pitch % value_size != 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_2d(rocrand_generator generator,
+                    unsigned int * output_data, size_t width,
+                    size_t height, size_t pitch)
+{
+    ROCRAND_PROFILING_RANGE(generator, width * height);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    rocrand_status status = validate_2d(width, pitch, sizeof(unsigned int));
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, height * pitch);
+    ROCRAND_TELEMETRY_SCOPE(generator, height * pitch, generator_stream(generator));
+    if(!generator->host)
+    {
+        if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            rocrand_philox4x32_10 * philox4x32_10_generator =
+                static_cast<rocrand_philox4x32_10 *>(generator);
+            return philox4x32_10_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+        {
+            rocrand_threefry4x32_20 * threefry4x32_20_generator =
+                static_cast<rocrand_threefry4x32_20 *>(generator);
+            return threefry4x32_20_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        {
+            rocrand_threefry2x64_20 * threefry2x64_20_generator =
+                static_cast<rocrand_threefry2x64_20 *>(generator);
+            return threefry2x64_20_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            rocrand_philox4x64_10 * philox4x64_10_generator =
+                static_cast<rocrand_philox4x64_10 *>(generator);
+            return philox4x64_10_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            rocrand_xorwow * rocrand_xorwow_generator =
+                static_cast<rocrand_xorwow *>(generator);
+            return rocrand_xorwow_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+                static_cast<rocrand_xoshiro128pp *>(generator);
+            return rocrand_xoshiro128pp_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            rocrand_pcg32 * rocrand_pcg32_generator =
+                static_cast<rocrand_pcg32 *>(generator);
+            return rocrand_pcg32_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+    }
+
+    // Other generators generate rows one by one
+    return rocrand_host::detail::generate_rows(output_data, height, pitch,
+        [&](unsigned int * row)
+        {
+            return rocrand_generate(generator, row, width);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_2d(rocrand_generator generator,
+                            float * output_data, size_t width,
+                            size_t height, size_t pitch)
+{
+    ROCRAND_PROFILING_RANGE(generator, width * height);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    rocrand_status status = validate_2d(width, pitch, sizeof(float));
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, height * pitch);
+    ROCRAND_TELEMETRY_SCOPE(generator, height * pitch, generator_stream(generator));
+    if(!generator->host)
+    {
+        if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            rocrand_philox4x32_10 * philox4x32_10_generator =
+                static_cast<rocrand_philox4x32_10 *>(generator);
+            return philox4x32_10_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+        {
+            rocrand_threefry4x32_20 * threefry4x32_20_generator =
+                static_cast<rocrand_threefry4x32_20 *>(generator);
+            return threefry4x32_20_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        {
+            rocrand_threefry2x64_20 * threefry2x64_20_generator =
+                static_cast<rocrand_threefry2x64_20 *>(generator);
+            return threefry2x64_20_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            rocrand_philox4x64_10 * philox4x64_10_generator =
+                static_cast<rocrand_philox4x64_10 *>(generator);
+            return philox4x64_10_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            rocrand_xorwow * rocrand_xorwow_generator =
+                static_cast<rocrand_xorwow *>(generator);
+            return rocrand_xorwow_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+                static_cast<rocrand_xoshiro128pp *>(generator);
+            return rocrand_xoshiro128pp_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            rocrand_pcg32 * rocrand_pcg32_generator =
+                static_cast<rocrand_pcg32 *>(generator);
+            return rocrand_pcg32_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+    }
+
+    // Other generators generate rows one by one
+    return rocrand_host::detail::generate_rows(output_data, height, pitch,
+        [&](float * row)
+        {
+            return rocrand_generate_uniform(generator, row, width);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_2d(rocrand_generator generator,
+                                   double * output_data, size_t width,
+                                   size_t height, size_t pitch)
+{
+    ROCRAND_PROFILING_RANGE(generator, width * height);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    rocrand_status status = validate_2d(width, pitch, sizeof(double));
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, height * pitch);
+    ROCRAND_TELEMETRY_SCOPE(generator, height * pitch, generator_stream(generator));
+    if(!generator->host)
+    {
+        if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            rocrand_philox4x32_10 * philox4x32_10_generator =
+                static_cast<rocrand_philox4x32_10 *>(generator);
+            return philox4x32_10_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+        {
+            rocrand_threefry4x32_20 * threefry4x32_20_generator =
+                static_cast<rocrand_threefry4x32_20 *>(generator);
+            return threefry4x32_20_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        {
+            rocrand_threefry2x64_20 * threefry2x64_20_generator =
+                static_cast<rocrand_threefry2x64_20 *>(generator);
+            return threefry2x64_20_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            rocrand_philox4x64_10 * philox4x64_10_generator =
+                static_cast<rocrand_philox4x64_10 *>(generator);
+            return philox4x64_10_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            rocrand_xorwow * rocrand_xorwow_generator =
+                static_cast<rocrand_xorwow *>(generator);
+            return rocrand_xorwow_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+                static_cast<rocrand_xoshiro128pp *>(generator);
+            return rocrand_xoshiro128pp_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            rocrand_pcg32 * rocrand_pcg32_generator =
+                static_cast<rocrand_pcg32 *>(generator);
+            return rocrand_pcg32_generator->generate_uniform_2d(output_data, width, height, pitch);
+        }
+    }
+
+    // Other generators generate rows one by one
+    return rocrand_host::detail::generate_rows(output_data, height, pitch,
+        [&](double * row)
+        {
+            return rocrand_generate_uniform_double(generator, row, width);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_2d(rocrand_generator generator,
+                           float * output_data, size_t width,
+                           size_t height, size_t pitch,
+                           float mean, float stddev)
+{
+    ROCRAND_PROFILING_RANGE(generator, width * height);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    rocrand_status status = validate_2d(width, pitch, sizeof(float));
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, height * pitch);
+    ROCRAND_TELEMETRY_SCOPE(generator, height * pitch, generator_stream(generator));
+    if(!generator->host)
+    {
+        if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            rocrand_philox4x32_10 * philox4x32_10_generator =
+                static_cast<rocrand_philox4x32_10 *>(generator);
+            return philox4x32_10_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+        {
+            rocrand_threefry4x32_20 * threefry4x32_20_generator =
+                static_cast<rocrand_threefry4x32_20 *>(generator);
+            return threefry4x32_20_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        {
+            rocrand_threefry2x64_20 * threefry2x64_20_generator =
+                static_cast<rocrand_threefry2x64_20 *>(generator);
+            return threefry2x64_20_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            rocrand_philox4x64_10 * philox4x64_10_generator =
+                static_cast<rocrand_philox4x64_10 *>(generator);
+            return philox4x64_10_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            rocrand_xorwow * rocrand_xorwow_generator =
+                static_cast<rocrand_xorwow *>(generator);
+            return rocrand_xorwow_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+                static_cast<rocrand_xoshiro128pp *>(generator);
+            return rocrand_xoshiro128pp_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            rocrand_pcg32 * rocrand_pcg32_generator =
+                static_cast<rocrand_pcg32 *>(generator);
+            return rocrand_pcg32_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+    }
+
+    // Other generators generate rows one by one
+    return rocrand_host::detail::generate_rows(output_data, height, pitch,
+        [&](float * row)
+        {
+            return rocrand_generate_normal(generator, row, width, mean, stddev);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_2d(rocrand_generator generator,
+                                  double * output_data, size_t width,
+                                  size_t height, size_t pitch,
+                                  double mean, double stddev)
+{
+    ROCRAND_PROFILING_RANGE(generator, width * height);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    rocrand_status status = validate_2d(width, pitch, sizeof(double));
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, height * pitch);
+    ROCRAND_TELEMETRY_SCOPE(generator, height * pitch, generator_stream(generator));
+    if(!generator->host)
+    {
+        if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            rocrand_philox4x32_10 * philox4x32_10_generator =
+                static_cast<rocrand_philox4x32_10 *>(generator);
+            return philox4x32_10_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+        {
+            rocrand_threefry4x32_20 * threefry4x32_20_generator =
+                static_cast<rocrand_threefry4x32_20 *>(generator);
+            return threefry4x32_20_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        {
+            rocrand_threefry2x64_20 * threefry2x64_20_generator =
+                static_cast<rocrand_threefry2x64_20 *>(generator);
+            return threefry2x64_20_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            rocrand_philox4x64_10 * philox4x64_10_generator =
+                static_cast<rocrand_philox4x64_10 *>(generator);
+            return philox4x64_10_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            rocrand_xorwow * rocrand_xorwow_generator =
+                static_cast<rocrand_xorwow *>(generator);
+            return rocrand_xorwow_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+                static_cast<rocrand_xoshiro128pp *>(generator);
+            return rocrand_xoshiro128pp_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            rocrand_pcg32 * rocrand_pcg32_generator =
+                static_cast<rocrand_pcg32 *>(generator);
+            return rocrand_pcg32_generator->generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+    }
+
+    // Other generators generate rows one by one
+    return rocrand_host::detail::generate_rows(output_data, height, pitch,
+        [&](double * row)
+        {
+            return rocrand_generate_normal_double(generator, row, width, mean, stddev);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_2d(rocrand_generator generator,
+                               float * output_data, size_t width,
+                               size_t height, size_t pitch,
+                               float mean, float stddev)
+{
+    ROCRAND_PROFILING_RANGE(generator, width * height);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    rocrand_status status = validate_2d(width, pitch, sizeof(float));
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, height * pitch);
+    ROCRAND_TELEMETRY_SCOPE(generator, height * pitch, generator_stream(generator));
+    if(!generator->host)
+    {
+        if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            rocrand_philox4x32_10 * philox4x32_10_generator =
+                static_cast<rocrand_philox4x32_10 *>(generator);
+            return philox4x32_10_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+        {
+            rocrand_threefry4x32_20 * threefry4x32_20_generator =
+                static_cast<rocrand_threefry4x32_20 *>(generator);
+            return threefry4x32_20_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        {
+            rocrand_threefry2x64_20 * threefry2x64_20_generator =
+                static_cast<rocrand_threefry2x64_20 *>(generator);
+            return threefry2x64_20_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            rocrand_philox4x64_10 * philox4x64_10_generator =
+                static_cast<rocrand_philox4x64_10 *>(generator);
+            return philox4x64_10_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            rocrand_xorwow * rocrand_xorwow_generator =
+                static_cast<rocrand_xorwow *>(generator);
+            return rocrand_xorwow_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+                static_cast<rocrand_xoshiro128pp *>(generator);
+            return rocrand_xoshiro128pp_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            rocrand_pcg32 * rocrand_pcg32_generator =
+                static_cast<rocrand_pcg32 *>(generator);
+            return rocrand_pcg32_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+    }
+
+    // Other generators generate rows one by one
+    return rocrand_host::detail::generate_rows(output_data, height, pitch,
+        [&](float * row)
+        {
+            return rocrand_generate_log_normal(generator, row, width, mean, stddev);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_double_2d(rocrand_generator generator,
+                                      double * output_data, size_t width,
+                                      size_t height, size_t pitch,
+                                      double mean, double stddev)
+{
+    ROCRAND_PROFILING_RANGE(generator, width * height);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    rocrand_status status = validate_2d(width, pitch, sizeof(double));
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, height * pitch);
+    ROCRAND_TELEMETRY_SCOPE(generator, height * pitch, generator_stream(generator));
+    if(!generator->host)
+    {
+        if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            rocrand_philox4x32_10 * philox4x32_10_generator =
+                static_cast<rocrand_philox4x32_10 *>(generator);
+            return philox4x32_10_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+        {
+            rocrand_threefry4x32_20 * threefry4x32_20_generator =
+                static_cast<rocrand_threefry4x32_20 *>(generator);
+            return threefry4x32_20_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        {
+            rocrand_threefry2x64_20 * threefry2x64_20_generator =
+                static_cast<rocrand_threefry2x64_20 *>(generator);
+            return threefry2x64_20_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            rocrand_philox4x64_10 * philox4x64_10_generator =
+                static_cast<rocrand_philox4x64_10 *>(generator);
+            return philox4x64_10_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            rocrand_xorwow * rocrand_xorwow_generator =
+                static_cast<rocrand_xorwow *>(generator);
+            return rocrand_xorwow_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+                static_cast<rocrand_xoshiro128pp *>(generator);
+            return rocrand_xoshiro128pp_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            rocrand_pcg32 * rocrand_pcg32_generator =
+                static_cast<rocrand_pcg32 *>(generator);
+            return rocrand_pcg32_generator->generate_log_normal_2d(output_data, width, height, pitch, mean, stddev);
+        }
+    }
+
+    // Other generators generate rows one by one
+    return rocrand_host::detail::generate_rows(output_data, height, pitch,
+        [&](double * row)
+        {
+            return rocrand_generate_log_normal_double(generator, row, width, mean, stddev);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_ensemble(rocrand_generator generator,
+                          unsigned int * output_data,
+                          const unsigned long long * seeds,
+                          size_t k, size_t n)
+{
+    ROCRAND_PROFILING_RANGE(generator, k * n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    // Keys of rows are seeds of counter-based generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, k * n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, k * n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_uniform_ensemble(output_data, seeds, k, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_uniform_ensemble(output_data, seeds, k, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_uniform_ensemble(output_data, seeds, k, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_uniform_ensemble(output_data, seeds, k, n);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_ensemble(rocrand_generator generator,
+                                  float * output_data,
+                                  const unsigned long long * seeds,
+                                  size_t k, size_t n)
+{
+    ROCRAND_PROFILING_RANGE(generator, k * n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    // Keys of rows are seeds of counter-based generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, k * n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, k * n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_uniform_ensemble(output_data, seeds, k, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_uniform_ensemble(output_data, seeds, k, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_uniform_ensemble(output_data, seeds, k, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_uniform_ensemble(output_data, seeds, k, n);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_int(rocrand_generator generator,
+                             unsigned int * output_data, size_t n,
+                             unsigned int lo, unsigned int hi)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(lo >= hi)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice * rocrand_lattice_generator =
+            static_cast<rocrand_lattice *>(generator);
+        return rocrand_lattice_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton * rocrand_halton_generator =
+            static_cast<rocrand_halton *>(generator);
+        return rocrand_halton_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_long_long(rocrand_generator generator,
+                                   unsigned long long * output_data, size_t n,
+                                   unsigned long long lo, unsigned long long hi)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(lo >= hi)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_uniform_int(output_data, n, lo, hi);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson(rocrand_generator generator,
+                         unsigned int * output_data, size_t n,
+                         double lambda)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if (lambda <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->generate_poisson(output_data, n, lambda);
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_poisson(output_data, n,
+                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_poisson(output_data, n,
+                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_poisson(output_data, n,
+                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_poisson(output_data, n,
+                                                       lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_poisson(output_data, n,
+                                                    lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_poisson(output_data, n,
+                                                          lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_poisson(output_data, n,
+                                                          lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_poisson(output_data, n,
+                                                          lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_poisson(output_data, n,
+                                                           lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_poisson(output_data, n,
+                                                                     lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_poisson(output_data, n,
+                                                           lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_poisson(output_data, n,
+                                                                     lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice * rocrand_lattice_generator =
+            static_cast<rocrand_lattice *>(generator);
+        return rocrand_lattice_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton * rocrand_halton_generator =
+            static_cast<rocrand_halton *>(generator);
+        return rocrand_halton_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_poisson(output_data, n,
+                                                          lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_poisson(output_data, n,
+                                                           lambda);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson_array(rocrand_generator generator,
+                               unsigned int * output_data,
+                               const double * lambdas,
+                               size_t n)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    // Values draw variable counts of numbers, so generators whose threads
+    // draw together (MTGP32) or per dimension (quasi-random) are not supported
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)
+            ->generate_poisson(output_data, n, lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20 *>(generator)
+            ->generate_poisson(output_data, n, lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)
+            ->generate_poisson(output_data, n, lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)
+            ->generate_poisson(output_data, n, lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)
+            ->generate_poisson(output_data, n, lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)
+            ->generate_poisson(output_data, n, lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)
+            ->generate_poisson(output_data, n, lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)
+            ->generate_poisson(output_data, n, lambdas);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_binomial_array(rocrand_generator generator,
+                                unsigned int * output_data,
+                                const unsigned int * trials,
+                                const double * probabilities,
+                                size_t n)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    // Generators of rocrand_generate_poisson_array
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)
+            ->generate_binomial(output_data, n, trials, probabilities);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20 *>(generator)
+            ->generate_binomial(output_data, n, trials, probabilities);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)
+            ->generate_binomial(output_data, n, trials, probabilities);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)
+            ->generate_binomial(output_data, n, trials, probabilities);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)
+            ->generate_binomial(output_data, n, trials, probabilities);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)
+            ->generate_binomial(output_data, n, trials, probabilities);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)
+            ->generate_binomial(output_data, n, trials, probabilities);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)
+            ->generate_binomial(output_data, n, trials, probabilities);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_multinomial_array(rocrand_generator generator,
+                                   unsigned int * output_data,
+                                   const unsigned int * trials,
+                                   const double * probabilities,
+                                   unsigned int categories,
+                                   size_t n)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(categories == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Generators of rocrand_generate_poisson_array
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * categories * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * categories * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)
+            ->generate_multinomial(output_data, n, trials, probabilities, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20 *>(generator)
+            ->generate_multinomial(output_data, n, trials, probabilities, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)
+            ->generate_multinomial(output_data, n, trials, probabilities, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)
+            ->generate_multinomial(output_data, n, trials, probabilities, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)
+            ->generate_multinomial(output_data, n, trials, probabilities, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)
+            ->generate_multinomial(output_data, n, trials, probabilities, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)
+            ->generate_multinomial(output_data, n, trials, probabilities, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)
+            ->generate_multinomial(output_data, n, trials, probabilities, categories);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_gamma(rocrand_generator generator,
+                       float * output_data, size_t n,
+                       float shape, float scale)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(shape <= 0.0f || scale <= 0.0f)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Distributions with rejection of device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_gamma_double(rocrand_generator generator,
+                              double * output_data, size_t n,
+                              double shape, double scale)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(shape <= 0.0 || scale <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Distributions with rejection of device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_gamma(output_data, n, shape, scale);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_beta(rocrand_generator generator,
+                      float * output_data, size_t n,
+                      float alpha, float beta)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(alpha <= 0.0f || beta <= 0.0f)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Distributions with rejection of device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_beta_double(rocrand_generator generator,
+                             double * output_data, size_t n,
+                             double alpha, double beta)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(alpha <= 0.0 || beta <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Distributions with rejection of device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_beta(output_data, n, alpha, beta);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_exponential(rocrand_generator generator,
+                             float * output_data, size_t n,
+                             float lambda)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(lambda <= 0.0f)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Distributions with rejection of device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_exponential(output_data, n, lambda);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_exponential_double(rocrand_generator generator,
+                                    double * output_data, size_t n,
+                                    double lambda)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(lambda <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Distributions with rejection of device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_exponential(output_data, n, lambda);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_bernoulli_bits(rocrand_generator generator,
+                                unsigned int * output_data, size_t n_bits,
+                                double p)
+{
+    ROCRAND_PROFILING_RANGE(generator, n_bits);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(p >= 0.0 && p <= 1.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Distributions with rejection of device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, (n_bits + 31) / 32 * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, (n_bits + 31) / 32 * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal(rocrand_generator generator,
+                                  float * output_data, size_t n,
+                                  float mean, float stddev,
+                                  float a, float b)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    // Negated comparisons reject NaN
+    if(!(stddev > 0.0f) || !(a < b))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Distributions with rejection of device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal_double(rocrand_generator generator,
+                                         double * output_data, size_t n,
+                                         double mean, double stddev,
+                                         double a, double b)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    // Negated comparisons reject NaN
+    if(!(stddev > 0.0) || !(a < b))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Distributions with rejection of device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_truncated_normal(output_data, n, mean, stddev, a, b);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal(rocrand_generator generator,
+                                     float * output_data, size_t n,
+                                     unsigned int dimensions,
+                                     const float * mean,
+                                     const float * factor)
+{
+    ROCRAND_PROFILING_RANGE(generator, n * dimensions);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(dimensions == 0 || dimensions > ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Distributions with rejection of device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * dimensions * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * dimensions * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal_double(rocrand_generator generator,
+                                            double * output_data, size_t n,
+                                            unsigned int dimensions,
+                                            const double * mean,
+                                            const double * factor)
+{
+    ROCRAND_PROFILING_RANGE(generator, n * dimensions);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(dimensions == 0 || dimensions > ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Distributions with rejection of device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * dimensions * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * dimensions * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * rocrand_mt19937_generator =
+            static_cast<rocrand_mt19937 *>(generator);
+        return rocrand_mt19937_generator->generate_multivariate_normal(output_data, n, dimensions, mean, factor);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_categorical(rocrand_generator generator,
+                             unsigned int * output_data,
+                             const float * probabilities,
+                             size_t batch,
+                             unsigned int n_categories,
+                             size_t ld)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(n_categories == 0 || ld < n_categories)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        const rocrand_status status = host_generator->generate(output_data, batch);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        rocrand_host::detail::categorical_transform_host(
+            output_data, probabilities, batch, n_categories, ld
+        );
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, batch * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, batch * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return rocrand_host::detail::generate_categorical(
+            static_cast<rocrand_philox4x32_10 *>(generator),
+            output_data, probabilities, batch, n_categories, ld
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return rocrand_host::detail::generate_categorical(
+            static_cast<rocrand_threefry4x32_20 *>(generator),
+            output_data, probabilities, batch, n_categories, ld
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return rocrand_host::detail::generate_categorical(
+            static_cast<rocrand_threefry2x64_20 *>(generator),
+            output_data, probabilities, batch, n_categories, ld
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return rocrand_host::detail::generate_categorical(
+            static_cast<rocrand_philox4x64_10 *>(generator),
+            output_data, probabilities, batch, n_categories, ld
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return rocrand_host::detail::generate_categorical(
+            static_cast<rocrand_mrg32k3a *>(generator),
+            output_data, probabilities, batch, n_categories, ld
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return rocrand_host::detail::generate_categorical(
+            static_cast<rocrand_xorwow *>(generator),
+            output_data, probabilities, batch, n_categories, ld
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return rocrand_host::detail::generate_categorical(
+            static_cast<rocrand_xoshiro128pp *>(generator),
+            output_data, probabilities, batch, n_categories, ld
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return rocrand_host::detail::generate_categorical(
+            static_cast<rocrand_pcg32 *>(generator),
+            output_data, probabilities, batch, n_categories, ld
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return rocrand_host::detail::generate_categorical(
+            static_cast<rocrand_sobol32 *>(generator),
+            output_data, probabilities, batch, n_categories, ld
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return rocrand_host::detail::generate_categorical(
+            static_cast<rocrand_scrambled_sobol32 *>(generator),
+            output_data, probabilities, batch, n_categories, ld
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return rocrand_host::detail::generate_categorical(
+            static_cast<rocrand_mtgp32 *>(generator),
+            output_data, probabilities, batch, n_categories, ld
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return rocrand_host::detail::generate_categorical(
+            static_cast<rocrand_mt19937 *>(generator),
+            output_data, probabilities, batch, n_categories, ld
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_permutation(rocrand_generator generator,
+                             unsigned int * output_data, size_t n)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(n > 0xFFFFFFFFULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Keys are generated by device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, n * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, n * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return rocrand_host::detail::generate_permutation(
+            static_cast<rocrand_philox4x32_10 *>(generator), output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return rocrand_host::detail::generate_permutation(
+            static_cast<rocrand_threefry4x32_20 *>(generator), output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return rocrand_host::detail::generate_permutation(
+            static_cast<rocrand_threefry2x64_20 *>(generator), output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return rocrand_host::detail::generate_permutation(
+            static_cast<rocrand_philox4x64_10 *>(generator), output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return rocrand_host::detail::generate_permutation(
+            static_cast<rocrand_mrg32k3a *>(generator), output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return rocrand_host::detail::generate_permutation(
+            static_cast<rocrand_xorwow *>(generator), output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return rocrand_host::detail::generate_permutation(
+            static_cast<rocrand_xoshiro128pp *>(generator), output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return rocrand_host::detail::generate_permutation(
+            static_cast<rocrand_pcg32 *>(generator), output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return rocrand_host::detail::generate_permutation(
+            static_cast<rocrand_mtgp32 *>(generator), output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return rocrand_host::detail::generate_permutation(
+            static_cast<rocrand_mt19937 *>(generator), output_data, n
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_shuffle(rocrand_generator generator,
+                void * data, size_t n, size_t element_size)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(n > 0xFFFFFFFFULL || element_size == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Keys are generated by device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, data, n * element_size);
+    ROCRAND_TELEMETRY_SCOPE(generator, n * element_size, generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return rocrand_host::detail::shuffle(
+            static_cast<rocrand_philox4x32_10 *>(generator), data, n, element_size
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return rocrand_host::detail::shuffle(
+            static_cast<rocrand_threefry4x32_20 *>(generator), data, n, element_size
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return rocrand_host::detail::shuffle(
+            static_cast<rocrand_threefry2x64_20 *>(generator), data, n, element_size
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return rocrand_host::detail::shuffle(
+            static_cast<rocrand_philox4x64_10 *>(generator), data, n, element_size
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return rocrand_host::detail::shuffle(
+            static_cast<rocrand_mrg32k3a *>(generator), data, n, element_size
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return rocrand_host::detail::shuffle(
+            static_cast<rocrand_xorwow *>(generator), data, n, element_size
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return rocrand_host::detail::shuffle(
+            static_cast<rocrand_xoshiro128pp *>(generator), data, n, element_size
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return rocrand_host::detail::shuffle(
+            static_cast<rocrand_pcg32 *>(generator), data, n, element_size
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return rocrand_host::detail::shuffle(
+            static_cast<rocrand_mtgp32 *>(generator), data, n, element_size
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return rocrand_host::detail::shuffle(
+            static_cast<rocrand_mt19937 *>(generator), data, n, element_size
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_sample_without_replacement(rocrand_generator generator,
+                                   unsigned int * output_data,
+                                   size_t k, size_t n,
+                                   const float * weights)
+{
+    ROCRAND_PROFILING_RANGE(generator, k);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(k > n || n > 0xFFFFFFFFULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Keys are generated by device pseudo-random generators
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    ROCRAND_MANAGED_OUTPUT(generator, output_data, k * sizeof(*output_data));
+    ROCRAND_TELEMETRY_SCOPE(generator, k * sizeof(*output_data), generator_stream(generator));
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return rocrand_host::detail::sample_without_replacement(
+            static_cast<rocrand_philox4x32_10 *>(generator), output_data, k, n, weights
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return rocrand_host::detail::sample_without_replacement(
+            static_cast<rocrand_threefry4x32_20 *>(generator), output_data, k, n, weights
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return rocrand_host::detail::sample_without_replacement(
+            static_cast<rocrand_threefry2x64_20 *>(generator), output_data, k, n, weights
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return rocrand_host::detail::sample_without_replacement(
+            static_cast<rocrand_philox4x64_10 *>(generator), output_data, k, n, weights
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return rocrand_host::detail::sample_without_replacement(
+            static_cast<rocrand_mrg32k3a *>(generator), output_data, k, n, weights
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return rocrand_host::detail::sample_without_replacement(
+            static_cast<rocrand_xorwow *>(generator), output_data, k, n, weights
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return rocrand_host::detail::sample_without_replacement(
+            static_cast<rocrand_xoshiro128pp *>(generator), output_data, k, n, weights
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return rocrand_host::detail::sample_without_replacement(
+            static_cast<rocrand_pcg32 *>(generator), output_data, k, n, weights
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return rocrand_host::detail::sample_without_replacement(
+            static_cast<rocrand_mtgp32 *>(generator), output_data, k, n, weights
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return rocrand_host::detail::sample_without_replacement(
+            static_cast<rocrand_mt19937 *>(generator), output_data, k, n, weights
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_stochastic_round_half(rocrand_generator generator,
+                              const float * input_data,
+                              __half * output_data, size_t n)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    return stochastic_round(
+        generator, input_data, output_data, n,
+        rocrand_host::detail::stochastic_round_half_op()
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_stochastic_round_bfloat16(rocrand_generator generator,
+                                  const float * input_data,
+                                  unsigned short * output_data, size_t n)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    return stochastic_round(
+        generator, input_data, output_data, n,
+        rocrand_host::detail::stochastic_round_bfloat16_op()
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_stochastic_round_int8(rocrand_generator generator,
+                              const float * input_data,
+                              signed char * output_data, size_t n,
+                              float scale)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(scale > 0.0f))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    rocrand_host::detail::stochastic_round_int8_op op;
+    op.scale = scale;
+    return stochastic_round(generator, input_data, output_data, n, op);
+}
+
+// Generates one request of rocrand_generate_batch() with the generate
+// function of its distribution
+static rocrand_status
+generate_request(rocrand_generator generator,
+                 const rocrand_generate_request& request)
+{
+    switch(request.distribution)
+    {
+        case ROCRAND_DISTRIBUTION_UNIFORM_UINT:
+            return rocrand_generate(generator,
+                static_cast<unsigned int *>(request.output_data), request.n);
+        case ROCRAND_DISTRIBUTION_UNIFORM_FLOAT:
+            return rocrand_generate_uniform(generator,
+                static_cast<float *>(request.output_data), request.n);
+        case ROCRAND_DISTRIBUTION_UNIFORM_DOUBLE:
+            return rocrand_generate_uniform_double(generator,
+                static_cast<double *>(request.output_data), request.n);
+        case ROCRAND_DISTRIBUTION_NORMAL_FLOAT:
+            return rocrand_generate_normal(generator,
+                static_cast<float *>(request.output_data), request.n,
+                static_cast<float>(request.mean), static_cast<float>(request.stddev));
+        case ROCRAND_DISTRIBUTION_NORMAL_DOUBLE:
+            return rocrand_generate_normal_double(generator,
+                static_cast<double *>(request.output_data), request.n,
+                request.mean, request.stddev);
+        case ROCRAND_DISTRIBUTION_LOG_NORMAL_FLOAT:
+            return rocrand_generate_log_normal(generator,
+                static_cast<float *>(request.output_data), request.n,
+                static_cast<float>(request.mean), static_cast<float>(request.stddev));
+        case ROCRAND_DISTRIBUTION_LOG_NORMAL_DOUBLE:
+            return rocrand_generate_log_normal_double(generator,
+                static_cast<double *>(request.output_data), request.n,
+                request.mean, request.stddev);
+        case ROCRAND_DISTRIBUTION_POISSON:
+            return rocrand_generate_poisson(generator,
+                static_cast<unsigned int *>(request.output_data), request.n,
+                request.lambda);
+    }
+    return ROCRAND_STATUS_OUT_OF_RANGE;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_batch(rocrand_generator generator,
+                       const rocrand_generate_request * requests,
+                       size_t count)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(requests == NULL && count > 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(!generator->host)
+    {
+        if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+        {
+            rocrand_mrg32k3a * mrg32k3a_generator =
+                static_cast<rocrand_mrg32k3a *>(generator);
+            return mrg32k3a_generator->generate_batch(requests, count);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            rocrand_xorwow * rocrand_xorwow_generator =
+                static_cast<rocrand_xorwow *>(generator);
+            return rocrand_xorwow_generator->generate_batch(requests, count);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+                static_cast<rocrand_xoshiro128pp *>(generator);
+            return rocrand_xoshiro128pp_generator->generate_batch(requests, count);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            rocrand_pcg32 * rocrand_pcg32_generator =
+                static_cast<rocrand_pcg32 *>(generator);
+            return rocrand_pcg32_generator->generate_batch(requests, count);
+        }
+    }
+
+    // Other generators process requests one by one
+    for(size_t i = 0; i < count; i++)
+    {
+        rocrand_status status = generate_request(generator, requests[i]);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+// Returns the size of a value of a request
+static size_t
+distribution_value_size(const rocrand_distribution distribution)
+{
+    switch(distribution)
+    {
+        case ROCRAND_DISTRIBUTION_UNIFORM_UINT:
+        case ROCRAND_DISTRIBUTION_POISSON:
+            return sizeof(unsigned int);
+        case ROCRAND_DISTRIBUTION_UNIFORM_FLOAT:
+        case ROCRAND_DISTRIBUTION_NORMAL_FLOAT:
+        case ROCRAND_DISTRIBUTION_LOG_NORMAL_FLOAT:
+            return sizeof(float);
+        case ROCRAND_DISTRIBUTION_UNIFORM_DOUBLE:
+        case ROCRAND_DISTRIBUTION_NORMAL_DOUBLE:
+        case ROCRAND_DISTRIBUTION_LOG_NORMAL_DOUBLE:
+            return sizeof(double);
+    }
+    return 0;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_to_host(rocrand_generator generator,
+                         const rocrand_generate_request * request,
+                         size_t chunk_size)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(request == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    const size_t value_size = distribution_value_size(request->distribution);
+    if(value_size == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        return generate_request(generator, *request);
+    }
+
+    return rocrand_host::detail::generate_to_host(
+        request->output_data, request->n, value_size, chunk_size,
+        generator->allocator, generator_stream(generator),
+        [&](void * buffer, size_t count)
+        {
+            rocrand_generate_request chunk = *request;
+            chunk.output_data = buffer;
+            chunk.n = count;
+            return generate_request(generator, chunk);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_reserve_sequence(rocrand_generator generator, size_t n,
+                         unsigned long long * seed,
+                         unsigned long long * position)
+{
+    ROCRAND_PROFILING_RANGE(generator, n);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(seed == NULL || position == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(!generator->host && generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->reserve(n, *seed, *position);
+    }
+    else if(!generator->host && generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->reserve(n, *seed, *position);
+    }
+    else if(!generator->host && generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->reserve(n, *seed, *position);
+    }
+    else if(!generator->host && generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->reserve(n, *seed, *position);
+    }
+    // Engines of other generators are stored in the library
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_initialize_generator(rocrand_generator generator)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    ROCRAND_TELEMETRY_INIT_SCOPE(generator);
+
+    if(generator->host)
+    {
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->init();
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        return static_cast<rocrand_lattice *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        return static_cast<rocrand_halton *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937 *>(generator)->init();
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_capture_safe(rocrand_generator generator, int capture_safe)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_capture_safe(capture_safe != 0);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20 *>(generator)->set_capture_safe(capture_safe != 0);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->set_capture_safe(capture_safe != 0);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->set_capture_safe(capture_safe != 0);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->set_capture_safe(capture_safe != 0);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->set_capture_safe(capture_safe != 0);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->set_capture_safe(capture_safe != 0);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->set_capture_safe(capture_safe != 0);
+    }
+    // Engine states are in device memory, captured kernels update them
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A
+            || generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW
+            || generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+            || generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32
+            || generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32
+            || generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return rocrand_initialize_generator(generator);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_stream(rocrand_generator generator, hipStream_t stream)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->host)
+    {
+        // Host generators do not use streams
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        static_cast<rocrand_philox4x32_10 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        static_cast<rocrand_threefry4x32_20 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        static_cast<rocrand_threefry2x64_20 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        static_cast<rocrand_philox4x64_10 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        static_cast<rocrand_mrg32k3a *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        static_cast<rocrand_xoshiro128pp *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        static_cast<rocrand_pcg32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        static_cast<rocrand_sobol32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        static_cast<rocrand_scrambled_sobol32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        static_cast<rocrand_sobol64 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        static_cast<rocrand_scrambled_sobol64 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        static_cast<rocrand_lattice *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        static_cast<rocrand_halton *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        static_cast<rocrand_mtgp32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        static_cast<rocrand_mt19937 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_seed(rocrand_generator generator, unsigned long long seed)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->host)
+    {
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->set_seed(seed);
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        static_cast<rocrand_philox4x32_10 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        static_cast<rocrand_threefry4x32_20 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        static_cast<rocrand_threefry2x64_20 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        static_cast<rocrand_philox4x64_10 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        if(seed == 0ULL)
+        {
+            seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
+        }
+        static_cast<rocrand_mrg32k3a *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        static_cast<rocrand_xoshiro128pp *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        static_cast<rocrand_pcg32 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        static_cast<rocrand_mtgp32 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        static_cast<rocrand_mt19937 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        static_cast<rocrand_lattice *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        static_cast<rocrand_halton *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_prepare_seed(rocrand_generator generator, unsigned long long seed)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        // Counter-based, there is no state to initialize
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        // Counter-based, there is no state to initialize
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        // Counter-based, there is no state to initialize
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        // Counter-based, there is no state to initialize
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->prepare_seed(seed);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->prepare_seed(seed);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->prepare_seed(seed);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->prepare_seed(seed);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->prepare_seed(seed);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937 *>(generator)->prepare_seed(seed);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_offset(rocrand_generator generator, unsigned long long offset)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->host)
+    {
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->set_offset(offset);
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        static_cast<rocrand_philox4x32_10 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        static_cast<rocrand_threefry4x32_20 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        static_cast<rocrand_threefry2x64_20 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        static_cast<rocrand_philox4x64_10 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        static_cast<rocrand_mrg32k3a *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        static_cast<rocrand_xoshiro128pp *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        static_cast<rocrand_pcg32 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        static_cast<rocrand_sobol32 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        static_cast<rocrand_scrambled_sobol32 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        static_cast<rocrand_sobol64 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        static_cast<rocrand_scrambled_sobol64 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        static_cast<rocrand_lattice *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        static_cast<rocrand_halton *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        // Can't set offset for MTGP32
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        // Can't set offset for MT19937
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_ordering(rocrand_generator generator, rocrand_ordering order)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    bool quasi_order;
+    switch(order)
+    {
+        case ROCRAND_ORDERING_PSEUDO_BEST:
+        case ROCRAND_ORDERING_PSEUDO_DEFAULT:
+        case ROCRAND_ORDERING_PSEUDO_SEEDED:
+        case ROCRAND_ORDERING_PSEUDO_LEGACY:
+        case ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT:
+            quasi_order = false;
+            break;
+        case ROCRAND_ORDERING_QUASI_DEFAULT:
+        case ROCRAND_ORDERING_QUASI_POINT_MAJOR:
+            quasi_order = true;
+            break;
+        default:
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if(quasi_order != (generator->rng_type >= ROCRAND_RNG_QUASI_DEFAULT))
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    if(generator->host)
+    {
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->set_order(order);
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        return static_cast<rocrand_lattice *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        return static_cast<rocrand_halton *>(generator)->set_order(order);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_normal_method(rocrand_generator generator, rocrand_normal_method method)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(method != ROCRAND_NORMAL_METHOD_BOX_MULLER &&
+       method != ROCRAND_NORMAL_METHOD_ZIGGURAT &&
+       method != ROCRAND_NORMAL_METHOD_INVERSION)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20 *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->set_normal_method(method);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_math_mode(rocrand_generator generator, rocrand_math_mode mode)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(mode != ROCRAND_MATH_MODE_ACCURATE && mode != ROCRAND_MATH_MODE_FAST)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20 *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937 *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->set_math_mode(mode);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->set_math_mode(mode);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_double_resolution(rocrand_generator generator,
+                              rocrand_double_resolution resolution)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(resolution != ROCRAND_DOUBLE_RESOLUTION_DEFAULT
+        && resolution != ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT
+        && resolution != ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_double_resolution(resolution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20 *>(generator)->set_double_resolution(resolution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->set_double_resolution(resolution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->set_double_resolution(resolution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_double_resolution(resolution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_double_resolution(resolution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->set_double_resolution(resolution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->set_double_resolution(resolution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->set_double_resolution(resolution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937 *>(generator)->set_double_resolution(resolution);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_permutation_method(rocrand_generator generator,
+                               rocrand_permutation_method method)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(method != ROCRAND_PERMUTATION_METHOD_FEISTEL
+        && method != ROCRAND_PERMUTATION_METHOD_EXACT)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    generator->permutation_method = method;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_managed_memory_hints(rocrand_generator generator, unsigned int hints)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const unsigned int all_hints = ROCRAND_MANAGED_HINT_PREFETCH
+        | ROCRAND_MANAGED_HINT_READ_MOSTLY
+        | ROCRAND_MANAGED_HINT_PREFETCH_TO_HOST;
+    if((hints & ~all_hints) != 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    generator->managed_hints = hints;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_engine_count(rocrand_generator generator, unsigned int engine_count)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->host)
+    {
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->set_engine_count(engine_count);
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_engine_count(engine_count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_engine_count(engine_count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->set_engine_count(engine_count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->set_engine_count(engine_count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->set_engine_count(engine_count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937 *>(generator)->set_engine_count(engine_count);
+    }
+    // Philox and quasi-random generators have no engines
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_generator_memory_usage(rocrand_generator generator, size_t * bytes)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(bytes == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        *bytes = host_generator->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        *bytes = static_cast<rocrand_philox4x32_10 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        *bytes = static_cast<rocrand_threefry4x32_20 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        *bytes = static_cast<rocrand_threefry2x64_20 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        *bytes = static_cast<rocrand_philox4x64_10 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        *bytes = static_cast<rocrand_mrg32k3a *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        *bytes = static_cast<rocrand_xorwow *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        *bytes = static_cast<rocrand_xoshiro128pp *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        *bytes = static_cast<rocrand_pcg32 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        *bytes = static_cast<rocrand_mtgp32 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        *bytes = static_cast<rocrand_mt19937 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        *bytes = static_cast<rocrand_sobol32 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        *bytes = static_cast<rocrand_scrambled_sobol32 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        *bytes = static_cast<rocrand_sobol64 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        *bytes = static_cast<rocrand_scrambled_sobol64 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_allocator(rocrand_generator generator,
+                      rocrand_device_malloc_fn malloc_fn,
+                      rocrand_device_free_fn free_fn,
+                      void * user_data)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if((malloc_fn == NULL) != (free_fn == NULL))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    const rocrand_host::detail::device_allocator allocator(malloc_fn, free_fn, user_data);
+
+    if(generator->host)
+    {
+        return generator->set_allocator(allocator);
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_allocator(allocator);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_allocator(allocator);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_allocator(allocator);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->set_allocator(allocator);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->set_allocator(allocator);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->set_allocator(allocator);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937 *>(generator)->set_allocator(allocator);
+    }
+    // Generators without engines allocate new memory by the allocator
+    return generator->set_allocator(allocator);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_default_allocator(rocrand_device_malloc_fn malloc_fn,
+                              rocrand_device_free_fn free_fn,
+                              void * user_data)
+{
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
+    if((malloc_fn == NULL) != (free_fn == NULL))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    rocrand_host::detail::set_default_allocator(
+        rocrand_host::detail::device_allocator(malloc_fn, free_fn, user_data)
+    );
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_state_size(rocrand_generator generator, size_t * bytes)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(bytes == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // States of host generators are not saved
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        *bytes = static_cast<rocrand_philox4x32_10 *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        *bytes = static_cast<rocrand_threefry4x32_20 *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        *bytes = static_cast<rocrand_threefry2x64_20 *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        *bytes = static_cast<rocrand_philox4x64_10 *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        *bytes = static_cast<rocrand_mrg32k3a *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        *bytes = static_cast<rocrand_xorwow *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        *bytes = static_cast<rocrand_xoshiro128pp *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        *bytes = static_cast<rocrand_pcg32 *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        *bytes = static_cast<rocrand_mtgp32 *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        *bytes = static_cast<rocrand_mt19937 *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        *bytes = static_cast<rocrand_sobol32 *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        *bytes = static_cast<rocrand_scrambled_sobol32 *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        *bytes = static_cast<rocrand_sobol64 *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        *bytes = static_cast<rocrand_scrambled_sobol64 *>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_save_state(rocrand_generator generator, void * state, hipStream_t stream)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(state == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20 *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937 *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->save_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->save_state(state, stream);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_load_state(rocrand_generator generator, const void * state, hipStream_t stream)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(state == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_log_normal(output_data, n,
-                                                            mean, stddev);
+        return static_cast<rocrand_philox4x32_10 *>(generator)->load_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20 *>(generator)->load_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->load_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->load_state(state, stream);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_log_normal(output_data, n,
-                                                       mean, stddev);
+        return static_cast<rocrand_mrg32k3a *>(generator)->load_state(state, stream);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_xorwow *>(generator)->load_state(state, stream);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_log_normal(output_data, n,
-                                                              mean, stddev);
+        return static_cast<rocrand_xoshiro128pp *>(generator)->load_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->load_state(state, stream);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_mtgp32 *>(generator)->load_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937 *>(generator)->load_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->load_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->load_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->load_state(state, stream);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->load_state(state, stream);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_log_normal_double(rocrand_generator generator,
-                                   double * output_data, size_t n,
-                                   double mean, double stddev)
+rocrand_export_generator(rocrand_generator generator,
+                         rocrand_generator_ipc_handle * handle)
 {
+    ROCRAND_PROFILING_RANGE(generator);
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    if(handle == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    size_t state_size;
+    rocrand_status status = rocrand_get_state_size(generator, &state_size);
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_log_normal(output_data, n,
-                                                            mean, stddev);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    const hipStream_t stream = generator_stream(generator);
+    // A larger state (more engines) needs new memory, handles of
+    // the previous memory become invalid
+    if(generator->ipc_state_size < state_size)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_log_normal(output_data, n,
-                                                       mean, stddev);
+        if(generator->ipc_state != NULL)
+        {
+            hipFree(generator->ipc_state);
+            generator->ipc_state = NULL;
+            generator->ipc_state_size = 0;
+        }
+        if(hipMalloc(&generator->ipc_state, state_size) != hipSuccess)
+        {
+            generator->ipc_state = NULL;
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        generator->ipc_state_size = state_size;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+
+    status = rocrand_save_state(generator, generator->ipc_state, stream);
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    if(hipStreamSynchronize(stream) != hipSuccess
+        || hipIpcGetMemHandle(&handle->state, generator->ipc_state) != hipSuccess)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_log_normal(output_data, n,
-                                                              mean, stddev);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    handle->rng_type = generator->rng_type;
+    handle->state_size = state_size;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_import_generator(const rocrand_generator_ipc_handle * handle,
+                         rocrand_generator * generator)
+{
+    if(handle == NULL || generator == NULL)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
+    ROCRAND_PROFILING_RANGE(handle->rng_type);
+
+    void * state;
+    if(hipIpcOpenMemHandle(&state, handle->state, hipIpcMemLazyEnablePeerAccess) != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    rocrand_generator imported = NULL;
+    rocrand_status status = rocrand_create_generator(&imported, handle->rng_type);
+    if(status == ROCRAND_STATUS_SUCCESS)
+    {
+        const hipStream_t stream = generator_stream(imported);
+        status = rocrand_load_state(imported, state, stream);
+        // The state must be copied before the handle is closed
+        if(hipStreamSynchronize(stream) != hipSuccess && status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+    }
+    if(hipIpcCloseMemHandle(state) != hipSuccess && status == ROCRAND_STATUS_SUCCESS)
+    {
+        status = ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        if(imported != NULL)
+        {
+            rocrand_destroy_generator(imported);
+        }
+        return status;
+    }
+    *generator = imported;
+    return ROCRAND_STATUS_SUCCESS;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_poisson(rocrand_generator generator,
-                         unsigned int * output_data, size_t n,
-                         double lambda)
+rocrand_fork_generator(rocrand_generator parent,
+                       rocrand_generator * child,
+                       unsigned long long subsequence_id)
 {
-    if(generator == NULL)
+    ROCRAND_PROFILING_RANGE(parent);
+    if(parent == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-    if (lambda <= 0.0)
+    if(child == NULL)
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(parent->host)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_poisson(output_data, n,
-                                                         lambda);
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+
+    rocrand_generator generator = NULL;
+    rocrand_status status = ROCRAND_STATUS_TYPE_ERROR;
+    try
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_poisson(output_data, n,
-                                                    lambda);
+        if(parent->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            rocrand_philox4x32_10 * g = rocrand_host::detail::new_generator<rocrand_philox4x32_10>();
+            generator = g;
+            status = g->fork(*static_cast<rocrand_philox4x32_10 *>(parent), subsequence_id);
+        }
+        else if(parent->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+        {
+            rocrand_threefry4x32_20 * g = rocrand_host::detail::new_generator<rocrand_threefry4x32_20>();
+            generator = g;
+            status = g->fork(*static_cast<rocrand_threefry4x32_20 *>(parent), subsequence_id);
+        }
+        else if(parent->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        {
+            rocrand_threefry2x64_20 * g = rocrand_host::detail::new_generator<rocrand_threefry2x64_20>();
+            generator = g;
+            status = g->fork(*static_cast<rocrand_threefry2x64_20 *>(parent), subsequence_id);
+        }
+        else if(parent->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            rocrand_philox4x64_10 * g = rocrand_host::detail::new_generator<rocrand_philox4x64_10>();
+            generator = g;
+            status = g->fork(*static_cast<rocrand_philox4x64_10 *>(parent), subsequence_id);
+        }
+        else if(parent->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+        {
+            rocrand_mrg32k3a * g = rocrand_host::detail::new_generator<rocrand_mrg32k3a>();
+            generator = g;
+            status = g->fork(*static_cast<rocrand_mrg32k3a *>(parent), subsequence_id);
+        }
+        else if(parent->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            rocrand_xorwow * g = rocrand_host::detail::new_generator<rocrand_xorwow>();
+            generator = g;
+            status = g->fork(*static_cast<rocrand_xorwow *>(parent), subsequence_id);
+        }
+        else if(parent->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            rocrand_xoshiro128pp * g = rocrand_host::detail::new_generator<rocrand_xoshiro128pp>();
+            generator = g;
+            status = g->fork(*static_cast<rocrand_xoshiro128pp *>(parent), subsequence_id);
+        }
+        else if(parent->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            rocrand_pcg32 * g = rocrand_host::detail::new_generator<rocrand_pcg32>();
+            generator = g;
+            status = g->fork(*static_cast<rocrand_pcg32 *>(parent), subsequence_id);
+        }
+        else if(parent->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+        {
+            rocrand_mtgp32 * g = rocrand_host::detail::new_generator<rocrand_mtgp32>();
+            generator = g;
+            status = g->fork(*static_cast<rocrand_mtgp32 *>(parent), subsequence_id);
+        }
+        else if(parent->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+        {
+            rocrand_mt19937 * g = rocrand_host::detail::new_generator<rocrand_mt19937>();
+            generator = g;
+            status = g->fork(*static_cast<rocrand_mt19937 *>(parent), subsequence_id);
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    catch(const std::bad_alloc& e)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_poisson(output_data, n,
-                                                          lambda);
+        status = ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    catch(rocrand_status e)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_poisson(output_data, n,
-                                                           lambda);
+        status = e;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_poisson(output_data, n,
-                                                          lambda);
+        delete(generator);
+        return status;
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
+    *child = generator;
+    return ROCRAND_STATUS_SUCCESS;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_initialize_generator(rocrand_generator generator)
+rocrand_acquire_stream_generator(rocrand_generator generator,
+                                 hipStream_t stream,
+                                 rocrand_generator * lease)
 {
+    ROCRAND_PROFILING_RANGE(generator);
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(lease == NULL)
     {
-        return static_cast<rocrand_philox4x32_10 *>(generator)->init();
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+
+    // Leases are children of rocrand_fork_generator()
+    if(generator->host || generator->rng_type >= ROCRAND_RNG_QUASI_DEFAULT)
     {
-        return static_cast<rocrand_mrg32k3a *>(generator)->init();
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+
+    rocrand_host::detail::stream_leases * leases = generator->get_leases();
+    if(leases == NULL)
     {
-        return static_cast<rocrand_xorwow *>(generator)->init();
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    return leases->acquire(
+        stream, *lease,
+        [generator](unsigned int slot, rocrand_generator& child)
+        {
+            return rocrand_fork_generator(generator, &child, slot);
+        },
+        [](rocrand_generator child, hipStream_t child_stream)
+        {
+            rocrand_set_stream(child, child_stream);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_release_stream_generator(rocrand_generator generator,
+                                 rocrand_generator lease)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
     {
-        return static_cast<rocrand_sobol32 *>(generator)->init();
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+
+    rocrand_host::detail::stream_leases * leases = generator->leases.load();
+    if(lease == NULL || leases == NULL)
     {
-        return static_cast<rocrand_mtgp32 *>(generator)->init();
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
+    return leases->release(lease);
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_stream(rocrand_generator generator, hipStream_t stream)
+rocrand_set_subsequence_partition(rocrand_generator generator,
+                                  unsigned int rank,
+                                  unsigned int nranks)
 {
+    ROCRAND_PROFILING_RANGE(generator);
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    if(nranks == 0 || rank >= nranks)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->host)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        static_cast<rocrand_philox4x32_10 *>(generator)->set_stream(stream);
+        static_cast<rocrand_philox4x32_10 *>(generator)->set_subsequence_partition(rank, nranks);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        static_cast<rocrand_threefry4x32_20 *>(generator)->set_subsequence_partition(rank, nranks);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        static_cast<rocrand_threefry2x64_20 *>(generator)->set_subsequence_partition(rank, nranks);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        static_cast<rocrand_philox4x64_10 *>(generator)->set_subsequence_partition(rank, nranks);
         return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        static_cast<rocrand_mrg32k3a *>(generator)->set_stream(stream);
+        static_cast<rocrand_mrg32k3a *>(generator)->set_subsequence_partition(rank, nranks);
         return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        static_cast<rocrand_xorwow *>(generator)->set_stream(stream);
+        static_cast<rocrand_xorwow *>(generator)->set_subsequence_partition(rank, nranks);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
     {
-        static_cast<rocrand_sobol32 *>(generator)->set_stream(stream);
+        static_cast<rocrand_xoshiro128pp *>(generator)->set_subsequence_partition(rank, nranks);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        static_cast<rocrand_pcg32 *>(generator)->set_subsequence_partition(rank, nranks);
         return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        static_cast<rocrand_mtgp32 *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_mtgp32 *>(generator)->set_subsequence_partition(rank, nranks);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937 *>(generator)->set_subsequence_partition(rank, nranks);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        static_cast<rocrand_sobol32 *>(generator)->set_subsequence_partition(rank, nranks);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        static_cast<rocrand_scrambled_sobol32 *>(generator)->set_subsequence_partition(rank, nranks);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        static_cast<rocrand_sobol64 *>(generator)->set_subsequence_partition(rank, nranks);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        static_cast<rocrand_scrambled_sobol64 *>(generator)->set_subsequence_partition(rank, nranks);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_poisson_cache_size(rocrand_generator generator, size_t bytes)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    generator->poisson_cache.max_bytes = bytes;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_poisson_cache_stats(rocrand_generator generator,
+                                unsigned long long * hits,
+                                unsigned long long * misses)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(hits == NULL || misses == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    *hits = generator->poisson_cache.hits;
+    *misses = generator->poisson_cache.misses;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_generator_stats(rocrand_generator generator,
+                            rocrand_generator_stats * stats)
+{
+    ROCRAND_PROFILING_RANGE(generator);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(stats == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    stats->samples = generator->stats.samples;
+    stats->launches = generator->stats.launches;
+    stats->inits = generator->stats.inits;
+    stats->table_rebuilds = generator->poisson_cache.misses;
+    stats->init_time = generator->stats.init_time * 1000.0;
+    stats->table_time = generator->poisson_cache.build_time * 1000.0;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_telemetry_stats(rocrand_rng_type rng_type,
+                            rocrand_telemetry_stats * stats)
+{
+#ifdef ROCRAND_ENABLE_TELEMETRY
+    if(stats == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    return rocrand_host::detail::telemetry::instance().get_stats(rng_type, *stats);
+#else
+    (void)rng_type;
+    (void)stats;
+    return ROCRAND_STATUS_TYPE_ERROR;
+#endif
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_telemetry_callback(rocrand_telemetry_callback callback,
+                               void * user_data,
+                               double interval)
+{
+#ifdef ROCRAND_ENABLE_TELEMETRY
+    if(!(interval >= 0.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
+    rocrand_host::detail::telemetry::instance().set_callback(callback, user_data, interval);
+    return ROCRAND_STATUS_SUCCESS;
+#else
+    (void)callback;
+    (void)user_data;
+    (void)interval;
     return ROCRAND_STATUS_TYPE_ERROR;
+#endif
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_seed(rocrand_generator generator, unsigned long long seed)
+rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
+                                              unsigned int dimensions)
 {
+    ROCRAND_PROFILING_RANGE(generator);
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    if(dimensions < 1
+        || dimensions > rocrand_host::detail::max_quasi_dimensions(generator->rng_type))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(generator->host)
     {
-        static_cast<rocrand_philox4x32_10 *>(generator)->set_seed(seed);
+        rocrand_host_generator_base_type * host_generator =
+            static_cast<rocrand_host_generator_base_type *>(generator);
+        return host_generator->set_dimensions(dimensions);
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        static_cast<rocrand_sobol32 *>(generator)->set_dimensions(dimensions);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        if(seed == 0ULL)
-        {
-            seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
-        }
-        static_cast<rocrand_mrg32k3a *>(generator)->set_seed(seed);
+        static_cast<rocrand_scrambled_sobol32 *>(generator)->set_dimensions(dimensions);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
     {
-        static_cast<rocrand_xorwow *>(generator)->set_seed(seed);
+        static_cast<rocrand_sobol64 *>(generator)->set_dimensions(dimensions);
         return ROCRAND_STATUS_SUCCESS;
     }
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
     {
-        static_cast<rocrand_mtgp32 *>(generator)->set_seed(seed);
+        static_cast<rocrand_scrambled_sobol64 *>(generator)->set_dimensions(dimensions);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        static_cast<rocrand_lattice *>(generator)->set_dimensions(dimensions);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        static_cast<rocrand_halton *>(generator)->set_dimensions(dimensions);
         return ROCRAND_STATUS_SUCCESS;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_offset(rocrand_generator generator, unsigned long long offset)
+rocrand_set_quasi_random_generator_first_dimension(rocrand_generator generator,
+                                                   unsigned int first_dimension)
 {
+    ROCRAND_PROFILING_RANGE(generator);
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    if(first_dimension >= rocrand_host::detail::max_quasi_dimensions(generator->rng_type))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(generator->host)
     {
-        static_cast<rocrand_philox4x32_10 *>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        static_cast<rocrand_mrg32k3a *>(generator)->set_offset(offset);
+        static_cast<rocrand_sobol32 *>(generator)->set_first_dimension(first_dimension);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        static_cast<rocrand_xorwow *>(generator)->set_offset(offset);
+        static_cast<rocrand_scrambled_sobol32 *>(generator)->set_first_dimension(first_dimension);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
     {
-        static_cast<rocrand_sobol32 *>(generator)->set_offset(offset);
+        static_cast<rocrand_sobol64 *>(generator)->set_first_dimension(first_dimension);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
     {
-        // Can't set offset for MTGP32
-        return ROCRAND_STATUS_TYPE_ERROR;
+        static_cast<rocrand_scrambled_sobol64 *>(generator)->set_first_dimension(first_dimension);
+        return ROCRAND_STATUS_SUCCESS;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
-                                              unsigned int dimensions)
+rocrand_set_lattice_generating_vector(rocrand_generator generator,
+                                      const unsigned int * vector,
+                                      unsigned int size)
 {
+    ROCRAND_PROFILING_RANGE(generator);
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-    if(dimensions < 1 || dimensions > 20000)
+    if(generator->host || generator->rng_type != ROCRAND_RNG_QUASI_LATTICE)
     {
-        return ROCRAND_STATUS_OUT_OF_RANGE;
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
-    {
-        static_cast<rocrand_sobol32 *>(generator)->set_dimensions(dimensions);
-        return ROCRAND_STATUS_SUCCESS;
-    }
-    return ROCRAND_STATUS_TYPE_ERROR;
+    static_cast<rocrand_lattice *>(generator)->set_generating_vector(
+        vector, vector == NULL ? 0 : size
+    );
+    return ROCRAND_STATUS_SUCCESS;
 }
 
 rocrand_status ROCRANDAPI
 rocrand_get_version(int * version)
 {
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
     if(version == NULL)
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
@@ -627,10 +5298,60 @@ rocrand_get_version(int * version)
     return ROCRAND_STATUS_SUCCESS;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_get_host_tables(const rocrand_precomputed_tables ** tables)
+{
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
+    if(tables == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    *tables = rocrand_host::detail::get_host_tables();
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_device_tables(const rocrand_precomputed_tables ** tables)
+{
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
+    if(tables == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return rocrand_host::detail::get_device_tables(tables);
+}
+
+// Copies a distribution of the public API to device memory allocated by
+// allocator (the allocator of its tables), both are freed by the allocator
+// in rocrand_destroy_discrete_distribution()
+static rocrand_status
+store_discrete_distribution(const rocrand_discrete_distribution_st& h_dis,
+                            const rocrand_host::detail::device_allocator& allocator,
+                            rocrand_discrete_distribution * discrete_distribution)
+{
+    if (allocator.allocate(discrete_distribution, 1) != ROCRAND_STATUS_SUCCESS)
+    {
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+    hipError_t error;
+    error = hipMemcpy(*discrete_distribution, &h_dis, sizeof(rocrand_discrete_distribution_st), hipMemcpyDefault);
+    if (error != hipSuccess)
+    {
+        allocator.deallocate(*discrete_distribution);
+        *discrete_distribution = NULL;
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    rocrand_host::detail::register_distribution_allocator(*discrete_distribution, allocator);
+    return ROCRAND_STATUS_SUCCESS;
+}
+
 rocrand_status ROCRANDAPI
 rocrand_create_poisson_distribution(double lambda,
                                     rocrand_discrete_distribution * discrete_distribution)
 {
+    ROCRAND_PROFILING_RANGE(lambda);
     if (discrete_distribution == NULL)
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
@@ -654,19 +5375,13 @@ rocrand_create_poisson_distribution(double lambda,
         return status;
     }
 
-    hipError_t error;
-    error = hipMalloc(discrete_distribution, sizeof(rocrand_discrete_distribution_st));
-    if (error != hipSuccess)
-    {
-        return ROCRAND_STATUS_ALLOCATION_FAILED;
-    }
-    error = hipMemcpy(*discrete_distribution, &h_dis, sizeof(rocrand_discrete_distribution_st), hipMemcpyDefault);
-    if (error != hipSuccess)
+    const rocrand_status status =
+        store_discrete_distribution(h_dis, h_dis.allocator, discrete_distribution);
+    if (status != ROCRAND_STATUS_SUCCESS)
     {
-        return ROCRAND_STATUS_INTERNAL_ERROR;
+        h_dis.deallocate();
     }
-
-    return ROCRAND_STATUS_SUCCESS;
+    return status;
 }
 
 rocrand_status ROCRANDAPI
@@ -675,6 +5390,7 @@ rocrand_create_discrete_distribution(const double * probabilities,
                                      unsigned int offset,
                                      rocrand_discrete_distribution * discrete_distribution)
 {
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
     if (discrete_distribution == NULL)
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
@@ -698,17 +5414,128 @@ rocrand_create_discrete_distribution(const double * probabilities,
         return status;
     }
 
-    hipError_t error;
-    error = hipMalloc(discrete_distribution, sizeof(rocrand_discrete_distribution_st));
-    if (error != hipSuccess)
+    const rocrand_status status =
+        store_discrete_distribution(h_dis, h_dis.allocator, discrete_distribution);
+    if (status != ROCRAND_STATUS_SUCCESS)
     {
-        return ROCRAND_STATUS_ALLOCATION_FAILED;
+        h_dis.deallocate();
     }
-    error = hipMemcpy(*discrete_distribution, &h_dis, sizeof(rocrand_discrete_distribution_st), hipMemcpyDefault);
+    return status;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution_device(const double * probabilities,
+                                            unsigned int size,
+                                            unsigned int offset,
+                                            rocrand_discrete_distribution * discrete_distribution)
+{
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
+    if (discrete_distribution == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if (size == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_UNIVERSAL> h_dis;
+    try
+    {
+        h_dis.init_device(probabilities, size, offset);
+    }
+    catch(const std::exception& e)
+    {
+        h_dis.deallocate();
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        h_dis.deallocate();
+        return status;
+    }
+
+    const rocrand_status status =
+        store_discrete_distribution(h_dis, h_dis.allocator, discrete_distribution);
+    if (status != ROCRAND_STATUS_SUCCESS)
+    {
+        h_dis.deallocate();
+    }
+    return status;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution_updatable(const double * probabilities,
+                                               unsigned int size,
+                                               unsigned int offset,
+                                               rocrand_discrete_distribution * discrete_distribution)
+{
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
+    if (discrete_distribution == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if (size == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_TREE> h_dis;
+    try
+    {
+        h_dis = rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_TREE>(probabilities, size, offset);
+    }
+    catch(const std::exception& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+
+    const rocrand_status status =
+        store_discrete_distribution(h_dis, h_dis.allocator, discrete_distribution);
+    if (status != ROCRAND_STATUS_SUCCESS)
+    {
+        h_dis.deallocate();
+    }
+    return status;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_update_discrete_distribution(rocrand_discrete_distribution discrete_distribution,
+                                     const unsigned int * indices,
+                                     const double * probabilities,
+                                     unsigned int k)
+{
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
+    if (discrete_distribution == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_TREE> h_dis;
+
+    hipError_t error;
+    error = hipMemcpy(&h_dis, discrete_distribution, sizeof(rocrand_discrete_distribution_st), hipMemcpyDefault);
     if (error != hipSuccess)
     {
         return ROCRAND_STATUS_INTERNAL_ERROR;
     }
+    if (h_dis.tree == NULL)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    try
+    {
+        h_dis.update(indices, probabilities, k);
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
 
     return ROCRAND_STATUS_SUCCESS;
 }
@@ -716,6 +5543,7 @@ rocrand_create_discrete_distribution(const double * probabilities,
 rocrand_status ROCRANDAPI
 rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_distribution)
 {
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
     if (discrete_distribution == NULL)
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
@@ -730,6 +5558,8 @@ rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_dis
         return ROCRAND_STATUS_INTERNAL_ERROR;
     }
 
+    h_dis.allocator =
+        rocrand_host::detail::unregister_distribution_allocator(discrete_distribution);
     try
     {
         h_dis.deallocate();
@@ -739,15 +5569,100 @@ rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_dis
         return status;
     }
 
-    error = hipFree(discrete_distribution);
-    if (error != hipSuccess)
+    h_dis.allocator.deallocate(discrete_distribution);
+
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_multi_device_generator(rocrand_multi_device_generator * generator,
+                                      rocrand_rng_type rng_type,
+                                      const int * devices,
+                                      unsigned int device_count)
+{
+    ROCRAND_PROFILING_RANGE(rng_type);
+    if(generator == NULL || devices == NULL || device_count == 0)
     {
-        return ROCRAND_STATUS_INTERNAL_ERROR;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if(!rocrand_multi_device_generator_base_type::is_supported(rng_type))
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_multi_device_generator_base_type * multi_generator;
+    try
+    {
+        multi_generator = new rocrand_multi_device_generator_base_type(rng_type);
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+
+    const rocrand_status status = multi_generator->create(devices, device_count);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        delete multi_generator;
+        return status;
     }
+    *generator = multi_generator;
+    return ROCRAND_STATUS_SUCCESS;
+}
 
+rocrand_status ROCRANDAPI
+rocrand_destroy_multi_device_generator(rocrand_multi_device_generator generator)
+{
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    delete generator;
     return ROCRAND_STATUS_SUCCESS;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_set_multi_device_seed(rocrand_multi_device_generator generator,
+                              unsigned long long seed)
+{
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    return generator->set_seed(seed);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_multi_device_offset(rocrand_multi_device_generator generator,
+                                unsigned long long offset)
+{
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    return generator->set_offset(offset);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_multi_device(rocrand_multi_device_generator generator,
+                              unsigned int * const * output_data,
+                              const size_t * sizes)
+{
+    ROCRAND_PROFILING_NAMED_RANGE(__func__);
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(output_data == NULL || sizes == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    return generator->generate(output_data, sizes);
+}
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -0,0 +1,135 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <rocrand_sobol_precomputed.h>
+#include <rocrand_scrambled_sobol_precomputed.h>
+
+#include "rng/rocrand_sobol64_precomputed.h"
+#include "rng/sobol_host_tables.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+namespace {
+
+    // Tables of a file of tools/sobol_direction_vector_generator (--binary):
+    //   char[8] "ROCRANDS", uint32 version (1), uint32 dimensions,
+    //   uint32 sobol32[dimensions * 32], uint64 sobol64[dimensions * 64],
+    //   uint32 scrambled32[dimensions], uint64 scrambled64[dimensions]
+    struct sobol_file_tables
+    {
+        std::vector<unsigned int> sobol32;
+        std::vector<unsigned long long int> sobol64;
+        std::vector<unsigned int> scrambled32;
+        std::vector<unsigned long long int> scrambled64;
+    };
+
+    template<class T>
+    bool read_values(std::ifstream& file, std::vector<T>& values, const size_t size)
+    {
+        values.resize(size);
+        file.read(reinterpret_cast<char *>(values.data()), sizeof(T) * size);
+        return static_cast<bool>(file);
+    }
+
+    bool load_tables(const char * path, sobol_file_tables& tables, unsigned int& dimensions)
+    {
+        std::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+        char magic[8];
+        uint32_t version = 0;
+        uint32_t dims = 0;
+        file.read(magic, sizeof(magic));
+        file.read(reinterpret_cast<char *>(&version), sizeof(version));
+        file.read(reinterpret_cast<char *>(&dims), sizeof(dims));
+        if(!file || std::memcmp(magic, "ROCRANDS", sizeof(magic)) != 0
+            || version != 1 || dims == 0)
+        {
+            return false;
+        }
+        // The whole file is validated before values are read
+        const std::streamoff header_size = file.tellg();
+        file.seekg(0, std::ios_base::end);
+        const std::streamoff expected_size =
+            header_size + static_cast<std::streamoff>(dims) * (32 * 4 + 64 * 8 + 4 + 8);
+        if(file.tellg() != expected_size)
+        {
+            return false;
+        }
+        file.seekg(header_size);
+        if(!read_values(file, tables.sobol32, static_cast<size_t>(dims) * 32)
+            || !read_values(file, tables.sobol64, static_cast<size_t>(dims) * 64)
+            || !read_values(file, tables.scrambled32, dims)
+            || !read_values(file, tables.scrambled64, dims))
+        {
+            return false;
+        }
+        dimensions = dims;
+        return true;
+    }
+
+} // end namespace
+
+    const sobol_host_tables& get_sobol_host_tables()
+    {
+        // Tables are used until the process exits
+        static sobol_file_tables file_tables;
+        static const sobol_host_tables tables = []()
+        {
+            sobol_host_tables t;
+            t.dimensions = SOBOL_DIM;
+            t.sobol32_direction_vectors = h_sobol32_direction_vectors;
+            t.sobol64_direction_vectors = h_sobol64_direction_vectors;
+            t.scrambled_sobol32_constants = h_scrambled_sobol32_constants;
+            t.scrambled_sobol64_constants = h_scrambled_sobol64_constants;
+            t.status = ROCRAND_STATUS_SUCCESS;
+
+            const char * path = std::getenv("ROCRAND_SOBOL_TABLES");
+            if(path == NULL || path[0] == '\0')
+            {
+                return t;
+            }
+            unsigned int dimensions;
+            if(!load_tables(path, file_tables, dimensions))
+            {
+                // The requested tables are not silently replaced by
+                // the embedded ones in Sobol generators
+                t.status = ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            else
+            {
+                t.dimensions = dimensions;
+                t.sobol32_direction_vectors = file_tables.sobol32.data();
+                t.sobol64_direction_vectors = file_tables.sobol64.data();
+                t.scrambled_sobol32_constants = file_tables.scrambled32.data();
+                t.scrambled_sobol64_constants = file_tables.scrambled64.data();
+            }
+            return t;
+        }();
+        return tables;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
@@ -18,5 +18,5 @@
 # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 # THE SOFTWARE.
 
-from .rocrand import RocRandError, PRNG, QRNG, get_version
-from .hip import HipError, DeviceNDArray, empty
+from .rocrand import RocRandError, PRNG, QRNG, GenerateFuture, get_version
+from .hip import HipError, DeviceNDArray, empty, device_array
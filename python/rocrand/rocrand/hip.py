@@ -43,6 +43,18 @@ class HipError(Exception):
 
 hipSuccess = 0
 hipMemcpyDeviceToHost = 2
+hipEventDisableTiming = 2
+hipErrorNotReady = 600
+hipHostMallocDefault = 0
+
+# DLPack device types of memory which kernels can access
+kDLCUDA = 2
+kDLCUDAHost = 3
+kDLROCM = 10
+kDLROCMHost = 11
+kDLCUDAManaged = 13
+DLPACK_DEVICE_TYPES = (kDLCUDA, kDLCUDAHost, kDLROCM, kDLROCMHost, kDLCUDAManaged)
+DLPACK_HOST_DEVICE_TYPES = (kDLCUDAHost, kDLROCMHost)
 
 def check_hip(status):
     if status != hipSuccess:
@@ -81,6 +93,15 @@ def load_hip():
             hip.hipMalloc = cuda.cudaMalloc
             hip.hipFree = cuda.cudaFree
             hip.hipMemcpy = cuda.cudaMemcpy
+            hip.hipMemcpyAsync = cuda.cudaMemcpyAsync
+            hip.hipHostMalloc = cuda.cudaHostAlloc
+            hip.hipHostFree = cuda.cudaFreeHost
+            hip.hipEventQuery = cuda.cudaEventQuery
+            hip.hipEventSynchronize = cuda.cudaEventSynchronize
+            hip.hipEventCreateWithFlags = cuda.cudaEventCreateWithFlags
+            hip.hipEventRecord = cuda.cudaEventRecord
+            hip.hipEventDestroy = cuda.cudaEventDestroy
+            hip.hipStreamWaitEvent = cuda.cudaStreamWaitEvent
 
     if hip is None:
         raise ImportError("both libcudart.so and libhip_hcc.so cannot be loaded: " +
@@ -89,6 +110,7 @@ def load_hip():
 class MemoryPointer(object):
     def __init__(self, nbytes):
         self.ptr = c_void_p()
+        self.nbytes = nbytes
         check_hip(hip.hipMalloc(byref(self.ptr), c_size_t(nbytes)))
         track_for_finalization(self, self.ptr, MemoryPointer._finalize)
 
@@ -96,9 +118,215 @@ class MemoryPointer(object):
     def _finalize(cls, ptr):
         check_hip(hip.hipFree(ptr))
 
+class PinnedMemoryPointer(object):
+    """Page-locked host memory, the device copies to it asynchronously."""
+
+    def __init__(self, nbytes):
+        self.ptr = c_void_p()
+        self.nbytes = nbytes
+        check_hip(hip.hipHostMalloc(byref(self.ptr), c_size_t(nbytes), hipHostMallocDefault))
+        track_for_finalization(self, self.ptr, PinnedMemoryPointer._finalize)
+
+    @classmethod
+    def _finalize(cls, ptr):
+        check_hip(hip.hipHostFree(ptr))
+
+class Event(object):
+    """HIP event which marks completion of work enqueued to a stream."""
+
+    def __init__(self):
+        self.event = c_void_p()
+        check_hip(hip.hipEventCreateWithFlags(byref(self.event), hipEventDisableTiming))
+        track_for_finalization(self, self.event, Event._finalize)
+
+    @classmethod
+    def _finalize(cls, event):
+        check_hip(hip.hipEventDestroy(event))
+
+    def record(self, stream=None):
+        check_hip(hip.hipEventRecord(self.event, c_void_p(stream_handle(stream))))
+
+    def query(self):
+        """Returns *True* if the recorded work is completed."""
+        status = hip.hipEventQuery(self.event)
+        if status == hipErrorNotReady:
+            return False
+        check_hip(status)
+        return True
+
+    def synchronize(self):
+        check_hip(hip.hipEventSynchronize(self.event))
+
+class ExternalMemoryPointer(object):
+    """Device memory of an array of another library (e.g. PyTorch, CuPy).
+
+    **owner** is kept alive, **managed_tensor** (a DLPack tensor) is returned
+    to its producer when the pointer is destroyed.
+    """
+
+    def __init__(self, ptr, owner, managed_tensor=None):
+        self.ptr = c_void_p(ptr)
+        self.owner = owner
+        if managed_tensor is not None:
+            track_for_finalization(self, managed_tensor, ExternalMemoryPointer._finalize)
+
+    @classmethod
+    def _finalize(cls, managed_tensor):
+        if managed_tensor.contents.deleter:
+            managed_tensor.contents.deleter(managed_tensor)
+
 def device_pointer(dary):
     return dary.data.ptr
 
+def stream_handle(stream):
+    """Returns the handle of a HIP stream as an integer, *None* is the default stream."""
+    if stream is None:
+        return 0
+    if isinstance(stream, c_void_p):
+        return stream.value or 0
+    return int(stream)
+
+def copy_to_host_async(dst, src, nbytes, stream=None):
+    """Enqueues a copy of **nbytes** bytes from device pointer **src** to
+    host pointer **dst** (pinned memory) to **stream**."""
+    check_hip(hip.hipMemcpyAsync(dst, src, c_size_t(nbytes), hipMemcpyDeviceToHost,
+                                 c_void_p(stream_handle(stream))))
+
+def stream_wait(stream, other):
+    """Makes work enqueued to **stream** wait for work enqueued to **other** so far."""
+    stream, other = stream_handle(stream), stream_handle(other)
+    if stream == other:
+        return
+    event = c_void_p()
+    check_hip(hip.hipEventCreateWithFlags(byref(event), hipEventDisableTiming))
+    try:
+        check_hip(hip.hipEventRecord(event, c_void_p(other)))
+        check_hip(hip.hipStreamWaitEvent(c_void_p(stream), event, 0))
+    finally:
+        check_hip(hip.hipEventDestroy(event))
+
+class DLDevice(Structure):
+    _fields_ = [
+        ("device_type", c_int32),
+        ("device_id", c_int32)
+    ]
+
+class DLDataType(Structure):
+    _fields_ = [
+        ("code", c_uint8),
+        ("bits", c_uint8),
+        ("lanes", c_uint16)
+    ]
+
+class DLTensor(Structure):
+    _fields_ = [
+        ("data", c_void_p),
+        ("device", DLDevice),
+        ("ndim", c_int32),
+        ("dtype", DLDataType),
+        ("shape", POINTER(c_int64)),
+        ("strides", POINTER(c_int64)),
+        ("byte_offset", c_uint64)
+    ]
+
+class DLManagedTensor(Structure):
+    pass
+
+DLManagedTensor._fields_ = [
+    ("dl_tensor", DLTensor),
+    ("manager_ctx", c_void_p),
+    ("deleter", CFUNCTYPE(None, POINTER(DLManagedTensor)))
+]
+
+_capsule_get_pointer = pythonapi.PyCapsule_GetPointer
+_capsule_get_pointer.restype = c_void_p
+_capsule_get_pointer.argtypes = [py_object, c_char_p]
+_capsule_set_name = pythonapi.PyCapsule_SetName
+_capsule_set_name.restype = c_int
+_capsule_set_name.argtypes = [py_object, c_char_p]
+# The name must be valid while the capsule exists
+_USED_DLTENSOR = b"used_dltensor"
+
+def _is_c_contiguous(shape, strides, itemsize):
+    if strides is None:
+        return True
+    expected = itemsize
+    for dim, stride in reversed(list(zip(shape, strides))):
+        if dim != 1 and stride != expected:
+            return False
+        expected *= dim
+    return True
+
+def _from_array_interface(ary, interface, stream):
+    ptr, _ = interface["data"]
+    shape = tuple(interface["shape"])
+    dtype = np.dtype(interface["typestr"])
+    if not _is_c_contiguous(shape, interface.get("strides"), dtype.itemsize):
+        raise ValueError("ary must be C-contiguous")
+
+    # Kernels must not start before the work of the producer's stream
+    # (1 is the legacy default stream of __cuda_array_interface__)
+    producer_stream = interface.get("stream")
+    if producer_stream is not None:
+        stream_wait(stream, 0 if producer_stream == 1 else producer_stream)
+
+    return DeviceNDArray(shape, dtype, ExternalMemoryPointer(ptr or 0, ary))
+
+def _from_dlpack(ary, stream):
+    device_type, _ = ary.__dlpack_device__()
+    if device_type not in DLPACK_DEVICE_TYPES:
+        raise TypeError("unsupported DLPack device type {}".format(device_type))
+
+    # The producer makes stream wait for its work
+    if device_type in DLPACK_HOST_DEVICE_TYPES:
+        capsule = ary.__dlpack__()
+    else:
+        handle = stream_handle(stream)
+        if handle == 0 and device_type != kDLROCM:
+            # The legacy default stream of CUDA
+            handle = 1
+        capsule = ary.__dlpack__(stream=handle)
+
+    managed_tensor = cast(_capsule_get_pointer(capsule, b"dltensor"), POINTER(DLManagedTensor))
+    _capsule_set_name(capsule, _USED_DLTENSOR)
+    tensor = managed_tensor.contents.dl_tensor
+    pointer = ExternalMemoryPointer((tensor.data or 0) + tensor.byte_offset, ary, managed_tensor)
+
+    if tensor.dtype.lanes != 1 or tensor.dtype.code > 2:
+        raise TypeError("unsupported DLPack data type")
+    dtype = np.dtype("{}{}".format("iuf"[tensor.dtype.code], tensor.dtype.bits // 8))
+    shape = tuple(tensor.shape[i] for i in range(tensor.ndim))
+    strides = None
+    if tensor.strides:
+        strides = tuple(tensor.strides[i] * dtype.itemsize for i in range(tensor.ndim))
+    if not _is_c_contiguous(shape, strides, dtype.itemsize):
+        raise ValueError("ary must be C-contiguous")
+
+    return DeviceNDArray(shape, dtype, pointer)
+
+def device_array(ary, stream=None):
+    """Returns an array which the generator can fill.
+
+    NumPy arrays and :class:`DeviceNDArray` are returned as is. Arrays of other
+    libraries (e.g. PyTorch tensors, CuPy arrays) which expose
+    ``__hip_array_interface__``, ``__cuda_array_interface__`` or DLPack
+    (``__dlpack__``) are returned as :class:`DeviceNDArray` which shares their
+    device memory, so numbers are generated without copies. Work of the
+    producer is ordered before work enqueued to **stream**.
+
+    :param ary:    Array
+    :param stream: HIP stream of the generator, *None* means default stream
+    """
+    if isinstance(ary, (np.ndarray, DeviceNDArray)):
+        return ary
+    for name in ("__hip_array_interface__", "__cuda_array_interface__"):
+        interface = getattr(ary, name, None)
+        if interface is not None:
+            return _from_array_interface(ary, interface, stream)
+    if hasattr(ary, "__dlpack__") and hasattr(ary, "__dlpack_device__"):
+        return _from_dlpack(ary, stream)
+    raise TypeError("unsupported type {}".format(type(ary)))
+
 class DeviceNDArray(object):
     """Device-side array.
 
@@ -29,7 +29,8 @@ import numbers
 import numpy as np
 
 from .hip import load_hip, HIP_PATHS
-from .hip import empty, DeviceNDArray, device_pointer
+from .hip import empty, DeviceNDArray, device_pointer, device_array
+from .hip import MemoryPointer, PinnedMemoryPointer, Event, copy_to_host_async
 
 from .utils import find_library, expand_paths
 from .finalize import track_for_finalization
@@ -58,8 +59,52 @@ ROCRAND_RNG_PSEUDO_XORWOW = 401
 ROCRAND_RNG_PSEUDO_MRG32K3A = 402
 ROCRAND_RNG_PSEUDO_MTGP32 = 403
 ROCRAND_RNG_PSEUDO_PHILOX4_32_10 = 404
+ROCRAND_RNG_PSEUDO_THREEFRY4_32_20 = 405
+ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 = 406
+ROCRAND_RNG_PSEUDO_XOSHIRO128PP = 407
+ROCRAND_RNG_PSEUDO_PCG32 = 408
+ROCRAND_RNG_PSEUDO_MT19937 = 409
+ROCRAND_RNG_PSEUDO_PHILOX4_64_10 = 410
 ROCRAND_RNG_QUASI_DEFAULT = 500
 ROCRAND_RNG_QUASI_SOBOL32 = 501
+ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 = 502
+ROCRAND_RNG_QUASI_SOBOL64 = 503
+ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 = 504
+ROCRAND_RNG_QUASI_LATTICE = 505
+ROCRAND_RNG_QUASI_HALTON = 506
+
+ROCRAND_DISTRIBUTION_UNIFORM_UINT = 0
+ROCRAND_DISTRIBUTION_UNIFORM_FLOAT = 1
+ROCRAND_DISTRIBUTION_UNIFORM_DOUBLE = 2
+ROCRAND_DISTRIBUTION_NORMAL_FLOAT = 3
+ROCRAND_DISTRIBUTION_NORMAL_DOUBLE = 4
+ROCRAND_DISTRIBUTION_LOG_NORMAL_FLOAT = 5
+ROCRAND_DISTRIBUTION_LOG_NORMAL_DOUBLE = 6
+ROCRAND_DISTRIBUTION_POISSON = 7
+
+# Distributions of generate functions which can generate to host memory
+# with rocrand_generate_to_host
+TO_HOST_DISTRIBUTIONS = {
+    "rocrand_generate": ROCRAND_DISTRIBUTION_UNIFORM_UINT,
+    "rocrand_generate_uniform": ROCRAND_DISTRIBUTION_UNIFORM_FLOAT,
+    "rocrand_generate_uniform_double": ROCRAND_DISTRIBUTION_UNIFORM_DOUBLE,
+    "rocrand_generate_normal": ROCRAND_DISTRIBUTION_NORMAL_FLOAT,
+    "rocrand_generate_normal_double": ROCRAND_DISTRIBUTION_NORMAL_DOUBLE,
+    "rocrand_generate_log_normal": ROCRAND_DISTRIBUTION_LOG_NORMAL_FLOAT,
+    "rocrand_generate_log_normal_double": ROCRAND_DISTRIBUTION_LOG_NORMAL_DOUBLE,
+    "rocrand_generate_poisson": ROCRAND_DISTRIBUTION_POISSON
+}
+
+class GenerateRequest(Structure):
+    """rocrand_generate_request"""
+    _fields_ = [
+        ("distribution", c_int),
+        ("output_data", c_void_p),
+        ("n", c_size_t),
+        ("mean", c_double),
+        ("stddev", c_double),
+        ("lmbd", c_double)
+    ]
 
 ROCRAND_STATUS_SUCCESS = 0
 ROCRAND_STATUS_VERSION_MISMATCH = 100
@@ -124,6 +169,49 @@ class RocRandError(Exception):
         return "{} ({})".format(s, v)
 
 
+class GenerateFuture(object):
+    """Result of an asynchronous generation (**async_** is *True*).
+
+    Numbers are generated and, for NumPy arrays, copied to page-locked host
+    memory on the stream of the generator, so Python code can run while the
+    device works. NumPy arrays receive the numbers when :meth:`wait` is called.
+
+    Example::
+
+        import rocrand
+        import numpy as np
+
+        gen = rocrand.PRNG()
+        a = np.empty(1000000, dtype=np.float32)
+        future = gen.uniform(a, async_=True)
+        # ... other work ...
+        future.wait()
+        print(a)
+    """
+
+    def __init__(self, rng, event, ary, size, staging=None):
+        self._rng = rng
+        self._event = event
+        self._ary = ary
+        self._size = size
+        self._staging = staging
+
+    def done(self):
+        """Returns *True* if the numbers are generated (and copied)."""
+        return self._event.query()
+
+    def wait(self):
+        """Waits for the numbers and saves them to **ary** if it is a NumPy array."""
+        self._event.synchronize()
+        if self._staging is not None:
+            staging, self._staging = self._staging, None
+            nbytes = self._ary.dtype.itemsize * self._size
+            output = np.frombuffer((c_char * nbytes).from_address(staging.ptr.value),
+                                   self._ary.dtype)
+            self._ary.flat[:self._size] = output
+            self._rng._release_staging(staging)
+
+
 class RNG(object):
     """Random number generator base class."""
 
@@ -140,10 +228,33 @@ class RNG(object):
         if stream is not None:
             self.stream = stream
 
+        # Device memory reused by generations to host memory which cannot
+        # use rocrand_generate_to_host, grows to the largest request
+        self._scratch = None
+        # Free pinned buffers of asynchronous generations to host memory
+        self._staging = []
+
     @classmethod
     def _finalize(cls, gen):
         check_rocrand(rocrand.rocrand_destroy_generator(gen))
 
+    def _scratch_array(self, size, dtype):
+        nbytes = np.dtype(dtype).itemsize * size
+        if self._scratch is None or self._scratch.nbytes < nbytes:
+            # Freeing waits for enqueued work which uses the previous buffer
+            self._scratch = None
+            self._scratch = MemoryPointer(nbytes)
+        return DeviceNDArray(size, dtype, self._scratch)
+
+    def _acquire_staging(self, nbytes):
+        for i, staging in enumerate(self._staging):
+            if staging.nbytes >= nbytes:
+                return self._staging.pop(i)
+        return PinnedMemoryPointer(nbytes)
+
+    def _release_staging(self, staging):
+        self._staging.append(staging)
+
     @property
     def offset(self):
         """Mutable attribute of the offset of random numbers sequence.
@@ -171,7 +282,7 @@ class RNG(object):
         check_rocrand(rocrand.rocrand_set_stream(self._gen, stream))
         self._stream = stream
 
-    def _generate(self, gen_func, ary, size, *args):
+    def _generate(self, gen_func, ary, size, async_, *args):
         if size is not None:
             if size > ary.size:
                 raise ValueError("requested size is greater than ary")
@@ -179,7 +290,13 @@ class RNG(object):
             size = ary.size
 
         if isinstance(ary, np.ndarray):
-            dary, needs_conversion = empty(size, ary.dtype), True
+            distribution = TO_HOST_DISTRIBUTIONS.get(gen_func.__name__)
+            if not async_ and distribution is not None and ary.flags.c_contiguous:
+                # Chunks are generated and copied to ary in a pipeline,
+                # no device array of the full size is allocated
+                self._generate_to_host(distribution, ary, size, *args)
+                return None
+            dary, needs_conversion = self._scratch_array(size, ary.dtype), True
         elif isinstance(ary, DeviceNDArray):
             dary, needs_conversion = ary, False
         else:
@@ -187,10 +304,34 @@ class RNG(object):
 
         check_rocrand(gen_func(self._gen, device_pointer(dary), c_size_t(size), *args))
 
-        if needs_conversion:
-            dary.copy_to_host(ary)
+        if not async_:
+            if needs_conversion:
+                ary.flat[:size] = dary.copy_to_host()
+            return None
 
-    def generate(self, ary, size=None):
+        staging = None
+        if needs_conversion:
+            staging = self._acquire_staging(dary.nbytes)
+            copy_to_host_async(staging.ptr, device_pointer(dary), dary.nbytes, self._stream)
+        event = Event()
+        event.record(self._stream)
+        return GenerateFuture(self, event, ary, size, staging)
+
+    def _generate_to_host(self, distribution, ary, size, *args):
+        request = GenerateRequest()
+        request.distribution = distribution
+        request.output_data = ary.ctypes.data_as(c_void_p)
+        request.n = size
+        if distribution == ROCRAND_DISTRIBUTION_POISSON:
+            request.lmbd = args[0].value
+        elif args:
+            request.mean = args[0].value
+            request.stddev = args[1].value
+
+        check_rocrand(rocrand.rocrand_generate_to_host(
+            self._gen, byref(request), c_size_t(0)))
+
+    def generate(self, ary, size=None, async_=False):
         """Generates uniformly distributed integers.
 
         Generates **size** (if present) or **ary.size** uniformly distributed
@@ -198,18 +339,23 @@ class RNG(object):
 
         Supported **dtype** of **ary**: :class:`numpy.uint32`, :class:`numpy.int32`.
 
-        :param ary:  NumPy array (:class:`numpy.ndarray`) or
-                     HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:  NumPy array (:class:`numpy.ndarray`),
+                     HIP device-side array (:class:`DeviceNDArray`) or
+                     array of another library (see :func:`device_array`)
         :param size: Number of samples to generate, default to **ary.size**
+        :param async_: If *True*, returns without waiting for the numbers
+                       (see :class:`GenerateFuture`)
+        :returns: :class:`GenerateFuture` if **async_** is *True*
         """
+        ary = device_array(ary, self._stream)
         if ary.dtype in (np.uint32, np.int32):
-            self._generate(
+            return self._generate(
                 rocrand.rocrand_generate,
-                ary, size)
+                ary, size, async_)
         else:
             raise TypeError("unsupported type {}".format(ary.dtype))
 
-    def uniform(self, ary, size=None):
+    def uniform(self, ary, size=None, async_=False):
         """Generates uniformly distributed floats.
 
         Generates **size** (if present) or **ary.size** uniformly distributed
@@ -220,22 +366,27 @@ class RNG(object):
         Generated numbers are between 0.0 and 1.0, excluding 0.0 and
         including 1.0.
 
-        :param ary:  NumPy array (:class:`numpy.ndarray`) or
-                     HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:  NumPy array (:class:`numpy.ndarray`),
+                     HIP device-side array (:class:`DeviceNDArray`) or
+                     array of another library (see :func:`device_array`)
         :param size: Number of samples to generate, default to **ary.size**
+        :param async_: If *True*, returns without waiting for the numbers
+                       (see :class:`GenerateFuture`)
+        :returns: :class:`GenerateFuture` if **async_** is *True*
         """
+        ary = device_array(ary, self._stream)
         if ary.dtype == np.float32:
-            self._generate(
+            return self._generate(
                 rocrand.rocrand_generate_uniform,
-                ary, size)
+                ary, size, async_)
         elif ary.dtype == np.float64:
-            self._generate(
+            return self._generate(
                 rocrand.rocrand_generate_uniform_double,
-                ary, size)
+                ary, size, async_)
         else:
             raise TypeError("unsupported type {}".format(ary.dtype))
 
-    def normal(self, ary, mean, stddev, size=None):
+    def normal(self, ary, mean, stddev, size=None, async_=False):
         """Generates normally distributed floats.
 
         Generates **size** (if present) or **ary.size** normally distributed
@@ -243,26 +394,31 @@ class RNG(object):
 
         Supported **dtype** of **ary**: :class:`numpy.float32`, :class:`numpy.float64`.
 
-        :param ary:    NumPy array (:class:`numpy.ndarray`) or
-                       HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:    NumPy array (:class:`numpy.ndarray`),
+                       HIP device-side array (:class:`DeviceNDArray`) or
+                       array of another library (see :func:`device_array`)
         :param mean:   Mean value of normal distribution
         :param stddev: Standard deviation value of normal distribution
         :param size:   Number of samples to generate, default to **ary.size**
+        :param async_: If *True*, returns without waiting for the numbers
+                       (see :class:`GenerateFuture`)
+        :returns: :class:`GenerateFuture` if **async_** is *True*
         """
+        ary = device_array(ary, self._stream)
         if ary.dtype == np.float32:
-            self._generate(
+            return self._generate(
                 rocrand.rocrand_generate_normal,
-                ary, size,
+                ary, size, async_,
                 c_float(mean), c_float(stddev))
         elif ary.dtype == np.float64:
-            self._generate(
+            return self._generate(
                 rocrand.rocrand_generate_normal_double,
-                ary, size,
+                ary, size, async_,
                 c_double(mean), c_double(stddev))
         else:
             raise TypeError("unsupported type {}".format(ary.dtype))
 
-    def lognormal(self, ary, mean, stddev, size=None):
+    def lognormal(self, ary, mean, stddev, size=None, async_=False):
         """Generates log-normally distributed floats.
 
         Generates **size** (if present) or **ary.size** log-normally distributed
@@ -270,26 +426,31 @@ class RNG(object):
 
         Supported **dtype** of **ary**: :class:`numpy.float32`, :class:`numpy.float64`.
 
-        :param ary:    NumPy array (:class:`numpy.ndarray`) or
-                       HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:    NumPy array (:class:`numpy.ndarray`),
+                       HIP device-side array (:class:`DeviceNDArray`) or
+                       array of another library (see :func:`device_array`)
         :param mean:   Mean value of log normal distribution
         :param stddev: Standard deviation value of log normal distribution
         :param size:   Number of samples to generate, default to **ary.size**
+        :param async_: If *True*, returns without waiting for the numbers
+                       (see :class:`GenerateFuture`)
+        :returns: :class:`GenerateFuture` if **async_** is *True*
         """
+        ary = device_array(ary, self._stream)
         if ary.dtype == np.float32:
-            self._generate(
+            return self._generate(
                 rocrand.rocrand_generate_log_normal,
-                ary, size,
+                ary, size, async_,
                 c_float(mean), c_float(stddev))
         elif ary.dtype == np.float64:
-            self._generate(
+            return self._generate(
                 rocrand.rocrand_generate_log_normal_double,
-                ary, size,
+                ary, size, async_,
                 c_double(mean), c_double(stddev))
         else:
             raise TypeError("unsupported type {}".format(ary.dtype))
 
-    def poisson(self, ary, lmbd, size=None):
+    def poisson(self, ary, lmbd, size=None, async_=False):
         """Generates Poisson-distributed integers.
 
         Generates **size** (if present) or **ary.size** Poisson-distributed
@@ -297,15 +458,20 @@ class RNG(object):
 
         Supported **dtype** of **ary**: :class:`numpy.uint32`, :class:`numpy.int32`.
 
-        :param ary:   NumPy array (:class:`numpy.ndarray`) or
-                      HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:   NumPy array (:class:`numpy.ndarray`),
+                      HIP device-side array (:class:`DeviceNDArray`) or
+                      array of another library (see :func:`device_array`)
         :param lmbd:  lambda for the Poisson distribution
         :param size:  Number of samples to generate, default to **ary.size**
+        :param async_: If *True*, returns without waiting for the numbers
+                       (see :class:`GenerateFuture`)
+        :returns: :class:`GenerateFuture` if **async_** is *True*
         """
+        ary = device_array(ary, self._stream)
         if ary.dtype in (np.uint32, np.int32):
-            self._generate(
+            return self._generate(
                 rocrand.rocrand_generate_poisson,
-                ary, size,
+                ary, size, async_,
                 c_double(lmbd))
         else:
             raise TypeError("unsupported type {}".format(ary.dtype))
@@ -335,6 +501,18 @@ class PRNG(RNG):
     """Mersenne Twister MTGP32 pseudo-random generator type"""
     PHILOX4_32_10 = ROCRAND_RNG_PSEUDO_PHILOX4_32_10
     """PHILOX_4x32 (10 rounds) pseudo-random generator type"""
+    THREEFRY4_32_20 = ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
+    """Threefry-4x32 (20 rounds) pseudo-random generator type"""
+    THREEFRY2_64_20 = ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+    """Threefry-2x64 (20 rounds) pseudo-random generator type"""
+    XOSHIRO128PP  = ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+    """xoshiro128++ pseudo-random generator type"""
+    PCG32         = ROCRAND_RNG_PSEUDO_PCG32
+    """PCG32 (XSH RR) pseudo-random generator type"""
+    MT19937       = ROCRAND_RNG_PSEUDO_MT19937
+    """Mersenne Twister MT19937 pseudo-random generator type"""
+    PHILOX4_64_10 = ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+    """PHILOX_4x64 (10 rounds) pseudo-random generator type"""
 
     def __init__(self, rngtype=DEFAULT, seed=None, offset=None, stream=None):
         """__init__(self, rngtype=DEFAULT, seed=None, offset=None, stream=None)
@@ -350,6 +528,12 @@ class PRNG(RNG):
         * :const:`MRG32K3A`
         * :const:`MTGP32`
         * :const:`PHILOX4_32_10`
+        * :const:`THREEFRY4_32_20`
+        * :const:`THREEFRY2_64_20`
+        * :const:`XOSHIRO128PP`
+        * :const:`PCG32`
+        * :const:`MT19937`
+        * :const:`PHILOX4_64_10`
 
         :param rngtype: Type of pseudo-random number generator to create
         :param seed:    Initial seed value
@@ -62,10 +62,13 @@ make_test(TestCtorPRNG, "DEFAULT",       rngtype=PRNG.DEFAULT)
 make_test(TestCtorPRNG, "XORWOW",        rngtype=PRNG.XORWOW)
 make_test(TestCtorPRNG, "MRG32K3A",      rngtype=PRNG.MRG32K3A)
 make_test(TestCtorPRNG, "PHILOX4_32_10", rngtype=PRNG.PHILOX4_32_10)
+make_test(TestCtorPRNG, "THREEFRY4_32_20", rngtype=PRNG.THREEFRY4_32_20)
+make_test(TestCtorPRNG, "THREEFRY2_64_20", rngtype=PRNG.THREEFRY2_64_20)
+make_test(TestCtorPRNG, "PHILOX4_64_10", rngtype=PRNG.PHILOX4_64_10)
+make_test(TestCtorPRNG, "XOSHIRO128PP", rngtype=PRNG.XOSHIRO128PP)
+make_test(TestCtorPRNG, "PCG32", rngtype=PRNG.PCG32)
 
-class TestCtorPRNGMTGP32(TestRNGBase):
-    rngtype = PRNG.MTGP32
-
+class TestCtorPRNGNoOffset(TestRNGBase):
     def test_ctor(self):
         PRNG(self.rngtype)
         PRNG(self.rngtype, seed=123456)
@@ -74,6 +77,9 @@ class TestCtorPRNGMTGP32(TestRNGBase):
         with self.assertRaises(RocRandError):
             PRNG(self.rngtype, seed=2345678, offset=7654)
 
+make_test(TestCtorPRNGNoOffset, "MTGP32",  rngtype=PRNG.MTGP32)
+make_test(TestCtorPRNGNoOffset, "MT19937", rngtype=PRNG.MT19937)
+
 class TestCtorQRNG(TestRNGBase):
     def test_ctor(self):
         QRNG(self.rngtype)
@@ -110,12 +116,15 @@ make_test(TestParamsPRNG, "DEFAULT",       rngtype=PRNG.DEFAULT)
 make_test(TestParamsPRNG, "XORWOW",        rngtype=PRNG.XORWOW)
 make_test(TestParamsPRNG, "MRG32K3A",      rngtype=PRNG.MRG32K3A)
 make_test(TestParamsPRNG, "PHILOX4_32_10", rngtype=PRNG.PHILOX4_32_10)
+make_test(TestParamsPRNG, "THREEFRY4_32_20", rngtype=PRNG.THREEFRY4_32_20)
+make_test(TestParamsPRNG, "THREEFRY2_64_20", rngtype=PRNG.THREEFRY2_64_20)
+make_test(TestParamsPRNG, "PHILOX4_64_10", rngtype=PRNG.PHILOX4_64_10)
+make_test(TestParamsPRNG, "XOSHIRO128PP", rngtype=PRNG.XOSHIRO128PP)
+make_test(TestParamsPRNG, "PCG32", rngtype=PRNG.PCG32)
 
-class TestParamsPRNGMTGP32(TestRNGBase):
-    rngtype = PRNG.MTGP32
-
+class TestParamsPRNGNoOffset(TestRNGBase):
     def setUp(self):
-        super(TestParamsPRNGMTGP32, self).setUp()
+        super(TestParamsPRNGNoOffset, self).setUp()
         self.rng = PRNG(self.rngtype)
 
     def tearDown(self):
@@ -133,6 +142,9 @@ class TestParamsPRNGMTGP32(TestRNGBase):
         with self.assertRaises(RocRandError):
             self.rng.offset = 2323423
 
+make_test(TestParamsPRNGNoOffset, "MTGP32",  rngtype=PRNG.MTGP32)
+make_test(TestParamsPRNGNoOffset, "MT19937", rngtype=PRNG.MT19937)
+
 class TestParamsQRNG(TestRNGBase):
     def setUp(self):
         super(TestParamsQRNG, self).setUp()
@@ -269,11 +281,59 @@ class TestGenerate(TestRNGBase):
         self.assertTrue((output[:OUTPUT_SIZE] <= 1.0).all())
         self.assertTrue((output[OUTPUT_SIZE:] == 10.0).all())
 
+    def test_async(self):
+        output = np.full(OUTPUT_SIZE * 2, 10.0, dtype=np.float32)
+        future = self.rng.uniform(output, size=OUTPUT_SIZE, async_=True)
+        future.wait()
+        self.assertTrue(future.done())
+
+        self.assertTrue((output[:OUTPUT_SIZE] <= 1.0).all())
+        self.assertTrue((output[OUTPUT_SIZE:] == 10.0).all())
+        self.assertAlmostEqual(output[:OUTPUT_SIZE].mean(), 0.5, delta=0.2)
+
+        # The staging buffer is reused
+        output2 = np.empty(OUTPUT_SIZE, dtype=np.float32)
+        self.rng.uniform(output2, async_=True).wait()
+        self.assertTrue((output2 <= 1.0).all())
+
+        doutput = empty(OUTPUT_SIZE, np.uint32)
+        self.rng.generate(doutput, async_=True).wait()
+
+    def test_array_interface(self):
+        doutput = empty(OUTPUT_SIZE, np.float32)
+        self.rng.uniform(ArrayInterface(doutput))
+        output = doutput.copy_to_host()
+
+        self.assertTrue(((output > 0.0) & (output <= 1.0)).all())
+        self.assertAlmostEqual(output.mean(), 0.5, delta=0.2)
+
+        with self.assertRaises(ValueError):
+            self.rng.uniform(ArrayInterface(doutput, strides=(8,)))
+
+class ArrayInterface(object):
+    """Device array of another library which exposes __cuda_array_interface__"""
+
+    def __init__(self, dary, strides=None):
+        self.dary = dary
+        self.__cuda_array_interface__ = {
+            "shape": dary.shape,
+            "typestr": dary.dtype.str,
+            "data": (dary.data.ptr.value, False),
+            "strides": strides,
+            "version": 2
+        }
+
 make_test(TestGenerate, "PRNG" + "DEFAULT",       klass=PRNG, rngtype=PRNG.DEFAULT)
 make_test(TestGenerate, "PRNG" + "XORWOW",        klass=PRNG, rngtype=PRNG.XORWOW)
 make_test(TestGenerate, "PRNG" + "MRG32K3A",      klass=PRNG, rngtype=PRNG.MRG32K3A)
 make_test(TestGenerate, "PRNG" + "MTGP32",        klass=PRNG, rngtype=PRNG.MTGP32)
 make_test(TestGenerate, "PRNG" + "PHILOX4_32_10", klass=PRNG, rngtype=PRNG.PHILOX4_32_10)
+make_test(TestGenerate, "PRNG" + "THREEFRY4_32_20", klass=PRNG, rngtype=PRNG.THREEFRY4_32_20)
+make_test(TestGenerate, "PRNG" + "THREEFRY2_64_20", klass=PRNG, rngtype=PRNG.THREEFRY2_64_20)
+make_test(TestGenerate, "PRNG" + "PHILOX4_64_10", klass=PRNG, rngtype=PRNG.PHILOX4_64_10)
+make_test(TestGenerate, "PRNG" + "XOSHIRO128PP", klass=PRNG, rngtype=PRNG.XOSHIRO128PP)
+make_test(TestGenerate, "PRNG" + "PCG32", klass=PRNG, rngtype=PRNG.PCG32)
+make_test(TestGenerate, "PRNG" + "MT19937", klass=PRNG, rngtype=PRNG.MT19937)
 make_test(TestGenerate, "QRNG" + "DEFAULT",       klass=QRNG, rngtype=QRNG.DEFAULT)
 make_test(TestGenerate, "QRNG" + "SOBOL32",       klass=QRNG, rngtype=QRNG.SOBOL32)
 
@@ -0,0 +1,297 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Streams random numbers of a generator to a file or to stdout, for example
+// for PractRand or TestU01 reading from a pipe:
+//
+//   rocrand_stream --engine xorwow --size 0 | RNG_test stdin32
+//
+// Chunks are generated into two device buffers and copied asynchronously
+// to two pinned staging buffers, so generation and copies of the next chunk
+// overlap writing of the current one. Output is written in large blocks,
+// optionally with O_DIRECT when the output is a file.
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "cmdparser.hpp"
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cerr << error << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status status = condition;           \
+    if(status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cerr << status << std::endl; \
+        exit(status); \
+    } \
+  }
+
+// Writes all bytes, returns false if the output is closed (for example
+// the reading end of a pipe stopped reading) or on errors
+bool write_all(int fd, const char * data, size_t bytes)
+{
+    while(bytes > 0)
+    {
+        const ssize_t written = write(fd, data, bytes);
+        if(written < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            if(errno != EPIPE)
+                std::cerr << "Error: write failed: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+        data += written;
+        bytes -= written;
+    }
+    return true;
+}
+
+bool parse_engine(const std::string& engine, rocrand_rng_type& rng_type)
+{
+    if(engine == "philox") rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+    else if(engine == "mrg32k3a") rng_type = ROCRAND_RNG_PSEUDO_MRG32K3A;
+    else if(engine == "xorwow") rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+    else if(engine == "mtgp32") rng_type = ROCRAND_RNG_PSEUDO_MTGP32;
+    else if(engine == "sobol32") rng_type = ROCRAND_RNG_QUASI_SOBOL32;
+    else if(engine == "scrambled_sobol32") rng_type = ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32;
+    else return false;
+    return true;
+}
+
+bool parse_distribution(const std::string& distribution,
+                        rocrand_distribution& d, size_t& value_size)
+{
+    if(distribution == "uint")
+    {
+        d = ROCRAND_DISTRIBUTION_UNIFORM_UINT; value_size = sizeof(unsigned int);
+    }
+    else if(distribution == "uniform-float")
+    {
+        d = ROCRAND_DISTRIBUTION_UNIFORM_FLOAT; value_size = sizeof(float);
+    }
+    else if(distribution == "uniform-double")
+    {
+        d = ROCRAND_DISTRIBUTION_UNIFORM_DOUBLE; value_size = sizeof(double);
+    }
+    else if(distribution == "normal-float")
+    {
+        d = ROCRAND_DISTRIBUTION_NORMAL_FLOAT; value_size = sizeof(float);
+    }
+    else if(distribution == "normal-double")
+    {
+        d = ROCRAND_DISTRIBUTION_NORMAL_DOUBLE; value_size = sizeof(double);
+    }
+    else if(distribution == "log-normal-float")
+    {
+        d = ROCRAND_DISTRIBUTION_LOG_NORMAL_FLOAT; value_size = sizeof(float);
+    }
+    else if(distribution == "log-normal-double")
+    {
+        d = ROCRAND_DISTRIBUTION_LOG_NORMAL_DOUBLE; value_size = sizeof(double);
+    }
+    else if(distribution == "poisson")
+    {
+        d = ROCRAND_DISTRIBUTION_POISSON; value_size = sizeof(unsigned int);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    parser.set_optional<std::string>("engine", "engine", "philox", "random number engine");
+    parser.set_optional<std::string>("dis", "dis", "uint",
+        "distribution: uint, uniform-float, uniform-double, normal-float, normal-double, "
+        "log-normal-float, log-normal-double, poisson");
+    parser.set_optional<std::string>("output", "output", "-", "output file, - for stdout");
+    parser.set_optional<size_t>("size", "size", 1024, "MiB to write, 0 to write until the output is closed");
+    parser.set_optional<size_t>("chunk", "chunk", 64, "MiB of a chunk (generation and write block)");
+    parser.set_optional<size_t>("seed", "seed", 0, "seed, 0 for the default seed");
+    parser.set_optional<double>("mean", "mean", 0.0, "mean of normal and log-normal distributions");
+    parser.set_optional<double>("stddev", "stddev", 1.0, "standard deviation of normal and log-normal distributions");
+    parser.set_optional<double>("lambda", "lambda", 100.0, "lambda of the Poisson distribution");
+    parser.set_optional<bool>("direct", "direct", false, "write the output file with O_DIRECT");
+    parser.run_and_exit_if_error();
+
+    rocrand_rng_type rng_type;
+    if(!parse_engine(parser.get<std::string>("engine"), rng_type))
+    {
+        std::cerr << "Error: unknown random number engine '"
+                  << parser.get<std::string>("engine") << "'" << std::endl;
+        return -1;
+    }
+    rocrand_distribution distribution;
+    size_t value_size;
+    if(!parse_distribution(parser.get<std::string>("dis"), distribution, value_size))
+    {
+        std::cerr << "Error: unknown distribution '"
+                  << parser.get<std::string>("dis") << "'" << std::endl;
+        return -1;
+    }
+
+    const std::string output = parser.get<std::string>("output");
+    const size_t total_bytes = parser.get<size_t>("size") * 1024 * 1024;
+    // MiB chunks are multiples of value sizes and of O_DIRECT alignment
+    const size_t chunk_bytes = std::max<size_t>(parser.get<size_t>("chunk"), 1) * 1024 * 1024;
+    const size_t chunk_size = chunk_bytes / value_size;
+    const bool direct = parser.get<bool>("direct");
+
+    int fd = STDOUT_FILENO;
+    if(output != "-")
+    {
+        int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef O_DIRECT
+        if(direct) flags |= O_DIRECT;
+#endif
+        fd = open(output.c_str(), flags, 0644);
+        if(fd < 0)
+        {
+            std::cerr << "Error: output file could not be opened: "
+                      << std::strerror(errno) << std::endl;
+            return -1;
+        }
+    }
+    // A closed pipe stops the stream instead of killing the process
+    signal(SIGPIPE, SIG_IGN);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    if(parser.get<size_t>("seed") != 0)
+    {
+        ROCRAND_CHECK(rocrand_set_seed(generator, parser.get<size_t>("seed")));
+    }
+    hipStream_t stream;
+    hipStream_t copy_stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    HIP_CHECK(hipStreamCreateWithFlags(&copy_stream, hipStreamNonBlocking));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+
+    // Pinned buffers are page-aligned, as O_DIRECT requires
+    void * buffers[2];
+    char * staging[2];
+    hipEvent_t generated[2];
+    hipEvent_t copied[2];
+    for(int i = 0; i < 2; i++)
+    {
+        HIP_CHECK(hipMalloc(&buffers[i], chunk_bytes));
+        HIP_CHECK(hipHostMalloc((void **)&staging[i], chunk_bytes));
+        HIP_CHECK(hipEventCreateWithFlags(&generated[i], hipEventDisableTiming));
+        HIP_CHECK(hipEventCreateWithFlags(&copied[i], hipEventDisableTiming));
+    }
+
+    rocrand_generate_request request;
+    request.distribution = distribution;
+    request.mean = parser.get<double>("mean");
+    request.stddev = parser.get<double>("stddev");
+    request.lambda = parser.get<double>("lambda");
+
+    // Generation and copy of chunk k are enqueued, then chunk k - 1 is written
+    // while the device works on chunk k
+    const auto start = std::chrono::high_resolution_clock::now();
+    size_t written = 0;
+    size_t enqueued = 0;
+    size_t pending_bytes = 0;
+    bool open_output = true;
+    for(size_t k = 0; open_output; k++)
+    {
+        const int b = static_cast<int>(k % 2);
+        const size_t bytes = total_bytes == 0
+            ? chunk_bytes
+            : std::min(chunk_bytes, total_bytes - enqueued);
+        if(bytes > 0)
+        {
+            request.output_data = buffers[b];
+            request.n = (bytes + value_size - 1) / value_size;
+            // The device buffer is reused after the copy of chunk k - 2
+            HIP_CHECK(hipStreamWaitEvent(stream, copied[b], 0));
+            ROCRAND_CHECK(rocrand_generate_batch(generator, &request, 1));
+            HIP_CHECK(hipEventRecord(generated[b], stream));
+            HIP_CHECK(hipStreamWaitEvent(copy_stream, generated[b], 0));
+            HIP_CHECK(hipMemcpyAsync(staging[b], buffers[b], bytes,
+                                     hipMemcpyDeviceToHost, copy_stream));
+            HIP_CHECK(hipEventRecord(copied[b], copy_stream));
+            enqueued += bytes;
+        }
+
+        if(pending_bytes > 0)
+        {
+            const int p = 1 - b;
+            HIP_CHECK(hipEventSynchronize(copied[p]));
+#ifdef O_DIRECT
+            // The last block may be not aligned to the O_DIRECT block size
+            if(direct && fd != STDOUT_FILENO && pending_bytes < chunk_bytes)
+                fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_DIRECT);
+#endif
+            open_output = write_all(fd, staging[p], pending_bytes);
+            if(open_output)
+                written += pending_bytes;
+        }
+        pending_bytes = bytes;
+        if(bytes == 0)
+            break;
+    }
+
+    const auto end = std::chrono::high_resolution_clock::now();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    std::cerr << "Written " << written / (1024 * 1024) << " MiB in "
+              << seconds << " s, "
+              << (seconds > 0 ? written / seconds / (1024 * 1024) : 0.0) << " MiB/s"
+              << std::endl;
+
+    HIP_CHECK(hipStreamSynchronize(copy_stream));
+    for(int i = 0; i < 2; i++)
+    {
+        HIP_CHECK(hipFree(buffers[i]));
+        HIP_CHECK(hipHostFree(staging[i]));
+        HIP_CHECK(hipEventDestroy(generated[i]));
+        HIP_CHECK(hipEventDestroy(copied[i]));
+    }
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipStreamDestroy(copy_stream));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    if(fd != STDOUT_FILENO)
+        close(fd);
+    return 0;
+}
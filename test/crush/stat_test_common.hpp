@@ -111,28 +111,90 @@ void save_points_plots(const size_t size,
     }
 }
 
+// Cells of histograms of chi-squared tests, the same for all first level tests
+struct histogram_layout
+{
+    double start;
+    std::vector<size_t> cells_counts;
+    std::vector<double> cell_widths;
+};
+
 template<typename T>
-void analyze(const size_t size,
-             const size_t level1_tests,
-             const T * data,
-             const bool save_plots,
-             const std::string plot_name,
-             const double mean, const double stddev,
-             const distribution_func_type& distribution_func)__attribute__((cpu))
+histogram_layout get_histogram_layout(const double mean, const double stddev)
 {
-    if (save_plots)
+    histogram_layout layout;
+
+    layout.start = (mean - 6.0 * stddev);
+    if (std::is_integral<T>::value)
     {
-        save_points_plots(size, level1_tests, data, plot_name);
+        // Use integral values for discrete distributions (e.g. Poisson)
+        layout.start = std::floor(layout.start);
     }
 
-    const double alpha = 0.05;
+    layout.cells_counts = std::vector<size_t>({ 1000, 100, 25 });
+    for (size_t cells_count : layout.cells_counts)
+    {
+        double cell_width = 12.0 * stddev / cells_count;
+        if (std::is_integral<T>::value)
+        {
+            // Use integral values for discrete distributions (e.g. Poisson)
+            cell_width = std::ceil(cell_width);
+        }
+        layout.cell_widths.push_back(cell_width);
+    }
+    return layout;
+}
 
-    double start = (mean - 6.0 * stddev);
-    if (std::is_integral<T>::value)
+// Mean, standard deviation and numbers of values in cells of histograms
+// (counts[test][cell]) of one first level test
+struct level1_statistics
+{
+    double mean;
+    double stddev;
+    std::vector<std::vector<long>> counts;
+};
+
+template<typename T>
+level1_statistics get_statistics(const T * values, const size_t size,
+                                 const histogram_layout& layout)
+{
+    level1_statistics stats;
+    stats.mean = get_mean(values, size);
+    stats.stddev = get_stddev(values, size, stats.mean);
+
+    for (size_t test = 0; test < layout.cells_counts.size(); test++)
     {
-        // Use integral values for discrete distributions (e.g. Poisson)
-        start = std::floor(start);
+        const size_t cells_count = layout.cells_counts[test];
+        std::vector<long> count(cells_count, 0);
+
+        for (size_t si = 0; si < size; si++)
+        {
+            const double v = values[si];
+            const long cell = static_cast<long>((v - layout.start) / layout.cell_widths[test]);
+            if (cell >= 0 && cell < static_cast<long>(cells_count))
+            {
+                count[cell]++;
+            }
+        }
+        stats.counts.push_back(count);
     }
+    return stats;
+}
+
+// Prints results of chi-squared tests of first level tests and
+// of Anderson-Darling tests of their p-values
+inline void analyze_statistics(const size_t size,
+                               const size_t level1_tests,
+                               const histogram_layout& layout,
+                               const std::vector<level1_statistics>& level1_stats,
+                               const bool save_plots,
+                               const std::string plot_name,
+                               const double mean, const double stddev,
+                               const distribution_func_type& distribution_func)
+{
+    const double alpha = 0.05;
+
+    const double start = layout.start;
 
     struct test_param
     {
@@ -150,7 +212,7 @@ void analyze(const size_t size,
         long nb_classes;
     };
 
-    const std::vector<size_t> max_cells_counts({ 1000, 100, 25 });
+    const std::vector<size_t>& max_cells_counts = layout.cells_counts;
     const size_t tests = max_cells_counts.size();
 
     std::vector<test_param> ts(tests);
@@ -161,12 +223,7 @@ void analyze(const size_t size,
 
         const size_t cells_count = max_cells_counts[test];
 
-        t.cell_width = 12.0 * stddev / cells_count;
-        if (std::is_integral<T>::value)
-        {
-            // Use integral values for discrete distributions (e.g. Poisson)
-            t.cell_width = std::ceil(t.cell_width);
-        }
+        t.cell_width = layout.cell_widths[test];
 
         t.nb_exp.resize(cells_count);
         t.xs.resize(cells_count);
@@ -249,8 +306,8 @@ void analyze(const size_t size,
     {
         std::cout << "  ";
         std::cout << std::setw(w0) << level1_test;
-        const double test_mean = get_mean(&data[level1_test * size], size);
-        const double test_stddev = get_stddev(&data[level1_test * size], size, test_mean);
+        const double test_mean = level1_stats[level1_test].mean;
+        const double test_stddev = level1_stats[level1_test].stddev;
         std::cout << std::setw(w) << std::fixed << std::setprecision(3) << test_mean;
         std::cout << std::setw(w) << std::fixed << std::setprecision(3) << test_stddev;
 
@@ -259,17 +316,8 @@ void analyze(const size_t size,
             test_param& t = ts[test];
 
             const size_t cells_count = max_cells_counts[test];
-            std::vector<long> count(cells_count, 0);
+            std::vector<long> count = level1_stats[level1_test].counts[test];
 
-            for (size_t si = 0; si < size; si++)
-            {
-                const double v = data[level1_test * size + si];
-                const long cell = static_cast<long>((v - start) / t.cell_width);
-                if (cell >= 0 && cell < static_cast<long>(cells_count))
-                {
-                    count[cell]++;
-                }
-            }
             for (long s = 0; s < static_cast<long>(cells_count); s++)
             {
                 const long j = t.loc[s];
@@ -362,4 +410,29 @@ void analyze(const size_t size,
     std::cout << std::endl;
 }
 
+template<typename T>
+void analyze(const size_t size,
+             const size_t level1_tests,
+             const T * data,
+             const bool save_plots,
+             const std::string plot_name,
+             const double mean, const double stddev,
+             const distribution_func_type& distribution_func)__attribute__((cpu))
+{
+    if (save_plots)
+    {
+        save_points_plots(size, level1_tests, data, plot_name);
+    }
+
+    const histogram_layout layout = get_histogram_layout<T>(mean, stddev);
+    std::vector<level1_statistics> level1_stats;
+    for (size_t level1_test = 0; level1_test < level1_tests; level1_test++)
+    {
+        level1_stats.push_back(get_statistics(&data[level1_test * size], size, layout));
+    }
+
+    analyze_statistics(size, level1_tests, layout, level1_stats,
+                       save_plots, plot_name, mean, stddev, distribution_func);
+}
+
 #endif // STAT_TEST_COMMON_H_
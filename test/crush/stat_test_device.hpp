@@ -0,0 +1,295 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef STAT_TEST_DEVICE_H_
+#define STAT_TEST_DEVICE_H_
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+
+#include "stat_test_common.hpp"
+
+// Device versions of statistics of stat_test_common.hpp: moments and
+// histograms of all first level tests are computed by kernels directly
+// from generated values, only the results are copied to the host. Values
+// are generated and accumulated in chunks, so sizes of tests are not
+// limited by device memory.
+
+constexpr unsigned int stat_test_threads = 256;
+// Blocks of one first level test
+constexpr unsigned int stat_test_max_blocks = 256;
+// Histograms and cells of all chi-squared tests (see histogram_layout)
+constexpr unsigned int stat_test_max_histograms = 4;
+constexpr unsigned int stat_test_max_cells = 2048;
+
+struct device_histogram_layout
+{
+    double start;
+    double cell_widths[stat_test_max_histograms];
+    unsigned int cells_counts[stat_test_max_histograms];
+    // Index of the first cell of each histogram in counts
+    unsigned int offsets[stat_test_max_histograms];
+    unsigned int histograms;
+    unsigned int cells;
+};
+
+inline void stat_test_hip_check(const hipError_t error, const int line)
+{
+    if(error != hipSuccess)
+    {
+        std::cout << "HIP error: " << error << " line: " << line << std::endl;
+        exit(error);
+    }
+}
+
+__device__ inline
+double block_sum(double value, double * shared)
+{
+    shared[hipThreadIdx_x] = value;
+    __syncthreads();
+    for(unsigned int i = stat_test_threads / 2; i > 0; i /= 2)
+    {
+        if(hipThreadIdx_x < i)
+        {
+            shared[hipThreadIdx_x] += shared[hipThreadIdx_x + i];
+        }
+        __syncthreads();
+    }
+    return shared[0];
+}
+
+// Sums deviations from shift and their squares and counts values in cells
+// of all histograms of each first level test (hipBlockIdx_y) of a chunk
+// of chunk_size values of every test, results of chunks are accumulated
+// by atomics, cells are counted in shared memory
+template<typename T>
+__global__
+__launch_bounds__(stat_test_threads)
+void statistics_kernel(const T * data, const size_t chunk_size,
+                       const double shift,
+                       const device_histogram_layout layout,
+                       double * sums,
+                       double * squares,
+                       unsigned long long * counts)
+{
+    __shared__ double shared[stat_test_threads];
+    __shared__ unsigned int shared_counts[stat_test_max_cells];
+
+    for(unsigned int c = hipThreadIdx_x; c < layout.cells; c += stat_test_threads)
+    {
+        shared_counts[c] = 0;
+    }
+    __syncthreads();
+
+    const T * values = data + hipBlockIdx_y * chunk_size;
+    const size_t stride = static_cast<size_t>(hipGridDim_x) * stat_test_threads;
+    double sum = 0.0;
+    double square = 0.0;
+    for(size_t i = hipBlockIdx_x * stat_test_threads + hipThreadIdx_x; i < chunk_size; i += stride)
+    {
+        const double v = static_cast<double>(values[i]);
+        sum += v - shift;
+        square += (v - shift) * (v - shift);
+        for(unsigned int h = 0; h < layout.histograms; h++)
+        {
+            // The same cells as of get_statistics() (truncation towards zero)
+            const double cell = (v - layout.start) / layout.cell_widths[h];
+            if(cell > -1.0 && cell < layout.cells_counts[h])
+            {
+                atomicAdd(&shared_counts[layout.offsets[h] + static_cast<unsigned int>(cell)], 1U);
+            }
+        }
+    }
+    sum = block_sum(sum, shared);
+    __syncthreads();
+    square = block_sum(square, shared);
+    if(hipThreadIdx_x == 0)
+    {
+        atomicAdd(&sums[hipBlockIdx_y], sum);
+        atomicAdd(&squares[hipBlockIdx_y], square);
+    }
+
+    unsigned long long * test_counts = counts + hipBlockIdx_y * layout.cells;
+    for(unsigned int c = hipThreadIdx_x; c < layout.cells; c += stat_test_threads)
+    {
+        if(shared_counts[c] > 0)
+        {
+            atomicAdd(&test_counts[c], static_cast<unsigned long long>(shared_counts[c]));
+        }
+    }
+}
+
+// The same statistics as get_statistics() of all first level tests,
+// accumulated from chunks of values in device memory, so the values of all
+// tests are not stored at once. Moments are accumulated as deviations from
+// shift (the expected mean) to keep the variance accurate in one pass.
+template<typename T>
+class device_statistics
+{
+public:
+
+    device_statistics(const size_t level1_tests,
+                      const histogram_layout& layout,
+                      const double shift)
+        : level1_tests(level1_tests), shift(shift), d_layout()
+    {
+        d_layout.start = layout.start;
+        d_layout.histograms = static_cast<unsigned int>(layout.cells_counts.size());
+        if(d_layout.histograms > stat_test_max_histograms)
+        {
+            std::cout << "Too many histograms" << std::endl;
+            exit(1);
+        }
+        for(unsigned int h = 0; h < d_layout.histograms; h++)
+        {
+            d_layout.cell_widths[h] = layout.cell_widths[h];
+            d_layout.cells_counts[h] = static_cast<unsigned int>(layout.cells_counts[h]);
+            d_layout.offsets[h] = d_layout.cells;
+            d_layout.cells += d_layout.cells_counts[h];
+        }
+        if(d_layout.cells > stat_test_max_cells)
+        {
+            std::cout << "Too many cells of histograms" << std::endl;
+            exit(1);
+        }
+
+        counts_size = level1_tests * d_layout.cells;
+        stat_test_hip_check(hipMalloc((void **)&sums, level1_tests * sizeof(double)), __LINE__);
+        stat_test_hip_check(hipMalloc((void **)&squares, level1_tests * sizeof(double)), __LINE__);
+        stat_test_hip_check(hipMalloc((void **)&counts, counts_size * sizeof(unsigned long long)), __LINE__);
+        stat_test_hip_check(hipMemset(sums, 0, level1_tests * sizeof(double)), __LINE__);
+        stat_test_hip_check(hipMemset(squares, 0, level1_tests * sizeof(double)), __LINE__);
+        stat_test_hip_check(hipMemset(counts, 0, counts_size * sizeof(unsigned long long)), __LINE__);
+    }
+
+    ~device_statistics()
+    {
+        stat_test_hip_check(hipFree(sums), __LINE__);
+        stat_test_hip_check(hipFree(squares), __LINE__);
+        stat_test_hip_check(hipFree(counts), __LINE__);
+    }
+
+    device_statistics(const device_statistics&) = delete;
+    device_statistics& operator=(const device_statistics&) = delete;
+
+    // Adds a chunk of chunk_size values of every first level test
+    // (chunk_size * level1_tests values in device memory)
+    void add(const T * d_data, const size_t chunk_size)
+    {
+        const unsigned int blocks = static_cast<unsigned int>(std::min<size_t>(
+            (chunk_size + stat_test_threads - 1) / stat_test_threads, stat_test_max_blocks
+        ));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(statistics_kernel),
+            dim3(blocks, static_cast<unsigned int>(level1_tests)),
+            dim3(stat_test_threads), 0, 0,
+            d_data, chunk_size, shift, d_layout, sums, squares, counts
+        );
+        stat_test_hip_check(hipPeekAtLastError(), __LINE__);
+    }
+
+    // Statistics of size values of every first level test
+    std::vector<level1_statistics> get(const size_t size) const
+    {
+        std::vector<double> h_sums(level1_tests);
+        std::vector<double> h_squares(level1_tests);
+        std::vector<unsigned long long> h_counts(counts_size);
+        stat_test_hip_check(hipMemcpy(h_sums.data(), sums, level1_tests * sizeof(double), hipMemcpyDeviceToHost), __LINE__);
+        stat_test_hip_check(hipMemcpy(h_squares.data(), squares, level1_tests * sizeof(double), hipMemcpyDeviceToHost), __LINE__);
+        stat_test_hip_check(hipMemcpy(h_counts.data(), counts, counts_size * sizeof(unsigned long long), hipMemcpyDeviceToHost), __LINE__);
+
+        std::vector<level1_statistics> level1_stats(level1_tests);
+        for(size_t level1_test = 0; level1_test < level1_tests; level1_test++)
+        {
+            level1_statistics& stats = level1_stats[level1_test];
+            const double deviation = h_sums[level1_test] / size;
+            stats.mean = shift + deviation;
+            stats.stddev = std::sqrt(std::max(h_squares[level1_test] / size - deviation * deviation, 0.0));
+            for(unsigned int h = 0; h < d_layout.histograms; h++)
+            {
+                const unsigned long long * first =
+                    h_counts.data() + level1_test * d_layout.cells + d_layout.offsets[h];
+                stats.counts.push_back(std::vector<long>(first, first + d_layout.cells_counts[h]));
+            }
+        }
+        return level1_stats;
+    }
+
+private:
+    size_t level1_tests;
+    double shift;
+    device_histogram_layout d_layout;
+    size_t counts_size;
+    double * sums;
+    double * squares;
+    unsigned long long * counts;
+};
+
+// The same as analyze() of size values of every first level test generated
+// in chunks of at most chunk_size values of every test into d_data by
+// generate_chunk(d_data, n * level1_tests) (n values of each test, test
+// by test), values are copied to the host only for plots
+template<typename T, typename GenerateChunkFunc>
+void analyze_device(const size_t size,
+                    const size_t level1_tests,
+                    const size_t chunk_size,
+                    T * d_data,
+                    const GenerateChunkFunc& generate_chunk,
+                    const bool save_plots,
+                    const std::string plot_name,
+                    const double mean, const double stddev,
+                    const distribution_func_type& distribution_func)
+{
+    const histogram_layout layout = get_histogram_layout<T>(mean, stddev);
+    device_statistics<T> statistics(level1_tests, layout, mean);
+
+    std::vector<T> h_data(save_plots ? size * level1_tests : 0);
+    for(size_t offset = 0; offset < size; offset += chunk_size)
+    {
+        const size_t n = std::min(chunk_size, size - offset);
+        generate_chunk(d_data, n * level1_tests);
+        statistics.add(d_data, n);
+        if(save_plots)
+        {
+            for(size_t level1_test = 0; level1_test < level1_tests; level1_test++)
+            {
+                stat_test_hip_check(hipMemcpy(h_data.data() + level1_test * size + offset,
+                                              d_data + level1_test * n, n * sizeof(T),
+                                              hipMemcpyDeviceToHost), __LINE__);
+            }
+        }
+    }
+
+    const std::vector<level1_statistics> level1_stats = statistics.get(size);
+    if(save_plots)
+    {
+        save_points_plots(size, level1_tests, h_data.data(), plot_name);
+    }
+
+    analyze_statistics(size, level1_tests, layout, level1_stats,
+                       save_plots, plot_name, mean, stddev, distribution_func);
+}
+
+#endif // STAT_TEST_DEVICE_H_
@@ -32,6 +32,7 @@
 #include <rocrand.h>
 
 #include "stat_test_common.hpp"
+#include "stat_test_device.hpp"
 #include "cmdparser.hpp"
 
 extern "C" {
@@ -76,13 +77,21 @@ void run_test(const cli::Parser& parser,
     const size_t level1_tests = parser.get<size_t>("level1-tests");
     const size_t level2_tests = parser.get<size_t>("level2-tests");
     const bool save_plots = parser.get<bool>("plots");
+    const size_t chunk_size = std::max<size_t>(std::min(size, parser.get<size_t>("chunk")), 1);
 
     T * data;
-    HIP_CHECK(hipMalloc((void **)&data, size * level1_tests * sizeof(T)));
+    HIP_CHECK(hipMalloc((void **)&data, chunk_size * level1_tests * sizeof(T)));
 
     rocrand_generator generator;
     ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
 
+    // --math-mode fast checks that the error bounds of __logf and __expf
+    // (see rocrand_set_math_mode()) do not change the distributions
+    if(parser.get<std::string>("math-mode") == "fast")
+    {
+        ROCRAND_CHECK(rocrand_set_math_mode(generator, ROCRAND_MATH_MODE_FAST));
+    }
+
     const size_t dimensions = level1_tests;
     rocrand_status status = rocrand_set_quasi_random_generator_dimensions(generator, dimensions);
     if (status != ROCRAND_STATUS_TYPE_ERROR) // If the RNG is not quasi-random
@@ -92,15 +101,15 @@ void run_test(const cli::Parser& parser,
 
     for (size_t level2_test = 0; level2_test < level2_tests; level2_test++)
     {
-        ROCRAND_CHECK(generate_func(generator, data, size * level1_tests));
-        HIP_CHECK(hipDeviceSynchronize());
-
-        std::vector<T> h_data(size * level1_tests);
-        HIP_CHECK(hipMemcpy(h_data.data(), data, size * level1_tests * sizeof(T), hipMemcpyDeviceToHost));
-
-        analyze(size, level1_tests, h_data.data(),
-                save_plots, plot_name + "-" + std::to_string(level2_test),
-                mean, stddev, distribution_func);
+        // Values are generated in chunks and statistics are computed on
+        // the device, only results are copied
+        analyze_device(size, level1_tests, chunk_size, data,
+                       [&](T * chunk_data, size_t chunk_values)
+                       {
+                           ROCRAND_CHECK(generate_func(generator, chunk_data, chunk_values));
+                       },
+                       save_plots, plot_name + "-" + std::to_string(level2_test),
+                       mean, stddev, distribution_func);
     }
 
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
@@ -236,9 +245,11 @@ int main(int argc, char *argv[])
     parser.set_optional<size_t>("size", "size", 10000, "number of samples in every first level test");
     parser.set_optional<size_t>("level1-tests", "level1-tests", 10, "number of first level tests");
     parser.set_optional<size_t>("level2-tests", "level2-tests", 10, "number of second level tests");
+    parser.set_optional<size_t>("chunk", "chunk", 1 << 20, "number of samples of every first level test generated at once");
     parser.set_optional<std::vector<std::string>>("dis", "dis", {"all"}, distribution_desc.c_str());
     parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
     parser.set_optional<std::vector<double>>("lambda", "lambda", {100.0}, "space-separated list of lambdas of Poisson distribution");
+    parser.set_optional<std::string>("math-mode", "math-mode", "accurate", "precision of normal and log-normal distributions: accurate or fast");
     parser.set_optional<bool>("plots", "plots", false, "Boolean argument to save plots for GnuPlot");
     parser.run_and_exit_if_error();
 
@@ -35,6 +35,7 @@
 #include <rocrand_sobol_precomputed.h>
 
 #include "stat_test_common.hpp"
+#include "stat_test_device.hpp"
 #include "cmdparser.hpp"
 
 extern "C" {
@@ -329,24 +330,25 @@ void run_test(const cli::Parser& parser,
     const size_t threads = parser.get<size_t>("threads");
 
     const size_t dimensions = level1_tests;
+    const size_t chunk_size = std::max<size_t>(std::min(size, parser.get<size_t>("chunk")), 1);
 
     T * data;
-    HIP_CHECK(hipMalloc((void **)&data, size * level1_tests * sizeof(T)));
+    HIP_CHECK(hipMalloc((void **)&data, chunk_size * level1_tests * sizeof(T)));
 
     runner<GeneratorState> r(dimensions, blocks, threads, 0, 0);
 
     for (size_t level2_test = 0; level2_test < level2_tests; level2_test++)
     {
-        r.generate(blocks, threads, data, size * level1_tests, generate_func, extra);
-        HIP_CHECK(hipPeekAtLastError());
-        HIP_CHECK(hipDeviceSynchronize());
-
-        std::vector<T> h_data(size * level1_tests);
-        HIP_CHECK(hipMemcpy(h_data.data(), data, size * level1_tests * sizeof(T), hipMemcpyDeviceToHost));
-
-        analyze(size, level1_tests, h_data.data(),
-                save_plots, plot_name + "-" + std::to_string(level2_test),
-                mean, stddev, distribution_func);
+        // Values are generated in chunks (states are kept between chunks)
+        // and statistics are computed on the device, only results are copied
+        analyze_device(size, level1_tests, chunk_size, data,
+                       [&](T * chunk_data, size_t chunk_values)
+                       {
+                           r.generate(blocks, threads, chunk_data, chunk_values, generate_func, extra);
+                           HIP_CHECK(hipPeekAtLastError());
+                       },
+                       save_plots, plot_name + "-" + std::to_string(level2_test),
+                       mean, stddev, distribution_func);
     }
 
     HIP_CHECK(hipFree(data));
@@ -553,6 +555,7 @@ int main(int argc, char *argv[])
     parser.set_optional<size_t>("size", "size", 10000, "number of samples in every first level test");
     parser.set_optional<size_t>("level1-tests", "level1-tests", 10, "number of first level tests");
     parser.set_optional<size_t>("level2-tests", "level2-tests", 10, "number of second level tests");
+    parser.set_optional<size_t>("chunk", "chunk", 1 << 20, "number of samples of every first level test generated at once");
     parser.set_optional<size_t>("blocks", "blocks", 256, "number of blocks");
     parser.set_optional<size_t>("threads", "threads", 256, "number of threads in each block");
     parser.set_optional<std::vector<std::string>>("dis", "dis", {"all"}, distribution_desc.c_str());
@@ -209,6 +209,27 @@ contains
         call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_destroy_generator(gen))
     end subroutine test_rocrand_generate_poisson
 
+    !> Test rocrand_generate_uniform with a Fortran array in device memory.
+    subroutine test_rocrand_generate_uniform_device_array()
+        integer(kind =8) :: gen
+        real, target, dimension(128) :: h_x
+        type(c_ptr) :: d_ptr
+        real(c_float), pointer, dimension(:) :: d_x
+        integer(c_size_t), parameter :: output_size = 128
+        real, parameter :: mean = 0.5, delta = 0.1
+        call assert_equals(hipSuccess, hipMalloc(d_ptr, output_size * sizeof(h_x(1))))
+        call c_f_pointer(d_ptr, d_x, [output_size])
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_create_generator(gen, &
+        ROCRAND_RNG_PSEUDO_DEFAULT))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_set_stream(gen, c_null_ptr))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_generate_uniform(gen, d_x))
+        call assert_equals(hipSuccess, hipMemcpy(c_loc(h_x), d_ptr, output_size * sizeof(h_x(1)), &
+        hipMemcpyDeviceToHost))
+        call assert_equals((sum(h_x) / output_size), mean, delta)
+        call assert_equals(hipSuccess, hipFree(d_ptr))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_destroy_generator(gen))
+    end subroutine test_rocrand_generate_uniform_device_array
+
     !> Call each test.
     subroutine rocrand_basket()
     character(len=*) :: suite_name
@@ -241,6 +262,9 @@ contains
     call run_fruit_test_case(test_rocrand_generate_poisson,'test_rocrand_generate_poisson',&
         setup,teardown,suite_name)
 
+    call run_fruit_test_case(test_rocrand_generate_uniform_device_array, &
+        'test_rocrand_generate_uniform_device_array',setup,teardown,suite_name)
+
     end subroutine rocrand_basket
 
 end module test_rocrand
@@ -0,0 +1,155 @@
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+"""Performance regression check of rocRAND.
+
+Runs a fixed matrix of benchmark_rocrand_generate, stores the Google Benchmark
+JSON output in --output-dir and compares the median throughput of every
+benchmark with the baseline of the current GPU (--baselines/<device_arch>.json).
+
+Exit codes: 0 - no regressions, 1 - throughput of at least one benchmark
+dropped by more than --threshold percent (or no baseline for this GPU when
+ROCRAND_PERF_REQUIRE_BASELINE is set, as in CI), 77 - no baseline for this GPU.
+
+Baselines are created or refreshed on a quiet machine with --update-baseline.
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+# Engines and distributions checked by the test. Poisson and normal catch
+# regressions of divergent code paths, uniform ones of the engines.
+ENGINES = ['xorwow', 'mrg32k3a', 'mtgp32', 'philox', 'threefry4x32_20', 'sobol32']
+DISTRIBUTIONS = ['uniform-uint', 'uniform-float', 'normal-float', 'poisson']
+SIZE = 16 * 1024 * 1024
+TRIALS = 20
+REPETITIONS = 5
+
+SKIP_RETURN_CODE = 77
+
+
+def run_benchmark(benchmark, output):
+    command = [
+        benchmark,
+        '--engine'] + ENGINES + [
+        '--dis'] + DISTRIBUTIONS + [
+        '--size', str(SIZE),
+        '--trials', str(TRIALS),
+        '--repetitions', str(REPETITIONS),
+        '--benchmark_report_aggregates_only=true',
+        '--benchmark_format=console',
+        '--benchmark_out_format=json',
+        '--benchmark_out=' + output,
+    ]
+    print(' '.join(command))
+    sys.stdout.flush()
+    subprocess.check_call(command)
+    with open(output) as f:
+        return json.load(f)
+
+
+def median_throughputs(results):
+    throughputs = {}
+    for b in results['benchmarks']:
+        if b.get('aggregate_name') == 'median' and 'items_per_second' in b:
+            throughputs[b['run_name']] = b['items_per_second']
+    return throughputs
+
+
+def write_results(path, results, throughputs):
+    with open(path, 'w') as f:
+        json.dump({'device_arch': results['context'].get('device_arch', 'unknown'),
+                   'device_name': results['context'].get('device_name', ''),
+                   'items_per_second': throughputs}, f, indent=2, sort_keys=True)
+        f.write('\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--benchmark', required=True,
+                        help='path to benchmark_rocrand_generate')
+    parser.add_argument('--baselines', required=True,
+                        help='directory of per-GPU baseline files')
+    parser.add_argument('--output-dir', required=True,
+                        help='directory of JSON results')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='maximal allowed throughput drop in percent')
+    parser.add_argument('--update-baseline', action='store_true',
+                        help='store results as the baseline of the current GPU')
+    args = parser.parse_args()
+
+    if not os.path.isdir(args.output_dir):
+        os.makedirs(args.output_dir)
+    raw_output = os.path.join(args.output_dir, 'benchmark_rocrand_generate.json')
+    results = run_benchmark(args.benchmark, raw_output)
+
+    arch = results['context'].get('device_arch', 'unknown')
+    current = median_throughputs(results)
+    # Named by the GPU, so results of several machines can be collected
+    # as artifacts side by side
+    write_results(os.path.join(args.output_dir, arch + '.json'), results, current)
+
+    baseline_path = os.path.join(args.baselines, arch + '.json')
+    if args.update_baseline:
+        write_results(baseline_path, results, current)
+        print('Baseline written to ' + baseline_path)
+        return 0
+
+    if not os.path.exists(baseline_path):
+        # Results of this run have the format of a baseline, CI uploads
+        # them so they can be committed
+        if os.environ.get('ROCRAND_PERF_REQUIRE_BASELINE'):
+            print('No baseline for ' + arch + ' (' + baseline_path + '), commit '
+                  + os.path.join(args.output_dir, arch + '.json') + ' measured on an idle machine')
+            return 1
+        print('No baseline for ' + arch + ' (' + baseline_path + '), skipping')
+        return SKIP_RETURN_CODE
+    with open(baseline_path) as f:
+        baseline = json.load(f)['items_per_second']
+
+    regressions = 0
+    print()
+    print('{:<48} {:>14} {:>14} {:>9}'.format('benchmark', 'baseline', 'current', 'change'))
+    for name in sorted(baseline):
+        if name not in current:
+            print('{:<48} {:>14.4g} {:>14} {:>9}'.format(name, baseline[name], 'missing', ''))
+            regressions += 1
+            continue
+        change = (current[name] / baseline[name] - 1.0) * 100.0
+        regressed = change < -args.threshold
+        print('{:<48} {:>14.4g} {:>14.4g} {:>+8.1f}%{}'.format(
+            name, baseline[name], current[name], change,
+            '  REGRESSION' if regressed else ''))
+        if regressed:
+            regressions += 1
+
+    if regressions > 0:
+        print('{} benchmark(s) regressed by more than {}%'.format(regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
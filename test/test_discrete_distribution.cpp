@@ -0,0 +1,225 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class discrete_distribution_device_tests : public ::testing::TestWithParam<unsigned int> { };
+
+// Tables built on the device must represent the given probabilities exactly:
+// value i gets probability[i] of its own bucket and 1 - probability[j] of
+// every bucket j with alias[j] == i
+TEST_P(discrete_distribution_device_tests, tables_test)
+{
+    const unsigned int size = GetParam();
+    const unsigned int offset = 1234;
+
+    std::mt19937 gen(size);
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    std::vector<double> p(size);
+    double sum = 0.0;
+    for(unsigned int i = 0; i < size; i++)
+    {
+        // Several very likely and many unlikely values
+        p[i] = i % 97 == 0 ? 100.0 * u(gen) : std::pow(u(gen), 4.0);
+        sum += p[i];
+    }
+
+    double * d_p;
+    HIP_CHECK(hipMalloc((void **)&d_p, size * sizeof(double)));
+    HIP_CHECK(hipMemcpy(d_p, p.data(), size * sizeof(double), hipMemcpyHostToDevice));
+
+    rocrand_discrete_distribution dis;
+    ROCRAND_CHECK(rocrand_create_discrete_distribution_device(d_p, size, offset, &dis));
+
+    rocrand_discrete_distribution_st h_dis;
+    HIP_CHECK(hipMemcpy(&h_dis, dis, sizeof(rocrand_discrete_distribution_st), hipMemcpyDeviceToHost));
+    ASSERT_EQ(h_dis.size, size);
+    ASSERT_EQ(h_dis.offset, offset);
+
+    std::vector<double> probability(size);
+    std::vector<unsigned int> alias(size);
+    std::vector<double> cdf(size);
+    std::vector<unsigned long long> packed_alias(size);
+    HIP_CHECK(hipMemcpy(probability.data(), h_dis.probability, size * sizeof(double), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(alias.data(), h_dis.alias, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(cdf.data(), h_dis.cdf, size * sizeof(double), hipMemcpyDeviceToHost));
+    ASSERT_NE(h_dis.packed_alias, (unsigned long long *)NULL);
+    HIP_CHECK(hipMemcpy(packed_alias.data(), h_dis.packed_alias, size * sizeof(unsigned long long), hipMemcpyDeviceToHost));
+    ASSERT_NE(h_dis.guide, (unsigned int *)NULL);
+    ASSERT_GT(h_dis.guide_size, 0U);
+    std::vector<unsigned int> guide(h_dis.guide_size);
+    HIP_CHECK(hipMemcpy(guide.data(), h_dis.guide, h_dis.guide_size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+    std::vector<double> mass(size, 0.0);
+    for(unsigned int i = 0; i < size; i++)
+    {
+        ASSERT_GE(probability[i], -1e-9);
+        ASSERT_LE(probability[i], 1.0 + 1e-9);
+        ASSERT_LT(alias[i], size);
+        mass[i] += probability[i];
+        mass[alias[i]] += 1.0 - probability[i];
+
+        // The packed entry must select the same values up to 2^-32
+        const double packed_probability =
+            static_cast<unsigned int>(packed_alias[i]) / 4294967296.0;
+        const unsigned int packed_alias_i = static_cast<unsigned int>(packed_alias[i] >> 32);
+        EXPECT_NEAR(packed_probability, std::min(std::max(probability[i], 0.0), 1.0), 1e-9);
+        if(probability[i] < 1.0)
+        {
+            EXPECT_EQ(packed_alias_i, alias[i]);
+        }
+        else
+        {
+            EXPECT_EQ(packed_alias_i, i);
+        }
+    }
+    double cdf_expected = 0.0;
+    for(unsigned int i = 0; i < size; i++)
+    {
+        cdf_expected += p[i] / sum;
+        EXPECT_NEAR(mass[i] / size, p[i] / sum, 1e-9);
+        EXPECT_NEAR(cdf[i], cdf_expected, 1e-9);
+    }
+
+    // guide[k] is the first value with cdf >= k / guide_size
+    for(unsigned int k = 0; k < h_dis.guide_size; k++)
+    {
+        const double x = static_cast<double>(k) / h_dis.guide_size;
+        ASSERT_LT(guide[k], size);
+        if(guide[k] > 0)
+        {
+            EXPECT_LT(cdf[guide[k] - 1], x);
+        }
+        if(guide[k] < size - 1)
+        {
+            EXPECT_GE(cdf[guide[k]], x);
+        }
+    }
+
+    HIP_CHECK(hipFree(d_p));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(dis));
+}
+
+INSTANTIATE_TEST_CASE_P(discrete_distribution_device_tests,
+                        discrete_distribution_device_tests,
+                        ::testing::Values(1, 2, 100, 2048, 12345, 1000000));
+
+TEST(discrete_distribution_device_tests, neg_test)
+{
+    rocrand_discrete_distribution dis;
+    EXPECT_EQ(
+        rocrand_create_discrete_distribution_device(NULL, 0, 0, &dis),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_create_discrete_distribution_device(NULL, 10, 0, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+}
+
+// Prefix sums read from the Fenwick tree of an updatable distribution
+// must follow updates of probabilities
+TEST(discrete_distribution_updatable_tests, update_test)
+{
+    const unsigned int size = 12345;
+
+    std::mt19937 gen(size);
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    std::vector<double> p(size);
+    for(unsigned int i = 0; i < size; i++)
+    {
+        p[i] = u(gen);
+    }
+
+    rocrand_discrete_distribution dis;
+    ROCRAND_CHECK(rocrand_create_discrete_distribution_updatable(p.data(), size, 0, &dis));
+
+    std::vector<unsigned int> indices;
+    std::vector<double> new_p;
+    for(unsigned int i = 7; i < size; i += 31)
+    {
+        indices.push_back(i);
+        new_p.push_back(i % 2 == 0 ? 0.0 : 10.0 * u(gen));
+        p[i] = new_p.back();
+    }
+    const unsigned int k = indices.size();
+    unsigned int * d_indices;
+    double * d_new_p;
+    HIP_CHECK(hipMalloc((void **)&d_indices, k * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&d_new_p, k * sizeof(double)));
+    HIP_CHECK(hipMemcpy(d_indices, indices.data(), k * sizeof(unsigned int), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_new_p, new_p.data(), k * sizeof(double), hipMemcpyHostToDevice));
+    ROCRAND_CHECK(rocrand_update_discrete_distribution(dis, d_indices, d_new_p, k));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_discrete_distribution_st h_dis;
+    HIP_CHECK(hipMemcpy(&h_dis, dis, sizeof(rocrand_discrete_distribution_st), hipMemcpyDeviceToHost));
+    ASSERT_NE(h_dis.tree, (double *)NULL);
+    std::vector<double> tree(size + 1);
+    HIP_CHECK(hipMemcpy(tree.data(), h_dis.tree, (size + 1) * sizeof(double), hipMemcpyDeviceToHost));
+
+    double sum = 0.0;
+    for(unsigned int i = 1; i <= size; i++)
+    {
+        sum += p[i - 1];
+        double prefix = 0.0;
+        for(unsigned int j = i; j > 0; j -= j & (~j + 1))
+        {
+            prefix += tree[j - 1];
+        }
+        ASSERT_NEAR(prefix, sum, 1e-8);
+    }
+    EXPECT_NEAR(tree[size], sum, 1e-8);
+
+    HIP_CHECK(hipFree(d_indices));
+    HIP_CHECK(hipFree(d_new_p));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(dis));
+}
+
+TEST(discrete_distribution_updatable_tests, neg_test)
+{
+    EXPECT_EQ(
+        rocrand_update_discrete_distribution(NULL, NULL, NULL, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    // Distributions with alias tables can not be updated
+    const double p[] = { 1.0, 2.0 };
+    rocrand_discrete_distribution dis;
+    ROCRAND_CHECK(rocrand_create_discrete_distribution(p, 2, 0, &dis));
+    EXPECT_EQ(
+        rocrand_update_discrete_distribution(dis, NULL, NULL, 0),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(dis));
+}
@@ -82,6 +82,11 @@ TEST(hiprand, hiprand_generate_test_mtgp32)
     hiprand_generate_test_func<HIPRAND_RNG_PSEUDO_MTGP32>();
 }
 
+TEST(hiprand, hiprand_generate_test_mt19937)
+{
+    hiprand_generate_test_func<HIPRAND_RNG_PSEUDO_MT19937>();
+}
+
 TEST(hiprand, hiprand_generate_test_philox)
 {
     hiprand_generate_test_func<HIPRAND_RNG_PSEUDO_PHILOX4_32_10>();
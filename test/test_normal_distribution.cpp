@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <random>
 
 #include <rng/distribution/normal.hpp>
@@ -131,3 +132,82 @@ TEST(normal_distribution_tests, double_test)
     EXPECT_NEAR(1.0f, mean, 0.2); // 20%
     EXPECT_NEAR(2.0f, std, 0.4); // 20%
 }
+
+// Quantile of the upper tail mass r (0 < r <= 0.5) by bisection and Newton
+// steps in long double, a series is used near the median where erfc
+// can not resolve r
+long double normal_quantile_reference(const long double r)
+{
+    const long double sqrt2 = std::sqrt(2.0L);
+    const long double sqrt2pi = std::sqrt(2.0L * 3.14159265358979323846264338327950288L);
+    const long double e = 0.5L - r;
+    if(e < 1e-5L)
+    {
+        const long double a = sqrt2pi * e;
+        return a + a * a * a / 6 + 7 * a * a * a * a * a / 120;
+    }
+    long double lo = 0.0L;
+    long double hi = 40.0L;
+    for(int i = 0; i < 100; i++)
+    {
+        const long double m = (lo + hi) / 2;
+        (0.5L * std::erfc(m / sqrt2) > r ? lo : hi) = m;
+    }
+    long double z = (lo + hi) / 2;
+    for(int i = 0; i < 2; i++)
+    {
+        z += (0.5L * std::erfc(z / sqrt2) - r) * sqrt2pi * std::exp(z * z / 2);
+    }
+    return z;
+}
+
+// Relative errors of the inverse normal CDF of 32-bit numbers (floats and
+// doubles) and 64-bit numbers (doubles, 53 bits are used), numbers are
+// sampled log-uniformly to cover both tails
+TEST(normal_distribution_tests, inverse_cdf_accuracy_test)
+{
+    std::mt19937_64 gen(1234);
+    std::uniform_real_distribution<double> bits(0.0, 63.9);
+
+    double max_float_error = 0.0;
+    double max_double_error = 0.0;
+    double max_double64_error = 0.0;
+    for(size_t i = 0; i < 20000; i++)
+    {
+        const unsigned long long r = i % 2 == 0 ? gen() : static_cast<unsigned long long>(std::exp2(bits(gen)));
+        const unsigned long long v64 = i % 4 < 2 ? r : ~r;
+        const unsigned int v32 = static_cast<unsigned int>(i % 4 < 2 ? r : ~r >> 32);
+
+        // p = (v + 0.5) / 2^32
+        const long double p32 = (static_cast<long double>(v32) + 0.5L) * std::ldexp(1.0L, -32);
+        const long double z32 = p32 < 0.5L ? -normal_quantile_reference(p32) : normal_quantile_reference(1.0L - p32);
+        const float f = rocrand_device::detail::normal_inverse_cdf(v32);
+        const double d = rocrand_device::detail::normal_inverse_cdf_double(v32);
+        max_float_error = std::max(max_float_error, static_cast<double>(std::abs((f - z32) / z32)));
+        max_double_error = std::max(max_double_error, static_cast<double>(std::abs((d - z32) / z32)));
+
+        // p = (v / 2^11 + 0.5) / 2^53
+        const long double p64 = (static_cast<long double>(v64 >> 11) + 0.5L) * std::ldexp(1.0L, -53);
+        const long double z64 = p64 < 0.5L ? -normal_quantile_reference(p64) : normal_quantile_reference(1.0L - p64);
+        const double d64 = rocrand_device::detail::normal_inverse_cdf_double(v64);
+        max_double64_error = std::max(max_double64_error, static_cast<double>(std::abs((d64 - z64) / z64)));
+
+        // The tails are folded, so the results are exactly symmetric
+        ASSERT_EQ(f, -rocrand_device::detail::normal_inverse_cdf(~v32));
+        ASSERT_EQ(d64, -rocrand_device::detail::normal_inverse_cdf_double(~v64));
+    }
+
+    EXPECT_LT(max_float_error, 4e-7);
+    EXPECT_LT(max_double_error, 2e-15);
+    EXPECT_LT(max_double64_error, 2e-15);
+}
+
+TEST(normal_distribution_tests, inverse_cdf_extremes_test)
+{
+    // The smallest and the largest probabilities 2^-33 and 1 - 2^-33
+    EXPECT_NEAR(rocrand_device::detail::normal_inverse_cdf(0U), -6.3379575, 1e-5);
+    EXPECT_NEAR(rocrand_device::detail::normal_inverse_cdf(0xffffffffU), 6.3379575, 1e-5);
+    EXPECT_NEAR(rocrand_device::detail::normal_inverse_cdf_double(0ULL), -8.2923610758135951, 1e-13);
+    EXPECT_NEAR(rocrand_device::detail::normal_inverse_cdf_double(~0ULL), 8.2923610758135951, 1e-13);
+    EXPECT_NEAR(rocrand_device::detail::roc_d_erfinv(0.5), 0.47693627620446987, 1e-15);
+}
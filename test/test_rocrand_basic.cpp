@@ -19,11 +19,15 @@
 // THE SOFTWARE.
 
 #include <stdio.h>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
+#include <rng/generator_state.hpp>
+
 #define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
 #define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
 
@@ -83,12 +87,900 @@ TEST_P(rocrand_basic_tests, rocrand_initialize_generator_test)
     ROCRAND_CHECK(rocrand_destroy_generator(g));
 }
 
+// Prepared states must give the same numbers as initialization on set_seed
+TEST_P(rocrand_basic_tests, rocrand_prepare_seed_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const bool quasi = rng_type >= ROCRAND_RNG_QUASI_DEFAULT;
+
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_prepare_seed(g, 1), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    if(quasi)
+    {
+        EXPECT_EQ(rocrand_prepare_seed(g, 1), ROCRAND_STATUS_TYPE_ERROR);
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+        return;
+    }
+
+    const size_t size = 123456;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    std::vector<unsigned int> expected(size);
+    std::vector<unsigned int> output(size);
+
+    // Seed 2 with offset 0 and seed 3 with offset 100 (MTGP32 and MT19937
+    // have no offsets)
+    for(unsigned long long seed : { 2ULL, 3ULL })
+    {
+        const bool has_offset = rng_type != ROCRAND_RNG_PSEUDO_MTGP32
+            && rng_type != ROCRAND_RNG_PSEUDO_MT19937;
+        const unsigned long long offset = seed == 3 && has_offset ? 100 : 0;
+        rocrand_generator expected_g;
+        ROCRAND_CHECK(rocrand_create_generator(&expected_g, rng_type));
+        ROCRAND_CHECK(rocrand_set_seed(expected_g, seed));
+        if(has_offset)
+        {
+            ROCRAND_CHECK(rocrand_set_offset(expected_g, offset));
+        }
+        ROCRAND_CHECK(rocrand_generate(expected_g, data, size));
+        HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(expected_g));
+
+        ROCRAND_CHECK(rocrand_set_seed(g, 1));
+        if(has_offset)
+        {
+            ROCRAND_CHECK(rocrand_set_offset(g, 0));
+        }
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        ROCRAND_CHECK(rocrand_prepare_seed(g, seed));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        // The prepared state is discarded when the offset is changed
+        if(has_offset)
+        {
+            ROCRAND_CHECK(rocrand_set_offset(g, offset));
+        }
+        ROCRAND_CHECK(rocrand_set_seed(g, seed));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(output[i], expected[i]);
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_set_ordering_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const bool quasi = rng_type >= ROCRAND_RNG_QUASI_DEFAULT;
+
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_DEFAULT), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_set_ordering(g, static_cast<rocrand_ordering>(0)), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_set_ordering(g, static_cast<rocrand_ordering>(200)), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    const rocrand_ordering pseudo_orders[] = {
+        ROCRAND_ORDERING_PSEUDO_BEST,
+        ROCRAND_ORDERING_PSEUDO_DEFAULT,
+        ROCRAND_ORDERING_PSEUDO_SEEDED,
+        ROCRAND_ORDERING_PSEUDO_LEGACY,
+        ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT
+    };
+    const rocrand_ordering quasi_orders[] = {
+        ROCRAND_ORDERING_QUASI_DEFAULT,
+        ROCRAND_ORDERING_QUASI_POINT_MAJOR
+    };
+    for(rocrand_ordering order : pseudo_orders)
+    {
+        if(quasi)
+        {
+            EXPECT_EQ(rocrand_set_ordering(g, order), ROCRAND_STATUS_TYPE_ERROR);
+        }
+        else
+        {
+            ROCRAND_CHECK(rocrand_set_ordering(g, order));
+            ROCRAND_CHECK(rocrand_initialize_generator(g));
+        }
+    }
+    for(rocrand_ordering order : quasi_orders)
+    {
+        if(quasi)
+        {
+            ROCRAND_CHECK(rocrand_set_ordering(g, order));
+            ROCRAND_CHECK(rocrand_initialize_generator(g));
+        }
+        else
+        {
+            EXPECT_EQ(rocrand_set_ordering(g, order), ROCRAND_STATUS_TYPE_ERROR);
+        }
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_default_ordering_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    if(rng_type >= ROCRAND_RNG_QUASI_DEFAULT)
+    {
+        return;
+    }
+
+    const size_t size = 123457;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    std::vector<unsigned int> expected(size);
+    std::vector<unsigned int> output(size);
+
+    // The default ordering gives the legacy results on every device
+    const rocrand_ordering orders[] = {
+        ROCRAND_ORDERING_PSEUDO_LEGACY,
+        ROCRAND_ORDERING_PSEUDO_DEFAULT
+    };
+    for(rocrand_ordering order : orders)
+    {
+        rocrand_generator g;
+        ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+        if(order != ROCRAND_ORDERING_PSEUDO_DEFAULT)
+        {
+            ROCRAND_CHECK(rocrand_set_ordering(g, order));
+        }
+        ROCRAND_CHECK(rocrand_set_seed(g, 12345));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        std::vector<unsigned int>& host_data =
+            order == ROCRAND_ORDERING_PSEUDO_LEGACY ? expected : output;
+        HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+    }
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(output[i], expected[i]);
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_engine_count_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const bool has_engines = rng_type == ROCRAND_RNG_PSEUDO_XORWOW
+        || rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+        || rng_type == ROCRAND_RNG_PSEUDO_PCG32
+        || rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A
+        || rng_type == ROCRAND_RNG_PSEUDO_MTGP32
+        || rng_type == ROCRAND_RNG_PSEUDO_MT19937;
+
+    rocrand_generator g = NULL;
+    size_t bytes = 0;
+    EXPECT_EQ(rocrand_set_engine_count(g, 64), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_get_generator_memory_usage(g, &bytes), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_get_generator_memory_usage(g, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_get_generator_memory_usage(g, &bytes));
+
+    if(!has_engines)
+    {
+        EXPECT_EQ(rocrand_set_engine_count(g, 64), ROCRAND_STATUS_TYPE_ERROR);
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+        return;
+    }
+
+    EXPECT_GT(bytes, 0U);
+    ROCRAND_CHECK(rocrand_set_engine_count(g, 1));
+    size_t small_bytes = 0;
+    ROCRAND_CHECK(rocrand_get_generator_memory_usage(g, &small_bytes));
+    EXPECT_LT(small_bytes, bytes);
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, 12345 * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate(g, data, 12345));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+
+    // The number of engines of the ordering is restored
+    ROCRAND_CHECK(rocrand_set_engine_count(g, 0));
+    size_t default_bytes = 0;
+    ROCRAND_CHECK(rocrand_get_generator_memory_usage(g, &default_bytes));
+    EXPECT_EQ(default_bytes, bytes);
+
+    if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        EXPECT_EQ(rocrand_set_engine_count(g, 513), ROCRAND_STATUS_OUT_OF_RANGE);
+    }
+    if(rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        EXPECT_EQ(rocrand_set_engine_count(g, 8193), ROCRAND_STATUS_OUT_OF_RANGE);
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_generator_stats_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    // Counter-based generators have no state to initialize (Philox4x32-10
+    // keeps engines with the default ordering)
+    const unsigned long long inits = rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
+        || rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+        || rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10 ? 0 : 1;
+
+    rocrand_generator g = NULL;
+    rocrand_generator_stats stats;
+    EXPECT_EQ(rocrand_get_generator_stats(g, &stats), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_get_generator_stats(g, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_get_generator_stats(g, &stats));
+    EXPECT_EQ(stats.samples, 0ULL);
+    EXPECT_EQ(stats.launches, 0ULL);
+    EXPECT_EQ(stats.inits, 0ULL);
+    EXPECT_EQ(stats.table_rebuilds, 0ULL);
+
+    const size_t size = 12345;
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+    ROCRAND_CHECK(rocrand_generate_uniform_double(g, data, size));
+    ROCRAND_CHECK(rocrand_generate_uniform_double(g, data, size));
+    ROCRAND_CHECK(rocrand_get_generator_stats(g, &stats));
+    EXPECT_EQ(stats.samples, 2 * size);
+    EXPECT_GE(stats.launches, 2ULL);
+    EXPECT_EQ(stats.inits, inits);
+    EXPECT_GE(stats.init_time, 0.0);
+
+    // The state is initialized again after it is reset
+    ROCRAND_CHECK(rocrand_set_offset(g, 1000));
+    ROCRAND_CHECK(rocrand_generate_uniform_double(g, data, size));
+    ROCRAND_CHECK(rocrand_get_generator_stats(g, &stats));
+    EXPECT_EQ(stats.samples, 3 * size);
+    EXPECT_EQ(stats.inits, 2 * inits);
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+
+    // Tables of a new lambda are created once
+    unsigned int * poisson_data;
+    HIP_CHECK(hipMalloc((void **)&poisson_data, size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate_poisson(g, poisson_data, size, 10.0));
+    ROCRAND_CHECK(rocrand_generate_poisson(g, poisson_data, size, 10.0));
+    ROCRAND_CHECK(rocrand_get_generator_stats(g, &stats));
+    EXPECT_EQ(stats.samples, 5 * size);
+    EXPECT_EQ(stats.table_rebuilds, 1ULL);
+    EXPECT_GE(stats.table_time, 0.0);
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(poisson_data));
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+static void telemetry_callback(const rocrand_telemetry_stats * stats, size_t count, void * user_data)
+{
+    std::vector<rocrand_telemetry_stats> * reports =
+        static_cast<std::vector<rocrand_telemetry_stats> *>(user_data);
+    reports->insert(reports->end(), stats, stats + count);
+}
+
+TEST_P(rocrand_basic_tests, rocrand_telemetry_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_telemetry_stats before;
+    const rocrand_status status = rocrand_get_telemetry_stats(rng_type, &before);
+    if(status == ROCRAND_STATUS_TYPE_ERROR)
+    {
+        // The library is built without ENABLE_TELEMETRY
+        EXPECT_EQ(rocrand_set_telemetry_callback(NULL, NULL, 0.0), ROCRAND_STATUS_TYPE_ERROR);
+        return;
+    }
+    ROCRAND_CHECK(status);
+    EXPECT_EQ(rocrand_get_telemetry_stats(rng_type, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_set_telemetry_callback(NULL, NULL, -1.0), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // Reports are made by every call
+    std::vector<rocrand_telemetry_stats> reports;
+    ROCRAND_CHECK(rocrand_set_telemetry_callback(telemetry_callback, &reports, 0.0));
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    const size_t size = 12345;
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+    ROCRAND_CHECK(rocrand_generate_uniform_double(g, data, size));
+    ROCRAND_CHECK(rocrand_generate_uniform_double(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+    rocrand_generator_stats generator_stats;
+    ROCRAND_CHECK(rocrand_get_generator_stats(g, &generator_stats));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    ROCRAND_CHECK(rocrand_set_telemetry_callback(NULL, NULL, 10.0));
+
+    rocrand_telemetry_stats after;
+    ROCRAND_CHECK(rocrand_get_telemetry_stats(rng_type, &after));
+    EXPECT_EQ(after.rng_type, rng_type);
+    EXPECT_EQ(after.calls - before.calls, 2ULL);
+    EXPECT_EQ(after.samples - before.samples, 2 * size);
+    EXPECT_EQ(after.bytes - before.bytes, 2 * size * sizeof(double));
+    EXPECT_EQ(after.inits - before.inits, generator_stats.inits);
+    EXPECT_GE(after.timed_calls, before.timed_calls);
+    EXPECT_GE(after.kernel_time, before.kernel_time);
+
+    // Reports contain all types used in the process, the last report of
+    // the type is made by the last call
+    size_t last = reports.size();
+    for(size_t i = 0; i < reports.size(); i++)
+    {
+        if(reports[i].rng_type == rng_type)
+            last = i;
+    }
+    ASSERT_LT(last, reports.size());
+    EXPECT_EQ(reports[last].calls, after.calls);
+}
+
+// Allocator which counts allocations and bytes in use
+struct counting_allocator
+{
+    int allocations;
+    int frees;
+    long long bytes;
+};
+
+static hipError_t counting_malloc(void ** ptr, size_t size, hipStream_t stream, void * user_data)
+{
+    (void)stream;
+    counting_allocator * allocator = static_cast<counting_allocator *>(user_data);
+    // The size is stored before the returned memory
+    char * p = NULL;
+    const hipError_t error = hipMalloc((void **)&p, size + 256);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    const size_t stored = size;
+    hipMemcpy(p, &stored, sizeof(size_t), hipMemcpyHostToDevice);
+    *ptr = p + 256;
+    allocator->allocations++;
+    allocator->bytes += size;
+    return hipSuccess;
+}
+
+static hipError_t counting_free(void * ptr, hipStream_t stream, void * user_data)
+{
+    (void)stream;
+    counting_allocator * allocator = static_cast<counting_allocator *>(user_data);
+    char * p = static_cast<char *>(ptr) - 256;
+    size_t size = 0;
+    hipMemcpy(&size, p, sizeof(size_t), hipMemcpyDeviceToHost);
+    allocator->frees++;
+    allocator->bytes -= size;
+    return hipFree(p);
+}
+
+TEST_P(rocrand_basic_tests, rocrand_set_allocator_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    counting_allocator allocator = { 0, 0, 0 };
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_allocator(g, counting_malloc, counting_free, &allocator),
+              ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_set_allocator(g, counting_malloc, NULL, &allocator),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_set_allocator(g, NULL, counting_free, &allocator),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_set_allocator(g, counting_malloc, counting_free, &allocator));
+
+    const size_t size = 12345;
+    unsigned int * data;
+    unsigned int * expected;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&expected, size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate_poisson(g, data, size, 10.0));
+
+    // All device memory of the generator comes from the allocator
+    size_t bytes = 0;
+    ROCRAND_CHECK(rocrand_get_generator_memory_usage(g, &bytes));
+    EXPECT_GT(allocator.allocations, 0);
+    if(rng_type < ROCRAND_RNG_QUASI_DEFAULT)
+    {
+        EXPECT_EQ(static_cast<size_t>(allocator.bytes), bytes);
+    }
+
+    // Results do not depend on the allocator
+    rocrand_generator g2 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g2, rng_type));
+    if(rng_type < ROCRAND_RNG_QUASI_DEFAULT)
+    {
+        ROCRAND_CHECK(rocrand_set_seed(g, 123ULL));
+        ROCRAND_CHECK(rocrand_set_seed(g2, 123ULL));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_set_offset(g, 0));
+    }
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate(g2, expected, size));
+    ROCRAND_CHECK(rocrand_destroy_generator(g2));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> h_data(size);
+    std::vector<unsigned int> h_expected(size);
+    HIP_CHECK(hipMemcpy(h_data.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(h_expected.data(), expected, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    EXPECT_EQ(h_data, h_expected);
+
+    // Memory is returned to the allocator which allocated it
+    ROCRAND_CHECK(rocrand_set_allocator(g, NULL, NULL, NULL));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(expected));
+    EXPECT_EQ(allocator.allocations, allocator.frees);
+    EXPECT_EQ(allocator.bytes, 0);
+}
+
+static hipError_t failing_malloc(void ** ptr, size_t size, hipStream_t stream, void * user_data)
+{
+    (void)ptr;
+    (void)size;
+    (void)stream;
+    static_cast<counting_allocator *>(user_data)->allocations++;
+    return hipErrorOutOfMemory;
+}
+
+TEST_P(rocrand_basic_tests, rocrand_set_allocator_failure_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const size_t size = 12345;
+    unsigned int * data;
+    unsigned int * expected;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&expected, size * sizeof(unsigned int)));
+
+    rocrand_generator g = NULL;
+    rocrand_generator g2 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    ROCRAND_CHECK(rocrand_create_generator(&g2, rng_type));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate(g2, expected, size));
+
+    // Engines can not be allocated, the generator keeps its engines and
+    // its allocator (generators without engines only store the allocator)
+    counting_allocator allocator = { 0, 0, 0 };
+    const rocrand_status status
+        = rocrand_set_allocator(g, failing_malloc, counting_free, &allocator);
+    if(status == ROCRAND_STATUS_SUCCESS)
+    {
+        ROCRAND_CHECK(rocrand_set_allocator(g, NULL, NULL, NULL));
+    }
+    else
+    {
+        EXPECT_EQ(status, ROCRAND_STATUS_ALLOCATION_FAILED);
+        EXPECT_EQ(allocator.allocations, 1);
+    }
+    EXPECT_EQ(allocator.frees, 0);
+
+    // The sequence continues
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate(g2, expected, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> h_data(size);
+    std::vector<unsigned int> h_expected(size);
+    HIP_CHECK(hipMemcpy(h_data.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(h_expected.data(), expected, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    EXPECT_EQ(h_data, h_expected);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    ROCRAND_CHECK(rocrand_destroy_generator(g2));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(expected));
+    EXPECT_EQ(allocator.frees, 0);
+}
+
+TEST_P(rocrand_basic_tests, rocrand_save_load_state_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    size_t state_size = 0;
+    EXPECT_EQ(rocrand_get_state_size(g, &state_size), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_get_state_size(g, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_save_state(g, NULL, 0), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_get_state_size(g, &state_size));
+    EXPECT_GT(state_size, 0U);
+
+    const size_t size = 12345;
+    unsigned int * data;
+    unsigned int * expected;
+    void * state;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&expected, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc(&state, state_size));
+
+    // The sequence continues after the saved position
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_save_state(g, state, 0));
+    ROCRAND_CHECK(rocrand_generate(g, expected, size));
+
+    rocrand_generator g2 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g2, rng_type));
+    ROCRAND_CHECK(rocrand_load_state(g2, state, 0));
+    ROCRAND_CHECK(rocrand_generate(g2, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> h_data(size);
+    std::vector<unsigned int> h_expected(size);
+    HIP_CHECK(hipMemcpy(h_data.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(h_expected.data(), expected, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    EXPECT_EQ(h_data, h_expected);
+
+    // States of other types are rejected
+    rocrand_generator g3 = NULL;
+    const rocrand_rng_type other_type = rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        ? ROCRAND_RNG_PSEUDO_XORWOW
+        : ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+    ROCRAND_CHECK(rocrand_create_generator(&g3, other_type));
+    EXPECT_EQ(rocrand_load_state(g3, state, 0), ROCRAND_STATUS_TYPE_ERROR);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    ROCRAND_CHECK(rocrand_destroy_generator(g2));
+    ROCRAND_CHECK(rocrand_destroy_generator(g3));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(expected));
+    HIP_CHECK(hipFree(state));
+}
+
+// A state with an invalid header is rejected before the generator is changed
+TEST_P(rocrand_basic_tests, rocrand_load_invalid_state_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    typedef rocrand_host::detail::generator_state_header header_type;
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    size_t state_size = 0;
+    ROCRAND_CHECK(rocrand_get_state_size(g, &state_size));
+
+    const size_t size = 12345;
+    double * data;
+    double * expected;
+    void * state;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+    HIP_CHECK(hipMalloc((void **)&expected, size * sizeof(double)));
+    HIP_CHECK(hipMalloc(&state, state_size));
+
+    // Settings of transforms are saved with the state
+    const bool full_resolution = rocrand_set_double_resolution(
+        g, ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT) == ROCRAND_STATUS_SUCCESS;
+    ROCRAND_CHECK(rocrand_generate_uniform_double(g, data, size));
+    ROCRAND_CHECK(rocrand_save_state(g, state, 0));
+    HIP_CHECK(hipDeviceSynchronize());
+    header_type header;
+    HIP_CHECK(hipMemcpy(&header, state, sizeof(header), hipMemcpyDeviceToHost));
+    EXPECT_EQ(header.math_mode, ROCRAND_MATH_MODE_ACCURATE);
+    if(full_resolution)
+    {
+        EXPECT_EQ(header.double_resolution, ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT);
+    }
+
+    rocrand_generator g2 = NULL;
+    rocrand_generator g3 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g2, rng_type));
+    ROCRAND_CHECK(rocrand_create_generator(&g3, rng_type));
+
+    header_type invalid = header;
+    invalid.double_resolution = static_cast<rocrand_double_resolution>(12345);
+    HIP_CHECK(hipMemcpy(state, &invalid, sizeof(invalid), hipMemcpyHostToDevice));
+    EXPECT_EQ(rocrand_load_state(g2, state, 0), ROCRAND_STATUS_TYPE_ERROR);
+
+    invalid = header;
+    invalid.order = rng_type < ROCRAND_RNG_QUASI_DEFAULT
+        ? ROCRAND_ORDERING_QUASI_DEFAULT
+        : ROCRAND_ORDERING_PSEUDO_DEFAULT;
+    HIP_CHECK(hipMemcpy(state, &invalid, sizeof(invalid), hipMemcpyHostToDevice));
+    EXPECT_EQ(rocrand_load_state(g2, state, 0), ROCRAND_STATUS_TYPE_ERROR);
+
+    if(rng_type < ROCRAND_RNG_QUASI_DEFAULT)
+    {
+        // Engines of the state do not match its settings
+        invalid = header;
+        invalid.engines_size++;
+        HIP_CHECK(hipMemcpy(state, &invalid, sizeof(invalid), hipMemcpyHostToDevice));
+        EXPECT_EQ(rocrand_load_state(g2, state, 0), ROCRAND_STATUS_TYPE_ERROR);
+    }
+
+    // g2 is the same as a new generator
+    ROCRAND_CHECK(rocrand_generate_uniform_double(g2, data, size));
+    ROCRAND_CHECK(rocrand_generate_uniform_double(g3, expected, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<double> h_data(size);
+    std::vector<double> h_expected(size);
+    HIP_CHECK(hipMemcpy(h_data.data(), data, size * sizeof(double), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(h_expected.data(), expected, size * sizeof(double), hipMemcpyDeviceToHost));
+    EXPECT_EQ(h_data, h_expected);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    ROCRAND_CHECK(rocrand_destroy_generator(g2));
+    ROCRAND_CHECK(rocrand_destroy_generator(g3));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(expected));
+    HIP_CHECK(hipFree(state));
+}
+
+// Handles are opened by other processes (IPC handles can not be opened by
+// the process which created them), so only exporting is tested here
+TEST_P(rocrand_basic_tests, rocrand_export_generator_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    rocrand_generator_ipc_handle handle;
+    EXPECT_EQ(rocrand_export_generator(g, &handle), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_import_generator(NULL, &g), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_export_generator(g, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_import_generator(&handle, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    const size_t size = 12345;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+
+    size_t state_size;
+    ROCRAND_CHECK(rocrand_get_state_size(g, &state_size));
+    ROCRAND_CHECK(rocrand_export_generator(g, &handle));
+    EXPECT_EQ(handle.rng_type, rng_type);
+    EXPECT_EQ(handle.state_size, state_size);
+
+    // The generator continues after exports
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_export_generator(g, &handle));
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_fork_generator_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    rocrand_generator child = NULL;
+    EXPECT_EQ(rocrand_fork_generator(g, &child, 0), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_fork_generator(g, NULL, 0), ROCRAND_STATUS_OUT_OF_RANGE);
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL32
+        || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+        || rng_type == ROCRAND_RNG_QUASI_SOBOL64
+        || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        EXPECT_EQ(rocrand_fork_generator(g, &child, 0), ROCRAND_STATUS_TYPE_ERROR);
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+        return;
+    }
+
+    rocrand_generator child2 = NULL;
+    ROCRAND_CHECK(rocrand_fork_generator(g, &child, 0));
+    ROCRAND_CHECK(rocrand_fork_generator(g, &child2, 1));
+
+    const size_t size = 12345;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, 4 * size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate(child, data + size, size));
+    ROCRAND_CHECK(rocrand_generate(child2, data + 2 * size, size));
+    // A child initialized again continues to use its own subsequences
+    ROCRAND_CHECK(rocrand_set_offset(child, 0));
+    ROCRAND_CHECK(rocrand_generate(child, data + 3 * size, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> h_data(4 * size);
+    HIP_CHECK(hipMemcpy(h_data.data(), data, 4 * size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    const std::vector<unsigned int> parent_data(h_data.begin(), h_data.begin() + size);
+    const std::vector<unsigned int> child_data(h_data.begin() + size, h_data.begin() + 2 * size);
+    const std::vector<unsigned int> child2_data(h_data.begin() + 2 * size, h_data.begin() + 3 * size);
+    const std::vector<unsigned int> reset_data(h_data.begin() + 3 * size, h_data.end());
+    EXPECT_NE(parent_data, child_data);
+    EXPECT_NE(parent_data, child2_data);
+    EXPECT_NE(child_data, child2_data);
+    EXPECT_EQ(child_data, reset_data);
+
+    // Children are independent of the parent
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    ROCRAND_CHECK(rocrand_generate(child2, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_destroy_generator(child));
+    ROCRAND_CHECK(rocrand_destroy_generator(child2));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_stream_generator_lease_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    rocrand_generator lease = NULL;
+    EXPECT_EQ(rocrand_acquire_stream_generator(g, 0, &lease), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_acquire_stream_generator(g, 0, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_release_stream_generator(g, g), ROCRAND_STATUS_OUT_OF_RANGE);
+    if(rng_type >= ROCRAND_RNG_QUASI_DEFAULT)
+    {
+        EXPECT_EQ(rocrand_acquire_stream_generator(g, 0, &lease), ROCRAND_STATUS_TYPE_ERROR);
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+        return;
+    }
+
+    hipStream_t streams[2];
+    HIP_CHECK(hipStreamCreate(&streams[0]));
+    HIP_CHECK(hipStreamCreate(&streams[1]));
+
+    const size_t size = 12345;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, 4 * size * sizeof(unsigned int)));
+
+    // Leases of different streams are different children
+    rocrand_generator lease2 = NULL;
+    ROCRAND_CHECK(rocrand_acquire_stream_generator(g, streams[0], &lease));
+    ROCRAND_CHECK(rocrand_acquire_stream_generator(g, streams[1], &lease2));
+    EXPECT_NE(lease, lease2);
+    ROCRAND_CHECK(rocrand_generate(lease, data, size));
+    ROCRAND_CHECK(rocrand_generate(lease2, data + size, size));
+    ROCRAND_CHECK(rocrand_release_stream_generator(g, lease));
+    ROCRAND_CHECK(rocrand_release_stream_generator(g, lease2));
+    EXPECT_EQ(rocrand_release_stream_generator(g, lease), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // The first slot is leased again and continues its sequence on another stream
+    rocrand_generator lease3 = NULL;
+    ROCRAND_CHECK(rocrand_acquire_stream_generator(g, streams[1], &lease3));
+    EXPECT_EQ(lease3, lease);
+    ROCRAND_CHECK(rocrand_generate(lease3, data + 2 * size, size));
+    ROCRAND_CHECK(rocrand_release_stream_generator(g, lease3));
+
+    // Slot 0 is the child with subsequence_id 0
+    rocrand_generator child = NULL;
+    ROCRAND_CHECK(rocrand_fork_generator(g, &child, 0));
+    ROCRAND_CHECK(rocrand_generate(child, data + 3 * size, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> h_data(4 * size);
+    HIP_CHECK(hipMemcpy(h_data.data(), data, 4 * size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    const std::vector<unsigned int> lease_data(h_data.begin(), h_data.begin() + size);
+    const std::vector<unsigned int> lease2_data(h_data.begin() + size, h_data.begin() + 2 * size);
+    const std::vector<unsigned int> lease3_data(h_data.begin() + 2 * size, h_data.begin() + 3 * size);
+    const std::vector<unsigned int> child_data(h_data.begin() + 3 * size, h_data.end());
+    EXPECT_NE(lease_data, lease2_data);
+    EXPECT_NE(lease_data, lease3_data);
+    EXPECT_EQ(lease_data, child_data);
+
+    // Threads lease concurrently
+    std::vector<std::thread> threads;
+    std::vector<rocrand_status> statuses(4, ROCRAND_STATUS_SUCCESS);
+    for(size_t t = 0; t < statuses.size(); t++)
+    {
+        threads.emplace_back([&, t]()
+        {
+            rocrand_generator thread_lease = NULL;
+            rocrand_status status = rocrand_acquire_stream_generator(g, streams[t % 2], &thread_lease);
+            if(status == ROCRAND_STATUS_SUCCESS)
+            {
+                status = rocrand_generate(thread_lease, data + t * size, size);
+                const rocrand_status release_status = rocrand_release_stream_generator(g, thread_lease);
+                status = status != ROCRAND_STATUS_SUCCESS ? status : release_status;
+            }
+            statuses[t] = status;
+        });
+    }
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+    for(const rocrand_status status : statuses)
+    {
+        EXPECT_EQ(status, ROCRAND_STATUS_SUCCESS);
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_destroy_generator(child));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipStreamDestroy(streams[0]));
+    HIP_CHECK(hipStreamDestroy(streams[1]));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_subsequence_partition_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_subsequence_partition(g, 0, 1), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_set_subsequence_partition(g, 0, 0), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_set_subsequence_partition(g, 4, 4), ROCRAND_STATUS_OUT_OF_RANGE);
+    if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32 || rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        EXPECT_EQ(rocrand_set_subsequence_partition(g, 0, 1U << 20), ROCRAND_STATUS_OUT_OF_RANGE);
+    }
+
+    const size_t size = 12345;
+    const unsigned int ranks = 4;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, (ranks + 2) * size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    // Rank 0 of 1 is the default partition
+    ROCRAND_CHECK(rocrand_set_subsequence_partition(g, 0, 1));
+    ROCRAND_CHECK(rocrand_generate(g, data + size, size));
+    for(unsigned int rank = 0; rank < ranks; rank++)
+    {
+        ROCRAND_CHECK(rocrand_set_subsequence_partition(g, rank, ranks));
+        ROCRAND_CHECK(rocrand_generate(g, data + (rank + 2) * size, size));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> h_data((ranks + 2) * size);
+    HIP_CHECK(hipMemcpy(h_data.data(), data, h_data.size() * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    std::vector<std::vector<unsigned int>> outputs;
+    for(unsigned int i = 0; i < ranks + 2; i++)
+    {
+        outputs.emplace_back(h_data.begin() + i * size, h_data.begin() + (i + 1) * size);
+    }
+    EXPECT_EQ(outputs[0], outputs[1]);
+    for(unsigned int i = 2; i < ranks + 2; i++)
+    {
+        for(unsigned int j = i + 1; j < ranks + 2; j++)
+        {
+            EXPECT_NE(outputs[i], outputs[j]) << i - 2 << " " << j - 2;
+        }
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_set_default_allocator_test)
+{
+    counting_allocator allocator = { 0, 0, 0 };
+    EXPECT_EQ(rocrand_set_default_allocator(counting_malloc, NULL, &allocator),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_set_default_allocator(counting_malloc, counting_free, &allocator));
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    rocrand_discrete_distribution distribution = NULL;
+    ROCRAND_CHECK(rocrand_create_poisson_distribution(10.0, &distribution));
+    const int allocations = allocator.allocations;
+    EXPECT_GT(allocations, 0);
+
+    // Memory allocated before is freed by the previous default allocator
+    ROCRAND_CHECK(rocrand_set_default_allocator(NULL, NULL, NULL));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(distribution));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    EXPECT_EQ(allocator.allocations, allocations);
+    EXPECT_EQ(allocator.frees, allocations);
+    EXPECT_EQ(allocator.bytes, 0);
+}
+
 const rocrand_rng_type rng_types[] = {
     ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
     ROCRAND_RNG_PSEUDO_MRG32K3A,
     ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32,
     ROCRAND_RNG_PSEUDO_MTGP32,
-    ROCRAND_RNG_QUASI_SOBOL32
+    ROCRAND_RNG_PSEUDO_MT19937,
+    ROCRAND_RNG_QUASI_SOBOL32,
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
+    ROCRAND_RNG_QUASI_SOBOL64,
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
 };
 
 INSTANTIATE_TEST_CASE_P(rocrand_basic_tests,
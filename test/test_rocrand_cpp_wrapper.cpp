@@ -650,3 +650,255 @@ TEST(rocrand_cpp_wrapper, rocrand_poisson_dist_param)
     d3.param(d1.param());
     ASSERT_TRUE(d1.param() == d3.param());
 }
+
+struct scale_functor
+{
+    __host__ __device__
+    float operator()(unsigned int v) const
+    {
+        return static_cast<float>(v >> 8) * 0.5f;
+    }
+};
+
+TEST(rocrand_cpp_wrapper, rocrand_philox_generate_functor)
+{
+    const size_t output_size = 12345;
+    float * output;
+    unsigned int * raw;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&raw, output_size * sizeof(unsigned int)));
+
+    // Odd offset and sizes check counters which are not multiples of 4
+    rocrand_cpp::philox4x32_10 engine(123ULL, 3ULL);
+    rocrand_cpp::philox4x32_10 expected_engine(123ULL, 3ULL);
+    ASSERT_NO_THROW(engine.order(ROCRAND_ORDERING_PSEUDO_BEST));
+    ASSERT_NO_THROW(expected_engine.order(ROCRAND_ORDERING_PSEUDO_BEST));
+    rocrand_cpp::uniform_int_distribution<unsigned int> d;
+    for(size_t size : { size_t(1), size_t(7), output_size })
+    {
+        ASSERT_NO_THROW(engine.generate(output, size, scale_functor()));
+        ASSERT_NO_THROW(d(expected_engine, raw, size));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<float> output_host(size);
+        std::vector<unsigned int> raw_host(size);
+        HIP_CHECK(hipMemcpy(output_host.data(), output, size * sizeof(float),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(raw_host.data(), raw, size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(output_host[i], scale_functor()(raw_host[i]));
+        }
+    }
+
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(raw));
+}
+
+template<class Iterator, class T>
+__global__
+void copy_iterator_kernel(Iterator first, T * output, const size_t size)
+{
+    const size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(i < size)
+    {
+        // Half of the values are read by offset, half by indexing
+        output[i] = (i % 2 == 0) ? *(first + i) : first[i];
+    }
+}
+
+TEST(rocrand_cpp_wrapper, rocrand_counting_random_iterator)
+{
+    typedef rocrand_cpp::counting_random_iterator<rocrand_cpp::philox4x32_10, scale_functor>
+        iterator_type;
+
+    const size_t output_size = 12345;
+    float * output;
+    float * expected;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&expected, output_size * sizeof(float)));
+
+    rocrand_cpp::philox4x32_10 engine(123ULL, 3ULL);
+    rocrand_cpp::philox4x32_10 expected_engine(123ULL, 3ULL);
+    ASSERT_NO_THROW(engine.order(ROCRAND_ORDERING_PSEUDO_BEST));
+    ASSERT_NO_THROW(expected_engine.order(ROCRAND_ORDERING_PSEUDO_BEST));
+    for(size_t size : { size_t(1), size_t(7), output_size })
+    {
+        iterator_type first(engine, size);
+        ASSERT_EQ((first + size) - first, static_cast<std::ptrdiff_t>(size));
+        ASSERT_TRUE(first < first + 1);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(copy_iterator_kernel<iterator_type, float>),
+            dim3((size + 255) / 256), dim3(256), 0, 0,
+            first, output, size
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        ASSERT_NO_THROW(expected_engine.generate(expected, size, scale_functor()));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<float> output_host(size);
+        std::vector<float> expected_host(size);
+        HIP_CHECK(hipMemcpy(output_host.data(), output, size * sizeof(float),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(expected_host.data(), expected, size * sizeof(float),
+                            hipMemcpyDeviceToHost));
+        ASSERT_EQ(output_host, expected_host);
+    }
+
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(expected));
+}
+
+struct uniform_functor
+{
+    __device__
+    float operator()(unsigned int v) const
+    {
+        return rocrand_device::detail::uniform_distribution(v);
+    }
+};
+
+struct to_double_functor
+{
+    __host__ __device__
+    double operator()(float v) const
+    {
+        return static_cast<double>(v);
+    }
+};
+
+struct max_functor
+{
+    __host__ __device__
+    float operator()(float a, float b) const
+    {
+        return a > b ? a : b;
+    }
+};
+
+struct identity_functor
+{
+    __host__ __device__
+    float operator()(float v) const
+    {
+        return v;
+    }
+};
+
+TEST(rocrand_cpp_wrapper, rocrand_monte_carlo_reduce)
+{
+    const size_t size = 123457;
+    float * expected;
+    HIP_CHECK(hipMalloc((void **)&expected, size * sizeof(float)));
+
+    rocrand_cpp::philox4x32_10 engine(123ULL, 3ULL);
+    rocrand_cpp::philox4x32_10 expected_engine(123ULL, 3ULL);
+    ASSERT_NO_THROW(engine.order(ROCRAND_ORDERING_PSEUDO_BEST));
+    ASSERT_NO_THROW(expected_engine.order(ROCRAND_ORDERING_PSEUDO_BEST));
+
+    std::vector<float> expected_host(size);
+    double expected_sum = 0.0;
+    double sum = 0.0;
+    ASSERT_NO_THROW(sum = rocrand_cpp::monte_carlo_reduce(
+        engine, uniform_functor(), size, to_double_functor()
+    ));
+    ASSERT_NO_THROW(expected_engine.generate(expected, size, uniform_functor()));
+    HIP_CHECK(hipMemcpy(expected_host.data(), expected, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    for(float v : expected_host) expected_sum += v;
+    ASSERT_NEAR(sum, expected_sum, expected_sum * 1e-10);
+
+    // The engine is advanced by size numbers
+    float max_value = 0.0f;
+    ASSERT_NO_THROW(max_value = rocrand_cpp::monte_carlo_reduce(
+        engine, uniform_functor(), size, identity_functor(), max_functor(), 0.0f
+    ));
+    ASSERT_NO_THROW(expected_engine.generate(expected, size, uniform_functor()));
+    HIP_CHECK(hipMemcpy(expected_host.data(), expected, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    ASSERT_EQ(max_value, *std::max_element(expected_host.begin(), expected_host.end()));
+
+    rocrand_cpp::monte_carlo_estimate estimate;
+    ASSERT_NO_THROW(estimate = rocrand_cpp::monte_carlo_mean_variance(
+        engine, uniform_functor(), size, identity_functor()
+    ));
+    ASSERT_NO_THROW(expected_engine.generate(expected, size, uniform_functor()));
+    HIP_CHECK(hipMemcpy(expected_host.data(), expected, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    double mean = 0.0;
+    for(float v : expected_host) mean += v;
+    mean /= size;
+    double variance = 0.0;
+    for(float v : expected_host) variance += (v - mean) * (v - mean);
+    variance /= size - 1;
+    ASSERT_EQ(estimate.count, size);
+    ASSERT_NEAR(estimate.mean, mean, 1e-10);
+    ASSERT_NEAR(estimate.variance, variance, 1e-10);
+
+    ASSERT_EQ(rocrand_cpp::monte_carlo_reduce(
+        engine, uniform_functor(), 0, identity_functor(), max_functor(), -1.0f
+    ), -1.0f);
+
+    HIP_CHECK(hipFree(expected));
+}
+
+TEST(rocrand_cpp_wrapper, rocrand_buffered_engine)
+{
+    const size_t pool_size = 1000;
+    const size_t output_size = 12345;
+    unsigned int * output;
+    unsigned int * expected;
+    const size_t pools = (output_size + pool_size - 1) / pool_size;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&expected, pools * pool_size * sizeof(unsigned int)));
+
+    // Small requests give values of consecutive pool-sized calls of the engine in order
+    rocrand_cpp::buffered_engine<rocrand_cpp::philox4x32_10> engine(pool_size, 123ULL);
+    rocrand_cpp::philox4x32_10 expected_engine(123ULL);
+    rocrand_cpp::uniform_int_distribution<unsigned int> d;
+    for(size_t i = 0; i < pools; i++)
+    {
+        ASSERT_NO_THROW(d(expected_engine, expected + i * pool_size, pool_size));
+    }
+
+    size_t offset = 0;
+    for(size_t i = 0; offset < output_size; i++)
+    {
+        const size_t size = std::min((i * 37) % pool_size, output_size - offset);
+        ASSERT_NO_THROW(engine(output + offset, size));
+        offset += size;
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> output_host(output_size);
+    std::vector<unsigned int> expected_host(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(), output, output_size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(expected_host.data(), expected, output_size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host[i], expected_host[i]);
+    }
+
+    // Large requests bypass the pool, too large pointers into the pool are refused
+    ASSERT_NO_THROW(engine(output, output_size));
+    const unsigned int * values = NULL;
+    ASSERT_NO_THROW(values = engine.acquire(pool_size));
+    ASSERT_NE(values, (const unsigned int *)NULL);
+    ASSERT_THROW(engine.acquire(pool_size + 1), rocrand_cpp::error);
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Stateful engines
+    rocrand_cpp::buffered_engine<rocrand_cpp::xorwow> xorwow_engine(pool_size);
+    for(size_t size : { size_t(1), size_t(999), size_t(5000) })
+    {
+        ASSERT_NO_THROW(xorwow_engine(output, size));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(expected));
+}
@@ -19,6 +19,8 @@
 // THE SOFTWARE.
 
 #include <stdio.h>
+#include <algorithm>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include <hip/hip_runtime.h>
@@ -84,3 +86,670 @@ TEST(rocrand_generate_tests, simple_neg_test)
         ROCRAND_STATUS_NOT_CREATED
     );
 }
+
+TEST(rocrand_generate_tests, long_long_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_QUASI_SOBOL64
+        )
+    );
+
+    const size_t size = 256;
+    unsigned long long * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned long long)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_long_long(generator, data, size)
+    );
+    // 64-bit generators do not generate 32-bit numbers
+    EXPECT_EQ(
+        rocrand_generate(generator, (unsigned int *) data, size),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_tests, long_long_neg_test)
+{
+    const size_t size = 256;
+    unsigned long long * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_long_long(generator, data, size),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_QUASI_SOBOL32
+        )
+    );
+    EXPECT_EQ(
+        rocrand_generate_long_long(generator, data, size),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+struct legacy_value
+{
+    size_t index;
+    unsigned int value;
+};
+
+struct legacy_values
+{
+    rocrand_rng_type rng_type;
+    // Values per iteration of the grid (all threads or all blocks)
+    size_t grid_size;
+    std::vector<legacy_value> first;
+    std::vector<legacy_value> second;
+};
+
+// Values of versions of the library without orderings (seed 12345, two calls
+// of grid_size + 1001 and grid_size + 7 numbers), the default and the legacy
+// orderings must keep generating them. Grids of XORWOW, MRG32k3a and MTGP32
+// are smaller on HIP-NVCC, only Philox4x32-10 is checked there.
+TEST(rocrand_generate_tests, legacy_values_test)
+{
+    const std::vector<legacy_values> tests = {
+        {
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10, 1024 * 256 * 4,
+            { { 0, 3522838145U }, { 1, 796912209U }, { 4, 11954473U }, { 63, 1022550850U },
+              { 64, 2083340038U }, { 1000, 2232210697U }, { 1048575, 48929992U },
+              { 1048576, 1525405285U }, { 1049576, 1303419777U } },
+            { { 0, 549187586U }, { 3, 3511853354U }, { 4, 799273435U }, { 1000, 2273665304U },
+              { 1048575, 2116617321U }, { 1048582, 499611946U } }
+        },
+#ifndef __HIP_PLATFORM_NVCC__
+        {
+            ROCRAND_RNG_PSEUDO_XORWOW, 512 * 256,
+            { { 0, 1313276523U }, { 1, 3893726099U }, { 1000, 4001457169U },
+              { 131071, 2258958119U }, { 131072, 562898125U }, { 132072, 1382245U } },
+            { { 0, 2062475559U }, { 1, 1436452365U }, { 1000, 2061616630U },
+              { 131071, 3710586644U }, { 131078, 153453071U } }
+        },
+        {
+            ROCRAND_RNG_PSEUDO_MRG32K3A, 512 * 256,
+            { { 0, 3078006141U }, { 1, 568802634U }, { 1000, 1511101060U },
+              { 131071, 3202289807U }, { 131072, 631176432U }, { 132072, 1320860222U } },
+            { { 0, 2684665518U }, { 1, 1323256114U }, { 1000, 1028921976U },
+              { 131071, 3437401515U }, { 131078, 141051065U } }
+        },
+        {
+            ROCRAND_RNG_PSEUDO_MTGP32, 512 * 256,
+            { { 0, 944261663U }, { 1, 2973293543U }, { 255, 2951654262U }, { 256, 2463676860U },
+              { 1000, 1483054756U }, { 131071, 978729375U }, { 131072, 2489139309U },
+              { 132072, 2441745959U } },
+            { { 0, 3744622346U }, { 1, 2166630190U }, { 1000, 1816603814U },
+              { 131071, 3275716181U }, { 131078, 1420554042U } }
+        },
+#endif
+    };
+
+    for(const rocrand_ordering order : { ROCRAND_ORDERING_PSEUDO_DEFAULT,
+                                         ROCRAND_ORDERING_PSEUDO_LEGACY })
+    {
+        for(const legacy_values& test : tests)
+        {
+            SCOPED_TRACE(testing::Message() << "with rng_type = " << test.rng_type
+                                            << ", order = " << order);
+
+            const size_t size1 = test.grid_size + 1001;
+            const size_t size2 = test.grid_size + 7;
+            unsigned int * data;
+            HIP_CHECK(hipMalloc((void **)&data, size1 * sizeof(unsigned int)));
+
+            rocrand_generator generator;
+            ROCRAND_CHECK(rocrand_create_generator(&generator, test.rng_type));
+            ROCRAND_CHECK(rocrand_set_ordering(generator, order));
+            ROCRAND_CHECK(rocrand_set_seed(generator, 12345ULL));
+
+            std::vector<unsigned int> first(size1);
+            ROCRAND_CHECK(rocrand_generate(generator, data, size1));
+            HIP_CHECK(hipMemcpy(first.data(), data, size1 * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            std::vector<unsigned int> second(size2);
+            ROCRAND_CHECK(rocrand_generate(generator, data, size2));
+            HIP_CHECK(hipMemcpy(second.data(), data, size2 * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+
+            for(const legacy_value& v : test.first)
+            {
+                EXPECT_EQ(first[v.index], v.value) << "first call, index " << v.index;
+            }
+            for(const legacy_value& v : test.second)
+            {
+                EXPECT_EQ(second[v.index], v.value) << "second call, index " << v.index;
+            }
+
+            ROCRAND_CHECK(rocrand_destroy_generator(generator));
+            HIP_CHECK(hipFree(data));
+        }
+    }
+}
+
+class rocrand_generate_range_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Engines of Philox4x32-10 with the default ordering do not compute ranges,
+// counter-based orderings do
+static void set_range_ordering(rocrand_generator generator, rocrand_rng_type rng_type)
+{
+    if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        ROCRAND_CHECK(rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_BEST));
+    }
+}
+
+TEST_P(rocrand_generate_range_tests, range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    // start is not a multiple of the number of engines or of Philox groups
+    const unsigned long long start = 300007;
+    const size_t size = 10015;
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, (start + size) * sizeof(unsigned int)));
+    unsigned int * range_data;
+    HIP_CHECK(hipMalloc((void **)&range_data, size * sizeof(unsigned int)));
+
+    std::vector<unsigned int> expected(size);
+    std::vector<unsigned int> expected_next(size);
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        set_range_ordering(generator, rng_type);
+        ROCRAND_CHECK(rocrand_set_offset(generator, 123));
+        ROCRAND_CHECK(rocrand_generate(generator, data, start + size));
+        HIP_CHECK(hipMemcpy(expected.data(), data + start, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+        HIP_CHECK(hipMemcpy(expected_next.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    set_range_ordering(generator, rng_type);
+    ROCRAND_CHECK(rocrand_set_offset(generator, 123));
+
+    // Before initialization of the generator
+    std::vector<unsigned int> range(size);
+    ROCRAND_CHECK(rocrand_generate_range(generator, range_data, start, size));
+    HIP_CHECK(hipMemcpy(range.data(), range_data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(range[i], expected[i]);
+    }
+
+    // Ranges do not change the state of the generator
+    ROCRAND_CHECK(rocrand_generate(generator, data, start + size));
+    ROCRAND_CHECK(rocrand_generate_range(generator, range_data, start, size));
+    HIP_CHECK(hipMemcpy(range.data(), range_data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    std::vector<unsigned int> next(size);
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipMemcpy(next.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(range[i], expected[i]);
+        ASSERT_EQ(next[i], expected_next[i]);
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(range_data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_range_tests,
+                        rocrand_generate_range_tests,
+                        ::testing::Values(ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                          ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+                                          ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+                                          ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+                                          ROCRAND_RNG_PSEUDO_XORWOW,
+                                          ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+                                          ROCRAND_RNG_PSEUDO_PCG32,
+                                          ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                          ROCRAND_RNG_QUASI_SOBOL32,
+                                          ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32));
+
+// Small requests launch smaller grids, numbers must be the same as
+// the beginning of a large request
+TEST_P(rocrand_generate_range_tests, small_request_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t large_size = 1 << 20;
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, large_size * sizeof(unsigned int)));
+
+    std::vector<unsigned int> expected(large_size);
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_generate(generator, data, large_size));
+        HIP_CHECK(hipMemcpy(expected.data(), data, large_size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    for(size_t size : { 1, 3, 100, 4097 })
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+        std::vector<unsigned int> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(output[i], expected[i]);
+        }
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_tests, range_neg_test)
+{
+    const size_t size = 256;
+    unsigned int * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_range(generator, data, 0, size),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_MTGP32));
+    EXPECT_EQ(
+        rocrand_generate_range(generator, data, 0, size),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_generate_range(generator, data, 0, size),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_MT19937));
+    EXPECT_EQ(
+        rocrand_generate_range(generator, data, 0, size),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, 3));
+    EXPECT_EQ(
+        rocrand_generate_range(generator, data, 0, size),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_tests, long_long_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_QUASI_SOBOL64
+        )
+    );
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, 4));
+
+    // Points [start, start + points) of all dimensions
+    const unsigned long long start = 1001;
+    const size_t points = 513;
+    const unsigned int dimensions = 4;
+    unsigned long long * data;
+    HIP_CHECK(hipMalloc((void **)&data, (start + points) * dimensions * sizeof(unsigned long long)));
+    unsigned long long * range_data;
+    HIP_CHECK(hipMalloc((void **)&range_data, points * dimensions * sizeof(unsigned long long)));
+
+    ROCRAND_CHECK(rocrand_generate_long_long(generator, data, (start + points) * dimensions));
+    ROCRAND_CHECK(rocrand_generate_long_long_range(generator, range_data, start, points * dimensions));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned long long> all((start + points) * dimensions);
+    std::vector<unsigned long long> range(points * dimensions);
+    HIP_CHECK(hipMemcpy(all.data(), data, all.size() * sizeof(unsigned long long), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(range.data(), range_data, range.size() * sizeof(unsigned long long), hipMemcpyDeviceToHost));
+    for(unsigned int d = 0; d < dimensions; d++)
+    {
+        for(size_t i = 0; i < points; i++)
+        {
+            ASSERT_EQ(range[d * points + i], all[d * (start + points) + start + i]);
+        }
+    }
+
+    // 64-bit generators do not generate 32-bit ranges
+    EXPECT_EQ(
+        rocrand_generate_range(generator, (unsigned int *) data, 0, dimensions),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(range_data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Generates a request with the generate function of its distribution
+rocrand_status generate_request(rocrand_generator generator,
+                                const rocrand_generate_request& r)
+{
+    switch(r.distribution)
+    {
+        case ROCRAND_DISTRIBUTION_UNIFORM_UINT:
+            return rocrand_generate(generator, (unsigned int *)r.output_data, r.n);
+        case ROCRAND_DISTRIBUTION_UNIFORM_FLOAT:
+            return rocrand_generate_uniform(generator, (float *)r.output_data, r.n);
+        case ROCRAND_DISTRIBUTION_UNIFORM_DOUBLE:
+            return rocrand_generate_uniform_double(generator, (double *)r.output_data, r.n);
+        case ROCRAND_DISTRIBUTION_NORMAL_FLOAT:
+            return rocrand_generate_normal(generator, (float *)r.output_data, r.n,
+                                           (float)r.mean, (float)r.stddev);
+        case ROCRAND_DISTRIBUTION_NORMAL_DOUBLE:
+            return rocrand_generate_normal_double(generator, (double *)r.output_data, r.n,
+                                                  r.mean, r.stddev);
+        case ROCRAND_DISTRIBUTION_LOG_NORMAL_FLOAT:
+            return rocrand_generate_log_normal(generator, (float *)r.output_data, r.n,
+                                               (float)r.mean, (float)r.stddev);
+        case ROCRAND_DISTRIBUTION_LOG_NORMAL_DOUBLE:
+            return rocrand_generate_log_normal_double(generator, (double *)r.output_data, r.n,
+                                                      r.mean, r.stddev);
+        case ROCRAND_DISTRIBUTION_POISSON:
+            return rocrand_generate_poisson(generator, (unsigned int *)r.output_data, r.n,
+                                            r.lambda);
+    }
+    return ROCRAND_STATUS_OUT_OF_RANGE;
+}
+
+class rocrand_generate_batch_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Batches give the same results as separate generate calls
+TEST_P(rocrand_generate_batch_tests, batch_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    // More requests than one kernel launch processes
+    const size_t count = 37;
+    const size_t max_bytes = 4000 * sizeof(double);
+    char * data;
+    HIP_CHECK(hipMalloc((void **)&data, count * max_bytes));
+    HIP_CHECK(hipMemset(data, 0, count * max_bytes));
+
+    std::vector<rocrand_generate_request> requests(count);
+    for(size_t i = 0; i < count; i++)
+    {
+        rocrand_generate_request& r = requests[i];
+        r.distribution = static_cast<rocrand_distribution>(i % 8);
+        r.output_data = data + i * max_bytes;
+        r.n = 2 * (i * 97 % 2000) + 2;
+        r.mean = 0.5 * i;
+        r.stddev = 1.0 + 0.25 * i;
+        r.lambda = 1.0 + 10.0 * (i % 3);
+    }
+
+    std::vector<char> expected(count * max_bytes);
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        for(size_t i = 0; i < count; i++)
+        {
+            ROCRAND_CHECK(generate_request(generator, requests[i]));
+        }
+        HIP_CHECK(hipMemcpy(expected.data(), data, count * max_bytes, hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+    HIP_CHECK(hipMemset(data, 0, count * max_bytes));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_generate_batch(generator, requests.data(), count));
+    std::vector<char> result(count * max_bytes);
+    HIP_CHECK(hipMemcpy(result.data(), data, count * max_bytes, hipMemcpyDeviceToHost));
+
+    for(size_t i = 0; i < count * max_bytes; i++)
+    {
+        ASSERT_EQ(result[i], expected[i]);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_batch_tests,
+                        rocrand_generate_batch_tests,
+                        ::testing::Values(ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                          ROCRAND_RNG_PSEUDO_XORWOW,
+                                          ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                          ROCRAND_RNG_PSEUDO_MTGP32,
+                                          ROCRAND_RNG_PSEUDO_MT19937,
+                                          ROCRAND_RNG_QUASI_SOBOL32));
+
+TEST(rocrand_generate_tests, batch_neg_test)
+{
+    const size_t size = 256;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+
+    rocrand_generate_request request;
+    request.distribution = ROCRAND_DISTRIBUTION_NORMAL_FLOAT;
+    request.output_data = data;
+    request.n = size;
+    request.mean = 0.0;
+    request.stddev = 1.0;
+    request.lambda = 0.0;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_batch(generator, &request, 1),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_batch(generator, NULL, 1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_generate_batch(generator, NULL, 0));
+
+    // Odd sizes are supported by normal generation
+    request.n = size - 1;
+    ROCRAND_CHECK(rocrand_generate_batch(generator, &request, 1));
+
+    request.n = size;
+    request.distribution = ROCRAND_DISTRIBUTION_POISSON;
+    EXPECT_EQ(
+        rocrand_generate_batch(generator, &request, 1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    request.distribution = static_cast<rocrand_distribution>(100);
+    EXPECT_EQ(
+        rocrand_generate_batch(generator, &request, 1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+class rocrand_generate_2d_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Rows of a 2D generation are the same as consecutive generations of width
+// values, padding between rows is not written
+TEST_P(rocrand_generate_2d_tests, pitch_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    // Odd width and a pitch which misaligns odd rows for vector stores
+    const size_t width = 1237;
+    const size_t height = 7;
+    const size_t pitch_values = width + 3;
+    const size_t pitch = pitch_values * sizeof(float);
+    const size_t size = pitch_values * height;
+
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    const std::vector<float> padding(size, -1.0f);
+
+    for(int normal = 0; normal < 2; normal++)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        std::vector<float> expected(width * height);
+        for(size_t r = 0; r < height; r++)
+        {
+            if(normal)
+                ROCRAND_CHECK(rocrand_generate_normal(generator, data, width, 0.0f, 1.0f));
+            else
+                ROCRAND_CHECK(rocrand_generate_uniform(generator, data, width));
+            HIP_CHECK(hipMemcpy(expected.data() + r * width, data, width * sizeof(float),
+                                hipMemcpyDeviceToHost));
+        }
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+        HIP_CHECK(hipMemcpy(data, padding.data(), size * sizeof(float), hipMemcpyHostToDevice));
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        if(normal)
+            ROCRAND_CHECK(rocrand_generate_normal_2d(generator, data, width, height, pitch, 0.0f, 1.0f));
+        else
+            ROCRAND_CHECK(rocrand_generate_uniform_2d(generator, data, width, height, pitch));
+        std::vector<float> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+        for(size_t r = 0; r < height; r++)
+        {
+            for(size_t c = 0; c < pitch_values; c++)
+            {
+                if(c < width)
+                    ASSERT_EQ(output[r * pitch_values + c], expected[r * width + c]);
+                else
+                    ASSERT_EQ(output[r * pitch_values + c], -1.0f);
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_2d_tests,
+                        rocrand_generate_2d_tests,
+                        ::testing::Values(ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                          ROCRAND_RNG_PSEUDO_XORWOW,
+                                          ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                          ROCRAND_RNG_PSEUDO_MTGP32,
+                                          ROCRAND_RNG_PSEUDO_MT19937));
+
+TEST(rocrand_generate_tests, generate_2d_neg_test)
+{
+    unsigned int * data = NULL;
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_2d(generator, data, 4, 4, 4 * sizeof(unsigned int)),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    // Pitch is smaller than a row or is not a multiple of the value size
+    EXPECT_EQ(
+        rocrand_generate_2d(generator, data, 4, 4, 3 * sizeof(unsigned int)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_2d(generator, data, 4, 4, 4 * sizeof(unsigned int) + 1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+class rocrand_generate_to_host_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Generation to pageable and pinned host memory gives the same numbers
+// as consecutive generations of chunks
+TEST_P(rocrand_generate_to_host_tests, chunks_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t chunk_size = 40000;
+    const size_t size = chunk_size * 5 + 123;
+
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, chunk_size * sizeof(float)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    std::vector<float> expected(size);
+    for(size_t first = 0; first < size; first += chunk_size)
+    {
+        const size_t count = std::min(chunk_size, size - first);
+        ROCRAND_CHECK(rocrand_generate_normal(generator, data, count, 1.0f, 2.0f));
+        HIP_CHECK(hipMemcpy(expected.data() + first, data, count * sizeof(float),
+                            hipMemcpyDeviceToHost));
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+
+    std::vector<float> pageable(size);
+    float * pinned;
+    HIP_CHECK(hipHostMalloc((void **)&pinned, size * sizeof(float)));
+
+    for(float * output : { pageable.data(), pinned })
+    {
+        rocrand_generate_request request;
+        request.distribution = ROCRAND_DISTRIBUTION_NORMAL_FLOAT;
+        request.output_data = output;
+        request.n = size;
+        request.mean = 1.0;
+        request.stddev = 2.0;
+        request.lambda = 0.0;
+
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_generate_to_host(generator, &request, chunk_size));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(output[i], expected[i]);
+        }
+    }
+
+    HIP_CHECK(hipHostFree(pinned));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_to_host_tests,
+                        rocrand_generate_to_host_tests,
+                        ::testing::Values(ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                          ROCRAND_RNG_PSEUDO_XORWOW,
+                                          ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                          ROCRAND_RNG_PSEUDO_MTGP32,
+                                          ROCRAND_RNG_PSEUDO_MT19937,
+                                          ROCRAND_RNG_QUASI_SOBOL32));
+
+TEST(rocrand_generate_tests, generate_to_host_neg_test)
+{
+    std::vector<unsigned int> output(16);
+    rocrand_generate_request request;
+    request.distribution = ROCRAND_DISTRIBUTION_UNIFORM_UINT;
+    request.output_data = output.data();
+    request.n = output.size();
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(rocrand_generate_to_host(generator, &request, 0), ROCRAND_STATUS_NOT_CREATED);
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_generate_to_host(generator, NULL, 0), ROCRAND_STATUS_OUT_OF_RANGE);
+    request.distribution = static_cast<rocrand_distribution>(100);
+    EXPECT_EQ(rocrand_generate_to_host(generator, &request, 0), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
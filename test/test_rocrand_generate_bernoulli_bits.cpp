@@ -0,0 +1,191 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// Frequency of 1 bits of the first bits bits
+double bit_frequency(const std::vector<unsigned int>& output, const size_t bits)
+{
+    size_t ones = 0;
+    for(size_t i = 0; i < bits; i++)
+    {
+        ones += (output[i / 32] >> (i % 32)) & 1;
+    }
+    return static_cast<double>(ones) / bits;
+}
+
+class rocrand_generate_bernoulli_bits_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Dyadic probabilities (bit-sliced), others (threshold) and 0, 1
+TEST_P(rocrand_generate_bernoulli_bits_tests, frequency_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t bits = 32 * 123457 + 11;
+    const size_t size = (bits + 31) / 32;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    for(const double p : { 0.0, 0.5, 0.25, 0.8125, 0.1, 0.9, 1.0 })
+    {
+        SCOPED_TRACE(testing::Message() << "with p = " << p);
+        ROCRAND_CHECK(rocrand_generate_bernoulli_bits(generator, data, bits, p));
+
+        std::vector<unsigned int> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        EXPECT_NEAR(bit_frequency(output, bits), p, 0.002);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_bernoulli_bits_tests,
+                        rocrand_generate_bernoulli_bits_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+                            ROCRAND_RNG_PSEUDO_MTGP32,
+                            ROCRAND_RNG_PSEUDO_MT19937
+                        ));
+
+TEST(rocrand_generate_bernoulli_bits_tests, neg_test)
+{
+    const size_t bits = 256;
+    unsigned int * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_bernoulli_bits(generator, data, bits, 0.5),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_bernoulli_bits(generator, data, bits, -0.1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_bernoulli_bits(generator, data, bits, 1.5),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_generate_bernoulli_bits(generator, data, bits, 0.5),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Bits of the device API are the same on the host (see FQUALIFIERS above)
+TEST(rocrand_generate_bernoulli_bits_tests, host_frequency_test)
+{
+    rocrand_state_philox4x32_10 state;
+    rocrand_init(12345, 0, 0, &state);
+
+    const size_t size = 65536;
+    for(const double p : { 0.375, 0.3 })
+    {
+        SCOPED_TRACE(testing::Message() << "with p = " << p);
+        std::vector<unsigned int> output(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            output[i] = rocrand_bernoulli_bits(&state, p);
+        }
+        EXPECT_NEAR(bit_frequency(output, size * 32), p, 0.002);
+    }
+}
+
+template<class GeneratorState>
+__global__
+void rocrand_bernoulli_bits_kernel(unsigned int * output, const size_t size, const double p)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    rocrand_init(12345, state_id, 0, &state);
+
+    for(size_t i = state_id; i < size; i += stride)
+    {
+        output[i] = rocrand_bernoulli_bits(&state, p);
+    }
+}
+
+template<class GeneratorState>
+void test_device_api()
+{
+    const size_t size = 65536;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    for(const double p : { 0.5, 0.0625, 0.7 })
+    {
+        SCOPED_TRACE(testing::Message() << "with p = " << p);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_bernoulli_bits_kernel<GeneratorState>),
+            dim3(64), dim3(64), 0, 0,
+            data, size, p
+        );
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<unsigned int> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+        EXPECT_NEAR(bit_frequency(output, size * 32), p, 0.002);
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_bernoulli_bits_tests, rocrand_bernoulli_bits_philox4x32_10)
+{
+    test_device_api<rocrand_state_philox4x32_10>();
+}
+
+TEST(rocrand_generate_bernoulli_bits_tests, rocrand_bernoulli_bits_xorwow)
+{
+    test_device_api<rocrand_state_xorwow>();
+}
+
+TEST(rocrand_generate_bernoulli_bits_tests, rocrand_bernoulli_bits_mrg32k3a)
+{
+    test_device_api<rocrand_state_mrg32k3a>();
+}
@@ -0,0 +1,321 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// Blocks of values of both regimes (inversion and BTRD), p > 0.5 and
+// degenerate parameters
+const unsigned int block_trials[] = { 20, 1000, 100000, 60, 0, 50 };
+const double block_probabilities[] = { 0.2, 0.03, 0.45, 0.9, 0.5, 1.0 };
+const size_t blocks = 6;
+
+void check_binomial_block(const unsigned int * values, const size_t size,
+                          const unsigned int n, const double p)
+{
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_LE(values[i], n);
+        mean += values[i];
+    }
+    mean /= size;
+
+    double variance = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        variance += (values[i] - mean) * (values[i] - mean);
+    }
+    variance /= size;
+
+    const double expected_mean = n * p;
+    const double expected_variance = n * p * (1.0 - p);
+    EXPECT_NEAR(mean, expected_mean, std::max(expected_mean * 0.02, 1e-9));
+    EXPECT_NEAR(variance, expected_variance, std::max(expected_variance * 0.05, 1e-9));
+}
+
+class rocrand_generate_binomial_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_binomial_tests, array_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t block = 40000;
+    const size_t size = blocks * block;
+    std::vector<unsigned int> trials(size);
+    std::vector<double> probabilities(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        trials[i] = block_trials[i / block];
+        probabilities[i] = block_probabilities[i / block];
+    }
+
+    unsigned int * d_trials;
+    double * d_probabilities;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&d_trials, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&d_probabilities, size * sizeof(double)));
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_trials, trials.data(), size * sizeof(unsigned int), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_probabilities, probabilities.data(), size * sizeof(double), hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_binomial_array(generator, data, d_trials, d_probabilities, size));
+
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t b = 0; b < blocks; b++)
+    {
+        SCOPED_TRACE(testing::Message() << "with n = " << block_trials[b]
+                                        << ", p = " << block_probabilities[b]);
+        check_binomial_block(output.data() + b * block, block, block_trials[b], block_probabilities[b]);
+    }
+
+    HIP_CHECK(hipFree(d_trials));
+    HIP_CHECK(hipFree(d_probabilities));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_binomial_tests, multinomial_array_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    // Parameters are stored by category: category j of value i is at j * size + i
+    const double category_probabilities[] = { 0.1, 0.0, 0.6, 0.3 };
+    const unsigned int categories = 4;
+    const size_t size = 50000;
+    std::vector<unsigned int> trials(size);
+    std::vector<double> probabilities(categories * size);
+    for(size_t i = 0; i < size; i++)
+    {
+        trials[i] = i % 2 == 0 ? 30 : 5000;
+        for(unsigned int j = 0; j < categories; j++)
+        {
+            probabilities[j * size + i] = category_probabilities[j];
+        }
+    }
+
+    unsigned int * d_trials;
+    double * d_probabilities;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&d_trials, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&d_probabilities, categories * size * sizeof(double)));
+    HIP_CHECK(hipMalloc((void **)&data, categories * size * sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_trials, trials.data(), size * sizeof(unsigned int), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_probabilities, probabilities.data(), categories * size * sizeof(double), hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_multinomial_array(
+            generator, data, d_trials, d_probabilities, categories, size
+        )
+    );
+
+    std::vector<unsigned int> output(categories * size);
+    HIP_CHECK(hipMemcpy(output.data(), data, categories * size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double means[2][categories] = { };
+    for(size_t i = 0; i < size; i++)
+    {
+        unsigned int sum = 0;
+        for(unsigned int j = 0; j < categories; j++)
+        {
+            sum += output[j * size + i];
+            means[i % 2][j] += output[j * size + i];
+        }
+        ASSERT_EQ(sum, trials[i]) << i;
+    }
+    for(size_t t = 0; t < 2; t++)
+    {
+        for(unsigned int j = 0; j < categories; j++)
+        {
+            const double expected = trials[t] * category_probabilities[j];
+            EXPECT_NEAR(means[t][j] / (size / 2), expected, expected * 0.02) << j;
+        }
+    }
+
+    HIP_CHECK(hipFree(d_trials));
+    HIP_CHECK(hipFree(d_probabilities));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_binomial_tests,
+                        rocrand_generate_binomial_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_PCG32
+                        ));
+
+TEST(rocrand_generate_binomial_tests, neg_test)
+{
+    EXPECT_EQ(
+        rocrand_generate_binomial_array(NULL, NULL, NULL, NULL, 0),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_generate_multinomial_array(NULL, NULL, NULL, NULL, 2, 0),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_multinomial_array(generator, NULL, NULL, NULL, 0, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Values draw variable counts of numbers
+    for(auto rng_type : { ROCRAND_RNG_PSEUDO_MTGP32, ROCRAND_RNG_QUASI_SOBOL32 })
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        EXPECT_EQ(
+            rocrand_generate_binomial_array(generator, NULL, NULL, NULL, 0),
+            ROCRAND_STATUS_TYPE_ERROR
+        );
+        EXPECT_EQ(
+            rocrand_generate_multinomial_array(generator, NULL, NULL, NULL, 2, 0),
+            ROCRAND_STATUS_TYPE_ERROR
+        );
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+}
+
+template<class GeneratorState>
+__global__
+void rocrand_binomial_kernel(unsigned int * output, const size_t size,
+                             const unsigned int n, const double p)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    rocrand_init(12345, state_id, 0, &state);
+
+    for(size_t i = state_id; i < size; i += stride)
+    {
+        output[i] = rocrand_binomial(&state, n, p);
+    }
+}
+
+template<class GeneratorState>
+__global__
+void rocrand_multinomial_kernel(unsigned int * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    rocrand_init(12345, state_id, 0, &state);
+
+    const double probabilities[3] = { 0.25, 0.7, 0.05 };
+    for(size_t i = state_id; i < size; i += stride)
+    {
+        rocrand_multinomial(&state, 200, probabilities, 3, output + i * 3);
+    }
+}
+
+template<class GeneratorState>
+void test_device_api()
+{
+    const size_t block = 16384;
+    const size_t size = blocks * block;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    for(size_t b = 0; b < blocks; b++)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_binomial_kernel<GeneratorState>),
+            dim3(64), dim3(64), 0, 0,
+            data + b * block, block, block_trials[b], block_probabilities[b]
+        );
+        HIP_CHECK(hipPeekAtLastError());
+    }
+
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    for(size_t b = 0; b < blocks; b++)
+    {
+        SCOPED_TRACE(testing::Message() << "with n = " << block_trials[b]
+                                        << ", p = " << block_probabilities[b]);
+        check_binomial_block(output.data() + b * block, block, block_trials[b], block_probabilities[b]);
+    }
+
+    const size_t multinomial_size = size / 3;
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_multinomial_kernel<GeneratorState>),
+        dim3(64), dim3(64), 0, 0,
+        data, multinomial_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    double means[3] = { };
+    for(size_t i = 0; i < multinomial_size; i++)
+    {
+        ASSERT_EQ(output[i * 3] + output[i * 3 + 1] + output[i * 3 + 2], 200U) << i;
+        for(size_t j = 0; j < 3; j++)
+        {
+            means[j] += output[i * 3 + j];
+        }
+    }
+    EXPECT_NEAR(means[0] / multinomial_size, 50.0, 0.5);
+    EXPECT_NEAR(means[1] / multinomial_size, 140.0, 1.4);
+    EXPECT_NEAR(means[2] / multinomial_size, 10.0, 0.1);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_binomial_tests, rocrand_binomial_philox4x32_10)
+{
+    test_device_api<rocrand_state_philox4x32_10>();
+}
+
+TEST(rocrand_generate_binomial_tests, rocrand_binomial_mrg32k3a)
+{
+    test_device_api<rocrand_state_mrg32k3a>();
+}
+
+TEST(rocrand_generate_binomial_tests, rocrand_binomial_xorwow)
+{
+    test_device_api<rocrand_state_xorwow>();
+}
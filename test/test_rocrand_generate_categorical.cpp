@@ -0,0 +1,180 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_categorical_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_categorical_tests, sparse_rows_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    // Every row has categories a, b, c with probabilities 1/8, 2/8, 5/8
+    const size_t batch = 12345;
+    const unsigned int n = 1000;
+    const size_t ld = 1024;
+    std::vector<float> probabilities(batch * ld, 0.0f);
+    for(size_t row = 0; row < batch; row++)
+    {
+        const unsigned int a = row % 300;
+        probabilities[row * ld + a] = 1.0f;
+        probabilities[row * ld + a + 300] = 2.0f;
+        probabilities[row * ld + a + 699] = 5.0f;
+        // Padding must be ignored
+        probabilities[row * ld + n] = 100.0f;
+    }
+
+    float * d_probabilities;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&d_probabilities, batch * ld * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&data, batch * sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMemcpy(
+            d_probabilities, probabilities.data(),
+            batch * ld * sizeof(float),
+            hipMemcpyHostToDevice
+        )
+    );
+
+    const rocrand_status status =
+        rocrand_generate_categorical(generator, data, d_probabilities, batch, n, ld);
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL64 ||
+       rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        EXPECT_EQ(status, ROCRAND_STATUS_TYPE_ERROR);
+    }
+    else
+    {
+        ROCRAND_CHECK(status);
+
+        std::vector<unsigned int> output(batch);
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                batch * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<size_t> histogram(3, 0);
+        for(size_t row = 0; row < batch; row++)
+        {
+            const unsigned int a = row % 300;
+            const unsigned int v = output[row];
+            ASSERT_TRUE(v == a || v == a + 300 || v == a + 699);
+            histogram[v == a ? 0 : (v == a + 300 ? 1 : 2)]++;
+        }
+        EXPECT_NEAR(histogram[0], batch * 1.0 / 8.0, batch * 0.02);
+        EXPECT_NEAR(histogram[1], batch * 2.0 / 8.0, batch * 0.02);
+        EXPECT_NEAR(histogram[2], batch * 5.0 / 8.0, batch * 0.02);
+    }
+
+    HIP_CHECK(hipFree(d_probabilities));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_categorical_tests,
+                        rocrand_generate_categorical_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_MTGP32,
+                            ROCRAND_RNG_PSEUDO_MT19937,
+                            ROCRAND_RNG_QUASI_SOBOL32,
+                            ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
+                            ROCRAND_RNG_QUASI_SOBOL64,
+                            ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+                        ));
+
+// Uniform rows with many categories, the mean category is the center
+TEST(rocrand_generate_categorical_tests, uniform_rows_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+
+    const size_t batch = 1000;
+    const unsigned int n = 50000;
+    float * d_probabilities;
+    unsigned int * data;
+    const std::vector<float> probabilities(batch * n, 0.5f);
+    HIP_CHECK(hipMalloc((void **)&d_probabilities, batch * n * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&data, batch * sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMemcpy(
+            d_probabilities, probabilities.data(),
+            batch * n * sizeof(float),
+            hipMemcpyHostToDevice
+        )
+    );
+
+    ROCRAND_CHECK(rocrand_generate_categorical(generator, data, d_probabilities, batch, n, n));
+
+    std::vector<unsigned int> output(batch);
+    HIP_CHECK(hipMemcpy(output.data(), data, batch * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(auto v : output)
+    {
+        ASSERT_LT(v, n);
+        mean += static_cast<double>(v) / n;
+    }
+    mean /= batch;
+    EXPECT_NEAR(mean, 0.5, 0.05);
+
+    HIP_CHECK(hipFree(d_probabilities));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_categorical_tests, neg_test)
+{
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_categorical(generator, NULL, NULL, 1, 10, 10),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_categorical(generator, NULL, NULL, 1, 0, 10),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_categorical(generator, NULL, NULL, 1, 10, 5),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
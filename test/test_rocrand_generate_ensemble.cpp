@@ -0,0 +1,140 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_ensemble_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+const std::vector<unsigned long long> seeds = {
+    0ULL, 1ULL, 12345ULL, 0x123456789ABCDEFULL, 0xFFFFFFFFFFFFFFFFULL
+};
+
+// Rows are the numbers of new generators with the seeds of rows, engines
+// of Philox4x32-10 with the default ordering do not generate ensembles,
+// so a counter-based ordering is set
+template<class T>
+void test_ensemble(const rocrand_rng_type rng_type,
+                   rocrand_status (*generate_ensemble)(rocrand_generator, T *,
+                                                       const unsigned long long *,
+                                                       size_t, size_t),
+                   rocrand_status (*generate)(rocrand_generator, T *, size_t))
+{
+    const size_t k = seeds.size();
+    const unsigned long long offset = 5;
+    for(const size_t n : { 1, 7, 1000, 12345 })
+    {
+        SCOPED_TRACE(testing::Message() << "with n = " << n);
+        T * data;
+        unsigned long long * d_seeds;
+        HIP_CHECK(hipMalloc((void **)&data, k * n * sizeof(T)));
+        HIP_CHECK(hipMalloc((void **)&d_seeds, k * sizeof(unsigned long long)));
+        HIP_CHECK(hipMemcpy(d_seeds, seeds.data(), k * sizeof(unsigned long long),
+                            hipMemcpyHostToDevice));
+
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_BEST));
+        ROCRAND_CHECK(rocrand_set_offset(generator, offset));
+        ROCRAND_CHECK(generate_ensemble(generator, data, d_seeds, k, n));
+        std::vector<T> ensemble(k * n);
+        HIP_CHECK(hipMemcpy(ensemble.data(), data, k * n * sizeof(T), hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+        std::vector<T> expected(n);
+        for(size_t r = 0; r < k; r++)
+        {
+            ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+            ROCRAND_CHECK(rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_BEST));
+            ROCRAND_CHECK(rocrand_set_seed(generator, seeds[r]));
+            ROCRAND_CHECK(rocrand_set_offset(generator, offset));
+            ROCRAND_CHECK(generate(generator, data, n));
+            HIP_CHECK(hipMemcpy(expected.data(), data, n * sizeof(T), hipMemcpyDeviceToHost));
+            ROCRAND_CHECK(rocrand_destroy_generator(generator));
+            for(size_t i = 0; i < n; i++)
+            {
+                ASSERT_EQ(ensemble[r * n + i], expected[i]);
+            }
+        }
+
+        HIP_CHECK(hipFree(data));
+        HIP_CHECK(hipFree(d_seeds));
+    }
+}
+
+TEST_P(rocrand_generate_ensemble_tests, uint_test)
+{
+    test_ensemble<unsigned int>(GetParam(), rocrand_generate_ensemble, rocrand_generate);
+}
+
+TEST_P(rocrand_generate_ensemble_tests, uniform_float_test)
+{
+    test_ensemble<float>(GetParam(), rocrand_generate_uniform_ensemble, rocrand_generate_uniform);
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_ensemble_tests,
+                        rocrand_generate_ensemble_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+                            ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+                            ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+                        ));
+
+TEST(rocrand_generate_ensemble_tests, neg_test)
+{
+    unsigned int * data = NULL;
+    const unsigned long long * d_seeds = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_ensemble(generator, data, d_seeds, 1, 10),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    // Generators with engines need a state per seed
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_ensemble(generator, data, d_seeds, 1, 10),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // So do engines of Philox4x32-10 with the default ordering
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_generate_ensemble(generator, data, d_seeds, 1, 10),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_BEST));
+    EXPECT_EQ(
+        rocrand_generate_ensemble(generator, data, d_seeds, 0, 10),
+        ROCRAND_STATUS_SUCCESS
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
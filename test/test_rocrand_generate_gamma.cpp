@@ -0,0 +1,302 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+template<class T>
+void check_mean_variance(const std::vector<T>& output,
+                         const double expected_mean,
+                         const double expected_variance)
+{
+    double mean = 0.0;
+    for(auto v : output)
+    {
+        mean += v;
+    }
+    mean /= output.size();
+
+    double variance = 0.0;
+    for(auto v : output)
+    {
+        variance += (v - mean) * (v - mean);
+    }
+    variance /= output.size();
+
+    EXPECT_NEAR(mean, expected_mean, expected_mean * 0.03);
+    EXPECT_NEAR(variance, expected_variance, expected_variance * 0.1);
+}
+
+class rocrand_generate_gamma_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+template<class T, class Generate>
+void test_distribution(const rocrand_rng_type rng_type,
+                       Generate generate,
+                       const double expected_mean,
+                       const double expected_variance)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 123457;
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+
+    ROCRAND_CHECK(generate(generator, data, size));
+
+    std::vector<T> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(T), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    check_mean_variance(output, expected_mean, expected_variance);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Mean of gamma is shape * scale, variance is shape * scale^2
+TEST_P(rocrand_generate_gamma_tests, gamma_test)
+{
+    for(const float shape : { 0.3f, 1.0f, 4.5f })
+    {
+        SCOPED_TRACE(testing::Message() << "with shape = " << shape);
+        const float scale = 2.0f;
+        test_distribution<float>(
+            GetParam(),
+            [=](rocrand_generator g, float * data, size_t n)
+            {
+                return rocrand_generate_gamma(g, data, n, shape, scale);
+            },
+            shape * scale, shape * scale * scale
+        );
+        test_distribution<double>(
+            GetParam(),
+            [=](rocrand_generator g, double * data, size_t n)
+            {
+                return rocrand_generate_gamma_double(g, data, n, shape, scale);
+            },
+            shape * scale, shape * scale * scale
+        );
+    }
+}
+
+TEST_P(rocrand_generate_gamma_tests, beta_test)
+{
+    for(const float alpha : { 0.5f, 2.0f })
+    {
+        SCOPED_TRACE(testing::Message() << "with alpha = " << alpha);
+        const float beta = 5.0f;
+        const double mean = alpha / (alpha + beta);
+        const double variance = alpha * beta
+            / ((alpha + beta) * (alpha + beta) * (alpha + beta + 1.0));
+        test_distribution<float>(
+            GetParam(),
+            [=](rocrand_generator g, float * data, size_t n)
+            {
+                return rocrand_generate_beta(g, data, n, alpha, beta);
+            },
+            mean, variance
+        );
+        test_distribution<double>(
+            GetParam(),
+            [=](rocrand_generator g, double * data, size_t n)
+            {
+                return rocrand_generate_beta_double(g, data, n, alpha, beta);
+            },
+            mean, variance
+        );
+    }
+}
+
+TEST_P(rocrand_generate_gamma_tests, exponential_test)
+{
+    const float lambda = 4.0f;
+    test_distribution<float>(
+        GetParam(),
+        [=](rocrand_generator g, float * data, size_t n)
+        {
+            return rocrand_generate_exponential(g, data, n, lambda);
+        },
+        1.0 / lambda, 1.0 / (lambda * lambda)
+    );
+    test_distribution<double>(
+        GetParam(),
+        [=](rocrand_generator g, double * data, size_t n)
+        {
+            return rocrand_generate_exponential_double(g, data, n, lambda);
+        },
+        1.0 / lambda, 1.0 / (lambda * lambda)
+    );
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_gamma_tests,
+                        rocrand_generate_gamma_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+                            ROCRAND_RNG_PSEUDO_MTGP32,
+                            ROCRAND_RNG_PSEUDO_MT19937
+                        ));
+
+TEST(rocrand_generate_gamma_tests, neg_test)
+{
+    const size_t size = 256;
+    float * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_gamma(generator, data, size, 1.0f, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_gamma(generator, data, size, 0.0f, 1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_beta(generator, data, size, 1.0f, -1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_exponential(generator, data, size, 0.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Quasi-random generators do not generate distributions with rejection
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_generate_gamma(generator, data, size, 1.0f, 1.0f),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    EXPECT_EQ(
+        rocrand_generate_exponential_double(generator, (double *)data, size, 1.0),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+template<class GeneratorState>
+__global__
+void rocrand_gamma_kernel(float * output, double * output_double, const size_t size,
+                          const float shape, const float beta, const float lambda)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    rocrand_init(12345, state_id, 0, &state);
+
+    for(size_t i = state_id; i < size; i += stride)
+    {
+        if(i % 3 == 0)
+        {
+            output[i] = rocrand_gamma(&state, shape, 2.0f);
+            output_double[i] = rocrand_gamma_double(&state, shape, 2.0);
+        }
+        else if(i % 3 == 1)
+        {
+            output[i] = rocrand_beta(&state, shape, beta);
+            output_double[i] = rocrand_beta_double(&state, shape, beta);
+        }
+        else
+        {
+            output[i] = rocrand_exponential(&state, lambda);
+            output_double[i] = rocrand_exponential_double(&state, lambda);
+        }
+    }
+}
+
+template<class GeneratorState>
+void test_device_api()
+{
+    const size_t size = 3 * 65536;
+    float * data;
+    double * data_double;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&data_double, size * sizeof(double)));
+
+    for(const float shape : { 0.3f, 2.5f })
+    {
+        SCOPED_TRACE(testing::Message() << "with shape = " << shape);
+        const float beta = 4.0f;
+        const float lambda = 3.0f;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_gamma_kernel<GeneratorState>),
+            dim3(64), dim3(64), 0, 0,
+            data, data_double, size, shape, beta, lambda
+        );
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<float> output(size);
+        std::vector<double> output_double(size);
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(output_double.data(), data_double, size * sizeof(double), hipMemcpyDeviceToHost));
+
+        std::vector<float> values[3];
+        std::vector<double> values_double[3];
+        for(size_t i = 0; i < size; i++)
+        {
+            values[i % 3].push_back(output[i]);
+            values_double[i % 3].push_back(output_double[i]);
+        }
+        const double beta_mean = shape / (shape + beta);
+        const double beta_variance = shape * beta
+            / ((shape + beta) * (shape + beta) * (shape + beta + 1.0));
+        check_mean_variance(values[0], 2.0 * shape, 4.0 * shape);
+        check_mean_variance(values_double[0], 2.0 * shape, 4.0 * shape);
+        check_mean_variance(values[1], beta_mean, beta_variance);
+        check_mean_variance(values_double[1], beta_mean, beta_variance);
+        check_mean_variance(values[2], 1.0 / lambda, 1.0 / (lambda * lambda));
+        check_mean_variance(values_double[2], 1.0 / lambda, 1.0 / (lambda * lambda));
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(data_double));
+}
+
+TEST(rocrand_generate_gamma_tests, rocrand_gamma_philox4x32_10)
+{
+    test_device_api<rocrand_state_philox4x32_10>();
+}
+
+TEST(rocrand_generate_gamma_tests, rocrand_gamma_xorwow)
+{
+    test_device_api<rocrand_state_xorwow>();
+}
+
+TEST(rocrand_generate_gamma_tests, rocrand_gamma_mrg32k3a)
+{
+    test_device_api<rocrand_state_mrg32k3a>();
+}
@@ -0,0 +1,228 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <hip/hip_fp16.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_half_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Converts generated values to float on device
+__global__
+void half_to_float_kernel(const __half * input, float * output, const size_t n)
+{
+    const size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(index < n)
+    {
+        output[index] = __half2float(input[index]);
+    }
+}
+
+void get_floats(const __half * data, const size_t size, std::vector<float>& output)
+{
+    float * data_float;
+    HIP_CHECK(hipMalloc((void **)&data_float, size * sizeof(float)));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(half_to_float_kernel),
+        dim3((size + 255) / 256), dim3(256), 0, 0,
+        data, data_float, size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    output.resize(size);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data_float,
+            size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data_float));
+}
+
+TEST_P(rocrand_generate_half_tests, uniform_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 1313;
+    __half * data;
+    HIP_CHECK(hipMalloc((void **)&data, (size + 1) * sizeof(__half)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_uniform_half(generator, data, size + 1));
+
+    std::vector<float> output;
+    get_floats(data, size + 1, output);
+
+    double mean = 0.0;
+    for(size_t i = 0; i < output.size(); i++)
+    {
+        ASSERT_GT(output[i], 0.0f);
+        ASSERT_LE(output[i], 1.0f);
+        mean += output[i];
+    }
+    mean /= output.size();
+    EXPECT_NEAR(mean, 0.5, 0.05);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_half_tests, normal_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 12346;
+    __half * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(__half)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_normal_half(generator, data, size, 2.0f, 5.0f));
+
+    std::vector<float> output;
+    get_floats(data, size, output);
+
+    double mean = 0.0;
+    for(size_t i = 0; i < output.size(); i++)
+    {
+        mean += output[i];
+    }
+    mean /= output.size();
+
+    double stddev = 0.0;
+    for(size_t i = 0; i < output.size(); i++)
+    {
+        stddev += std::pow(output[i] - mean, 2);
+    }
+    stddev = std::sqrt(stddev / output.size());
+
+    EXPECT_NEAR(2.0, mean, 0.4);
+    EXPECT_NEAR(5.0, stddev, 0.4);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_half_tests, log_normal_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 12346;
+    __half * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(__half)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_log_normal_half(generator, data, size, 0.5f, 0.25f));
+
+    std::vector<float> output;
+    get_floats(data, size, output);
+
+    double mean = 0.0;
+    for(size_t i = 0; i < output.size(); i++)
+    {
+        ASSERT_GT(output[i], 0.0f);
+        mean += output[i];
+    }
+    mean /= output.size();
+
+    const double expected_mean = std::exp(0.5 + 0.25 * 0.25 / 2);
+    EXPECT_NEAR(expected_mean, mean, expected_mean * 0.1);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_half_tests,
+                        rocrand_generate_half_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_MTGP32,
+                            ROCRAND_RNG_PSEUDO_MT19937,
+                            ROCRAND_RNG_QUASI_SOBOL32,
+                            ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
+                            ROCRAND_RNG_QUASI_SOBOL64,
+                            ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+                        ));
+
+TEST(rocrand_generate_half_tests, pairs_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+
+    const size_t size = 256;
+    __half * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(__half)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // n must be even
+    EXPECT_EQ(
+        rocrand_generate_uniform_half(generator, data, 1),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+    EXPECT_EQ(
+        rocrand_generate_normal_half(generator, data, 1, 0.0f, 1.0f),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+
+    // pointer must be aligned
+    EXPECT_EQ(
+        rocrand_generate_log_normal_half(generator, data + 1, 2, 0.0f, 1.0f),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_half_tests, neg_test)
+{
+    const size_t size = 256;
+    __half * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_uniform_half(generator, data, size),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
@@ -0,0 +1,198 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_multivariate_normal_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+template<class T>
+rocrand_status generate_multivariate_normal(rocrand_generator generator, T * data, size_t n,
+                                            unsigned int dimensions,
+                                            const T * mean, const T * factor);
+
+template<>
+rocrand_status generate_multivariate_normal(rocrand_generator generator, float * data, size_t n,
+                                            unsigned int dimensions,
+                                            const float * mean, const float * factor)
+{
+    return rocrand_generate_multivariate_normal(generator, data, n, dimensions, mean, factor);
+}
+
+template<>
+rocrand_status generate_multivariate_normal(rocrand_generator generator, double * data, size_t n,
+                                            unsigned int dimensions,
+                                            const double * mean, const double * factor)
+{
+    return rocrand_generate_multivariate_normal_double(generator, data, n, dimensions, mean, factor);
+}
+
+// Sample means and covariances of components are compared with mean and
+// factor * factor^T
+template<class T>
+void test_multivariate_normal(const rocrand_rng_type rng_type, const unsigned int dimensions)
+{
+    SCOPED_TRACE(testing::Message() << "with dimensions = " << dimensions);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t n = 50001;
+    std::vector<T> mean(dimensions);
+    // Column-major, the upper triangle must be ignored
+    std::vector<T> factor(dimensions * dimensions, T(1000));
+    for(unsigned int j = 0; j < dimensions; j++)
+    {
+        mean[j] = T(j) - T(2);
+        for(unsigned int k = 0; k <= j; k++)
+        {
+            factor[k * dimensions + j] = T(1) / T(1 + j + k) + (j == k ? T(1) : T(0));
+        }
+    }
+
+    T * d_mean;
+    T * d_factor;
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&d_mean, dimensions * sizeof(T)));
+    HIP_CHECK(hipMalloc((void **)&d_factor, dimensions * dimensions * sizeof(T)));
+    HIP_CHECK(hipMalloc((void **)&data, n * dimensions * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_mean, mean.data(), dimensions * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_factor, factor.data(), dimensions * dimensions * sizeof(T), hipMemcpyHostToDevice));
+
+    ROCRAND_CHECK(generate_multivariate_normal(generator, data, n, dimensions, d_mean, d_factor));
+
+    std::vector<T> output(n * dimensions);
+    HIP_CHECK(hipMemcpy(output.data(), data, n * dimensions * sizeof(T), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Component j of vector i is at j * n + i
+    std::vector<double> sample_mean(dimensions, 0.0);
+    for(unsigned int j = 0; j < dimensions; j++)
+    {
+        for(size_t i = 0; i < n; i++)
+        {
+            sample_mean[j] += output[j * n + i];
+        }
+        sample_mean[j] /= n;
+    }
+
+    for(unsigned int a = 0; a < dimensions; a++)
+    {
+        for(unsigned int b = 0; b <= a; b++)
+        {
+            double expected = 0.0;
+            double variance_a = 0.0;
+            double variance_b = 0.0;
+            for(unsigned int k = 0; k <= b; k++)
+            {
+                expected += double(factor[k * dimensions + a]) * factor[k * dimensions + b];
+                variance_b += double(factor[k * dimensions + b]) * factor[k * dimensions + b];
+            }
+            for(unsigned int k = 0; k <= a; k++)
+            {
+                variance_a += double(factor[k * dimensions + a]) * factor[k * dimensions + a];
+            }
+
+            double covariance = 0.0;
+            for(size_t i = 0; i < n; i++)
+            {
+                covariance += (output[a * n + i] - sample_mean[a]) * (output[b * n + i] - sample_mean[b]);
+            }
+            covariance /= n;
+
+            // 6 standard deviations of the sample covariance
+            const double tolerance = 6.0 * std::sqrt((variance_a * variance_b + expected * expected) / n);
+            EXPECT_NEAR(covariance, expected, tolerance) << a << ", " << b;
+            if(a == b)
+            {
+                EXPECT_NEAR(sample_mean[a], mean[a], 6.0 * std::sqrt(variance_a / n)) << a;
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(d_mean));
+    HIP_CHECK(hipFree(d_factor));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_multivariate_normal_tests, float_test)
+{
+    for(const unsigned int dimensions : { 1, 3, 10, 33 })
+    {
+        test_multivariate_normal<float>(GetParam(), dimensions);
+    }
+}
+
+TEST_P(rocrand_generate_multivariate_normal_tests, double_test)
+{
+    for(const unsigned int dimensions : { 2, 16, 64 })
+    {
+        test_multivariate_normal<double>(GetParam(), dimensions);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_multivariate_normal_tests,
+                        rocrand_generate_multivariate_normal_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+                            ROCRAND_RNG_PSEUDO_MTGP32,
+                            ROCRAND_RNG_PSEUDO_MT19937
+                        ));
+
+TEST(rocrand_generate_multivariate_normal_tests, neg_test)
+{
+    float * data = NULL;
+
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(NULL, data, 256, 2, NULL, NULL),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, data, 256, 0, NULL, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal_double(generator, (double *)data, 256, 65, NULL, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, data, 256, 2, NULL, NULL),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
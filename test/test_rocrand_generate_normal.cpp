@@ -19,6 +19,8 @@
 // THE SOFTWARE.
 
 #include <stdio.h>
+#include <cmath>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include <hip/hip_runtime.h>
@@ -44,16 +46,12 @@ TEST(rocrand_generate_normal_tests, float_test)
     HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
     HIP_CHECK(hipDeviceSynchronize());
 
-    // n must be even
-    EXPECT_EQ(
-        rocrand_generate_normal(generator, (float *) data, 1, mean, stddev),
-        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    // n may be odd and pointer may be misaligned
+    ROCRAND_CHECK(
+        rocrand_generate_normal(generator, (float *) data, 1, mean, stddev)
     );
-
-    // pointer must be aligned
-    EXPECT_EQ(
-        rocrand_generate_normal(generator, (float *)(data+1), 2, mean, stddev),
-        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    ROCRAND_CHECK(
+        rocrand_generate_normal(generator, (float *)(data+1), 3, mean, stddev)
     );
 
     ROCRAND_CHECK(
@@ -81,16 +79,12 @@ TEST(rocrand_generate_normal_tests, double_test)
     HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
     HIP_CHECK(hipDeviceSynchronize());
 
-    // n must be even
-    EXPECT_EQ(
-        rocrand_generate_normal_double(generator, (double *) data, 1, mean, stddev),
-        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    // n may be odd and pointer may be misaligned
+    ROCRAND_CHECK(
+        rocrand_generate_normal_double(generator, (double *) data, 1, mean, stddev)
     );
-
-    // pointer must be aligned
-    EXPECT_EQ(
-        rocrand_generate_normal_double(generator, (double *)(data+1), 2, mean, stddev),
-        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    ROCRAND_CHECK(
+        rocrand_generate_normal_double(generator, (double *)(data+1), 3, mean, stddev)
     );
 
     ROCRAND_CHECK(
@@ -114,3 +108,256 @@ TEST(rocrand_generate_normal_tests, neg_test)
         ROCRAND_STATUS_NOT_CREATED
     );
 }
+
+class rocrand_generate_normal_ziggurat_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+template<class T>
+void normal_method_stats(const rocrand_rng_type rng_type,
+                         const rocrand_normal_method method,
+                         rocrand_status (*generate)(rocrand_generator, T *, size_t, T, T))
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_normal_method(generator, method));
+
+    const size_t size = 123456;
+    const T mean = 3;
+    const T stddev = 2;
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Odd sizes are supported as by the Box-Muller transform
+    ROCRAND_CHECK(generate(generator, data, 1, mean, stddev));
+
+    ROCRAND_CHECK(generate(generator, data, size, mean, stddev));
+
+    std::vector<T> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(T), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double actual_mean = 0.0;
+    for(auto v : output)
+    {
+        actual_mean += v;
+    }
+    actual_mean /= size;
+
+    double actual_stddev = 0.0;
+    size_t outside_2sigma = 0;
+    for(auto v : output)
+    {
+        actual_stddev += std::pow(v - actual_mean, 2);
+        outside_2sigma += std::abs(v - mean) > 2 * stddev ? 1 : 0;
+    }
+    actual_stddev = std::sqrt(actual_stddev / size);
+
+    EXPECT_NEAR(mean, actual_mean, 0.05);
+    EXPECT_NEAR(stddev, actual_stddev, 0.05);
+    // P(|Z| > 2) = 0.0455, checks the tail and wedges of the ziggurat
+    // and the tail branches of the inverse CDF
+    EXPECT_NEAR(0.0455, static_cast<double>(outside_2sigma) / size, 0.005);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_normal_ziggurat_tests, float_test)
+{
+    normal_method_stats<float>(GetParam(), ROCRAND_NORMAL_METHOD_ZIGGURAT,
+                               rocrand_generate_normal);
+}
+
+TEST_P(rocrand_generate_normal_ziggurat_tests, double_test)
+{
+    normal_method_stats<double>(GetParam(), ROCRAND_NORMAL_METHOD_ZIGGURAT,
+                                rocrand_generate_normal_double);
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_normal_ziggurat_tests,
+                        rocrand_generate_normal_ziggurat_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW
+                        ));
+
+class rocrand_generate_normal_inversion_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_normal_inversion_tests, float_test)
+{
+    normal_method_stats<float>(GetParam(), ROCRAND_NORMAL_METHOD_INVERSION,
+                               rocrand_generate_normal);
+}
+
+TEST_P(rocrand_generate_normal_inversion_tests, double_test)
+{
+    normal_method_stats<double>(GetParam(), ROCRAND_NORMAL_METHOD_INVERSION,
+                                rocrand_generate_normal_double);
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_normal_inversion_tests,
+                        rocrand_generate_normal_inversion_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_PCG32
+                        ));
+
+TEST(rocrand_generate_normal_tests, normal_method_test)
+{
+    // MTGP32 and MT19937 draw numbers in the whole block together
+    for(auto rng_type : { ROCRAND_RNG_QUASI_SOBOL32,
+                          ROCRAND_RNG_PSEUDO_MTGP32,
+                          ROCRAND_RNG_PSEUDO_MT19937 })
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+        EXPECT_EQ(
+            rocrand_set_normal_method(generator, ROCRAND_NORMAL_METHOD_ZIGGURAT),
+            ROCRAND_STATUS_TYPE_ERROR
+        );
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    EXPECT_EQ(
+        rocrand_set_normal_method(NULL, ROCRAND_NORMAL_METHOD_ZIGGURAT),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_set_normal_method(generator, static_cast<rocrand_normal_method>(3)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+class rocrand_generate_normal_fast_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// The fast mode consumes the same numbers, values differ only by errors of
+// __logf (see the bounds in the documentation of rocrand_set_math_mode())
+TEST_P(rocrand_generate_normal_fast_tests, float_test)
+{
+    const size_t size = 123456;
+    const float mean = 3;
+    const float stddev = 2;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+
+    std::vector<float> outputs[2];
+    for(size_t i = 0; i < 2; i++)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+        ROCRAND_CHECK(rocrand_set_seed(generator, 1234567ULL));
+        ROCRAND_CHECK(rocrand_set_math_mode(
+            generator, i == 0 ? ROCRAND_MATH_MODE_ACCURATE : ROCRAND_MATH_MODE_FAST
+        ));
+        ROCRAND_CHECK(rocrand_generate_normal(generator, data, size, mean, stddev));
+        outputs[i].resize(size);
+        HIP_CHECK(hipMemcpy(outputs[i].data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipDeviceSynchronize());
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    double actual_mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        const float accurate = outputs[0][i];
+        ASSERT_NEAR(accurate, outputs[1][i], stddev * 1e-3f + std::abs(accurate) * 1e-5f);
+        actual_mean += outputs[1][i];
+    }
+    actual_mean /= size;
+
+    double actual_stddev = 0.0;
+    for(auto v : outputs[1])
+    {
+        actual_stddev += std::pow(v - actual_mean, 2);
+    }
+    actual_stddev = std::sqrt(actual_stddev / size);
+
+    EXPECT_NEAR(mean, actual_mean, 0.05);
+    EXPECT_NEAR(stddev, actual_stddev, 0.05);
+
+    HIP_CHECK(hipFree(data));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_normal_fast_tests,
+                        rocrand_generate_normal_fast_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_MTGP32,
+                            ROCRAND_RNG_PSEUDO_MT19937,
+                            ROCRAND_RNG_PSEUDO_PCG32
+                        ));
+
+TEST(rocrand_generate_normal_tests, math_mode_test)
+{
+    EXPECT_EQ(
+        rocrand_set_math_mode(NULL, ROCRAND_MATH_MODE_FAST),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_set_math_mode(generator, static_cast<rocrand_math_mode>(2)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_set_math_mode(generator, ROCRAND_MATH_MODE_FAST),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+class rocrand_generate_normal_unaligned_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Odd sizes and misaligned pointers give the same values as aligned
+// generation of the same generator
+TEST_P(rocrand_generate_normal_unaligned_tests, float_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 12345;
+
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, (size + 1) * sizeof(float)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, data, size + 1, 0.0f, 1.0f));
+    std::vector<float> expected(size + 1);
+    HIP_CHECK(hipMemcpy(expected.data(), data, (size + 1) * sizeof(float), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, data + 1, size, 0.0f, 1.0f));
+    std::vector<float> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), data + 1, size * sizeof(float), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(output[i], expected[i]);
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_normal_unaligned_tests,
+                        rocrand_generate_normal_unaligned_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW
+                        ));
@@ -0,0 +1,213 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <algorithm>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+typedef std::tuple<rocrand_rng_type, rocrand_permutation_method> permutation_params;
+
+class rocrand_generate_permutation_tests : public ::testing::TestWithParam<permutation_params> { };
+
+TEST_P(rocrand_generate_permutation_tests, permutation_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, std::get<0>(GetParam())));
+    ROCRAND_CHECK(rocrand_set_permutation_method(generator, std::get<1>(GetParam())));
+
+    for(const size_t size : { 1, 2, 255, 257, 1000, 123457 })
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+        unsigned int * data;
+        HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+        ROCRAND_CHECK(rocrand_generate_permutation(generator, data, size));
+        std::vector<unsigned int> first(size);
+        HIP_CHECK(hipMemcpy(first.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+        ROCRAND_CHECK(rocrand_generate_permutation(generator, data, size));
+        std::vector<unsigned int> second(size);
+        HIP_CHECK(hipMemcpy(second.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipFree(data));
+
+        // Consecutive calls give different permutations
+        if(size > 2)
+        {
+            EXPECT_NE(first, second);
+        }
+
+        // Every value appears once
+        std::sort(first.begin(), first.end());
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(first[i], i);
+        }
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Every position receives every value of a small permutation equally often
+TEST_P(rocrand_generate_permutation_tests, position_frequency_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, std::get<0>(GetParam())));
+    ROCRAND_CHECK(rocrand_set_permutation_method(generator, std::get<1>(GetParam())));
+
+    const size_t size = 300;
+    const size_t trials = 3000;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    std::vector<double> counts(size, 0.0);
+    std::vector<unsigned int> output(size);
+    for(size_t t = 0; t < trials; t++)
+    {
+        ROCRAND_CHECK(rocrand_generate_permutation(generator, data, size));
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        counts[output[0]] += 1.0;
+    }
+    HIP_CHECK(hipFree(data));
+
+    // Chi-squared of the value at position 0, mean 299, std. dev. 24.5
+    const double expected = static_cast<double>(trials) / size;
+    double chi_squared = 0.0;
+    for(const double c : counts)
+    {
+        chi_squared += (c - expected) * (c - expected) / expected;
+    }
+    EXPECT_LT(chi_squared, 299.0 + 6.0 * 24.5);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Elements of all sizes keep their bytes and are moved together
+TEST_P(rocrand_generate_permutation_tests, shuffle_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, std::get<0>(GetParam())));
+    ROCRAND_CHECK(rocrand_set_permutation_method(generator, std::get<1>(GetParam())));
+
+    const size_t size = 12345;
+    for(const size_t element_size : { 1, 3, 4, 8, 12, 24 })
+    {
+        SCOPED_TRACE(testing::Message() << "with element_size = " << element_size);
+        // Every element holds its index in all its bytes (modulo 256)
+        std::vector<unsigned char> input(size * element_size);
+        for(size_t i = 0; i < size; i++)
+        {
+            std::fill_n(input.begin() + i * element_size, element_size,
+                        static_cast<unsigned char>(i));
+        }
+        unsigned char * data;
+        HIP_CHECK(hipMalloc((void **)&data, input.size()));
+        HIP_CHECK(hipMemcpy(data, input.data(), input.size(), hipMemcpyHostToDevice));
+
+        ROCRAND_CHECK(rocrand_shuffle(generator, data, size, element_size));
+
+        std::vector<unsigned char> output(input.size());
+        HIP_CHECK(hipMemcpy(output.data(), data, output.size(), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipFree(data));
+
+        std::vector<size_t> counts(256, 0);
+        for(size_t i = 0; i < size; i++)
+        {
+            const unsigned char value = output[i * element_size];
+            for(size_t b = 1; b < element_size; b++)
+            {
+                ASSERT_EQ(output[i * element_size + b], value);
+            }
+            counts[value]++;
+        }
+        for(size_t v = 0; v < 256; v++)
+        {
+            EXPECT_EQ(counts[v], size / 256 + (v < size % 256 ? 1 : 0));
+        }
+        EXPECT_NE(input, output);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_permutation_tests,
+                        rocrand_generate_permutation_tests,
+                        ::testing::Combine(
+                            ::testing::Values(
+                                ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                ROCRAND_RNG_PSEUDO_XORWOW,
+                                ROCRAND_RNG_PSEUDO_MTGP32
+                            ),
+                            ::testing::Values(
+                                ROCRAND_PERMUTATION_METHOD_FEISTEL,
+                                ROCRAND_PERMUTATION_METHOD_EXACT
+                            )
+                        ));
+
+TEST(rocrand_generate_permutation_tests, neg_test)
+{
+    const size_t size = 256;
+    unsigned int * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_permutation(generator, data, size),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_set_permutation_method(generator, ROCRAND_PERMUTATION_METHOD_EXACT),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_set_permutation_method(generator, (rocrand_permutation_method)2),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_shuffle(generator, data, size, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    if(sizeof(size_t) > 4)
+    {
+        EXPECT_EQ(
+            rocrand_generate_permutation(generator, data, size_t(1) << 32),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_generate_permutation(generator, data, size),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
@@ -19,6 +19,7 @@
 // THE SOFTWARE.
 
 #include <stdio.h>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include <hip/hip_runtime.h>
@@ -88,3 +89,202 @@ TEST(rocrand_generate_poisson_tests, out_of_range_test)
     HIP_CHECK(hipFree(data));
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
+
+class rocrand_generate_poisson_large_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Large lambdas are generated without tables by pseudo-random generators
+// (rejection and normal approximation), mean and variance must be lambda
+TEST_P(rocrand_generate_poisson_large_tests, mean_variance_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 123456;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(double lambda : { 64.0, 1000.5, 20000.0 })
+    {
+        ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, lambda));
+
+        std::vector<unsigned int> output(size);
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        double mean = 0.0;
+        for(auto v : output)
+        {
+            mean += v;
+        }
+        mean /= size;
+
+        double variance = 0.0;
+        for(auto v : output)
+        {
+            variance += (v - mean) * (v - mean);
+        }
+        variance /= size;
+
+        EXPECT_NEAR(mean, lambda, lambda * 0.01);
+        EXPECT_NEAR(variance, lambda, lambda * 0.05);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_poisson_large_tests,
+                        rocrand_generate_poisson_large_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_MTGP32,
+                            ROCRAND_RNG_PSEUDO_MT19937
+                        ));
+
+TEST(rocrand_generate_poisson_tests, cache_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+
+    const size_t size = 256;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned long long hits;
+    unsigned long long misses;
+    const double lambdas[] = { 0.5, 10.0, 33.3 };
+
+    // Tables of all lambdas stay in the cache
+    for(int i = 0; i < 2; i++)
+    {
+        for(double lambda : lambdas)
+        {
+            ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, lambda));
+        }
+    }
+    ROCRAND_CHECK(rocrand_get_poisson_cache_stats(generator, &hits, &misses));
+    EXPECT_EQ(hits, 3ULL);
+    EXPECT_EQ(misses, 3ULL);
+
+    // Only tables of the last lambda are kept
+    ROCRAND_CHECK(rocrand_set_poisson_cache_size(generator, 0));
+    for(int i = 0; i < 2; i++)
+    {
+        for(double lambda : lambdas)
+        {
+            ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, lambda));
+        }
+    }
+    ROCRAND_CHECK(rocrand_get_poisson_cache_stats(generator, &hits, &misses));
+    EXPECT_EQ(hits, 4ULL);
+    EXPECT_EQ(misses, 8ULL);
+
+    EXPECT_EQ(
+        rocrand_get_poisson_cache_stats(generator, NULL, &misses),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_poisson_tests, array_test)
+{
+    for(auto rng_type : { ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                          ROCRAND_RNG_PSEUDO_MRG32K3A,
+                          ROCRAND_RNG_PSEUDO_XORWOW })
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+        // Blocks of values of small, large and huge lambdas
+        const double block_lambdas[] = { 3.5, 500.0, 10000.0, 0.0 };
+        const size_t block = 40000;
+        const size_t size = 4 * block;
+        std::vector<double> lambdas(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            lambdas[i] = block_lambdas[i / block];
+        }
+
+        double * d_lambdas;
+        unsigned int * data;
+        HIP_CHECK(hipMalloc((void **)&d_lambdas, size * sizeof(double)));
+        HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+        HIP_CHECK(
+            hipMemcpy(
+                d_lambdas, lambdas.data(),
+                size * sizeof(double),
+                hipMemcpyHostToDevice
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        ROCRAND_CHECK(rocrand_generate_poisson_array(generator, data, d_lambdas, size));
+
+        std::vector<unsigned int> output(size);
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        for(size_t b = 0; b < 4; b++)
+        {
+            const double lambda = block_lambdas[b];
+            double mean = 0.0;
+            for(size_t i = b * block; i < (b + 1) * block; i++)
+            {
+                mean += output[i];
+            }
+            mean /= block;
+            EXPECT_NEAR(mean, lambda, lambda * 0.02);
+        }
+
+        HIP_CHECK(hipFree(d_lambdas));
+        HIP_CHECK(hipFree(data));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+}
+
+TEST(rocrand_generate_poisson_tests, array_type_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_QUASI_SOBOL32
+        )
+    );
+
+    EXPECT_EQ(
+        rocrand_generate_poisson_array(generator, NULL, NULL, 0),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    EXPECT_EQ(
+        rocrand_generate_poisson_array(NULL, NULL, NULL, 0),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
@@ -0,0 +1,240 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// Central intervals, one-sided and two-sided tails (standardized bounds)
+const double intervals[][2] = {
+    { -1.0, 2.0 },
+    { 0.5, INFINITY },
+    { -INFINITY, INFINITY },
+    { 4.0, INFINITY },
+    { -INFINITY, -6.0 },
+    { -30.0, -29.5 },
+    { 10.0, 10.01 }
+};
+
+// Mean of the standard normal distribution truncated to [alpha, beta]
+double truncated_normal_mean(const double alpha, const double beta)
+{
+    const double pdf_alpha = std::isinf(alpha) ? 0.0 : std::exp(-0.5 * alpha * alpha);
+    const double pdf_beta = std::isinf(beta) ? 0.0 : std::exp(-0.5 * beta * beta);
+    // Mass of the interval times sqrt(2 * pi), precise in both tails
+    const double mass = alpha >= 0.0
+        ? std::sqrt(M_PI / 2.0) * (std::erfc(alpha / std::sqrt(2.0)) - std::erfc(beta / std::sqrt(2.0)))
+        : std::sqrt(M_PI / 2.0) * (std::erfc(-beta / std::sqrt(2.0)) - std::erfc(-alpha / std::sqrt(2.0)));
+    return (pdf_alpha - pdf_beta) / mass;
+}
+
+template<class T>
+void check_values(const std::vector<T>& output, const double mean, const double stddev,
+                  const double alpha, const double beta)
+{
+    const T a = static_cast<T>(mean + stddev * alpha);
+    const T b = static_cast<T>(mean + stddev * beta);
+    double sum = 0.0;
+    for(size_t i = 0; i < output.size(); i++)
+    {
+        ASSERT_GE(output[i], a) << i;
+        ASSERT_LE(output[i], b) << i;
+        sum += output[i];
+    }
+    const double expected = mean + stddev * truncated_normal_mean(alpha, beta);
+    EXPECT_NEAR(sum / output.size(), expected, stddev * 0.02 + std::abs(expected) * 1e-5);
+}
+
+class rocrand_generate_truncated_normal_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_truncated_normal_tests, float_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t size = 100003;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+
+    const float mean = 2.0f;
+    const float stddev = 3.0f;
+    for(const auto& interval : intervals)
+    {
+        SCOPED_TRACE(testing::Message() << "with interval = [" << interval[0] << ", " << interval[1] << "]");
+        const float a = static_cast<float>(mean + stddev * interval[0]);
+        const float b = static_cast<float>(mean + stddev * interval[1]);
+        ROCRAND_CHECK(rocrand_generate_truncated_normal(generator, data, size, mean, stddev, a, b));
+
+        std::vector<float> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipDeviceSynchronize());
+        check_values(output, mean, stddev, interval[0], interval[1]);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_truncated_normal_tests, double_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t size = 100003;
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+
+    const double mean = -1.0;
+    const double stddev = 0.5;
+    for(const auto& interval : intervals)
+    {
+        SCOPED_TRACE(testing::Message() << "with interval = [" << interval[0] << ", " << interval[1] << "]");
+        const double a = mean + stddev * interval[0];
+        const double b = mean + stddev * interval[1];
+        ROCRAND_CHECK(rocrand_generate_truncated_normal_double(generator, data, size, mean, stddev, a, b));
+
+        std::vector<double> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(double), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipDeviceSynchronize());
+        check_values(output, mean, stddev, interval[0], interval[1]);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_truncated_normal_tests,
+                        rocrand_generate_truncated_normal_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_PCG32,
+                            ROCRAND_RNG_PSEUDO_MTGP32,
+                            ROCRAND_RNG_PSEUDO_MT19937
+                        ));
+
+TEST(rocrand_generate_truncated_normal_tests, neg_test)
+{
+    const size_t size = 256;
+    float * data = NULL;
+
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(NULL, data, size, 0.0f, 1.0f, -1.0f, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 0.0f, -1.0f, 1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 1.0f, 1.0f, 1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal_double(generator, (double *)data, size, 0.0, 1.0, NAN, 1.0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 1.0f, -1.0f, 1.0f),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+template<class GeneratorState>
+__global__
+void rocrand_truncated_normal_kernel(float * output, double * output_double, const size_t size,
+                                     const double alpha, const double beta)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    rocrand_init(12345, state_id, 0, &state);
+
+    for(size_t i = state_id; i < size; i += stride)
+    {
+        output[i] = rocrand_truncated_normal(&state, 0.0f, 1.0f, alpha, beta);
+        output_double[i] = rocrand_truncated_normal_double(&state, 0.0, 1.0, alpha, beta);
+    }
+}
+
+template<class GeneratorState>
+void test_device_api()
+{
+    const size_t size = 65536;
+    float * data;
+    double * data_double;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&data_double, size * sizeof(double)));
+
+    for(const auto& interval : intervals)
+    {
+        SCOPED_TRACE(testing::Message() << "with interval = [" << interval[0] << ", " << interval[1] << "]");
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_truncated_normal_kernel<GeneratorState>),
+            dim3(64), dim3(64), 0, 0,
+            data, data_double, size, interval[0], interval[1]
+        );
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<float> output(size);
+        std::vector<double> output_double(size);
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(output_double.data(), data_double, size * sizeof(double), hipMemcpyDeviceToHost));
+        check_values(output, 0.0, 1.0, interval[0], interval[1]);
+        check_values(output_double, 0.0, 1.0, interval[0], interval[1]);
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(data_double));
+}
+
+TEST(rocrand_generate_truncated_normal_tests, rocrand_truncated_normal_philox4x32_10)
+{
+    test_device_api<rocrand_state_philox4x32_10>();
+}
+
+TEST(rocrand_generate_truncated_normal_tests, rocrand_truncated_normal_xorwow)
+{
+    test_device_api<rocrand_state_xorwow>();
+}
+
+TEST(rocrand_generate_truncated_normal_tests, rocrand_truncated_normal_mrg32k3a)
+{
+    test_device_api<rocrand_state_mrg32k3a>();
+}
@@ -0,0 +1,252 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+#include <rocrand_kernel.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+template<class T>
+void generate_values(rocrand_rng_type rng_type,
+                     rocrand_double_resolution resolution,
+                     std::vector<T>& output,
+                     size_t size,
+                     rocrand_ordering order = ROCRAND_ORDERING_PSEUDO_DEFAULT);
+
+template<>
+void generate_values(rocrand_rng_type rng_type,
+                     rocrand_double_resolution /* resolution */,
+                     std::vector<unsigned int>& output,
+                     size_t size,
+                     rocrand_ordering order)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_ordering(generator, order));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 1234567ULL));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    output.resize(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
+
+template<>
+void generate_values(rocrand_rng_type rng_type,
+                     rocrand_double_resolution resolution,
+                     std::vector<double>& output,
+                     size_t size,
+                     rocrand_ordering order)
+{
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_ordering(generator, order));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 1234567ULL));
+    ROCRAND_CHECK(rocrand_set_double_resolution(generator, resolution));
+    ROCRAND_CHECK(rocrand_generate_uniform_double(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    output.resize(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(double), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
+
+class rocrand_generate_uniform_double_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// The fast resolution consumes one 32-bit number per double: values are
+// exactly (x + 1) / 2^32 for numbers x of rocrand_generate()
+TEST_P(rocrand_generate_uniform_double_tests, fast_32bit_test)
+{
+    const size_t size = 123457;
+
+    std::vector<unsigned int> numbers;
+    generate_values(GetParam(), ROCRAND_DOUBLE_RESOLUTION_DEFAULT, numbers, size);
+    std::vector<double> values;
+    generate_values(GetParam(), ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT, values, size);
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(values[i], (numbers[i] + 1.0) / 4294967296.0) << "at " << i;
+    }
+}
+
+// The full resolution uses 53 bits: values are not multiples of 2^-32
+TEST_P(rocrand_generate_uniform_double_tests, full_53bit_test)
+{
+    const size_t size = 123457;
+
+    std::vector<double> values;
+    generate_values(GetParam(), ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT, values, size);
+
+    double mean = 0.0;
+    size_t fine_values = 0;
+    for(double v : values)
+    {
+        ASSERT_GT(v, 0.0);
+        ASSERT_LE(v, 1.0);
+        mean += v;
+        const double scaled = v * 4294967296.0;
+        if(scaled != std::floor(scaled))
+        {
+            fine_values++;
+        }
+    }
+    mean /= size;
+
+    EXPECT_NEAR(mean, 0.5, 0.01);
+    EXPECT_GT(fine_values, size * 9 / 10);
+}
+
+// The default resolution keeps sequences of previous versions
+TEST_P(rocrand_generate_uniform_double_tests, default_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 12345;
+
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 1234567ULL));
+    ROCRAND_CHECK(rocrand_generate_uniform_double(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<double> expected(size);
+    HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(double), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+
+    // Generators with 53-bit resolution by default
+    const bool full = rng_type != ROCRAND_RNG_PSEUDO_MRG32K3A
+        && rng_type != ROCRAND_RNG_PSEUDO_MTGP32
+        && rng_type != ROCRAND_RNG_PSEUDO_MT19937;
+    std::vector<double> values;
+    generate_values(rng_type, ROCRAND_DOUBLE_RESOLUTION_DEFAULT, values, size);
+    EXPECT_EQ(values, expected);
+    if(full)
+    {
+        generate_values(rng_type, ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT, values, size);
+        EXPECT_EQ(values, expected);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_uniform_double_tests,
+                        rocrand_generate_uniform_double_tests,
+                        ::testing::Values(ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                          ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+                                          ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+                                          ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+                                          ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                          ROCRAND_RNG_PSEUDO_XORWOW,
+                                          ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+                                          ROCRAND_RNG_PSEUDO_PCG32,
+                                          ROCRAND_RNG_PSEUDO_MTGP32,
+                                          ROCRAND_RNG_PSEUDO_MT19937));
+
+__global__
+void uniform_double_kernel(double * output, const size_t size, const bool full)
+{
+    const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocrand_state_philox4x32_10 state;
+    rocrand_init(1234567ULL, 0, static_cast<unsigned long long>(thread_id) * size, &state);
+    for(size_t i = 0; i < size; i++)
+    {
+        output[thread_id * size + i] = full
+            ? rocrand_uniform_double_full(&state)
+            : rocrand_uniform_double_fast(&state);
+    }
+}
+
+// Device API: one thread reproduces consecutive values of the host API
+// with counter-based ordering
+TEST(rocrand_generate_uniform_double_kernel_tests, philox_test)
+{
+    const size_t size = 1024;
+    double * output;
+    HIP_CHECK(hipMalloc((void **)&output, size * sizeof(double)));
+
+    const rocrand_double_resolution resolutions[] = {
+        ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT,
+        ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT
+    };
+    for(rocrand_double_resolution resolution : resolutions)
+    {
+        SCOPED_TRACE(testing::Message() << "with resolution = " << resolution);
+
+        const bool full = resolution == ROCRAND_DOUBLE_RESOLUTION_FULL_53BIT;
+        hipLaunchKernelGGL(uniform_double_kernel, dim3(1), dim3(1), 0, 0, output, size, full);
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+        std::vector<double> values(size);
+        HIP_CHECK(hipMemcpy(values.data(), output, size * sizeof(double), hipMemcpyDeviceToHost));
+
+        std::vector<double> expected;
+        generate_values(ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                        resolution,
+                        expected,
+                        size,
+                        ROCRAND_ORDERING_PSEUDO_BEST);
+        EXPECT_EQ(values, expected);
+    }
+    HIP_CHECK(hipFree(output));
+}
+
+TEST(rocrand_generate_uniform_double_tests, set_double_resolution_test)
+{
+    EXPECT_EQ(
+        rocrand_set_double_resolution(NULL, ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_set_double_resolution(generator, static_cast<rocrand_double_resolution>(3)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_set_double_resolution(generator, ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_set_double_resolution(generator, ROCRAND_DOUBLE_RESOLUTION_FAST_32BIT),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
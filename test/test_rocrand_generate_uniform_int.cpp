@@ -0,0 +1,174 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_uniform_int_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_uniform_int_tests, uint_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 12345;
+    const unsigned int lo = 1000;
+    const unsigned int hi = 1013;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_uniform_int(generator, data, size, lo, hi));
+
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<size_t> histogram(hi - lo, 0);
+    for(auto v : output)
+    {
+        ASSERT_GE(v, lo);
+        ASSERT_LT(v, hi);
+        histogram[v - lo]++;
+    }
+    const double expected = static_cast<double>(size) / (hi - lo);
+    for(auto h : histogram)
+    {
+        EXPECT_NEAR(h, expected, expected * 0.1);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_uniform_int_tests, ulonglong_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 12345;
+    const unsigned long long lo = 1ULL << 40;
+    const unsigned long long range = (1ULL << 62) + 7;
+    unsigned long long * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned long long)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    const rocrand_status status =
+        rocrand_generate_uniform_long_long(generator, data, size, lo, lo + range);
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL32 ||
+       rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        EXPECT_EQ(status, ROCRAND_STATUS_TYPE_ERROR);
+    }
+    else
+    {
+        ROCRAND_CHECK(status);
+
+        std::vector<unsigned long long> output(size);
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                size * sizeof(unsigned long long),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        double mean = 0.0;
+        for(auto v : output)
+        {
+            ASSERT_GE(v, lo);
+            ASSERT_LT(v, lo + range);
+            mean += static_cast<double>(v - lo) / range;
+        }
+        mean /= size;
+        EXPECT_NEAR(mean, 0.5, 0.05);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_uniform_int_tests,
+                        rocrand_generate_uniform_int_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_MTGP32,
+                            ROCRAND_RNG_PSEUDO_MT19937,
+                            ROCRAND_RNG_QUASI_SOBOL32,
+                            ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
+                            ROCRAND_RNG_QUASI_SOBOL64,
+                            ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+                        ));
+
+TEST(rocrand_generate_uniform_int_tests, neg_test)
+{
+    const size_t size = 256;
+    unsigned int * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_uniform_int(generator, data, size, 0, 10),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+TEST(rocrand_generate_uniform_int_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+
+    const size_t size = 256;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_uniform_int(generator, data, size, 10, 10),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
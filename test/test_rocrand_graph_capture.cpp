@@ -0,0 +1,150 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_graph_capture_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Every launch of a captured generation must give the numbers of the next
+// call of rocrand_generate() of a generator which is not captured
+TEST_P(rocrand_graph_capture_tests, replay_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 12345;
+    const size_t launches = 3;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    // 1 generation before capture, then launches of the graph
+    rocrand_generator expected_g;
+    ROCRAND_CHECK(rocrand_create_generator(&expected_g, rng_type));
+    std::vector<unsigned int> expected((launches + 1) * size);
+    for(size_t i = 0; i <= launches; i++)
+    {
+        ROCRAND_CHECK(rocrand_generate(expected_g, data, size));
+        HIP_CHECK(hipMemcpy(expected.data() + i * size, data, size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(expected_g));
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    ROCRAND_CHECK(rocrand_set_stream(g, stream));
+    ROCRAND_CHECK(rocrand_set_capture_safe(g, 1));
+
+    std::vector<unsigned int> output((launches + 1) * size);
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+    hipGraph_t graph;
+    hipGraphExec_t graph_exec;
+    HIP_CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipStreamEndCapture(stream, &graph));
+    HIP_CHECK(hipGraphInstantiate(&graph_exec, graph, NULL, NULL, 0));
+
+    for(size_t i = 1; i <= launches; i++)
+    {
+        HIP_CHECK(hipGraphLaunch(graph_exec, stream));
+        HIP_CHECK(hipStreamSynchronize(stream));
+        HIP_CHECK(hipMemcpy(output.data() + i * size, data, size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+    }
+
+    for(size_t i = 0; i < output.size(); i++)
+    {
+        ASSERT_EQ(output[i], expected[i]);
+    }
+
+    // Generation after capture-safe mode is disabled continues too
+    ROCRAND_CHECK(rocrand_set_capture_safe(g, 0));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    HIP_CHECK(hipGraphExecDestroy(graph_exec));
+    HIP_CHECK(hipGraphDestroy(graph));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+// Host-side setup is not captured
+TEST_P(rocrand_graph_capture_tests, uninitialized_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 1024;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    ROCRAND_CHECK(rocrand_set_stream(g, stream));
+    ROCRAND_CHECK(rocrand_set_capture_safe(g, 1));
+
+    hipGraph_t graph;
+    HIP_CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    // Tables of a new lambda can not be built
+    EXPECT_EQ(rocrand_generate_poisson(g, data, size, 3.5), ROCRAND_STATUS_LAUNCH_FAILURE);
+    EXPECT_EQ(rocrand_set_capture_safe(g, 0), ROCRAND_STATUS_LAUNCH_FAILURE);
+    HIP_CHECK(hipStreamEndCapture(stream, &graph));
+    HIP_CHECK(hipGraphDestroy(graph));
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_graph_capture_tests,
+                        rocrand_graph_capture_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_MTGP32,
+                            ROCRAND_RNG_PSEUDO_MT19937,
+                            ROCRAND_RNG_QUASI_SOBOL32,
+                            ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+                        ));
+
+TEST(rocrand_graph_capture_tests, neg_test)
+{
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_capture_safe(g, 1), ROCRAND_STATUS_NOT_CREATED);
+
+    ROCRAND_CHECK(rocrand_create_generator_host(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_set_capture_safe(g, 1), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
@@ -0,0 +1,293 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_host_generators_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_host_generators_tests, uniform_float_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator_host(&g, rng_type));
+    ROCRAND_CHECK(rocrand_set_stream(g, NULL));
+
+    const size_t size = 1313 * 1000;
+    std::vector<float> data(size);
+    ROCRAND_CHECK(rocrand_generate_uniform(g, data.data(), size));
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(data[i], 0.0f);
+        ASSERT_LE(data[i], 1.0f);
+        mean += data[i];
+    }
+    mean /= size;
+    EXPECT_NEAR(mean, 0.5, 0.05);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_host_generators_tests, same_seed_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g0 = NULL;
+    rocrand_generator g1 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator_host(&g0, rng_type));
+    ROCRAND_CHECK(rocrand_create_generator_host(&g1, rng_type));
+    if(rng_type != ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        ROCRAND_CHECK(rocrand_set_seed(g0, 5ULL));
+        ROCRAND_CHECK(rocrand_set_seed(g1, 5ULL));
+    }
+
+    const size_t size = 12345;
+    std::vector<unsigned int> data0(size);
+    std::vector<unsigned int> data1(size);
+    ROCRAND_CHECK(rocrand_generate(g0, data0.data(), size));
+    ROCRAND_CHECK(rocrand_generate(g1, data1.data(), size));
+    ASSERT_EQ(data0, data1);
+
+    ROCRAND_CHECK(rocrand_generate(g0, data0.data(), size));
+    ROCRAND_CHECK(rocrand_generate(g1, data1.data(), size));
+    ASSERT_EQ(data0, data1);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g0));
+    ROCRAND_CHECK(rocrand_destroy_generator(g1));
+}
+
+TEST_P(rocrand_host_generators_tests, normal_poisson_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator_host(&g, rng_type));
+
+    const size_t size = 1000 * 1000;
+    std::vector<double> data(size);
+    ROCRAND_CHECK(rocrand_generate_normal_double(g, data.data(), size, 2.0, 3.0));
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += data[i];
+    }
+    mean /= size;
+    EXPECT_NEAR(mean, 2.0, 0.1);
+
+    std::vector<unsigned int> values(size);
+    ROCRAND_CHECK(rocrand_generate_poisson(g, values.data(), size, 100.0));
+    mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += values[i];
+    }
+    mean /= size;
+    EXPECT_NEAR(mean, 100.0, 1.0);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_host_generators_tests, range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator_host(&g, rng_type));
+
+    const unsigned long long start = 200003;
+    const size_t size = 4099;
+    if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        std::vector<unsigned int> range(size);
+        EXPECT_EQ(rocrand_generate_range(g, range.data(), start, size),
+                  ROCRAND_STATUS_TYPE_ERROR);
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+        return;
+    }
+
+    if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        // Engines of the default ordering do not support ranges
+        std::vector<unsigned int> range(size);
+        EXPECT_EQ(rocrand_generate_range(g, range.data(), start, size),
+                  ROCRAND_STATUS_TYPE_ERROR);
+        ROCRAND_CHECK(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_BEST));
+    }
+
+    std::vector<unsigned int> range(size);
+    ROCRAND_CHECK(rocrand_generate_range(g, range.data(), start, size));
+    std::vector<unsigned int> data(start + size);
+    ROCRAND_CHECK(rocrand_generate(g, data.data(), start + size));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(range[i], data[start + i]);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_host_generators_tests,
+                        rocrand_host_generators_tests,
+                        ::testing::ValuesIn(rng_types));
+
+// Counter-based and quasi-random generators do not depend on the grid,
+// the other generators (and Philox4x32-10 with the legacy ordering) use
+// the same grid as host generators with the legacy ordering, host and
+// device generators must produce the same numbers
+void compare_host_device(const rocrand_rng_type rng_type,
+                         const unsigned long long offset,
+                         const rocrand_ordering order = ROCRAND_ORDERING_PSEUDO_LEGACY,
+                         const unsigned int engine_count = 0)
+{
+    rocrand_generator host_generator = NULL;
+    rocrand_generator device_generator = NULL;
+    ROCRAND_CHECK(rocrand_create_generator_host(&host_generator, rng_type));
+    ROCRAND_CHECK(rocrand_create_generator(&device_generator, rng_type));
+    if(rng_type < ROCRAND_RNG_QUASI_DEFAULT)
+    {
+        ROCRAND_CHECK(rocrand_set_ordering(host_generator, order));
+        ROCRAND_CHECK(rocrand_set_ordering(device_generator, order));
+    }
+    if(engine_count != 0)
+    {
+        ROCRAND_CHECK(rocrand_set_engine_count(host_generator, engine_count));
+        ROCRAND_CHECK(rocrand_set_engine_count(device_generator, engine_count));
+    }
+    // Offset can not be set for MTGP32
+    if(offset != 0)
+    {
+        ROCRAND_CHECK(rocrand_set_offset(host_generator, offset));
+        ROCRAND_CHECK(rocrand_set_offset(device_generator, offset));
+    }
+
+    const size_t sizes[] = { 1313, 1, 1024 * 1024 + 3 };
+    for(size_t size : sizes)
+    {
+        std::vector<unsigned int> host_data(size);
+        std::vector<unsigned int> device_data(size);
+        unsigned int * data;
+        HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+        ROCRAND_CHECK(rocrand_generate(host_generator, host_data.data(), size));
+        ROCRAND_CHECK(rocrand_generate(device_generator, data, size));
+        HIP_CHECK(hipMemcpy(device_data.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipFree(data));
+
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(host_data[i], device_data[i]);
+        }
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(host_generator));
+    ROCRAND_CHECK(rocrand_destroy_generator(device_generator));
+}
+
+TEST(rocrand_host_generators_tests, philox_host_device_test)
+{
+    compare_host_device(ROCRAND_RNG_PSEUDO_PHILOX4_32_10, 0);
+    compare_host_device(ROCRAND_RNG_PSEUDO_PHILOX4_32_10, 3);
+    compare_host_device(ROCRAND_RNG_PSEUDO_PHILOX4_32_10, 1234567);
+}
+
+TEST(rocrand_host_generators_tests, legacy_host_device_test)
+{
+    compare_host_device(ROCRAND_RNG_PSEUDO_XORWOW, 0);
+    compare_host_device(ROCRAND_RNG_PSEUDO_XORWOW, 1234567);
+    compare_host_device(ROCRAND_RNG_PSEUDO_MRG32K3A, 0);
+    compare_host_device(ROCRAND_RNG_PSEUDO_MRG32K3A, 1234567);
+    compare_host_device(ROCRAND_RNG_PSEUDO_MTGP32, 0);
+}
+
+// Results of the device-independent ordering do not depend on the grid
+// of device generators
+TEST(rocrand_host_generators_tests, device_independent_host_device_test)
+{
+    compare_host_device(ROCRAND_RNG_PSEUDO_XORWOW, 0, ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT);
+    compare_host_device(ROCRAND_RNG_PSEUDO_XORWOW, 1234567, ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT);
+    compare_host_device(ROCRAND_RNG_PSEUDO_MRG32K3A, 0, ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT);
+    compare_host_device(ROCRAND_RNG_PSEUDO_MRG32K3A, 1234567, ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT);
+    compare_host_device(ROCRAND_RNG_PSEUDO_MTGP32, 0, ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT);
+    compare_host_device(ROCRAND_RNG_PSEUDO_PHILOX4_32_10, 3, ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT);
+}
+
+TEST(rocrand_host_generators_tests, engine_count_host_device_test)
+{
+    compare_host_device(ROCRAND_RNG_PSEUDO_XORWOW, 0, ROCRAND_ORDERING_PSEUDO_DEFAULT, 1000);
+    compare_host_device(ROCRAND_RNG_PSEUDO_XORWOW, 1234567, ROCRAND_ORDERING_PSEUDO_LEGACY, 4096);
+    compare_host_device(ROCRAND_RNG_PSEUDO_MRG32K3A, 1234567, ROCRAND_ORDERING_PSEUDO_DEFAULT, 1000);
+    compare_host_device(ROCRAND_RNG_PSEUDO_MTGP32, 0, ROCRAND_ORDERING_PSEUDO_DEFAULT, 37);
+}
+
+TEST(rocrand_host_generators_tests, host_ordering_test)
+{
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator_host(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_BEST));
+    EXPECT_EQ(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_SEEDED), ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(rocrand_set_ordering(g, ROCRAND_ORDERING_QUASI_DEFAULT), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator_host(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_ordering(g, ROCRAND_ORDERING_QUASI_DEFAULT));
+    EXPECT_EQ(rocrand_set_ordering(g, ROCRAND_ORDERING_QUASI_POINT_MAJOR), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_host_generators_tests, sobol32_host_device_test)
+{
+    compare_host_device(ROCRAND_RNG_QUASI_SOBOL32, 0);
+    compare_host_device(ROCRAND_RNG_QUASI_SOBOL32, 1234567);
+}
+
+TEST(rocrand_host_generators_tests, sobol32_dimensions_test)
+{
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator_host(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, 4));
+    EXPECT_EQ(rocrand_set_seed(g, 1ULL), ROCRAND_STATUS_TYPE_ERROR);
+
+    std::vector<float> data(4 * 1001);
+    EXPECT_EQ(rocrand_generate_uniform(g, data.data(), 4 * 1001 - 1), ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+    ROCRAND_CHECK(rocrand_generate_uniform(g, data.data(), 4 * 1001));
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
@@ -0,0 +1,137 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+// Device functions use tables of the library
+#define ROCRAND_EXTERNAL_TABLES
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+template <class GeneratorState>
+__global__
+void rocrand_init_kernel(unsigned int * output,
+                         const unsigned long long seed,
+                         const unsigned long long offset)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    GeneratorState state;
+    rocrand_init(seed, state_id * 1234567ULL, offset * state_id, &state);
+    skipahead(state_id, &state);
+    output[state_id] = rocrand(&state);
+}
+
+// Results of the device (tables of the library in device memory) must be
+// the same as results of the host (tables of the library in host memory)
+template <class GeneratorState>
+void test_external_tables()
+{
+    const unsigned int size = 256;
+    const unsigned long long seed = 123ULL;
+    const unsigned long long offset = 98765ULL;
+
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_init_kernel<GeneratorState>),
+        dim3(size / 64), dim3(64), 0, 0,
+        output, seed, offset
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(size);
+    HIP_CHECK(hipMemcpy(output_host.data(), output, size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    for(unsigned int i = 0; i < size; i++)
+    {
+        GeneratorState state;
+        rocrand_init(seed, i * 1234567ULL, offset * i, &state);
+        skipahead(i, &state);
+        ASSERT_EQ(output_host[i], rocrand(&state));
+    }
+}
+
+TEST(rocrand_kernel_external_tables, rocrand_xorwow)
+{
+    ROCRAND_CHECK(rocrand_load_precomputed_tables());
+    test_external_tables<rocrand_state_xorwow>();
+}
+
+TEST(rocrand_kernel_external_tables, rocrand_mrg32k3a)
+{
+    ROCRAND_CHECK(rocrand_load_precomputed_tables());
+    test_external_tables<rocrand_state_mrg32k3a>();
+}
+
+TEST(rocrand_kernel_external_tables, rocrand_xoshiro128pp)
+{
+    ROCRAND_CHECK(rocrand_load_precomputed_tables());
+    test_external_tables<rocrand_state_xoshiro128pp>();
+}
+
+TEST(rocrand_kernel_external_tables, rocrand_get_device_tables)
+{
+    const rocrand_precomputed_tables * host_tables = NULL;
+    const rocrand_precomputed_tables * device_tables = NULL;
+    ROCRAND_CHECK(rocrand_get_host_tables(&host_tables));
+    ROCRAND_CHECK(rocrand_get_device_tables(&device_tables));
+    EXPECT_EQ(rocrand_get_device_tables(NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // Tables are created once per device
+    const rocrand_precomputed_tables * device_tables2 = NULL;
+    ROCRAND_CHECK(rocrand_get_device_tables(&device_tables2));
+    EXPECT_EQ(device_tables, device_tables2);
+
+    EXPECT_EQ(host_tables->xorwow_jump_log2, device_tables->xorwow_jump_log2);
+    EXPECT_EQ(host_tables->sobol_dimensions, device_tables->sobol_dimensions);
+
+    // Direction vectors of the first dimensions
+    const size_t size = 32 * 100;
+    std::vector<unsigned int> vectors(size);
+    HIP_CHECK(hipMemcpy(vectors.data(), device_tables->sobol32_direction_vectors,
+                        size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(vectors[i], host_tables->sobol32_direction_vectors[i]);
+    }
+
+    std::vector<unsigned long long> constants(host_tables->sobol_dimensions);
+    HIP_CHECK(hipMemcpy(constants.data(), device_tables->scrambled_sobol64_constants,
+                        constants.size() * sizeof(unsigned long long), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < constants.size(); i++)
+    {
+        ASSERT_EQ(constants[i], host_tables->scrambled_sobol64_constants[i]);
+    }
+}
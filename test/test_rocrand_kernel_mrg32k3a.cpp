@@ -170,12 +170,151 @@ void rocrand_discrete_kernel(unsigned int * output, const size_t size, rocrand_d
     }
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_block_generate_kernel(unsigned int * output, float * uniform_output)
+{
+    constexpr unsigned int block_size = 256;
+    constexpr unsigned int tile_size = 1000;
+    constexpr unsigned int tiles = 3;
+    __shared__ GeneratorState state;
+    __shared__ unsigned int tile[tile_size];
+    __shared__ float uniform_tile[tile_size];
+
+    rocrand_block_init(0, hipBlockIdx_x, 456ULL, &state);
+    for(unsigned int t = 0; t < tiles; t++)
+    {
+        rocrand_block_generate<block_size>(&state, tile, tile_size);
+        rocrand_block_generate_uniform<block_size>(&state, uniform_tile, tile_size);
+        const unsigned int first = (hipBlockIdx_x * tiles + t) * tile_size;
+        for(unsigned int i = hipThreadIdx_x; i < tile_size; i += block_size)
+        {
+            output[first + i] = tile[i];
+            uniform_output[first + i] = uniform_tile[i];
+        }
+        // Tiles are overwritten by the next iteration
+        __syncthreads();
+    }
+}
+
+// Same numbers as rocrand_block_generate_kernel, generated by one thread
+// of every block
+template <class GeneratorState>
+__global__
+void rocrand_block_reference_kernel(unsigned int * output, float * uniform_output)
+{
+    constexpr unsigned int tile_size = 1000;
+    constexpr unsigned int tiles = 3;
+    if(hipThreadIdx_x != 0)
+        return;
+
+    GeneratorState state;
+    rocrand_init(0, hipBlockIdx_x, 456ULL, &state);
+    for(unsigned int t = 0; t < tiles; t++)
+    {
+        const unsigned int first = (hipBlockIdx_x * tiles + t) * tile_size;
+        for(unsigned int i = 0; i < tile_size; i++)
+        {
+            output[first + i] = rocrand(&state);
+        }
+        for(unsigned int i = 0; i < tile_size; i++)
+        {
+            uniform_output[first + i] = rocrand_uniform(&state);
+        }
+    }
+}
+
+template <class GeneratorState>
+__global__
+void rocrand4_kernel(unsigned int * mismatches)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    GeneratorState state;
+    rocrand_init(0, state_id, 567ULL, &state);
+    GeneratorState scalar_state = state;
+
+    unsigned int count = 0;
+    for(unsigned int i = 0; i < 16; i++)
+    {
+        const uint4 v = rocrand4(&state);
+        count += v.x != rocrand(&scalar_state);
+        count += v.y != rocrand(&scalar_state);
+        count += v.z != rocrand(&scalar_state);
+        count += v.w != rocrand(&scalar_state);
+
+        const float4 u = rocrand_uniform4(&state);
+        count += u.x != rocrand_uniform(&scalar_state);
+        count += u.y != rocrand_uniform(&scalar_state);
+        count += u.z != rocrand_uniform(&scalar_state);
+        count += u.w != rocrand_uniform(&scalar_state);
+
+        const float4 n = rocrand_normal4(&state);
+        const float2 n1 = rocrand_normal2(&scalar_state);
+        const float2 n2 = rocrand_normal2(&scalar_state);
+        count += n.x != n1.x;
+        count += n.y != n1.y;
+        count += n.z != n2.x;
+        count += n.w != n2.y;
+    }
+    atomicAdd(mismatches, count);
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_init_fast_kernel(unsigned int * output, const size_t size,
+                              unsigned long long seed)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    rocrand_init_fast(seed, state_id, 0, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand(&state);
+        index += global_size;
+    }
+}
+
 TEST(rocrand_kernel_mrg32k3a, rocrand_state_mrg32k3a_type)
 {
     EXPECT_EQ(sizeof(rocrand_state_mrg32k3a), 12 * sizeof(unsigned int));
     EXPECT_EQ(sizeof(rocrand_state_mrg32k3a[32]), 32 * sizeof(rocrand_state_mrg32k3a));
 }
 
+TEST(rocrand_kernel_mrg32k3a, rocrand_state_mrg32k3a_compact)
+{
+    EXPECT_EQ(sizeof(rocrand_state_mrg32k3a_compact), 6 * sizeof(unsigned int));
+
+    // Compact states give the same sequences, normal values only in pairs
+    rocrand_state_mrg32k3a state;
+    rocrand_state_mrg32k3a_compact compact_state;
+    rocrand_init(0xdeadbeefbeefdeadULL, 5, 1234, &state);
+    rocrand_init(0xdeadbeefbeefdeadULL, 5, 1234, &compact_state);
+    for(size_t i = 0; i < 1000; i++)
+    {
+        ASSERT_EQ(rocrand(&state), rocrand(&compact_state));
+        ASSERT_EQ(rocrand_uniform(&state), rocrand_uniform(&compact_state));
+
+        const float2 n = rocrand_normal2(&state);
+        const float2 compact_n = rocrand_normal2(&compact_state);
+        ASSERT_EQ(n.x, compact_n.x);
+        ASSERT_EQ(n.y, compact_n.y);
+
+        const double2 ln = rocrand_log_normal_double2(&state, 1.0, 0.5);
+        const double2 compact_ln = rocrand_log_normal_double2(&compact_state, 1.0, 0.5);
+        ASSERT_EQ(ln.x, compact_ln.x);
+        ASSERT_EQ(ln.y, compact_ln.y);
+    }
+
+    skipahead(12345ULL, &state);
+    skipahead(12345ULL, &compact_state);
+    EXPECT_EQ(rocrand(&state), rocrand(&compact_state));
+}
+
 TEST(rocrand_kernel_mrg32k3a, rocrand)
 {
     typedef rocrand_state_mrg32k3a state_type;
@@ -248,6 +387,134 @@ TEST(rocrand_kernel_mrg32k3a, rocrand_uniform)
     EXPECT_NEAR(mean, 0.5, 0.1);
 }
 
+// States of rocrand_init_fast() must give the same numbers as engines
+// of the generator with seeded ordering
+TEST(rocrand_kernel_mrg32k3a, rocrand_init_fast)
+{
+    typedef rocrand_state_mrg32k3a state_type;
+
+    const unsigned int engines = 256;
+    const size_t output_size = engines * 64;
+    const unsigned long long seed = 0xabcdef12345ULL;
+    unsigned int * output;
+    unsigned int * expected;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&expected, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_init_fast_kernel<state_type>),
+        dim3(engines / 64), dim3(64), 0, 0,
+        output, output_size, seed
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_MRG32K3A));
+    ROCRAND_CHECK(rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_SEEDED));
+    ROCRAND_CHECK(rocrand_set_engine_count(generator, engines));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    ROCRAND_CHECK(rocrand_generate(generator, expected, output_size));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    std::vector<unsigned int> output_host(output_size);
+    std::vector<unsigned int> expected_host(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(), output,
+                        output_size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(expected_host.data(), expected,
+                        output_size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(expected));
+
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host[i], expected_host[i]) << i;
+    }
+}
+
+// 4-wide functions must return the same values as scalar functions
+TEST(rocrand_kernel_mrg32k3a, rocrand4)
+{
+    typedef rocrand_state_mrg32k3a state_type;
+
+    unsigned int * mismatches;
+    HIP_CHECK(hipMalloc((void **)&mismatches, sizeof(unsigned int)));
+    HIP_CHECK(hipMemset(mismatches, 0, sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand4_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        mismatches
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    unsigned int mismatches_host;
+    HIP_CHECK(hipMemcpy(&mismatches_host, mismatches, sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(mismatches));
+
+    EXPECT_EQ(mismatches_host, 0U);
+}
+
+// Block API must return the same numbers as consecutive calls with
+// the state of the block
+TEST(rocrand_kernel_mrg32k3a, rocrand_block_generate)
+{
+    typedef rocrand_state_mrg32k3a state_type;
+
+    const unsigned int blocks = 4;
+    const size_t output_size = blocks * 3 * 1000;
+    unsigned int * output;
+    float * uniform_output;
+    unsigned int * expected;
+    float * uniform_expected;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&uniform_output, output_size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&expected, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&uniform_expected, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_block_generate_kernel<state_type>),
+        dim3(blocks), dim3(256), 0, 0,
+        output, uniform_output
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_block_reference_kernel<state_type>),
+        dim3(blocks), dim3(64), 0, 0,
+        expected, uniform_expected
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    std::vector<float> uniform_output_host(output_size);
+    std::vector<unsigned int> expected_host(output_size);
+    std::vector<float> uniform_expected_host(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(), output,
+                        output_size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(uniform_output_host.data(), uniform_output,
+                        output_size * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(expected_host.data(), expected,
+                        output_size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(uniform_expected_host.data(), uniform_expected,
+                        output_size * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(uniform_output));
+    HIP_CHECK(hipFree(expected));
+    HIP_CHECK(hipFree(uniform_expected));
+
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host[i], expected_host[i]) << i;
+        ASSERT_EQ(uniform_output_host[i], uniform_expected_host[i]) << i;
+    }
+}
+
 TEST(rocrand_kernel_mrg32k3a, rocrand_normal)
 {
     typedef rocrand_state_mrg32k3a state_type;
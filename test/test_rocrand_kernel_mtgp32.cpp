@@ -179,6 +179,25 @@ void rocrand_poisson_kernel(GeneratorState * states, unsigned int * output, cons
         states[state_id] = state;
 }
 
+// Stores numbers of every state in the order of its sequence
+template <class GeneratorState>
+__global__
+void rocrand_sequence_kernel(GeneratorState * states, unsigned int * output,
+                             const unsigned int size_per_state)
+{
+    const unsigned int state_id = hipBlockIdx_x;
+
+    __shared__ GeneratorState state;
+    rocrand_mtgp32_block_copy(&states[state_id], &state);
+
+    for(unsigned int i = hipThreadIdx_x; i < size_per_state; i += hipBlockDim_x)
+    {
+        output[state_id * size_per_state + i] = rocrand(&state);
+    }
+
+    rocrand_mtgp32_block_copy(&state, &states[state_id]);
+}
+
 TEST(rocrand_kernel_mtgp32, rocrand_state_mtgp32_type)
 {
     EXPECT_EQ(sizeof(rocrand_state_mtgp32), 1078 * sizeof(unsigned int));
@@ -227,6 +246,57 @@ TEST(rocrand_kernel_mtgp32, rocrand)
     EXPECT_NEAR(mean, 0.5, 0.1);
 }
 
+// Sequences of states must not depend on the number of threads per block
+TEST(rocrand_kernel_mtgp32, rocrand_block_size)
+{
+    typedef rocrand_state_mtgp32 state_type;
+
+    const unsigned int states_size = 8;
+    const unsigned int size_per_state = 4096;
+    const size_t output_size = states_size * size_per_state;
+
+    state_type * states;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&states, sizeof(state_type) * states_size));
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> expected;
+    for(unsigned int block_size : { 256, 128, 64 })
+    {
+        ROCRAND_CHECK(rocrand_make_state_mtgp32(states, mtgp32dc_params_fast_11213, states_size, 0));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_sequence_kernel<state_type>),
+            dim3(states_size), dim3(block_size), 0, 0,
+            states, output, size_per_state
+        );
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<unsigned int> output_host(output_size);
+        HIP_CHECK(
+            hipMemcpy(
+                output_host.data(), output,
+                output_size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        if(expected.empty())
+        {
+            expected = output_host;
+        }
+        else
+        {
+            ASSERT_EQ(output_host, expected) << "block_size = " << block_size;
+        }
+    }
+
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(states));
+}
+
 TEST(rocrand_kernel_mtgp32, rocrand_uniform)
 {
     typedef rocrand_state_mtgp32 state_type;
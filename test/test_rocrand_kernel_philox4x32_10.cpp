@@ -93,6 +93,26 @@ void rocrand_uniform_kernel(float * output, const size_t size)
     }
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_uniform_int_kernel(unsigned int * output, const size_t size,
+                                const unsigned int lo, const unsigned int hi)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 0, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_uniform_int(&state, lo, hi);
+        index += global_size;
+    }
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_normal_kernel(float * output, const size_t size)
@@ -160,6 +180,28 @@ void rocrand_poisson_kernel(unsigned int * output, const size_t size, double lam
     }
 }
 
+// Lambdas of even and odd threads differ (and can use different methods),
+// all threads of warps call rocrand_poisson_warp() the same number of times
+template <class GeneratorState>
+__global__
+void rocrand_poisson_warp_kernel(unsigned int * output, const size_t size, double lambda)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(456, subsequence, 234ULL, &state);
+
+    const double thread_lambda = state_id % 2 == 0 ? lambda : 2.0 * lambda + 100.0;
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_poisson_warp(&state, thread_lambda);
+        index += global_size;
+    }
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_discrete_kernel(unsigned int * output, const size_t size, rocrand_discrete_distribution discrete_distribution)
@@ -179,12 +221,96 @@ void rocrand_discrete_kernel(unsigned int * output, const size_t size, rocrand_d
     }
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_block_generate_kernel(unsigned int * output, float * uniform_output)
+{
+    constexpr unsigned int block_size = 256;
+    constexpr unsigned int tile_size = 1000;
+    constexpr unsigned int tiles = 3;
+    __shared__ GeneratorState state;
+    __shared__ unsigned int tile[tile_size];
+    __shared__ float uniform_tile[tile_size];
+
+    rocrand_block_init(0, hipBlockIdx_x, 456ULL, &state);
+    for(unsigned int t = 0; t < tiles; t++)
+    {
+        rocrand_block_generate<block_size>(&state, tile, tile_size);
+        rocrand_block_generate_uniform<block_size>(&state, uniform_tile, tile_size);
+        const unsigned int first = (hipBlockIdx_x * tiles + t) * tile_size;
+        for(unsigned int i = hipThreadIdx_x; i < tile_size; i += block_size)
+        {
+            output[first + i] = tile[i];
+            uniform_output[first + i] = uniform_tile[i];
+        }
+        // Tiles are overwritten by the next iteration
+        __syncthreads();
+    }
+}
+
+// Same numbers as rocrand_block_generate_kernel, generated by one thread
+// of every block
+template <class GeneratorState>
+__global__
+void rocrand_block_reference_kernel(unsigned int * output, float * uniform_output)
+{
+    constexpr unsigned int tile_size = 1000;
+    constexpr unsigned int tiles = 3;
+    if(hipThreadIdx_x != 0)
+        return;
+
+    GeneratorState state;
+    rocrand_init(0, hipBlockIdx_x, 456ULL, &state);
+    for(unsigned int t = 0; t < tiles; t++)
+    {
+        const unsigned int first = (hipBlockIdx_x * tiles + t) * tile_size;
+        for(unsigned int i = 0; i < tile_size; i++)
+        {
+            output[first + i] = rocrand(&state);
+        }
+        for(unsigned int i = 0; i < tile_size; i++)
+        {
+            uniform_output[first + i] = rocrand_uniform(&state);
+        }
+    }
+}
+
 TEST(rocrand_kernel_philox4x32_10, rocrand_state_philox4x32_10_type)
 {
     EXPECT_EQ(sizeof(rocrand_state_philox4x32_10), 16 * sizeof(float));
     EXPECT_EQ(sizeof(rocrand_state_philox4x32_10[32]), 32 * sizeof(rocrand_state_philox4x32_10));
 }
 
+TEST(rocrand_kernel_philox4x32_10, rocrand_state_philox4x32_10_compact)
+{
+    EXPECT_EQ(sizeof(rocrand_state_philox4x32_10_compact), 12 * sizeof(unsigned int));
+
+    // Compact states give the same sequences, normal values only in pairs
+    rocrand_state_philox4x32_10 state;
+    rocrand_state_philox4x32_10_compact compact_state;
+    rocrand_init(0xdeadbeefbeefdeadULL, 5, 1234, &state);
+    rocrand_init(0xdeadbeefbeefdeadULL, 5, 1234, &compact_state);
+    for(size_t i = 0; i < 1000; i++)
+    {
+        ASSERT_EQ(rocrand(&state), rocrand(&compact_state));
+        ASSERT_EQ(rocrand_uniform(&state), rocrand_uniform(&compact_state));
+
+        const float2 n = rocrand_normal2(&state);
+        const float2 compact_n = rocrand_normal2(&compact_state);
+        ASSERT_EQ(n.x, compact_n.x);
+        ASSERT_EQ(n.y, compact_n.y);
+
+        const double2 ln = rocrand_log_normal_double2(&state, 1.0, 0.5);
+        const double2 compact_ln = rocrand_log_normal_double2(&compact_state, 1.0, 0.5);
+        ASSERT_EQ(ln.x, compact_ln.x);
+        ASSERT_EQ(ln.y, compact_ln.y);
+    }
+
+    skipahead(12345ULL, &state);
+    skipahead(12345ULL, &compact_state);
+    EXPECT_EQ(rocrand(&state), rocrand(&compact_state));
+}
+
 TEST(rocrand_kernel_philox4x32_10, rocrand_init)
 {
     // Just get access to internal state
@@ -329,6 +455,149 @@ TEST(rocrand_kernel_philox4x32_10, rocrand_uniform)
     EXPECT_NEAR(mean, 0.5, 0.1);
 }
 
+TEST(rocrand_kernel_philox4x32_10, rocrand_uniform_int)
+{
+    typedef rocrand_state_philox4x32_10 state_type;
+
+    const size_t output_size = 8192;
+    const unsigned int lo = 10;
+    const unsigned int hi = 17;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_uniform_int_kernel<state_type>),
+        dim3(8), dim3(32), 0, 0,
+        output, output_size, lo, hi
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    std::vector<size_t> histogram(hi - lo, 0);
+    for(auto v : output_host)
+    {
+        ASSERT_GE(v, lo);
+        ASSERT_LT(v, hi);
+        histogram[v - lo]++;
+    }
+    const double expected = static_cast<double>(output_size) / (hi - lo);
+    for(auto h : histogram)
+    {
+        EXPECT_NEAR(h, expected, expected * 0.1);
+    }
+}
+
+// Block API must return the same numbers as consecutive calls with
+// the state of the block
+TEST(rocrand_kernel_philox4x32_10, rocrand_block_generate)
+{
+    typedef rocrand_state_philox4x32_10 state_type;
+
+    const unsigned int blocks = 4;
+    const size_t output_size = blocks * 3 * 1000;
+    unsigned int * output;
+    float * uniform_output;
+    unsigned int * expected;
+    float * uniform_expected;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&uniform_output, output_size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&expected, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&uniform_expected, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_block_generate_kernel<state_type>),
+        dim3(blocks), dim3(256), 0, 0,
+        output, uniform_output
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_block_reference_kernel<state_type>),
+        dim3(blocks), dim3(64), 0, 0,
+        expected, uniform_expected
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    std::vector<float> uniform_output_host(output_size);
+    std::vector<unsigned int> expected_host(output_size);
+    std::vector<float> uniform_expected_host(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(), output,
+                        output_size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(uniform_output_host.data(), uniform_output,
+                        output_size * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(expected_host.data(), expected,
+                        output_size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(uniform_expected_host.data(), uniform_expected,
+                        output_size * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(uniform_output));
+    HIP_CHECK(hipFree(expected));
+    HIP_CHECK(hipFree(uniform_expected));
+
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host[i], expected_host[i]) << i;
+        ASSERT_EQ(uniform_output_host[i], uniform_expected_host[i]) << i;
+    }
+}
+
+// Stateless functions must return the same numbers as the state
+// at the corresponding position
+TEST(rocrand_kernel_philox4x32_10, rocrand_philox4x32_10_hash)
+{
+    typedef rocrand_state_philox4x32_10 state_type;
+
+    const unsigned long long seed = 0x123456789abcdefULL;
+    const unsigned long long subsequences[] = { 0, 1, 12345, 1ULL << 40 };
+    const unsigned long long indices[] = { 0, 1, 999, 1ULL << 33 };
+    const uint2 key = rocrand_philox4x32_10_key(seed);
+    for(auto subsequence : subsequences)
+    {
+        for(auto index : indices)
+        {
+            const uint4 counter = rocrand_philox4x32_10_counter(subsequence, index);
+
+            state_type state;
+            rocrand_init(seed, subsequence, 4 * index, &state);
+            const uint4 expected = rocrand4(&state);
+            const uint4 actual = rocrand_philox4x32_10_hash(counter, key);
+            EXPECT_EQ(actual.x, expected.x);
+            EXPECT_EQ(actual.y, expected.y);
+            EXPECT_EQ(actual.z, expected.z);
+            EXPECT_EQ(actual.w, expected.w);
+
+            rocrand_init(seed, subsequence, 4 * index, &state);
+            const float4 uniform = rocrand_uniform4(&state);
+            EXPECT_EQ(rocrand_uniform4_at(counter, key).x, uniform.x);
+            EXPECT_EQ(rocrand_uniform4_at(counter, key).w, uniform.w);
+            EXPECT_EQ(rocrand_uniform_at(counter, key), uniform.x);
+
+            rocrand_init(seed, subsequence, 4 * index, &state);
+            const float2 normal = rocrand_normal2(&state);
+            EXPECT_EQ(rocrand_normal2_at(counter, key).x, normal.x);
+            EXPECT_EQ(rocrand_normal2_at(counter, key).y, normal.y);
+
+            rocrand_init(seed, subsequence, 4 * index, &state);
+            const double2 normal_double = rocrand_normal_double2(&state);
+            EXPECT_EQ(rocrand_normal_double2_at(counter, key).x, normal_double.x);
+            EXPECT_EQ(rocrand_normal_double2_at(counter, key).y, normal_double.y);
+        }
+    }
+}
+
 TEST(rocrand_kernel_philox4x32_10, rocrand_normal)
 {
     typedef rocrand_state_philox4x32_10 state_type;
@@ -470,6 +739,60 @@ TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_poisson)
     EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 1e-1));
 }
 
+TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_poisson_warp)
+{
+    typedef rocrand_state_philox4x32_10 state_type;
+
+    const double lambda = GetParam();
+
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_poisson_warp_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size, lambda
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    // Indices of even and odd threads are even and odd
+    for(size_t parity = 0; parity < 2; parity++)
+    {
+        const double expected = parity == 0 ? lambda : 2.0 * lambda + 100.0;
+        const size_t count = output_size / 2;
+
+        double mean = 0;
+        for(size_t i = parity; i < output_size; i += 2)
+        {
+            mean += static_cast<double>(output_host[i]);
+        }
+        mean = mean / count;
+
+        double variance = 0;
+        for(size_t i = parity; i < output_size; i += 2)
+        {
+            variance += std::pow(output_host[i] - mean, 2);
+        }
+        variance = variance / count;
+
+        EXPECT_NEAR(mean, expected, std::max(1.0, expected * 1e-1));
+        EXPECT_NEAR(variance, expected, std::max(1.0, expected * 1e-1));
+    }
+}
+
 TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_discrete)
 {
     typedef rocrand_state_philox4x32_10 state_type;
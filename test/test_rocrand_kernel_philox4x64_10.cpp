@@ -0,0 +1,194 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// Numbers of subsequence 0 of the device API, 4 per thread
+__global__
+void rocrand4_kernel(unsigned int * output, const size_t size, unsigned long long seed)
+{
+    const unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(4 * index < size)
+    {
+        rocrand_state_philox4x64_10 state;
+        rocrand_init(seed, 0, 4 * index, &state);
+        const uint4 v = rocrand4(&state);
+        output[4 * index + 0] = v.x;
+        output[4 * index + 1] = v.y;
+        output[4 * index + 2] = v.z;
+        output[4 * index + 3] = v.w;
+    }
+}
+
+// Known answers from Random123
+TEST(rocrand_kernel_philox4x64_10, known_answers)
+{
+    const unsigned long long counters[][4] = {
+        { 0, 0, 0, 0 },
+        { ~0ULL, ~0ULL, ~0ULL, ~0ULL },
+        { 0x243f6a8885a308d3ULL, 0x13198a2e03707344ULL, 0xa4093822299f31d0ULL, 0x082efa98ec4e6c89ULL }
+    };
+    const unsigned long long keys[][2] = {
+        { 0, 0 },
+        { ~0ULL, ~0ULL },
+        { 0x452821e638d01377ULL, 0xbe5466cf34e90c6cULL }
+    };
+    const unsigned long long expected[][4] = {
+        { 0x16554d9eca36314cULL, 0xdb20fe9d672d0fdcULL, 0xd7e772cee186176bULL, 0x7e68b68aec7ba23bULL },
+        { 0x87b092c3013fe90bULL, 0x438c3c67be8d0224ULL, 0x9cc7d7c69cd777b6ULL, 0xa09caebf594f0ba0ULL },
+        { 0xa528f45403e61d95ULL, 0x38c72dbd566e9788ULL, 0xa5a1610e72fd18b5ULL, 0x57bd43b5e52b7fe6ULL }
+    };
+    for(size_t i = 0; i < 3; i++)
+    {
+        unsigned long long x0 = counters[i][0];
+        unsigned long long x1 = counters[i][1];
+        unsigned long long x2 = counters[i][2];
+        unsigned long long x3 = counters[i][3];
+        rocrand_device::detail::philox4x64_10_rounds(x0, x1, x2, x3, keys[i][0], keys[i][1]);
+        EXPECT_EQ(x0, expected[i][0]) << i;
+        EXPECT_EQ(x1, expected[i][1]) << i;
+        EXPECT_EQ(x2, expected[i][2]) << i;
+        EXPECT_EQ(x3, expected[i][3]) << i;
+    }
+}
+
+// Every offset (including the ones inside of the 8 numbers of one counter)
+// gives the same numbers as rocrand() calls and skipahead
+TEST(rocrand_kernel_philox4x64_10, skipahead)
+{
+    const unsigned long long seed = 0x123456789abcdefULL;
+    const size_t size = 64;
+    rocrand_state_philox4x64_10 state;
+    rocrand_init(seed, 5, 0, &state);
+    std::vector<unsigned int> expected(size + 4);
+    for(auto& v : expected)
+    {
+        v = rocrand(&state);
+    }
+    for(size_t offset = 0; offset < size; offset++)
+    {
+        rocrand_init(seed, 5, offset, &state);
+        EXPECT_EQ(rocrand(&state), expected[offset]) << offset;
+
+        rocrand_init(seed, 0, 0, &state);
+        skipahead_subsequence(5ULL, &state);
+        skipahead(offset, &state);
+        const uint4 v = rocrand4(&state);
+        EXPECT_EQ(v.x, expected[offset + 0]) << offset;
+        EXPECT_EQ(v.y, expected[offset + 1]) << offset;
+        EXPECT_EQ(v.z, expected[offset + 2]) << offset;
+        EXPECT_EQ(v.w, expected[offset + 3]) << offset;
+    }
+}
+
+// The host API generates the numbers of subsequence 0 of the device API
+TEST(rocrand_kernel_philox4x64_10, rocrand_philox4x64_10_generator)
+{
+    const unsigned long long seed = 12345ULL;
+    const size_t size = 4096;
+    unsigned int * data;
+    unsigned int * expected;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&expected, size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_64_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand4_kernel),
+        dim3(size / 4 / 64), dim3(64), 0, 0,
+        expected, size, seed
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> data_host(size);
+    std::vector<unsigned int> expected_host(size);
+    HIP_CHECK(hipMemcpy(data_host.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(expected_host.data(), expected, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    EXPECT_EQ(data_host, expected_host);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(expected));
+}
+
+// 64-bit numbers are pairs of consecutive 32-bit numbers (lower halves first)
+TEST(rocrand_kernel_philox4x64_10, rocrand_generate_long_long)
+{
+    const unsigned long long seed = 12345ULL;
+    const size_t size = 1001;
+    const unsigned long long start = 123;
+    unsigned int * data;
+    unsigned long long * long_data;
+    unsigned long long * range_data;
+    HIP_CHECK(hipMalloc((void **)&data, 2 * size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&long_data, size * sizeof(unsigned long long)));
+    HIP_CHECK(hipMalloc((void **)&range_data, (size - start) * sizeof(unsigned long long)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_64_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    ROCRAND_CHECK(rocrand_generate(generator, data, 2 * size));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_64_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    ROCRAND_CHECK(rocrand_generate_long_long(generator, long_data, size));
+    ROCRAND_CHECK(rocrand_generate_long_long_range(generator, range_data, start, size - start));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> data_host(2 * size);
+    std::vector<unsigned long long> long_data_host(size);
+    std::vector<unsigned long long> range_data_host(size - start);
+    HIP_CHECK(hipMemcpy(data_host.data(), data, data_host.size() * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(long_data_host.data(), long_data, long_data_host.size() * sizeof(unsigned long long), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(range_data_host.data(), range_data, range_data_host.size() * sizeof(unsigned long long), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        const unsigned long long expected =
+            data_host[2 * i] | (static_cast<unsigned long long>(data_host[2 * i + 1]) << 32);
+        ASSERT_EQ(long_data_host[i], expected) << i;
+        if(i >= start)
+        {
+            ASSERT_EQ(range_data_host[i - start], expected) << i;
+        }
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(long_data));
+    HIP_CHECK(hipFree(range_data));
+}
@@ -0,0 +1,258 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// Numbers of engines of the host API: engine i is subsequence i,
+// its numbers are stored with stride engines
+template <class GeneratorState>
+__global__
+void rocrand_engines_kernel(unsigned int * output, const size_t size,
+                            const unsigned int engines, unsigned long long seed)
+{
+    const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(engine_id < engines)
+    {
+        GeneratorState state;
+        rocrand_init(seed, engine_id, 0, &state);
+        for(size_t i = engine_id; i < size; i += engines)
+        {
+            output[i] = rocrand(&state);
+        }
+    }
+}
+
+// Reference implementation of xoshiro128++ (xoshiro128plusplus.c)
+struct xoshiro128pp_reference
+{
+    unsigned int s[4];
+
+    static unsigned int rotl(const unsigned int x, int k)
+    {
+        return (x << k) | (x >> (32 - k));
+    }
+
+    unsigned int next()
+    {
+        const unsigned int result = rotl(s[0] + s[3], 7) + s[0];
+        const unsigned int t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+
+    // 2^64 calls of next()
+    void jump()
+    {
+        static const unsigned int JUMP[] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+        unsigned int s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        for(int i = 0; i < 4; i++)
+        {
+            for(int b = 0; b < 32; b++)
+            {
+                if(JUMP[i] & (1U << b))
+                {
+                    s0 ^= s[0];
+                    s1 ^= s[1];
+                    s2 ^= s[2];
+                    s3 ^= s[3];
+                }
+                next();
+            }
+        }
+        s[0] = s0;
+        s[1] = s1;
+        s[2] = s2;
+        s[3] = s3;
+    }
+};
+
+xoshiro128pp_reference make_reference(const unsigned long long seed)
+{
+    const unsigned long long s01 = rocrand_device::detail::splitmix64_seed(seed, 0);
+    const unsigned long long s23 = rocrand_device::detail::splitmix64_seed(seed, 1);
+    return xoshiro128pp_reference {{
+        static_cast<unsigned int>(s01), static_cast<unsigned int>(s01 >> 32),
+        static_cast<unsigned int>(s23), static_cast<unsigned int>(s23 >> 32)
+    }};
+}
+
+TEST(rocrand_kernel_small_state, xoshiro128pp_reference)
+{
+    const unsigned long long seed = 12345ULL;
+    xoshiro128pp_reference reference = make_reference(seed);
+    rocrand_state_xoshiro128pp state;
+    rocrand_init(seed, 0, 0, &state);
+    for(int i = 0; i < 1000; i++)
+    {
+        EXPECT_EQ(rocrand(&state), reference.next()) << i;
+    }
+
+    // Jump polynomials of subsequences give the jump of the reference
+    reference = make_reference(seed);
+    reference.jump();
+    rocrand_init(seed, 1, 0, &state);
+    EXPECT_EQ(rocrand(&state), reference.next());
+    reference.jump();
+    reference.jump();
+    skipahead_subsequence(2ULL, &state);
+    EXPECT_EQ(rocrand(&state), reference.next());
+}
+
+template<class StateType>
+void test_skipahead()
+{
+    const unsigned long long seed = 67890ULL;
+    const unsigned long long offsets[] = { 1, 5, 127, 128, 129, 1000, 4097, 40000 };
+    for(const unsigned long long offset : offsets)
+    {
+        StateType state;
+        rocrand_init(seed, 3, 0, &state);
+        for(unsigned long long i = 0; i < offset; i++)
+        {
+            rocrand(&state);
+        }
+        const unsigned int expected = rocrand(&state);
+
+        rocrand_init(seed, 3, offset, &state);
+        EXPECT_EQ(rocrand(&state), expected) << offset;
+
+        rocrand_init(seed, 0, 0, &state);
+        skipahead_subsequence(3ULL, &state);
+        skipahead(offset, &state);
+        EXPECT_EQ(rocrand(&state), expected) << offset;
+    }
+}
+
+TEST(rocrand_kernel_small_state, xoshiro128pp_skipahead)
+{
+    test_skipahead<rocrand_state_xoshiro128pp>();
+}
+
+// Known answers of pcg32-demo (pcg32_srandom_r(&rng, 42u, 54u))
+TEST(rocrand_kernel_small_state, pcg32_known_answers)
+{
+    const unsigned int expected[] = {
+        0xa15c02b7U, 0x7b47f409U, 0xba1d3330U, 0x83d2f293U, 0xbfa4784bU, 0xcbed606eU
+    };
+    rocrand_state_pcg32 state;
+    rocrand_init(42ULL, 54ULL, 0, &state);
+    for(size_t i = 0; i < 6; i++)
+    {
+        EXPECT_EQ(rocrand(&state), expected[i]) << i;
+    }
+}
+
+TEST(rocrand_kernel_small_state, pcg32_skipahead)
+{
+    const unsigned long long seed = 67890ULL;
+    const unsigned long long offsets[] = { 1, 5, 127, 128, 129, 1000, 4097, 40000 };
+    for(const unsigned long long offset : offsets)
+    {
+        rocrand_state_pcg32 state;
+        rocrand_init(seed, 3, 0, &state);
+        for(unsigned long long i = 0; i < offset; i++)
+        {
+            rocrand(&state);
+        }
+        const unsigned int expected = rocrand(&state);
+
+        rocrand_init(seed, 3, offset, &state);
+        EXPECT_EQ(rocrand(&state), expected) << offset;
+    }
+
+    // Other streams give other numbers at the same position (the first few
+    // numbers after the switch differ only in low bits of the state)
+    rocrand_state_pcg32 state0, state1;
+    rocrand_init(seed, 3, 0, &state0);
+    rocrand_init(seed, 3, 0, &state1);
+    skipahead_subsequence(1ULL, &state1);
+    skipahead(4ULL, &state0);
+    skipahead(4ULL, &state1);
+    const uint4 v0 = rocrand4(&state0);
+    const uint4 v1 = rocrand4(&state1);
+    EXPECT_NE(v0.x, v1.x);
+    EXPECT_NE(v0.y, v1.y);
+    EXPECT_NE(v0.z, v1.z);
+    EXPECT_NE(v0.w, v1.w);
+}
+
+// The host API generates the numbers of subsequences 0, 1... of the device API
+template<class StateType>
+void test_generator(const rocrand_rng_type rng_type)
+{
+    const unsigned long long seed = 12345ULL;
+    const unsigned int engines = 256;
+    const size_t size = 4096;
+    unsigned int * data;
+    unsigned int * expected;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&expected, size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_engine_count(generator, engines));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_engines_kernel<StateType>),
+        dim3(engines / 64), dim3(64), 0, 0,
+        expected, size, engines, seed
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> data_host(size);
+    std::vector<unsigned int> expected_host(size);
+    HIP_CHECK(hipMemcpy(data_host.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(expected_host.data(), expected, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    EXPECT_EQ(data_host, expected_host);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(expected));
+}
+
+TEST(rocrand_kernel_small_state, rocrand_xoshiro128pp_generator)
+{
+    test_generator<rocrand_state_xoshiro128pp>(ROCRAND_RNG_PSEUDO_XOSHIRO128PP);
+}
+
+TEST(rocrand_kernel_small_state, rocrand_pcg32_generator)
+{
+    test_generator<rocrand_state_pcg32>(ROCRAND_RNG_PSEUDO_PCG32);
+}
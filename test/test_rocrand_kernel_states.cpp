@@ -0,0 +1,192 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+const unsigned int values_per_state = 8;
+
+// Numbers of states of rocrand_init() in every thread, state i is
+// subsequence i
+template<class GeneratorState>
+__global__
+void rocrand_init_generate_kernel(unsigned int * output, const size_t n,
+                                  const unsigned long long seed)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(state_id < n)
+    {
+        GeneratorState state;
+        rocrand_init(seed, state_id, 0, &state);
+        for(unsigned int i = 0; i < values_per_state; i++)
+        {
+            output[state_id * values_per_state + i] = rocrand(&state);
+        }
+    }
+}
+
+template<class GeneratorState>
+__global__
+void rocrand_generate_kernel(GeneratorState * states, unsigned int * output, const size_t n)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(state_id < n)
+    {
+        GeneratorState state = states[state_id];
+        for(unsigned int i = 0; i < values_per_state; i++)
+        {
+            output[state_id * values_per_state + i] = rocrand(&state);
+        }
+        states[state_id] = state;
+    }
+}
+
+// States of the structure of arrays layout are loaded and stored back
+template<class GeneratorState>
+__global__
+void rocrand_generate_soa_kernel(unsigned int * soa_states, unsigned int * output, const size_t n)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(state_id < n)
+    {
+        GeneratorState state;
+        rocrand_load_state_soa(soa_states, n, state_id, &state);
+        for(unsigned int i = 0; i < values_per_state; i++)
+        {
+            output[state_id * values_per_state + i] = rocrand(&state);
+        }
+        rocrand_store_state_soa(soa_states, n, state_id, &state);
+    }
+}
+
+template<class GeneratorState>
+struct rocrand_kernel_states : public ::testing::Test
+{
+    typedef GeneratorState state_type;
+};
+
+typedef ::testing::Types<
+    rocrand_state_xorwow,
+    rocrand_state_xorwow_compact,
+    rocrand_state_mrg32k3a,
+    rocrand_state_mrg32k3a_compact,
+    rocrand_state_philox4x32_10,
+    rocrand_state_philox4x32_10_compact
+> rocrand_kernel_states_types;
+
+TYPED_TEST_CASE(rocrand_kernel_states, rocrand_kernel_states_types);
+
+// Cached Box-Muller values of states are not initialized by rocrand_init(),
+// so states are compared by their numbers
+TYPED_TEST(rocrand_kernel_states, rocrand_create_states)
+{
+    typedef typename TestFixture::state_type state_type;
+
+    const unsigned long long seed = 0xdeadbeefbeefdeadULL;
+    // A partial block and blocks of 256 states
+    const size_t sizes[] = { 1, 100, 256, 4096 + 17 };
+    for(size_t n : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with n = " << n);
+
+        const size_t size = n * values_per_state;
+        unsigned int * output;
+        HIP_CHECK(hipMalloc((void **)&output, size * sizeof(unsigned int)));
+        state_type * states;
+        HIP_CHECK(hipMalloc((void **)&states, n * sizeof(state_type)));
+        unsigned int * soa_states;
+        HIP_CHECK(hipMalloc((void **)&soa_states, n * sizeof(state_type)));
+        const dim3 blocks((n + 63) / 64);
+        const dim3 threads(64);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_init_generate_kernel<state_type>),
+            blocks, threads, 0, 0,
+            output, n, seed
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+        std::vector<unsigned int> expected(size);
+        HIP_CHECK(hipMemcpy(expected.data(), output, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+        std::vector<unsigned int> values(size);
+        ROCRAND_CHECK(rocrand_create_states(states, n, seed));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_generate_kernel<state_type>),
+            blocks, threads, 0, 0,
+            states, output, n
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(values.data(), output, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        EXPECT_EQ(values, expected);
+
+        ROCRAND_CHECK(rocrand_create_states_soa<state_type>(soa_states, n, seed));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_generate_soa_kernel<state_type>),
+            blocks, threads, 0, 0,
+            soa_states, output, n
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(values.data(), output, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        EXPECT_EQ(values, expected);
+
+        // Stored states continue the sequences
+        std::vector<unsigned int> aos_values(size);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_generate_kernel<state_type>),
+            blocks, threads, 0, 0,
+            states, output, n
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(aos_values.data(), output, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_generate_soa_kernel<state_type>),
+            blocks, threads, 0, 0,
+            soa_states, output, n
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(values.data(), output, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        EXPECT_EQ(values, aos_values);
+        EXPECT_NE(values, expected);
+
+        HIP_CHECK(hipFree(soa_states));
+        HIP_CHECK(hipFree(states));
+        HIP_CHECK(hipFree(output));
+    }
+}
+
+TEST(rocrand_kernel_states, rocrand_create_states_empty)
+{
+    ROCRAND_CHECK(rocrand_create_states<rocrand_state_xorwow>(NULL, 0, 1234ULL));
+    ROCRAND_CHECK(rocrand_create_states_soa<rocrand_state_xorwow>(NULL, 0, 1234ULL));
+}
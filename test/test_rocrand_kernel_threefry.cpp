@@ -0,0 +1,191 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// Numbers of subsequence 0 of the device API, 4 per thread
+template <class GeneratorState>
+__global__
+void rocrand4_kernel(unsigned int * output, const size_t size, unsigned long long seed)
+{
+    const unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(4 * index < size)
+    {
+        GeneratorState state;
+        rocrand_init(seed, 0, 4 * index, &state);
+        const uint4 v = rocrand4(&state);
+        output[4 * index + 0] = v.x;
+        output[4 * index + 1] = v.y;
+        output[4 * index + 2] = v.z;
+        output[4 * index + 3] = v.w;
+    }
+}
+
+// Known answers from Random123
+TEST(rocrand_kernel_threefry, threefry4x32_20_known_answers)
+{
+    const uint4 counters[] = {
+        { 0, 0, 0, 0 },
+        { 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU },
+        { 0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U }
+    };
+    const uint4 keys[] = {
+        { 0, 0, 0, 0 },
+        { 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU },
+        { 0xa4093822U, 0x299f31d0U, 0x082efa98U, 0xec4e6c89U }
+    };
+    const uint4 expected[] = {
+        { 0x9c6ca96aU, 0xe17eae66U, 0xfc10ecd4U, 0x5256a7d8U },
+        { 0x2a881696U, 0x57012287U, 0xf6c7446eU, 0xa16a6732U },
+        { 0x59cd1dbbU, 0xb8879579U, 0x86b5d00cU, 0xac8b6d84U }
+    };
+    for(size_t i = 0; i < 3; i++)
+    {
+        const uint4 actual = rocrand_device::detail::threefry4x32_20_rounds(counters[i], keys[i]);
+        EXPECT_EQ(actual.x, expected[i].x) << i;
+        EXPECT_EQ(actual.y, expected[i].y) << i;
+        EXPECT_EQ(actual.z, expected[i].z) << i;
+        EXPECT_EQ(actual.w, expected[i].w) << i;
+    }
+}
+
+TEST(rocrand_kernel_threefry, threefry2x64_20_known_answers)
+{
+    const unsigned long long counters[][2] = {
+        { 0, 0 },
+        { 0x243f6a8885a308d3ULL, 0x13198a2e03707344ULL }
+    };
+    const unsigned long long keys[][2] = {
+        { 0, 0 },
+        { 0xa4093822299f31d0ULL, 0x082efa98ec4e6c89ULL }
+    };
+    const unsigned long long expected[][2] = {
+        { 0xc2b6e3a8c2c69865ULL, 0x6f81ed42f350084dULL },
+        { 0x263c7d30bb0f0af1ULL, 0x56be8361d3311526ULL }
+    };
+    for(size_t i = 0; i < 2; i++)
+    {
+        unsigned long long x0 = counters[i][0];
+        unsigned long long x1 = counters[i][1];
+        rocrand_device::detail::threefry2x64_20_rounds(x0, x1, keys[i][0], keys[i][1]);
+        EXPECT_EQ(x0, expected[i][0]) << i;
+        EXPECT_EQ(x1, expected[i][1]) << i;
+    }
+}
+
+// Stateless functions must return the same numbers as the state
+// at the corresponding position
+template<class StateType, class Hash>
+void test_hash(Hash hash)
+{
+    const unsigned long long seed = 0x123456789abcdefULL;
+    const unsigned long long subsequences[] = { 0, 1, 12345, 1ULL << 40 };
+    const unsigned long long indices[] = { 0, 1, 999, 1ULL << 33 };
+    const uint2 key = rocrand_philox4x32_10_key(seed);
+    for(auto subsequence : subsequences)
+    {
+        for(auto index : indices)
+        {
+            const uint4 counter = rocrand_philox4x32_10_counter(subsequence, index);
+
+            StateType state;
+            rocrand_init(seed, subsequence, 4 * index, &state);
+            const uint4 expected = rocrand4(&state);
+            const uint4 actual = hash(counter, key);
+            EXPECT_EQ(actual.x, expected.x);
+            EXPECT_EQ(actual.y, expected.y);
+            EXPECT_EQ(actual.z, expected.z);
+            EXPECT_EQ(actual.w, expected.w);
+
+            // Numbers of the state continue in the next counter
+            rocrand_init(seed, subsequence, 4 * index + 3, &state);
+            EXPECT_EQ(rocrand(&state), expected.w);
+            skipahead(4ULL, &state);
+            EXPECT_EQ(rocrand(&state), hash(rocrand_philox4x32_10_counter(subsequence, index + 2), key).x);
+        }
+    }
+}
+
+TEST(rocrand_kernel_threefry, rocrand_threefry4x32_20_hash)
+{
+    test_hash<rocrand_state_threefry4x32_20>(rocrand_threefry4x32_20_hash);
+}
+
+TEST(rocrand_kernel_threefry, rocrand_threefry2x64_20_hash)
+{
+    test_hash<rocrand_state_threefry2x64_20>(rocrand_threefry2x64_20_hash);
+}
+
+// The host API generates the numbers of subsequence 0 of the device API
+template<class StateType>
+void test_generator(const rocrand_rng_type rng_type)
+{
+    const unsigned long long seed = 12345ULL;
+    const size_t size = 4096;
+    unsigned int * data;
+    unsigned int * expected;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&expected, size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand4_kernel<StateType>),
+        dim3(size / 4 / 64), dim3(64), 0, 0,
+        expected, size, seed
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> data_host(size);
+    std::vector<unsigned int> expected_host(size);
+    HIP_CHECK(hipMemcpy(data_host.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(expected_host.data(), expected, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    EXPECT_EQ(data_host, expected_host);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(expected));
+}
+
+TEST(rocrand_kernel_threefry, rocrand_threefry4x32_20_generator)
+{
+    test_generator<rocrand_state_threefry4x32_20>(ROCRAND_RNG_PSEUDO_THREEFRY4_32_20);
+}
+
+TEST(rocrand_kernel_threefry, rocrand_threefry2x64_20_generator)
+{
+    test_generator<rocrand_state_threefry2x64_20>(ROCRAND_RNG_PSEUDO_THREEFRY2_64_20);
+}
@@ -0,0 +1,259 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <set>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include <rng/generator_type.hpp>
+#include <rng/generators.hpp>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+template<class Generator>
+class rocrand_point_set_qrng_tests : public ::testing::Test { };
+
+typedef ::testing::Types<rocrand_lattice, rocrand_halton> point_set_generators;
+TYPED_TEST_CASE(rocrand_point_set_qrng_tests, point_set_generators);
+
+TYPED_TEST(rocrand_point_set_qrng_tests, uniform_float_test)
+{
+    const unsigned int dimensions = 6;
+    const size_t points = 4096;
+    const size_t size = points * dimensions;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * size));
+
+    TypeParam g;
+    g.set_dimensions(dimensions);
+    ROCRAND_CHECK(g.generate(data, size));
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(unsigned int d = 0; d < dimensions; d++)
+    {
+        double sum = 0;
+        for(size_t p = 0; p < points; p++)
+        {
+            const float x = host_data[d * points + p];
+            ASSERT_GT(x, 0.0f);
+            ASSERT_LE(x, 1.0f);
+            sum += x;
+        }
+        // Quasi-random points are much closer to the mean than random ones
+        EXPECT_NEAR(sum / points, 0.5, 0.002);
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+TYPED_TEST(rocrand_point_set_qrng_tests, normal_double_test)
+{
+    const size_t size = 4096;
+    double * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(double) * size));
+
+    TypeParam g;
+    ROCRAND_CHECK(g.generate_normal(data, size, 2.0, 5.0));
+
+    std::vector<double> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(double) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean = mean / size;
+
+    double std = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        std += (host_data[i] - mean) * (host_data[i] - mean);
+    }
+    std = sqrt(std / size);
+
+    EXPECT_NEAR(2.0, mean, 0.1);
+    EXPECT_NEAR(5.0, std, 0.2);
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Point-major results must be the transposed dimension-major results,
+// consecutive generations continue the sequence
+TYPED_TEST(rocrand_point_set_qrng_tests, point_major_test)
+{
+    const unsigned int dimensions = 13;
+    const size_t points = 1031;
+    const size_t size = points * dimensions;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size * 2));
+
+    TypeParam g0;
+    TypeParam g1;
+    g0.set_dimensions(dimensions);
+    g1.set_dimensions(dimensions);
+    g0.set_seed(17);
+    g1.set_seed(17);
+    ROCRAND_CHECK(g1.set_order(ROCRAND_ORDERING_QUASI_POINT_MAJOR));
+
+    std::vector<unsigned int> host_data0(size * 2);
+    std::vector<unsigned int> host_data1(size * 2);
+    ROCRAND_CHECK(g0.generate(data, size * 2));
+    HIP_CHECK(hipMemcpy(host_data0.data(), data, sizeof(unsigned int) * size * 2, hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(g1.generate(data, size));
+    ROCRAND_CHECK(g1.generate(data + size, size));
+    HIP_CHECK(hipMemcpy(host_data1.data(), data, sizeof(unsigned int) * size * 2, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t p = 0; p < points * 2; p++)
+    {
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            ASSERT_EQ(host_data0[d * points * 2 + p], host_data1[p * dimensions + d]);
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+// The seed changes the random shift or scrambling, the offset skips points
+TYPED_TEST(rocrand_point_set_qrng_tests, seed_offset_test)
+{
+    const unsigned int dimensions = 4;
+    const size_t points = 64;
+    const size_t size = points * dimensions;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * (size + dimensions)));
+
+    std::vector<unsigned int> host_data0(size + dimensions);
+    std::vector<unsigned int> host_data1(size);
+    std::vector<unsigned int> host_data2(size);
+
+    TypeParam g0;
+    g0.set_dimensions(dimensions);
+    ROCRAND_CHECK(g0.set_order(ROCRAND_ORDERING_QUASI_POINT_MAJOR));
+    ROCRAND_CHECK(g0.generate(data, size + dimensions));
+    HIP_CHECK(hipMemcpy(host_data0.data(), data, sizeof(unsigned int) * (size + dimensions), hipMemcpyDeviceToHost));
+
+    g0.set_offset(1);
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipMemcpy(host_data1.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+
+    g0.set_offset(0);
+    g0.set_seed(1234);
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipMemcpy(host_data2.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data1[i], host_data0[i + dimensions]);
+        same += host_data2[i] == host_data0[i] ? 1 : 0;
+    }
+    // Halton coordinates of base 2 are not scrambled (the factor is 1),
+    // other factors can be equal for both seeds
+    EXPECT_LT(same, size / 2);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TYPED_TEST(rocrand_point_set_qrng_tests, dimensions_test)
+{
+    const size_t size = 12345;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * size));
+
+    TypeParam g;
+    ROCRAND_CHECK(g.generate(data, size));
+
+    g.set_dimensions(4);
+    EXPECT_EQ(g.generate(data, size), ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+
+    g.set_dimensions(15);
+    ROCRAND_CHECK(g.generate(data, size));
+
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+}
+
+// The first 2^m points of an extensible lattice with odd generating vector
+// components have one coordinate in each of 2^m intervals of every dimension
+TEST(rocrand_lattice_qrng_tests, stratification_test)
+{
+    const unsigned int dimensions = 8;
+    const size_t points = 1024;
+    const size_t size = points * dimensions;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_LATTICE));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+    ROCRAND_CHECK(rocrand_set_seed(g, 5));
+    for(int user_vector = 0; user_vector < 2; user_vector++)
+    {
+        if(user_vector)
+        {
+            const unsigned int vector[dimensions] = { 1, 433461, 315689, 441789, 501101, 146355, 88411, 215837 };
+            ROCRAND_CHECK(rocrand_set_lattice_generating_vector(g, vector, dimensions));
+        }
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        std::vector<unsigned int> host_data(size);
+        HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            // Shifted intervals of the first point
+            const unsigned int shift = host_data[d * points];
+            std::set<unsigned int> intervals;
+            for(size_t p = 0; p < points; p++)
+            {
+                intervals.insert((host_data[d * points + p] - shift) >> 22);
+            }
+            EXPECT_EQ(intervals.size(), points);
+        }
+    }
+
+    // Too few components for the dimensions
+    const unsigned int vector[2] = { 1, 3 };
+    ROCRAND_CHECK(rocrand_set_lattice_generating_vector(g, vector, 2));
+    EXPECT_EQ(rocrand_generate(g, data, size), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_set_lattice_generating_vector(g, NULL, 0));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_HALTON));
+    EXPECT_EQ(rocrand_set_lattice_generating_vector(g, vector, 2), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    HIP_CHECK(hipFree(data));
+}
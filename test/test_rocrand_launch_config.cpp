@@ -0,0 +1,117 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include <rng/launch_config.hpp>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+
+__global__
+void launch_config_test_kernel(unsigned int * data, const size_t n)
+{
+    const unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(index < n)
+    {
+        data[index] = index;
+    }
+}
+
+TEST(rocrand_launch_config_tests, device_info)
+{
+    rocrand_host::detail::device_info info;
+    ASSERT_TRUE(rocrand_host::detail::get_device_info(info));
+
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    EXPECT_EQ(info.device_id, device_id);
+    EXPECT_GT(info.cu_count, 0U);
+    EXPECT_GT(info.warp_size, 0U);
+}
+
+TEST(rocrand_launch_config_tests, blocks_multiple_and_limit)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_MTGP32,
+        ROCRAND_RNG_PSEUDO_MT19937
+    };
+    for(auto rng_type : rng_types)
+    {
+        SCOPED_TRACE(testing::Message() << "with rng_type = " << rng_type);
+
+        const unsigned int block_multiple = 16;
+        const unsigned int max_blocks = 512;
+        const rocrand_host::detail::launch_config config =
+            rocrand_host::detail::get_launch_config(
+                rng_type, launch_config_test_kernel,
+                { 256, 1024, 0, 0 },
+                block_multiple, max_blocks
+            );
+
+        EXPECT_GT(config.threads, 0U);
+        EXPECT_GT(config.blocks, 0U);
+        EXPECT_LE(config.blocks, max_blocks);
+        EXPECT_EQ(config.blocks % block_multiple, 0U);
+        EXPECT_GT(config.cu_count, 0U);
+
+        const unsigned int blocks =
+            rocrand_host::detail::get_launch_blocks(launch_config_test_kernel, config);
+        EXPECT_GT(blocks, 0U);
+        EXPECT_LE(blocks, config.blocks);
+    }
+}
+
+TEST(rocrand_launch_config_tests, launch)
+{
+    const rocrand_host::detail::launch_config config =
+        rocrand_host::detail::get_launch_config(
+            ROCRAND_RNG_PSEUDO_XORWOW, launch_config_test_kernel,
+            { 256, 512, 0, 0 }
+        );
+    const unsigned int blocks =
+        rocrand_host::detail::get_launch_blocks(launch_config_test_kernel, config);
+
+    const size_t size = blocks * config.threads;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(launch_config_test_kernel),
+        dim3(blocks), dim3(config.threads), 0, 0,
+        data, size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], i);
+    }
+    HIP_CHECK(hipFree(data));
+}
@@ -0,0 +1,121 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_managed_memory_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Hints do not change generated values: managed output of every combination
+// of hints is the same as output in device memory
+TEST_P(rocrand_managed_memory_tests, uniform_float_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 1234567;
+
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    int managed_memory = 0;
+    HIP_CHECK(hipDeviceGetAttribute(&managed_memory, hipDeviceAttributeManagedMemory, device_id));
+    if(managed_memory == 0)
+    {
+        return;
+    }
+
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    float * managed;
+    HIP_CHECK(hipMallocManaged((void **)&managed, size * sizeof(float)));
+
+    const unsigned int hints[] = {
+        0,
+        ROCRAND_MANAGED_HINT_PREFETCH,
+        ROCRAND_MANAGED_HINT_PREFETCH | ROCRAND_MANAGED_HINT_READ_MOSTLY,
+        ROCRAND_MANAGED_HINT_PREFETCH | ROCRAND_MANAGED_HINT_PREFETCH_TO_HOST,
+        ROCRAND_MANAGED_HINT_READ_MOSTLY | ROCRAND_MANAGED_HINT_PREFETCH_TO_HOST
+    };
+    for(unsigned int h : hints)
+    {
+        SCOPED_TRACE(testing::Message() << "with hints = " << h);
+
+        rocrand_generator expected_g;
+        ROCRAND_CHECK(rocrand_create_generator(&expected_g, rng_type));
+        ROCRAND_CHECK(rocrand_generate_uniform(expected_g, data, size));
+        ROCRAND_CHECK(rocrand_generate_uniform(expected_g, data, size));
+        HIP_CHECK(hipDeviceSynchronize());
+        std::vector<float> expected(size);
+        HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(expected_g));
+
+        rocrand_generator g;
+        ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+        ROCRAND_CHECK(rocrand_set_managed_memory_hints(g, h));
+        // The second call generates to memory which was touched by the host
+        ROCRAND_CHECK(rocrand_generate_uniform(g, managed, size));
+        HIP_CHECK(hipDeviceSynchronize());
+        managed[0] = 0.0f;
+        ROCRAND_CHECK(rocrand_generate_uniform(g, managed, size));
+        HIP_CHECK(hipDeviceSynchronize());
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(managed[i], expected[i]);
+        }
+    }
+
+    HIP_CHECK(hipFree(managed));
+    HIP_CHECK(hipFree(data));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_managed_memory_tests,
+                        rocrand_managed_memory_tests,
+                        ::testing::Values(ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                          ROCRAND_RNG_PSEUDO_XORWOW,
+                                          ROCRAND_RNG_PSEUDO_MTGP32,
+                                          ROCRAND_RNG_QUASI_SOBOL32));
+
+TEST(rocrand_managed_memory_hints_tests, set_hints_test)
+{
+    EXPECT_EQ(rocrand_set_managed_memory_hints(NULL, 0), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_set_managed_memory_hints(g, 0), ROCRAND_STATUS_SUCCESS);
+    EXPECT_EQ(rocrand_set_managed_memory_hints(g,
+                  ROCRAND_MANAGED_HINT_PREFETCH
+                  | ROCRAND_MANAGED_HINT_READ_MOSTLY
+                  | ROCRAND_MANAGED_HINT_PREFETCH_TO_HOST),
+              ROCRAND_STATUS_SUCCESS);
+    EXPECT_EQ(rocrand_set_managed_memory_hints(g, 8), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator_host(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_set_managed_memory_hints(g, ROCRAND_MANAGED_HINT_PREFETCH),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
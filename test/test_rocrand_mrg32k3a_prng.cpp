@@ -21,6 +21,9 @@
 #include <stdio.h>
 #include <gtest/gtest.h>
 
+#include <vector>
+#include <cmath>
+
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
@@ -187,6 +190,42 @@ TEST(rocrand_mrg32k3a_prng_tests, normal_float_test)
     HIP_CHECK(hipFree(data));
 }
 
+// Normal and log-normal doubles are generated in two pairs per iteration
+// of an engine: values must not depend on alignment of the output and
+// log-normal values must be exp() of normal values of the same numbers
+TEST(rocrand_mrg32k3a_prng_tests, normal_double_layout_test)
+{
+    const size_t sizes[] = { 1, 2, 3, 1313, 1234567 };
+    for(size_t size : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        double * data;
+        HIP_CHECK(hipMalloc(&data, sizeof(double) * (size + 1)));
+
+        std::vector<double> normal(size);
+        {
+            rocrand_mrg32k3a g;
+            ROCRAND_CHECK(g.generate_normal(data, size, 1.0, 2.0));
+            HIP_CHECK(hipMemcpy(normal.data(), data, sizeof(double) * size, hipMemcpyDeviceToHost));
+        }
+        std::vector<double> log_normal(size);
+        {
+            rocrand_mrg32k3a g;
+            // Unaligned output
+            ROCRAND_CHECK(g.generate_log_normal(data + 1, size, 1.0, 2.0));
+            HIP_CHECK(hipMemcpy(log_normal.data(), data + 1, sizeof(double) * size, hipMemcpyDeviceToHost));
+        }
+        HIP_CHECK(hipFree(data));
+
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_NEAR(std::log(log_normal[i]), normal[i], 1e-9 * std::abs(normal[i]) + 1e-12)
+                << "at " << i;
+        }
+    }
+}
+
 TEST(rocrand_mrg32k3a_prng_tests, poisson_test)
 {
     const size_t size = 1313;
@@ -432,3 +471,39 @@ TEST(rocrand_mrg32k3a_prng_tests, discard_subsequence_test)
 
     EXPECT_EQ(engine1(), engine2());
 }
+
+// Engines initialized in steps have the same states as engines seeded
+// and moved to their subsequences one by one
+TEST(rocrand_mrg32k3a_prng_tests, init_engines_by_steps_test)
+{
+    typedef rocrand_mrg32k3a::engine_type engine_type;
+    const unsigned long long seed = 1234567ULL;
+    const unsigned long long subsequence = 12345ULL;
+    const unsigned long long offset = 987654321ULL;
+    const size_t engines_size = 1000;
+
+    engine_type * engines;
+    HIP_CHECK(hipMalloc(&engines, sizeof(engine_type) * engines_size));
+    ROCRAND_CHECK(rocrand_host::detail::init_engines_by_steps(
+        engines, engines_size, seed, subsequence, offset, 0
+    ));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<engine_type> host_engines(engines_size);
+    HIP_CHECK(hipMemcpy(host_engines.data(), engines, sizeof(engine_type) * engines_size,
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(engines));
+
+    for(size_t i = 0; i < engines_size; i++)
+    {
+        // Engines may be stored as a structure of arrays (ENGINES_SOA)
+        engine_type engine = rocrand_host::detail::load_engine(
+            host_engines.data(), static_cast<unsigned int>(engines_size),
+            static_cast<unsigned int>(i)
+        );
+        engine_type expected(seed, subsequence + i, offset);
+        for(int j = 0; j < 4; j++)
+        {
+            ASSERT_EQ(engine(), expected()) << "engine " << i;
+        }
+    }
+}
@@ -0,0 +1,93 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+void generate_mt19937(const unsigned long long seed,
+                      const unsigned int engine_count,
+                      std::vector<unsigned int>& output)
+{
+    const size_t size = output.size();
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_MT19937));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    ROCRAND_CHECK(rocrand_set_engine_count(generator, engine_count));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+}
+
+// With one engine the generator produces the sequence of init_genrand(seed)
+TEST(rocrand_mt19937_tests, single_engine_reference)
+{
+    for(const unsigned long long seed : { 0ULL, 5489ULL, 12345678ULL })
+    {
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed);
+
+        std::vector<unsigned int> output(12345);
+        generate_mt19937(seed, 1, output);
+
+        std::mt19937 reference(static_cast<unsigned int>(seed));
+        for(size_t i = 0; i < output.size(); i++)
+        {
+            ASSERT_EQ(output[i], reference()) << i;
+        }
+    }
+}
+
+// Engine 0 starts the sequence of the seed, other engines start at jumps of
+// 2^1000 numbers, so their numbers are not in the beginning of the sequence
+TEST(rocrand_mt19937_tests, engines_jumped)
+{
+    const unsigned long long seed = 1234ULL;
+    std::vector<unsigned int> output(2 * 256 * 4);
+    generate_mt19937(seed, 2, output);
+
+    std::mt19937 reference(static_cast<unsigned int>(seed));
+    std::vector<unsigned int> expected(output.size());
+    for(auto& v : expected)
+    {
+        v = reference();
+    }
+    // The first number of the output is the first number of engine 0
+    EXPECT_EQ(output[0], expected[0]);
+    EXPECT_NE(output, expected);
+}
@@ -22,6 +22,8 @@
 #include <stdio.h>
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
@@ -281,3 +283,61 @@ TEST(rocrand_mtgp32_prng_tests, different_seed_test)
 
     HIP_CHECK(hipFree(data));
 }
+
+TEST(rocrand_mtgp32_prng_tests, device_init_test)
+{
+    typedef rocrand_mtgp32::engine_type engine_type;
+
+    const unsigned int engines_size = 100;
+    const unsigned long long seed = 0x123456789abcdefULL;
+
+    engine_type * engines;
+    engine_type * expected_engines;
+    rocrand_host::detail::mtgp32_fast_params * params;
+    HIP_CHECK(hipMalloc(&engines, sizeof(engine_type) * engines_size));
+    HIP_CHECK(hipMalloc(&expected_engines, sizeof(engine_type) * engines_size));
+    HIP_CHECK(hipMalloc(&params, sizeof(mtgp32dc_params_fast_11213)));
+    HIP_CHECK(hipMemcpy(params, mtgp32dc_params_fast_11213, sizeof(mtgp32dc_params_fast_11213), hipMemcpyHostToDevice));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+        dim3(2), dim3(64), 0, 0,
+        engines, engines_size,
+        static_cast<const rocrand_host::detail::mtgp32_fast_params *>(params),
+        seed
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    ROCRAND_CHECK(rocrand_make_state_mtgp32(expected_engines, mtgp32dc_params_fast_11213, engines_size, seed));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<engine_type> host_engines(engines_size);
+    std::vector<engine_type> host_expected_engines(engines_size);
+    HIP_CHECK(hipMemcpy(host_engines.data(), engines, sizeof(engine_type) * engines_size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_expected_engines.data(), expected_engines, sizeof(engine_type) * engines_size, hipMemcpyDeviceToHost));
+
+    for(unsigned int i = 0; i < engines_size; i++)
+    {
+        const engine_type& e = host_engines[i];
+        const engine_type& x = host_expected_engines[i];
+        ASSERT_EQ(e.m_state.offset, x.m_state.offset);
+        ASSERT_EQ(e.m_state.id, x.m_state.id);
+        for(int j = 0; j < MTGP_N; j++)
+        {
+            ASSERT_EQ(e.m_state.status[j], x.m_state.status[j]);
+        }
+        ASSERT_EQ(e.pos_tbl, x.pos_tbl);
+        ASSERT_EQ(e.sh1_tbl, x.sh1_tbl);
+        ASSERT_EQ(e.sh2_tbl, x.sh2_tbl);
+        ASSERT_EQ(e.mask, x.mask);
+        for(int j = 0; j < MTGP_TS; j++)
+        {
+            ASSERT_EQ(e.param_tbl[j], x.param_tbl[j]);
+            ASSERT_EQ(e.temper_tbl[j], x.temper_tbl[j]);
+            ASSERT_EQ(e.single_temper_tbl[j], x.single_temper_tbl[j]);
+        }
+    }
+
+    HIP_CHECK(hipFree(engines));
+    HIP_CHECK(hipFree(expected_engines));
+    HIP_CHECK(hipFree(params));
+}
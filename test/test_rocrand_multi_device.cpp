@@ -0,0 +1,168 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_multi_device_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Parts generated on all devices (a device can be used several times)
+// must be consecutive ranges of the sequence of one generator
+TEST_P(rocrand_multi_device_tests, split_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    int device_count;
+    HIP_CHECK(hipGetDeviceCount(&device_count));
+    std::vector<int> devices;
+    for(int i = 0; i < device_count; i++)
+    {
+        devices.push_back(i);
+    }
+    devices.push_back(0);
+
+    std::vector<size_t> sizes;
+    size_t total = 0;
+    for(size_t i = 0; i < devices.size(); i++)
+    {
+        sizes.push_back(10007 + i * 3001);
+        total += sizes.back();
+    }
+
+    // One generator on one device
+    std::vector<unsigned int> expected(2 * total);
+    {
+        unsigned int * data;
+        HIP_CHECK(hipMalloc((void **)&data, total * sizeof(unsigned int)));
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            // The multi-device generator uses counter-based Philox4x32-10
+            ROCRAND_CHECK(rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_BEST));
+        }
+        ROCRAND_CHECK(rocrand_set_seed(generator, 1234));
+        ROCRAND_CHECK(rocrand_set_offset(generator, 56));
+        ROCRAND_CHECK(rocrand_generate(generator, data, total));
+        HIP_CHECK(hipMemcpy(expected.data(), data, total * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_generate_range(generator, data, total, total));
+        HIP_CHECK(hipMemcpy(expected.data() + total, data, total * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipFree(data));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    rocrand_multi_device_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_multi_device_generator(
+            &generator, rng_type, devices.data(), devices.size()
+        )
+    );
+    ROCRAND_CHECK(rocrand_set_multi_device_seed(generator, 1234));
+    ROCRAND_CHECK(rocrand_set_multi_device_offset(generator, 56));
+
+    std::vector<unsigned int *> output_data(devices.size());
+    for(size_t i = 0; i < devices.size(); i++)
+    {
+        HIP_CHECK(hipSetDevice(devices[i]));
+        HIP_CHECK(hipMalloc((void **)&output_data[i], sizes[i] * sizeof(unsigned int)));
+    }
+    HIP_CHECK(hipSetDevice(0));
+
+    // Two calls continue the sequence
+    for(size_t call = 0; call < 2; call++)
+    {
+        ROCRAND_CHECK(rocrand_generate_multi_device(generator, output_data.data(), sizes.data()));
+
+        size_t start = call * total;
+        for(size_t i = 0; i < devices.size(); i++)
+        {
+            std::vector<unsigned int> output(sizes[i]);
+            HIP_CHECK(hipSetDevice(devices[i]));
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), output_data[i],
+                    sizes[i] * sizeof(unsigned int),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            for(size_t j = 0; j < sizes[i]; j++)
+            {
+                ASSERT_EQ(output[j], expected[start + j]);
+            }
+            start += sizes[i];
+        }
+        HIP_CHECK(hipSetDevice(0));
+    }
+
+    for(size_t i = 0; i < devices.size(); i++)
+    {
+        HIP_CHECK(hipSetDevice(devices[i]));
+        HIP_CHECK(hipFree(output_data[i]));
+    }
+    HIP_CHECK(hipSetDevice(0));
+    ROCRAND_CHECK(rocrand_destroy_multi_device_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_multi_device_tests,
+                        rocrand_multi_device_tests,
+                        ::testing::Values(ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                          ROCRAND_RNG_PSEUDO_XORWOW,
+                                          ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                          ROCRAND_RNG_QUASI_SOBOL32,
+                                          ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32));
+
+TEST(rocrand_multi_device_tests, neg_test)
+{
+    const int devices[] = { 0 };
+    rocrand_multi_device_generator generator = NULL;
+
+    EXPECT_EQ(
+        rocrand_generate_multi_device(generator, NULL, NULL),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_create_multi_device_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW, devices, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_create_multi_device_generator(&generator, ROCRAND_RNG_PSEUDO_MTGP32, devices, 1),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    EXPECT_EQ(
+        rocrand_create_multi_device_generator(&generator, ROCRAND_RNG_PSEUDO_MT19937, devices, 1),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    int device_count;
+    HIP_CHECK(hipGetDeviceCount(&device_count));
+    const int invalid_devices[] = { 0, device_count };
+    EXPECT_EQ(
+        rocrand_create_multi_device_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW, invalid_devices, 2),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+}
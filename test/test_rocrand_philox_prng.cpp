@@ -19,6 +19,7 @@
 // THE SOFTWARE.
 
 #include <stdio.h>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include <hip/hip_runtime.h>
@@ -209,6 +210,48 @@ TEST(rocrand_philox_prng_tests, different_seed_test)
     HIP_CHECK(hipFree(data));
 }
 
+// Checks if generated numbers are the numbers of subsequence 0 of
+// the device engine (counter-based generation, the default ordering
+// uses engines) and if consecutive calls continue the sequence
+TEST(rocrand_philox_prng_tests, counter_based_test)
+{
+    const unsigned long long seed = 0xdeadbeefdeadbeefULL;
+    const unsigned long long offsets[] = { 0, 1, 2, 3, 1234567 };
+
+    // Device side data
+    const size_t size0 = 1024;
+    const size_t size1 = 1313;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * (size0 + size1)));
+
+    for(auto offset : offsets)
+    {
+        SCOPED_TRACE(testing::Message() << "with offset = " << offset);
+
+        rocrand_philox4x32_10 g(seed, offset);
+        ROCRAND_CHECK(g.set_order(ROCRAND_ORDERING_PSEUDO_BEST));
+        ROCRAND_CHECK(g.generate(data, size0));
+        ROCRAND_CHECK(g.generate(data + size0, size1));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned int> host_data(size0 + size1);
+        HIP_CHECK(
+            hipMemcpy(
+                host_data.data(), data,
+                sizeof(unsigned int) * (size0 + size1),
+                hipMemcpyDeviceToHost
+            )
+        );
+
+        rocrand_philox4x32_10::engine_type engine(seed, 0, offset);
+        for(size_t i = 0; i < size0 + size1; i++)
+        {
+            ASSERT_EQ(host_data[i], engine());
+        }
+    }
+    HIP_CHECK(hipFree(data));
+}
+
 ///
 /// rocrand_philox_prng_state_tests TEST GROUP
 ///
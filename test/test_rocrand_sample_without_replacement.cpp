@@ -0,0 +1,203 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_sample_without_replacement_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Samples of k indices of n (weighted with weights if not empty)
+void sample(rocrand_generator generator,
+            const size_t k,
+            const size_t n,
+            const std::vector<float>& weights,
+            std::vector<unsigned int>& output)
+{
+    unsigned int * data;
+    float * d_weights = NULL;
+    HIP_CHECK(hipMalloc((void **)&data, k * sizeof(unsigned int)));
+    if(!weights.empty())
+    {
+        HIP_CHECK(hipMalloc((void **)&d_weights, n * sizeof(float)));
+        HIP_CHECK(hipMemcpy(d_weights, weights.data(), n * sizeof(float), hipMemcpyHostToDevice));
+    }
+
+    ROCRAND_CHECK(rocrand_sample_without_replacement(generator, data, k, n, d_weights));
+
+    output.resize(k);
+    HIP_CHECK(hipMemcpy(output.data(), data, k * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(d_weights));
+}
+
+// Indices are distinct, increasing and less than n
+TEST_P(rocrand_sample_without_replacement_tests, indices_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t sizes[][2] = {
+        { 1, 1 }, { 10, 20 }, { 2048, 2048 }, { 2048, 1000000 },
+        { 2049, 3000 }, { 50000, 1000000 }, { 123457, 123457 }
+    };
+    for(const bool weighted : { false, true })
+    {
+        for(const auto& size : sizes)
+        {
+            const size_t k = size[0];
+            const size_t n = size[1];
+            SCOPED_TRACE(testing::Message() << "with k = " << k << ", n = " << n
+                                            << ", weighted = " << weighted);
+            std::vector<float> weights;
+            if(weighted)
+            {
+                for(size_t i = 0; i < n; i++)
+                {
+                    weights.push_back(1.0f + (i % 10));
+                }
+            }
+            std::vector<unsigned int> output;
+            sample(generator, k, n, weights, output);
+            for(size_t i = 0; i < k; i++)
+            {
+                ASSERT_LT(output[i], n);
+                if(i > 0)
+                {
+                    ASSERT_LT(output[i - 1], output[i]);
+                }
+            }
+        }
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Every index is selected with probability k / n (Floyd's algorithm and
+// radix selection of uniform keys)
+TEST_P(rocrand_sample_without_replacement_tests, uniform_frequency_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t n = 4000;
+    const size_t trials = 50;
+    for(const size_t k : { 1000, 3000 })
+    {
+        SCOPED_TRACE(testing::Message() << "with k = " << k);
+        std::vector<double> counts(n, 0.0);
+        std::vector<unsigned int> output;
+        for(size_t t = 0; t < trials; t++)
+        {
+            sample(generator, k, n, std::vector<float>(), output);
+            for(const unsigned int i : output)
+            {
+                counts[i] += 1.0;
+            }
+        }
+        // Counts of halves and of even and odd indices
+        double first_half = 0.0;
+        double even = 0.0;
+        for(size_t i = 0; i < n; i++)
+        {
+            first_half += i < n / 2 ? counts[i] : 0.0;
+            even += i % 2 == 0 ? counts[i] : 0.0;
+        }
+        const double expected = trials * k / 2.0;
+        EXPECT_NEAR(first_half, expected, expected * 0.02);
+        EXPECT_NEAR(even, expected, expected * 0.02);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Single indices are selected with probabilities proportional to weights,
+// indices with zero weights are not selected
+TEST_P(rocrand_sample_without_replacement_tests, weighted_frequency_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const std::vector<float> weights = { 1.0f, 0.0f, 2.0f, 3.0f, 4.0f, 0.0f };
+    const size_t trials = 2000;
+    std::vector<double> counts(weights.size(), 0.0);
+    std::vector<unsigned int> output;
+    for(size_t t = 0; t < trials; t++)
+    {
+        sample(generator, 1, weights.size(), weights, output);
+        counts[output[0]] += 1.0;
+    }
+    for(size_t i = 0; i < weights.size(); i++)
+    {
+        EXPECT_NEAR(counts[i] / trials, weights[i] / 10.0, 0.05);
+    }
+
+    // Zero weights are selected after all positive weights
+    sample(generator, 5, weights.size(), weights, output);
+    EXPECT_EQ(output, std::vector<unsigned int>({ 0, 1, 2, 3, 4 }));
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_sample_without_replacement_tests,
+                        rocrand_sample_without_replacement_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_MTGP32
+                        ));
+
+TEST(rocrand_sample_without_replacement_tests, neg_test)
+{
+    unsigned int * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_sample_without_replacement(generator, data, 1, 10, NULL),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_sample_without_replacement(generator, data, 11, 10, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_sample_without_replacement(generator, data, 0, 10, NULL),
+        ROCRAND_STATUS_SUCCESS
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_sample_without_replacement(generator, data, 1, 10, NULL),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
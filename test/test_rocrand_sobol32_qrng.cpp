@@ -21,6 +21,8 @@
 #include <stdio.h>
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 #include <rocrand_sobol_precomputed.h>
@@ -172,6 +174,118 @@ TEST(rocrand_sobol32_qrng_tests, dimesions_test)
     HIP_CHECK(hipFree(data));
 }
 
+// Point-major results must be the transposed dimension-major results
+TEST(rocrand_sobol32_qrng_tests, point_major_test)
+{
+    const unsigned int dimensions = 7;
+    const size_t points = 1031;
+    const size_t size = points * dimensions;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_sobol32 g0;
+    rocrand_sobol32 g1;
+    g0.set_dimensions(dimensions);
+    g1.set_dimensions(dimensions);
+    ROCRAND_CHECK(g1.set_order(ROCRAND_ORDERING_QUASI_POINT_MAJOR));
+
+    std::vector<unsigned int> host_data0(size);
+    std::vector<unsigned int> host_data1(size);
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipMemcpy(host_data0.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipMemcpy(host_data1.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t p = 0; p < points; p++)
+    {
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            ASSERT_EQ(host_data0[d * points + p], host_data1[p * dimensions + d]);
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Many dimensions with few points (generated by tiles of points and
+// dimensions) in both orderings
+TEST(rocrand_sobol32_qrng_tests, many_dimensions_test)
+{
+    const unsigned int dimensions = 1000;
+    const size_t points = 37;
+    const size_t size = points * dimensions;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    for(rocrand_ordering order : { ROCRAND_ORDERING_QUASI_DEFAULT, ROCRAND_ORDERING_QUASI_POINT_MAJOR })
+    {
+        rocrand_sobol32 g;
+        g.set_dimensions(dimensions);
+        ROCRAND_CHECK(g.set_order(order));
+        g.set_offset(11);
+
+        std::vector<unsigned int> host_data(size);
+        ROCRAND_CHECK(g.generate(data, size));
+        HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        const bool point_major = order == ROCRAND_ORDERING_QUASI_POINT_MAJOR;
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            rocrand_sobol32::engine_type engine(&h_sobol32_direction_vectors[d * 32], 11);
+            for(size_t p = 0; p < points; p++)
+            {
+                const size_t index = point_major ? p * dimensions + d : d * points + p;
+                ASSERT_EQ(host_data[index], engine());
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Direction vectors are shared by generators and copied to the device
+// when dimensions are used for the first time
+TEST(rocrand_sobol32_qrng_tests, shared_direction_vectors_test)
+{
+    const size_t points = 2049;
+    const unsigned int dimensions[] = { 1, 5, 3, 17 };
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * points * 17));
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    rocrand_sobol32 g0;
+    for(unsigned int d : dimensions)
+    {
+        // New generators use the same table, on another stream too
+        rocrand_sobol32 g1(0, d % 2 == 0 ? 0 : stream);
+        rocrand_sobol32& g = d == 3 ? g0 : g1;
+        g.set_dimensions(d);
+
+        const size_t size = points * d;
+        ROCRAND_CHECK(g.generate(data, size));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned int> host_data(size);
+        HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+
+        for(unsigned int i = 0; i < d; i++)
+        {
+            rocrand_sobol32::engine_type engine(&h_sobol32_direction_vectors[i * 32], 0);
+            for(size_t p = 0; p < points; p++)
+            {
+                ASSERT_EQ(host_data[i * points + p], engine());
+            }
+        }
+    }
+
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(data));
+}
+
 // Check if the numbers generated by first generate() call are different from
 // the numbers generated by the 2nd call (same generator)
 TEST(rocrand_sobol32_qrng_tests, state_progress_test)
@@ -264,3 +378,146 @@ TEST(rocrand_sobol32_qrng_tests, discard_stride_test)
         EXPECT_EQ(engine1(), engine2());
     }
 }
+
+// Shards of points (set by offsets) and of dimensions (set by the first
+// dimension) are parts of the output of one generator
+TEST(rocrand_sobol32_qrng_tests, shards_test)
+{
+    const unsigned int dimensions = 8;
+    const size_t points = 4 * 1031;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * points * dimensions));
+
+    rocrand_sobol32 g0(123);
+    g0.set_dimensions(dimensions);
+    std::vector<unsigned int> expected(points * dimensions);
+    ROCRAND_CHECK(g0.generate(data, points * dimensions));
+    HIP_CHECK(hipMemcpy(expected.data(), data, sizeof(unsigned int) * points * dimensions,
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    const unsigned int shard_first_dimension = 2;
+    const unsigned int shard_dimensions = 5;
+    const size_t shard_points = points / 4;
+    for(size_t k = 0; k < 4; k++)
+    {
+        rocrand_sobol32 g1;
+        g1.set_offset(123 + k * shard_points);
+        g1.set_first_dimension(shard_first_dimension);
+        g1.set_dimensions(shard_dimensions);
+
+        std::vector<unsigned int> output(shard_points * shard_dimensions);
+        ROCRAND_CHECK(g1.generate(data, output.size()));
+        HIP_CHECK(hipMemcpy(output.data(), data, sizeof(unsigned int) * output.size(),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        for(unsigned int d = 0; d < shard_dimensions; d++)
+        {
+            for(size_t p = 0; p < shard_points; p++)
+            {
+                ASSERT_EQ(output[d * shard_points + p],
+                          expected[(shard_first_dimension + d) * points + k * shard_points + p]);
+            }
+        }
+    }
+
+    rocrand_sobol32 g2;
+    g2.set_first_dimension(19999);
+    g2.set_dimensions(2);
+    EXPECT_EQ(g2.generate(data, 2), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    HIP_CHECK(hipFree(data));
+}
+
+// The sequence has 2^32 points, offsets are not truncated and wrap around
+TEST(rocrand_sobol32_qrng_tests, offset_64bit_test)
+{
+    const size_t size = 1025;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_sobol32 g0((1ULL << 32) + 1000);
+    rocrand_sobol32 g1(1000);
+    std::vector<unsigned int> output0(size);
+    std::vector<unsigned int> output1(size);
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipMemcpy(output0.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipMemcpy(output1.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    EXPECT_EQ(output0, output1);
+
+    // The last points of the sequence are followed by the first ones
+    rocrand_sobol32 g2((1ULL << 32) - 10);
+    ROCRAND_CHECK(g2.generate(data, size));
+    HIP_CHECK(hipMemcpy(output0.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    rocrand_sobol32::engine_type engine(&h_sobol32_direction_vectors[0], 0xfffffff6U);
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(output0[i], engine());
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Points of a rank of a partition start at rank * 2^32 / nranks,
+// the offset is added within the part of the rank
+TEST(rocrand_sobol32_qrng_tests, subsequence_partition_test)
+{
+    const size_t size = 1025;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_sobol32 g0(100);
+    g0.set_subsequence_partition(3, 4);
+    rocrand_sobol32 g1((3ULL << 30) + 100);
+    std::vector<unsigned int> output0(size);
+    std::vector<unsigned int> output1(size);
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipMemcpy(output0.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipMemcpy(output1.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    EXPECT_EQ(output0, output1);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_sobol32_qrng_tests, first_dimension_api_test)
+{
+    EXPECT_EQ(
+        rocrand_set_quasi_random_generator_first_dimension(NULL, 1),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    // 20000 dimensions, or more if tables are loaded from ROCRAND_SOBOL_TABLES
+    const rocrand_precomputed_tables * tables;
+    ROCRAND_CHECK(rocrand_get_host_tables(&tables));
+    ASSERT_GE(tables->sobol_dimensions, 20000U);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_first_dimension(generator, 10));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_first_dimension(
+        generator, tables->sobol_dimensions - 1));
+    EXPECT_EQ(
+        rocrand_set_quasi_random_generator_first_dimension(generator, tables->sobol_dimensions),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(
+        generator, tables->sobol_dimensions));
+    EXPECT_EQ(
+        rocrand_set_quasi_random_generator_dimensions(generator, tables->sobol_dimensions + 1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_set_quasi_random_generator_first_dimension(generator, 1),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
@@ -0,0 +1,255 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <hip/hip_fp16.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_stochastic_round_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Every value is repeated many times to estimate the mean of roundings
+constexpr size_t repeats = 4000;
+const std::vector<float> values = {
+    0.0f, 1.0f, -1.0f, 1.3f, -2.71828f, 1000.123f, 3.0e-6f, -1.0e-7f, 12345.67f, 0.1f
+};
+
+std::vector<float> repeated_values()
+{
+    std::vector<float> input;
+    for(const float x : values)
+    {
+        input.insert(input.end(), repeats, x);
+    }
+    return input;
+}
+
+// Distance of representable values around x with 'digits' significant
+// binary digits and the least exponent 'min_exponent'
+double spacing(const float x, const int digits, const int min_exponent)
+{
+    int exponent;
+    std::frexp(std::fabs(x), &exponent);
+    return std::ldexp(1.0, std::max(exponent - digits, min_exponent));
+}
+
+// Results are one of two neighbours of the input and their mean is the input
+void check_roundings(const std::vector<float>& output,
+                     const int digits, const int min_exponent)
+{
+    for(size_t v = 0; v < values.size(); v++)
+    {
+        const double x = values[v];
+        const double s = spacing(values[v], digits, min_exponent);
+        SCOPED_TRACE(testing::Message() << "with x = " << x);
+        double sum = 0.0;
+        for(size_t i = 0; i < repeats; i++)
+        {
+            const double y = output[v * repeats + i];
+            ASSERT_LT(std::fabs(y - x), s);
+            sum += y;
+        }
+        EXPECT_NEAR(sum / repeats, x, s * 0.05);
+    }
+}
+
+template<class T>
+void convert(const std::vector<float>& input, std::vector<T>& output,
+             rocrand_status (*function)(rocrand_generator, const float *, T *, size_t),
+             rocrand_generator generator)
+{
+    const size_t n = input.size();
+    float * d_input;
+    T * d_output;
+    HIP_CHECK(hipMalloc((void **)&d_input, n * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&d_output, n * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), n * sizeof(float), hipMemcpyHostToDevice));
+
+    ROCRAND_CHECK(function(generator, d_input, d_output, n));
+
+    output.resize(n);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, n * sizeof(T), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+__global__
+void half_to_float_kernel(const __half * input, float * output, const size_t n)
+{
+    const size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(index < n)
+    {
+        output[index] = __half2float(input[index]);
+    }
+}
+
+TEST_P(rocrand_stochastic_round_tests, half_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const std::vector<float> input = repeated_values();
+    const size_t n = input.size();
+    float * d_input;
+    __half * d_half;
+    float * d_output;
+    HIP_CHECK(hipMalloc((void **)&d_input, n * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&d_half, n * sizeof(__half)));
+    HIP_CHECK(hipMalloc((void **)&d_output, n * sizeof(float)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), n * sizeof(float), hipMemcpyHostToDevice));
+
+    ROCRAND_CHECK(rocrand_stochastic_round_half(generator, d_input, d_half, n));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(half_to_float_kernel),
+        dim3((n + 255) / 256), dim3(256), 0, 0,
+        d_half, d_output, n
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output(n);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, n * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_half));
+    HIP_CHECK(hipFree(d_output));
+
+    check_roundings(output, 11, -24);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_stochastic_round_tests, bfloat16_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    std::vector<float> input = repeated_values();
+    std::vector<unsigned short> bits;
+    convert(input, bits, rocrand_stochastic_round_bfloat16, generator);
+    std::vector<float> output(bits.size());
+    for(size_t i = 0; i < bits.size(); i++)
+    {
+        const unsigned int u = static_cast<unsigned int>(bits[i]) << 16;
+        std::memcpy(&output[i], &u, sizeof(float));
+    }
+    check_roundings(output, 8, -133);
+
+    // Infinities are kept, NaN is NaN
+    input = { INFINITY, -INFINITY, NAN };
+    convert(input, bits, rocrand_stochastic_round_bfloat16, generator);
+    EXPECT_EQ(bits[0], 0x7F80);
+    EXPECT_EQ(bits[1], 0xFF80);
+    EXPECT_EQ(bits[2] & 0x7F80, 0x7F80);
+    EXPECT_NE(bits[2] & 0x007F, 0);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+rocrand_status stochastic_round_int8_scale_half(rocrand_generator generator,
+                                                const float * input,
+                                                signed char * output,
+                                                size_t n)
+{
+    return rocrand_stochastic_round_int8(generator, input, output, n, 0.5f);
+}
+
+TEST_P(rocrand_stochastic_round_tests, int8_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const std::vector<float> input = {
+        0.0f, 0.3f, -0.3f, 10.75f, -20.1f, 63.4f, 1000.0f, -1000.0f, NAN
+    };
+    const std::vector<float> expected_means = {
+        0.0f, 0.6f, -0.6f, 21.5f, -40.2f, 126.8f, 127.0f, -128.0f, 0.0f
+    };
+    std::vector<float> repeated;
+    for(const float x : input)
+    {
+        repeated.insert(repeated.end(), repeats, x);
+    }
+    std::vector<signed char> output;
+    convert(repeated, output, stochastic_round_int8_scale_half, generator);
+    for(size_t v = 0; v < input.size(); v++)
+    {
+        SCOPED_TRACE(testing::Message() << "with x = " << input[v]);
+        const float y = expected_means[v];
+        double sum = 0.0;
+        for(size_t i = 0; i < repeats; i++)
+        {
+            const signed char r = output[v * repeats + i];
+            ASSERT_TRUE(r == std::floor(y) || r == std::ceil(y));
+            sum += r;
+        }
+        EXPECT_NEAR(sum / repeats, y, 0.05);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_stochastic_round_tests,
+                        rocrand_stochastic_round_tests,
+                        ::testing::Values(
+                            ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                            ROCRAND_RNG_PSEUDO_XORWOW,
+                            ROCRAND_RNG_PSEUDO_MTGP32
+                        ));
+
+TEST(rocrand_stochastic_round_tests, neg_test)
+{
+    const float * input = NULL;
+    signed char * output = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_stochastic_round_int8(generator, input, output, 10, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_stochastic_round_int8(generator, input, output, 10, 0.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_stochastic_round_int8(generator, input, output, 0, 1.0f),
+        ROCRAND_STATUS_SUCCESS
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_stochastic_round_int8(generator, input, output, 10, 1.0f),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
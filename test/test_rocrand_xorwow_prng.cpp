@@ -21,6 +21,8 @@
 #include <stdio.h>
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
@@ -243,6 +245,41 @@ TEST(rocrand_xorwow_prng_tests, different_seed_test)
     HIP_CHECK(hipFree(data));
 }
 
+// Engines seeded independently must produce different numbers
+// than engines of the same seed at different subsequences
+TEST(rocrand_xorwow_prng_tests, seeded_order_test)
+{
+    const size_t size = 1024 * 1024;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * size));
+
+    rocrand_xorwow g0, g1;
+    ROCRAND_CHECK(g1.set_order(ROCRAND_ORDERING_PSEUDO_SEEDED));
+
+    std::vector<float> host_data0(size);
+    std::vector<float> host_data1(size);
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipMemcpy(host_data0.data(), data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipMemcpy(host_data1.data(), data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data0[i] == host_data1[i]) same++;
+        ASSERT_GT(host_data1[i], 0.0f);
+        ASSERT_LE(host_data1[i], 1.0f);
+        mean += host_data1[i];
+    }
+    mean /= size;
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+    EXPECT_NEAR(mean, 0.5, 0.05);
+
+    HIP_CHECK(hipFree(data));
+}
+
 TEST(rocrand_xorwow_prng_tests, discard_test)
 {
     const unsigned long long seed = 1234567890123ULL;
@@ -297,3 +334,39 @@ TEST(rocrand_xorwow_prng_tests, discard_sequence_test)
 
     EXPECT_EQ(engine1(), engine2());
 }
+
+// Engines initialized in steps have the same states as engines seeded
+// and moved to their subsequences one by one
+TEST(rocrand_xorwow_prng_tests, init_engines_by_steps_test)
+{
+    typedef rocrand_xorwow::engine_type engine_type;
+    const unsigned long long seed = 1234567ULL;
+    const unsigned long long subsequence = 12345ULL;
+    const unsigned long long offset = 987654321ULL;
+    const size_t engines_size = 1000;
+
+    engine_type * engines;
+    HIP_CHECK(hipMalloc(&engines, sizeof(engine_type) * engines_size));
+    ROCRAND_CHECK(rocrand_host::detail::init_engines_by_steps(
+        engines, engines_size, seed, subsequence, offset, 0
+    ));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<engine_type> host_engines(engines_size);
+    HIP_CHECK(hipMemcpy(host_engines.data(), engines, sizeof(engine_type) * engines_size,
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(engines));
+
+    for(size_t i = 0; i < engines_size; i++)
+    {
+        // Engines may be stored as a structure of arrays (ENGINES_SOA)
+        engine_type engine = rocrand_host::detail::load_engine(
+            host_engines.data(), static_cast<unsigned int>(engines_size),
+            static_cast<unsigned int>(i)
+        );
+        engine_type expected(seed, subsequence + i, offset);
+        for(int j = 0; j < 4; j++)
+        {
+            ASSERT_EQ(engine(), expected()) << "engine " << i;
+        }
+    }
+}
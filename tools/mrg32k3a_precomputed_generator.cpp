@@ -3,6 +3,9 @@
 #include <string>
 #include <iomanip>
 #include <cstring>
+#include <cstdlib>
+#include <thread>
+#include <vector>
 
 using namespace std;
 
@@ -80,18 +83,47 @@ void mod_mat_sq(unsigned long long * A,
 }
 
 
-void init_matrices(unsigned long long * matrix, unsigned long long * A, int n, unsigned long long m)
+void mod_mat_mul(unsigned long long * A,
+                 const unsigned long long * B,
+                 unsigned long long m)
 {
     unsigned long long x[9];
+    unsigned long long a;
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            a = 0;
+            for (size_t k = 0; k < 3; k++) {
+                a += (A[i + 3 * k] * B[k + 3 * j]) % m;
+            }
+            x[i + 3 * j] = a % m;
+        }
+    }
+    for (size_t i = 0; i < 9; i++)
+        A[i] = x[i];
+}
+
+// Writes A^(k * 2^(jump_log2 * i)) for all digits i and k = 1...2^jump_log2 - 1
+void init_matrices(unsigned long long * matrix, unsigned long long * A, int n, int jump_log2, unsigned long long m)
+{
+    const int multiples = (1 << jump_log2) - 1;
+    unsigned long long x[9];
+    unsigned long long y[9];
     for (int i = 0; i < 9; i++)
         x[i] = A[i];
 
-    for (int i = 0 ; i < n ; i++) {
+    for (int i = 0 ; i < n / multiples ; i++) {
         if (i > 0) {
-            mod_mat_sq(x, m);
+            for (int s = 0; s < jump_log2; s++)
+                mod_mat_sq(x, m);
         }
         for (int j = 0; j < 9; j++)
-            matrix[j + (i * 9)] = x[j];
+            y[j] = x[j];
+        for (int k = 0; k < multiples; k++) {
+            if (k > 0)
+                mod_mat_mul(y, x, m);
+            for (int j = 0; j < 9; j++)
+                matrix[j + ((i * multiples + k) * 9)] = y[j];
+        }
     }
 }
 
@@ -114,14 +146,29 @@ void write_matrices(std::ofstream& fout, const std::string name, unsigned long l
 
 int main(int argc, char const *argv[])
 {
-    if (argc != 2 || std::string(argv[1]) == "--help")
+    if (argc < 2 || argc > 3 || std::string(argv[1]) == "--help")
     {
         std::cout << "Usage:" << std::endl;
-        std::cout << "  ./mrg32k3a_precomputed_generator ../../library/include/rocrand_mrg32k3a_precomputed.h" << std::endl;
+        std::cout << "  ./mrg32k3a_precomputed_generator ../../library/include/rocrand_mrg32k3a_precomputed.h [jump_log2]" << std::endl;
+        std::cout << std::endl;
+        std::cout << "jump_log2 (1...8, default 1) is log2 of the base of jumps: 2^jump_log2 - 1" << std::endl;
+        std::cout << "multiples are generated per digit, skipping ahead takes one product per digit." << std::endl;
         return -1;
     }
 
-    unsigned int MRG323A_DIM = 64;
+    int MRG323A_JUMP_LOG2 = 1;
+    if (argc == 3)
+    {
+        MRG323A_JUMP_LOG2 = std::atoi(argv[2]);
+        if (MRG323A_JUMP_LOG2 < 1 || MRG323A_JUMP_LOG2 > 8)
+        {
+            std::cout << "jump_log2 must be in range [1, 8]" << std::endl;
+            return -1;
+        }
+    }
+
+    unsigned int MRG323A_DIM = (64 + MRG323A_JUMP_LOG2 - 1) / MRG323A_JUMP_LOG2
+        * ((1 << MRG323A_JUMP_LOG2) - 1);
     unsigned int MRG323A_N = MRG323A_DIM * 9;
     unsigned long long * A1 = new unsigned long long[MRG323A_N];
     unsigned long long * A2 = new unsigned long long[MRG323A_N];
@@ -130,12 +177,18 @@ int main(int argc, char const *argv[])
     unsigned long long * A1P127 = new unsigned long long[MRG323A_N];
     unsigned long long * A2P127 = new unsigned long long[MRG323A_N];
 
-    init_matrices(A1, A1_, MRG323A_DIM, ROCRAND_MRG32K3A_M1);
-    init_matrices(A2, A2_, MRG323A_DIM, ROCRAND_MRG32K3A_M2);
-    init_matrices(A1P67, A1p67, MRG323A_DIM, ROCRAND_MRG32K3A_M1);
-    init_matrices(A2P67, A2p67, MRG323A_DIM, ROCRAND_MRG32K3A_M2);
-    init_matrices(A1P127, A1p127, MRG323A_DIM, ROCRAND_MRG32K3A_M1);
-    init_matrices(A2P127, A2p127, MRG323A_DIM, ROCRAND_MRG32K3A_M2);
+    // Tables are independent, each one is computed by its own thread
+    std::vector<std::thread> threads;
+    threads.emplace_back(init_matrices, A1, A1_, MRG323A_DIM, MRG323A_JUMP_LOG2, ROCRAND_MRG32K3A_M1);
+    threads.emplace_back(init_matrices, A2, A2_, MRG323A_DIM, MRG323A_JUMP_LOG2, ROCRAND_MRG32K3A_M2);
+    threads.emplace_back(init_matrices, A1P67, A1p67, MRG323A_DIM, MRG323A_JUMP_LOG2, ROCRAND_MRG32K3A_M1);
+    threads.emplace_back(init_matrices, A2P67, A2p67, MRG323A_DIM, MRG323A_JUMP_LOG2, ROCRAND_MRG32K3A_M2);
+    threads.emplace_back(init_matrices, A1P127, A1p127, MRG323A_DIM, MRG323A_JUMP_LOG2, ROCRAND_MRG32K3A_M1);
+    threads.emplace_back(init_matrices, A2P127, A2p127, MRG323A_DIM, MRG323A_JUMP_LOG2, ROCRAND_MRG32K3A_M2);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
     const std::string file_path(argv[1]);
     std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
     fout << R"(// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
@@ -168,6 +221,7 @@ int main(int argc, char const *argv[])
 
     fout << "#define MRG323A_DIM " << MRG323A_DIM << std::endl;
     fout << "#define MRG323A_N " << MRG323A_N << std::endl;
+    fout << "#define MRG323A_JUMP_LOG2 " << MRG323A_JUMP_LOG2 << std::endl;
     fout << std::endl;
 
     write_matrices(fout, "d_A1", A1, MRG323A_N, 9, true);
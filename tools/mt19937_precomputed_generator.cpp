@@ -0,0 +1,242 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+const int MT19937_N = 624; // 624 values
+const int MT19937_M = 397;
+const int MT19937_W = 32;  // 32-bit each
+
+// Dimension of the state space (the lower 31 bits of the first value
+// are not used)
+const int MT19937_DEGREE = 19937;
+
+// Engines are 2^MT19937_JUMP_LOG2 numbers apart, engine i starts at
+// i * 2^MT19937_JUMP_LOG2 of the sequence of the seed.
+const int MT19937_JUMP_LOG2 = 1000;
+
+// Jumps are done by binary digits of the engine index: polynomial i is
+// x^(2^(MT19937_JUMP_LOG2 + i)) modulo the characteristic polynomial of the
+// transition, the number of engines is limited to 2^MT19937_JUMP_POLYNOMIALS.
+const int MT19937_JUMP_POLYNOMIALS = 13;
+
+// Polynomials over GF(2), bit i is the coefficient of x^i
+typedef std::vector<unsigned int> polynomial;
+
+bool get_bit(const polynomial& p, const int i)
+{
+    return (p[i / MT19937_W] >> (i % MT19937_W)) & 1;
+}
+
+void flip_bit(polynomial& p, const int i)
+{
+    p[i / MT19937_W] ^= 1U << (i % MT19937_W);
+}
+
+// MT19937 values (before tempering) of init_genrand(5489)
+std::vector<unsigned int> generate_sequence(const int size)
+{
+    std::vector<unsigned int> x(size);
+    x[0] = 5489U;
+    for (int i = 1; i < MT19937_N; i++)
+    {
+        x[i] = 1812433253U * (x[i - 1] ^ (x[i - 1] >> 30)) + i;
+    }
+    for (int i = MT19937_N; i < size; i++)
+    {
+        const unsigned int y = (x[i - MT19937_N] & 0x80000000U) | (x[i - MT19937_N + 1] & 0x7fffffffU);
+        x[i] = x[i - MT19937_N + MT19937_M] ^ (y >> 1) ^ ((y & 1) ? 0x9908b0dfU : 0U);
+    }
+    return x;
+}
+
+// Minimal polynomial of a bit sequence (Berlekamp-Massey over GF(2)), the
+// sequence of the lowest bit of the values has the characteristic polynomial
+// of the transition as its minimal polynomial. Returns the connection polynomial.
+polynomial berlekamp_massey(const std::vector<bool>& s, int& length)
+{
+    const int n = static_cast<int>(s.size());
+    const int words = n / MT19937_W + 2;
+    polynomial c(words, 0);
+    polynomial b(words, 0);
+    c[0] = b[0] = 1;
+    length = 0;
+    int m = -1;
+    for (int i = 0; i < n; i++)
+    {
+        bool d = s[i];
+        for (int j = 1; j <= length; j++)
+        {
+            d = d ^ (get_bit(c, j) && s[i - j]);
+        }
+        if (!d)
+        {
+            continue;
+        }
+        const polynomial t = c;
+        const int shift = i - m;
+        // c += x^shift * b
+        const int word_shift = shift / MT19937_W;
+        const int bit_shift = shift % MT19937_W;
+        for (int j = words - 1; j >= word_shift; j--)
+        {
+            unsigned int v = b[j - word_shift] << bit_shift;
+            if (bit_shift != 0 && j - word_shift - 1 >= 0)
+            {
+                v |= b[j - word_shift - 1] >> (MT19937_W - bit_shift);
+            }
+            c[j] ^= v;
+        }
+        if (2 * length <= i)
+        {
+            length = i + 1 - length;
+            m = i;
+            b = t;
+        }
+    }
+    return c;
+}
+
+// a^2 mod p, p is given by exponents of its nonzero terms except x^MT19937_DEGREE
+polynomial square_mod(const polynomial& a, const std::vector<int>& terms)
+{
+    polynomial c(2 * a.size(), 0);
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        for (int j = 0; j < MT19937_W; j++)
+        {
+            if ((a[i] >> j) & 1)
+            {
+                flip_bit(c, static_cast<int>(i) * 2 * MT19937_W + 2 * j);
+            }
+        }
+    }
+    // The characteristic polynomial is sparse, x^i = x^(i - DEGREE) * (p - x^DEGREE)
+    for (int i = 2 * MT19937_DEGREE - 2; i >= MT19937_DEGREE; i--)
+    {
+        if (!get_bit(c, i))
+        {
+            continue;
+        }
+        flip_bit(c, i);
+        for (const int e : terms)
+        {
+            flip_bit(c, i - MT19937_DEGREE + e);
+        }
+    }
+    c.resize(a.size());
+    return c;
+}
+
+void write_polynomials(std::ofstream& fout, const std::string name,
+                       const std::vector<polynomial>& a)
+{
+    fout << "static const unsigned int " << name
+         << "[MT19937_JUMP_POLYNOMIALS][MT19937_N] = {" << std::endl;
+    for (int k = 0; k < MT19937_JUMP_POLYNOMIALS; k++)
+    {
+        fout << "    {";
+        for (int i = 0; i < MT19937_N; i++)
+        {
+            if (i % 8 == 0)
+            {
+                fout << std::endl << "        ";
+            }
+            fout << a[k][i] << "U," << (i % 8 == 7 ? "" : " ");
+        }
+        fout << std::endl << "    }," << std::endl;
+    }
+    fout << "};" << std::endl;
+    fout << std::endl;
+}
+
+int main(int argc, char const *argv[]) {
+    if (argc != 2 || std::string(argv[1]) == "--help")
+    {
+        std::cout << "Usage:" << std::endl;
+        std::cout << "  ./mt19937_precomputed_generator ../../library/src/rng/rocrand_mt19937_precomputed.h" << std::endl;
+        return -1;
+    }
+
+    const std::vector<unsigned int> x = generate_sequence(MT19937_N + 2 * MT19937_DEGREE);
+    std::vector<bool> bits;
+    for (int i = MT19937_N; i < MT19937_N + 2 * MT19937_DEGREE; i++)
+    {
+        bits.push_back(x[i] & 1);
+    }
+    int length;
+    const polynomial c = berlekamp_massey(bits, length);
+    if (length != MT19937_DEGREE)
+    {
+        std::cout << "unexpected degree of the characteristic polynomial: " << length << std::endl;
+        return -1;
+    }
+    // The characteristic polynomial is the reversed connection polynomial
+    std::vector<int> terms;
+    for (int i = 0; i < MT19937_DEGREE; i++)
+    {
+        if (get_bit(c, MT19937_DEGREE - i))
+        {
+            terms.push_back(i);
+        }
+    }
+
+    // Polynomials have MT19937_N * MT19937_W >= MT19937_DEGREE coefficients
+    polynomial p(MT19937_N, 0);
+    flip_bit(p, 1);
+    for (int i = 0; i < MT19937_JUMP_LOG2; i++)
+    {
+        p = square_mod(p, terms);
+    }
+    std::vector<polynomial> jump_polynomials;
+    for (int i = 0; i < MT19937_JUMP_POLYNOMIALS; i++)
+    {
+        jump_polynomials.push_back(p);
+        p = square_mod(p, terms);
+    }
+
+    const std::string file_path(argv[1]);
+    std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
+    fout << R"(// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_MT19937_PRECOMPUTED_H_
+#define ROCRAND_MT19937_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/mt19937_precomputed_generator
+
+)";
+
+    fout << "#define MT19937_N " << MT19937_N << std::endl;
+    fout << "#define MT19937_JUMP_LOG2 " << MT19937_JUMP_LOG2 << std::endl;
+    fout << "#define MT19937_JUMP_POLYNOMIALS " << MT19937_JUMP_POLYNOMIALS << std::endl;
+    fout << std::endl;
+
+    // Polynomials are copied to the device by the generator
+    write_polynomials(fout, "h_mt19937_jump_polynomials", jump_polynomials);
+
+    fout << R"(
+#endif // ROCRAND_MT19937_PRECOMPUTED_H_
+)";
+
+    return 0;
+}
@@ -6,9 +6,42 @@
 #include <fstream>
 #include <string>
 #include <iomanip>
+#include <random>
+#include <vector>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <thread>
 
 using namespace std;
 
+// Number of dimensions of the library's headers (SOBOL_DIM)
+const unsigned int HEADER_DIMENSIONS = 20000;
+
+// Number of threads computing direction vectors of dimensions
+static unsigned int threads_count = std::max(1U, std::thread::hardware_concurrency());
+
+// Calls f(i) for all i in [0, n) on threads_count threads
+template<class F>
+void parallel_for(const int n, F f)
+{
+    const int count = std::min(static_cast<int>(threads_count), n);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < count; t++)
+    {
+        threads.emplace_back([=]() {
+            for (int i = t; i < n; i += count)
+            {
+                f(i);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
 struct sobol_set
 {
     unsigned int d;
@@ -29,6 +62,10 @@ bool read_sobol_set(struct sobol_set * inputs, int N, const std::string name)
 
     for (int i = 0; i < N; i++) {
         infile >> inputs[i].d >> inputs[i].s >> inputs[i].a;
+        if (!infile || inputs[i].s > 18) {
+            cout << "Input file contains only " << i << " polynomials, " << N << " are required!\n";
+            return false;
+        }
         for (unsigned int j = 0; j < inputs[i].s; j++)
             infile >> inputs[i].m[j];
     }
@@ -36,70 +73,88 @@ bool read_sobol_set(struct sobol_set * inputs, int N, const std::string name)
     return true;
 }
 
-void init_direction_vectors(struct sobol_set * inputs, unsigned int * directions, int n_directions, int n)
+// Dimensions are independent, they are computed in parallel
+template<class DirectionVectorType>
+void init_direction_vectors(struct sobol_set * inputs, DirectionVectorType * directions, int n_directions, int n)
 {
-    for (int i = 0 ; i < n ; i++) {
+    const DirectionVectorType one = 1;
+    parallel_for(n, [=](int i) {
+        DirectionVectorType * d = directions + static_cast<size_t>(i) * n_directions;
         if (i == 0)
             for (int j = 0 ; j < n_directions ; j++)
-                directions[j] = 1 << (31 - j);
+                d[j] = one << (n_directions - 1 - j);
         else
         {
             int ix = i - 1;
             int s = inputs[ix].s;
             for (int j = 0 ; j < s ; j++)
-                directions[j] = inputs[ix].m[j] << (31 - j);
+                d[j] = static_cast<DirectionVectorType>(inputs[ix].m[j]) << (n_directions - 1 - j);
             for (int j = s ; j < n_directions ; j++)
             {
-                directions[j] = directions[j - s] ^ (directions[j - s] >> s);
+                d[j] = d[j - s] ^ (d[j - s] >> s);
                 for (int k = 1 ; k < s ; k++)
-                    directions[j] ^= (((inputs[ix].a >> (s - 1 - k)) & 1) * directions[j - k]);
+                    d[j] ^= (((inputs[ix].a >> (s - 1 - k)) & 1) * d[j - k]);
             }
         }
-        directions += n_directions;
-    }
+    });
+}
+
+// Binary file of all tables (see library/src/rng/sobol_host_tables.hpp),
+// values are in host byte order:
+//   char[8]   "ROCRANDS"
+//   uint32    version (1)
+//   uint32    dimensions
+//   uint32    Sobol32 direction vectors [dimensions * 32]
+//   uint64    Sobol64 direction vectors [dimensions * 64]
+//   uint32    scrambled Sobol32 constants [dimensions]
+//   uint64    scrambled Sobol64 constants [dimensions]
+bool write_binary(const std::string& path, unsigned int dimensions,
+                  const unsigned int * directions, const unsigned long long * directions64,
+                  const unsigned int * constants, const unsigned long long * constants64)
+{
+    std::ofstream fout(path, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    const char magic[8] = { 'R', 'O', 'C', 'R', 'A', 'N', 'D', 'S' };
+    const uint32_t version = 1;
+    const uint32_t dims = dimensions;
+    fout.write(magic, sizeof(magic));
+    fout.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    fout.write(reinterpret_cast<const char *>(&dims), sizeof(dims));
+    fout.write(reinterpret_cast<const char *>(directions),
+               sizeof(unsigned int) * 32 * dimensions);
+    fout.write(reinterpret_cast<const char *>(directions64),
+               sizeof(unsigned long long) * 64 * dimensions);
+    fout.write(reinterpret_cast<const char *>(constants),
+               sizeof(unsigned int) * dimensions);
+    fout.write(reinterpret_cast<const char *>(constants64),
+               sizeof(unsigned long long) * dimensions);
+    return static_cast<bool>(fout);
 }
 
-void write_matrices(std::ofstream& fout, const std::string name, unsigned int * a, int n, int bits, bool is_device)
+template<class T>
+void write_matrices(std::ofstream& fout, const std::string name, const std::string size,
+                    T * a, int n, int bits, bool is_device)
 {
+    const char * type_name = sizeof(T) == 8 ? "unsigned long long" : "unsigned int";
+    const char * suffix = sizeof(T) == 8 ? "ULL" : "";
     fout << "static const ";
-    fout << (is_device ? "__device__ " : "") << "unsigned int " << name << "[SOBOL_N] = " << std::endl;
+    fout << (is_device ? "__device__ " : "") << type_name << " " << name << "[" << size << "] =" << std::endl;
     fout << "    {" << std::endl;
-    fout << "        ";
     for (int k = 0; k < n; k++)
     {
+        fout << ((k % bits == 0) ? "        " : " ");
         fout << "0x";
-        fout << hex << setw(8) << setfill('0') << a[k] << ", ";
-        if ((k + 1) % bits == 0 && k != 1)
-            fout  << std::endl << "        ";
+        fout << hex << setw(sizeof(T) * 2) << setfill('0') << a[k] << suffix << ",";
+        if ((k + 1) % bits == 0)
+            fout << std::endl;
     }
-    fout << std::endl;
+    fout << dec << std::endl;
     fout << "    };" << std::endl;
     fout << std::endl;
 }
 
-int main(int argc, char const *argv[])
+void write_header_begin(std::ofstream& fout, const std::string guard)
 {
-    if (argc != 3 || std::string(argv[1]) == "--help")
-    {
-        std::cout << "Usage:" << std::endl;
-        std::cout << "  ./sobol_direction_vector_generator new-joe-kuo-6.21201 ../../library/include/rocrand_sobol_precomputed.h" << std::endl;
-        std::cout << "  (the source file can be downloaded here: http://web.maths.unsw.edu.au/~fkuo/sobol/)" << std::endl;
-        return -1;
-    }
-
-    const std::string vector_file(argv[1]);
-    unsigned int SOBOL_DIM = 20000;
-    unsigned int SOBOL_N = SOBOL_DIM * 32;
-    struct sobol_set * inputs = new struct sobol_set[SOBOL_DIM];
-    unsigned int * directions = new unsigned int[SOBOL_N];
-    bool read = read_sobol_set(inputs, SOBOL_DIM, vector_file);
-
-    if (read)
-    {
-        init_direction_vectors(inputs, directions, 32, SOBOL_DIM);
-        const std::string file_path(argv[2]);
-        std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
-        fout << R"(// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+    fout << R"(// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
 //
 // Permission is hereby granted, free of charge, to any person obtaining a copy
 // of this software and associated documentation files (the "Software"), to deal
@@ -119,28 +174,158 @@ int main(int argc, char const *argv[])
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
-#ifndef ROCRAND_SOBOL_PRECOMPUTED_H_
-#define ROCRAND_SOBOL_PRECOMPUTED_H_
-
+)";
+    fout << "#ifndef " << guard << std::endl;
+    fout << "#define " << guard << std::endl;
+    fout << R"(
 // Auto-generated file. Do not edit!
 // Generated by tools/sobol_direction_vector_generator
 
 )";
+}
+
+void write_header_end(std::ofstream& fout, const std::string guard)
+{
+    fout << std::endl << "#endif // " << guard << std::endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    // Options are removed from the arguments, positional arguments remain
+    std::vector<std::string> args;
+    std::string binary_file;
+    unsigned int binary_dimensions = HEADER_DIMENSIONS;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        if (arg == "--threads" && i + 1 < argc)
+        {
+            const int threads = std::atoi(argv[++i]);
+            if (threads < 1)
+            {
+                std::cout << "threads must be positive" << std::endl;
+                return -1;
+            }
+            threads_count = threads;
+        }
+        else if (arg == "--binary" && i + 1 < argc)
+        {
+            binary_file = argv[++i];
+        }
+        else if (arg == "--dimensions" && i + 1 < argc)
+        {
+            const int dimensions = std::atoi(argv[++i]);
+            if (dimensions < 1)
+            {
+                std::cout << "dimensions must be positive" << std::endl;
+                return -1;
+            }
+            binary_dimensions = dimensions;
+        }
+        else
+        {
+            args.push_back(arg);
+        }
+    }
+
+    if (args.size() != 3 || args[0] == "--help")
+    {
+        std::cout << "Usage:" << std::endl;
+        std::cout << "  ./sobol_direction_vector_generator new-joe-kuo-6.21201 ../../library/include ../../library/src/rng" << std::endl;
+        std::cout << "      [--threads n]" << std::endl;
+        std::cout << "      [--binary rocrand_sobol_tables.bin [--dimensions n]]" << std::endl;
+        std::cout << "  (the source file can be downloaded here: http://web.maths.unsw.edu.au/~fkuo/sobol/)" << std::endl;
+        std::cout << "  Writes rocrand_sobol_precomputed.h and rocrand_scrambled_sobol_precomputed.h" << std::endl;
+        std::cout << "  (" << HEADER_DIMENSIONS << " dimensions) to the first directory and the internal" << std::endl;
+        std::cout << "  rocrand_sobol64_precomputed.h to the second one." << std::endl;
+        std::cout << "  With --binary all tables of n dimensions (" << HEADER_DIMENSIONS << " by default, up to the" << std::endl;
+        std::cout << "  number of polynomials of the source file + 1) are also written to one binary file," << std::endl;
+        std::cout << "  which the library loads instead of its tables when ROCRAND_SOBOL_TABLES is set to its path." << std::endl;
+        std::cout << "  Dimensions are computed by n threads (all hardware threads by default)." << std::endl;
+        return -1;
+    }
 
+    const std::string vector_file(args[0]);
+    const std::string output_dir(args[1]);
+    const std::string internal_output_dir(args[2]);
+    unsigned int SOBOL_DIM = HEADER_DIMENSIONS;
+    unsigned int SOBOL_N = SOBOL_DIM * 32;
+    unsigned int SOBOL64_N = SOBOL_DIM * 64;
+    // Tables of the headers are the first SOBOL_DIM dimensions
+    const unsigned int dimensions = std::max(SOBOL_DIM, binary_file.empty() ? 0 : binary_dimensions);
+    std::vector<sobol_set> inputs(dimensions - 1);
+    std::vector<unsigned int> directions(static_cast<size_t>(dimensions) * 32);
+    std::vector<unsigned long long> directions64(static_cast<size_t>(dimensions) * 64);
+    if (!read_sobol_set(inputs.data(), dimensions - 1, vector_file))
+    {
+        return -1;
+    }
+
+    // Scramble constants (digital shifts) are drawn from fixed seeds,
+    // so regenerating the file gives the same constants.
+    std::vector<unsigned int> constants(dimensions);
+    std::vector<unsigned long long> constants64(dimensions);
+    std::thread constants_thread([&]() {
+        std::mt19937 gen(5489u);
+        std::mt19937_64 gen64(5489ull);
+        for (unsigned int i = 0; i < dimensions; i++)
+        {
+            constants[i] = gen();
+            constants64[i] = gen64();
+        }
+    });
+    init_direction_vectors(inputs.data(), directions.data(), 32, dimensions);
+    init_direction_vectors(inputs.data(), directions64.data(), 64, dimensions);
+    constants_thread.join();
+
+    {
+        std::ofstream fout(output_dir + "/rocrand_sobol_precomputed.h",
+                           std::ios_base::out | std::ios_base::trunc);
+        write_header_begin(fout, "ROCRAND_SOBOL_PRECOMPUTED_H_");
         fout << "#define SOBOL_DIM " << SOBOL_DIM << std::endl;
         fout << "#define SOBOL_N " << SOBOL_N << std::endl;
         fout << std::endl;
+        write_matrices(fout, "h_sobol32_direction_vectors", "SOBOL_N",
+                       directions.data(), SOBOL_N, 32, false);
+        write_header_end(fout, "ROCRAND_SOBOL_PRECOMPUTED_H_");
+    }
 
-        write_matrices(fout, "h_sobol32_direction_vectors", directions, SOBOL_N,
-        32, false);
+    {
+        std::ofstream fout(internal_output_dir + "/rocrand_sobol64_precomputed.h",
+                           std::ios_base::out | std::ios_base::trunc);
+        write_header_begin(fout, "ROCRAND_SOBOL64_PRECOMPUTED_H_");
+        fout << "#include <rocrand_sobol_precomputed.h>" << std::endl;
+        fout << std::endl;
+        fout << "#define SOBOL64_N " << SOBOL64_N << std::endl;
+        fout << std::endl;
+        write_matrices(fout, "h_sobol64_direction_vectors", "SOBOL64_N",
+                       directions64.data(), SOBOL64_N, 64, false);
+        write_header_end(fout, "ROCRAND_SOBOL64_PRECOMPUTED_H_");
+    }
 
-        fout << R"(
-#endif // ROCRAND_SOBOL_PRECOMPUTED_H_
-)";
+    {
+        std::ofstream fout(output_dir + "/rocrand_scrambled_sobol_precomputed.h",
+                           std::ios_base::out | std::ios_base::trunc);
+        write_header_begin(fout, "ROCRAND_SCRAMBLED_SOBOL_PRECOMPUTED_H_");
+        fout << "#include \"rocrand_sobol_precomputed.h\"" << std::endl;
+        fout << std::endl;
+        write_matrices(fout, "h_scrambled_sobol32_constants", "SOBOL_DIM",
+                       constants.data(), SOBOL_DIM, 32, false);
+        write_matrices(fout, "h_scrambled_sobol64_constants", "SOBOL_DIM",
+                       constants64.data(), SOBOL_DIM, 16, false);
+        write_header_end(fout, "ROCRAND_SCRAMBLED_SOBOL_PRECOMPUTED_H_");
     }
 
-    delete[] inputs;
-    delete[] directions;
+    if (!binary_file.empty())
+    {
+        if (!write_binary(binary_file, binary_dimensions,
+                          directions.data(), directions64.data(),
+                          constants.data(), constants64.data()))
+        {
+            std::cout << "Binary file " << binary_file << " cannot be written!" << std::endl;
+            return -1;
+        }
+    }
 
     return 0;
 }
@@ -2,6 +2,10 @@
 #include <fstream>
 #include <string>
 #include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include <thread>
 
 
 const int XORWOW_N = 5;  // 5 values
@@ -9,13 +13,18 @@ const int XORWOW_M = 32; // 32-bit each
 
 const int XORWOW_SIZE = XORWOW_M * XORWOW_N * XORWOW_N;
 
-const int XORWOW_JUMP_MATRICES = 32;
-const int XORWOW_JUMP_LOG2 = 2;
-
 const int XORWOW_SEQUENCE_JUMP_LOG2 = 67;
 
-static unsigned int jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE];
-static unsigned int sequence_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE];
+// Jumps are done by base 2^XORWOW_JUMP_LOG2 digits of the distance.
+// XORWOW_JUMP_MULTIPLES matrices are stored per digit:
+// 1 - A^(base^i), which is applied up to (base - 1) times for the digit;
+// base - 1 - A^(k * base^i) for all k, so one product is enough per digit.
+static int XORWOW_JUMP_LOG2 = 2;
+static int XORWOW_JUMP_MULTIPLES = 1;
+static int XORWOW_JUMP_MATRICES = 32;
+
+static std::vector<unsigned int> jump_matrices;
+static std::vector<unsigned int> sequence_jump_matrices;
 
 
 void copy_mat(unsigned int * dst, const unsigned int * src)
@@ -34,33 +43,86 @@ void copy_vec(unsigned int * dst, const unsigned int * src)
     }
 }
 
-void mul_mat_vec_inplace(const unsigned int * m, unsigned int * v)
+// Number of threads computing multiples of digits (see generate_jump_matrices())
+static unsigned int threads_count = std::max(1U, std::thread::hardware_concurrency());
+
+// Calls f(i) for all i in [0, n) on threads_count threads
+template<class F>
+void parallel_for(const int n, F f)
 {
-    unsigned int r[XORWOW_N] = { 0 };
-    for (int i = 0; i < XORWOW_N; i++)
+    const int count = std::min(static_cast<int>(threads_count), n);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < count; t++)
     {
-        for (int j = 0; j < XORWOW_M; j++)
-        {
-            if (v[i] & (1 << j))
+        threads.emplace_back([=]() {
+            for (int i = t; i < n; i += count)
             {
-                for (int k = 0; k < XORWOW_N; k++)
-                {
-                    r[k] ^= m[XORWOW_N * (i * XORWOW_M + j) + k];
-                }
+                f(i);
             }
-        }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
     }
-    copy_vec(v, r);
 }
 
-void mul_mat_mat_inplace(unsigned int * a, const unsigned int * b)
+// Computes c = a * b over GF(2): row r of c is the XOR of rows of b selected
+// by bits of row r of a. XORs of all subsets of 8 consecutive rows of b are
+// tabulated first (method of Four Russians), so each row of c takes one lookup
+// per byte of the row of a instead of one conditional XOR per bit.
+void mul_mat_mat(unsigned int * c, const unsigned int * a, const unsigned int * b)
 {
-    for (int i = 0; i < XORWOW_N * XORWOW_M; i++)
+    const int groups = XORWOW_N * XORWOW_M / 8;
+    std::vector<unsigned int> tables(groups * 256 * XORWOW_N);
+    for (int g = 0; g < groups; g++)
+    {
+        unsigned int * table = &tables[g * 256 * XORWOW_N];
+        for (int k = 0; k < XORWOW_N; k++)
+        {
+            table[k] = 0;
+        }
+        for (int v = 1; v < 256; v++)
+        {
+            // The table of v is the table of v without its lowest bit
+            // and the row of the lowest bit
+            int bit = 0;
+            while (!(v & (1 << bit)))
+            {
+                bit++;
+            }
+            const unsigned int * prev = table + (v & (v - 1)) * XORWOW_N;
+            const unsigned int * row = b + (g * 8 + bit) * XORWOW_N;
+            for (int k = 0; k < XORWOW_N; k++)
+            {
+                table[v * XORWOW_N + k] = prev[k] ^ row[k];
+            }
+        }
+    }
+
+    for (int r = 0; r < XORWOW_N * XORWOW_M; r++)
     {
-        mul_mat_vec_inplace(b, a + i * XORWOW_N);
+        unsigned int v[XORWOW_N] = { 0 };
+        for (int g = 0; g < groups; g++)
+        {
+            const unsigned int byte = (a[r * XORWOW_N + g / 4] >> (8 * (g % 4))) & 0xFF;
+            const unsigned int * t = &tables[(g * 256 + byte) * XORWOW_N];
+            for (int k = 0; k < XORWOW_N; k++)
+            {
+                v[k] ^= t[k];
+            }
+        }
+        copy_vec(c + r * XORWOW_N, v);
     }
 }
 
+void square_mat_inplace(unsigned int * a)
+{
+    unsigned int t[XORWOW_SIZE];
+    mul_mat_mat(t, a, a);
+    copy_mat(a, t);
+}
+
 void mat_pow(unsigned int * a, const unsigned int * b, const unsigned long long power)
 {
     // Identity matrix
@@ -77,18 +139,17 @@ void mat_pow(unsigned int * a, const unsigned int * b, const unsigned long long
 
     // Exponentiation by squaring
     unsigned int y[XORWOW_SIZE];
+    unsigned int t[XORWOW_SIZE];
     copy_mat(y, b);
     for (unsigned long long p = power; p > 0; p >>= 1)
     {
         if (p & 1)
         {
-            mul_mat_mat_inplace(a, y);
+            mul_mat_mat(t, a, y);
+            copy_mat(a, t);
         }
 
-        // Square the matrix
-        unsigned int t[XORWOW_SIZE];
-        copy_mat(t, y);
-        mul_mat_mat_inplace(y, t);
+        square_mat_inplace(y);
     }
 }
 
@@ -112,6 +173,36 @@ struct rocrand_xorwow_state
     }
 };
 
+// Writes A^(k * base^i) for all digits i and k = 1...XORWOW_JUMP_MULTIPLES
+void generate_jump_matrices(unsigned int * matrices, const unsigned int * a)
+{
+    const int digits = XORWOW_JUMP_MATRICES / XORWOW_JUMP_MULTIPLES;
+
+    // A^(base^i) of all digits, XORWOW_JUMP_LOG2 squarings per digit
+    std::vector<unsigned int> powers(digits * XORWOW_SIZE);
+    copy_mat(powers.data(), a);
+    for (int i = 1; i < digits; i++)
+    {
+        unsigned int * p = &powers[i * XORWOW_SIZE];
+        copy_mat(p, p - XORWOW_SIZE);
+        for (int s = 0; s < XORWOW_JUMP_LOG2; s++)
+        {
+            square_mat_inplace(p);
+        }
+    }
+
+    // Multiples of different digits are independent
+    parallel_for(digits, [&](int i) {
+        const unsigned int * p = &powers[i * XORWOW_SIZE];
+        unsigned int * m = matrices + i * XORWOW_JUMP_MULTIPLES * XORWOW_SIZE;
+        copy_mat(m, p);
+        for (int k = 1; k < XORWOW_JUMP_MULTIPLES; k++)
+        {
+            mul_mat_mat(m + k * XORWOW_SIZE, m + (k - 1) * XORWOW_SIZE, p);
+        }
+    });
+}
+
 void generate_matrices()
 {
     unsigned int one_step[XORWOW_SIZE];
@@ -137,19 +228,10 @@ void generate_matrices()
         }
     }
 
-    {
-        unsigned int a[XORWOW_SIZE];
-        unsigned int b[XORWOW_SIZE];
-        copy_mat(a, one_step);
+    jump_matrices.resize(XORWOW_JUMP_MATRICES * XORWOW_SIZE);
+    sequence_jump_matrices.resize(XORWOW_JUMP_MATRICES * XORWOW_SIZE);
 
-        copy_mat(jump_matrices[0], a);
-        for (int k = 1; k < XORWOW_JUMP_MATRICES; k++)
-        {
-            copy_mat(b, a);
-            mat_pow(a, b, (1 << XORWOW_JUMP_LOG2));
-            copy_mat(jump_matrices[k], a);
-        }
-    }
+    generate_jump_matrices(jump_matrices.data(), one_step);
 
     {
         unsigned int a[XORWOW_SIZE];
@@ -161,13 +243,7 @@ void generate_matrices()
         // For 67: (A^(2^33))^(2^34) = A^(2^67)
         mat_pow(a, b, 1ULL << (XORWOW_SEQUENCE_JUMP_LOG2 - XORWOW_SEQUENCE_JUMP_LOG2 / 2));
 
-        copy_mat(sequence_jump_matrices[0], a);
-        for (int k = 1; k < XORWOW_JUMP_MATRICES; k++)
-        {
-            copy_mat(b, a);
-            mat_pow(a, b, (1 << XORWOW_JUMP_LOG2));
-            copy_mat(sequence_jump_matrices[k], a);
-        }
+        generate_jump_matrices(sequence_jump_matrices.data(), a);
     }
 }
 
@@ -194,16 +270,55 @@ void write_matrices(std::ofstream& fout, const std::string name, unsigned int *
 
 
 int main(int argc, char const *argv[]) {
-    if (argc != 2 || std::string(argv[1]) == "--help")
+    // Options are removed from the arguments, positional arguments remain
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        if (arg == "--threads" && i + 1 < argc)
+        {
+            const int threads = std::atoi(argv[++i]);
+            if (threads < 1)
+            {
+                std::cout << "threads must be positive" << std::endl;
+                return -1;
+            }
+            threads_count = threads;
+        }
+        else
+        {
+            args.push_back(arg);
+        }
+    }
+
+    if (args.size() < 1 || args.size() > 2 || args[0] == "--help")
     {
         std::cout << "Usage:" << std::endl;
-        std::cout << "  ./xorwow_precomputed_generator ../../library/include/rocrand_xorwow_precomputed.h" << std::endl;
+        std::cout << "  ./xorwow_precomputed_generator ../../library/include/rocrand_xorwow_precomputed.h [jump_log2] [--threads n]" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Without jump_log2 one matrix per base 4 digit is generated (default tables)." << std::endl;
+        std::cout << "With jump_log2 (1...8) all 2^jump_log2 - 1 multiples per digit are generated:" << std::endl;
+        std::cout << "tables are larger but skipping ahead takes at most one product per digit." << std::endl;
+        std::cout << "Multiples of digits are computed by n threads (all hardware threads by default)." << std::endl;
         return -1;
     }
 
+    if (args.size() == 2)
+    {
+        const int jump_log2 = std::atoi(args[1].c_str());
+        if (jump_log2 < 1 || jump_log2 > 8)
+        {
+            std::cout << "jump_log2 must be in range [1, 8]" << std::endl;
+            return -1;
+        }
+        XORWOW_JUMP_LOG2 = jump_log2;
+        XORWOW_JUMP_MULTIPLES = (1 << jump_log2) - 1;
+        XORWOW_JUMP_MATRICES = (64 + jump_log2 - 1) / jump_log2 * XORWOW_JUMP_MULTIPLES;
+    }
+
     generate_matrices();
 
-    const std::string file_path(argv[1]);
+    const std::string file_path(args[0]);
     std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
     fout << R"(// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
 //
@@ -238,17 +353,18 @@ int main(int argc, char const *argv[]) {
     fout << "#define XORWOW_SIZE (XORWOW_M * XORWOW_N * XORWOW_N)" << std::endl;
     fout << "#define XORWOW_JUMP_MATRICES " << XORWOW_JUMP_MATRICES << std::endl;
     fout << "#define XORWOW_JUMP_LOG2 " << XORWOW_JUMP_LOG2 << std::endl;
+    fout << "#define XORWOW_JUMP_MULTIPLES " << XORWOW_JUMP_MULTIPLES << std::endl;
     fout << std::endl;
 
     write_matrices(fout, "d_xorwow_jump_matrices",
-        static_cast<unsigned int *>(&jump_matrices[0][0]), true);
+        jump_matrices.data(), true);
     write_matrices(fout, "h_xorwow_jump_matrices",
-        static_cast<unsigned int *>(&jump_matrices[0][0]), false);
+        jump_matrices.data(), false);
 
     write_matrices(fout, "d_xorwow_sequence_jump_matrices",
-        static_cast<unsigned int *>(&sequence_jump_matrices[0][0]), true);
+        sequence_jump_matrices.data(), true);
     write_matrices(fout, "h_xorwow_sequence_jump_matrices",
-        static_cast<unsigned int *>(&sequence_jump_matrices[0][0]), false);
+        sequence_jump_matrices.data(), false);
 
     fout << R"(
 #endif // ROCRAND_XORWOW_PRECOMPUTED_H_
@@ -0,0 +1,233 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+const int XOSHIRO128PP_N = 4;  // 4 values
+const int XOSHIRO128PP_M = 32; // 32-bit each
+
+const int XOSHIRO128PP_DEGREE = XOSHIRO128PP_N * XOSHIRO128PP_M;
+
+const int XOSHIRO128PP_SEQUENCE_JUMP_LOG2 = 64;
+
+// Jumps are done by binary digits of the distance: polynomial i is x^(2^i)
+// modulo the characteristic polynomial of the transition, applying it
+// takes XOSHIRO128PP_DEGREE steps.
+const int XOSHIRO128PP_JUMP_POLYNOMIALS = 64;
+
+// Polynomials over GF(2) of degree < 2 * XOSHIRO128PP_DEGREE, bit i is the
+// coefficient of x^i
+typedef std::vector<bool> polynomial;
+
+struct rocrand_xoshiro128pp_state
+{
+    unsigned int s[4];
+
+    void discard()
+    {
+        const unsigned int t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = (s[3] << 11) | (s[3] >> 21);
+    }
+};
+
+// Minimal polynomial of a bit sequence (Berlekamp-Massey over GF(2)), the
+// sequence of the lowest bit of s[0] has the characteristic polynomial of the
+// transition as its minimal polynomial. Returns the connection polynomial.
+polynomial berlekamp_massey(const std::vector<bool>& s, int& length)
+{
+    const size_t n = s.size();
+    polynomial c(n + 1, false);
+    polynomial b(n + 1, false);
+    c[0] = b[0] = true;
+    length = 0;
+    int m = -1;
+    for (size_t i = 0; i < n; i++)
+    {
+        bool d = s[i];
+        for (int j = 1; j <= length; j++)
+        {
+            d = d ^ (c[j] && s[i - j]);
+        }
+        if (!d)
+        {
+            continue;
+        }
+        const polynomial t = c;
+        const size_t shift = i - m;
+        for (size_t j = 0; j + shift <= n; j++)
+        {
+            c[j + shift] = c[j + shift] ^ b[j];
+        }
+        if (2 * length <= static_cast<int>(i))
+        {
+            length = static_cast<int>(i) + 1 - length;
+            m = static_cast<int>(i);
+            b = t;
+        }
+    }
+    return c;
+}
+
+// c = a * b mod p, p is monic of degree XOSHIRO128PP_DEGREE
+polynomial mul_mod(const polynomial& a, const polynomial& b, const polynomial& p)
+{
+    polynomial c(2 * XOSHIRO128PP_DEGREE, false);
+    for (int i = 0; i < XOSHIRO128PP_DEGREE; i++)
+    {
+        if (!a[i])
+        {
+            continue;
+        }
+        for (int j = 0; j < XOSHIRO128PP_DEGREE; j++)
+        {
+            c[i + j] = c[i + j] ^ b[j];
+        }
+    }
+    for (int i = 2 * XOSHIRO128PP_DEGREE - 1; i >= XOSHIRO128PP_DEGREE; i--)
+    {
+        if (!c[i])
+        {
+            continue;
+        }
+        for (int j = 0; j <= XOSHIRO128PP_DEGREE; j++)
+        {
+            c[i - XOSHIRO128PP_DEGREE + j] = c[i - XOSHIRO128PP_DEGREE + j] ^ p[j];
+        }
+    }
+    c.resize(XOSHIRO128PP_DEGREE);
+    return c;
+}
+
+// Writes x^(2^(first + i)) mod p for i = 0...XOSHIRO128PP_JUMP_POLYNOMIALS - 1
+void generate_jump_polynomials(std::vector<unsigned int>& polynomials,
+                               const polynomial& p,
+                               const int first)
+{
+    polynomial x(XOSHIRO128PP_DEGREE, false);
+    x[1] = true;
+    for (int i = 0; i < first; i++)
+    {
+        x = mul_mod(x, x, p);
+    }
+    polynomials.assign(XOSHIRO128PP_JUMP_POLYNOMIALS * XOSHIRO128PP_N, 0);
+    for (int i = 0; i < XOSHIRO128PP_JUMP_POLYNOMIALS; i++)
+    {
+        for (int j = 0; j < XOSHIRO128PP_DEGREE; j++)
+        {
+            if (x[j])
+            {
+                polynomials[i * XOSHIRO128PP_N + j / XOSHIRO128PP_M] |= 1U << (j % XOSHIRO128PP_M);
+            }
+        }
+        x = mul_mod(x, x, p);
+    }
+}
+
+void write_polynomials(std::ofstream& fout, const std::string name,
+                       const std::vector<unsigned int>& a, bool is_device)
+{
+    fout << "static const " << (is_device ? "__device__ " : "") << "unsigned int " << name
+         << "[XOSHIRO128PP_JUMP_POLYNOMIALS][XOSHIRO128PP_N] = {" << std::endl;
+    for (int k = 0; k < XOSHIRO128PP_JUMP_POLYNOMIALS; k++)
+    {
+        fout << "    { ";
+        for (int i = 0; i < XOSHIRO128PP_N; i++)
+        {
+            fout << a[k * XOSHIRO128PP_N + i] << "U, ";
+        }
+        fout << "}," << std::endl;
+    }
+    fout << "};" << std::endl;
+    fout << std::endl;
+}
+
+int main(int argc, char const *argv[]) {
+    if (argc != 2 || std::string(argv[1]) == "--help")
+    {
+        std::cout << "Usage:" << std::endl;
+        std::cout << "  ./xoshiro128pp_precomputed_generator ../../library/include/rocrand_xoshiro128pp_precomputed.h" << std::endl;
+        return -1;
+    }
+
+    rocrand_xoshiro128pp_state state = { { 1, 2, 3, 4 } };
+    std::vector<bool> bits;
+    for (int i = 0; i < 2 * XOSHIRO128PP_DEGREE; i++)
+    {
+        bits.push_back(state.s[0] & 1);
+        state.discard();
+    }
+    int length;
+    const polynomial c = berlekamp_massey(bits, length);
+    if (length != XOSHIRO128PP_DEGREE)
+    {
+        std::cout << "unexpected degree of the characteristic polynomial: " << length << std::endl;
+        return -1;
+    }
+    // The characteristic polynomial is the reversed connection polynomial
+    polynomial p(XOSHIRO128PP_DEGREE + 1, false);
+    for (int i = 0; i <= XOSHIRO128PP_DEGREE; i++)
+    {
+        p[i] = c[XOSHIRO128PP_DEGREE - i];
+    }
+
+    std::vector<unsigned int> jump_polynomials;
+    std::vector<unsigned int> sequence_jump_polynomials;
+    generate_jump_polynomials(jump_polynomials, p, 0);
+    generate_jump_polynomials(sequence_jump_polynomials, p, XOSHIRO128PP_SEQUENCE_JUMP_LOG2);
+
+    const std::string file_path(argv[1]);
+    std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
+    fout << R"(// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_XOSHIRO128PP_PRECOMPUTED_H_
+#define ROCRAND_XOSHIRO128PP_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/xoshiro128pp_precomputed_generator
+
+)";
+
+    fout << "#define XOSHIRO128PP_N " << XOSHIRO128PP_N << std::endl;
+    fout << "#define XOSHIRO128PP_JUMP_POLYNOMIALS " << XOSHIRO128PP_JUMP_POLYNOMIALS << std::endl;
+    fout << std::endl;
+
+    write_polynomials(fout, "d_xoshiro128pp_jump_polynomials",
+        jump_polynomials, true);
+    write_polynomials(fout, "h_xoshiro128pp_jump_polynomials",
+        jump_polynomials, false);
+
+    write_polynomials(fout, "d_xoshiro128pp_sequence_jump_polynomials",
+        sequence_jump_polynomials, true);
+    write_polynomials(fout, "h_xoshiro128pp_sequence_jump_polynomials",
+        sequence_jump_polynomials, false);
+
+    fout << R"(
+#endif // ROCRAND_XOSHIRO128PP_PRECOMPUTED_H_
+)";
+
+    return 0;
+}